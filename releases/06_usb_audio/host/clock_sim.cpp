@@ -0,0 +1,268 @@
+// clock_sim — USB Audio's clock recovery (src/usb_clock.h) against drifting virtual clocks,
+// on Linux, beside the fixed-threshold scheme it replaces.
+//
+// The card's sample clock and the host's USB frame clock each wander by tens of ppm.
+// Events run in time order:
+//   - card sample tick (core 1): play one frame from the OUT ring, record one into the
+//     IN ring (a 1 kHz tone in the card's time);
+//   - host SOF: the host sends an OUT packet (its 1 kHz tone, sized by the feedback value
+//     it last read, or the nominal rate for the old scheme) and takes one IN packet;
+//   - audio_task (core 0), a little after each SOF, with occasional long delays as under
+//     a MIDI burst.
+// Reported per direction: latency (frames buffered, as ms), slips (ring or packet
+// underruns and overflows) and THD+N of the tone after 30 s of settling.
+//
+//   ./clock_sim
+#include "../src/usb_clock.h"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <deque>
+#include <random>
+#include <vector>
+
+static constexpr double kPi = 3.14159265358979323846;
+
+struct Scenario {
+    const char *name;
+    uint32_t rate;
+    double hostPpm, cardPpm;       // offsets
+    double wanderPpm, wanderSec;   // card drift: sinusoidal wander on top
+    double lateChance;             // chance per frame that audio_task runs 0.5..1.8 ms late
+};
+
+struct Result {
+    double outLatMs = 0, outLatMaxMs = 0, inLatMs = 0, inLatMaxMs = 0;
+    uint32_t outSlips = 0, inSlips = 0;
+    double outThd = 0, inThd = 0;
+};
+
+// THD+N of a recorded tone, dB: 4-term Blackman-Harris, 16384-point blocks, everything
+// but the tone's peak +-8 bins (and DC) counts as distortion and noise.
+static void fft(std::vector<std::complex<double>> &a)
+{
+    size_t n = a.size();
+    for (size_t i = 1, j = 0; i < n; i++) {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+        if (i < j) std::swap(a[i], a[j]);
+    }
+    for (size_t len = 2; len <= n; len <<= 1) {
+        std::complex<double> w = std::polar(1.0, -2 * kPi / len);
+        for (size_t i = 0; i < n; i += len) {
+            std::complex<double> wn = 1;
+            for (size_t k = 0; k < len / 2; k++, wn *= w) {
+                auto u = a[i + k], v = a[i + k + len / 2] * wn;
+                a[i + k] = u + v;
+                a[i + k + len / 2] = u - v;
+            }
+        }
+    }
+}
+
+static double thdn_db(const std::vector<int16_t> &x)
+{
+    const size_t N = 16384;
+    double sig = 0, rest = 0;
+    for (size_t b = 0; b + N <= x.size(); b += N * 8) {
+        std::vector<std::complex<double>> a(N);
+        for (size_t i = 0; i < N; i++) {
+            double t = 2 * kPi * i / (N - 1);
+            double w = 0.35875 - 0.48829 * cos(t) + 0.14128 * cos(2 * t) - 0.01168 * cos(3 * t);
+            a[i] = w * x[b + i];
+        }
+        fft(a);
+        size_t peak = 1;
+        for (size_t i = 1; i < N / 2; i++) if (std::abs(a[i]) > std::abs(a[peak])) peak = i;
+        for (size_t i = 1; i < N / 2; i++) {
+            double p = std::norm(a[i]);
+            if (i + 8 >= peak && i <= peak + 8) sig += p; else if (i > 8) rest += p;
+        }
+    }
+    return 10 * log10(rest / sig);
+}
+
+// Frames are reduced to channel 1 here: the rings' layout is the firmware's business.
+template <bool NEW>
+static Result run(const Scenario &sc, double seconds)
+{
+    const double fs = sc.rate;
+    const uint32_t kRing = 4096 / 3;                // old ring: 4096 words, 3 per frame
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<double> uni(0, 1);
+
+    std::deque<int16_t> outFifo, outRing;           // TinyUSB OUT FIFO, OUT ring
+    std::deque<int16_t> inRing, inFifo;             // IN ring, TinyUSB IN FIFO
+    std::deque<uint32_t> inPackets;                 // old scheme: sizes of queued packets
+
+    RateServo spkServo, micServo;
+    FracResampler resampler;
+    const int32_t packet = (int32_t)(sc.rate / 1000);
+    const int32_t spkTarget = 3 * packet, micTarget = packet + packet / 2 + 8;
+    if (NEW) {
+        spkServo.init(sc.rate, spkTarget);
+        micServo.init(sc.rate, micTarget);
+        resampler.init();
+    }
+
+    // Stream start, as tud_audio_set_itf_cb does it
+    for (int i = 0; i < (NEW ? spkTarget : 200); i++) outRing.push_back(0);
+    if (NEW) for (int i = 0; i < packet; i++) inFifo.push_back(0);
+
+    uint32_t feedback = (uint32_t)(((uint64_t)sc.rate << 16) / 1000), fbLatched = feedback;
+    uint32_t hostFbAcc = 0, nominalAcc = 0, oldMicAcc = 0, hostInAcc = 0, taskInAcc = 0;
+    uint64_t hostOutIdx = 0, cardIdx = 0;
+    double tCard = 0, tSof = 0, tTask = 1e9;
+    uint32_t sofs = 0, pendingSofs = 0;
+
+    Result r;
+    double outLatSum = 0, inLatSum = 0;
+    uint64_t latN = 0;
+    std::vector<int16_t> dacRec, hostRec;
+    const double settle = 30;
+
+    auto cardPpm = [&](double t) { return sc.cardPpm + sc.wanderPpm * sin(2 * kPi * t / sc.wanderSec); };
+    auto nominalFrames = [&]() {                     // host frames per USB frame (44.1k: 44/45)
+        nominalAcc += sc.rate;
+        uint32_t n = nominalAcc / 1000;
+        nominalAcc %= 1000;
+        return n;
+    };
+
+    while (tCard < seconds) {
+        if (tCard <= tSof && tCard <= tTask) {
+            // --- Card sample tick (core 1) ---
+            int16_t s = 0;
+            if (!outRing.empty()) { s = outRing.front(); outRing.pop_front(); }
+            else if (tCard > 1) r.outSlips++;
+            if (tCard > settle) dacRec.push_back(s);
+            int16_t adc = (int16_t)lrint(16000 * sin(2 * kPi * 1000 * cardIdx / fs));
+            if (inRing.size() < kRing) inRing.push_back(adc); else r.inSlips++;
+            cardIdx++;
+            if (tCard > settle) {
+                outLatSum += outRing.size() + outFifo.size();
+                inLatSum += inRing.size() + inFifo.size() + (NEW ? FracResampler::TAPS / 2 : 0);
+                latN++;
+                r.outLatMaxMs = std::max(r.outLatMaxMs, (outRing.size() + outFifo.size()) * 1000 / fs);
+                r.inLatMaxMs = std::max(r.inLatMaxMs, (inRing.size() + inFifo.size()) * 1000 / fs);
+            }
+            tCard += 1 / (fs * (1 + cardPpm(tCard) * 1e-6));
+        } else if (tSof <= tTask) {
+            // --- Host SOF ---
+            if (sofs % 32 == 0) fbLatched = feedback;   // bRefresh 5: every 32 frames
+            uint32_t n;
+            if (NEW) { hostFbAcc += fbLatched; n = hostFbAcc >> 16; hostFbAcc &= 0xFFFF; }
+            else n = nominalFrames();
+            for (uint32_t i = 0; i < n; i++, hostOutIdx++)
+                outFifo.push_back((int16_t)lrint(16000 * sin(2 * kPi * 1000 * hostOutIdx / fs)));
+
+            // IN: the host takes one packet
+            uint32_t want = 0;
+            if (NEW) { hostInAcc += sc.rate; want = hostInAcc / 1000; hostInAcc %= 1000; } else if (!inPackets.empty()) { want = inPackets.front(); inPackets.pop_front(); }
+            else if (tCard > 1) r.inSlips++;
+            if (inFifo.size() < want && tCard > 1) r.inSlips++;
+            for (uint32_t i = 0; i < want && !inFifo.empty(); i++) {
+                if (tCard > settle) hostRec.push_back(inFifo.front());
+                inFifo.pop_front();
+            }
+
+            sofs++;
+            pendingSofs++;
+            double late = uni(rng) < sc.lateChance ? 0.5e-3 + 1.3e-3 * uni(rng) : 0.25e-3 * uni(rng);
+            tTask = std::min(tTask, tSof + late);
+            tSof += 1e-3 / (1 + sc.hostPpm * 1e-6);
+        } else {
+            // --- audio_task (core 0) ---
+            uint32_t frames = pendingSofs;
+            pendingSofs = 0;
+            tTask = 1e9;
+
+            // Speaker: everything TinyUSB has, into the ring
+            while (!outFifo.empty()) {
+                if (outRing.size() < kRing) outRing.push_back(outFifo.front()); else r.outSlips++;
+                outFifo.pop_front();
+            }
+            if (NEW) {
+                int32_t rate = spkServo.update((int32_t)outRing.size());
+                uint32_t nominal = (uint32_t)(((uint64_t)sc.rate << 16) / 1000);
+                feedback = nominal - (uint32_t)(((int64_t)nominal * rate) >> 32);
+            }
+
+            // Mic
+            if (NEW) {
+                int32_t rate = micServo.update((int32_t)inRing.size());
+                for (uint32_t f = 0; f < frames; f++) {
+                    taskInAcc += sc.rate;
+                    uint32_t n = taskInAcc / 1000;
+                    taskInAcc %= 1000;
+                    for (uint32_t i = 0; i < n; i++) {
+                        int16_t o, x;
+                        resampler.process<1>(rate, &o, [&]() -> const int16_t * {
+                            if (inRing.empty()) { if (tCard > 1) r.inSlips++; return nullptr; }
+                            x = inRing.front();
+                            inRing.pop_front();
+                            return &x;
+                        });
+                        inFifo.push_back(o);
+                    }
+                }
+            } else {
+                for (uint32_t f = 0; f < frames; f++) {
+                    // The old audio_task: packet size from the ring count (in words)
+                    uint32_t count = (uint32_t)inRing.size() * 3, n;
+                    if (sc.rate == 44100) {
+                        uint32_t target = 44100;
+                        if (count > 3000) target = 44150;
+                        else if (count > 2200) target = 44105;
+                        else if (count < 1000) target = 44000;
+                        else if (count < 1900) target = 44095;
+                        oldMicAcc += target; n = oldMicAcc / 1000; oldMicAcc %= 1000;
+                    } else {
+                        n = packet;
+                        if (count > 3000) n = packet + 1;
+                        else if (count < 1000) n = packet - 1;
+                    }
+                    for (uint32_t i = 0; i < n; i++) {
+                        if (!inRing.empty()) { inFifo.push_back(inRing.front()); inRing.pop_front(); }
+                        else { inFifo.push_back(0); if (tCard > 1) r.inSlips++; }
+                    }
+                    inPackets.push_back(n);
+                }
+            }
+        }
+    }
+    r.outLatMs = outLatSum / latN * 1000 / fs;
+    r.inLatMs = inLatSum / latN * 1000 / fs;
+    r.outThd = thdn_db(dacRec);
+    r.inThd = thdn_db(hostRec);
+    return r;
+}
+
+int main()
+{
+    const double kSeconds = 600;
+    const Scenario scenarios[] = {
+        { "48k, 100 ppm apart",          48000, +50, -50, 20, 120, 0.00 },
+        { "44.1k, 100 ppm apart",        44100, +50, -50, 20, 120, 0.00 },
+        { "48k, card fast, MIDI load",   48000, -30, +70, 30,  60, 0.05 },
+        { "24k, 20 ppm apart",           24000, +10, -10,  5, 300, 0.01 },
+    };
+    int failures = 0;
+    printf("%.0f s per run; latency = frames buffered (rings + TinyUSB FIFOs + resampler)\n\n", kSeconds);
+    printf("%-27s %-4s | %-30s | %-30s\n", "", "", "speaker (USB -> DAC)", "mic (ADC -> USB)");
+    printf("%-27s %-4s | %7s %7s %6s %7s | %7s %7s %6s %7s\n", "scenario", "", "lat ms", "max ms", "slips",
+           "THD+N", "lat ms", "max ms", "slips", "THD+N");
+    for (const Scenario &sc : scenarios) {
+        Result o = run<false>(sc, kSeconds), n = run<true>(sc, kSeconds);
+        printf("%-27s %-4s | %7.2f %7.2f %6u %7.1f | %7.2f %7.2f %6u %7.1f\n", sc.name, "old", o.outLatMs,
+               o.outLatMaxMs, o.outSlips, o.outThd, o.inLatMs, o.inLatMaxMs, o.inSlips, o.inThd);
+        printf("%-27s %-4s | %7.2f %7.2f %6u %7.1f | %7.2f %7.2f %6u %7.1f\n", "", "new", n.outLatMs,
+               n.outLatMaxMs, n.outSlips, n.outThd, n.inLatMs, n.inLatMaxMs, n.inSlips, n.inThd);
+        failures += n.outSlips != 0 || n.inSlips != 0;
+    }
+    printf("\nnew scheme slip-free in every scenario | %s\n", failures ? "FAIL" : "ok");
+    return failures ? 1 : 0;
+}
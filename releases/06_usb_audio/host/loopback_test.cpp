@@ -0,0 +1,261 @@
+// loopback_test — the loopback latency measurement (src/loopback.h) through the firmware's
+// own USB Audio path (src/audio_stream.h), on Linux, with tusb_mock.h in place of TinyUSB.
+//
+// Events run in time order, as in clock_sim:
+//   - card sample tick (core 1): one frame from the OUT ring to the DAC (12 bits), through
+//     the patch cable (a delay of D samples, a gain, noise) back to the ADC (12 bits) and
+//     into the IN ring;
+//   - host SOF: an OUT packet sized by the feedback value, one nominal IN packet taken;
+//   - audio_task (core 0) a jittered while after each SOF, then the main loop's poll().
+// The host's and the card's clocks are a few tens of ppm apart. After 1 s of settling,
+// SysEx CMD 6 is "received" and the run ends with the reply.
+//
+// Checked per scenario: the reply's status; latency against what the rings held while
+// the burst went round (OUT ring + D + IN ring + the resampler's TAPS/2, +-2 frames);
+// latency moving by exactly the change in D; jitter against the task delays injected.
+// Each scenario runs in its own process, so audio_stream.h's state starts fresh.
+//
+//   ./loopback_test        exit status 1 on any failure
+#include "tusb_mock.h"
+#include "../src/audio_stream.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <random>
+#include <sys/wait.h>
+#include <unistd.h>
+
+uint8_t g_sampleRateIdx = 0;   // extern "C" from audio_stream.h
+uint8_t g_channelsOut = 6;
+uint8_t g_channelsIn = 6;
+
+static double simNow = 0, simCardPpm = 0;   // true time (s); the card crystal's offset
+uint32_t audio_stream_micros() { return (uint32_t)(uint64_t)llround(simNow * (1 + simCardPpm * 1e-6) * 1e6); }
+
+struct Scenario {
+    const char *name;
+    uint8_t rateIdx, channels;
+    double hostPpm, cardPpm;
+    uint32_t delay;            // patch: samples
+    double gain;               // patch: negative inverts
+    double jitterUs;           // audio_task starts 30 us + 0..jitterUs after each SOF
+    bool hostSends;            // false: no OUT stream (nothing plays)
+    bool doubleRequest;        // a second CMD 6 while the first runs
+};
+
+struct Outcome {
+    uint8_t reply[2][20];
+    uint32_t replyLen[2];
+    double expectLatency;      // mean ring fills while the burst went round + D + TAPS/2
+    double injectedPp;         // max - min task delay while timed, us
+    double windowUs;           // time the jitter was taken over
+};
+
+static Outcome simulate(const Scenario &sc)
+{
+    Outcome o = {};
+    g_sampleRateIdx = sc.rateIdx;
+    g_channelsOut = g_channelsIn = sc.channels;
+    simCardPpm = sc.cardPpm;
+    const double fs = sample_rates[sc.rateIdx];
+    const int ch = sc.channels;
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> uni(0, 1);
+    std::normal_distribution<double> noise(0, 1.5);   // 12-bit LSBs
+
+    micResampler.init();
+    AudioStreamStartSpeaker();   // tud_audio_set_itf_cb, both streams
+    AudioStreamStartMic();
+
+    std::deque<int16_t> cable(sc.delay, 0);
+    double tCard = 0, tSof = 0, tTask = 1e9, taskDelay = 0;
+    uint32_t sofs = 0, fbLatched = 0, hostFbAcc = 0, hostInAcc = 0;
+    const double settle = 1.0, giveUp = 4.0;
+    bool started = false, searching = false;
+    uint32_t replies = 0;
+    double delayMin = 1e9, delayMax = -1e9, tStart = 0;
+    double fillSum = 0;
+    uint64_t fillN = 0;
+    int16_t pkt[49 * 6];
+
+    while (tCard < giveUp && replies < (sc.doubleRequest ? 2u : 1u)) {
+        if (tCard <= tSof && tCard <= tTask) {
+            // --- Card sample tick (core 1) ---
+            simNow = tCard;
+            AudioFrame out = {};
+            bool played = audioOutRing.pop(out);
+            cable.push_back((int16_t)(out.ch[0] >> 4));
+            double a = sc.gain * cable.front() + noise(rng);
+            cable.pop_front();
+            long adc = lrint(a);
+            adc = adc > 2047 ? 2047 : (adc < -2048 ? -2048 : adc);
+            AudioFrame in = {};
+            in.ch[0] = (int16_t)(adc << 4);
+            for (int c = 1; c < 6; c++) in.ch[c] = (int16_t)(out.ch[c] / 2);
+            audioInRing.push(in);
+            if (started && loopback.active() && played)
+                fillSum += audioOutRing.count() + audioInRing.count(), fillN++;
+            tCard += 1 / (fs * (1 + sc.cardPpm * 1e-6));
+        } else if (tSof <= tTask) {
+            // --- Host SOF ---
+            simNow = tSof;
+            if (sofs % 32 == 0) fbLatched = usbMock.feedback;   // bRefresh 5
+            hostFbAcc += fbLatched;
+            uint32_t n = hostFbAcc >> 16;
+            hostFbAcc &= 0xFFFF;
+            if (n > 49) n = 49;
+            for (uint32_t i = 0; i < n * ch; i++) pkt[i] = (int16_t)(uni(rng) * 8000 - 4000);
+            if (sc.hostSends) usbMock.hostSend(pkt, n * ch * 2);
+
+            hostInAcc += (uint32_t)fs;
+            uint32_t want = hostInAcc / 1000;
+            hostInAcc %= 1000;
+            usbMock.hostTake(pkt, want * ch * 2);
+
+            tud_sof_cb(sofs++);
+            taskDelay = 30e-6 + sc.jitterUs * 1e-6 * uni(rng);
+            tTask = std::min(tTask, tSof + taskDelay);
+            tSof += 1e-3 / (1 + sc.hostPpm * 1e-6);
+        } else {
+            // --- Main loop (core 0): audio_task, the SysEx, poll(), midi_task's reply ---
+            simNow = tTask;
+            tTask = 1e9;
+            audio_task();
+            if (started && loopback.active() && !searching) {
+                double d = taskDelay * 1e6;
+                if (d < delayMin) delayMin = d;
+                if (d > delayMax) delayMax = d;
+            }
+            if (!started && simNow > settle) {
+                loopback.start(audio_stream_micros());
+                started = true;
+                tStart = simNow;
+            } else if (started && sc.doubleRequest && replies == 0 && !searching) {
+                loopback.start(audio_stream_micros());   // answered Busy
+            }
+            if (started && !searching && loopback.active()) {
+                // Capture done when poll() starts finding work: time the window up to here
+                o.windowUs = (simNow - tStart) * 1e6;
+            }
+            for (int i = 0; i < 16; i++) loopback.poll();
+            if (uint32_t len = loopback.report(o.reply[replies])) o.replyLen[replies++] = len;
+            searching = started && !loopback.active();
+        }
+    }
+    o.expectLatency = (fillN ? fillSum / fillN : 0) + sc.delay + FracResampler::TAPS / 2;
+    o.injectedPp = delayMax - delayMin;
+    return o;
+}
+
+// simulate() in a child process; the Outcome back through a pipe
+static bool runIsolated(const Scenario &sc, Outcome &o)
+{
+    int fd[2];
+    if (pipe(fd) != 0) return false;
+    pid_t pid = fork();
+    if (pid == 0) {
+        close(fd[0]);
+        Outcome r = simulate(sc);
+        ssize_t w = write(fd[1], &r, sizeof r);
+        _exit(w == (ssize_t)sizeof r ? 0 : 1);
+    }
+    close(fd[1]);
+    ssize_t got = read(fd[0], &o, sizeof o);
+    close(fd[0]);
+    int status = 0;
+    waitpid(pid, &status, 0);
+    return got == (ssize_t)sizeof o && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+struct Reply {
+    int status = -1;
+    uint32_t latency = 0, ratio = 0, negative = 0, jpp = 0, jrms = 0, pktMin = 0, pktMax = 0, runs = 0;
+};
+
+static Reply parse(const uint8_t *m, uint32_t len)
+{
+    Reply r;
+    if (len != 17 || m[0] != 0xF0 || m[1] != 0x7D || m[2] != 0x06 || m[16] != 0xF7) return r;
+    auto get14 = [&](int i) { return (uint32_t)m[i] | ((uint32_t)m[i + 1] << 7); };
+    r.status = m[3];
+    r.latency = get14(4);
+    r.ratio = m[6];
+    r.negative = m[7];
+    r.jpp = get14(8);
+    r.jrms = get14(10);
+    r.pktMin = m[12];
+    r.pktMax = m[13];
+    r.runs = get14(14);
+    return r;
+}
+
+static const char *kStatus[] = { "ok", "weak peak", "no OUT stream", "busy" };
+
+int main()
+{
+    //                name                 rate ch  host  card   D     gain  jitter send  2x
+    const Scenario scenarios[] = {
+        { "48k 2ch D=0",        0, 2,  40, -30,    0,  0.9,   150, true, false },
+        { "48k 2ch D=37",       0, 2,  40, -30,   37,  0.9,   150, true, false },
+        { "48k 6ch D=37",       0, 6,  40, -30,   37,  0.9,   150, true, false },
+        { "48k 6ch D=37 inv",   0, 6,  40, -30,   37, -0.5,   150, true, false },
+        { "44.1k 4ch D=5",      1, 4, -20,  60,    5,  0.9,   400, true, false },
+        { "44.1k 4ch D=300",    1, 4, -20,  60,  300,  0.9,   400, true, false },
+        { "24k 2ch D=12",       2, 2,  10,  10,   12,  0.9,    50, true, false },
+        { "24k 2ch D=1012",     2, 2,  10,  10, 1012,  0.9,    50, true, false },
+        { "48k 2ch twice",      0, 2,  40, -30,   37,  0.9,   150, true, true  },
+        { "48k no OUT stream",  0, 2,  40, -30,   37,  0.9,   150, false, false },
+        { "48k unpatched",      0, 2,  40, -30,   37,  0.0,   150, true, false },
+    };
+    const int kN = sizeof scenarios / sizeof scenarios[0];
+    Outcome out[kN];
+    Reply rep[kN];
+    int failures = 0;
+
+    printf("%-20s %-14s %8s %8s %6s %4s %10s %10s %5s %5s\n", "", "status", "latency", "expect",
+           "ratio", "inv", "jitter pp", "(injected)", "rms", "pkt");
+    for (int i = 0; i < kN; i++) {
+        const Scenario &sc = scenarios[i];
+        bool ok = runIsolated(sc, out[i]);
+        const Outcome &o = out[i];
+        int last = o.replyLen[1] ? 1 : 0;
+        rep[i] = parse(o.reply[last], o.replyLen[last]);
+        const Reply &r = rep[i];
+
+        int wantStatus = !sc.hostSends ? LoopbackMeter::NoOutStream
+                       : sc.gain == 0 ? LoopbackMeter::WeakPeak : LoopbackMeter::Ok;
+        ok = ok && r.status == wantStatus;
+        if (sc.doubleRequest) ok = ok && parse(o.reply[0], o.replyLen[0]).status == LoopbackMeter::Busy;
+        if (wantStatus == LoopbackMeter::Ok) {
+            ok = ok && fabs(r.latency - o.expectLatency) <= 2;
+            ok = ok && r.negative == (sc.gain < 0);
+            double ramp = fabs(sc.hostPpm - sc.cardPpm) * 1e-6 * o.windowUs;
+            ok = ok && r.jpp >= sc.jitterUs * 0.8 && r.jpp <= o.injectedPp + ramp + 3;
+            uint32_t packet = sample_rates[sc.rateIdx] / 1000;
+            ok = ok && r.pktMin >= packet - 1 && r.pktMax <= packet + 2;
+        }
+        failures += !ok;
+
+        printf("%-20s %-14s %8u %8.1f %6u %4s %10u %10.0f %5u %2u-%-2u %s\n", sc.name,
+               r.status >= 0 && r.status <= 3 ? kStatus[r.status] : "no reply", r.latency,
+               o.expectLatency, r.ratio, r.negative ? "yes" : "", r.jpp, o.injectedPp, r.jrms,
+               r.pktMin, r.pktMax, ok ? "" : "FAIL");
+    }
+
+    // Same clocks and jitter, only the patch delay differs: latency moves by exactly that
+    const int pairs[][2] = { { 0, 1 }, { 4, 5 }, { 6, 7 } };
+    printf("\n");
+    for (auto &p : pairs) {
+        long dl = (long)rep[p[1]].latency - (long)rep[p[0]].latency;
+        long dd = (long)scenarios[p[1]].delay - (long)scenarios[p[0]].delay;
+        bool ok = dl == dd;
+        failures += !ok;
+        printf("%-20s -> %-20s latency %+5ld, delay %+5ld %s\n", scenarios[p[0]].name, scenarios[p[1]].name,
+               dl, dd, ok ? "" : "FAIL");
+    }
+    printf("\n%s\n", failures ? "FAILED" : "all passed");
+    return failures ? 1 : 0;
+}
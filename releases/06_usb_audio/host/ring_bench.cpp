@@ -0,0 +1,269 @@
+// ring_bench — USB Audio's frame rings (src/frame_ring.h) against the word rings they
+// replace (src/ring_buffer.h), on Linux.
+//
+// Per 1 ms packet at 48 kHz, core 0's side of audio_task:
+//   - speaker: TinyUSB's FIFO -> OUT ring (old: three rb_push a frame, each with a modulo
+//     and a barrier, channel count tested per word; new: whole packet through ring spans,
+//     PackFrames<CH>, one barrier);
+//   - mic: IN ring -> resampler -> packet (old: three rb_pop a frame into a copy, then
+//     a per-channel loop on tx_channels; new: frames read in place from ring spans,
+//     process<CH> writes the packet).
+// Core 1's side per sample (one frame out, one in) is timed too. Both versions must give
+// the same DAC frames and the same mic packets.
+//
+// The functions below mirror main.cpp's (new) and the code it replaced (old); a TinyUSB
+// stand-in moves the bytes. Cycles are the x86 timestamp counter and barriers cost more
+// on x86 than an RP2040's DMB — compare the columns, not the numbers.
+//
+//   ./ring_bench
+#include "../src/ring_buffer.h"
+#include "../src/frame_ring.h"
+#include "../src/usb_clock.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+static inline uint64_t ticks() { return __rdtsc(); }
+static const char *kTickUnit = "cycles";
+#else
+static inline uint64_t ticks()
+{
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+static const char *kTickUnit = "ns";
+#endif
+
+// --- TinyUSB stand-in: the OUT FIFO the host fills, the IN bytes the host takes ---
+static std::vector<uint8_t> usbOut;
+static size_t usbOutRead = 0;
+static std::vector<uint8_t> usbIn;
+
+static uint32_t tud_audio_available() { return (uint32_t)(usbOut.size() - usbOutRead); }
+static uint32_t tud_audio_read(void *dst, uint32_t n)
+{
+    n = n < tud_audio_available() ? n : tud_audio_available();
+    memcpy(dst, usbOut.data() + usbOutRead, n);
+    usbOutRead += n;
+    return n;
+}
+static uint32_t tud_audio_write(const void *src, uint32_t n)
+{
+    usbIn.insert(usbIn.end(), (const uint8_t *)src, (const uint8_t *)src + n);
+    return n;
+}
+
+static int16_t spk_buf[2048];
+static int16_t mic_buf[600];
+
+// --- Old: word rings, as audio_task and ProcessSample had them ---
+namespace old_path {
+audio_ring_buffer_t outRB, inRB;
+FracResampler resampler;
+
+void receive_speaker(uint8_t rx_channels)
+{
+    uint8_t rx_bytes_per_sample = rx_channels * 2;
+    uint32_t aligned_bytes = (tud_audio_available() / rx_bytes_per_sample) * rx_bytes_per_sample;
+    if (aligned_bytes == 0) return;
+    uint32_t samples_read = tud_audio_read(spk_buf, aligned_bytes) / rx_bytes_per_sample;
+    for (uint32_t i = 0; i < samples_read; i++) {
+        uint32_t val_12 = (uint16_t)spk_buf[rx_channels*i] | ((uint32_t)(uint16_t)spk_buf[rx_channels*i+1] << 16);
+        rb_push(&outRB, val_12);
+        if (rx_channels >= 4) {
+            uint32_t val_34 = (uint16_t)spk_buf[rx_channels*i+2] | ((uint32_t)(uint16_t)spk_buf[rx_channels*i+3] << 16);
+            rb_push(&outRB, val_34);
+        } else {
+            rb_push(&outRB, 0);
+        }
+        if (rx_channels >= 6) {
+            uint32_t val_56 = (uint16_t)spk_buf[rx_channels*i+4] | ((uint32_t)(uint16_t)spk_buf[rx_channels*i+5] << 16);
+            rb_push(&outRB, val_56);
+        } else {
+            rb_push(&outRB, 0);
+        }
+    }
+}
+
+int16_t pulled[6];
+const int16_t *pull_mic_frame()
+{
+    if (rb_count(&inRB) < 3) return nullptr;
+    for (int w = 0; w < 3; w++) {
+        uint32_t s = 0;
+        rb_pop(&inRB, &s);
+        pulled[w*2] = (int16_t)(s & 0xFFFF);
+        pulled[w*2+1] = (int16_t)(s >> 16);
+    }
+    return pulled;
+}
+
+void send_mic(uint8_t tx_channels, int32_t rate, uint32_t samples_to_send)
+{
+    for (uint32_t i = 0; i < samples_to_send; i++) {
+        int16_t frame[FracResampler::MAXCH];
+        resampler.process<6>(rate, frame, pull_mic_frame);   // Always 6ch internally
+        for (int j = 0; j < tx_channels; j++) mic_buf[tx_channels*i+j] = frame[j];
+    }
+    tud_audio_write(mic_buf, samples_to_send * tx_channels * 2);
+}
+
+// Core 1, one sample: a frame to the DAC, one from the ADC
+void card_sample(int16_t *dac, const int16_t *adc)
+{
+    int streamIdx = 0;
+    if (rb_count(&outRB) >= 3) {
+        for (int w = 0; w < 3; w++) {
+            uint32_t s = 0;
+            rb_pop(&outRB, &s);
+            dac[streamIdx++] = (int16_t)(s & 0xFFFF);
+            dac[streamIdx++] = (int16_t)(s >> 16);
+        }
+    } else {
+        for (int k = 0; k < 6; k++) dac[k] = 0;
+    }
+    if (rb_count(&inRB) < (AUDIO_BUFFER_SIZE - 4)) {
+        for (int w = 0; w < 3; w++) {
+            uint32_t s = (uint16_t)adc[w*2] | ((uint32_t)(uint16_t)adc[w*2+1] << 16);
+            rb_push(&inRB, s);
+        }
+    }
+}
+} // namespace old_path
+
+// --- New: frame rings, as main.cpp has them ---
+namespace new_path {
+FrameRing<1024> outRing, inRing;
+FracResampler resampler;
+
+template <int RX>
+void receive_speaker()
+{
+    uint32_t n = tud_audio_available() / (RX * 2);
+    if (n == 0) return;
+    if constexpr (RX == 6) {
+        outRing.write_n(n, [](AudioFrame *dst, uint32_t k, uint32_t) {
+            tud_audio_read(dst, k * sizeof(AudioFrame));
+        });
+    } else {
+        n = tud_audio_read(spk_buf, n * RX * 2) / (RX * 2);
+        outRing.write_n(n, [](AudioFrame *dst, uint32_t k, uint32_t done) {
+            PackFrames<RX>(dst, &spk_buf[done * RX], k);
+        });
+    }
+}
+
+template <int TX>
+void send_mic(int32_t rate, uint32_t n)
+{
+    const AudioFrame *span = nullptr;
+    uint32_t avail = 0, used = 0;
+    auto pull = [&]() -> const int16_t * {
+        if (used == avail) {
+            if (used) inRing.release(used);
+            used = 0;
+            avail = inRing.read_span(span);
+            if (avail == 0) return nullptr;
+        }
+        return span[used++].ch;
+    };
+    for (uint32_t i = 0; i < n; i++)
+        resampler.process<TX>(rate, &mic_buf[TX * i], pull);
+    if (used) inRing.release(used);
+    tud_audio_write(mic_buf, n * TX * 2);
+}
+
+void card_sample(int16_t *dac, const int16_t *adc)
+{
+    AudioFrame frame = {};
+    outRing.pop(frame);
+    memcpy(dac, frame.ch, sizeof frame.ch);
+    memcpy(frame.ch, adc, sizeof frame.ch);
+    inRing.push(frame);
+}
+} // namespace new_path
+
+struct Cost { double spk = 0, mic = 0, card = 0; };
+
+// kPackets ms of 48 kHz through one path; the DAC frames and mic bytes it produced
+template <bool NEW, int CH>
+static Cost run(int kPackets, std::vector<int16_t> &dac, std::vector<uint8_t> &mic)
+{
+    const int kFrames = 48;
+    const int32_t rate = 4295 * 80;   // mic resampler 80 ppm off 1:1, as under drift
+    usbOut.clear(); usbOutRead = 0; usbIn.clear();
+    dac.clear();
+    uint32_t rng = 1;
+    uint64_t tSpk = 0, tMic = 0, tCard = 0;
+    int16_t adc[6], out[6];
+    int64_t sampleIdx = 0;
+
+    for (int p = 0; p < kPackets; p++) {
+        // Host: one OUT packet into TinyUSB's FIFO
+        for (int i = 0; i < kFrames * CH; i++) {
+            rng = rng * 1664525u + 1013904223u;
+            int16_t s = (int16_t)(rng >> 16);
+            usbOut.insert(usbOut.end(), (uint8_t *)&s, (uint8_t *)&s + 2);
+        }
+
+        // Core 0
+        uint64_t t0 = ticks();
+        if constexpr (NEW) new_path::receive_speaker<CH>(); else old_path::receive_speaker(CH);
+        uint64_t t1 = ticks();
+        if constexpr (NEW) new_path::send_mic<CH>(rate, kFrames); else old_path::send_mic(CH, rate, kFrames);
+        uint64_t t2 = ticks();
+        tSpk += t1 - t0;
+        tMic += t2 - t1;
+
+        // Core 1: a ms of samples
+        uint64_t t3 = ticks();
+        for (int i = 0; i < kFrames; i++, sampleIdx++) {
+            for (int c = 0; c < 6; c++) adc[c] = (int16_t)((sampleIdx * (c + 3) * 97) & 0x7FFF);
+            if constexpr (NEW) new_path::card_sample(out, adc); else old_path::card_sample(out, adc);
+            dac.insert(dac.end(), out, out + 6);
+        }
+        tCard += ticks() - t3;
+    }
+    mic = usbIn;
+    return { (double)tSpk / kPackets, (double)tMic / kPackets, (double)tCard / kPackets };
+}
+
+template <int CH>
+static bool row(int kPackets)
+{
+    std::vector<int16_t> dacOld, dacNew;
+    std::vector<uint8_t> micOld, micNew;
+    old_path::resampler.reset();
+    new_path::resampler.reset();
+    // Prime both IN rings with the same 2 ms, so the mic path starts with input queued
+    int16_t zero[6] = {};
+    for (int i = 0; i < 96; i++) {
+        int16_t tmp[6];
+        old_path::card_sample(tmp, zero);
+        new_path::card_sample(tmp, zero);
+    }
+    Cost o = run<false, CH>(kPackets, dacOld, micOld);
+    Cost n = run<true, CH>(kPackets, dacNew, micNew);
+    bool same = dacOld == dacNew && micOld == micNew;
+    printf("%dx%d  old  %9.0f %9.0f %9.0f %9.0f\n", CH, CH, o.spk, o.mic, o.spk + o.mic, o.card);
+    printf("     new  %9.0f %9.0f %9.0f %9.0f   %.2fx / %.2fx | %s\n", n.spk, n.mic, n.spk + n.mic, n.card,
+           (o.spk + o.mic) / (n.spk + n.mic), o.card / n.card, same ? "same output" : "FAIL");
+    return same;
+}
+
+int main()
+{
+    old_path::resampler.init();
+    new_path::resampler.init();
+    const int kPackets = 20000;   // 20 s of audio per row
+    printf("%s per 1 ms packet at 48 kHz (core 0: speaker in, mic out; core 1: 48 samples)\n\n", kTickUnit);
+    printf("ch        %9s %9s %9s %9s   core 0 / core 1 speed-up\n", "speaker", "mic", "core 0", "core 1");
+    int failures = 0;
+    failures += !row<2>(kPackets);
+    failures += !row<4>(kPackets);
+    failures += !row<6>(kPackets);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,73 @@
+// tusb_mock — just enough of TinyUSB's audio class for src/audio_stream.h on Linux.
+//
+// The device side is TinyUSB's API (tud_audio_available / read / write / fb_set), over
+// byte FIFOs the size of the firmware's software buffers (tusb_config.h at 6 channels,
+// 48 kHz). The host side sends OUT packets, takes IN packets and reads the feedback
+// value, and counts what didn't fit. Include before ../src/audio_stream.h.
+#ifndef TUSB_MOCK_H
+#define TUSB_MOCK_H
+
+#include <stdint.h>
+#include <string.h>
+#include <deque>
+
+// As tusb_config.h works them out: 32 packets of 6ch 48k (49 frames)
+#define CFG_TUD_AUDIO_FUNC_1_EP_OUT_SW_BUF_SZ   (32 * 49 * 12)
+#define CFG_TUD_AUDIO_FUNC_1_EP_IN_SW_BUF_SZ    (32 * 49 * 12)
+
+struct UsbAudioMock {
+    std::deque<uint8_t> out, in;     // OUT FIFO (host -> device), IN FIFO (device -> host)
+    uint32_t feedback = 0;           // last tud_audio_fb_set, 16.16 frames per ms
+    uint32_t outDropped = 0, inDropped = 0, inShort = 0;   // bytes
+
+    void reset() { out.clear(); in.clear(); feedback = 0; outDropped = inDropped = inShort = 0; }
+
+    // Host: one OUT packet
+    void hostSend(const void *src, uint32_t bytes)
+    {
+        const uint8_t *p = (const uint8_t *)src;
+        for (uint32_t i = 0; i < bytes; i++) {
+            if (out.size() < CFG_TUD_AUDIO_FUNC_1_EP_OUT_SW_BUF_SZ) out.push_back(p[i]);
+            else outDropped++;
+        }
+    }
+
+    // Host: one IN packet of up to bytes; returns the bytes there were
+    uint32_t hostTake(void *dst, uint32_t bytes)
+    {
+        uint8_t *p = (uint8_t *)dst;
+        uint32_t n = 0;
+        for (; n < bytes && !in.empty(); n++) { p[n] = in.front(); in.pop_front(); }
+        inShort += bytes - n;
+        return n;
+    }
+};
+
+static UsbAudioMock usbMock;
+
+static uint16_t tud_audio_available() { return (uint16_t)usbMock.out.size(); }
+
+static uint16_t tud_audio_read(void *dst, uint16_t n)
+{
+    uint8_t *p = (uint8_t *)dst;
+    uint16_t i = 0;
+    for (; i < n && !usbMock.out.empty(); i++) { p[i] = usbMock.out.front(); usbMock.out.pop_front(); }
+    return i;
+}
+
+static uint16_t tud_audio_write(const void *src, uint16_t n)
+{
+    const uint8_t *p = (const uint8_t *)src;
+    uint16_t i = 0;
+    for (; i < n && usbMock.in.size() < CFG_TUD_AUDIO_FUNC_1_EP_IN_SW_BUF_SZ; i++) usbMock.in.push_back(p[i]);
+    usbMock.inDropped += n - i;
+    return i;
+}
+
+static bool tud_audio_fb_set(uint32_t feedback)
+{
+    usbMock.feedback = feedback;
+    return true;
+}
+
+#endif // TUSB_MOCK_H
@@ -0,0 +1,196 @@
+/*
+ * Core 0's side of USB Audio: TinyUSB's audio FIFOs <-> the frame rings
+ *
+ * Speaker packets go into audioOutRing, mic packets are resampled out of audioInRing
+ * (frame_ring.h), both clocked by the servos in usb_clock.h, once per USB frame (SOF).
+ * Core 1 (ComputerCard) is the rings' other end. The loopback meter (loopback.h) taps
+ * both streams here.
+ *
+ * Only TinyUSB's audio calls are used (tud_audio_available / read / write / fb_set), so
+ * host/tusb_mock.h can stand in for TinyUSB and host/loopback_test.cpp can run this same
+ * code on Linux. The including file provides those, CFG_TUD_AUDIO_FUNC_1_EP_OUT_SW_BUF_SZ
+ * (tusb_config.h), g_sampleRateIdx / g_channelsOut / g_channelsIn and
+ * audio_stream_micros(). Included once, by main.cpp or a host test.
+ */
+
+#ifndef AUDIO_STREAM_H
+#define AUDIO_STREAM_H
+
+#include <stdint.h>
+#include <string.h>
+#include "frame_ring.h"
+#include "usb_clock.h"
+#include "loopback.h"
+
+extern "C" uint8_t g_sampleRateIdx;
+extern "C" uint8_t g_channelsOut;
+extern "C" uint8_t g_channelsIn;
+uint32_t audio_stream_micros();   // Free-running microseconds (time_us_32 on the card)
+
+//--------------------------------------------------------------------+
+// Audio Ring Buffers (shared between cores)
+//--------------------------------------------------------------------+
+FrameRing<1024> audioInRing;     // ADC -> USB (Mic), 6-channel frames (~21ms at 48k)
+FrameRing<1024> audioOutRing;    // USB -> DAC (Speaker)
+
+const uint32_t sample_rates[] = {48000, 44100, 24000};
+#define N_SAMPLE_RATES (sizeof(sample_rates) / sizeof(sample_rates[0]))
+
+// Buffer for speaker data
+int16_t spk_buf[CFG_TUD_AUDIO_FUNC_1_EP_OUT_SW_BUF_SZ / 2];
+static int16_t mic_buf[600];  // Buffer for one 6-channel mic packet
+
+// Clock recovery (usb_clock.h): speaker feedback and mic resampling, run from audio_task
+RateServo spkServo, micServo;
+FracResampler micResampler;
+volatile uint32_t sofCount = 0;   // USB frames seen (tud_sof_cb)
+bool micPrime = false;            // mic stream just started: queue a packet of silence
+
+// Round-trip latency and jitter on request (SysEx CMD 6)
+LoopbackMeter loopback;
+
+// Frames per USB frame at the configured rate, and the ring fill each servo holds
+static uint32_t NominalRate() { return sample_rates[g_sampleRateIdx < N_SAMPLE_RATES ? g_sampleRateIdx : 0]; }
+static int32_t SpkTargetFrames() { return 3 * (int32_t)(NominalRate() / 1000); }
+static int32_t MicTargetFrames() { int32_t p = (int32_t)(NominalRate() / 1000); return p + p / 2 + 8; }
+
+// Speaker streaming starting - top the ring up to the servo's target (~3ms) with silence;
+// the feedback EP holds it there from now on. Core 1 is the only consumer, so it is never
+// cleared from this side.
+static void AudioStreamStartSpeaker()
+{
+    uint32_t have = audioOutRing.count(), want = (uint32_t)SpkTargetFrames();
+    if (have < want) {
+        audioOutRing.write_n(want - have, [](AudioFrame *dst, uint32_t k, uint32_t) {
+            memset(dst, 0, k * sizeof(AudioFrame));
+        });
+    }
+    spkServo.init(NominalRate(), SpkTargetFrames());
+    tud_audio_fb_set((uint32_t)(((uint64_t)NominalRate() << 16) / 1000));
+}
+
+// Mic streaming starting - drop stale frames, restart the resampler
+static void AudioStreamStartMic()
+{
+    audioInRing.flush();
+    micServo.init(NominalRate(), MicTargetFrames());
+    micResampler.reset();
+    micPrime = true;
+}
+
+// Start of each USB frame (1ms); audio_task catches up on the frames counted here
+void tud_sof_cb(uint32_t frame_count)
+{
+    (void)frame_count;
+    sofCount = sofCount + 1;
+}
+
+//--------------------------------------------------------------------+
+// USB Audio Task (Core 0) - runs once per USB frame (SOF)
+//--------------------------------------------------------------------+
+
+// Everything TinyUSB has received, as whole RX-channel frames, into the OUT ring. Returns
+// the frames taken.
+template <int RX>
+static uint32_t ReceiveSpeaker()
+{
+    // Only read full frames to avoid dropping partial bytes and shifting channels
+    uint32_t n = tud_audio_available() / (RX * 2);
+    if (n == 0) return 0;
+    if constexpr (RX == 6) {
+        // Same layout as the ring: read straight into its spans (what doesn't fit stays
+        // in TinyUSB's FIFO)
+        return audioOutRing.write_n(n, [](AudioFrame *dst, uint32_t k, uint32_t) {
+            tud_audio_read(dst, k * sizeof(AudioFrame));
+            loopback.onSpeaker(dst->ch, k, 6);
+        });
+    } else {
+        n = tud_audio_read(spk_buf, n * RX * 2) / (RX * 2);
+        return audioOutRing.write_n(n, [](AudioFrame *dst, uint32_t k, uint32_t done) {
+            PackFrames<RX>(dst, &spk_buf[done * RX], k);
+            loopback.onSpeaker(dst->ch, k, 6);
+        });
+    }
+}
+
+// One mic packet of n TX-channel frames, resampled from the IN ring. Input frames are read
+// in place from the ring's spans and handed back once per packet.
+template <int TX>
+static void SendMic(int32_t rate, uint32_t n)
+{
+    const AudioFrame *span = nullptr;
+    uint32_t avail = 0, used = 0;
+    auto pull = [&]() -> const int16_t * {
+        if (used == avail) {
+            if (used) audioInRing.release(used);
+            used = 0;
+            avail = audioInRing.read_span(span);
+            if (avail == 0) return nullptr;
+        }
+        return span[used++].ch;
+    };
+    for (uint32_t i = 0; i < n; i++)
+        micResampler.process<TX>(rate, &mic_buf[TX * i], pull);
+    if (used) audioInRing.release(used);
+
+    loopback.onMic(mic_buf, n, TX);
+    tud_audio_write((uint8_t*)mic_buf, n * TX * 2);
+}
+
+void audio_task(void)
+{
+    static uint32_t last_sof = 0;
+    uint32_t frames = sofCount - last_sof;
+    if (frames == 0) return;  // Run once per USB frame (catching up if we were late)
+    last_sof += frames;
+
+    // Determine RX (Spk) and TX (Mic) channel counts based on Config
+    uint8_t rx_channels = g_channelsOut; // Explicitly configured
+    uint8_t tx_channels = g_channelsIn;  // Explicitly configured
+
+    // Safety clamp to allowed values (2, 4, 6)
+    if (rx_channels != 2 && rx_channels != 4 && rx_channels != 6) rx_channels = 6;
+    if (tx_channels != 2 && tx_channels != 4 && tx_channels != 6) tx_channels = 6;
+
+    // ===== SPEAKER RX (USB -> DAC) =====
+    // Format: [Ch1 Ch2 ...] per sample, each 16-bit
+    uint32_t received;
+    switch (rx_channels) {
+        case 2:  received = ReceiveSpeaker<2>(); break;
+        case 4:  received = ReceiveSpeaker<4>(); break;
+        default: received = ReceiveSpeaker<6>(); break;
+    }
+    loopback.onRun(frames, audio_stream_micros(), received);
+
+    // Feedback: ask the host for more or fewer samples per frame to hold the ring's fill.
+    // The rate error is Q32 (positive = ring too full); the value is 16.16 frames per ms.
+    uint32_t nominal = (uint32_t)(((uint64_t)NominalRate() << 16) / 1000);
+    int32_t spkRate = spkServo.update((int32_t)audioOutRing.count());
+    tud_audio_fb_set(nominal - (uint32_t)(((int64_t)nominal * spkRate) >> 32));
+
+    // ===== MIC TX (ADC -> USB) =====
+    // Synchronous EP: exactly the nominal rate per USB frame (44.1k: 44/45), resampled from
+    // the ADC's clock, the ratio set by the IN ring's fill.
+    if (micPrime) {
+        // A packet of silence ahead, so a late audio_task never leaves the host short
+        micPrime = false;
+        uint32_t bytes = (NominalRate() / 1000) * tx_channels * 2;
+        memset(mic_buf, 0, bytes);
+        tud_audio_write((uint8_t*)mic_buf, bytes);
+    }
+    int32_t micRate = micServo.update((int32_t)audioInRing.count());
+    static uint32_t phase_acc = 0;
+    for (uint32_t f = 0; f < frames; f++) {
+        phase_acc += NominalRate();
+        uint32_t samples_to_send = phase_acc / 1000;
+        phase_acc %= 1000;
+
+        switch (tx_channels) {
+            case 2:  SendMic<2>(micRate, samples_to_send); break;
+            case 4:  SendMic<4>(micRate, samples_to_send); break;
+            default: SendMic<6>(micRate, samples_to_send); break;
+        }
+    }
+}
+
+#endif // AUDIO_STREAM_H
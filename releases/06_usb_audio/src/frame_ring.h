@@ -0,0 +1,141 @@
+/*
+ * Frame-typed audio rings between the cores, and the USB interleave loops
+ *
+ * Each ring holds whole 6-channel frames (the internal bus is always 6 channels; USB
+ * streams of 2 or 4 channels are padded with silence). One producer, one consumer, on
+ * different cores. The indices run freely and are masked on access, so count is just
+ * head - tail. Batches are read or written through spans: contiguous pieces of the ring
+ * itself, so a packet costs one barrier and one index update, not three per frame.
+ *
+ * PackFrames<CH> turns USB's interleaved CH-channel samples into 6-channel frames; the
+ * mic side is unpacked by the resampler (FracResampler::process<CH>, usb_clock.h), which
+ * writes the packet's interleaved samples itself. audio_task picks the instances once per
+ * packet.
+ */
+
+#ifndef FRAME_RING_H
+#define FRAME_RING_H
+
+#include <stdint.h>
+#include <string.h>
+
+struct AudioFrame {
+    int16_t ch[6];
+};
+static_assert(sizeof(AudioFrame) == 12, "6 x 16-bit, no padding: a 6-channel USB frame");
+
+template <uint32_t N>
+class FrameRing {
+public:
+    static_assert((N & (N - 1)) == 0, "N must be a power of two");
+    static constexpr uint32_t kSize = N;
+
+    uint32_t count() const { return head - tail; }
+    uint32_t space() const { return N - count(); }
+
+    // --- Producer ---
+
+    // Contiguous free frames at the head (up to the wrap), without publishing them
+    uint32_t write_span(AudioFrame *&p)
+    {
+        uint32_t h = head, free = N - (h - tail), off = h & (N - 1);
+        p = &buf[off];
+        return free < N - off ? free : N - off;
+    }
+
+    // Publish n frames written through write_span
+    void commit(uint32_t n)
+    {
+        __sync_synchronize();   // frames visible before the head that publishes them
+        head = head + n;
+    }
+
+    // Up to n frames from fill(AudioFrame *dst, uint32_t count, uint32_t done), called once
+    // per contiguous span (twice across the wrap), then published together.
+    template <typename Fill>
+    uint32_t write_n(uint32_t n, Fill fill)
+    {
+        uint32_t h = head, free = N - (h - tail), off = h & (N - 1);
+        if (n > free) n = free;
+        uint32_t first = n < N - off ? n : N - off;
+        if (first) fill(&buf[off], first, 0);
+        if (n > first) fill(&buf[0], n - first, first);
+        if (n) commit(n);
+        return n;
+    }
+
+    uint32_t write_n(const AudioFrame *src, uint32_t n)
+    {
+        return write_n(n, [src](AudioFrame *dst, uint32_t k, uint32_t done) {
+            memcpy(dst, src + done, k * sizeof(AudioFrame));
+        });
+    }
+
+    bool push(const AudioFrame &f) { return write_n(&f, 1) == 1; }
+
+    // --- Consumer ---
+
+    // Contiguous queued frames at the tail (up to the wrap), without releasing them
+    uint32_t read_span(const AudioFrame *&p)
+    {
+        uint32_t t = tail, avail = head - t, off = t & (N - 1);
+        __sync_synchronize();   // read the frames after seeing the head that published them
+        p = &buf[off];
+        return avail < N - off ? avail : N - off;
+    }
+
+    // Hand n frames read through read_span back to the producer
+    void release(uint32_t n)
+    {
+        __sync_synchronize();   // done reading before the producer may overwrite
+        tail = tail + n;
+    }
+
+    // Up to n frames into drain(const AudioFrame *src, uint32_t count, uint32_t done), once
+    // per contiguous span, then released together.
+    template <typename Drain>
+    uint32_t read_n(uint32_t n, Drain drain)
+    {
+        uint32_t t = tail, avail = head - t, off = t & (N - 1);
+        if (n > avail) n = avail;
+        __sync_synchronize();   // read the frames after seeing the head that published them
+        uint32_t first = n < N - off ? n : N - off;
+        if (first) drain(&buf[off], first, 0);
+        if (n > first) drain(&buf[0], n - first, first);
+        if (n) release(n);
+        return n;
+    }
+
+    uint32_t read_n(AudioFrame *dst, uint32_t n)
+    {
+        return read_n(n, [dst](const AudioFrame *src, uint32_t k, uint32_t done) {
+            memcpy(dst + done, src, k * sizeof(AudioFrame));
+        });
+    }
+
+    bool pop(AudioFrame &f) { return read_n(&f, 1) == 1; }
+
+    // Consumer side: drop everything queued
+    void flush() { tail = head; }
+
+private:
+    AudioFrame buf[N];
+    volatile uint32_t head = 0, tail = 0;   // written only by the producer / the consumer
+};
+
+// USB interleaved CH-channel samples -> 6-channel frames, silence in the unused channels
+template <int CH>
+static inline void PackFrames(AudioFrame *dst, const int16_t *usb, uint32_t n)
+{
+    static_assert(CH == 2 || CH == 4 || CH == 6, "USB streams are 2, 4 or 6 channels");
+    if constexpr (CH == 6) {
+        memcpy(dst, usb, n * sizeof(AudioFrame));
+    } else {
+        for (uint32_t i = 0; i < n; i++, usb += CH) {
+            for (int c = 0; c < CH; c++) dst[i].ch[c] = usb[c];
+            for (int c = CH; c < 6; c++) dst[i].ch[c] = 0;
+        }
+    }
+}
+
+#endif // FRAME_RING_H
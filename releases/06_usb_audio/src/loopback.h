@@ -0,0 +1,227 @@
+/*
+ * Loopback latency and jitter measurement
+ *
+ * Patch Audio Out 1 to Audio In 1 and send SysEx F0 7D 06 F7. The card then, on the first
+ * USB channel of each stream (Audio 1 with the default masks):
+ *   1. mutes the incoming speaker stream for kQuiet frames, so the loop is silent;
+ *   2. replaces it with a 1023-sample maximal-length sequence (kBurst);
+ *   3. captures kCapture frames of the outgoing mic stream from the burst's start;
+ *   4. finds the burst in the capture by cross-correlation, a few lags per call of poll();
+ * and answers with SysEx F0 7D 06 ... F7 (see report()).
+ *
+ * Latency counts samples from the burst's arrival in a USB OUT packet to its departure in
+ * a USB IN packet: the OUT ring, DAC, the patch, ADC, the IN ring and the mic resampler.
+ * Both stream counters start together and run at the host's rate, so the lag of the
+ * correlation peak is the latency itself. The host's own buffers (and one USB frame each
+ * way) come on top.
+ *
+ * Jitter is that of audio_task against the USB frame grid while the measurement runs:
+ * each run's time minus 1 ms per SOF since the first, peak-to-peak and RMS, plus the
+ * smallest and largest OUT packets the host sent.
+ *
+ * Everything runs on core 0 (audio_task and the main loop). host/loopback_test.cpp runs
+ * the real audio_stream.h pipeline through a TinyUSB stand-in and checks the numbers.
+ */
+
+#ifndef LOOPBACK_H
+#define LOOPBACK_H
+
+#include <stdint.h>
+#include <math.h>
+
+class LoopbackMeter {
+public:
+    static constexpr uint32_t kBurst   = 1023;   // MLS length (10-bit LFSR)
+    static constexpr uint32_t kQuiet   = 2048;   // frames of silence first
+    static constexpr uint32_t kCapture = 4096;   // frames of mic stream searched
+    static constexpr uint32_t kMaxLag  = kCapture - kBurst;
+    static constexpr int16_t  kLevel   = 8192;   // burst amplitude (-12 dBFS)
+    static constexpr uint32_t kLagsPerPoll = 8;  // ~8k adds a call, a fraction of a USB frame
+    static constexpr uint32_t kTimeoutUs = 1000000;
+
+    enum Status : uint8_t { Ok = 0, WeakPeak = 1, NoOutStream = 2, Busy = 3 };
+
+    LoopbackMeter()
+    {
+        // x^10 + x^7 + 1: period 1023
+        uint32_t lfsr = 1;
+        for (uint32_t i = 0; i < kBurst; i++) {
+            uint32_t bit = lfsr & 1;
+            if (bit) mls[i >> 5] |= 1u << (i & 31);
+            uint32_t fb = ((lfsr >> 0) ^ (lfsr >> 3)) & 1;
+            lfsr = (lfsr >> 1) | (fb << 9);
+        }
+    }
+
+    bool active() const { return state != Idle && state != Done; }
+
+    // SysEx request. A request while one is running is answered with Busy.
+    void start(uint32_t nowUs)
+    {
+        if (active()) { busyReply = true; return; }
+        state = Quiet;
+        outIdx = inIdx = 0;
+        startUs = nowUs;
+        haveRun = false;
+        sofs = 0;
+        errMin = INT32_MAX; errMax = INT32_MIN;
+        errSum = 0; errSq = 0; runs = 0;
+        pktMin = 0xFFFF; pktMax = 0;
+        lag = 0; bestLag = 0; best = 0; second = 0;
+        for (int i = 0; i < kTop; i++) top[i] = {};
+    }
+
+    // audio_task, once per run: SOFs handled this run, the time, OUT frames received
+    void onRun(uint32_t frames, uint32_t nowUs, uint32_t outFrames)
+    {
+        if (!active() || state == Search) return;
+        if (!haveRun) { firstUs = nowUs; haveRun = true; }
+        else {
+            sofs += frames;
+            int32_t e = (int32_t)(nowUs - firstUs) - (int32_t)(sofs * 1000);
+            if (e < errMin) errMin = e;
+            if (e > errMax) errMax = e;
+            errSum += e; errSq += (int64_t)e * e; runs++;
+            uint32_t per = outFrames / frames;
+            if (per < pktMin) pktMin = (uint16_t)per;
+            if (per > pktMax) pktMax = (uint16_t)per;
+        }
+        // The host stopped (or never started) sending before the burst was out
+        if (nowUs - startUs > kTimeoutUs) finish(NoOutStream);
+    }
+
+    // Speaker frames on their way into the OUT ring: the first channel is replaced
+    void onSpeaker(int16_t *frames, uint32_t n, int stride)
+    {
+        if (state != Quiet && state != Burst) return;
+        for (uint32_t i = 0; i < n; i++, outIdx++) {
+            int16_t s = 0;
+            if (outIdx >= kQuiet && outIdx < kQuiet + kBurst) {
+                uint32_t k = outIdx - kQuiet;
+                s = (mls[k >> 5] >> (k & 31)) & 1 ? kLevel : -kLevel;
+            }
+            frames[i * stride] = s;
+        }
+        if (outIdx >= kQuiet) state = Burst;
+    }
+
+    // Mic frames as they leave in an IN packet: the first channel is captured
+    void onMic(const int16_t *frames, uint32_t n, int stride)
+    {
+        if (state != Quiet && state != Burst) return;
+        for (uint32_t i = 0; i < n; i++, inIdx++) {
+            if (inIdx < kQuiet) continue;
+            uint32_t k = inIdx - kQuiet;
+            if (k >= kCapture) break;
+            capture[k] = frames[i * stride];
+        }
+        if (inIdx >= kQuiet + kCapture && outIdx >= kQuiet + kBurst) state = Search;
+    }
+
+    // Main loop (core 0): a few correlation lags at a time
+    void poll()
+    {
+        if (state != Search) return;
+        for (uint32_t n = 0; n < kLagsPerPoll && lag < kMaxLag; n++, lag++) {
+            int32_t acc = 0;
+            const int16_t *x = &capture[lag];
+            for (uint32_t k = 0; k < kBurst; k++)
+                acc += (mls[k >> 5] >> (k & 31)) & 1 ? x[k] : -x[k];
+            keep(acc < 0 ? -acc : acc, lag, acc < 0);
+        }
+        if (lag < kMaxLag) return;
+
+        // The peak, and the largest sidelobe at least 3 lags from it
+        best = top[0].mag; bestLag = top[0].lag; negative = top[0].neg;
+        second = 0;
+        for (int i = 1; i < kTop; i++) {
+            uint32_t d = top[i].lag > bestLag ? top[i].lag - bestLag : bestLag - top[i].lag;
+            if (d > 2) { second = top[i].mag; break; }
+        }
+        // Burst present (well above a 12-bit noise floor) and the peak clear of the rest
+        finish(best < 8 * (int32_t)kBurst || best < 4 * second ? WeakPeak : Ok);
+    }
+
+    // Result, as SysEx F0 7D 06 status lat_lo lat_hi ratio polarity jpp_lo jpp_hi
+    // jrms_lo jrms_hi pktmin pktmax runs_lo runs_hi F7 (14-bit values, 7 bits a byte;
+    // ratio = peak / largest sidelobe, capped at 127; jitter in us). Once per result.
+    uint32_t report(uint8_t *buf)
+    {
+        Status st;
+        if (busyReply) { busyReply = false; st = Busy; }
+        else if (state == Done && !reported) { reported = true; st = status; }
+        else return 0;
+
+        uint32_t latency = st == Ok || st == WeakPeak ? bestLag : 0;
+        uint32_t ratio = second ? best / second : 127;
+        uint32_t jpp = runs ? (uint32_t)(errMax - errMin) : 0;
+        uint32_t jrms = 0;
+        if (runs) {
+            double mean = (double)errSum / runs;
+            double var = (double)errSq / runs - mean * mean;
+            jrms = (uint32_t)(sqrt(var > 0 ? var : 0) + 0.5);
+        }
+        uint8_t *p = buf;
+        *p++ = 0xF0; *p++ = 0x7D; *p++ = 0x06;
+        *p++ = st;
+        put14(p, latency);
+        *p++ = (uint8_t)(ratio > 127 ? 127 : ratio);
+        *p++ = negative;
+        put14(p, jpp);
+        put14(p, jrms);
+        *p++ = (uint8_t)(pktMin > 127 ? 127 : (runs ? pktMin : 0));
+        *p++ = (uint8_t)(pktMax > 127 ? 127 : pktMax);
+        put14(p, runs);
+        *p++ = 0xF7;
+        return (uint32_t)(p - buf);
+    }
+
+    // Last result, for tests
+    uint32_t latency() const { return bestLag; }
+    Status result() const { return status; }
+
+private:
+    enum State : uint8_t { Idle, Quiet, Burst, Search, Done };
+
+    void finish(Status s) { status = s; state = Done; reported = false; }
+
+    // The kTop largest correlations so far, largest first: enough that the largest
+    // sidelobe survives the peak's own neighbours
+    static constexpr int kTop = 8;
+    struct Peak { int32_t mag; uint32_t lag; bool neg; };
+    Peak top[kTop] = {};
+
+    void keep(int32_t mag, uint32_t l, bool neg)
+    {
+        if (mag <= top[kTop - 1].mag) return;
+        int i = kTop - 1;
+        for (; i > 0 && top[i - 1].mag < mag; i--) top[i] = top[i - 1];
+        top[i] = { mag, l, neg };
+    }
+
+    static void put14(uint8_t *&p, uint32_t v)
+    {
+        if (v > 0x3FFF) v = 0x3FFF;
+        *p++ = v & 0x7F;
+        *p++ = (v >> 7) & 0x7F;
+    }
+
+    uint32_t mls[(kBurst + 31) / 32] = {};
+    int16_t capture[kCapture] = {};
+
+    State state = Idle;
+    Status status = Ok;
+    bool reported = true, busyReply = false, negative = false;
+    uint32_t outIdx = 0, inIdx = 0;
+
+    uint32_t startUs = 0, firstUs = 0, sofs = 0, runs = 0;
+    bool haveRun = false;
+    int32_t errMin = 0, errMax = 0;
+    int64_t errSum = 0, errSq = 0;
+    uint16_t pktMin = 0, pktMax = 0;
+
+    uint32_t lag = 0, bestLag = 0;
+    int32_t best = 0, second = 0;
+};
+
+#endif // LOOPBACK_H
@@ -57,6 +57,8 @@
 #include "hardware/pwm.h"
 #include "usb_descriptors.h"
 #include "ring_buffer.h"
+#include "audio_stream.h"
+#include "usb_clock.h"
 #include "hardware/flash.h"
 #include "hardware/watchdog.h" 
 #include "pico/bootrom.h"
@@ -326,35 +328,33 @@ void ProcessSysEx(uint8_t* data, uint8_t len) {
 
     // CMD 5: BOOTLOADER
     if (cmd == 5) reset_usb_boot(0, 0);
+
+    // CMD 6: LOOPBACK MEASUREMENT (loopback.h) - answered from midi_task when done
+    if (cmd == 6) loopback.start(audio_stream_micros());
 }
 
 //--------------------------------------------------------------------+
-// Audio Ring Buffers (shared between cores)
+// MIDI Ring Buffers (shared between cores); the audio rings are in audio_stream.h
 //--------------------------------------------------------------------+
-audio_ring_buffer_t audioInRB;   // ADC -> USB (Mic)
-audio_ring_buffer_t audioOutRB;  // USB -> DAC (Speaker)
 audio_ring_buffer_t midiInRB;    // Core 1 (CV/Knobs) -> Core 0 (USB MIDI TX)
 audio_ring_buffer_t midiOutRB;   // Core 0 (USB MIDI RX) -> Core 1 (CV Logic)
 
 //--------------------------------------------------------------------+
 // TinyUSB Audio Configuration
 //--------------------------------------------------------------------+
-const uint32_t sample_rates[] = {48000, 44100, 24000};
-#define N_SAMPLE_RATES TU_ARRAY_SIZE(sample_rates)
-
 uint32_t current_sample_rate = 48000;
 
 // Audio controls
 uint8_t mute[CFG_TUD_AUDIO_FUNC_1_N_CHANNELS_RX + 1];
 int16_t volume[CFG_TUD_AUDIO_FUNC_1_N_CHANNELS_RX + 1];
 
-// Buffer for speaker data
-int16_t spk_buf[CFG_TUD_AUDIO_FUNC_1_EP_OUT_SW_BUF_SZ / 2];
 int spk_data_size;
 
 // Current resolution
 uint8_t current_resolution = 16;
 
+uint32_t audio_stream_micros() { return time_us_32(); }
+
 //--------------------------------------------------------------------+
 // ComputerCard Audio Processing (runs on Core 1 @ 48kHz)
 //--------------------------------------------------------------------+
@@ -681,20 +681,9 @@ public:
         led_counter++;
         
         // ===== OUTPUT LOGIC =====
-        int streamIdx = 0;
-        int16_t streamData[6] = {0,0,0,0,0,0}; 
-        int wordsToPop = 3; // ALWAYS 3 words (6 channels) on internal RB bus
-        
-        if (rb_count(&audioOutRB) >= wordsToPop) {
-            for(int w=0; w<wordsToPop; w++) {
-                uint32_t s;
-                rb_pop(&audioOutRB, &s);
-                if (streamIdx < 6) streamData[streamIdx++] = (int16_t)(s & 0xFFFF);
-                if (streamIdx < 6) streamData[streamIdx++] = (int16_t)(s >> 16);
-            }
-        } else {
-             for(int k=0; k<6; k++) streamData[k] = 0;
-        }
+        AudioFrame frame = {};  // ALWAYS 6 channels on the internal bus; silence if the ring is empty
+        audioOutRing.pop(frame);
+        int16_t *streamData = frame.ch;
 
         int currentStreamPtr = 0;
         for(int i=0; i<6; i++) {
@@ -727,8 +716,8 @@ public:
         }
         
         // ===== INPUT LOGIC =====
-        streamIdx = 0;
-        // int16_t inStream[6]; // Re-use streamData
+        int streamIdx = 0;
+        // Re-use streamData
         
         for(int i=0; i<6; i++) {
             if (config.usbInMask & (1<<i)) {
@@ -737,13 +726,8 @@ public:
         }
         while(streamIdx < 6) streamData[streamIdx++] = 0; // Pad
         
-        // Input Bus is also 6-channel fixed
-        if (rb_count(&audioInRB) < (AUDIO_BUFFER_SIZE - 4)) {
-            for(int w=0; w<3; w++) {
-                uint32_t s = (uint16_t)streamData[w*2] | ((uint32_t)(uint16_t)streamData[w*2+1] << 16);
-                rb_push(&audioInRB, s);
-            }
-        }
+        // Input Bus is also 6-channel fixed (dropped if the ring is full)
+        audioInRing.push(frame);
         
         // LEDs
         if (led_counter % 1000 == 0) {
@@ -757,10 +741,10 @@ public:
              }
              
              // LED 2: Speaker Activity
-             LedOn(2, rb_count(&audioOutRB) > 0);
+             LedOn(2, audioOutRing.count() > 0);
              
              // LED 3: Mic Activity
-             LedOn(3, rb_count(&audioInRB) > 0);
+             LedOn(3, audioInRing.count() > 0);
              
              // LED 4: USB Ready
              LedOn(4, tud_ready());
@@ -899,19 +883,8 @@ bool tud_audio_set_itf_cb(uint8_t rhport, tusb_control_request_t const *p_reques
     
     if (alt != 0) {
         // Streaming enabled
-        if (itf == ITF_NUM_AUDIO_STREAMING_SPK) {
-            // Speaker streaming starting - pre-fill buffer
-            rb_clear(&audioOutRB);
-            // Must be multiple of 3 (atomic sample size) to preserve channel alignment
-            // Balanced buffer (200 samples * 3 words = ~12.5ms @ 48kHz)
-            for (int i = 0; i < 600; i++) {
-                rb_push(&audioOutRB, 0);
-            }
-        }
-        else if (itf == ITF_NUM_AUDIO_STREAMING_MIC) {
-            // Mic streaming starting - clear buffer
-            rb_clear(&audioInRB);
-        }
+        if (itf == ITF_NUM_AUDIO_STREAMING_SPK) AudioStreamStartSpeaker();
+        else if (itf == ITF_NUM_AUDIO_STREAMING_MIC) AudioStreamStartMic();
     }
     
     spk_data_size = 0;
@@ -925,127 +898,6 @@ bool tud_audio_tx_done_pre_load_cb(uint8_t rhport, uint8_t itf, uint8_t ep_in, u
     return true;
 }
 
-//--------------------------------------------------------------------+
-// USB Audio Task (Core 0) - runs every 1ms
-//--------------------------------------------------------------------+
-static int16_t mic_buf[600];  // Buffer for 6-channel mic data to send
-
-void audio_task(void)
-{
-    static uint32_t start_ms = 0;
-    uint32_t curr_ms = board_millis();
-    if (start_ms == curr_ms) return;  // Run once per ms
-    start_ms = curr_ms;
-    
-    // Determine RX (Spk) and TX (Mic) channel counts based on Config
-    uint8_t rx_channels = g_channelsOut; // Explicitly configured
-    uint8_t tx_channels = g_channelsIn;  // Explicitly configured
-    
-    // Safety clamp to allowed values (2, 4, 6)
-    if (rx_channels != 2 && rx_channels != 4 && rx_channels != 6) rx_channels = 6;
-    if (tx_channels != 2 && tx_channels != 4 && tx_channels != 6) tx_channels = 6;
-    
-    uint8_t rx_bytes_per_sample = rx_channels * 2;
-    uint8_t tx_bytes_per_sample = tx_channels * 2;
-    
-    // ===== SPEAKER RX (USB -> DAC) =====
-    // Format: [Ch1 Ch2 ...] per sample, each 16-bit
-    uint32_t bytes_available = tud_audio_available();
-    
-    // Fix: Only read full frames to avoid dropping partial bytes and shifting channels
-    // If we read partials (e.g. 2 leftover bytes of a 4-byte frame), we lose them and desync.
-    uint32_t aligned_bytes = (bytes_available / rx_bytes_per_sample) * rx_bytes_per_sample;
-    
-    if (aligned_bytes > 0) {
-        uint32_t bytes_read = tud_audio_read(spk_buf, aligned_bytes);
-        
-        uint32_t samples_read = bytes_read / rx_bytes_per_sample;
-        for (uint32_t i = 0; i < samples_read; i++) {
-            // Pack channels 1-2 (always present)
-            uint32_t val_12 = (uint16_t)spk_buf[rx_channels*i] | ((uint32_t)(uint16_t)spk_buf[rx_channels*i+1] << 16);
-            rb_push(&audioOutRB, val_12);
-            
-            // Pack channels 3-4 (present for 4ch and 6ch)
-            if (rx_channels >= 4) {
-                uint32_t val_34 = (uint16_t)spk_buf[rx_channels*i+2] | ((uint32_t)(uint16_t)spk_buf[rx_channels*i+3] << 16);
-                rb_push(&audioOutRB, val_34);
-            } else {
-                rb_push(&audioOutRB, 0); // Silence
-            }
-            
-            // Pack channels 5-6 (present only for 6ch)
-            if (rx_channels >= 6) {
-                uint32_t val_56 = (uint16_t)spk_buf[rx_channels*i+4] | ((uint32_t)(uint16_t)spk_buf[rx_channels*i+5] << 16);
-                rb_push(&audioOutRB, val_56);
-            } else {
-                rb_push(&audioOutRB, 0); // Silence
-            }
-        }
-    }
-    
-    // ===== MIC TX (ADC -> USB) =====
-    uint32_t count = rb_count(&audioInRB);
-    
-    // Adaptive Packet Size logic
-    uint32_t samples_to_send = 48; // Default for 48k
-
-    if (g_sampleRateIdx == 1) { // 44.1k
-         static uint32_t phase_acc = 0;
-         uint32_t target_mhz = 44100;
-         if (count > 3000) target_mhz = 44150;       
-         else if (count > 2200) target_mhz = 44105;  
-         else if (count < 1000) target_mhz = 44000;  
-         else if (count < 1900) target_mhz = 44095;
-         phase_acc += target_mhz;
-         samples_to_send = phase_acc / 1000;
-         phase_acc %= 1000;
-    } else if (g_sampleRateIdx == 2) { // 24k
-         samples_to_send = 24;
-         if (count > 3000) samples_to_send = 25;
-         else if (count < 1000) samples_to_send = 23;
-    } else { // 48k
-         samples_to_send = 48;
-         if (count > 3000) samples_to_send = 49;
-         else if (count < 1000) samples_to_send = 47;
-    }
-    
-    for (uint32_t i = 0; i < samples_to_send; i++) {
-        uint32_t val_12, val_34, val_56;
-        
-        // Pop 3 words (Always 6ch internally)
-        if (rb_count(&audioInRB) >= 3) {
-            rb_pop(&audioInRB, &val_12);
-            rb_pop(&audioInRB, &val_34);
-            rb_pop(&audioInRB, &val_56);
-            
-            int16_t ch1 = (int16_t)(val_12 & 0xFFFF);
-            int16_t ch2 = (int16_t)((val_12 >> 16) & 0xFFFF);
-            int16_t ch3 = (int16_t)(val_34 & 0xFFFF);
-            int16_t ch4 = (int16_t)((val_34 >> 16) & 0xFFFF);
-            int16_t ch5 = (int16_t)(val_56 & 0xFFFF);
-            int16_t ch6 = (int16_t)((val_56 >> 16) & 0xFFFF);
-            
-            // Pack TX buffer based on tx_channels
-            mic_buf[tx_channels*i] = ch1;
-            mic_buf[tx_channels*i+1] = ch2;
-            if (tx_channels >= 4) {
-                mic_buf[tx_channels*i+2] = ch3;
-                mic_buf[tx_channels*i+3] = ch4;
-            }
-            if (tx_channels >= 6) {
-                mic_buf[tx_channels*i+4] = ch5;
-                mic_buf[tx_channels*i+5] = ch6;
-            }
-        } else {
-            // Buffer underrun
-            for(int j=0; j<tx_channels; j++) mic_buf[tx_channels*i+j] = 0;
-        }
-    }
-    
-    // Write using TX byte count
-    tud_audio_write((uint8_t*)mic_buf, samples_to_send * tx_bytes_per_sample);
-}
-
 void midi_task(void)
 {
     if (g_audioOnly) return;
@@ -1086,7 +938,11 @@ void midi_task(void)
         }
     }
 
-    // 2. Send Events from Core 1
+    // 2. Loopback measurement result, once
+    uint8_t result[20];
+    if (uint32_t n = loopback.report(result)) tud_midi_stream_write(0, result, n);
+
+    // 3. Send Events from Core 1
     // Limit to 10 events per task call to balance load
     for(int i=0; i<10; i++) {
         uint32_t evt;
@@ -1120,10 +976,9 @@ int main(void)
     g_audioOnly = CheckDebugSwitch();
     
     // Initialize ring buffers
-    rb_init(&audioInRB);
-    rb_init(&audioOutRB);
     rb_init(&midiInRB);
     rb_init(&midiOutRB); // Init new buffer
+    micResampler.init();  // Coefficient table
     
     board_init();
 
@@ -1138,6 +993,7 @@ int main(void)
         .speed = TUSB_SPEED_AUTO
     };
     tusb_init(BOARD_TUD_RHPORT, &dev_init);
+    tud_sof_cb_enable(true);  // audio_task runs on USB frames
     
     if (board_init_after_tusb) {
         board_init_after_tusb();
@@ -1149,6 +1005,7 @@ int main(void)
         audio_task(); // Service Audio
         midi_task();  // Service MIDI (now limited)
         audio_task(); // Service Audio AGAIN to ensure priority
+        loopback.poll(); // Loopback measurement: a slice of the correlation, when one is due
     }
     
     return 0;
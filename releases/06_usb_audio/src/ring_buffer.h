@@ -1,5 +1,5 @@
 /*
- * Lock-free ring buffer for audio samples between cores
+ * Lock-free ring buffer of 32-bit words between cores (MIDI events; audio uses frame_ring.h)
  */
 
 #ifndef RING_BUFFER_H
@@ -110,6 +110,10 @@ extern "C" {
 // Allow volume controlled by on-baord button
 #define CFG_TUD_AUDIO_ENABLE_INTERRUPT_EP                            1
 
+// Speaker is an asynchronous sink: explicit feedback EP, value set by audio_task through
+// tud_audio_fb_set() in 16.16 samples per frame (the driver packs 10.14 for full speed)
+#define CFG_TUD_AUDIO_ENABLE_FEEDBACK_EP                             1
+
 // How many formats are used, need to adjust USB descriptor if changed
 #define CFG_TUD_AUDIO_FUNC_1_N_FORMATS                               2
 
@@ -0,0 +1,163 @@
+/*
+ * Clock recovery between the USB host and the card's sample clock
+ *
+ * The card's ADC/DAC run from its own crystal (ComputerCard's ADC divider), while the
+ * host counts samples against its own 1 ms USB frames (SOF). The two drift apart by
+ * tens of ppm, so each direction is servoed on the fill of its ring buffer:
+ *
+ * - Speaker (OUT): asynchronous endpoint with an explicit feedback endpoint. A RateServo
+ *   turns the OUT ring's fill into the UAC feedback value, so the host sends exactly as
+ *   many samples as the DAC plays and the ring holds a few packets, no more.
+ * - Mic (IN): synchronous endpoint. The host expects the nominal rate per USB frame, so
+ *   a FracResampler converts ADC frames to host frames, its ratio set by a RateServo on
+ *   the IN ring's fill.
+ *
+ * Both update once per USB frame in audio_task (core 0). host/clock_sim.cpp runs them
+ * against drifting virtual clocks and reports latency, slips and THD+N.
+ */
+
+#ifndef USB_CLOCK_H
+#define USB_CLOCK_H
+
+#include <stdint.h>
+#include <math.h>
+
+// PI loop on a ring's fill level. update() is called once per USB frame with the ring's
+// fill in frames; it returns the rate error as a Q32 fraction: positive when the ring is
+// too full (drain faster / ask for less), e.g. 4295 = +1 ppm.
+class RateServo {
+public:
+    static constexpr int32_t kMaxRate = 21474836;  // ±0.5%
+
+    // target: fill to hold, in frames. tauSec: loop time constant (critically damped).
+    void init(uint32_t sampleRate, int32_t targetFrames, float tauSec = 2.0f)
+    {
+        target = targetFrames;
+        // Rate per frame of fill error; the ring integrates rate * fs, so tau = 1 / (fs * kp)
+        double kpReal = 1.0 / ((double)sampleRate * tauSec);
+        double kiReal = (double)sampleRate * kpReal * kpReal / 4.0 / 1000.0;  // per 1 ms update
+        kp = (int32_t)llround(kpReal * 4294967296.0 / 256.0);           // Q32 per Q8 frame
+        ki = (int32_t)llround(kiReal * 72057594037927936.0 / 256.0);    // Q56 per Q8 frame
+        reset();
+    }
+
+    void reset() { primed = false; integ = 0; }
+
+    int32_t update(int32_t fillFrames)
+    {
+        int32_t x = fillFrames << 8;
+        if (!primed) { lp1 = lp2 = x; primed = true; }
+        // Two one-pole smoothers (~32 ms each) take out packet-sized steps and task jitter
+        lp1 += (x - lp1) >> 5;
+        lp2 += (lp1 - lp2) >> 5;
+
+        int32_t e = lp2 - (target << 8);
+        integ += (int64_t)e * ki;
+        const int64_t iMax = (int64_t)kMaxRate << 24;
+        if (integ > iMax) integ = iMax;
+        if (integ < -iMax) integ = -iMax;
+
+        int64_t r = (int64_t)e * kp + (integ >> 24);
+        if (r > kMaxRate) r = kMaxRate;
+        if (r < -kMaxRate) r = -kMaxRate;
+        return (int32_t)r;
+    }
+
+    int32_t fillQ8() const { return lp2; }   // smoothed fill, frames << 8
+
+private:
+    int32_t target = 0, kp = 0, ki = 0;
+    int32_t lp1 = 0, lp2 = 0;
+    int64_t integ = 0;
+    bool primed = false;
+};
+
+// Polyphase windowed-sinc fractional resampler for up to 6 interleaved channels. Ratios
+// stay within a fraction of a percent of 1, so one filter serves as the interpolator:
+// TAPS taps, PHASES phases, coefficients linearly interpolated between phases (shared by
+// all channels). Output lags input by TAPS/2 frames.
+class FracResampler {
+public:
+    static constexpr int TAPS = 16;
+    static constexpr int PHASES = 128;
+    static constexpr int MAXCH = 6;
+    static constexpr int32_t ONE = 1 << 15;     // coefficient scale (Q15; the peak is ~0.9)
+
+    // Build the coefficient table (once, at boot)
+    void init()
+    {
+        const double kPi = 3.14159265358979323846;
+        const double fc = 0.90;                   // cutoff, fraction of Nyquist
+        for (int p = 0; p <= PHASES; p++) {
+            double t = TAPS / 2 - 1 + (double)p / PHASES;   // output position among the taps
+            double h[TAPS], sum = 0;
+            for (int k = 0; k < TAPS; k++) {
+                double x = k - t;
+                double s = x == 0 ? fc : sin(kPi * fc * x) / (kPi * x);
+                double w = x / (TAPS / 2);        // Blackman over ±TAPS/2
+                w = (w <= -1 || w >= 1) ? 0 : 0.42 + 0.5 * cos(kPi * w) + 0.08 * cos(2 * kPi * w);
+                h[k] = s * w;
+                sum += h[k];
+            }
+            int32_t q = 0;
+            for (int k = 0; k < TAPS; k++) q += coef[p][k] = (int16_t)lrint(h[k] / sum * ONE);
+            coef[p][TAPS / 2 - 1 + (2 * p >= PHASES)] += ONE - q;    // DC gain exactly 1
+        }
+        reset();
+    }
+
+    void reset()
+    {
+        for (int c = 0; c < MAXCH; c++)
+            for (int k = 0; k < 2 * TAPS; k++) hist[c][k] = 0;
+        head = 0;
+        frac = 0;
+    }
+
+    // One output frame of NCH channels. rate is a Q32 offset from 1:1 (input frames per
+    // output frame = 1 + rate / 2^32). pull() returns the next input frame's channels (read
+    // in place, e.g. from a ring span), or nullptr when none is ready; the last frame is
+    // then held and counted in underruns.
+    template <int NCH, typename Pull>
+    void process(int32_t rate, int16_t *out, Pull pull)
+    {
+        static_assert(NCH >= 1 && NCH <= MAXCH, "channel count");
+        int64_t pos = (int64_t)frac + 4294967296LL + rate;
+        frac = (uint32_t)pos;
+        for (int n = (int)(pos >> 32); n > 0; n--) {
+            const int16_t *f = pull();
+            if (!f) underruns++;
+            for (int c = 0; c < NCH; c++) {
+                int16_t x = f ? f[c] : hist[c][head + TAPS - 1];
+                hist[c][head] = hist[c][head + TAPS] = x;
+            }
+            head = (head + 1) & (TAPS - 1);
+        }
+
+        // hist[c][head .. head + TAPS - 1] runs oldest to newest
+        int p = frac >> 25;                           // 7-bit phase
+        int32_t f = (frac >> 9) & 0xFFFF;             // position between phases
+        int32_t cf[TAPS], sum = 0;
+        for (int k = 0; k < TAPS; k++)
+            sum += cf[k] = coef[p][k] + (((coef[p + 1][k] - coef[p][k]) * f + 0x8000) >> 16);
+        cf[TAPS / 2 - 1 + (2 * p >= PHASES)] += ONE - sum;    // rounding off the gain, onto the centre tap
+        for (int c = 0; c < NCH; c++) {
+            const int16_t *x = &hist[c][head];
+            int32_t acc = 0;
+            for (int k = 0; k < TAPS; k++) acc += cf[k] * x[k];
+            acc = (acc + ONE / 2) >> 15;
+            out[c] = (int16_t)(acc > 32767 ? 32767 : (acc < -32768 ? -32768 : acc));
+        }
+    }
+
+    uint32_t underruns = 0;
+
+private:
+    static_assert((TAPS & (TAPS - 1)) == 0 && ((int64_t)PHASES << 25) == (1LL << 32), "table layout");
+    int16_t coef[PHASES + 1][TAPS];
+    int16_t hist[MAXCH][2 * TAPS];
+    int head = 0;
+    uint32_t frac = 0;
+};
+
+#endif // USB_CLOCK_H
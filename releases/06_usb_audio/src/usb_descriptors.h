@@ -169,6 +169,13 @@ enum
 #define UAC1_ENTITY_MIC_INPUT_TERMINAL  0x11
 #define UAC1_ENTITY_MIC_OUTPUT_TERMINAL 0x13
 
+// Speaker feedback endpoint (UAC1 synch endpoint, 9 bytes): the device reports its rate
+// in samples per frame, 10.14, every 2^_refresh ms; main.cpp's RateServo sets the value.
+#define TUD_AUDIO10_HEADSET_FB_EP_LEN 9
+#define TUD_AUDIO10_HEADSET_FB_REFRESH 5   // 32 ms
+#define TUD_AUDIO10_HEADSET_FB_EP(_ep) \
+    TUD_AUDIO10_HEADSET_FB_EP_LEN, TUSB_DESC_ENDPOINT, _ep, (uint8_t)((uint8_t)TUSB_XFER_ISOCHRONOUS | (uint8_t)TUSB_ISO_EP_ATT_EXPLICIT_FB), U16_TO_U8S_LE(3), /*_interval*/ 0x01, /*_refresh*/ TUD_AUDIO10_HEADSET_FB_REFRESH, /*_syncep*/ 0x00
+
 // Helper for length calculation
 #define TUD_AUDIO10_HEADSET_STEREO_DESC_LEN(_nfreqs) \
     (0 /* TUD_AUDIO_DESC_IAD_LEN */\
@@ -186,6 +193,7 @@ enum
     + TUD_AUDIO10_DESC_TYPE_I_FORMAT_LEN(_nfreqs)\
     + TUD_AUDIO10_DESC_STD_AS_ISO_EP_LEN\
     + TUD_AUDIO10_DESC_CS_AS_ISO_EP_LEN\
+    + TUD_AUDIO10_HEADSET_FB_EP_LEN\
     /* Interface 2, Alternate 0 (microphone) */\
     + TUD_AUDIO10_DESC_STD_AS_LEN\
     /* Interface 2, Alternate 1 (microphone) */\
@@ -226,15 +234,17 @@ enum
     /* Standard AS Interface Descriptor(4.5.1) - Speaker Interface 1, Alternate 0 */\
     TUD_AUDIO10_DESC_STD_AS_INT(/*_itfnum*/ (uint8_t)((_itfnum)+1), /*_altset*/ 0x00, /*_nEPs*/ 0x00, /*_stridx*/ _stridx),\
     /* Standard AS Interface Descriptor(4.5.1) - Speaker Interface 1, Alternate 1 */\
-    TUD_AUDIO10_DESC_STD_AS_INT(/*_itfnum*/ (uint8_t)((_itfnum)+1), /*_altset*/ 0x01, /*_nEPs*/ 0x01, /*_stridx*/ _stridx),\
+    TUD_AUDIO10_DESC_STD_AS_INT(/*_itfnum*/ (uint8_t)((_itfnum)+1), /*_altset*/ 0x01, /*_nEPs*/ 0x02, /*_stridx*/ _stridx),\
     /* Class-Specific AS Interface Descriptor(4.5.2) */\
     TUD_AUDIO10_DESC_CS_AS_INT(/*_termid*/ UAC1_ENTITY_SPK_INPUT_TERMINAL, /*_delay*/ 0x01, /*_formattype*/ AUDIO10_DATA_FORMAT_TYPE_I_PCM),\
     /* Type I Format Type Descriptor(2.2.5) */\
     TUD_AUDIO10_DESC_TYPE_I_FORMAT(/*_nrchannels*/ 0x02, /*_subframesize*/ _nBytesPerSample_RX, /*_bitresolution*/ _nBitsUsedPerSample_RX, /*_freqs*/ __VA_ARGS__),\
     /* Standard AS Isochronous Audio Data Endpoint Descriptor(4.6.1.1) */\
-    TUD_AUDIO10_DESC_STD_AS_ISO_EP(/*_ep*/ _epout, /*_attr*/ (uint8_t) ((uint8_t)TUSB_XFER_ISOCHRONOUS | (uint8_t)TUSB_ISO_EP_ATT_ADAPTIVE), /*_maxEPsize*/ _epoutsize, /*_interval*/ 0x01, /*_syncep*/ 0x00),\
+    TUD_AUDIO10_DESC_STD_AS_ISO_EP(/*_ep*/ _epout, /*_attr*/ (uint8_t) ((uint8_t)TUSB_XFER_ISOCHRONOUS | (uint8_t)TUSB_ISO_EP_ATT_ASYNCHRONOUS), /*_maxEPsize*/ _epoutsize, /*_interval*/ 0x01, /*_syncep*/ (uint8_t)(0x80 | (_epout))),\
     /* Class-Specific AS Isochronous Audio Data Endpoint Descriptor(4.6.1.2) */\
     TUD_AUDIO10_DESC_CS_AS_ISO_EP(/*_attr*/ AUDIO10_CS_AS_ISO_DATA_EP_ATT_SAMPLING_FRQ, /*_lockdelayunits*/ AUDIO10_CS_AS_ISO_DATA_EP_LOCK_DELAY_UNIT_MILLISEC, /*_lockdelay*/ 0x0001),\
+    /* Standard AS Isochronous Synch (feedback) Endpoint Descriptor(4.6.2.1) */\
+    TUD_AUDIO10_HEADSET_FB_EP(/*_ep*/ (uint8_t)(0x80 | (_epout))),\
     /* Standard AS Interface Descriptor(4.5.1) - Microphone Interface 2, Alternate 0 */\
     TUD_AUDIO10_DESC_STD_AS_INT(/*_itfnum*/ (uint8_t)((_itfnum)+2), /*_altset*/ 0x00, /*_nEPs*/ 0x00, /*_stridx*/ _stridx),\
     /* Standard AS Interface Descriptor(4.5.1) - Microphone Interface 2, Alternate 1 */\
@@ -267,15 +277,17 @@ enum
     /* Standard AS Interface Descriptor(4.5.1) - Speaker Interface 1, Alternate 0 */\
    TUD_AUDIO10_DESC_STD_AS_INT(/*_itfnum*/ (uint8_t)((_itfnum)+1), /*_altset*/ 0x00, /*_nEPs*/ 0x00, /*_stridx*/ _stridx),\
     /* Standard AS Interface Descriptor(4.5.1) - Speaker Interface 1, Alternate 1 */\
-    TUD_AUDIO10_DESC_STD_AS_INT(/*_itfnum*/ (uint8_t)((_itfnum)+1), /*_altset*/ 0x01, /*_nEPs*/ 0x01, /*_stridx*/ _stridx),\
+    TUD_AUDIO10_DESC_STD_AS_INT(/*_itfnum*/ (uint8_t)((_itfnum)+1), /*_altset*/ 0x01, /*_nEPs*/ 0x02, /*_stridx*/ _stridx),\
     /* Class-Specific AS Interface Descriptor(4.5.2) */\
     TUD_AUDIO10_DESC_CS_AS_INT(/*_termid*/ UAC1_ENTITY_SPK_INPUT_TERMINAL, /*_delay*/ 0x01, /*_formattype*/ AUDIO10_DATA_FORMAT_TYPE_I_PCM),\
     /* Type I Format Type Descriptor(2.2.5) */\
     TUD_AUDIO10_DESC_TYPE_I_FORMAT(/*_nrchannels*/ 0x04, /*_subframesize*/ _nBytesPerSample_RX, /*_bitresolution*/ _nBitsUsedPerSample_RX, /*_freqs*/ __VA_ARGS__),\
     /* Standard AS Isochronous Audio Data Endpoint Descriptor(4.6.1.1) */\
-    TUD_AUDIO10_DESC_STD_AS_ISO_EP(/*_ep*/ _epout, /*_attr*/ (uint8_t) ((uint8_t)TUSB_XFER_ISOCHRONOUS | (uint8_t)TUSB_ISO_EP_ATT_ADAPTIVE), /*_maxEPsize*/ _epoutsize, /*_interval*/ 0x01, /*_syncep*/ 0x00),\
+    TUD_AUDIO10_DESC_STD_AS_ISO_EP(/*_ep*/ _epout, /*_attr*/ (uint8_t) ((uint8_t)TUSB_XFER_ISOCHRONOUS | (uint8_t)TUSB_ISO_EP_ATT_ASYNCHRONOUS), /*_maxEPsize*/ _epoutsize, /*_interval*/ 0x01, /*_syncep*/ (uint8_t)(0x80 | (_epout))),\
     /* Class-Specific AS Isochronous Audio Data Endpoint Descriptor(4.6.1.2) */\
     TUD_AUDIO10_DESC_CS_AS_ISO_EP(/*_attr*/ AUDIO10_CS_AS_ISO_DATA_EP_ATT_SAMPLING_FRQ, /*_lockdelayunits*/ AUDIO10_CS_AS_ISO_DATA_EP_LOCK_DELAY_UNIT_MILLISEC, /*_lockdelay*/ 0x0001),\
+    /* Standard AS Isochronous Synch (feedback) Endpoint Descriptor(4.6.2.1) */\
+    TUD_AUDIO10_HEADSET_FB_EP(/*_ep*/ (uint8_t)(0x80 | (_epout))),\
     /* Standard AS Interface Descriptor(4.5.1) - Microphone Interface 2, Alternate 0 */\
     TUD_AUDIO10_DESC_STD_AS_INT(/*_itfnum*/ (uint8_t)((_itfnum)+2), /*_altset*/ 0x00, /*_nEPs*/ 0x00, /*_stridx*/ _stridx),\
     /* Standard AS Interface Descriptor(4.5.1) - Microphone Interface 2, Alternate 1 */\
@@ -308,15 +320,17 @@ enum
     /* Standard AS Interface Descriptor(4.5.1) - Speaker Interface 1, Alternate 0 */\
     TUD_AUDIO10_DESC_STD_AS_INT(/*_itfnum*/ (uint8_t)((_itfnum)+1), /*_altset*/ 0x00, /*_nEPs*/ 0x00, /*_stridx*/ _stridx),\
     /* Standard AS Interface Descriptor(4.5.1) - Speaker Interface 1, Alternate 1 */\
-    TUD_AUDIO10_DESC_STD_AS_INT(/*_itfnum*/ (uint8_t)((_itfnum)+1), /*_altset*/ 0x01, /*_nEPs*/ 0x01, /*_stridx*/ _stridx),\
+    TUD_AUDIO10_DESC_STD_AS_INT(/*_itfnum*/ (uint8_t)((_itfnum)+1), /*_altset*/ 0x01, /*_nEPs*/ 0x02, /*_stridx*/ _stridx),\
     /* Class-Specific AS Interface Descriptor(4.5.2) */\
     TUD_AUDIO10_DESC_CS_AS_INT(/*_termid*/ UAC1_ENTITY_SPK_INPUT_TERMINAL, /*_delay*/ 0x01, /*_formattype*/ AUDIO10_DATA_FORMAT_TYPE_I_PCM),\
     /* Type I Format Type Descriptor(2.2.5) */\
     TUD_AUDIO10_DESC_TYPE_I_FORMAT(/*_nrchannels*/ 0x06, /*_subframesize*/ _nBytesPerSample_RX, /*_bitresolution*/ _nBitsUsedPerSample_RX, /*_freqs*/ __VA_ARGS__),\
     /* Standard AS Isochronous Audio Data Endpoint Descriptor(4.6.1.1) */\
-    TUD_AUDIO10_DESC_STD_AS_ISO_EP(/*_ep*/ _epout, /*_attr*/ (uint8_t) ((uint8_t)TUSB_XFER_ISOCHRONOUS | (uint8_t)TUSB_ISO_EP_ATT_ADAPTIVE), /*_maxEPsize*/ _epoutsize, /*_interval*/ 0x01, /*_syncep*/ 0x00),\
+    TUD_AUDIO10_DESC_STD_AS_ISO_EP(/*_ep*/ _epout, /*_attr*/ (uint8_t) ((uint8_t)TUSB_XFER_ISOCHRONOUS | (uint8_t)TUSB_ISO_EP_ATT_ASYNCHRONOUS), /*_maxEPsize*/ _epoutsize, /*_interval*/ 0x01, /*_syncep*/ (uint8_t)(0x80 | (_epout))),\
     /* Class-Specific AS Isochronous Audio Data Endpoint Descriptor(4.6.1.2) */\
     TUD_AUDIO10_DESC_CS_AS_ISO_EP(/*_attr*/ AUDIO10_CS_AS_ISO_DATA_EP_ATT_SAMPLING_FRQ, /*_lockdelayunits*/ AUDIO10_CS_AS_ISO_DATA_EP_LOCK_DELAY_UNIT_MILLISEC, /*_lockdelay*/ 0x0001),\
+    /* Standard AS Isochronous Synch (feedback) Endpoint Descriptor(4.6.2.1) */\
+    TUD_AUDIO10_HEADSET_FB_EP(/*_ep*/ (uint8_t)(0x80 | (_epout))),\
     /* Standard AS Interface Descriptor(4.5.1) - Microphone Interface 2, Alternate 0 */\
     TUD_AUDIO10_DESC_STD_AS_INT(/*_itfnum*/ (uint8_t)((_itfnum)+2), /*_altset*/ 0x00, /*_nEPs*/ 0x00, /*_stridx*/ _stridx),\
     /* Standard AS Interface Descriptor(4.5.1) - Microphone Interface 2, Alternate 1 */\
@@ -349,15 +363,17 @@ enum
     /* Standard AS Interface Descriptor(4.5.1) - Speaker Interface 1, Alternate 0 */\
     TUD_AUDIO10_DESC_STD_AS_INT(/*_itfnum*/ (uint8_t)((_itfnum)+1), /*_altset*/ 0x00, /*_nEPs*/ 0x00, /*_stridx*/ _stridx),\
     /* Standard AS Interface Descriptor(4.5.1) - Speaker Interface 1, Alternate 1 */\
-    TUD_AUDIO10_DESC_STD_AS_INT(/*_itfnum*/ (uint8_t)((_itfnum)+1), /*_altset*/ 0x01, /*_nEPs*/ 0x01, /*_stridx*/ _stridx),\
+    TUD_AUDIO10_DESC_STD_AS_INT(/*_itfnum*/ (uint8_t)((_itfnum)+1), /*_altset*/ 0x01, /*_nEPs*/ 0x02, /*_stridx*/ _stridx),\
     /* Class-Specific AS Interface Descriptor(4.5.2) */\
     TUD_AUDIO10_DESC_CS_AS_INT(/*_termid*/ UAC1_ENTITY_SPK_INPUT_TERMINAL, /*_delay*/ 0x01, /*_formattype*/ AUDIO10_DATA_FORMAT_TYPE_I_PCM),\
     /* Type I Format Type Descriptor(2.2.5) */\
     TUD_AUDIO10_DESC_TYPE_I_FORMAT(/*_nrchannels*/ _nChannelsRX, /*_subframesize*/ _nBytesPerSample_RX, /*_bitresolution*/ _nBitsUsedPerSample_RX, /*_freqs*/ __VA_ARGS__),\
     /* Standard AS Isochronous Audio Data Endpoint Descriptor(4.6.1.1) */\
-    TUD_AUDIO10_DESC_STD_AS_ISO_EP(/*_ep*/ _epout, /*_attr*/ (uint8_t) ((uint8_t)TUSB_XFER_ISOCHRONOUS | (uint8_t)TUSB_ISO_EP_ATT_ADAPTIVE), /*_maxEPsize*/ _epoutsize, /*_interval*/ 0x01, /*_syncep*/ 0x00),\
+    TUD_AUDIO10_DESC_STD_AS_ISO_EP(/*_ep*/ _epout, /*_attr*/ (uint8_t) ((uint8_t)TUSB_XFER_ISOCHRONOUS | (uint8_t)TUSB_ISO_EP_ATT_ASYNCHRONOUS), /*_maxEPsize*/ _epoutsize, /*_interval*/ 0x01, /*_syncep*/ (uint8_t)(0x80 | (_epout))),\
     /* Class-Specific AS Isochronous Audio Data Endpoint Descriptor(4.6.1.2) */\
     TUD_AUDIO10_DESC_CS_AS_ISO_EP(/*_attr*/ AUDIO10_CS_AS_ISO_DATA_EP_ATT_SAMPLING_FRQ, /*_lockdelayunits*/ AUDIO10_CS_AS_ISO_DATA_EP_LOCK_DELAY_UNIT_MILLISEC, /*_lockdelay*/ 0x0001),\
+    /* Standard AS Isochronous Synch (feedback) Endpoint Descriptor(4.6.2.1) */\
+    TUD_AUDIO10_HEADSET_FB_EP(/*_ep*/ (uint8_t)(0x80 | (_epout))),\
     /* Standard AS Interface Descriptor(4.5.1) - Microphone Interface 2, Alternate 0 */\
     TUD_AUDIO10_DESC_STD_AS_INT(/*_itfnum*/ (uint8_t)((_itfnum)+2), /*_altset*/ 0x00, /*_nEPs*/ 0x00, /*_stridx*/ _stridx),\
     /* Standard AS Interface Descriptor(4.5.1) - Microphone Interface 2, Alternate 1 */\
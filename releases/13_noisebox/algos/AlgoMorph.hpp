@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+#include "algos/AlgoRegistry.hpp"
+
+// Click-free algorithm changes on top of AlgoRegistry. When the selected
+// algorithm changes, the outgoing and incoming ones are both rendered and
+// crossfaded over kFadeSamples; otherwise only the active one runs. The
+// very first algorithm fades in from silence.
+//
+// The fade is t(2 - t) in, 1 - t^2 out: within 0.5 dB of equal power for
+// the uncorrelated noise these make, where a linear fade dips 3 dB midway.
+// Turning back to the outgoing algorithm mid-fade reverses it; any other
+// change waits for the current fade to finish.
+//
+// Nothing here touches the card or the SDK, so the host bench builds it
+// unchanged.
+class AlgoMorph
+{
+public:
+    static constexpr int kBlock = 32;
+    static constexpr int kFadeSamples = 512;    // ~10.7 ms at 48 kHz
+
+    explicit AlgoMorph(AlgoRegistry& registry) : algos(registry) {}
+
+    // One block heading for algorithm `target` at controls x/y (0..4095).
+    void renderBlock(int target, uint16_t x, uint16_t y, int16_t* out)
+    {
+        if (incoming < 0 && target != current)
+        {
+            incoming = target;
+            fadePos = 0;
+        }
+        else if (incoming >= 0 && target == current)
+        {
+            // Each gain at t is the other's at 1 - t, so swapping the pair
+            // and mirroring the position continues without a step.
+            current = incoming;
+            incoming = target;
+            fadePos = kFadeSamples - fadePos;
+        }
+
+        if (incoming < 0)
+        {
+            algos.render(current, x, y, out, kBlock);
+            return;
+        }
+
+        if (current >= 0)
+            algos.render(current, x, y, out, kBlock);
+        else
+            for (int i = 0; i < kBlock; ++i) out[i] = 0;
+        algos.render(incoming, x, y, fadeIn, kBlock);
+
+        for (int i = 0; i < kBlock; ++i)
+        {
+            // t in Q15, 0..32768 across the fade
+            int32_t t = ((fadePos + i) << 15) / kFadeSamples;
+            int32_t gainIn = (t * (65536 - t)) >> 15;
+            int32_t gainOut = 32768 - ((t * t) >> 15);
+            int32_t mixed = (out[i] * gainOut + fadeIn[i] * gainIn) >> 15;
+            if (mixed < -2048) mixed = -2048;
+            if (mixed > 2047) mixed = 2047;
+            out[i] = static_cast<int16_t>(mixed);
+        }
+
+        fadePos += kBlock;
+        if (fadePos >= kFadeSamples)
+        {
+            current = incoming;
+            incoming = -1;
+        }
+    }
+
+    // Idle work: settle the algorithms either side of the active one, at
+    // most `budget` samples. Returns false once both are warm.
+    bool warmNeighbours(int budget)
+    {
+        int centre = incoming >= 0 ? incoming : current;
+        if (centre < 0) return false;
+        int below = (centre + AlgoRegistry::kNumAlgos - 1) % AlgoRegistry::kNumAlgos;
+        int above = (centre + 1) % AlgoRegistry::kNumAlgos;
+        if (algos.warm(below, budget)) return true;
+        return algos.warm(above, budget) != 0;
+    }
+
+    int active() const { return incoming >= 0 ? incoming : current; }
+    bool fading() const { return incoming >= 0; }
+
+private:
+    AlgoRegistry& algos;
+    int current = -1;
+    int incoming = -1;
+    int fadePos = 0;
+    int16_t fadeIn[kBlock];
+};
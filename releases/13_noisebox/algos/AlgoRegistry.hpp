@@ -0,0 +1,179 @@
+#pragma once
+
+#include <cstdint>
+#include "algos/ResoNoise.hpp"
+#include "algos/RadioOhNo.hpp"
+#include "algos/CrossModRingSquare.hpp"
+#include "algos/CrossModRingSine.hpp"
+#include "algos/ClusterSaw.hpp"
+#include "algos/Atari.hpp"
+#include "algos/Basurilla.hpp"
+#include "algos/ArrayOnTheRocks.hpp"
+#include "algos/PwCluster.hpp"
+#include "algos/ExistencelsPain.hpp"
+#include "algos/BasuraTotal.hpp"
+#include "algos/S_H.hpp"
+#include "algos/SatanWorkout.hpp"
+#include "dsp/DelayArena.hpp"
+
+// All 13 algorithms behind one index, in Main knob order, rendered a block
+// at a time: the switch runs once per block and each case is a tight loop
+// over that algorithm's inline nextSample/process.
+//
+// The algorithms settle (reverb tails fill, filters converge) after about
+// kWarmSamples. The registry counts what each one has rendered, and warm()
+// tops one up a chunk at a time, so settling happens on demand instead of
+// all thirteen at boot.
+//
+// The three reverb algorithms share one DelayArena instead of owning their
+// delay lines. render() leases a slot on first use, evicting whichever
+// holder rendered least recently (never the pair sounding now); warm()
+// only takes a free slot. An evicted algorithm loses its tail and counts
+// as cold again.
+class AlgoRegistry
+{
+public:
+    static constexpr int kNumAlgos = 13;
+    static constexpr uint32_t kWarmSamples = 1024;
+
+    static const char* name(int index)
+    {
+        static const char* const names[kNumAlgos] = {
+            "ResoNoise", "RadioOhNo", "CrossModRingSquare", "CrossModRingSine",
+            "ClusterSaw", "Basurilla", "PwCluster", "ArrayOnTheRocks", "Atari",
+            "SatanWorkout", "S_H", "BasuraTotal", "ExistencelsPain",
+        };
+        return (index >= 0 && index < kNumAlgos) ? names[index] : "";
+    }
+
+    // n samples of algorithm `index` at controls x/y (0..4095) into out.
+    void render(int index, uint16_t x, uint16_t y, int16_t* out, int n)
+    {
+        switch (index)
+        {
+            case 0:
+                for (int i = 0; i < n; ++i) out[i] = reso.nextSample(x, y);
+                break;
+            case 1:
+                for (int i = 0; i < n; ++i) out[i] = radio.nextSample(x, y);
+                break;
+            case 2:
+                for (int i = 0; i < n; ++i) out[i] = static_cast<int16_t>(xmodring.process(x, y));
+                break;
+            case 3:
+                for (int i = 0; i < n; ++i) out[i] = static_cast<int16_t>(xmodringsine.process(x, y));
+                break;
+            case 4:
+                for (int i = 0; i < n; ++i) out[i] = static_cast<int16_t>(clustersaw.process(x, y));
+                break;
+            case 5:
+                for (int i = 0; i < n; ++i) out[i] = static_cast<int16_t>(basurilla.process(x, y));
+                break;
+            case 6:
+                for (int i = 0; i < n; ++i) out[i] = static_cast<int16_t>(pwcluster.process(x, y));
+                break;
+            case 7:
+                for (int i = 0; i < n; ++i) out[i] = static_cast<int16_t>(arrayrocks.process(x, y));
+                break;
+            case 8:
+                for (int i = 0; i < n; ++i) out[i] = static_cast<int16_t>(atari.process(x, y));
+                break;
+            case 9:
+                lease(index, true);
+                satanworkout.render(x, y, out, n);
+                break;
+            case 10:
+                lease(index, true);
+                samplehold.render(x, y, out, n);
+                break;
+            case 11:
+                lease(index, true);
+                basuratotal.render(x, y, out, n);
+                break;
+            default:
+                index = kNumAlgos - 1;
+                for (int i = 0; i < n; ++i) out[i] = static_cast<int16_t>(existencels.process(x, y));
+                break;
+        }
+        if (rendered_[index] < kWarmSamples) rendered_[index] += static_cast<uint32_t>(n);
+    }
+
+    bool warmed(int index) const { return rendered_[index] >= kWarmSamples; }
+
+    // Settle algorithm `index` at noon controls, at most `budget` samples
+    // (discarded) per call. Returns how many were run; 0 once it is warm.
+    int warm(int index, int budget)
+    {
+        if (reverbOf(index) && !lease(index, false)) return 0;
+        int left = warmed(index) ? 0 : static_cast<int>(kWarmSamples - rendered_[index]);
+        int n = left < budget ? left : budget;
+        int16_t scratch[kWarmChunk];
+        for (int done = 0; done < n; done += kWarmChunk)
+        {
+            int chunk = (n - done) < kWarmChunk ? (n - done) : kWarmChunk;
+            render(index, 2048, 2048, scratch, chunk);
+        }
+        return n;
+    }
+
+    // Warm-up as the firmware used to do it, every algorithm at boot.
+    void warmAll()
+    {
+        for (int i = 0; i < kNumAlgos; ++i)
+            while (warm(i, kWarmChunk)) {}
+    }
+
+private:
+    static constexpr int kWarmChunk = 32;
+
+    dsp::MicroVerbMonoInt* reverbOf(int index)
+    {
+        switch (index)
+        {
+            case 9: return &satanworkout.reverb();
+            case 10: return &samplehold.reverb();
+            case 11: return &basuratotal.reverb();
+            default: return nullptr;
+        }
+    }
+
+    // Make sure reverb algorithm `index` holds arena memory. With `evict`
+    // it always succeeds; the previous holder detaches and turns cold.
+    bool lease(int index, bool evict)
+    {
+        int slot = arena.find(index);
+        if (slot >= 0)
+        {
+            arena.touch(slot);
+            return true;
+        }
+        int evicted;
+        slot = arena.lease(index, evict, evicted);
+        if (slot < 0) return false;
+        if (evicted >= 0)
+        {
+            reverbOf(evicted)->detach();
+            rendered_[evicted] = 0;
+        }
+        reverbOf(index)->attach(arena.memory(slot));
+        rendered_[index] = 0;
+        return true;
+    }
+
+    ResoNoiseAlgo reso;
+    RadioOhNoAlgo radio;
+    CrossModRingSquare xmodring;
+    CrossModRingSine xmodringsine;
+    ClusterSaw clustersaw;
+    Basurilla basurilla;
+    PwCluster pwcluster;
+    ArrayOnTheRocks arrayrocks;
+    Atari atari;
+    ExistencelsPain existencels;
+    BasuraTotalAlgo basuratotal;
+    SampleHoldReverbAlgo samplehold;
+    SatanWorkoutAlgo satanworkout;
+    dsp::DelayArena arena;
+
+    uint32_t rendered_[kNumAlgos] = {};
+};
@@ -33,6 +33,15 @@ public:
 
     // Generate one 12-bit sample. k1/k2: 0..4095
     inline int32_t process(int32_t k1_0_to_4095, int32_t k2_0_to_4095)
+    {
+        int16_t y;
+        render(k1_0_to_4095, k2_0_to_4095, &y, 1);
+        return y;
+    }
+
+    // n samples at fixed controls: the mapping runs once, the reverb once
+    // per kChunk.
+    void render(int32_t k1_0_to_4095, int32_t k2_0_to_4095, int16_t* out, int n)
     {
         if (k1_0_to_4095 < 0) k1_0_to_4095 = 0; else if (k1_0_to_4095 > 4095) k1_0_to_4095 = 4095;
         if (k2_0_to_4095 < 0) k2_0_to_4095 = 0; else if (k2_0_to_4095 > 4095) k2_0_to_4095 = 4095;
@@ -52,30 +61,47 @@ public:
         int32_t intervalSamples = static_cast<int32_t>(4800.0f * pitch2 + 0.5f);
         if (intervalSamples < 1) intervalSamples = 1;
 
-        // Trigger update when countdown expires
-        if (--counter_ <= 0)
+        while (n > 0)
         {
-            counter_ = intervalSamples;
+            const int m = n < kChunk ? n : kChunk;
+            for (int i = 0; i < m; )
+            {
+                // Trigger update when the countdown expires on this sample
+                if (counter_ <= 1)
+                {
+                    counter_ = intervalSamples + 1;
 
-            // Use existing white noise generator to decide gate (approx 50/50)
-            // Sign bit as boolean: >= 0 -> 1, < 0 -> 0
-            const bool on = (noise_.nextSample(4095) >= 0);
-            const float f = on ? baseHz : 0.0f;
+                    // Use existing white noise generator to decide gate (approx 50/50)
+                    // Sign bit as boolean: >= 0 -> 1, < 0 -> 0
+                    const bool on = (noise_.nextSample(4095) >= 0);
+                    const float f = on ? baseHz : 0.0f;
 
-            // Emulate Teensy begin() at each click: set shape and reset phase
-            osc_.setShape(WaveformOscillator::Shape::Square);
-            osc_.setFrequencyHz(f);
-            osc_.resetPhase(0);
+                    // Emulate Teensy begin() at each click: set shape and reset phase
+                    osc_.setShape(WaveformOscillator::Shape::Square);
+                    osc_.setFrequencyHz(f);
+                    osc_.resetPhase(0);
+                }
+                // The oscillator runs straight up to the next trigger
+                int run = counter_ - 1;
+                if (run > m - i) run = m - i;
+                counter_ -= run;
+
+                // Dry synth samples
+                for (const int end = i + run; i < end; ++i)
+                    out[i] = static_cast<int16_t>(osc_.nextSample());
+            }
+            // Through MicroVerb (mono), in place
+            verb_.process(out, out, m);
+            out += m;
+            n -= m;
         }
-        // Dry synth sample
-        const int16_t dry = static_cast<int16_t>(osc_.nextSample());
-        // Process through MicroVerb (mono)
-        int16_t wet = verb_.process(dry);
-        int32_t mono = static_cast<int32_t>(wet);
-        return mono;
     }
 
+    dsp::MicroVerbMonoInt& reverb() { return verb_; }
+
 private:
+    static constexpr int kChunk = 32;
+
     WaveformOscillator osc_;
     int32_t counter_ = 1;
     WhiteNoise noise_;
@@ -2,19 +2,10 @@
 #pragma once
 #include <cstdint>
 #include <cstring>
+#include "dsp/DelayArena.hpp"
 
 namespace dsp {
 
-// ---- small Q15 helpers ----
-static inline int32_t sat_q15(int32_t v){ if(v<-32768) return -32768; if(v>32767) return 32767; return v; }
-static inline int16_t sat_q12_from_q15(int32_t q15){
-    int32_t y = q15 >> 4; if (y < -2048) y = -2048; if (y > 2047) y = 2047; return (int16_t)y;
-}
-// rounded Q15 multiply
-static inline int32_t mul_q15(int32_t a,int32_t b){
-    int64_t p=(int64_t)a*b; int64_t adj=(p>=0)?(1ll<<14):((1ll<<14)-1); return (int32_t)((p+adj)>>15);
-}
-
 // ---- lean tunings (44.1k heritage; fine at 48k) ----
 static constexpr int COMB1  = 1188;   // ~27 ms
 static constexpr int COMB2  = 1536;   // ~35 ms
@@ -22,53 +13,9 @@ static constexpr int COMB3  = 1733;   // ~39 ms
 static constexpr int APCORE = 225;    // ~5 ms
 static constexpr int PREDELAY_MAX = 240; // up to ~5 ms @48k
 
-// ---- primitives ----
-template<int N>
-struct CombQ15 {
-    int16_t buf[N] = {};
-    int idx = 0;
-    int32_t store = 0;     // Q15
-    int32_t fb = 27000;    // feedback (Q15)
-    int32_t d1 = 16384;    // damp
-    int32_t d2 = 16383;    // 1 - damp
-
-    inline void set_feedback_q15(int32_t q){ if(q<0)q=0; if(q>32767)q=32767; fb=q; }
-    inline void set_damp_q15(int32_t d){ if(d<0)d=0; if(d>32767)d=32767; d1=d; d2=32767-d; }
-    inline void mute(){ std::memset(buf,0,sizeof(buf)); idx=0; store=0; }
-
-    inline int32_t process(int32_t x){           // x: Q15, returns Q15
-        int32_t y = (int32_t)buf[idx] << 1;      // int16 -> Q15 (keep headroom)
-        store = sat_q15(mul_q15(y, d2) + mul_q15(store, d1));  // one-pole lowpass
-        int32_t w = x + mul_q15(store, fb);      // feedback
-        if (w < -32768) w = -32768; if (w > 32767) w = 32767;
-        buf[idx] = (int16_t)(w >> 1);            // store with headroom
-        if (++idx >= N) idx = 0;
-        return y;
-    }
-};
-
-template<int N>
-struct AllpassQ15 {
-    int16_t buf[N] = {};
-    int idx = 0;
-    int32_t fb = 16384; // ~0.5
-
-    inline void set_feedback_q15(int32_t q){ if(q<-32768)q=-32768; if(q>32767)q=32767; fb=q; }
-    inline void mute(){ std::memset(buf,0,sizeof(buf)); idx=0; }
-
-    inline int32_t process(int32_t x){           // x: Q15, returns Q15
-        int32_t b = (int32_t)buf[idx] << 1;
-        int32_t y = sat_q15(b - x);              // -x + b
-        int32_t w = x + mul_q15(b, fb);          // x + b*fb
-        if (w < -32768) w = -32768; if (w > 32767) w = 32767;
-        buf[idx] = (int16_t)(w >> 1);
-        if (++idx >= N) idx = 0;
-        return y;
-    }
-};
-
+// ---- primitives (comb/allpass lines: dsp/DelayArena.hpp) ----
 struct PredelayQ15 {
-    int16_t buf[PREDELAY_MAX] = {};
+    int16_t* buf = nullptr; // PREDELAY_MAX samples of leased memory
     int idx = 0;
     int len = 0; // 0..PREDELAY_MAX
 
@@ -76,21 +23,48 @@ struct PredelayQ15 {
         int L = (int)(ms * 0.001f * fs + 0.5f);
         if (L < 0) L = 0; if (L > PREDELAY_MAX) L = PREDELAY_MAX;
         len = L; idx = 0;
-        std::memset(buf,0,sizeof(buf));
+        if (buf) std::memset(buf,0,sizeof(int16_t)*PREDELAY_MAX);
     }
-    inline int32_t process(int32_t x){ // Q15 -> Q15
-        if (len == 0) return x;
-        int32_t y = (int32_t)buf[idx] << 1;
-        buf[idx] = (int16_t)(x >> 1);
-        if (++idx >= len) idx = 0;
-        return y;
+    inline void process(int32_t* x, int n){ // Q15 -> Q15 in place
+        if (len == 0) return;
+        int16_t* const b = buf;
+        const int L = len;
+        int i0 = idx;
+        for (int i = 0; i < n; ++i) {
+            int32_t y = (int32_t)b[i0] << 1;
+            b[i0] = (int16_t)(x[i] >> 1);
+            if (++i0 >= L) i0 = 0;
+            x[i] = y;
+        }
+        idx = i0;
     }
 };
 
 // ---- MicroVerbMonoInt ----
+// Delay lines are leased: attach() kWords of DelayArena memory before
+// processing. Detached, only the dry path is heard.
 class MicroVerbMonoInt {
 public:
-    MicroVerbMonoInt(){ setDefaults(); mute(); }
+    static constexpr int kWords = COMB1 + COMB2 + COMB3 + APCORE + PREDELAY_MAX;
+    static_assert(kWords <= DelayArena::kSlotWords, "MicroVerb outgrew a DelayArena slot");
+
+    MicroVerbMonoInt(){
+        c1.len = COMB1; c2.len = COMB2; c3.len = COMB3; ap.len = APCORE;
+        setDefaults();
+    }
+
+    // Take kWords samples of delay memory, cleared; the tail starts empty.
+    void attach(int16_t* mem){
+        c1.buf = mem;
+        c2.buf = c1.buf + COMB1;
+        c3.buf = c2.buf + COMB2;
+        ap.buf = c3.buf + COMB3;
+        pre.buf = ap.buf + APCORE;
+        mute();
+        std::memset(pre.buf, 0, sizeof(int16_t) * PREDELAY_MAX);
+    }
+    void detach(){ c1.buf = c2.buf = c3.buf = ap.buf = pre.buf = nullptr; }
+    bool attached() const { return c1.buf != nullptr; }
 
     // Control-rate setters (float ok; precompute Q15)
     void setRoomSize(float v){ // 0..1 → ~0.25..0.95 feedback
@@ -116,35 +90,54 @@ public:
 
     void mute(){ c1.mute(); c2.mute(); c3.mute(); ap.mute(); pre.idx=0; }
 
-    // Mono in → mono out (12-bit signed)
-    inline int16_t process(int16_t in12){
-        // promote to Q15 and apply small input gain
-        int32_t x = (int32_t)in12 << 4;
-        x = mul_q15(x, input_gain_q15);
-
-        // pre-delay
-        x = pre.process(x);
-
-        // 3 combs in parallel
-        int32_t acc = 0;
-        acc += c1.process(x);
-        acc += c2.process(x);
-        acc += c3.process(x);
-
-        // 1 allpass for diffusion
-        int32_t wet = ap.process(acc);
+    // Mono in → mono out (12-bit signed: |in| <= 2048 keeps mul_q15_32 in
+    // range), n samples; out may alias in.
+    // Each stage runs the whole block before the next, gains in registers.
+    void process(const int16_t* in12, int16_t* out, int n){
+        while (n > 0) {
+            const int m = n < kChunk ? n : kChunk;
+            int32_t x[kChunk];
+            int32_t acc[kChunk];
+            int32_t wet[kChunk];
+
+            if (attached()) {
+                // promote to Q15 and apply small input gain
+                for (int i = 0; i < m; ++i) x[i] = mul_q15_32((int32_t)in12[i] << 4, input_gain_q15);
+                pre.process(x, m);
+
+                // 3 combs in parallel, then 1 allpass for diffusion
+                process_combs(c1, c2, c3, x, acc, m);
+                ap.process(acc, m);
+
+                const int32_t wg = wet_q15;
+                for (int i = 0; i < m; ++i) wet[i] = mul_q15_32(acc[i], wg);
+            } else {
+                for (int i = 0; i < m; ++i) wet[i] = 0;
+            }
+
+            // Wet/dry mix (mono)
+            const int32_t dg = dry_q15;
+            for (int i = 0; i < m; ++i)
+                out[i] = sat_q12_from_q15(sat_q15(mul_q15_32((int32_t)in12[i] << 4, dg) + wet[i]));
+
+            in12 += m; out += m; n -= m;
+        }
+    }
 
-        // Wet/dry mix (mono)
-        int32_t y_q15 = sat_q15( mul_q15(((int32_t)in12<<4), dry_q15) + mul_q15(wet, wet_q15) );
-        return sat_q12_from_q15(y_q15);
+    inline int16_t process(int16_t in12){
+        int16_t y;
+        process(&in12, &y, 1);
+        return y;
     }
 
 private:
-    // building blocks
-    CombQ15<COMB1>  c1;
-    CombQ15<COMB2>  c2;
-    CombQ15<COMB3>  c3;
-    AllpassQ15<APCORE> ap;
+    static constexpr int kChunk = 32;
+
+    // building blocks (views into the leased slot)
+    CombLineQ15  c1;
+    CombLineQ15  c2;
+    CombLineQ15  c3;
+    AllpassLineQ15 ap;
     PredelayQ15 pre;
 
     // params (Q15)
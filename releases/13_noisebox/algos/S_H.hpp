@@ -31,39 +31,71 @@ public:
 
     inline int16_t nextSample(uint16_t k1_0_to_4095, uint16_t k2_0_to_4095)
     {
-        // Control-rate parameter updates to minimize float work
-        if ((ctrlCounter_++ & 0x7F) == 0)
-        {
-            // freq = 15 + 5000*(k1/4095)
-            float k1 = static_cast<float>(k1_0_to_4095) * (1.0f / 4095.0f);
-            float freq = 15.0f + 5000.0f * k1;
-            if (freq < 0.0f) freq = 0.0f;
-            shOsc_.setFrequencyHz(freq);
-        }
-
-        // Source
-        const int16_t dry_s = shOsc_.nextSample(); // -2048..2047
-
-        // Reverb (pure wet mono)
-        int16_t wet = reverb_.process(dry_s);
+        int16_t y;
+        render(k1_0_to_4095, k2_0_to_4095, &y, 1);
+        return y;
+    }
 
+    // n samples at fixed controls, the reverb run once per kChunk.
+    void render(uint16_t k1_0_to_4095, uint16_t k2_0_to_4095, int16_t* out, int n)
+    {
         // Integer cross-mix
         // dry_gain = (4095 - k2); wet_gain = min(4*k2, 4095)  [Q12 gains]
         int32_t k2c = static_cast<int32_t>(k2_0_to_4095);
         if (k2c < 0) k2c = 0; else if (k2c > 4095) k2c = 4095;
-        int32_t dry_gain_q12 = 4095 - k2c;
+        const int32_t dry_gain_q12 = 4095 - k2c;
         int32_t wet_gain_q12 = k2c << 2; // *4
         if (wet_gain_q12 > 4095) wet_gain_q12 = 4095;
 
-        int32_t dry_mix = (static_cast<int32_t>(dry_s) * dry_gain_q12) >> 12;
-        int32_t wet_mix = (static_cast<int32_t>(wet) * wet_gain_q12) >> 12;
-        int32_t out = dry_mix + wet_mix;
-        if (out < -2048) out = -2048;
-        if (out >  2047) out =  2047;
-        return static_cast<int16_t>(out);
+        while (n > 0)
+        {
+            const int m = n < kChunk ? n : kChunk;
+            int16_t dry[kChunk];
+            int16_t wet[kChunk];
+            for (int i = 0; i < m; )
+            {
+                // Control-rate parameter updates to minimize float work, every
+                // 128 samples; the oscillator runs straight between them
+                const uint32_t phase = ctrlCounter_ & 0x7F;
+                if (phase == 0)
+                {
+                    // freq = 15 + 5000*(k1/4095)
+                    float k1 = static_cast<float>(k1_0_to_4095) * (1.0f / 4095.0f);
+                    float freq = 15.0f + 5000.0f * k1;
+                    if (freq < 0.0f) freq = 0.0f;
+                    shOsc_.setFrequencyHz(freq);
+                }
+                int run = static_cast<int>(0x80 - phase);
+                if (run > m - i) run = m - i;
+                ctrlCounter_ += static_cast<uint32_t>(run);
+
+                // Source
+                for (const int end = i + run; i < end; ++i)
+                    dry[i] = shOsc_.nextSample(); // -2048..2047
+            }
+
+            // Reverb (pure wet mono)
+            reverb_.process(dry, wet, m);
+
+            for (int i = 0; i < m; ++i)
+            {
+                int32_t dry_mix = (static_cast<int32_t>(dry[i]) * dry_gain_q12) >> 12;
+                int32_t wet_mix = (static_cast<int32_t>(wet[i]) * wet_gain_q12) >> 12;
+                int32_t y = dry_mix + wet_mix;
+                if (y < -2048) y = -2048;
+                if (y >  2047) y =  2047;
+                out[i] = static_cast<int16_t>(y);
+            }
+            out += m;
+            n -= m;
+        }
     }
 
+    dsp::MicroVerbMonoInt& reverb() { return reverb_; }
+
 private:
+    static constexpr int kChunk = 32;
+
     WaveformOscillator shOsc_;
     dsp::MicroVerbMonoInt reverb_;
     uint32_t ctrlCounter_ = 0;
@@ -0,0 +1,164 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+
+// Delay memory for the integer reverbs, shared instead of owned.
+//
+// FreeverbLiteInt and MicroVerbMonoInt used to carry their delay lines
+// inline, so every algorithm with a reverb held ~10 KB of SRAM whether it
+// was sounding or not. Only one algorithm plays at a time (two while
+// AlgoMorph crossfades), so the lines now live in a DelayArena: kSlots
+// slots of kSlotWords samples, leased by owner index. A reverb attach()es
+// to a slot's memory, which clears it, and detach()es when evicted.
+//
+// Also here: the Q15 helpers and delay-line views both reverbs share.
+
+namespace dsp {
+
+// ---- small Q15 helpers ----
+static inline int32_t sat_q15(int32_t v){ if(v<-32768) return -32768; if(v>32767) return 32767; return v; }
+static inline int16_t sat_q12_from_q15(int32_t q15){
+    int32_t y = q15 >> 4; if (y < -2048) y = -2048; if (y > 2047) y = 2047; return (int16_t)y;
+}
+// rounded (a*b)>>15, any range
+static inline int32_t mul_q15(int32_t a,int32_t b){
+    int64_t p=(int64_t)a*b; int64_t adj=(p>=0)?(1ll<<14):((1ll<<14)-1); return (int32_t)((p+adj)>>15);
+}
+// Same result as mul_q15 for |a| <= 65536 and |b| <= 32767, which is every
+// delay-line sample (int16 << 1) times a Q15 gain: the product and the
+// rounding fit an int32, so the M0+ does one MULS instead of a 64-bit
+// multiply call.
+static inline int32_t mul_q15_32(int32_t a,int32_t b){
+    int32_t p=a*b; return (p+(1<<14)-(p<0))>>15;
+}
+
+// ---- delay-line views over leased memory ----
+// Samples are stored halved (int16 = Q15 >> 1) for headroom. process()
+// runs a block with the coefficients and position held in locals.
+
+struct CombLineQ15 {
+    int16_t* buf = nullptr;
+    int len = 0;
+    int idx = 0;
+    int32_t store = 0;     // damping lowpass state (Q15)
+    int32_t fb = 27000;    // feedback (Q15)
+    int32_t d1 = 16384;    // damp
+    int32_t d2 = 16383;    // 1 - damp
+
+    inline void set_feedback_q15(int32_t q){ if(q<0)q=0; if(q>32767)q=32767; fb=q; }
+    inline void set_damp_q15(int32_t d){ if(d<0)d=0; if(d>32767)d=32767; d1=d; d2=32767-d; }
+    inline void mute(){ if(buf) std::memset(buf,0,sizeof(int16_t)*len); idx=0; store=0; }
+
+    // One sample with the position and lowpass state in the caller's locals.
+    static inline int32_t step(int16_t* b, int L, int32_t f, int32_t a1, int32_t a2,
+                               int& i0, int32_t& s, int32_t x){
+        int32_t y = (int32_t)b[i0] << 1;
+        s = sat_q15(mul_q15_32(y, a2) + mul_q15_32(s, a1));
+        int32_t w = x + mul_q15_32(s, f);
+        if (w < -32768) w = -32768;
+        if (w > 32767) w = 32767;
+        b[i0] = (int16_t)(w >> 1);
+        if (++i0 >= L) i0 = 0;
+        return y;
+    }
+
+    // acc[i] += comb output for input x[i] (both Q15)
+    inline void process(const int32_t* x, int32_t* acc, int n){
+        int i0 = idx;
+        int32_t s = store;
+        for (int i = 0; i < n; ++i) acc[i] += step(buf, len, fb, d1, d2, i0, s, x[i]);
+        idx = i0;
+        store = s;
+    }
+};
+
+// acc[i] = sum of three parallel combs for input x[i]. One pass rather than
+// three: the three recursions are independent, so a core that can overlap
+// them does, and acc[] is written once.
+static inline void process_combs(CombLineQ15& c1, CombLineQ15& c2, CombLineQ15& c3,
+                                 const int32_t* x, int32_t* acc, int n){
+    int i1 = c1.idx, i2 = c2.idx, i3 = c3.idx;
+    int32_t s1 = c1.store, s2 = c2.store, s3 = c3.store;
+    for (int i = 0; i < n; ++i) {
+        acc[i] = CombLineQ15::step(c1.buf, c1.len, c1.fb, c1.d1, c1.d2, i1, s1, x[i])
+               + CombLineQ15::step(c2.buf, c2.len, c2.fb, c2.d1, c2.d2, i2, s2, x[i])
+               + CombLineQ15::step(c3.buf, c3.len, c3.fb, c3.d1, c3.d2, i3, s3, x[i]);
+    }
+    c1.idx = i1; c2.idx = i2; c3.idx = i3;
+    c1.store = s1; c2.store = s2; c3.store = s3;
+}
+
+struct AllpassLineQ15 {
+    int16_t* buf = nullptr;
+    int len = 0;
+    int idx = 0;
+    int32_t fb = 16384;    // ~0.5
+
+    // -32768 would take mul_q15_32 out of range; the difference is inaudible.
+    inline void set_feedback_q15(int32_t q){ if(q<-32767)q=-32767; if(q>32767)q=32767; fb=q; }
+    inline void mute(){ if(buf) std::memset(buf,0,sizeof(int16_t)*len); idx=0; }
+
+    // x[i] -> allpass(x[i]) in place (Q15)
+    inline void process(int32_t* x, int n){
+        int16_t* const b = buf;
+        const int L = len;
+        const int32_t f = fb;
+        int i0 = idx;
+        for (int i = 0; i < n; ++i) {
+            int32_t v = (int32_t)b[i0] << 1;
+            int32_t w = x[i] + mul_q15_32(v, f);
+            if (w < -32768) w = -32768;
+            if (w > 32767) w = 32767;
+            x[i] = sat_q15(v - x[i]);
+            b[i0] = (int16_t)(w >> 1);
+            if (++i0 >= L) i0 = 0;
+        }
+        idx = i0;
+    }
+};
+
+// ---- the arena ----
+class DelayArena {
+public:
+    // Two slots: the pair AlgoMorph crossfades. A warm neighbour gets one
+    // only while it is free.
+    static constexpr int kSlots = 2;
+    // The larger reverb: MicroVerbMonoInt::kWords (FreeverbLiteInt needs 4818).
+    static constexpr int kSlotWords = 4922;
+
+    int16_t* memory(int slot){ return mem_[slot]; }
+
+    // The slot `owner` holds, or -1.
+    int find(int owner) const {
+        for (int s = 0; s < kSlots; ++s) if (owner_[s] == owner) return s;
+        return -1;
+    }
+
+    // Give `owner` a slot: a free one, or with `evict` the one used least
+    // recently. Returns the slot, -1 if none; `evicted` is the previous
+    // owner (which must detach) or -1.
+    int lease(int owner, bool evict, int& evicted){
+        evicted = -1;
+        int slot = -1;
+        for (int s = 0; s < kSlots && slot < 0; ++s) if (owner_[s] < 0) slot = s;
+        if (slot < 0) {
+            if (!evict) return -1;
+            slot = 0;
+            for (int s = 1; s < kSlots; ++s) if (used_[s] < used_[slot]) slot = s;
+            evicted = owner_[slot];
+        }
+        owner_[slot] = owner;
+        touch(slot);
+        return slot;
+    }
+
+    void touch(int slot){ used_[slot] = ++clock_; }
+
+private:
+    int16_t mem_[kSlots][kSlotWords];
+    int owner_[kSlots] = {-1, -1};
+    uint32_t used_[kSlots] = {};
+    uint32_t clock_ = 0;
+};
+
+} // namespace dsp
@@ -1,72 +1,43 @@
 #pragma once
 #include <cstdint>
 #include <cstring>
+#include "dsp/DelayArena.hpp"
 
 namespace dsp {
 
-// ---- small Q15 helpers ----
-static inline int32_t sat_q15(int32_t v){ if(v<-32768) return -32768; if(v>32767) return 32767; return v; }
-static inline int16_t sat_q12_from_q15(int32_t q15){
-    int32_t y = q15 >> 4; if (y < -2048) y = -2048; if (y > 2047) y = 2047; return (int16_t)y;
-}
-static inline int32_t mul_q15(int32_t a,int32_t b){ // rounded (a*b)>>15
-    int64_t p=(int64_t)a*b; int64_t adj=(p>=0)?(1ll<<14):((1ll<<14)-1); return (int32_t)((p+adj)>>15);
-}
-
 // ---- Tunings (trimmed) ----
+// The mono path runs combL_tunings[0..2] and allpassL_tunings[0..1]; the
+// rest are the stereo Freeverb's, kept for reference.
 static constexpr int stereo_spread = 23;
 static constexpr int combL_tunings[5]    = { 1188, 1277, 1356, 1491, 1617 };
 static constexpr int allpassL_tunings[3] = { 556,  441,  341  };
 
-// ---- Delay primitives ----
-template<int N>
-struct CombQ15 {
-    int16_t buf[N] = {};
-    int idx = 0;
-    int32_t filterstore = 0; // Q15
-    int32_t feedback = 0;    // Q15
-    int32_t damp1 = 0, damp2 = 32767;
-
-    inline void set_feedback_q15(int32_t fb){ feedback = fb; }
-    inline void set_damp_q15(int32_t d){ if(d<0)d=0; if(d>32767)d=32767; damp1=d; damp2=32767-d; }
-    inline void mute(){ std::memset(buf,0,sizeof(buf)); idx=0; filterstore=0; }
-
-    inline int32_t process(int32_t x){
-        int32_t y = (int32_t)buf[idx] << 1; // int16→Q15
-        int32_t fs = mul_q15(y, damp2) + mul_q15(filterstore, damp1);
-        filterstore = sat_q15(fs);
-        int32_t w = x + mul_q15(filterstore, feedback);
-        if (w < -32768) w = -32768; if (w > 32767) w = 32767;
-        buf[idx] = (int16_t)(w >> 1);
-        if (++idx >= N) idx = 0;
-        return y;
-    }
-};
-
-template<int N>
-struct AllpassQ15 {
-    int16_t buf[N] = {};
-    int idx = 0;
-    int32_t feedback = 16384; // ~0.5
-
-    inline void set_feedback_q15(int32_t fb){ if(fb<-32768)fb=-32768; if(fb>32767)fb=32767; feedback=fb; }
-    inline void mute(){ std::memset(buf,0,sizeof(buf)); idx=0; }
-
-    inline int32_t process(int32_t x){
-        int32_t b = (int32_t)buf[idx] << 1;
-        int32_t y = sat_q15(b - x);
-        int32_t w = x + mul_q15(b, feedback);
-        if (w < -32768) w = -32768; if (w > 32767) w = 32767;
-        buf[idx] = (int16_t)(w >> 1);
-        if (++idx >= N) idx = 0;
-        return y;
-    }
-};
-
 // ---- FreeverbLiteInt (mono path using 3 combs + 2 allpasses) ----
+// Delay lines are leased: attach() kWords of DelayArena memory before
+// processing. Only the five lines the mono path runs are allocated.
 class FreeverbLiteInt {
 public:
-    FreeverbLiteInt(){ setDefaults(); mute(); }
+    static constexpr int kWords = combL_tunings[0] + combL_tunings[1] + combL_tunings[2]
+                                + allpassL_tunings[0] + allpassL_tunings[1];
+    static_assert(kWords <= DelayArena::kSlotWords, "FreeverbLite outgrew a DelayArena slot");
+
+    FreeverbLiteInt(){
+        combL0.len = combL_tunings[0]; combL1.len = combL_tunings[1]; combL2.len = combL_tunings[2];
+        allpassL0.len = allpassL_tunings[0]; allpassL1.len = allpassL_tunings[1];
+        setDefaults();
+    }
+
+    // Take kWords samples of delay memory, cleared.
+    void attach(int16_t* mem){
+        combL0.buf = mem;
+        combL1.buf = combL0.buf + combL0.len;
+        combL2.buf = combL1.buf + combL1.len;
+        allpassL0.buf = combL2.buf + combL2.len;
+        allpassL1.buf = allpassL0.buf + allpassL0.len;
+        mute();
+    }
+    void detach(){ combL0.buf = combL1.buf = combL2.buf = allpassL0.buf = allpassL1.buf = nullptr; }
+    bool attached() const { return combL0.buf != nullptr; }
 
     // Control-rate setters
     void setRoomSize(float v){ if(v<0)v=0; if(v>1)v=1; roomsize_q15 = toQ15(0.28f + v*0.69f); refreshCombFeedbacks(); }
@@ -94,52 +65,55 @@ public:
     void setDryQ15(int32_t q){ dry_q15 = clampQ15(q); }
 
     void mute(){
-        combL0.mute(); combL1.mute(); combL2.mute(); combL3.mute(); combL4.mute();
-        combR0.mute(); combR1.mute(); combR2.mute(); combR3.mute(); combR4.mute();
-        allpassL0.mute(); allpassL1.mute(); allpassL2.mute();
-        allpassR0.mute(); allpassR1.mute(); allpassR2.mute();
+        combL0.mute(); combL1.mute(); combL2.mute();
+        allpassL0.mute(); allpassL1.mute();
+    }
+
+    // Mono-in → mono-out; 12-bit signed I/O (|in| <= 2048), n samples; out
+    // may alias in. Stages run a block at a time, gains in registers.
+    void process(const int16_t* in12, int16_t* out, int n){
+        while (n > 0) {
+            const int m = n < kChunk ? n : kChunk;
+            int32_t xin[kChunk];
+            int32_t acc[kChunk];
+
+            if (attached()) {
+                const int32_t ig = input_gain_q15;
+                for (int i = 0; i < m; ++i) xin[i] = mul_q15_32((int32_t)in12[i] << 4, ig);
+
+                // parallel combs (mono path, 3 combs for extreme test)
+                process_combs(combL0, combL1, combL2, xin, acc, m);
+
+                // serial allpasses (mono path, 2 stages)
+                allpassL0.process(acc, m);
+                allpassL1.process(acc, m);
+            } else {
+                for (int i = 0; i < m; ++i) acc[i] = 0;
+            }
+
+            // wet/dry mix (mono)
+            const int32_t dg = dry_q15, wg = wet_q15;
+            for (int i = 0; i < m; ++i) {
+                const int32_t dry_in = mul_q15_32((int32_t)in12[i] << 4, dg);
+                out[i] = sat_q12_from_q15(sat_q15(dry_in + mul_q15_32(acc[i], wg)));
+            }
+
+            in12 += m; out += m; n -= m;
+        }
     }
 
-    // Mono-in → mono-out; 12-bit signed I/O
     inline int16_t process(int16_t in12){
-        const int32_t x_q15 = (int32_t)in12 << 4;
-        const int32_t xin   = mul_q15(x_q15, input_gain_q15);
-
-        // parallel combs (mono path, 3 combs for extreme test)
-        int32_t accL = 0;
-        accL += combL0.process(xin);
-        accL += combL1.process(xin);
-        accL += combL2.process(xin);
-
-        // serial allpasses (mono path, 2 stages)
-        int32_t yL = allpassL0.process(accL);
-        yL = allpassL1.process(yL);
-
-        // wet/dry mix (mono)
-        const int32_t dry_in = mul_q15(x_q15, dry_q15);
-        const int32_t out_q15 = sat_q15(dry_in + mul_q15(yL, wet_q15));
-        return sat_q12_from_q15(out_q15);
+        int16_t y;
+        process(&in12, &y, 1);
+        return y;
     }
 
 private:
-    // concrete delays
-    CombQ15<combL_tunings[0]> combL0; CombQ15<combL_tunings[1]> combL1;
-    CombQ15<combL_tunings[2]> combL2; CombQ15<combL_tunings[3]> combL3;
-    CombQ15<combL_tunings[4]> combL4;
-
-    CombQ15<combL_tunings[0] + stereo_spread> combR0;
-    CombQ15<combL_tunings[1] + stereo_spread> combR1;
-    CombQ15<combL_tunings[2] + stereo_spread> combR2;
-    CombQ15<combL_tunings[3] + stereo_spread> combR3;
-    CombQ15<combL_tunings[4] + stereo_spread> combR4;
-
-    AllpassQ15<allpassL_tunings[0]> allpassL0;
-    AllpassQ15<allpassL_tunings[1]> allpassL1;
-    AllpassQ15<allpassL_tunings[2]> allpassL2;
+    static constexpr int kChunk = 32;
 
-    AllpassQ15<allpassL_tunings[0] + stereo_spread> allpassR0;
-    AllpassQ15<allpassL_tunings[1] + stereo_spread> allpassR1;
-    AllpassQ15<allpassL_tunings[2] + stereo_spread> allpassR2;
+    // delay lines (views into the leased slot)
+    CombLineQ15 combL0, combL1, combL2;
+    AllpassLineQ15 allpassL0, allpassL1;
 
     // Params (Q15)
     static constexpr int32_t fixed_gain_q15 = 492; // ~0.015
@@ -160,19 +134,13 @@ private:
 
     inline void applyDampAll(){
         combL0.set_damp_q15(damp_q15); combL1.set_damp_q15(damp_q15);
-        combL2.set_damp_q15(damp_q15); combL3.set_damp_q15(damp_q15);
-        combL4.set_damp_q15(damp_q15);
-        combR0.set_damp_q15(damp_q15); combR1.set_damp_q15(damp_q15);
-        combR2.set_damp_q15(damp_q15); combR3.set_damp_q15(damp_q15);
-        combR4.set_damp_q15(damp_q15);
+        combL2.set_damp_q15(damp_q15);
     }
 
     inline void refreshCombFeedbacks(){
-        combL0.set_feedback_q15(roomsize_q15); combR0.set_feedback_q15(roomsize_q15);
-        combL1.set_feedback_q15(roomsize_q15); combR1.set_feedback_q15(roomsize_q15);
-        combL2.set_feedback_q15(roomsize_q15); combR2.set_feedback_q15(roomsize_q15);
-        combL3.set_feedback_q15(roomsize_q15); combR3.set_feedback_q15(roomsize_q15);
-        combL4.set_feedback_q15(roomsize_q15); combR4.set_feedback_q15(roomsize_q15);
+        combL0.set_feedback_q15(roomsize_q15);
+        combL1.set_feedback_q15(roomsize_q15);
+        combL2.set_feedback_q15(roomsize_q15);
     }
 
     inline void updateWetGains(){
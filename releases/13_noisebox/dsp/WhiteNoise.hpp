@@ -28,8 +28,8 @@ public:
         int32_t u12 = static_cast<int32_t>((x >> 20) & 0x0FFFu); // 0..4095
         int32_t s12 = u12 - 2048; // -2048..2047
 
-        // Apply amplitude in Q12 and clamp
-        int32_t y = static_cast<int32_t>((static_cast<int64_t>(s12) * amplitude_q12) >> 12);
+        // Apply amplitude in Q12 and clamp (12 x 12 bits: a 32-bit multiply)
+        int32_t y = (s12 * static_cast<int32_t>(amplitude_q12)) >> 12;
         if (y < -2048) y = -2048;
         if (y > 2047) y = 2047;
         return static_cast<int16_t>(y);
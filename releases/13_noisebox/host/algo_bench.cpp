@@ -0,0 +1,153 @@
+// algo_bench — what Noisebox's algorithms cost per sample, on Linux.
+//
+// Builds ../algos/AlgoRegistry.hpp and AlgoMorph.hpp as the firmware does, and reports:
+//
+//   per algorithm   ns and host TSC cycles per sample, rendered in AlgoMorph::kBlock
+//                   blocks as core 1 does, with X and Y sweeping so the control-rate
+//                   updates run
+//   crossfade       AlgoMorph held mid-fade between neighbouring algorithms (the pairs a
+//                   Main knob turn meets), and between the two dearest algorithms, the
+//                   worst case core 1 has to fit
+//   boot            the old constructor's warm-up of all 13 algorithms against what the
+//                   new boot runs before the first block: nothing
+//
+// Best of five passes. Host figures are only relative (x86, not a Cortex-M0+): compare
+// the rows, and the pair against the dearest single algorithm.
+//
+//   ./algo_bench
+#include "algos/AlgoMorph.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC 1
+#else
+#define HAVE_TSC 0
+#endif
+
+namespace {
+
+constexpr int Blocks = 48000 / AlgoMorph::kBlock;   // a second of audio per pass
+
+struct Cost {
+    double ns;
+    double cycles;
+};
+
+// Controls as a slow triangle sweep across the block sequence.
+uint16_t sweep(int block, int period)
+{
+    int phase = block % (2 * period);
+    int v = phase < period ? phase : 2 * period - phase;
+    return static_cast<uint16_t>(v * 4095 / period);
+}
+
+template <typename RenderBlock>
+Cost measure(RenderBlock renderBlock)
+{
+    double best = 1e30, bestCycles = 1e30;
+    volatile int32_t sink = 0;
+    int16_t out[AlgoMorph::kBlock];
+    for (int pass = 0; pass < 5; ++pass) {
+        int32_t acc = 0;
+        const auto t0 = std::chrono::steady_clock::now();
+#if HAVE_TSC
+        const uint64_t c0 = __rdtsc();
+#endif
+        for (int b = 0; b < Blocks; ++b) {
+            renderBlock(b, sweep(b, 700), sweep(b, 1100), out);
+            acc += out[b % AlgoMorph::kBlock];
+        }
+#if HAVE_TSC
+        bestCycles = std::min(bestCycles, (double)(__rdtsc() - c0) / (Blocks * AlgoMorph::kBlock));
+#endif
+        const auto t1 = std::chrono::steady_clock::now();
+        best = std::min(best,
+            std::chrono::duration<double, std::nano>(t1 - t0).count() / (Blocks * AlgoMorph::kBlock));
+        sink = acc;
+    }
+    (void)sink;
+    return {best, HAVE_TSC ? bestCycles : 0.0};
+}
+
+// AlgoMorph kept fading between a and b: the target flips each time a fade ends.
+Cost measurePair(int a, int b)
+{
+    auto registry = std::make_unique<AlgoRegistry>();
+    registry->warmAll();
+    AlgoMorph morph(*registry);
+    int16_t prime[AlgoMorph::kBlock];
+    morph.renderBlock(a, 2048, 2048, prime);
+    while (morph.fading())
+        morph.renderBlock(a, 2048, 2048, prime);
+
+    int target = b;
+    return measure([&](int, uint16_t x, uint16_t y, int16_t* out) {
+        if (!morph.fading())
+            target = target == a ? b : a;
+        morph.renderBlock(target, x, y, out);
+    });
+}
+
+} // namespace
+
+int main()
+{
+    constexpr int N = AlgoRegistry::kNumAlgos;
+    auto registry = std::make_unique<AlgoRegistry>();
+    registry->warmAll();
+
+    Cost single[N];
+    std::printf("%-3s %-20s %8s %8s\n", "#", "algorithm", "ns", "cycles");
+    for (int i = 0; i < N; ++i) {
+        single[i] = measure([&](int, uint16_t x, uint16_t y, int16_t* out) {
+            registry->render(i, x, y, out, AlgoMorph::kBlock);
+        });
+        std::printf("%-3d %-20s %8.2f %8.1f\n", i, AlgoRegistry::name(i), single[i].ns,
+            single[i].cycles);
+    }
+
+    int dearest[2] = {0, 1};
+    for (int i = 0; i < N; ++i) {
+        if (single[i].ns > single[dearest[0]].ns) {
+            dearest[1] = dearest[0];
+            dearest[0] = i;
+        } else if (i != dearest[0] && single[i].ns > single[dearest[1]].ns) {
+            dearest[1] = i;
+        }
+    }
+
+    std::printf("\n%-38s %8s %8s %9s\n", "crossfade (held mid-fade)", "ns", "cycles", "x dearest");
+    double worstNeighbours = 0;
+    for (int i = 0; i < N; ++i) {
+        const int j = (i + 1) % N;
+        const Cost c = measurePair(i, j);
+        worstNeighbours = std::max(worstNeighbours, c.ns);
+        char label[64];
+        std::snprintf(label, sizeof(label), "%s <-> %s", AlgoRegistry::name(i), AlgoRegistry::name(j));
+        std::printf("%-38s %8.2f %8.1f %9.2f\n", label, c.ns, c.cycles, c.ns / single[dearest[0]].ns);
+    }
+    const Cost worst = measurePair(dearest[0], dearest[1]);
+    char label[64];
+    std::snprintf(label, sizeof(label), "dearest: %s <-> %s", AlgoRegistry::name(dearest[0]),
+        AlgoRegistry::name(dearest[1]));
+    std::printf("%-38s %8.2f %8.1f %9.2f\n", label, worst.ns, worst.cycles,
+        worst.ns / single[dearest[0]].ns);
+
+    // Boot: the old constructor ran warmupAllAlgos(1024) on every algorithm.
+    double bootBest = 1e30;
+    for (int pass = 0; pass < 5; ++pass) {
+        auto fresh = std::make_unique<AlgoRegistry>();
+        const auto t0 = std::chrono::steady_clock::now();
+        fresh->warmAll();
+        const auto t1 = std::chrono::steady_clock::now();
+        bootBest = std::min(bootBest, std::chrono::duration<double, std::micro>(t1 - t0).count());
+    }
+    std::printf("\nboot warm-up: old %.0f us (13 x %u samples), new 0 us (first block fades in)\n",
+        bootBest, (unsigned)AlgoRegistry::kWarmSamples);
+    return 0;
+}
@@ -0,0 +1,278 @@
+// reverb_report — what the shared delay arena saves, and what block reverbs cost.
+//
+// Builds ../algos and ../dsp as the firmware does, against the reverbs and reverb
+// algorithms as they were before the arena (REF: the copies in ref/, see README.md),
+// compiled in namespace ref. Reports:
+//
+//   RAM        sizeof the reverbs and the three reverb algorithms then and now, and
+//              AlgoRegistry with its DelayArena against the same registry holding
+//              REF's inline reverbs
+//   reverb     ns and host TSC cycles per sample: REF's per-sample process() against
+//              the block process() in AlgoMorph::kBlock blocks, and whether the output
+//              is sample-identical
+//   algorithm  the same for S_H, SatanWorkout and BasuraTotal, per sample at REF
+//              against render() in blocks, controls sweeping
+//
+// Best of 15 passes, REF and now alternating. Host figures are only relative (x86, not
+// a Cortex-M0+), and x86 multiplies 64 bits as cheaply as 32, which the M0+ does not:
+// compare the rows.
+//
+// Built as reverb_lmul (-DLMUL_COUNT, shim/lmul_count.h), the per-sample tables give
+// 64-bit multiplies per sample instead, each an __aeabi_lmul call on the M0+.
+//
+//   ./reverb_report
+//   ./reverb_lmul
+#include "algos/AlgoMorph.hpp"
+#include "dsp/FreeverbInt.hpp"
+
+namespace ref {
+#include "ref/MicroVerbInt.hpp"
+#include "ref/FreeverbInt.hpp"
+#include "ref/S_H.hpp"
+#include "ref/SatanWorkout.hpp"
+#include "ref/BasuraTotal.hpp"
+}
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC 1
+#else
+#define HAVE_TSC 0
+#endif
+
+namespace {
+
+constexpr int Block = AlgoMorph::kBlock;
+constexpr int Samples = 48000;   // a second of audio per pass
+
+struct Cost {
+    double ns;
+    double cycles;
+};
+
+#ifdef LMUL_COUNT
+// before/after: 64-bit multiplies per sample (in .ns) over one second of each
+template <typename RefBlock, typename NewBlock>
+void measure(RefBlock refBlock, NewBlock newBlock, Cost& before, Cost& after)
+{
+    int16_t out[Block];
+    unsigned long long c0 = lmul::calls;
+    for (int b = 0; b < Samples / Block; ++b) refBlock(b, out);
+    before = {(double)(lmul::calls - c0) / Samples, 0.0};
+    c0 = lmul::calls;
+    for (int b = 0; b < Samples / Block; ++b) newBlock(b, out);
+    after = {(double)(lmul::calls - c0) / Samples, 0.0};
+}
+#else
+// One second of renderBlock(b, out), which fills Block samples; keeps the best.
+template <typename RenderBlock>
+void pass(RenderBlock& renderBlock, Cost& best)
+{
+    volatile int32_t sink = 0;
+    int16_t out[Block];
+    int32_t acc = 0;
+    const auto t0 = std::chrono::steady_clock::now();
+#if HAVE_TSC
+    const uint64_t c0 = __rdtsc();
+#endif
+    for (int b = 0; b < Samples / Block; ++b) {
+        renderBlock(b, out);
+        acc += out[b % Block];
+    }
+#if HAVE_TSC
+    best.cycles = std::min(best.cycles, (double)(__rdtsc() - c0) / Samples);
+#endif
+    const auto t1 = std::chrono::steady_clock::now();
+    best.ns = std::min(best.ns, std::chrono::duration<double, std::nano>(t1 - t0).count() / Samples);
+    sink = acc;
+    (void)sink;
+}
+
+// Best of kPasses passes each, REF and now taking turns so that both see the same
+// machine load.
+template <typename RefBlock, typename NewBlock>
+void measure(RefBlock refBlock, NewBlock newBlock, Cost& before, Cost& after)
+{
+    constexpr int kPasses = 15;
+    before = after = {1e30, 1e30};
+    for (int p = 0; p < kPasses; ++p) {
+        pass(refBlock, before);
+        pass(newBlock, after);
+    }
+    if (!HAVE_TSC) before.cycles = after.cycles = 0.0;
+}
+#endif
+
+// 12-bit test input: a square burst every 4800 samples over low noise, so the
+// tails decay and refill.
+int16_t input(int i)
+{
+    uint32_t h = (uint32_t)i * 2654435761u;
+    h ^= h >> 15;
+    int32_t v = (int32_t)((h >> 8) & 255) - 128;
+    if (i % 4800 < 480) v += (i & 32) ? 1800 : -1800;
+    if (v < -2048) v = -2048;
+    if (v > 2047) v = 2047;
+    return (int16_t)v;
+}
+
+uint16_t sweep(int block, int period)
+{
+    int phase = block % (2 * period);
+    int v = phase < period ? phase : 2 * period - phase;
+    return static_cast<uint16_t>(v * 4095 / period);
+}
+
+// Largest |difference| between two runs over `blocks` blocks.
+template <typename A, typename B>
+int maxDiff(A refBlock, B newBlock, int blocks)
+{
+    int worst = 0;
+    int16_t a[Block], b[Block];
+    for (int n = 0; n < blocks; ++n) {
+        refBlock(n, a);
+        newBlock(n, b);
+        for (int i = 0; i < Block; ++i) worst = std::max(worst, std::abs(a[i] - b[i]));
+    }
+    return worst;
+}
+
+void row(const char* label, Cost before, Cost after, int diff)
+{
+#ifdef LMUL_COUNT
+    std::printf("%-16s %8.2f %8.2f %s\n", label, before.ns, after.ns,
+        diff ? "DIFFERS" : "identical");
+#else
+    std::printf("%-16s %8.2f %8.1f %8.2f %8.1f %7.2fx %s\n", label, before.ns, before.cycles,
+        after.ns, after.cycles, before.ns / after.ns, diff ? "DIFFERS" : "identical");
+#endif
+}
+
+// A reverb at REF against its block version, each with delay memory to hand.
+template <typename Ref, typename New, typename Setup>
+void compareReverb(const char* label, Setup setup)
+{
+    auto memory = std::make_unique<int16_t[]>(dsp::DelayArena::kSlotWords);
+    auto inputAt = [](int b, int16_t* in) {
+        for (int i = 0; i < Block; ++i) in[i] = input(b * Block + i);
+    };
+    auto runRef = [&](Ref& verb) {
+        return [&](int b, int16_t* out) {
+            inputAt(b, out);
+            for (int i = 0; i < Block; ++i) out[i] = verb.process(out[i]);
+        };
+    };
+    auto runNew = [&](New& verb) {
+        return [&](int b, int16_t* out) {
+            inputAt(b, out);
+            verb.process(out, out, Block);
+        };
+    };
+
+    auto r1 = std::make_unique<Ref>();
+    auto n1 = std::make_unique<New>();
+    setup(*r1);
+    setup(*n1);
+    n1->attach(memory.get());
+    const int diff = maxDiff(runRef(*r1), runNew(*n1), 4 * Samples / Block);
+
+    auto r2 = std::make_unique<Ref>();
+    auto n2 = std::make_unique<New>();
+    setup(*r2);
+    setup(*n2);
+    n2->attach(memory.get());
+    Cost before, after;
+    measure(runRef(*r2), runNew(*n2), before, after);
+    row(label, before, after, diff);
+}
+
+// An algorithm at REF, per sample, against render() in blocks.
+template <typename Ref, typename New, typename RefSample>
+void compareAlgo(const char* label, RefSample refSample)
+{
+    auto memory = std::make_unique<int16_t[]>(dsp::DelayArena::kSlotWords);
+    auto runRef = [&](Ref& algo) {
+        return [&](int b, int16_t* out) {
+            const uint16_t x = sweep(b, 700), y = sweep(b, 1100);
+            for (int i = 0; i < Block; ++i) out[i] = static_cast<int16_t>(refSample(algo, x, y));
+        };
+    };
+    auto runNew = [&](New& algo) {
+        return [&](int b, int16_t* out) { algo.render(sweep(b, 700), sweep(b, 1100), out, Block); };
+    };
+
+    auto r1 = std::make_unique<Ref>();
+    auto n1 = std::make_unique<New>();
+    n1->reverb().attach(memory.get());
+    const int diff = maxDiff(runRef(*r1), runNew(*n1), 4 * Samples / Block);
+
+    auto r2 = std::make_unique<Ref>();
+    auto n2 = std::make_unique<New>();
+    n2->reverb().attach(memory.get());
+    Cost before, after;
+    measure(runRef(*r2), runNew(*n2), before, after);
+    row(label, before, after, diff);
+}
+
+} // namespace
+
+int main()
+{
+    // RAM. The registry held three MicroVerbs inline; now it holds three views and
+    // an arena of kSlots slots.
+    const size_t refVerb = sizeof(ref::dsp::MicroVerbMonoInt);
+    const size_t newVerb = sizeof(dsp::MicroVerbMonoInt);
+    const size_t arena = sizeof(dsp::DelayArena);
+    const size_t registryNow = sizeof(AlgoRegistry);
+    const size_t registryRef = registryNow - arena - 3 * newVerb + 3 * refVerb;
+
+    std::printf("%-24s %10s %10s\n", "RAM (bytes)", "REF", "now");
+    std::printf("%-24s %10zu %10zu\n", "MicroVerbMonoInt", refVerb, newVerb);
+    std::printf("%-24s %10zu %10zu\n", "FreeverbLiteInt", sizeof(ref::dsp_fv::FreeverbLiteInt),
+        sizeof(dsp::FreeverbLiteInt));
+    std::printf("%-24s %10zu %10zu\n", "S_H", sizeof(ref::SampleHoldReverbAlgo),
+        sizeof(SampleHoldReverbAlgo));
+    std::printf("%-24s %10zu %10zu\n", "SatanWorkout", sizeof(ref::SatanWorkoutAlgo),
+        sizeof(SatanWorkoutAlgo));
+    std::printf("%-24s %10zu %10zu\n", "BasuraTotal", sizeof(ref::BasuraTotalAlgo),
+        sizeof(BasuraTotalAlgo));
+    std::printf("%-24s %10s %10zu  (%d x %d samples)\n", "DelayArena", "-", arena,
+        dsp::DelayArena::kSlots, dsp::DelayArena::kSlotWords);
+    std::printf("%-24s %10zu %10zu  (%+ld)\n", "AlgoRegistry", registryRef, registryNow,
+        (long)registryNow - (long)registryRef);
+
+#ifdef LMUL_COUNT
+    std::printf("\n%-16s %8s %8s\n", "64-bit multiplies", "REF", "now");
+    std::printf("%-16s %8s %8s %s\n", "per sample", "", "blocks", "output");
+#else
+    std::printf("\n%-16s %17s %17s %8s\n", "", "REF per sample", "now, blocks", "");
+    std::printf("%-16s %8s %8s %8s %8s %8s %s\n", "per sample", "ns", "cycles", "ns", "cycles",
+        "speedup", "output");
+#endif
+
+    compareReverb<ref::dsp::MicroVerbMonoInt, dsp::MicroVerbMonoInt>("MicroVerb", [](auto& v) {
+        v.setRoomSize(0.75f);
+        v.setDamp(0.55f);
+        v.setWet(1.0f);
+        v.setDry(0.0f);
+    });
+    compareReverb<ref::dsp_fv::FreeverbLiteInt, dsp::FreeverbLiteInt>("FreeverbLite", [](auto& v) {
+        v.setRoomSize(0.8f);
+        v.setWet(1.0f);
+        v.setDry(0.3f);
+    });
+
+    compareAlgo<ref::SampleHoldReverbAlgo, SampleHoldReverbAlgo>("S_H",
+        [](ref::SampleHoldReverbAlgo& a, uint16_t x, uint16_t y) { return a.nextSample(x, y); });
+    compareAlgo<ref::SatanWorkoutAlgo, SatanWorkoutAlgo>("SatanWorkout",
+        [](ref::SatanWorkoutAlgo& a, uint16_t x, uint16_t y) { return a.process(x, y); });
+    compareAlgo<ref::BasuraTotalAlgo, BasuraTotalAlgo>("BasuraTotal",
+        [](ref::BasuraTotalAlgo& a, uint16_t x, uint16_t y) { return a.process(x, y); });
+    return 0;
+}
@@ -0,0 +1,9 @@
+// host_compat.h — force-included by host/Makefile. The card's newlib puts sinf in
+// namespace std, as dsp/WaveformOsc.hpp expects; glibc's <cmath> does not.
+#pragma once
+
+#include <cmath>
+
+namespace std {
+using ::sinf;
+}
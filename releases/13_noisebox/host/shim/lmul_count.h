@@ -0,0 +1,78 @@
+// lmul_count.h — force-included by host/Makefile for reverb_lmul only. The M0+ has no
+// 32x32->64 multiply, so GCC turns each int64_t multiply into an __aeabi_lmul call.
+// Here int64_t becomes lmul::I64, which behaves the same but counts its multiplies,
+// so the report can give calls per sample for REF and now.
+//
+// The standard headers the card's code and the report use are pulled in first, so the
+// macro only reaches ../algos, ../dsp and ref/.
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace lmul {
+
+inline unsigned long long calls = 0;
+
+struct I64 {
+    long long v;
+
+    constexpr I64() : v(0) {}
+    constexpr I64(long long x) : v(x) {}
+    constexpr operator long long() const { return v; }
+
+    I64& operator+=(I64 b) { v += b.v; return *this; }
+    I64& operator-=(I64 b) { v -= b.v; return *this; }
+    I64& operator>>=(int s) { v >>= s; return *this; }
+    I64& operator<<=(int s) { v <<= s; return *this; }
+};
+
+// Mixed with any other arithmetic type the result is an I64, as int64_t's would be
+// (float and double aside), and only * counts.
+template <typename T>
+using Arith = std::enable_if_t<std::is_arithmetic_v<T>, I64>;
+
+template <typename T> Arith<T> operator*(I64 a, T b) { ++calls; return a.v * (long long)b; }
+template <typename T> Arith<T> operator*(T a, I64 b) { ++calls; return (long long)a * b.v; }
+inline I64 operator*(I64 a, I64 b) { ++calls; return a.v * b.v; }
+
+#define LMUL_OP(op)                                                                    \
+    template <typename T> constexpr Arith<T> operator op(I64 a, T b) { return a.v op (long long)b; } \
+    template <typename T> constexpr Arith<T> operator op(T a, I64 b) { return (long long)a op b.v; } \
+    constexpr I64 operator op(I64 a, I64 b) { return a.v op b.v; }
+LMUL_OP(+)
+LMUL_OP(-)
+LMUL_OP(/)
+#undef LMUL_OP
+
+#define LMUL_CMP(op)                                                                   \
+    template <typename T> constexpr std::enable_if_t<std::is_arithmetic_v<T>, bool>    \
+        operator op(I64 a, T b) { return a.v op b; }                                   \
+    template <typename T> constexpr std::enable_if_t<std::is_arithmetic_v<T>, bool>    \
+        operator op(T a, I64 b) { return a op b.v; }                                   \
+    constexpr bool operator op(I64 a, I64 b) { return a.v op b.v; }
+LMUL_CMP(<)
+LMUL_CMP(>)
+LMUL_CMP(<=)
+LMUL_CMP(>=)
+LMUL_CMP(==)
+LMUL_CMP(!=)
+#undef LMUL_CMP
+
+constexpr I64 operator-(I64 a) { return -a.v; }
+constexpr I64 operator>>(I64 a, int s) { return a.v >> s; }
+constexpr I64 operator<<(I64 a, int s) { return a.v << s; }
+
+} // namespace lmul
+
+#define int64_t lmul::I64
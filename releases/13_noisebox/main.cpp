@@ -1,25 +1,18 @@
 #include "ComputerCard.h"
-#include "algos/ResoNoise.hpp"
-#include "algos/RadioOhNo.hpp"
-#include "algos/CrossModRingSquare.hpp"
-#include "algos/CrossModRingSine.hpp"
-#include "algos/ClusterSaw.hpp"
-#include "algos/Atari.hpp"
-#include "algos/Basurilla.hpp"
-#include "algos/ArrayOnTheRocks.hpp"
-#include "algos/RwalkModWave.hpp"
-#include "algos/PwCluster.hpp"
-#include "algos/ExistencelsPain.hpp"
-#include "algos/BasuraTotal.hpp"
-#include "algos/S_H.hpp"
-#include "algos/SatanWorkout.hpp"
-#include "algos/WhoKnows.hpp"
+#include "algos/AlgoRegistry.hpp"
+#include "algos/AlgoMorph.hpp"
+#include "hardware/sync.h"
+#include "pico/multicore.h"
 
 // Noise synthesis algorithms with CV control.
-// - Main knob: algorithm selection (7 algorithms: ResoNoise, RadioOhNo, 
-//   CrossModRingSquare, CrossModRingSine, ClusterSaw, ExistencesPain, Atari)
+// - Main knob: algorithm selection (13 algorithms, see AlgoRegistry)
 // - CV1 input: X parameter control for selected algorithm  
 // - CV2 input: Y parameter control for selected algorithm
+//
+// Core 1 renders the selected algorithm a block ahead (RenderLoop),
+// crossfading on changes (AlgoMorph) and settling the neighbouring
+// algorithms while idle. Core 0 publishes the controls each sample and
+// plays the rendered samples through the VCA, crusher and S&H outputs.
 
 class NoiseDemo : public ComputerCard
 {
@@ -40,10 +33,13 @@ public:
         , hold_reset_applied(false)
         , prev_switch_state(Switch::Middle)
         , rng_state(0xA5F1523Du)
+        , morph(algos)
+        , ringWrite(0)
+        , ringRead(0)
+        , controls(0)
+        , lastRendered(0)
     {
-        // Freeverb removed from main.
-        // Warm up all algos so internal states (e.g., reverbs/filters) settle.
-        warmupAllAlgos(1024); // ~125 ms at 48 kHz
+        // No boot warm-up: core 1 settles algorithms as the knob nears them.
     }
     virtual void ProcessSample()
     {
@@ -100,57 +96,26 @@ public:
         if (kMain_wrapped < 0) kMain_wrapped += 4096;
 
         // Dynamically select algorithm based on number of algos and knob position
-        // Order: ResoNoise, RadioOhNo, CrossModRingSquare, CrossModRingSine, ClusterSaw, Basurilla, PwCluster, ArrayOnTheRocks, RwalkModWave, Atari, ExistencelsPain, BasuraTotal
-
-        // List of algorithm lambdas for dynamic dispatch
-        constexpr int num_algos = 13;
-        int16_t s = 0;
+        constexpr int num_algos = AlgoRegistry::kNumAlgos;
         int algo_index = (kMain_wrapped * num_algos) / 4096;
         if (algo_index < 0) algo_index = 0;
         if (algo_index >= num_algos) algo_index = num_algos - 1;
 
-        switch (algo_index)
+        // Hand core 1 this sample's controls and take the next sample it
+        // rendered. On an underrun hold the last one rather than click.
+        controls = CONTROLS_VALID | (static_cast<uint32_t>(algo_index) << 24) |
+                   (static_cast<uint32_t>(kX) << 12) | kY;
+        int16_t s = lastRendered;
+        uint32_t r = ringRead;
+        if (r != ringWrite)
         {
-            case 0:
-                s = reso.nextSample(kX, kY);
-                break;
-            case 1:
-                s = radio.nextSample(kX, kY);
-                break;
-            case 2:
-                s = static_cast<int16_t>(xmodring.process(kX, kY));
-                break;
-            case 3:
-                s = static_cast<int16_t>(xmodringsine.process(kX, kY));
-                break;
-            case 4:
-                s = static_cast<int16_t>(clustersaw.process(kX, kY));
-                break;
-            case 5:
-                s = static_cast<int16_t>(basurilla.process(kX, kY));
-                break;
-            case 6:
-                s = static_cast<int16_t>(pwcluster.process(kX, kY));
-                break;
-            case 7:
-                s = static_cast<int16_t>(arrayrocks.process(kX, kY));
-                break;
-            case 8:
-                s = static_cast<int16_t>(atari.process(kX, kY));
-                break;
-            case 9:
-                s = static_cast<int16_t>(satanworkout.process(kX, kY));
-                break;
-            case 10:
-                s = samplehold.nextSample(kX, kY);  
-                break;
-            case 11:
-                s = static_cast<int16_t>(basuratotal.process(kX, kY));
-                break;
-            default:
-                s = static_cast<int16_t>(existencels.process(kX, kY));
-                break;
+            __dmb();
+            s = ring[r & (RING_SIZE - 1)];
+            __dmb();
+            ringRead = ++r;
+            if ((r & (AlgoMorph::kBlock - 1)) == 0) __sev(); // a block is free
         }
+        lastRendered = s;
 
         int32_t vca_0_to_4095 = Connected(Input::Audio2) ? (AudioIn2() + 2048) : 4095;
         if (vca_0_to_4095 < 0) vca_0_to_4095 = 0;
@@ -249,52 +214,44 @@ public:
 
     }
 
+    // Core 1, never returns. Keeps the ring topped up a block at a time
+    // and spends spare time warming the algorithms either side of the knob;
+    // with both warm it sleeps until core 0 frees a block.
+    void RenderLoop()
+    {
+        while (!(controls & CONTROLS_VALID)) tight_loop_contents();
+
+        while (true)
+        {
+            uint32_t w = ringWrite;
+            if (w - ringRead <= RING_SIZE - AlgoMorph::kBlock)
+            {
+                uint32_t c = controls;
+                morph.renderBlock(static_cast<int>((c >> 24) & 0x7F),
+                                  static_cast<uint16_t>((c >> 12) & 0xFFF),
+                                  static_cast<uint16_t>(c & 0xFFF),
+                                  &ring[w & (RING_SIZE - 1)]);
+                __dmb();
+                ringWrite = w + AlgoMorph::kBlock;
+            }
+            else if (!morph.warmNeighbours(WARM_CHUNK_SAMPLES))
+            {
+                __wfe();
+            }
+        }
+    }
+
 private:
     // Hold reset after 2.5 seconds at 48kHz
     static constexpr uint32_t HOLD_RESET_SAMPLES = 120000; // 2.5s * 48k
     // Minimal guard to avoid zero-length ramps
     static constexpr uint32_t MIN_PERIOD_SAMPLES = 1;
 
-    // Run each algorithm for a number of samples to allow internal DSP to settle
-    inline void warmupAllAlgos(int samplesPerAlgo)
-    {
-        if (samplesPerAlgo <= 0) return;
-        const uint16_t x_q12 = 2048;
-        const uint16_t y_q12 = 2048;
-
-        // Helpers to avoid code repetition
-        auto clamp4095 = [](int v){ if(v<0) return 0; if(v>4095) return 4095; return v; };
-        const int kx = clamp4095(2048);
-        const int ky = clamp4095(2048);
-
-        for (int i = 0; i < samplesPerAlgo; ++i) reso.nextSample(x_q12, y_q12);
-        for (int i = 0; i < samplesPerAlgo; ++i) radio.nextSample(x_q12, y_q12);
-        for (int i = 0; i < samplesPerAlgo; ++i) (void)xmodring.process(kx, ky);
-        for (int i = 0; i < samplesPerAlgo; ++i) (void)xmodringsine.process(kx, ky);
-        for (int i = 0; i < samplesPerAlgo; ++i) (void)clustersaw.process(kx, ky);
-        for (int i = 0; i < samplesPerAlgo; ++i) (void)basurilla.process(kx, ky);
-        for (int i = 0; i < samplesPerAlgo; ++i) (void)pwcluster.process(kx, ky);
-        for (int i = 0; i < samplesPerAlgo; ++i) (void)arrayrocks.process(kx, ky);
-        for (int i = 0; i < samplesPerAlgo; ++i) (void)atari.process(kx, ky);
-        for (int i = 0; i < samplesPerAlgo; ++i) (void)basuratotal.process(kx, ky);
-        for (int i = 0; i < samplesPerAlgo; ++i) (void)samplehold.nextSample(x_q12, y_q12);
-        for (int i = 0; i < samplesPerAlgo; ++i) (void)satanworkout.process(kx, ky);
-        for (int i = 0; i < samplesPerAlgo; ++i) (void)existencels.process(kx, ky);
-    }
-
-    ResoNoiseAlgo reso;
-    RadioOhNoAlgo radio;
-    CrossModRingSquare xmodring;
-    CrossModRingSine xmodringsine;
-    ClusterSaw clustersaw;
-    Basurilla basurilla;
-    PwCluster pwcluster;
-    ArrayOnTheRocks arrayrocks;
-    Atari atari;
-    ExistencelsPain existencels;
-    BasuraTotalAlgo basuratotal;
-    SampleHoldReverbAlgo samplehold;
-    SatanWorkoutAlgo satanworkout;
+    // Rendered audio, core 1 → core 0. Four blocks: ~2.7 ms of latency,
+    // and room for a warm-up chunk between blocks.
+    static constexpr uint32_t RING_SIZE = 4 * AlgoMorph::kBlock;
+    static constexpr int WARM_CHUNK_SAMPLES = 32;
+    static constexpr uint32_t CONTROLS_VALID = 0x80000000u;
 
     // Crusher state
     int sampleHoldCounter;
@@ -329,13 +286,30 @@ private:
         rng_state = 1664525u * rng_state + 1013904223u;
         return static_cast<uint16_t>((rng_state >> 16) & 0x0FFF); // 0..4095
     }
-    
+
+    // Algorithms and the core 1 → core 0 ring
+    AlgoRegistry algos;
+    AlgoMorph morph;
+    int16_t ring[RING_SIZE];
+    volatile uint32_t ringWrite;   // core 1 only
+    volatile uint32_t ringRead;    // core 0 only
+    volatile uint32_t controls;    // valid | algo << 24 | x << 12 | y
+    int16_t lastRendered;
 };
 
+static NoiseDemo* core1Demo = nullptr;
+
+static void core1_entry()
+{
+    core1Demo->RenderLoop();
+}
+
 int main()
 { 
 	set_sys_clock_khz(225000, true);
     NoiseDemo demo;
+    core1Demo = &demo;
+    multicore_launch_core1(core1_entry);
     // Enable jack-detection (normalisation probe) so Connected/Disconnected works
     demo.EnableNormalisationProbe();
     demo.Run();
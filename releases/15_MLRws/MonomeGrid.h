@@ -23,7 +23,6 @@
 extern "C" {
 #include "monome_ws.h"
 #ifdef MLR_PERF_PROFILING
-void mlr_perf_count_grid_frame_drop(void);
 void mlr_perf_note_grid_poll(uint32_t processed, uint32_t backlog_before, uint32_t backlog_after);
 #endif
 }
@@ -258,7 +257,7 @@ public:
 		frame_[y * MONOME_WS_GRID_MAX_X + x] = level;
 	}
 
-	/** Submit the accumulated local frame when core 1 can accept it. */
+	/** Submit the accumulated local frame; core 1 sends the newest one. */
 	void submitFrame()
 	{
 		frame_dirty_ = true;
@@ -280,12 +279,9 @@ private:
 	{
 		if (!frame_dirty_)
 			return;
+		/* Never refused: a frame core 1 has not sent yet is replaced. */
 		if (monome_ws_grid_frame_submit(frame_))
 			frame_dirty_ = false;
-#ifdef MLR_PERF_PROFILING
-		else
-			mlr_perf_count_grid_frame_drop();
-#endif
 	}
 
 	static void usb_core()
@@ -0,0 +1,401 @@
+// grid_mock — LED traffic and latency of monome_ws against a mock serial grid, on Linux.
+//
+// Builds ../monome_ws.c against shim/, next to monome_ws_ref, the padded-packet driver
+// (ref/, renamed). Each is connected over host CDC to its own mock
+// 16x8 mext grid, which answers discovery and parses LED messages into what the grid
+// shows. USB takes a 64-byte bulk packet a millisecond from the driver's 64-byte TX FIFO:
+//
+//   native   RP2040 grid, straight from USB
+//   ftdi     FT232R grid: into the chip's 256-byte buffer, then 11.5 bytes a millisecond
+//            at 115200 baud
+//
+// The app redraws every 4 ms, faster than the driver's 60 Hz refresh, and submits through
+// the same keep-until-accepted logic as MonomeGrid::submitFrame(). Two screens:
+//
+//   mlr       six playheads at different rates over their loop ranges, a master VU in row 7
+//   drumdrum  a 16th-note playhead across the step bars, a step edited every 700 ms
+//
+// Reported per screen, link and driver, over 10 s once the grid has settled:
+//
+//   wire B/s     bytes queued to USB, padding included
+//   msg B/s      bytes of LED messages the grid parsed
+//   shown        frames the app drew that the grid showed exactly, of those drawn
+//   lat avg/max  ms from a frame being drawn until the grid shows it or a newer one
+//   final        whether the grid shows the last frame once the app stops drawing
+//
+//   ./grid_mock      exit status is non-zero if the new driver leaves the grid wrong
+#include "monome_ws.h"
+#include "monome_ws_ref.h"
+#include "tusb.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <vector>
+
+extern "C" uint64_t host_now_us;
+uint64_t host_now_us = 0;
+
+namespace {
+
+constexpr int kCols = 16;
+constexpr int kRows = 8;
+constexpr uint32_t kFifo = 64;
+constexpr uint32_t kUartBuffer = 256;
+constexpr double kUsbBytesPerUs = 0.064;
+constexpr uint64_t kStepUs = 50;
+constexpr uint64_t kRedrawUs = 4000;
+constexpr uint64_t kSettleUs = 4000000;
+constexpr uint64_t kMeasureUs = 10000000;
+constexpr uint64_t kTailUs = 500000;
+
+using Frame = std::array<uint8_t, MONOME_WS_GRID_MAX_X * MONOME_WS_GRID_MAX_Y>;
+
+bool SameShown(const uint8_t* a, const uint8_t* b) {
+  for (int y = 0; y < kRows; ++y) {
+    if (std::memcmp(a + y * MONOME_WS_GRID_MAX_X, b + y * MONOME_WS_GRID_MAX_X, kCols) != 0) return false;
+  }
+  return true;
+}
+
+// ─── Mock grid ───────────────────────────────────────────────────────────────
+
+size_t MextLength(uint8_t header) {
+  switch (header) {
+    case 0x10: case 0x11: return 3;
+    case 0x14: return 11;
+    case 0x15: case 0x16: case 0x18: return 4;
+    case 0x17: case 0x19: return 2;
+    case 0x1A: return 35;
+    case 0x1B: case 0x1C: return 7;
+    default: return 1;
+  }
+}
+
+struct MockGrid {
+  double uart_bytes_per_us = 0;  // 0: no UART, USB feeds the grid directly
+  double usb_credit = 0;
+  double uart_credit = 0;
+  std::deque<uint8_t> fifo;  // driver → USB
+  std::deque<uint8_t> uart;  // USB → grid, through an FTDI chip
+  std::deque<uint8_t> reply; // grid → driver
+  uint8_t msg[35] = {};
+  size_t msg_len = 0;
+  uint8_t leds[MONOME_WS_GRID_MAX_X * MONOME_WS_GRID_MAX_Y] = {};
+  uint64_t wire = 0;
+  uint64_t parsed = 0;
+  bool changed = false;
+
+  uint32_t Write(const void* data, uint32_t len) {
+    const uint32_t n = std::min<uint32_t>(len, kFifo - static_cast<uint32_t>(fifo.size()));
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    fifo.insert(fifo.end(), p, p + n);
+    wire += n;
+    return n;
+  }
+
+  uint32_t Read(void* data, uint32_t len) {
+    uint32_t n = 0;
+    for (uint8_t* p = static_cast<uint8_t*>(data); n < len && !reply.empty(); ++n) {
+      p[n] = reply.front();
+      reply.pop_front();
+    }
+    return n;
+  }
+
+  void Drain(uint64_t dt_us) {
+    usb_credit = std::min(usb_credit + kUsbBytesPerUs * dt_us, static_cast<double>(kFifo));
+    while (usb_credit >= 1.0 && !fifo.empty() && (uart_bytes_per_us == 0 || uart.size() < kUartBuffer)) {
+      if (uart_bytes_per_us == 0)
+        Consume(fifo.front());
+      else
+        uart.push_back(fifo.front());
+      fifo.pop_front();
+      usb_credit -= 1.0;
+    }
+    if (uart_bytes_per_us == 0) return;
+    uart_credit = std::min(uart_credit + uart_bytes_per_us * dt_us, 1.0);
+    while (uart_credit >= 1.0 && !uart.empty()) {
+      Consume(uart.front());
+      uart.pop_front();
+      uart_credit -= 1.0;
+    }
+  }
+
+  void Consume(uint8_t byte) {
+    if (msg_len == 0 && byte == 0xFF) return;
+    msg[msg_len++] = byte;
+    if (msg_len < MextLength(msg[0])) return;
+    parsed += msg_len;
+    Apply();
+    msg_len = 0;
+  }
+
+  void Set(int x, int y, uint8_t level) {
+    if (x < 0 || y < 0 || x >= MONOME_WS_GRID_MAX_X || y >= MONOME_WS_GRID_MAX_Y) return;
+    uint8_t& led = leds[y * MONOME_WS_GRID_MAX_X + x];
+    changed |= led != level;
+    led = level;
+  }
+
+  void Apply() {
+    const int x = msg[1] & ~7, y = msg[2] & ~7;
+    switch (msg[0]) {
+      case 0x00: reply.insert(reply.end(), {0x00, 0x01, 0x01}); break;
+      case 0x05: reply.insert(reply.end(), {0x03, kCols, kRows}); break;
+      case 0x10: case 0x11: Set(msg[1], msg[2], msg[0] == 0x11 ? 15 : 0); break;
+      case 0x12:
+        for (int i = 0; i < MONOME_WS_GRID_MAX_X * MONOME_WS_GRID_MAX_Y; ++i) Set(i % 16, i / 16, 0);
+        break;
+      case 0x14:
+        for (int r = 0; r < 8; ++r)
+          for (int c = 0; c < 8; ++c) Set(x + c, y + r, (msg[3 + r] >> c) & 1 ? 15 : 0);
+        break;
+      case 0x15:
+        for (int c = 0; c < 8; ++c) Set(x + c, msg[2], (msg[3] >> c) & 1 ? 15 : 0);
+        break;
+      case 0x16:
+        for (int r = 0; r < 8; ++r) Set(msg[1], y + r, (msg[3] >> r) & 1 ? 15 : 0);
+        break;
+      case 0x18: Set(msg[1], msg[2], msg[3] & 0x0F); break;
+      case 0x19:
+        for (int i = 0; i < MONOME_WS_GRID_MAX_X * MONOME_WS_GRID_MAX_Y; ++i) Set(i % 16, i / 16, msg[1] & 0x0F);
+        break;
+      case 0x1A:
+        for (int i = 0; i < 64; ++i) {
+          const uint8_t d = msg[3 + i / 2];
+          Set(x + i % 8, y + i / 8, i & 1 ? d & 0x0F : d >> 4);
+        }
+        break;
+      case 0x1B:
+        for (int c = 0; c < 8; ++c) Set(x + c, msg[2], c & 1 ? msg[3 + c / 2] & 0x0F : msg[3 + c / 2] >> 4);
+        break;
+      case 0x1C:
+        for (int r = 0; r < 8; ++r) Set(msg[1], y + r, r & 1 ? msg[3 + r / 2] & 0x0F : msg[3 + r / 2] >> 4);
+        break;
+      default: break;
+    }
+  }
+};
+
+// grids[0] is behind tuh_/tud_ (../monome_ws.c), grids[1] behind ref_tuh_/ref_tud_
+MockGrid* grids[2];
+
+}  // namespace
+
+#define HOST_CDC_IMPL(p, n)                                                                     \
+  extern "C" void p##tuh_task(void) {}                                                          \
+  extern "C" uint32_t p##tuh_cdc_write(uint8_t, const void* b, uint32_t len) { return grids[n]->Write(b, len); } \
+  extern "C" uint32_t p##tuh_cdc_write_available(uint8_t) { return kFifo - (uint32_t)grids[n]->fifo.size(); } \
+  extern "C" uint32_t p##tuh_cdc_write_flush(uint8_t) { return 0; }                             \
+  extern "C" uint32_t p##tuh_cdc_read(uint8_t, void* b, uint32_t len) { return grids[n]->Read(b, len); } \
+  extern "C" bool p##tud_mounted(void) { return false; }                                        \
+  extern "C" uint32_t p##tud_cdc_n_write(uint8_t, const void*, uint32_t) { return 0; }          \
+  extern "C" uint32_t p##tud_cdc_n_write_available(uint8_t) { return 0; }                       \
+  extern "C" uint32_t p##tud_cdc_n_write_flush(uint8_t) { return 0; }                           \
+  extern "C" uint32_t p##tud_cdc_n_read(uint8_t, void*, uint32_t) { return 0; }
+
+HOST_CDC_IMPL(, 0)
+HOST_CDC_IMPL(ref_, 1)
+
+namespace {
+
+// ─── Screens ─────────────────────────────────────────────────────────────────
+
+void Put(Frame& f, int x, int y, uint8_t level) { f[y * MONOME_WS_GRID_MAX_X + x] = level; }
+
+struct MlrScreen {
+  static constexpr int kStart[6] = {0, 0, 4, 8, 2, 0};
+  static constexpr int kEnd[6] = {15, 7, 11, 15, 13, 15};
+  static constexpr uint64_t kStepUs[6] = {125000, 250000, 93750, 187500, 62500, 500000};
+
+  void Draw(uint64_t t, Frame& f) {
+    f.fill(0);
+    for (int x = 0; x < 4; ++x) Put(f, x, 0, x == 1 ? 12 : 4);
+    Put(f, 15, 0, 8);
+    for (int i = 0; i < 6; ++i) {
+      for (int x = kStart[i]; x <= kEnd[i]; ++x) Put(f, x, 1 + i, 3);
+      const int span = kEnd[i] - kStart[i] + 1;
+      Put(f, kStart[i] + static_cast<int>((t / kStepUs[i]) % span), 1 + i, 15);
+    }
+    // Master VU: a wobbling level with a little jitter each redraw
+    const double s = t * 1e-6;
+    const double v = 0.55 + 0.3 * std::sin(2 * 3.14159265 * 1.3 * s) + 0.1 * std::sin(2 * 3.14159265 * 7.1 * s);
+    const int width = std::clamp(static_cast<int>(v * 16), 0, 16);
+    for (int x = 0; x < width; ++x) Put(f, x, 7, static_cast<uint8_t>(2 + x * 10 / 15));
+  }
+};
+
+struct DrumdrumScreen {
+  int pitch[8] = {3, 1, 5, 2, 7, 4, 2, 6};
+  int velocity[8] = {12, 6, 9, 4, 10, 7, 5, 11};
+  int selected = 0;
+  uint64_t edits = 0;
+
+  void Draw(uint64_t t, Frame& f) {
+    // A step edited every 700 ms, as if from the right-hand pages
+    for (; edits < t / 700000; ++edits) {
+      const uint32_t h = static_cast<uint32_t>(edits) * 2654435761u;
+      selected = static_cast<int>(edits % 8);
+      pitch[selected] = 1 + static_cast<int>((h >> 8) % 7);
+      velocity[selected] = 4 + static_cast<int>((h >> 16) % 9);
+    }
+    const int current = static_cast<int>((t / 125000) % 8);
+    f.fill(0);
+    for (int x = 0; x < 8; ++x) Put(f, x, 0, 8);
+    Put(f, 15, 0, 15);
+    for (int s = 0; s < 8; ++s) {
+      for (int h = 0; h < pitch[s]; ++h) Put(f, s, 7 - h, static_cast<uint8_t>(s == current ? 15 : velocity[s]));
+    }
+    Put(f, 8 + pitch[selected], 2, 10);
+    for (int x = 0; x < velocity[selected] / 2; ++x) Put(f, 8 + x, 4, 10);
+  }
+};
+
+// ─── Drivers ─────────────────────────────────────────────────────────────────
+
+struct Driver {
+  const char* name;
+  int grid;
+  void (*start)();
+  void (*task)();
+  bool (*submit)(const uint8_t*);
+};
+
+const Driver kDrivers[] = {
+    {"ref", 1,
+     [] {
+       monome_ws_ref_init(MONOME_WS_REF_TRANSPORT_HOST, 0);
+       ref_tuh_cdc_mount_cb(0);
+     },
+     monome_ws_ref_task, monome_ws_ref_grid_frame_submit},
+    {"new", 0,
+     [] {
+       monome_ws_init(MONOME_WS_TRANSPORT_HOST, 0);
+       tuh_cdc_mount_cb(0);
+     },
+     monome_ws_task, monome_ws_grid_frame_submit},
+};
+
+struct Link {
+  const char* name;
+  double uart_bytes_per_us;
+};
+
+const Link kLinks[] = {{"native", 0}, {"ftdi", 0.0115}};
+
+struct Result {
+  double wire_bps, msg_bps;
+  uint32_t shown, drawn;
+  double lat_avg_ms, lat_max_ms;
+  bool final_ok;
+};
+
+template <typename Screen>
+Result Run(const Driver& driver, const Link& link) {
+  MockGrid grid;
+  grid.uart_bytes_per_us = link.uart_bytes_per_us;
+  grids[driver.grid] = &grid;
+  Screen screen;
+
+  // Keep time running across runs, so the drivers' last-refresh timestamps stay behind it
+  host_now_us += 1000000;
+  const uint64_t t0 = host_now_us;
+  const uint64_t measure_start = t0 + kSettleUs;
+  const uint64_t measure_end = measure_start + kMeasureUs;
+  driver.start();
+
+  struct Drawn {
+    uint64_t t;
+    Frame leds;
+    bool measured;
+  };
+  std::deque<Drawn> pending;
+  Frame frame{}, last{};
+  bool have_last = false, frame_dirty = false;
+  uint64_t next_redraw = t0;
+  uint64_t wire0 = 0, parsed0 = 0;
+  Result r{};
+  double lat_sum = 0;
+  uint32_t lat_n = 0;
+
+  for (uint64_t now = t0; now < measure_end + kTailUs; now += kStepUs) {
+    host_now_us = now;
+    if (now == measure_start) {
+      wire0 = grid.wire;
+      parsed0 = grid.parsed;
+    }
+    if (now >= next_redraw && now < measure_end) {
+      next_redraw += kRedrawUs;
+      screen.Draw(now - t0, frame);
+      if (!have_last || !SameShown(frame.data(), last.data())) {
+        last = frame;
+        have_last = true;
+        frame_dirty = true;
+        pending.push_back({now, frame, now >= measure_start});
+        if (now >= measure_start) r.drawn++;
+      }
+      // MonomeGrid::submitFrameIfPossible(): kept dirty until the driver takes it
+      if (frame_dirty && driver.submit(frame.data())) frame_dirty = false;
+    }
+
+    driver.task();
+
+    grid.changed = false;
+    grid.Drain(kStepUs);
+    if (!grid.changed) continue;
+    for (size_t k = pending.size(); k-- > 0;) {
+      if (!SameShown(grid.leds, pending[k].leds.data())) continue;
+      if (pending[k].measured) r.shown++;
+      for (size_t j = 0; j <= k; ++j) {
+        if (!pending[j].measured) continue;
+        const double ms = (now - pending[j].t) / 1000.0;
+        lat_sum += ms;
+        lat_n++;
+        r.lat_max_ms = std::max(r.lat_max_ms, ms);
+      }
+      pending.erase(pending.begin(), pending.begin() + static_cast<long>(k) + 1);
+      break;
+    }
+  }
+
+  for (const Drawn& d : pending) {
+    if (!d.measured) continue;
+    const double ms = (host_now_us - d.t) / 1000.0;
+    lat_sum += ms;
+    lat_n++;
+    r.lat_max_ms = std::max(r.lat_max_ms, ms);
+  }
+  const double seconds = kMeasureUs / 1e6;
+  r.wire_bps = (grid.wire - wire0) / seconds;
+  r.msg_bps = (grid.parsed - parsed0) / seconds;
+  r.lat_avg_ms = lat_n ? lat_sum / lat_n : 0;
+  r.final_ok = SameShown(grid.leds, last.data());
+  grids[driver.grid] = nullptr;
+  return r;
+}
+
+}  // namespace
+
+int main() {
+  int bad = 0;
+  std::printf("%-9s %-7s %-6s %9s %9s %11s %8s %8s  %s\n", "screen", "link", "driver", "wire B/s", "msg B/s",
+              "shown", "lat avg", "lat max", "final");
+  for (int screen = 0; screen < 2; ++screen) {
+    for (const Link& link : kLinks) {
+      for (const Driver& driver : kDrivers) {
+        const Result r = screen == 0 ? Run<MlrScreen>(driver, link) : Run<DrumdrumScreen>(driver, link);
+        char shown[24];
+        std::snprintf(shown, sizeof(shown), "%u/%u", r.shown, r.drawn);
+        std::printf("%-9s %-7s %-6s %9.0f %9.0f %11s %6.1fms %6.1fms  %s\n", screen ? "drumdrum" : "mlr",
+                    link.name, driver.name, r.wire_bps, r.msg_bps, shown, r.lat_avg_ms, r.lat_max_ms,
+                    r.final_ok ? "ok" : "WRONG");
+        if (driver.grid == 0 && !r.final_ok) bad++;
+      }
+    }
+  }
+  return bad ? 1 : 0;
+}
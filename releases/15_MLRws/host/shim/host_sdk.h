@@ -0,0 +1,49 @@
+/* host_sdk.h — just enough of the Pico SDK and TinyUSB to compile monome_ws.c on Linux.
+ * tusb.h, pico/time.h and pico/platform.h in this directory are one-line files that
+ * include this one; host/Makefile puts it first on the include path.
+ *
+ * The CDC calls are declared twice: tuh_ and tud_ for ../monome_ws.c, and ref_tuh_ and
+ * ref_tud_ for the driver as of REF, which the Makefile renames so both link into one
+ * binary. grid_mock.cpp implements each set against its own mock grid. Time is whatever
+ * the harness sets host_now_us to. */
+#ifndef HOST_SDK_H
+#define HOST_SDK_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define __not_in_flash_func(f) f
+#define __dmb() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+extern uint64_t host_now_us;
+static inline uint64_t time_us_64(void) { return host_now_us; }
+
+#define HOST_CDC_API(p)                                                                     \
+	void p##tuh_task(void);                                                                 \
+	uint32_t p##tuh_cdc_write(uint8_t idx, const void *buffer, uint32_t bufsize);           \
+	uint32_t p##tuh_cdc_write_available(uint8_t idx);                                       \
+	uint32_t p##tuh_cdc_write_flush(uint8_t idx);                                           \
+	uint32_t p##tuh_cdc_read(uint8_t idx, void *buffer, uint32_t bufsize);                  \
+	bool p##tud_mounted(void);                                                              \
+	uint32_t p##tud_cdc_n_write(uint8_t itf, const void *buffer, uint32_t bufsize);         \
+	uint32_t p##tud_cdc_n_write_available(uint8_t itf);                                     \
+	uint32_t p##tud_cdc_n_write_flush(uint8_t itf);                                         \
+	uint32_t p##tud_cdc_n_read(uint8_t itf, void *buffer, uint32_t bufsize);                \
+	void p##tuh_cdc_mount_cb(uint8_t idx);                                                  \
+	void p##tuh_cdc_umount_cb(uint8_t idx);                                                 \
+	void p##tuh_cdc_rx_cb(uint8_t idx);                                                     \
+	void p##tuh_cdc_tx_complete_cb(uint8_t idx);
+
+HOST_CDC_API()
+HOST_CDC_API(ref_)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1 @@
+#include "host_sdk.h"   /* host build: see host_sdk.h */
@@ -11,6 +11,7 @@
 
 #ifdef MLR_PERF_PROFILING
 void mlr_perf_count_monome_ws_event_drop(void);
+void mlr_perf_count_grid_frame_drop(void);
 #endif
 
 #ifndef MONOME_WS_LEGACY_DEFAULT_PROTOCOL
@@ -32,10 +33,41 @@ void mlr_perf_count_monome_ws_event_drop(void);
 #define MONOME_WS_OUTPUT_SETTLE_US 2500000ull
 #define MONOME_WS_FORCE_REFRESH_WINDOW_US 1000000ull
 #define MONOME_WS_FORCE_REFRESH_INTERVAL_US 250000ull
+#define MONOME_WS_TX_PACKET 64
+
+/* Grid LED backends, by the messages they can send. */
+enum {
+	GRID_TX_MEXT_LEVELS,
+	GRID_TX_MEXT_BINARY,
+	GRID_TX_SERIES,
+	GRID_TX_40H,
+};
+
+/* Message sizes per backend; 0 where the backend has no such message. */
+typedef struct {
+	uint8_t led;
+	uint8_t row;
+	uint8_t col;
+	uint8_t quad;
+} grid_tx_costs_t;
+
+static const grid_tx_costs_t s_grid_tx_costs[] = {
+	[GRID_TX_MEXT_LEVELS] = {4, 7, 7, 35},
+	[GRID_TX_MEXT_BINARY] = {3, 4, 4, 11},
+	[GRID_TX_SERIES]      = {2, 2, 2, 9},
+	[GRID_TX_40H]         = {0, 2, 0, 0},
+};
 
 monome_ws_state_t g_monome_ws;
 static uint64_t s_last_refresh_us = 0;
 
+/* LED packet being built, and the cells it carries (a column mask per quad
+ * row) so they reach grid_shadow only once the packet is queued. */
+static uint8_t s_tx[MONOME_WS_TX_PACKET];
+static uint8_t s_tx_len = 0;
+static uint8_t s_tx_cells[4][8];
+static bool    s_tx_intensity = false;
+
 static bool monome_ws_send_raw(const uint8_t *data, uint32_t len)
 {
 	if (!g_monome_ws.connected || g_monome_ws.cdc_idx < 0)
@@ -127,6 +159,34 @@ static uint8_t frame_row_mask(uint8_t x_off, uint8_t y)
 	return mask;
 }
 
+static uint8_t frame_col_mask(uint8_t x, uint8_t y_off)
+{
+	uint8_t mask = 0;
+	for (uint8_t bit = 0; bit < 8; bit++) {
+		uint8_t y = y_off + bit;
+		if (x < g_monome_ws.grid_x && y < g_monome_ws.grid_y) {
+			uint8_t level = g_monome_ws.grid_led[y * MONOME_WS_GRID_MAX_X + x];
+			if (level_to_bit(level))
+				mask |= (uint8_t)(1u << bit);
+		}
+	}
+	return mask;
+}
+
+static inline uint8_t grid_level(uint8_t x, uint8_t y)
+{
+	if (x >= g_monome_ws.grid_x || y >= g_monome_ws.grid_y)
+		return 0;
+	return g_monome_ws.grid_led[y * MONOME_WS_GRID_MAX_X + x];
+}
+
+/* Cells of a quad line starting at `off` that fall inside `size`. */
+static inline uint8_t in_range_mask(uint8_t off, uint8_t size)
+{
+	uint8_t n = size > off ? (uint8_t)(size - off) : 0;
+	return n >= 8 ? 0xFF : (uint8_t)((1u << n) - 1u);
+}
+
 static void set_grid_identity(uint8_t cols, uint8_t rows, monome_ws_protocol_t protocol)
 {
 	bool identity_changed = g_monome_ws.protocol != (uint8_t)protocol ||
@@ -150,7 +210,7 @@ static void set_grid_identity(uint8_t cols, uint8_t rows, monome_ws_protocol_t p
 			(now_us - g_monome_ws.connect_time_us) < MONOME_WS_OUTPUT_SETTLE_US) {
 			first_refresh_us = g_monome_ws.connect_time_us + MONOME_WS_OUTPUT_SETTLE_US;
 		}
-		memset(g_monome_ws.grid_led, 0xFF, sizeof(g_monome_ws.grid_led));
+		memset(g_monome_ws.grid_shadow, 0xFF, sizeof(g_monome_ws.grid_shadow));
 		for (int q = 0; q < 4; q++)
 			g_monome_ws.grid_dirty[q] = false;
 		g_monome_ws.force_refresh_until_us = first_refresh_us + MONOME_WS_FORCE_REFRESH_WINDOW_US;
@@ -366,9 +426,10 @@ void monome_ws_connect(int cdc_idx)
 	g_monome_ws.rx_expected = 0;
 	memset(g_monome_ws.grid_led, 0, sizeof(g_monome_ws.grid_led));
 	memset(g_monome_ws.grid_next, 0, sizeof(g_monome_ws.grid_next));
+	memset(g_monome_ws.grid_shadow, 0xFF, sizeof(g_monome_ws.grid_shadow));
 	memset(g_monome_ws.arc_ring, 0, sizeof(g_monome_ws.arc_ring));
 	for (int q = 0; q < 4; q++) g_monome_ws.grid_dirty[q] = false;
-	g_monome_ws.grid_frame_pending = false;
+	g_monome_ws.grid_next_taken = g_monome_ws.grid_next_seq;
 	g_monome_ws.discovery_tick = 0;
 	g_monome_ws.connect_time_us = time_us_64();
 	g_monome_ws.force_refresh_until_us = 0;
@@ -416,7 +477,8 @@ void monome_ws_grid_all_off(void)
 {
 	if (g_monome_ws.protocol == MONOME_WS_PROTOCOL_MEXT || g_monome_ws.protocol == MONOME_WS_PROTOCOL_UNKNOWN) {
 		const uint8_t buf[] = {0x12};
-		monome_ws_send_raw(buf, sizeof(buf));
+		if (monome_ws_send_raw(buf, sizeof(buf)))
+			memset(g_monome_ws.grid_shadow, 0, sizeof(g_monome_ws.grid_shadow));
 	} else {
 		monome_ws_grid_led_all(0);
 	}
@@ -425,10 +487,21 @@ void monome_ws_grid_all_off(void)
 bool __not_in_flash_func(monome_ws_grid_frame_submit)(const uint8_t *levels)
 {
 	if (levels == NULL) return false;
-	if (g_monome_ws.grid_frame_pending) return false;
+
+	/* Latest frame wins: one the refresh has not taken yet is overwritten.
+	 * The sequence number is odd while grid_next is being written. */
+	uint32_t seq = g_monome_ws.grid_next_seq;
+	if (seq != g_monome_ws.grid_next_taken) {
+		g_monome_ws.grid_frames_coalesced++;
+#ifdef MLR_PERF_PROFILING
+		mlr_perf_count_grid_frame_drop();
+#endif
+	}
+	g_monome_ws.grid_next_seq = seq + 1u;
+	__dmb();
 	memcpy(g_monome_ws.grid_next, levels, sizeof(g_monome_ws.grid_next));
 	__dmb();
-	g_monome_ws.grid_frame_pending = true;
+	g_monome_ws.grid_next_seq = seq + 2u;
 	return true;
 }
 
@@ -442,105 +515,334 @@ void monome_ws_send_discovery(void)
 	monome_ws_send(query_size, sizeof(query_size));
 }
 
-static void refresh_mext_grid(void)
+static void tx_commit(void)
 {
-	if (g_monome_ws.intensity_pending) {
-		uint8_t ibuf[2] = {0x17, g_monome_ws.grid_intensity};
-		if (monome_ws_send_raw(ibuf, 2))
-			g_monome_ws.intensity_pending = false;
+	for (uint8_t q = 0; q < 4; q++) {
+		uint8_t xo = (q & 1) ? 8 : 0;
+		uint8_t yo = (q & 2) ? 8 : 0;
+		for (uint8_t r = 0; r < 8; r++) {
+			uint8_t cells = s_tx_cells[q][r];
+			if (!cells) continue;
+			for (uint8_t c = 0; c < 8; c++) {
+				if (cells & (1u << c)) {
+					uint16_t idx = (uint16_t)(yo + r) * MONOME_WS_GRID_MAX_X + xo + c;
+					g_monome_ws.grid_shadow[idx] = g_monome_ws.grid_led[idx];
+				}
+			}
+			s_tx_cells[q][r] = 0;
+		}
 	}
+	s_tx_intensity = false;
+	s_tx_len = 0;
+}
 
-	for (uint8_t yo = 0; yo < g_monome_ws.grid_y; yo += 8) {
-		for (uint8_t xo = 0; xo < g_monome_ws.grid_x; xo += 8) {
-			uint8_t q = quad_idx(xo, yo);
-			if (!g_monome_ws.grid_dirty[q]) continue;
-
-			uint8_t buf[35];
-			buf[0] = 0x1A;
-			buf[1] = xo;
-			buf[2] = yo;
-			uint8_t *p = buf + 3;
-			for (uint8_t r = 0; r < 8; r++) {
-				for (uint8_t c = 0; c < 8; c += 2) {
-					uint8_t gx0 = xo + c;
-					uint8_t gx1 = gx0 + 1;
-					uint8_t gy = yo + r;
-					uint8_t a = (gx0 < g_monome_ws.grid_x && gy < g_monome_ws.grid_y) ? g_monome_ws.grid_led[gy * MONOME_WS_GRID_MAX_X + gx0] : 0;
-					uint8_t b = (gx1 < g_monome_ws.grid_x && gy < g_monome_ws.grid_y) ? g_monome_ws.grid_led[gy * MONOME_WS_GRID_MAX_X + gx1] : 0;
-					*p++ = (uint8_t)((a << 4) | (b & 0x0F));
-				}
+/* The USB queue is full: drop the packet and leave its quads dirty. The next
+ * refresh plans them again from whatever frame is newest by then. */
+static void tx_discard(void)
+{
+	for (uint8_t q = 0; q < 4; q++) {
+		for (uint8_t r = 0; r < 8; r++) {
+			if (s_tx_cells[q][r]) {
+				g_monome_ws.grid_dirty[q] = true;
+				s_tx_cells[q][r] = 0;
 			}
-			if (monome_ws_send_raw(buf, sizeof(buf)))
-				g_monome_ws.grid_dirty[q] = false;
 		}
 	}
+	if (s_tx_intensity)
+		g_monome_ws.intensity_pending = true;
+	s_tx_intensity = false;
+	s_tx_len = 0;
 }
 
-#if MONOME_WS_FORCE_8X8_MONOBRIGHT
-static void refresh_mext_binary_grid(void)
+static bool tx_flush(void)
 {
-	if (g_monome_ws.intensity_pending) {
-		uint8_t ibuf[2] = {0x17, g_monome_ws.grid_intensity};
-		if (monome_ws_send_raw(ibuf, 2))
-			g_monome_ws.intensity_pending = false;
+	if (s_tx_len == 0)
+		return true;
+	if (!monome_ws_send_raw(s_tx, s_tx_len)) {
+		tx_discard();
+		return false;
 	}
+	g_monome_ws.grid_tx_bytes += MONOME_WS_TX_PACKET;
+	tx_commit();
+	return true;
+}
 
-	for (uint8_t yo = 0; yo < g_monome_ws.grid_y; yo += 8) {
-		for (uint8_t xo = 0; xo < g_monome_ws.grid_x; xo += 8) {
-			uint8_t q = quad_idx(xo, yo);
-			if (!g_monome_ws.grid_dirty[q]) continue;
+/* Messages share 64-byte packets; send_raw still pads the last one. */
+static bool tx_append(const uint8_t *data, uint8_t len)
+{
+	if (s_tx_len + len > MONOME_WS_TX_PACKET && !tx_flush())
+		return false;
+	memcpy(s_tx + s_tx_len, data, len);
+	s_tx_len += len;
+	return true;
+}
 
-			uint8_t buf[11];
-			buf[0] = 0x14;
-			buf[1] = xo;
-			buf[2] = yo;
-			for (uint8_t r = 0; r < 8; r++)
-				buf[3 + r] = frame_row_mask(xo, yo + r);
-			if (monome_ws_send_raw(buf, sizeof(buf)))
-				g_monome_ws.grid_dirty[q] = false;
+/* Cells of a quad that differ from the device, as a column mask per row and
+ * a row mask per column. Binary backends only see the thresholded bit. */
+static bool quad_changes(uint8_t xo, uint8_t yo, bool binary, uint8_t rows[8], uint8_t cols[8])
+{
+	bool any = false;
+	memset(cols, 0, 8);
+	for (uint8_t r = 0; r < 8; r++) {
+		rows[r] = 0;
+		uint8_t y = yo + r;
+		if (y >= g_monome_ws.grid_y) continue;
+		for (uint8_t c = 0; c < 8; c++) {
+			uint8_t x = xo + c;
+			if (x >= g_monome_ws.grid_x) break;
+			uint16_t idx = (uint16_t)y * MONOME_WS_GRID_MAX_X + x;
+			uint8_t level = g_monome_ws.grid_led[idx];
+			uint8_t shown = g_monome_ws.grid_shadow[idx];
+			bool changed = shown == 0xFF ||
+				(binary ? level_to_bit(level) != level_to_bit(shown) : level != shown);
+			if (changed) {
+				rows[r] |= (uint8_t)(1u << c);
+				cols[c] |= (uint8_t)(1u << r);
+				any = true;
+			}
 		}
 	}
+	return any;
 }
-#endif
 
-static void refresh_series_grid(void)
+/* Bytes to bring the changed cells up to date line by line, each line taking
+ * single-LED messages or one line message, whichever is shorter. */
+static uint32_t lines_cost(const uint8_t masks[8], uint8_t led, uint8_t line)
 {
-	if (g_monome_ws.intensity_pending) {
-		uint8_t ibuf = (uint8_t)(0xA0 | (g_monome_ws.grid_intensity & 0x0F));
-		monome_ws_send_raw(&ibuf, 1);
-		g_monome_ws.intensity_pending = false;
+	uint32_t total = 0;
+	for (uint8_t i = 0; i < 8; i++) {
+		if (!masks[i]) continue;
+		uint32_t singles = led ? (uint32_t)__builtin_popcount(masks[i]) * led : UINT32_MAX;
+		uint32_t best = (line && line < singles) ? line : singles;
+		if (best == UINT32_MAX)
+			return UINT32_MAX;
+		total += best;
 	}
+	return total;
+}
 
-	for (uint8_t yo = 0; yo < g_monome_ws.grid_y; yo += 8) {
-		for (uint8_t xo = 0; xo < g_monome_ws.grid_x; xo += 8) {
-			uint8_t q = quad_idx(xo, yo);
-			if (!g_monome_ws.grid_dirty[q]) continue;
+static bool emit_led(uint8_t kind, uint8_t x, uint8_t y)
+{
+	uint8_t level = g_monome_ws.grid_led[y * MONOME_WS_GRID_MAX_X + x];
+	uint8_t buf[4];
+	uint8_t len;
+	switch (kind) {
+	case GRID_TX_MEXT_LEVELS:
+		buf[0] = 0x18;
+		buf[1] = x;
+		buf[2] = y;
+		buf[3] = level;
+		len = 4;
+		break;
+	case GRID_TX_MEXT_BINARY:
+		buf[0] = (uint8_t)(0x10 | level_to_bit(level));
+		buf[1] = x;
+		buf[2] = y;
+		len = 3;
+		break;
+	default:
+		buf[0] = level_to_bit(level) ? 0x20 : 0x30;
+		buf[1] = (uint8_t)((x << 4) | (y & 0x0F));
+		len = 2;
+		break;
+	}
+	if (!tx_append(buf, len))
+		return false;
+	s_tx_cells[quad_idx(x, y)][y & 7] |= (uint8_t)(1u << (x & 7));
+	return true;
+}
+
+static bool emit_row(uint8_t kind, uint8_t xo, uint8_t y)
+{
+	uint8_t buf[7];
+	uint8_t len;
+	switch (kind) {
+	case GRID_TX_MEXT_LEVELS:
+		buf[0] = 0x1B;
+		buf[1] = xo;
+		buf[2] = y;
+		for (uint8_t i = 0; i < 4; i++)
+			buf[3 + i] = (uint8_t)((grid_level(xo + 2 * i, y) << 4) | grid_level(xo + 2 * i + 1, y));
+		len = 7;
+		break;
+	case GRID_TX_MEXT_BINARY:
+		buf[0] = 0x15;
+		buf[1] = xo;
+		buf[2] = y;
+		buf[3] = frame_row_mask(xo, y);
+		len = 4;
+		break;
+	case GRID_TX_SERIES:
+		buf[0] = (uint8_t)(0x40 | (y & 0x0F));
+		buf[1] = frame_row_mask(0, y);
+		len = 2;
+		break;
+	default:
+		buf[0] = (uint8_t)(0x70 | (y & 0x07));
+		buf[1] = frame_row_mask(0, y);
+		len = 2;
+		break;
+	}
+	if (!tx_append(buf, len))
+		return false;
+	s_tx_cells[quad_idx(xo, y)][y & 7] |= in_range_mask(xo, g_monome_ws.grid_x);
+	return true;
+}
+
+static bool emit_col(uint8_t kind, uint8_t x, uint8_t yo)
+{
+	uint8_t buf[7];
+	uint8_t len;
+	switch (kind) {
+	case GRID_TX_MEXT_LEVELS:
+		buf[0] = 0x1C;
+		buf[1] = x;
+		buf[2] = yo;
+		for (uint8_t i = 0; i < 4; i++)
+			buf[3 + i] = (uint8_t)((grid_level(x, yo + 2 * i) << 4) | grid_level(x, yo + 2 * i + 1));
+		len = 7;
+		break;
+	case GRID_TX_MEXT_BINARY:
+		buf[0] = 0x16;
+		buf[1] = x;
+		buf[2] = yo;
+		buf[3] = frame_col_mask(x, yo);
+		len = 4;
+		break;
+	default:
+		buf[0] = (uint8_t)(0x50 | (x & 0x0F));
+		buf[1] = frame_col_mask(x, 0);
+		len = 2;
+		break;
+	}
+	if (!tx_append(buf, len))
+		return false;
+	uint8_t q = quad_idx(x, yo);
+	uint8_t rows = in_range_mask(yo, g_monome_ws.grid_y);
+	for (uint8_t r = 0; r < 8; r++) {
+		if (rows & (1u << r))
+			s_tx_cells[q][r] |= (uint8_t)(1u << (x & 7));
+	}
+	return true;
+}
+
+static bool emit_quad(uint8_t kind, uint8_t xo, uint8_t yo)
+{
+	uint8_t q = quad_idx(xo, yo);
+	uint8_t buf[35];
+	uint8_t len;
+	switch (kind) {
+	case GRID_TX_MEXT_LEVELS: {
+		buf[0] = 0x1A;
+		buf[1] = xo;
+		buf[2] = yo;
+		uint8_t *p = buf + 3;
+		for (uint8_t r = 0; r < 8; r++) {
+			for (uint8_t c = 0; c < 8; c += 2)
+				*p++ = (uint8_t)((grid_level(xo + c, yo + r) << 4) | grid_level(xo + c + 1, yo + r));
+		}
+		len = 35;
+	} break;
+	case GRID_TX_MEXT_BINARY:
+		buf[0] = 0x14;
+		buf[1] = xo;
+		buf[2] = yo;
+		for (uint8_t r = 0; r < 8; r++)
+			buf[3 + r] = frame_row_mask(xo, yo + r);
+		len = 11;
+		break;
+	default:
+		buf[0] = (uint8_t)(0x80 | q);
+		for (uint8_t r = 0; r < 8; r++)
+			buf[1 + r] = frame_row_mask(xo, yo + r);
+		len = 9;
+		break;
+	}
+	if (!tx_append(buf, len))
+		return false;
+	uint8_t cols = in_range_mask(xo, g_monome_ws.grid_x);
+	uint8_t rows = in_range_mask(yo, g_monome_ws.grid_y);
+	for (uint8_t r = 0; r < 8; r++) {
+		if (rows & (1u << r))
+			s_tx_cells[q][r] |= cols;
+	}
+	return true;
+}
 
-			uint8_t buf[9];
-			buf[0] = (uint8_t)(0x80 | q);
-			for (uint8_t r = 0; r < 8; r++)
-				buf[1 + r] = frame_row_mask(xo, yo + r);
-			if (monome_ws_send_raw(buf, sizeof(buf)))
-				g_monome_ws.grid_dirty[q] = false;
+/* Bring one quad up to date with the fewest bytes: single LEDs, rows or
+ * columns when a playhead or a few cells moved, the whole quad past that. */
+static bool refresh_quad(uint8_t kind, uint8_t xo, uint8_t yo)
+{
+	uint8_t rows[8];
+	uint8_t cols[8];
+	if (!quad_changes(xo, yo, kind != GRID_TX_MEXT_LEVELS, rows, cols))
+		return true;
+
+	grid_tx_costs_t cost = s_grid_tx_costs[kind];
+	if (kind == GRID_TX_SERIES) {
+		/* Series row/column messages only cover x or y 0-7. */
+		if (xo) cost.row = 0;
+		if (yo) cost.col = 0;
+	}
+	uint32_t by_rows = lines_cost(rows, cost.led, cost.row);
+	uint32_t by_cols = lines_cost(cols, cost.led, cost.col);
+	uint32_t by_quad = cost.quad ? cost.quad : UINT32_MAX;
+	if (by_quad <= by_rows && by_quad <= by_cols)
+		return emit_quad(kind, xo, yo);
+
+	bool use_cols = by_cols < by_rows;
+	const uint8_t *masks = use_cols ? cols : rows;
+	uint8_t line = use_cols ? cost.col : cost.row;
+	for (uint8_t i = 0; i < 8; i++) {
+		uint8_t mask = masks[i];
+		if (!mask) continue;
+		uint32_t singles = cost.led ? (uint32_t)__builtin_popcount(mask) * cost.led : UINT32_MAX;
+		if (line && line < singles) {
+			bool sent = use_cols ? emit_col(kind, xo + i, yo) : emit_row(kind, xo, yo + i);
+			if (!sent)
+				return false;
+			continue;
+		}
+		for (uint8_t b = 0; b < 8; b++) {
+			if (!(mask & (1u << b))) continue;
+			uint8_t x = use_cols ? xo + i : xo + b;
+			uint8_t y = use_cols ? yo + b : yo + i;
+			if (!emit_led(kind, x, y))
+				return false;
 		}
 	}
+	return true;
 }
 
-static void refresh_40h_grid(void)
+static void refresh_grid(uint8_t kind)
 {
 	if (g_monome_ws.intensity_pending) {
-		uint8_t ibuf[2] = {0x30, g_monome_ws.grid_intensity};
-		monome_ws_send_raw(ibuf, sizeof(ibuf));
+		uint8_t ibuf[2] = {0x17, g_monome_ws.grid_intensity};
+		uint8_t ilen = 2;
+		if (kind == GRID_TX_SERIES) {
+			ibuf[0] = (uint8_t)(0xA0 | (g_monome_ws.grid_intensity & 0x0F));
+			ilen = 1;
+		} else if (kind == GRID_TX_40H) {
+			ibuf[0] = 0x30;
+		}
+		if (!tx_append(ibuf, ilen))
+			return;
 		g_monome_ws.intensity_pending = false;
+		s_tx_intensity = true;
 	}
 
-	if (!g_monome_ws.grid_dirty[0]) return;
-	for (uint8_t y = 0; y < 8; y++) {
-		uint8_t buf[2] = {(uint8_t)(0x70 | (y & 0x07)), frame_row_mask(0, y)};
-		if (!monome_ws_send_raw(buf, sizeof(buf)))
-			return;
+	for (uint8_t yo = 0; yo < g_monome_ws.grid_y; yo += 8) {
+		for (uint8_t xo = 0; xo < g_monome_ws.grid_x; xo += 8) {
+			uint8_t q = quad_idx(xo, yo);
+			if (!g_monome_ws.grid_dirty[q]) continue;
+			g_monome_ws.grid_dirty[q] = false;
+			if (!refresh_quad(kind, xo, yo)) {
+				g_monome_ws.grid_dirty[q] = true;
+				return;
+			}
+		}
 	}
-	g_monome_ws.grid_dirty[0] = false;
+	tx_flush();
 }
 
 void monome_ws_grid_refresh(void)
@@ -548,26 +850,25 @@ void monome_ws_grid_refresh(void)
 	if (!g_monome_ws.connected) return;
 	if (g_monome_ws.grid_x == 0 || g_monome_ws.grid_y == 0) return;
 
-	if (g_monome_ws.grid_frame_pending) {
-		bool dirty[4] = { false, false, false, false };
-		for (uint8_t y = 0; y < g_monome_ws.grid_y; y++) {
-			for (uint8_t x = 0; x < g_monome_ws.grid_x; x++) {
-				uint16_t idx = (uint16_t)y * MONOME_WS_GRID_MAX_X + x;
-				if (g_monome_ws.grid_led[idx] != g_monome_ws.grid_next[idx])
-					dirty[quad_idx(x, y)] = true;
-			}
-		}
+	uint32_t seq = g_monome_ws.grid_next_seq;
+	if (seq != g_monome_ws.grid_next_taken && !(seq & 1u)) {
+		__dmb();
 		for (uint8_t y = 0; y < g_monome_ws.grid_y; y++) {
 			for (uint8_t x = 0; x < g_monome_ws.grid_x; x++) {
-				uint8_t q = quad_idx(x, y);
-				if (!dirty[q]) continue;
 				uint16_t idx = (uint16_t)y * MONOME_WS_GRID_MAX_X + x;
-				g_monome_ws.grid_led[idx] = g_monome_ws.grid_next[idx];
+				uint8_t level = g_monome_ws.grid_next[idx];
+				if (g_monome_ws.grid_led[idx] != level) {
+					g_monome_ws.grid_led[idx] = level;
+					g_monome_ws.grid_dirty[quad_idx(x, y)] = true;
+				}
 			}
 		}
-		for (int q = 0; q < 4; q++) g_monome_ws.grid_dirty[q] |= dirty[q];
 		__dmb();
-		g_monome_ws.grid_frame_pending = false;
+		/* A newer frame landed mid-copy: take that one next time round
+		 * rather than send a mix of the two. */
+		if (g_monome_ws.grid_next_seq != seq)
+			return;
+		g_monome_ws.grid_next_taken = seq;
 	}
 
 	uint64_t now_us = time_us_64();
@@ -578,6 +879,7 @@ void monome_ws_grid_refresh(void)
 
 	if (g_monome_ws.force_refresh_until_us != 0 && now_us >= g_monome_ws.next_force_refresh_us) {
 		if (now_us <= g_monome_ws.force_refresh_until_us) {
+			memset(g_monome_ws.grid_shadow, 0xFF, sizeof(g_monome_ws.grid_shadow));
 			for (uint8_t yo = 0; yo < g_monome_ws.grid_y; yo += 8) {
 				for (uint8_t xo = 0; xo < g_monome_ws.grid_x; xo += 8)
 					g_monome_ws.grid_dirty[quad_idx(xo, yo)] = true;
@@ -590,24 +892,17 @@ void monome_ws_grid_refresh(void)
 
 	switch (g_monome_ws.protocol) {
 	case MONOME_WS_PROTOCOL_SERIES:
-		refresh_series_grid();
+		refresh_grid(GRID_TX_SERIES);
 		break;
 	case MONOME_WS_PROTOCOL_40H:
-		refresh_40h_grid();
+		refresh_grid(GRID_TX_40H);
 		break;
 	case MONOME_WS_PROTOCOL_MEXT:
-#if MONOME_WS_FORCE_8X8_MONOBRIGHT
-		if (g_monome_ws.supports_levels)
-			refresh_mext_grid();
-		else
-			refresh_mext_binary_grid();
-#else
-		refresh_mext_grid();
-#endif
+		refresh_grid(g_monome_ws.supports_levels ? GRID_TX_MEXT_LEVELS : GRID_TX_MEXT_BINARY);
 		break;
 	case MONOME_WS_PROTOCOL_UNKNOWN:
 	default:
-		refresh_mext_grid();
+		refresh_grid(GRID_TX_MEXT_LEVELS);
 		break;
 	}
 }
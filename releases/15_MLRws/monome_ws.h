@@ -80,11 +80,19 @@ typedef struct {
 	uint8_t           grid_y;
 	uint8_t           grid_led[MONOME_WS_GRID_MAX_X * MONOME_WS_GRID_MAX_Y];
 	uint8_t           grid_next[MONOME_WS_GRID_MAX_X * MONOME_WS_GRID_MAX_Y];
+	/* Levels the device is showing, as far as the driver knows; 0xFF = unknown. */
+	uint8_t           grid_shadow[MONOME_WS_GRID_MAX_X * MONOME_WS_GRID_MAX_Y];
 	bool              grid_dirty[4];
-	volatile bool     grid_frame_pending;
+	/* grid_next seqlock: odd while the app writes it; the frame is pending
+	 * until the refresh has taken that sequence number. */
+	volatile uint32_t grid_next_seq;
+	volatile uint32_t grid_next_taken;
 	uint8_t           grid_intensity;
 	bool              intensity_pending;
 
+	uint32_t          grid_tx_bytes;
+	uint32_t          grid_frames_coalesced;
+
 	uint8_t           arc_enc_count;
 	uint8_t           arc_ring[MONOME_WS_ARC_MAX_ENCODERS][MONOME_WS_ARC_RING_LEDS];
 	bool              arc_refresh_pending;
@@ -0,0 +1,333 @@
+// tuning_report — how well Resonator's strings hold pitch, and what they cost, on Linux.
+//
+// Builds ../karplus.h and ../delay_table.h as the firmware does, against the strings
+// before them (REF: ref/strings.h; linear interpolation, one division per string per
+// sample), compiled in namespace ref. Reports:
+//
+//   tuning   the four strings of a chord, plucked with an impulse once their glide has
+//            settled, across the pitch range: the resonance found in a zero-padded FFT
+//            of the ring against the pitch asked for, in cents (the largest of the
+//            four). With Y at full and at a quarter, and after a glide from a fifth
+//            below
+//   cost     ns and host TSC cycles per string per sample: REF's per-sample strings,
+//            the core 0 strings now (tick(), control every KS_BLOCK) and core 1's
+//            (StringSet::render() in blocks), with pitch held and sweeping
+//
+// Best of five passes. Host figures are only relative (x86, not a Cortex-M0+): compare
+// the rows.
+//
+//   ./tuning_report
+#include "delay_table.h"
+#include "karplus.h"
+
+namespace ref {
+#include "ref/strings.h"
+}
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC 1
+#else
+#define HAVE_TSC 0
+#endif
+
+namespace {
+
+constexpr double Fs = 48000.0;
+constexpr int Record = 1 << 16;   // samples of ring after the pluck
+constexpr int FftN = 1 << 18;
+constexpr int MinPeriod = 15;     // both trees
+constexpr int MaxBase = 1468;
+
+struct Chord {
+    const char* name;
+    int num[4];
+    int den[4];
+};
+const Chord Chords[] = {
+    {"HARMONIC", {1, 2, 3, 4}, {1, 1, 1, 1}},
+    {"MAJOR7", {1, 5, 3, 15}, {1, 4, 2, 8}},
+};
+
+int32_t dampingCoeff(int knob)
+{
+    return 32000 + ((knob * 33300) / 4095);
+}
+
+// The table's delay at pitchCV, unrounded
+double basePeriod(int pitchCV)
+{
+    const double d = delay_vals[pitchCV % 341] / std::ldexp(1.0, pitchCV / 341);
+    return std::min(std::max(d, (double)MinPeriod), (double)MaxBase);
+}
+
+// REF's four strings, as its ProcessSample ran them
+struct RefStrings {
+    ref::Strings dsp;
+    int16_t line[4][ref::Strings::MAX_DELAY_SIZE] = {};
+    int write[4] = {};
+    int32_t filter[4] = {}, dc[4] = {}, smooth[4] = {};
+    int num[4], den[4];
+
+    explicit RefStrings(const Chord& c)
+    {
+        for (int k = 0; k < 4; ++k) {
+            num[k] = c.num[k];
+            den[k] = c.den[k];
+        }
+    }
+
+    // The period each string is set to: REF clamps short strings
+    static double setPeriod(double period) { return std::max(period, (double)MinPeriod); }
+
+    void sample(int pitchCV, int32_t coeff, const int32_t* excite, int32_t* out)
+    {
+        int32_t baseDelay = ref::ExpDelay(pitchCV);
+        baseDelay = std::min(std::max(baseDelay, (int32_t)MinPeriod), (int32_t)MaxBase);
+        for (int k = 0; k < 4; ++k) {
+            const int32_t target = ((baseDelay * den[k]) << 8) / num[k];
+            if (smooth[k] == 0) smooth[k] = target;
+            smooth[k] += ((target - smooth[k]) * 2) >> 8;
+            int length = smooth[k] >> 8;
+            const int32_t frac = smooth[k] & 0xFF;
+            length = std::min(std::max(length, MinPeriod), ref::Strings::MAX_DELAY_SIZE - 1);
+            out[k] = dsp.processString(line[k], write[k], length, filter[k], dc[k], excite[k],
+                coeff, frac);
+        }
+    }
+};
+
+// The core 0 strings now
+struct NewStrings {
+    StringSet set;
+    int pos = 0;
+
+    explicit NewStrings(const Chord& c) { set.setRatios(c.num, c.den); }
+
+    // Strings too short for the delay line fold down an octave
+    static double setPeriod(double period)
+    {
+        while (period < MinPeriod) period *= 2;
+        return period;
+    }
+
+    void sample(int pitchCV, int32_t coeff, const int32_t* excite, int32_t* out)
+    {
+        if (pos == 0) {
+            int32_t base = ExpDelayQ8(pitchCV);
+            base = std::min(std::max(base, (int32_t)MinPeriod << 8), (int32_t)MaxBase << 8);
+            set.control(base, coeff);
+        }
+        pos = (pos + 1) % KS_BLOCK;
+        for (int k = 0; k < 4; ++k) out[k] = set.s[k].tick(excite[k]);
+    }
+};
+
+void fft(std::vector<std::complex<double>>& a)
+{
+    const size_t n = a.size();
+    for (size_t i = 1, j = 0; i < n; ++i) {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+        if (i < j) std::swap(a[i], a[j]);
+    }
+    for (size_t len = 2; len <= n; len <<= 1) {
+        const double ang = -2.0 * M_PI / (double)len;
+        const std::complex<double> wl(std::cos(ang), std::sin(ang));
+        for (size_t i = 0; i < n; i += len) {
+            std::complex<double> w(1.0);
+            for (size_t k = 0; k < len / 2; ++k) {
+                const std::complex<double> u = a[i + k], v = a[i + k + len / 2] * w;
+                a[i + k] = u + v;
+                a[i + k + len / 2] = u - v;
+                w *= wl;
+            }
+        }
+    }
+}
+
+// The strongest resonance within 400 cents of `hz`, interpolated. Only the ring down to
+// -40 dB is analysed (with a half-cosine taper): the integer strings end in low-level
+// limit cycles that would otherwise outweigh a short decay.
+double resonance(const std::vector<int32_t>& x, double hz)
+{
+    int32_t peakLevel = 0;
+    for (int32_t v : x) peakLevel = std::max(peakLevel, std::abs(v));
+    int length = 4096;
+    for (int i = 0; i < Record; ++i)
+        if (std::abs(x[i]) * 100 > peakLevel) length = std::max(length, i + 1);
+
+    std::vector<std::complex<double>> a(FftN);
+    for (int i = 0; i < length; ++i)
+        a[i] = x[i] * (0.5 + 0.5 * std::cos(M_PI * i / length));
+    fft(a);
+    const double bin = Fs / FftN;
+    const int lo = std::max(2, (int)(hz * std::pow(2.0, -400 / 1200.0) / bin));
+    const int hi = std::min(FftN / 2 - 2, (int)(hz * std::pow(2.0, 400 / 1200.0) / bin));
+    int peak = lo;
+    for (int i = lo; i <= hi; ++i)
+        if (std::norm(a[i]) > std::norm(a[peak])) peak = i;
+    const double l = std::log(std::norm(a[peak - 1]) + 1e-30);
+    const double c = std::log(std::norm(a[peak]) + 1e-30);
+    const double r = std::log(std::norm(a[peak + 1]) + 1e-30);
+    const double den = l - 2 * c + r;
+    const double delta = den != 0 ? 0.5 * (l - r) / den : 0.0;
+    return (peak + delta) * bin;
+}
+
+// Pluck the four strings once they have settled at pitchCV (gliding from fromCV),
+// and return the worst error in cents, signed
+template <typename Strings>
+double worstCents(const Chord& chord, int fromCV, int pitchCV, int knob)
+{
+    auto s = std::make_unique<Strings>(chord);
+    const int32_t coeff = dampingCoeff(knob);
+    const int32_t silent[4] = {0, 0, 0, 0};
+    int32_t out[4];
+    for (int i = 0; i < 4800; ++i) s->sample(fromCV, coeff, silent, out);
+    for (int i = 0; i < 3 * 48000; ++i) s->sample(pitchCV, coeff, silent, out);
+
+    std::vector<int32_t> rec[4];
+    for (auto& r : rec) r.resize(Record);
+    const int32_t pluck[4] = {2000, 2000, 2000, 2000};
+    for (int i = 0; i < Record; ++i) {
+        s->sample(pitchCV, coeff, i == 0 ? pluck : silent, out);
+        for (int k = 0; k < 4; ++k) rec[k][i] = out[k];
+    }
+
+    double worst = 0;
+    for (int k = 0; k < 4; ++k) {
+        const double asked = basePeriod(pitchCV) * chord.den[k] / chord.num[k];
+        const double set = Strings::setPeriod(asked);
+        // Now: in tune with the octave it folded to. REF: against the pitch asked for.
+        const double intended = std::is_same<Strings, NewStrings>::value ? set : asked;
+        const double hz = resonance(rec[k], Fs / set);
+        const double cents = 1200 * std::log2(hz / (Fs / intended));
+        if (std::fabs(cents) > std::fabs(worst)) worst = cents;
+    }
+    return worst;
+}
+
+void tuningTable(const char* title, int knob, int fromOffset)
+{
+    std::printf("\n%s\n%-10s", title, "base Hz");
+    for (const Chord& c : Chords) std::printf(" %10s REF %8s now", c.name, "");
+    std::printf("\n");
+    for (int cv : {2048, 2389, 2730, 3071, 3412, 3753, 4091}) {
+        std::printf("%-10.1f", Fs / basePeriod(cv));
+        for (const Chord& c : Chords) {
+            const int from = std::max(2048, cv - fromOffset);
+            std::printf(" %14.2f %12.2f", worstCents<RefStrings>(c, from, cv, knob),
+                worstCents<NewStrings>(c, from, cv, knob));
+        }
+        std::printf("\n");
+    }
+}
+
+struct Cost {
+    double ns;
+    double cycles;
+};
+
+template <typename Run>
+Cost measure(Run run, int samples)
+{
+    double best = 1e30, bestCycles = 1e30;
+    for (int pass = 0; pass < 5; ++pass) {
+        const auto t0 = std::chrono::steady_clock::now();
+#if HAVE_TSC
+        const uint64_t c0 = __rdtsc();
+#endif
+        run();
+#if HAVE_TSC
+        bestCycles = std::min(bestCycles, (double)(__rdtsc() - c0) / samples / 4);
+#endif
+        const auto t1 = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::nano>(t1 - t0).count() / samples / 4);
+    }
+    return {best, HAVE_TSC ? bestCycles : 0.0};
+}
+
+int16_t noise(int i)
+{
+    uint32_t h = (uint32_t)i * 2654435761u;
+    h ^= h >> 15;
+    return (int16_t)((int32_t)((h >> 8) & 511) - 256);
+}
+
+void costRows(bool sweep)
+{
+    constexpr int Samples = 48000;
+    const int32_t coeff = dampingCoeff(3500);
+    auto cvAt = [&](int i) { return sweep ? 2048 + (i / 48) % 1500 : 3071; };
+    volatile int32_t sink = 0;
+
+    auto refS = std::make_unique<RefStrings>(Chords[1]);
+    const Cost a = measure([&] {
+        int32_t acc = 0, out[4];
+        for (int i = 0; i < Samples; ++i) {
+            const int32_t e = noise(i);
+            const int32_t ex[4] = {e, e >> 2, e >> 2, e >> 1};
+            refS->sample(cvAt(i), coeff, ex, out);
+            acc += out[0] ^ out[3];
+        }
+        sink = acc;
+    }, Samples);
+
+    auto newS = std::make_unique<NewStrings>(Chords[1]);
+    const Cost b = measure([&] {
+        int32_t acc = 0, out[4];
+        for (int i = 0; i < Samples; ++i) {
+            const int32_t e = noise(i);
+            const int32_t ex[4] = {e, e >> 2, e >> 2, e >> 1};
+            newS->sample(cvAt(i), coeff, ex, out);
+            acc += out[0] ^ out[3];
+        }
+        sink = acc;
+    }, Samples);
+
+    auto upper = std::make_unique<StringSet>();
+    upper->setRatios(Chords[1].num, Chords[1].den);
+    const Cost c = measure([&] {
+        int16_t ex[KS_BLOCK], mid[KS_BLOCK], side[KS_BLOCK];
+        int32_t acc = 0;
+        for (int i = 0; i < Samples; i += KS_BLOCK) {
+            for (int j = 0; j < KS_BLOCK; ++j) ex[j] = noise(i + j) >> 2;
+            upper->control(ExpDelayQ8(cvAt(i)), coeff);
+            upper->render(ex, mid, side, KS_BLOCK);
+            acc += mid[0] ^ side[KS_BLOCK - 1];
+        }
+        sink = acc;
+    }, Samples);
+    (void)sink;
+
+    std::printf("%-16s %8.2f %8.1f  %8.2f %8.1f  %8.2f %8.1f\n", sweep ? "pitch sweeping" : "pitch held",
+        a.ns, a.cycles, b.ns, b.cycles, c.ns, c.cycles);
+}
+
+} // namespace
+
+int main()
+{
+    std::printf("tuning: the chord's worst string, cents\n");
+    tuningTable("settled, Y full (long decay)", 4095, 0);
+    tuningTable("settled, Y at a quarter (short decay)", 1024, 0);
+    tuningTable("after a glide from a fifth below, Y full", 4095, 200);
+
+    std::printf("\n%-16s %17s  %17s  %17s\n", "per string", "REF per sample", "now, core 0",
+        "now, core 1 blocks");
+    std::printf("%-16s %8s %8s  %8s %8s  %8s %8s\n", "per sample", "ns", "cycles", "ns", "cycles",
+        "ns", "cycles");
+    costRows(false);
+    costRows(true);
+    return 0;
+}
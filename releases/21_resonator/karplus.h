@@ -0,0 +1,198 @@
+#ifndef KARPLUS_H
+#define KARPLUS_H
+
+#include <cstdint>
+#include <cmath>
+
+// Karplus-Strong strings with allpass-tuned loops
+//
+// Each string is a delay line, a first-order (Thiran) allpass for the
+// fractional part of the period, the damping one-pole and a DC blocker.
+// The allpass replaces linear interpolation, which low-passed the loop
+// and detuned short strings. retune() also takes the damping filter's
+// and DC blocker's phase delay at the fundamental out of the delay line,
+// so the whole loop is one period long and the string sounds at the
+// pitch asked for.
+//
+// The DC blocker keeps its state in Q12 with its corner at 2 Hz. The old
+// one (corner 30 Hz, state truncated to whole LSBs) behaved differently
+// at every level, so its phase couldn't be compensated, and it led the
+// lowest strings by over 100 cents when driven hard.
+//
+// tick() is the per-sample work. Gliding and retuning run once per
+// KS_BLOCK samples from StringSet::control().
+
+static constexpr int KS_MAX_DELAY = 1920;
+static constexpr int KS_MIN_PERIOD = 15;        // shorter strings fold down an octave
+static constexpr int KS_BLOCK = 16;             // control block, and core 1's render block
+static constexpr int KS_DC_SHIFT = 12;          // DC blocker pole at 1 - 2^-12
+
+struct KsString
+{
+    int16_t line[KS_MAX_DELAY];
+    int write = 0;
+    int length = 100;       // whole samples of delay line
+    int32_t apCoeff = 0;    // allpass a, Q15
+    int32_t apX = 0;        // allpass state, 12-bit audio << 4
+    int32_t apY = 0;
+    int32_t lpState = 0;    // damping one-pole
+    int32_t lpCoeff = 65300;
+    int32_t dcAcc = 0;      // DC estimate, Q12
+
+    int32_t periodQ16 = 0;      // gliding period, samples
+    int32_t tunedPeriodQ16 = -1; // what the loop was last tuned for
+    int32_t tunedCoeff = -1;
+
+    void clear()
+    {
+        for (int i = 0; i < KS_MAX_DELAY; i++) line[i] = 0;
+        apX = apY = lpState = dcAcc = 0;
+    }
+
+    // One sample: excitation in, the delayed (pre-damping) string out
+    inline int32_t tick(int32_t excitation)
+    {
+        int read = write - length;
+        if (read < 0) read += KS_MAX_DELAY;
+
+        // Thiran allpass: y = a (x - y[-1]) + x[-1]
+        int32_t x = (int32_t)line[read] << 4;
+        int32_t y = ((apCoeff * (x - apY)) >> 15) + apX;
+        apX = x;
+        apY = y;
+        int32_t delayedSample = (y + 8) >> 4;
+
+        // One-pole lowpass for damping
+        lpState += (((delayedSample - lpState) * lpCoeff + 32768) >> 16);
+        int32_t dampedSample = lpState;
+
+        // DC blocker: remove DC offset to prevent accumulation
+        dcAcc += dampedSample - (dcAcc >> KS_DC_SHIFT);
+        dampedSample -= dcAcc >> KS_DC_SHIFT;
+
+        int32_t newSample = dampedSample + excitation;
+        if (newSample > 2047) newSample = 2047;
+        if (newSample < -2047) newSample = -2047;
+
+        line[write] = (int16_t)newSample;
+        if (++write == KS_MAX_DELAY) write = 0;
+
+        return delayedSample;
+    }
+
+    // Tune the loop to periodQ16 / 65536 samples with the damping one-pole
+    // at coeff (Q16). Float, at control rate only.
+    void retune(int32_t pQ16, int32_t coeff)
+    {
+        tunedPeriodQ16 = pQ16;
+        tunedCoeff = coeff;
+        lpCoeff = coeff;
+
+        const float period = pQ16 * (1.0f / 65536.0f);
+        const float w = 6.2831853f / period;
+        const float sw = sinf(w), cw = cosf(w);
+
+        // Phase delay at w of the one-pole (pole at 1 - k) ...
+        const float b = 1.0f - coeff * (1.0f / 65536.0f);
+        const float lp = atan2f(b * sw, 1.0f - b * cw) / w;
+        // ... and of the DC blocker, (1 - c)(1 - z^-1) / (1 - (1 - c) z^-1),
+        // c = 2^-KS_DC_SHIFT, which leads
+        const float r = 1.0f - 1.0f / (1 << KS_DC_SHIFT);
+        const float dc = -(1.5707963f - 0.5f * w - atan2f(r * sw, 1.0f - r * cw)) / w;
+        const float rest = period - lp - dc;
+
+        // Whole samples to the delay line and 0.5-1.5 to the allpass; a
+        // length is kept while its fraction stays in 0.3-1.7, so CV noise
+        // at a boundary doesn't step the read point back and forth
+        int n = length;
+        float frac = rest - n;
+        if (frac < 0.3f || frac > 1.7f)
+        {
+            n = (int)(rest - 0.5f);
+            if (n < 1) n = 1;
+            if (n > KS_MAX_DELAY - 1) n = KS_MAX_DELAY - 1;
+            frac = rest - n;
+            if (frac < 0.3f) frac = 0.3f;
+            if (frac > 1.7f) frac = 1.7f;
+        }
+        length = n;
+
+        // The allpass coefficient whose phase delay at w is exactly frac
+        // ((1 - d) / (1 + d) is the same at DC)
+        const float a = sinf(0.5f * w * (1.0f - frac)) / sinf(0.5f * w * (1.0f + frac));
+        apCoeff = (int32_t)lrintf(a * 32768.0f);
+    }
+};
+
+// Four strings tuned as a chord over one base period
+struct StringSet
+{
+    static constexpr int N = 4;
+
+    KsString s[N];
+    int32_t recipQ16[N];   // den / num of each string's ratio, set on chord change
+    int next = 0;          // string retuned next
+
+    StringSet()
+    {
+        for (int i = 0; i < N; i++) recipQ16[i] = 65536;
+        clear();
+    }
+
+    void clear()
+    {
+        for (int i = 0; i < N; i++) s[i].clear();
+    }
+
+    // Chord change: the divisions happen here, not every sample
+    void setRatios(const int* num, const int* den)
+    {
+        for (int i = 0; i < N; i++) recipQ16[i] = (den[i] << 16) / num[i];
+    }
+
+    // Once per KS_BLOCK: glide every string toward base (Q8 samples) over
+    // its ratio, and retune one of them if its period or the damping moved
+    void control(int32_t baseQ8, int32_t coeff)
+    {
+        for (int i = 0; i < N; i++)
+        {
+            int32_t target = (int32_t)((int64_t)baseQ8 * recipQ16[i] >> 8);
+            while (target < (KS_MIN_PERIOD << 16)) target <<= 1;
+
+            // Initialize on the first block; then the per-sample 2/256
+            // glide of a block, ~2 seconds
+            if (s[i].periodQ16 == 0) s[i].periodQ16 = target;
+            s[i].periodQ16 += (target - s[i].periodQ16) >> 3;
+        }
+
+        KsString& k = s[next];
+        if (k.periodQ16 != k.tunedPeriodQ16 || coeff != k.tunedCoeff)
+            k.retune(k.periodQ16, coeff);
+        next = (next + 1 == N) ? 0 : next + 1;
+    }
+
+    // n samples of every string on the same excitation: mid gets the sum,
+    // side the strings panned alternately
+    void render(const int16_t* excitation, int16_t* mid, int16_t* side, int n)
+    {
+        int32_t m[KS_BLOCK], d[KS_BLOCK];
+        for (int i = 0; i < n; i++) m[i] = d[i] = 0;
+        for (int k = 0; k < N; k++)
+        {
+            KsString& str = s[k];
+            for (int i = 0; i < n; i++)
+            {
+                int32_t o = str.tick(excitation[i]);
+                m[i] += o;
+                d[i] += (k & 1) ? o : -o;
+            }
+        }
+        for (int i = 0; i < n; i++)
+        {
+            mid[i] = (int16_t)m[i];
+            side[i] = (int16_t)d[i];
+        }
+    }
+};
+
+#endif // KARPLUS_H
@@ -3,6 +3,9 @@
 #include "pico/multicore.h"
 #include "hardware/flash.h"
 #include "hardware/sync.h"
+#include "delay_table.h"
+#include "karplus.h"
+#include "string_blocks.h"
 #include <cstring>
 #include <cstdio>
 
@@ -10,93 +13,30 @@
 // Use last sector of flash (4KB before end of 2MB)
 #define FLASH_PROG_OFFSET (PICO_FLASH_SIZE_BYTES - FLASH_SECTOR_SIZE)
 #define FLASH_PROG_MAGIC 0xAB
+#define FLASH_STRINGS_BYTE (2 + 18)  // after the longest progression
 
 /**
 Resonator Workshop System Computer Card - by Johan Eklund
 version 1.1.1 - 2026-02-18
 
-Four resonating strings using Karplus-Strong synthesis
+Four resonating strings using Karplus-Strong synthesis, or eight with the
+upper four rendered on core 1
 */
 
-// Delay lookup table for 1V/oct pitch control
-// 341 entries per octave, inverse exponential curve
-// Base: C1 = 32.7Hz at 48kHz = 1468 samples, scaled by 64
-// Higher input = shorter delay = higher pitch
-// Formula: delay_vals[i] = 93952 / 2^(i/341)
-// Ratio across table = 2.0 (one octave)
-static const uint32_t delay_vals[341] = {
-    93952, 93761, 93571, 93381, 93191, 93002, 92813, 92625, 92437, 92249,
-    92062, 91875, 91688, 91502, 91316, 91131, 90946, 90761, 90577, 90393,
-    90209, 90026, 89843, 89661, 89479, 89297, 89116, 88935, 88754, 88574,
-    88394, 88214, 88035, 87857, 87678, 87500, 87322, 87145, 86968, 86792,
-    86615, 86439, 86264, 86089, 85914, 85739, 85565, 85392, 85218, 85045,
-    84872, 84700, 84528, 84356, 84185, 84014, 83844, 83673, 83503, 83334,
-    83165, 82996, 82827, 82659, 82491, 82324, 82157, 81990, 81823, 81657,
-    81491, 81326, 81161, 80996, 80831, 80667, 80503, 80340, 80177, 80014,
-    79852, 79689, 79528, 79366, 79205, 79044, 78884, 78723, 78564, 78404,
-    78245, 78086, 77927, 77769, 77611, 77454, 77296, 77139, 76983, 76826,
-    76670, 76515, 76359, 76204, 76049, 75895, 75741, 75587, 75434, 75280,
-    75128, 74975, 74823, 74671, 74519, 74368, 74217, 74066, 73916, 73766,
-    73616, 73466, 73317, 73168, 73020, 72872, 72724, 72576, 72428, 72281,
-    72135, 71988, 71842, 71696, 71551, 71405, 71260, 71116, 70971, 70827,
-    70683, 70540, 70396, 70253, 70111, 69968, 69826, 69685, 69543, 69402,
-    69261, 69120, 68980, 68840, 68700, 68561, 68421, 68282, 68144, 68005,
-    67867, 67729, 67592, 67455, 67318, 67181, 67045, 66908, 66773, 66637,
-    66502, 66367, 66232, 66097, 65963, 65829, 65696, 65562, 65429, 65296,
-    65164, 65031, 64899, 64767, 64636, 64505, 64374, 64243, 64112, 63982,
-    63852, 63723, 63593, 63464, 63335, 63207, 63078, 62950, 62822, 62695,
-    62568, 62440, 62314, 62187, 62061, 61935, 61809, 61684, 61558, 61433,
-    61309, 61184, 61060, 60936, 60812, 60689, 60565, 60442, 60320, 60197,
-    60075, 59953, 59831, 59710, 59588, 59467, 59347, 59226, 59106, 58986,
-    58866, 58747, 58627, 58508, 58389, 58271, 58153, 58034, 57917, 57799,
-    57682, 57564, 57448, 57331, 57215, 57098, 56982, 56867, 56751, 56636,
-    56521, 56406, 56292, 56177, 56063, 55949, 55836, 55722, 55609, 55496,
-    55384, 55271, 55159, 55047, 54935, 54824, 54712, 54601, 54490, 54380,
-    54269, 54159, 54049, 53939, 53830, 53720, 53611, 53503, 53394, 53285,
-    53177, 53069, 52962, 52854, 52747, 52640, 52533, 52426, 52320, 52213,
-    52107, 52001, 51896, 51790, 51685, 51580, 51476, 51371, 51267, 51163,
-    51059, 50955, 50852, 50748, 50645, 50542, 50440, 50337, 50235, 50133,
-    50031, 49930, 49828, 49727, 49626, 49525, 49425, 49325, 49224, 49124,
-    49025, 48925, 48826, 48727, 48628, 48529, 48430, 48332, 48234, 48136,
-    48038, 47941, 47843, 47746, 47649, 47552, 47456, 47360, 47263, 47167,
-    47072
-};
-
-// Exponential delay lookup for 1V/oct pitch control
-// in: 0-4095 (knob + CV combined)
-// Returns delay in samples (right-shifted by octave)
-int32_t ExpDelay(int32_t in) {
-    if (in < 0) in = 0;
-    if (in > 4091) in = 4091;
-    int32_t oct = in / 341;
-    int32_t suboct = in % 341;
-    return delay_vals[suboct] >> oct;
-}
-
 class ResonatingStrings : public ComputerCard
 {
 private:
-    static const int MAX_DELAY_SIZE = 1920;
-
-    int16_t delayLine1[MAX_DELAY_SIZE];
-    int16_t delayLine2[MAX_DELAY_SIZE];
-    int16_t delayLine3[MAX_DELAY_SIZE];
-    int16_t delayLine4[MAX_DELAY_SIZE];
-
-    int writeIndex1;
-    int writeIndex2;
-    int writeIndex3;
-    int writeIndex4;
-
-    int delayLength1;
-    int delayLength2;
-    int delayLength3;
-    int delayLength4;
-
-    int32_t filterState1;
-    int32_t filterState2;
-    int32_t filterState3;
-    int32_t filterState4;
+    // Strings 1-4, on core 0
+    StringSet strings;
+    int blockPos;
+
+    // Strings 5-8, on core 1: each string of the chord doubled an octave up
+    // (as the courses of a twelve-string). Core 0 only touches the ring.
+    StringRing ring;
+    StringSet upperStrings;
+    uint32_t upperNext;
+    bool upperActive;
+    int upperMode;
 
     // Chord modes
     enum ChordMode {
@@ -121,6 +61,7 @@ private:
     };
     static const int NUM_MODES = 18;
     ChordMode currentMode;
+    int tunedMode;          // chord the strings' ratios were last set for (-1: none yet)
 
     // Double-buffered progression for lock-free Core0/Core1 sharing
     static const int MAX_PROGRESSION_LENGTH = 18;
@@ -132,6 +73,7 @@ private:
     ProgressionBuffer progressionBuffers[2];
     volatile bool progressionChanged;
     volatile bool pendingFlashSave;  // Flag for Core 1 to save flash (Core 0 can't lock out Core 1)
+    volatile bool eightStrings;      // Set over serial (STRINGS 8), persisted with the progression
     int progressionIndex;
 
     bool lastSwitchDown;
@@ -139,190 +81,136 @@ private:
     int32_t pulseExciteEnvelope;
     uint32_t noiseState;
 
-    int32_t dcState1, dcState2, dcState3, dcState4;
-
-    // Smoothed delay values for glide between chord modes (fixed-point, 8 bits fraction)
-    int32_t smoothDelay1, smoothDelay2, smoothDelay3, smoothDelay4;
-
     // Long-press reset detection
     uint32_t switchDownCounter;
     bool resetTriggered;
     static const uint32_t RESET_HOLD_SAMPLES = 144000;  // 3 seconds at 48kHz
 
-    // One-pole lowpass filter for damping
-    int32_t dampingFilter(int32_t input, int32_t& state, int32_t coefficient) {
-        state += (((input - state) * coefficient + 32768) >> 16);
-        return state;
-    }
-
-    // Process one string with linear interpolation for fractional delay
-    int32_t processString(int16_t* delayLine, int& writeIndex, int delayLength,
-                         int32_t& filterState, int32_t& dcState, int32_t excitation,
-                         int32_t dampingCoeff, int32_t frac) {
-        // Read two adjacent samples from delay line
-        int readIndex1 = writeIndex - delayLength;
-        if (readIndex1 < 0) readIndex1 += MAX_DELAY_SIZE;
-        int readIndex2 = readIndex1 - 1;
-        if (readIndex2 < 0) readIndex2 += MAX_DELAY_SIZE;
-
-        int32_t sample1 = delayLine[readIndex1];
-        int32_t sample2 = delayLine[readIndex2];
-
-        // Linear interpolation: blend based on fractional part (frac is 0-255)
-        int32_t delayedSample = ((sample1 * (256 - frac)) + (sample2 * frac)) >> 8;
-
-        int32_t dampedSample = dampingFilter(delayedSample, filterState, dampingCoeff);
-
-        // DC blocker: remove DC offset to prevent accumulation
-        dcState += (dampedSample - dcState) >> 8;
-        dampedSample -= dcState;
-
-        // Add excitation (input signal)
-        int32_t newSample = dampedSample + excitation;
-
-        // Soft clipping to prevent overflow
-        if (newSample > 2047) newSample = 2047;
-        if (newSample < -2047) newSample = -2047;
-
-        // Write back to delay line
-        delayLine[writeIndex] = (int16_t)newSample;
-
-        // Advance write index
-        writeIndex = (writeIndex + 1) % MAX_DELAY_SIZE;
-
-        return delayedSample;
-    }
-
-    // Calculate frequency ratio based on chord mode and string number
-    // Using fixed-point math to avoid floating-point on Cortex-M0+
-    // Returns numerator and denominator for each ratio
-    void getFrequencyRatios(int& num1, int& den1, int& num2, int& den2,
-                            int& num3, int& den3, int& num4, int& den4) {
+    // Frequency ratio of each string for a chord mode, as numerator and
+    // denominator. Only read on a chord change (StringSet::setRatios).
+    static void getFrequencyRatios(ChordMode mode, int* num, int* den) {
         // String 1: Fundamental
-        num1 = 1;
-        den1 = 1;
+        num[0] = 1;
+        den[0] = 1;
 
-        switch (currentMode) {
+        switch (mode) {
             case HARMONIC:
                 // Harmonic series: 1:1, 2:1, 3:1, 4:1
-                num2 = 2; den2 = 1;
-                num3 = 3; den3 = 1;
-                num4 = 4; den4 = 1;
+                num[1] = 2; den[1] = 1;
+                num[2] = 3; den[2] = 1;
+                num[3] = 4; den[3] = 1;
                 break;
             case FIFTH:
                 // Stacked fifths: 1:1, 3:2, 2:1, 3:1
-                num2 = 3; den2 = 2;
-                num3 = 2; den3 = 1;
-                num4 = 3; den4 = 1;
+                num[1] = 3; den[1] = 2;
+                num[2] = 2; den[2] = 1;
+                num[3] = 3; den[3] = 1;
                 break;
             case MAJOR7:
                 // Major 7th: 1:1, 5:4, 3:2, 15:8
-                num2 = 5; den2 = 4;
-                num3 = 3; den3 = 2;
-                num4 = 15; den4 = 8;
+                num[1] = 5; den[1] = 4;
+                num[2] = 3; den[2] = 2;
+                num[3] = 15; den[3] = 8;
                 break;
             case MINOR7:
                 // Minor 7th: 1:1, 6:5, 3:2, 9:5
-                num2 = 6; den2 = 5;
-                num3 = 3; den3 = 2;
-                num4 = 9; den4 = 5;
+                num[1] = 6; den[1] = 5;
+                num[2] = 3; den[2] = 2;
+                num[3] = 9; den[3] = 5;
                 break;
             case DIM:
                 // Diminished: 1:1, 6:5, 36:25, 3:2
-                num2 = 6; den2 = 5;
-                num3 = 36; den3 = 25;
-                num4 = 3; den4 = 2;
+                num[1] = 6; den[1] = 5;
+                num[2] = 36; den[2] = 25;
+                num[3] = 3; den[3] = 2;
                 break;
             case SUS4:
                 // Suspended 4th: 1:1, 4:3, 3:2, 2:1
-                num2 = 4; den2 = 3;
-                num3 = 3; den3 = 2;
-                num4 = 2; den4 = 1;
+                num[1] = 4; den[1] = 3;
+                num[2] = 3; den[2] = 2;
+                num[3] = 2; den[3] = 1;
                 break;
             case ADD9:
                 // Major add 9: 1:1, 5:4, 3:2, 9:4
-                num2 = 5; den2 = 4;
-                num3 = 3; den3 = 2;
-                num4 = 9; den4 = 4;
+                num[1] = 5; den[1] = 4;
+                num[2] = 3; den[2] = 2;
+                num[3] = 9; den[3] = 4;
                 break;
             case MAJOR10:
                 // Major 10th: 1:1, 5:4, 3:2, 5:2 (root, M3, P5, M10)
-                num2 = 5; den2 = 4;
-                num3 = 3; den3 = 2;
-                num4 = 5; den4 = 2;
+                num[1] = 5; den[1] = 4;
+                num[2] = 3; den[2] = 2;
+                num[3] = 5; den[3] = 2;
                 break;
             case SUS2:
                 // Suspended 2nd: 1:1, 9:8, 3:2, 2:1 (root, M2, P5, octave)
-                num2 = 9; den2 = 8;
-                num3 = 3; den3 = 2;
-                num4 = 2; den4 = 1;
+                num[1] = 9; den[1] = 8;
+                num[2] = 3; den[2] = 2;
+                num[3] = 2; den[3] = 1;
                 break;
             case MAJOR:
                 // Major triad: 1:1, 5:4, 3:2, 2:1 (root, M3, P5, octave)
-                num2 = 5; den2 = 4;
-                num3 = 3; den3 = 2;
-                num4 = 2; den4 = 1;
+                num[1] = 5; den[1] = 4;
+                num[2] = 3; den[2] = 2;
+                num[3] = 2; den[3] = 1;
                 break;
             case MINOR:
                 // Minor triad: 1:1, 6:5, 3:2, 2:1 (root, m3, P5, octave)
-                num2 = 6; den2 = 5;
-                num3 = 3; den3 = 2;
-                num4 = 2; den4 = 1;
+                num[1] = 6; den[1] = 5;
+                num[2] = 3; den[2] = 2;
+                num[3] = 2; den[3] = 1;
                 break;
             case MAJOR6:
                 // Major 6th: 1:1, 5:4, 3:2, 5:3 (root, M3, P5, M6)
-                num2 = 5; den2 = 4;
-                num3 = 3; den3 = 2;
-                num4 = 5; den4 = 3;
+                num[1] = 5; den[1] = 4;
+                num[2] = 3; den[2] = 2;
+                num[3] = 5; den[3] = 3;
                 break;
             case DOM7:
                 // Dominant 7th: 1:1, 5:4, 3:2, 9:5 (root, M3, P5, m7)
-                num2 = 5; den2 = 4;
-                num3 = 3; den3 = 2;
-                num4 = 9; den4 = 5;
+                num[1] = 5; den[1] = 4;
+                num[2] = 3; den[2] = 2;
+                num[3] = 9; den[3] = 5;
                 break;
             case MIN9:
                 // Minor add 9: 1:1, 6:5, 3:2, 9:4 (root, m3, P5, M9)
-                num2 = 6; den2 = 5;
-                num3 = 3; den3 = 2;
-                num4 = 9; den4 = 4;
+                num[1] = 6; den[1] = 5;
+                num[2] = 3; den[2] = 2;
+                num[3] = 9; den[3] = 4;
                 break;
             case TANPURA_PA:
                 // Tanpura Pa: 1:1, 3:2, 2:1, 4:1 (Sa, Pa, Sa', Sa'')
-                num2 = 3; den2 = 2;
-                num3 = 2; den3 = 1;
-                num4 = 4; den4 = 1;
+                num[1] = 3; den[1] = 2;
+                num[2] = 2; den[2] = 1;
+                num[3] = 4; den[3] = 1;
                 break;
             case TANPURA_MA:
                 // Tanpura Ma: 1:1, 4:3, 2:1, 4:1 (Sa, Ma, Sa', Sa'')
-                num2 = 4; den2 = 3;
-                num3 = 2; den3 = 1;
-                num4 = 4; den4 = 1;
+                num[1] = 4; den[1] = 3;
+                num[2] = 2; den[2] = 1;
+                num[3] = 4; den[3] = 1;
                 break;
             case TANPURA_NI:
                 // Tanpura Ni: 1:1, 15:8, 2:1, 4:1 (Sa, Ni, Sa', Sa'')
-                num2 = 15; den2 = 8;
-                num3 = 2; den3 = 1;
-                num4 = 4; den4 = 1;
+                num[1] = 15; den[1] = 8;
+                num[2] = 2; den[2] = 1;
+                num[3] = 4; den[3] = 1;
                 break;
             case TANPURA_NI_KOMAL:
                 // Tanpura ni: 1:1, 9:5, 2:1, 4:1 (Sa, ni, Sa', Sa'')
-                num2 = 9; den2 = 5;
-                num3 = 2; den3 = 1;
-                num4 = 4; den4 = 1;
+                num[1] = 9; den[1] = 5;
+                num[2] = 2; den[2] = 1;
+                num[3] = 4; den[3] = 1;
                 break;
         }
     }
 
 public:
-    ResonatingStrings() : writeIndex1(0), writeIndex2(0), writeIndex3(0), writeIndex4(0),
-                          delayLength1(100), delayLength2(150), delayLength3(200), delayLength4(400),
-                          filterState1(0), filterState2(0), filterState3(0), filterState4(0),
-                          currentMode(HARMONIC), activeBuffer(0), progressionChanged(false), pendingFlashSave(false),
-                          progressionIndex(0), lastSwitchDown(true),
+    ResonatingStrings() : blockPos(0), ring(), upperNext(0), upperActive(false), upperMode(-1),
+                          currentMode(HARMONIC), tunedMode(-1),
+                          activeBuffer(0), progressionChanged(false), pendingFlashSave(false),
+                          eightStrings(false), progressionIndex(0), lastSwitchDown(true),
                           pulseExciteEnvelope(0), noiseState(12345),
-                          dcState1(0), dcState2(0), dcState3(0), dcState4(0),
-                          smoothDelay1(0), smoothDelay2(0), smoothDelay3(0), smoothDelay4(0),
                           switchDownCounter(0), resetTriggered(false) {
         // Try to load progression from flash, fall back to defaults
         if (!loadProgressionFromFlash()) {
@@ -339,14 +227,6 @@ public:
             progressionBuffers[0].length = NUM_MODES;
             progressionBuffers[1].length = NUM_MODES;
         }
-
-        // Initialize delay lines with silence
-        for (int i = 0; i < MAX_DELAY_SIZE; i++) {
-            delayLine1[i] = 0;
-            delayLine2[i] = 0;
-            delayLine3[i] = 0;
-            delayLine4[i] = 0;
-        }
     }
 
     // Check and perform deferred flash save (called from Core 1)
@@ -363,6 +243,8 @@ public:
             handleSet(cmd + 4);
         } else if (strcmp(cmd, "GET") == 0) {
             handleGet();
+        } else if (strncmp(cmd, "STRINGS", 7) == 0) {
+            handleStrings(cmd + 7);
         } else {
             printf("ERR unknown_command\n");
         }
@@ -422,6 +304,18 @@ private:
         printf("\n");
     }
 
+    // STRINGS reports 4 or 8; STRINGS 4 / STRINGS 8 sets and persists it
+    void handleStrings(const char* args) {
+        if (strcmp(args, " 4") == 0 || strcmp(args, " 8") == 0) {
+            eightStrings = (args[1] == '8');
+            saveProgressionToFlash();
+        } else if (*args != '\0') {
+            printf("ERR invalid_strings\n");
+            return;
+        }
+        printf("STRINGS %d\n", eightStrings ? 8 : 4);
+    }
+
     // Save current progression to flash (must be called from Core 1)
     void saveProgressionToFlash() {
         int bufIdx = activeBuffer;
@@ -434,6 +328,7 @@ private:
         for (int i = 0; i < len && i < MAX_PROGRESSION_LENGTH; i++) {
             data[2 + i] = (uint8_t)progressionBuffers[bufIdx].chords[i];
         }
+        data[FLASH_STRINGS_BYTE] = eightStrings ? 8 : 4;
 
         // Pause Core 0 during flash operation (XIP is blocked during erase/program)
         multicore_lockout_start_blocking();
@@ -473,6 +368,9 @@ private:
         progressionBuffers[0].length = len;
         progressionBuffers[1].length = len;
 
+        // Saves from before the eight-string mode have 0 here
+        eightStrings = (flash_data[FLASH_STRINGS_BYTE] == 8);
+
         return true;
     }
 
@@ -493,14 +391,112 @@ private:
         __dmb();
         activeBuffer = writeIdx;
 
-        // Reset to first chord
+        // Reset to first chord, four strings
         progressionIndex = 0;
         currentMode = progressionBuffers[activeBuffer].chords[0];
+        eightStrings = false;
 
         // Defer flash save to Core 1 (Core 0 can't lock out Core 1)
         pendingFlashSave = true;
     }
 
+    // Once per KS_BLOCK samples: pitch (1V/oct), damping and chord for
+    // strings 1-4, and the same for core 1 in the block about to be filled
+    void controlBlock() {
+        // FREQUENCY CONTROL - 1V/oct
+        // CV1: ±6V maps to -2048 to 2047
+        int32_t pitchCV;
+
+        if (Disconnected(Input::CV1)) {
+            // No CV connected: X knob controls C1-C7 range
+            // Map knob 0-4095 to pitchCV 2048-4095 (6 octaves)
+            pitchCV = 2048 + (KnobVal(X) / 2);
+        } else {
+            // CV connected: X knob is fine tune (±1 octave)
+            // 1 octave = 341 steps
+            int32_t fineTune = ((KnobVal(X) - 2048) * 341) / 2048;
+
+            // CV input with 1V/oct scaling
+            // CVIn1 range: -2048 to +2047 for ±6V, so 1V = 341 counts
+            int32_t scaledCV = CVIn1();
+
+            pitchCV = 2048 + scaledCV + fineTune;
+        }
+
+        if (pitchCV > 4095) pitchCV = 4095;
+        if (pitchCV < 0) pitchCV = 0;
+
+        // Get delay from exponential lookup table (1V/oct), Q8
+        int32_t baseDelay = ExpDelayQ8(pitchCV);
+
+        // Clamp to usable range
+        const int32_t MIN_DELAY = KS_MIN_PERIOD << 8;
+        const int32_t MAX_DELAY = 1468 << 8;  // C1 at 32.7Hz
+        if (baseDelay < MIN_DELAY) baseDelay = MIN_DELAY;
+        if (baseDelay > MAX_DELAY) baseDelay = MAX_DELAY;
+
+        // DAMPING CONTROL (Y Knob + CV2)
+        int32_t dampingKnob = KnobVal(Y) + CVIn2();  // 0-4095 knob + CV
+        if (dampingKnob > 4095) dampingKnob = 4095;
+        if (dampingKnob < 0) dampingKnob = 0;
+
+        // Map to filter coefficient (more damping = lower coefficient, longer decay = higher coefficient)
+        int32_t dampingCoeff = 32000 + ((dampingKnob * 33300) / 4095);
+
+        // Frequency ratios only change with the chord
+        if (tunedMode != currentMode) {
+            int num[4], den[4];
+            getFrequencyRatios(currentMode, num, den);
+            strings.setRatios(num, den);
+            tunedMode = currentMode;
+        }
+
+        strings.control(baseDelay, dampingCoeff);
+
+        StringBlock& b = ring.slot[ring.posted % STRING_RING];
+        b.baseQ8 = baseDelay;
+        b.dampingCoeff = dampingCoeff;
+        b.mode = (uint8_t)currentMode;
+        b.eightStrings = eightStrings;
+    }
+
+public:
+    // Core 1: render strings 5-8 for the next block core 0 has posted.
+    // Returns false if there was none.
+    bool renderUpperStrings() {
+        uint32_t posted = ring.posted;
+        if (upperNext == posted) return false;
+
+        // Too far behind for core 0 to still mix it (at boot, or after a
+        // flash write): skip to the newest block
+        if (posted - upperNext > STRING_LATENCY) upperNext = posted - 1;
+        __dmb();
+
+        StringBlock& b = ring.slot[upperNext % STRING_RING];
+        if (b.eightStrings) {
+            if (!upperActive) {
+                upperStrings.clear();
+                upperActive = true;
+            }
+            if (upperMode != b.mode) {
+                // Each string of the chord an octave up
+                int num[4], den[4];
+                getFrequencyRatios((ChordMode)b.mode, num, den);
+                for (int i = 0; i < 4; i++) num[i] *= 2;
+                upperStrings.setRatios(num, den);
+                upperMode = b.mode;
+            }
+            upperStrings.control(b.baseQ8, b.dampingCoeff);
+            upperStrings.render(b.excitation, b.mid, b.side, KS_BLOCK);
+            __dmb();
+            b.done = upperNext + 1;
+        } else {
+            upperActive = false;
+        }
+        upperNext++;
+        return true;
+    }
+
 protected:
     void ProcessSample() override {
         int16_t audioIn1 = AudioIn1();
@@ -548,98 +544,18 @@ protected:
 
         lastSwitchDown = switchDown;
 
-        // FREQUENCY CONTROL - 1V/oct
-        // CV1: ±6V maps to -2048 to 2047
-        int32_t pitchCV;
-
-        if (Disconnected(Input::CV1)) {
-            // No CV connected: X knob controls C1-C7 range
-            // Map knob 0-4095 to pitchCV 2048-4095 (6 octaves)
-            pitchCV = 2048 + (KnobVal(X) / 2);
-        } else {
-            // CV connected: X knob is fine tune (±1 octave)
-            // 1 octave = 341 steps
-            int32_t fineTune = ((KnobVal(X) - 2048) * 341) / 2048;
-
-            // CV input with 1V/oct scaling
-            // CVIn1 range: -2048 to +2047 for ±6V, so 1V = 341 counts
-            int32_t scaledCV = CVIn1();
-            
-            pitchCV = 2048 + scaledCV + fineTune;
+        // Pitch, damping and chord change once per block
+        if (blockPos == 0) {
+            controlBlock();
         }
 
-        if (pitchCV > 4095) pitchCV = 4095;
-        if (pitchCV < 0) pitchCV = 0;
-
-        // Get delay from exponential lookup table (1V/oct)
-        int32_t baseDelay = ExpDelay(pitchCV);
-
-        // Clamp to usable range
-        const int MIN_DELAY = 15;
-        const int MAX_DELAY = 1468;  // C1 at 32.7Hz
-        if (baseDelay < MIN_DELAY) baseDelay = MIN_DELAY;
-        if (baseDelay > MAX_DELAY) baseDelay = MAX_DELAY;
-
-        // Get frequency ratios based on current chord mode
-        int num1 = 1, den1 = 1, num2 = 2, den2 = 1, num3 = 3, den3 = 1, num4 = 4, den4 = 1;
-        getFrequencyRatios(num1, den1, num2, den2, num3, den3, num4, den4);
-
-        // Calculate target delay lengths for each string using fixed-point math
-        // delay = baseDelay * denominator / numerator
-        // Use 8 extra bits of precision to extract fractional part for interpolation
-        int32_t targetDelay1 = ((baseDelay * den1) << 8) / num1;
-        int32_t targetDelay2 = ((baseDelay * den2) << 8) / num2;
-        int32_t targetDelay3 = ((baseDelay * den3) << 8) / num3;
-        int32_t targetDelay4 = ((baseDelay * den4) << 8) / num4;
-
-        // Smooth delay transitions to avoid harsh plucks on chord changes
-        // Initialize smoothDelay on first sample (when it's 0)
-        if (smoothDelay1 == 0) smoothDelay1 = targetDelay1;
-        if (smoothDelay2 == 0) smoothDelay2 = targetDelay2;
-        if (smoothDelay3 == 0) smoothDelay3 = targetDelay3;
-        if (smoothDelay4 == 0) smoothDelay4 = targetDelay4;
-
-        // One-pole lowpass: smoothDelay approaches target
-        const int32_t GLIDE_COEFF = 2;  // Lower = slower glide (~2 seconds)
-        smoothDelay1 += ((targetDelay1 - smoothDelay1) * GLIDE_COEFF) >> 8;
-        smoothDelay2 += ((targetDelay2 - smoothDelay2) * GLIDE_COEFF) >> 8;
-        smoothDelay3 += ((targetDelay3 - smoothDelay3) * GLIDE_COEFF) >> 8;
-        smoothDelay4 += ((targetDelay4 - smoothDelay4) * GLIDE_COEFF) >> 8;
-
-        delayLength1 = smoothDelay1 >> 8;  // Integer part
-        delayLength2 = smoothDelay2 >> 8;
-        delayLength3 = smoothDelay3 >> 8;
-        delayLength4 = smoothDelay4 >> 8;
-
-        int32_t frac1 = smoothDelay1 & 0xFF;  // Fractional part (0-255)
-        int32_t frac2 = smoothDelay2 & 0xFF;
-        int32_t frac3 = smoothDelay3 & 0xFF;
-        int32_t frac4 = smoothDelay4 & 0xFF;
-
-        // Clamp to valid range
-        if (delayLength1 < MIN_DELAY) delayLength1 = MIN_DELAY;
-        if (delayLength2 < MIN_DELAY) delayLength2 = MIN_DELAY;
-        if (delayLength3 < MIN_DELAY) delayLength3 = MIN_DELAY;
-        if (delayLength4 < MIN_DELAY) delayLength4 = MIN_DELAY;
-        if (delayLength1 > MAX_DELAY_SIZE - 1) delayLength1 = MAX_DELAY_SIZE - 1;
-        if (delayLength2 > MAX_DELAY_SIZE - 1) delayLength2 = MAX_DELAY_SIZE - 1;
-        if (delayLength3 > MAX_DELAY_SIZE - 1) delayLength3 = MAX_DELAY_SIZE - 1;
-        if (delayLength4 > MAX_DELAY_SIZE - 1) delayLength4 = MAX_DELAY_SIZE - 1;
-
-        // DAMPING CONTROL (Y Knob + CV2)
-        int32_t dampingKnob = KnobVal(Y) + CVIn2();  // 0-4095 knob + CV
-        if (dampingKnob > 4095) dampingKnob = 4095;
-        if (dampingKnob < 0) dampingKnob = 0;
-
-        // Map to filter coefficient (more damping = lower coefficient, longer decay = higher coefficient)
-        int32_t dampingCoeff = 32000 + ((dampingKnob * 33300) / 4095);
-
         // Excitation amounts for each string
         // String 1 gets full input, others get scaled versions (sympathetic response)
         int32_t excitation1 = audioIn >> 2;  // Direct excitation
         int32_t excitation2 = audioIn >> 4;  // Sympathetic response
         int32_t excitation3 = audioIn >> 4;  // Sympathetic response
         int32_t excitation4 = audioIn >> 3;  // 4th string
+        int32_t excitationUpper = audioIn >> 4;  // Strings 5-8
 
         // Pulse1 triggers a noise burst to excite strings (like plucking)
         if (PulseIn1RisingEdge()) {
@@ -655,31 +571,50 @@ protected:
             excitation2 += scaledNoise >> 1;
             excitation3 += scaledNoise >> 1;
             excitation4 += scaledNoise >> 1;
+            excitationUpper += scaledNoise >> 1;
             // Fast decay for short pluck burst
             pulseExciteEnvelope = (pulseExciteEnvelope * 250) >> 8;
         }
 
-        // Process each string with fractional delay interpolation
-        int32_t out1 = processString(delayLine1, writeIndex1, delayLength1,
-                                     filterState1, dcState1, excitation1, dampingCoeff, frac1);
-        int32_t out2 = processString(delayLine2, writeIndex2, delayLength2,
-                                     filterState2, dcState2, excitation2, dampingCoeff, frac2);
-        int32_t out3 = processString(delayLine3, writeIndex3, delayLength3,
-                                     filterState3, dcState3, excitation3, dampingCoeff, frac3);
-        int32_t out4 = processString(delayLine4, writeIndex4, delayLength4,
-                                     filterState4, dcState4, excitation4, dampingCoeff, frac4);
+        // Process each string (allpass-tuned fractional delay)
+        int32_t out1 = strings.s[0].tick(excitation1);
+        int32_t out2 = strings.s[1].tick(excitation2);
+        int32_t out3 = strings.s[2].tick(excitation3);
+        int32_t out4 = strings.s[3].tick(excitation4);
+
+        // Strings 5-8: hand this sample's excitation to core 1, and take its
+        // output for the block posted STRING_LATENCY blocks ago (0 if core 1
+        // didn't render it, or the mode is off)
+        int32_t upperMid = 0, upperSide = 0;
+        {
+            uint32_t posted = ring.posted;
+            ring.slot[posted % STRING_RING].excitation[blockPos] = (int16_t)excitationUpper;
+            uint32_t back = posted - STRING_LATENCY;
+            const StringBlock& b = ring.slot[back % STRING_RING];
+            if (b.done == back + 1) {
+                upperMid = b.mid[blockPos];
+                upperSide = b.side[blockPos];
+            }
+            if (++blockPos == KS_BLOCK) {
+                blockPos = 0;
+                __dmb();
+                ring.posted = posted + 1;
+                __sev();
+            }
+        }
 
         // Mix strings together - stereo mid/side
         // Out1 (mid): all strings summed - mono compatible
-        // Out2 (side): strings 1&3 center, strings 2&4 wide/diffuse
+        // Out2 (side): strings 1&3 center, strings 2&4 wide/diffuse; 5-8 at
+        // half level, panned opposite
         int32_t resonatorOut1, resonatorOut2;
         if (SwitchVal() == Switch::Up) {
             // TUNING MODE: first string only
             resonatorOut1 = out1 / 4;
             resonatorOut2 = out1 / 4;
         } else {
-            resonatorOut1 = (out1 + out2 + out3 + out4) / 4;
-            resonatorOut2 = (out1 - out2 + out3 - out4) / 4;
+            resonatorOut1 = (out1 + out2 + out3 + out4 + (upperMid >> 1)) / 4;
+            resonatorOut2 = (out1 - out2 + out3 - out4 + (upperSide >> 1)) / 4;
         }
 
         resonatorOut1 *= 2;
@@ -747,28 +682,38 @@ protected:
 // Global pointer for Core 1 to access shared state
 static ResonatingStrings* g_resonator = nullptr;
 
-void core1_serial_handler() {
+// Core 1: strings 5-8, the serial editor and flash saves. Sleeps in WFE
+// between the blocks core 0 posts (3 kHz); the serial port is polled
+// every 32nd wake (~10 ms), without blocking.
+void core1_main() {
     sleep_ms(500);  // Wait for USB to settle
 
     char lineBuf[128];
     int linePos = 0;
+    uint32_t wakes = 0;
 
     while (true) {
-        int c = getchar_timeout_us(10000);  // 10ms timeout
-        if (c == PICO_ERROR_TIMEOUT) {
-            // Check if Core 0 requested a flash save (e.g. long-press reset)
-            g_resonator->checkPendingFlashSave();
-            continue;
+        while (g_resonator->renderUpperStrings()) {
         }
-        if (c == '\n' || c == '\r') {
-            if (linePos > 0) {
-                lineBuf[linePos] = '\0';
-                g_resonator->handleSerialCommand(lineBuf);
-                linePos = 0;
+
+        if ((++wakes & 31) == 0) {
+            int c;
+            while ((c = getchar_timeout_us(0)) != PICO_ERROR_TIMEOUT) {
+                if (c == '\n' || c == '\r') {
+                    if (linePos > 0) {
+                        lineBuf[linePos] = '\0';
+                        g_resonator->handleSerialCommand(lineBuf);
+                        linePos = 0;
+                    }
+                } else if (linePos < 127) {
+                    lineBuf[linePos++] = (char)c;
+                }
             }
-        } else if (linePos < 127) {
-            lineBuf[linePos++] = (char)c;
+            // Check if Core 0 requested a flash save (e.g. long-press reset)
+            g_resonator->checkPendingFlashSave();
         }
+
+        __wfe();
     }
 }
 
@@ -782,7 +727,7 @@ int main() {
     // Enable lockout handler so Core 0 can be safely paused during flash operations
     multicore_lockout_victim_init();
 
-    multicore_launch_core1(core1_serial_handler);
+    multicore_launch_core1(core1_main);
     resonator.Run();
     return 0;
 }
@@ -0,0 +1,44 @@
+#ifndef STRING_BLOCKS_H
+#define STRING_BLOCKS_H
+
+#include <cstdint>
+#include "karplus.h"
+
+// Core 0 -> core 1 string blocks, for the eight-string mode
+//
+// ProcessSample fills a block with the upper strings' excitation, one
+// sample per call, and the block's pitch, damping and chord at its start.
+// When the block is full it posts it (posted++) and SEVs. Core 1 wakes
+// from WFE, renders the four upper strings over the block and tags the
+// slot done. ProcessSample mixes the result STRING_LATENCY blocks after
+// posting it (0.7 ms), so core 1 has a whole block period to render.
+//
+// One writer per field, so no locks: core 0 owns posted and a slot's
+// inputs, core 1 a slot's outputs and done. A block core 1 didn't finish
+// in time is simply left out of the mix.
+
+static constexpr int STRING_RING = 4;      // slots
+static constexpr int STRING_LATENCY = 2;   // blocks between posting and mixing
+
+struct StringBlock
+{
+    // core 0
+    int16_t excitation[KS_BLOCK];
+    int32_t baseQ8;
+    int32_t dampingCoeff;
+    uint8_t mode;
+    bool eightStrings;
+
+    // core 1
+    int16_t mid[KS_BLOCK];
+    int16_t side[KS_BLOCK];
+    volatile uint32_t done;    // block number + 1 once rendered
+};
+
+struct StringRing
+{
+    StringBlock slot[STRING_RING];
+    volatile uint32_t posted;  // blocks core 0 has filled
+};
+
+#endif // STRING_BLOCKS_H
@@ -0,0 +1,2390 @@
+// clockwork_engine.h — Clockwork's six-channel clock and waveform engine
+//
+// Everything Core 1 works out from the jacks and the shared parameters each sample: the
+// master clock, external (Pulse 1) and MIDI clock recovery, per-channel phase, Euclidean
+// steps, swing, humanize, the shapes, quantizer, glide and CV delay. There is no Pico SDK
+// or ComputerCard here: the card copies its jacks into an EngineJacks, calls process()
+// and writes the outputs back, and host/timing_bench.cpp runs the same code on Linux.
+//
+// Core 0 hands over settings through publish_params() (the double-buffered SharedParams)
+// and MIDI through the volatile counters and ChannelState note fields; the rest belongs
+// to Core 1. process() keeps its own statics and this file defines the engine's tables,
+// so one engine per program, included from one translation unit.
+//
+// releases/43_clockwork builds this file and main.cpp from here (see its CMakeLists.txt).
+
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+#if defined(__arm__)
+#include "hardware/structs/sio.h"
+#include "hardware/divider.h"
+#endif
+
+#ifndef __not_in_flash_func
+#define __not_in_flash_func(x) x
+#endif
+
+#ifndef COMPUTERCARD_SAMPLE_RATE_DIV
+#define COMPUTERCARD_SAMPLE_RATE_DIV 1
+#endif
+#define SAMPLE_RATE (48000 / COMPUTERCARD_SAMPLE_RATE_DIV)
+#define SAMPLES_PER_MINUTE (SAMPLE_RATE * 60)
+
+// Times the engine works in samples, so they hold at any SAMPLE_RATE
+#define MIN_TRIG_SAMPLES (SAMPLE_RATE * 12 / 1000)  // 12ms shortest trigger / gate
+#define MIN_TRIG_GAP_SAMPLES (SAMPLE_RATE / 2400)   // ~0.4ms low before the next step's gate
+#define DELAY_RATE 24000                            // CV/Audio delay runs at 24kHz: same buffer times
+#define DELAY_DECIMATION (SAMPLE_RATE / DELAY_RATE)
+
+// ============================================================================
+// Data Structs & Constants
+// ============================================================================
+
+enum WaveShape {
+    WAVE_GATE = 0,
+    WAVE_RATCHET,
+    WAVE_SINE,
+    WAVE_TRIANGLE,
+    WAVE_SAW_UP,
+    WAVE_SAW_DOWN,
+    WAVE_TRAPEZOID,
+    WAVE_HUMP,
+    WAVE_ENVELOPE,
+    WAVE_LOG_ENVELOPE,
+    WAVE_RANDOM_SH,
+    WAVE_RANDOM_SM,
+    WAVE_CV_DELAY,
+    WAVE_MATH,
+    WAVE_NUM_SHAPES
+};
+
+enum Scale {
+    SCALE_OFF = 0,
+    SCALE_CHROMATIC,
+    SCALE_MAJOR,
+    SCALE_MINOR_PENTATONIC,
+    SCALE_NATURAL_MINOR,
+    SCALE_MAJOR_PENTATONIC,
+    SCALE_DORIAN,
+    SCALE_MIXOLYDIAN,
+    SCALE_LYDIAN,
+    SCALE_PHRYGIAN,
+    SCALE_HARMONIC_MINOR,
+    SCALE_NUM_SCALES
+};
+
+// 34 clock modifiers: divisions (/2048 to /2), 1x, multiplications (x2 to x128)
+// Pinned to RAM so Core 1 never stalls on a Flash rodata access.
+uint32_t clock_multipliers_q16[] __attribute__((section(".data"))) = {
+    32, 64, 85, 128, 171, 256, 341,                                        // /2048, /1024, /768, /512, /384, /256, /192
+    512, 683, 1024, 1365, 2048, 2731, 4096, 5461, 8192, 10922, 16384, 21845, 32768,  // Divisions: /128, /96, /64, /48, /32, /24, /16, /12, /8, /6, /4, /3, /2
+    65536,                                                                  // x1
+    131072, 196608, 262144, 393216, 524288, 786432, 1048576, 1572864, 2097152, 3145728, 4194304, 6291456, 8388608 // Multiplications: x2 to x128
+};
+
+const char* clock_modifier_names[] = {
+    "/2048", "/1024", "/768", "/512", "/384", "/256", "/192",
+    "/128", "/96", "/64", "/48", "/32", "/24", "/16", "/12", "/8", "/6", "/4", "/3", "/2",
+    "x1",
+    "x2", "x3", "x4", "x6", "x8", "x12", "x16", "x24", "x32", "x48", "x64", "x96", "x128"
+};
+
+const char* wave_shape_names[] = {
+    "GATE", "RTCH", "SINE", "TRI", "SAW+", "SAW-", "TRAP", "HUMP", "ENV", "LOGE", "RSH", "RSM", "DELAY"
+};
+
+const char* scale_names[] = {
+    "OFF", "CHRO", "MAJ", "MPEN", "MIN", "MINP", "DOR", "MIXO", "LYD", "PHRY", "HMIN"
+};
+
+// Pinned to RAM so Core 1 never stalls on Flash rodata access inside ProcessSample.
+int scale_notes_major[] __attribute__((section(".data"))) = {0, 2, 4, 5, 7, 9, 11};
+int scale_notes_minor_pentatonic[] __attribute__((section(".data"))) = {0, 3, 5, 7, 10};
+int scale_notes_natural_minor[] __attribute__((section(".data"))) = {0, 2, 3, 5, 7, 8, 10};
+int scale_notes_major_pentatonic[] __attribute__((section(".data"))) = {0, 2, 4, 7, 9};
+int scale_notes_dorian[] __attribute__((section(".data"))) = {0, 2, 3, 5, 7, 9, 10};
+int scale_notes_mixolydian[] __attribute__((section(".data"))) = {0, 2, 4, 5, 7, 9, 10};
+int scale_notes_lydian[] __attribute__((section(".data"))) = {0, 2, 4, 6, 7, 9, 11};
+int scale_notes_phrygian[] __attribute__((section(".data"))) = {0, 1, 3, 5, 7, 8, 10};
+int scale_notes_harmonic_minor[] __attribute__((section(".data"))) = {0, 2, 3, 5, 7, 8, 11};
+
+uint32_t segment_widths_ram[] = {
+    4294967295U,
+    2147483647U,
+    1431655765U,
+    1073741823U,
+    858993459U,
+    715827882U,
+    613566756U,
+    536870911U
+};
+
+struct ChannelConfig {
+    uint8_t clock_modifier = 20;     // x1 default (index 20 in new 34-modifier scale)
+    uint8_t euclidean_steps = 0;    // 0 = straight clock
+    uint8_t euclidean_fills = 0;
+    uint8_t wave_shape = WAVE_GATE;
+    uint8_t wave_param = 128;       // default 50% / mid-way
+    uint8_t probability = 100;      // 100% trigger probability
+    uint8_t quantizer_scale_and_offset = 0; // bits 0-3: quantizer_scale, bits 4-7: euclidean_offset
+    uint8_t loop_length = 0;        // 0 = Infinite
+    uint8_t level = 0;            // default level (0 for analog, overridden for digital)
+    uint8_t glide = 0;              // default 0 (instant change, no portamento)
+
+    uint8_t get_quantizer_scale() const {
+        return quantizer_scale_and_offset & 0x0F;
+    }
+    void set_quantizer_scale(uint8_t scale) {
+        quantizer_scale_and_offset = (quantizer_scale_and_offset & 0xF0) | (scale & 0x0F);
+    }
+    uint8_t get_euclidean_offset() const {
+        return (quantizer_scale_and_offset >> 4) & 0x0F;
+    }
+    void set_euclidean_offset(uint8_t offset) {
+        quantizer_scale_and_offset = (quantizer_scale_and_offset & 0x0F) | ((offset & 0x0F) << 4);
+    }
+    uint8_t get_clock_modifier() const {
+        if (clock_modifier <= 33) return clock_modifier;
+        return 20; // x1 default (index 20)
+    }
+    void set_clock_modifier(uint8_t mod) {
+        if (mod <= 33) clock_modifier = mod;
+    }
+    uint8_t get_trigger_source() const {
+        if (clock_modifier >= 34 && clock_modifier <= 39) {
+            return clock_modifier - 33;
+        }
+        if (clock_modifier >= 40 && clock_modifier <= 55) {
+            return 7; // MIDI Mode
+        }
+        return 0; // standard clock source
+    }
+    void set_trigger_source(uint8_t src) {
+        if (src >= 1 && src <= 6) {
+            clock_modifier = 33 + src;
+        } else if (src == 7) {
+            if (clock_modifier < 40 || clock_modifier > 55) {
+                clock_modifier = 40; // MIDI Ch 1 default
+            }
+        } else {
+            clock_modifier = 20; // x1 default
+        }
+    }
+};
+
+struct SavedSettings {
+    uint32_t magic = 0x434c4b5b;    // 'CLKZ'
+    uint16_t bpm = 120;
+    uint8_t sync_source = 0;        // 0 = Internal, 1 = External Pulse 1
+    uint8_t reset_mode = 0;         // 0 = Reset on Pulse 2, 1 = Run Gate on Pulse 2
+    uint8_t ext_ppqn = 4;           // External Clock PPQN (1, 4, 24, 48)
+    uint8_t global_swing = 0;       // 0 to 50 (%)
+    uint8_t global_humanize = 0;    // 0 to 100 (%)
+    uint8_t global_seed = 0;        // 0 to 63 (64 seeding options)
+    ChannelConfig channels[6];
+};
+
+// Internal pre-calculated data owned exclusively by Core 1
+struct ChannelState {
+    uint32_t phase = 0;
+    uint32_t phase_increment = 0;
+    uint8_t step_index = 0;
+    uint8_t loop_step_count = 0;
+    bool step_active = true;
+    // volatile: written by Core 1, read by Core 0 (LED + telemetry). 16-bit
+    // aligned stores are atomic on Cortex-M0+, but volatile prevents the
+    // compiler from caching the value across the Core 0 read boundary.
+    volatile int16_t last_value = -2048;
+    volatile int16_t telemetry_max = -2048;
+    volatile int16_t telemetry_min = 2047;
+
+    // Slew/Triangle pre-calculations (from the inverse LUTs; all fit 32 bits)
+    uint32_t inv_skew = 0;
+    uint32_t inv_rem = 0;
+    uint32_t inv_slew = 0;
+    uint8_t ratchet_count = 2;
+
+    // Random walk and S&H state
+    int16_t rand_current = 0;
+    int16_t rand_next = 0;
+    int32_t rand_smoothed = 0;
+    int16_t random_history[64] = {0};
+
+    // External sync timing pre-calculations (division-free on Core 1)
+    uint32_t ext_sync_pulses = 4;
+    uint32_t ext_pulse_ch_counter = 0;
+
+    // Quantizer input cache — skip re-quantizing if note and scale are unchanged
+    int16_t last_q_input_note = INT16_MIN; // raw semitone before snap
+    uint8_t last_q_scale = 0xFF;           // scale when last_q_input_note was computed
+    int16_t last_q_output_note = 60;       // snapped semitone result
+    int32_t jitter_phase = 0;              // Global Humanize phase offset for current step
+    uint32_t delay_write_ptr = 0;          // Circular buffer write index for CV/Audio delay mode
+    bool step_triggered = false;           // Flag set when a new clock step starts
+    uint32_t bounce_decay = 0;             // Bouncing ball envelope decay value
+    uint32_t bounce_decay_coeff = 65536;   // Q16 fixed-point decay coefficient (65536 = neutral/full-speed)
+    uint8_t delay_impulse_counter = 0;     // Remaining samples to inject impulse trigger
+    // S&H humanize alignment: new voltage is held in pending until jitter delay expires
+    // so the CV latch and the trigger/gate output change on the exact same sample.
+    bool     rand_pending     = false;
+    int16_t  rand_pending_val = 0;
+    bool     last_gate_high   = false;
+
+    volatile uint8_t midi_note_num = 60;
+    volatile uint8_t midi_velocity = 0;
+    volatile bool midi_note_active = false;
+    volatile bool midi_trigger_pending = false;
+    int32_t pitch_q24 = 0;                 // Glided quantizer pitch, semitones from note 60 (Q24)
+
+    // Control-rate cache: reworked only when phase_increment changes, not every sample
+    uint32_t ctl_phase_inc = 0;            // phase_inc the values below belong to
+    uint32_t min_trig_phase = 0;           // MIN_TRIG_SAMPLES of phase
+    uint32_t max_trig_phase = 0xFFFFFFFF;  // Whole step less MIN_TRIG_GAP_SAMPLES of phase
+    uint32_t delay_step_ticks = 0;         // One step in CV delay ticks (DELAY_RATE)
+    int16_t delay_out = 0;                 // CV delay output, held between ticks
+
+    // S&H / smooth random endpoints after level + quantizer, reworked when an input changes
+    int16_t rand_key_current = INT16_MIN;
+    int16_t rand_key_next = INT16_MIN;
+    uint8_t rand_key_level = 0xFF;
+    uint8_t rand_key_scale = 0xFF;
+    int16_t rand_q_current = 0;
+    int16_t rand_q_next = 0;
+};
+
+// Symmetrical circular delay buffers in SRAM (24 KB total), at DELAY_RATE
+int16_t delay_buffer_0[4096] __attribute__((section(".data")));
+int16_t delay_buffer_1[4096] __attribute__((section(".data")));
+int16_t delay_buffer_2[2048] __attribute__((section(".data")));
+int16_t delay_buffer_3[2048] __attribute__((section(".data")));
+
+int16_t* delay_buffers[4] = { delay_buffer_0, delay_buffer_1, delay_buffer_2, delay_buffer_3 };
+uint32_t delay_buffer_masks[4] = { 4095, 4095, 2047, 2047 };
+
+// ============================================================================
+// Core Parameter Double-Buffer Struct (Core 0 → Core 1 Param Sharing)
+// ============================================================================
+
+struct SharedParams {
+    uint16_t bpm;
+    uint8_t sync_source;
+    uint8_t reset_mode;
+    uint8_t ext_ppqn;
+    uint8_t global_swing;
+    uint8_t global_humanize;
+    uint8_t global_seed;
+    bool global_paused;
+    uint32_t manual_reset_counter;
+    uint32_t base_increment; // Pre-calculated x1 step increment per sample
+    uint32_t swing_mult_even; // Pre-calculated swing Q16 multiplier for even steps
+    uint32_t swing_mult_odd;  // Pre-calculated swing Q16 multiplier for odd steps
+    uint32_t swing_recip_even; // 2^46 / swing_mult_even: un-swings envelope decay without a divide
+    uint32_t swing_recip_odd;  // 2^46 / swing_mult_odd
+    uint32_t glide_coef[6];    // Per-channel glide one-pole coefficient per sample (Q32), 0 = no glide
+    ChannelConfig channels[6];
+    // NOTE: ChannelState is intentionally NOT included here.
+    // Core 1 owns its own states_ array exclusively, so Core 0 can never
+    // corrupt the live phase/step/rand values by atomically swapping the
+    // parameter buffer mid-step.
+};
+
+volatile SharedParams g_shared_params[2];
+volatile uint32_t g_shared_params_idx = 0;
+
+// ============================================================================
+// Global Lookup Tables
+// ============================================================================
+
+int16_t sine_lut[256];
+uint16_t exp_lut[256];
+uint32_t inv_skew_lut[256];
+uint32_t inv_rem_lut[256];
+uint32_t inv_slew_lut[256];
+uint32_t inv_trap_lut[256];
+uint32_t env_multiplier_lut[256];
+
+void init_luts() {
+    for (int i = 0; i < 256; i++) {
+        // Sine wave ranging from -2048 to 2047
+        sine_lut[i] = (int16_t)(sinf(i * 2.0f * 3.14159265f / 256.0f) * 2047.0f);
+        // Exponential decay envelope mapping 4095 (i=0) to 0 (i=255)
+        float val = expf(-4.0f * i / 255.0f);
+        exp_lut[i] = (uint16_t)(4095.0f * (val - 0.0183156f) / 0.9816843f);
+
+        // Precalculate division-free inverses for triangle symmetry and random slew
+        uint32_t clamped = i;
+        if (clamped < 2) clamped = 2;
+        if (clamped > 253) clamped = 253;
+        
+        uint32_t skew_point = clamped << 24;
+        uint32_t rem_width = 0xFFFFFFFF - skew_point;
+        
+        inv_skew_lut[i] = ((uint64_t)4095 << 32) / skew_point;
+        inv_rem_lut[i] = ((uint64_t)4095 << 32) / rem_width;
+
+        clamped = i;
+        if (clamped < 2) clamped = 2;
+        uint32_t slew_duration = clamped << 24;
+        inv_slew_lut[i] = ((uint64_t)65536 << 32) / slew_duration;
+
+        // Trapezoid ramps: rise R = half cycle less the flat top F
+        clamped = i;
+        if (clamped < 2) clamped = 2;
+        if (clamped > 253) clamped = 253;
+        uint32_t flat = (clamped * 0x40000000ULL) >> 8;
+        inv_trap_lut[i] = ((uint64_t)4095 << 32) / (0x80000000U - flat);
+
+        // Precalculate envelope speed scaling factors
+        clamped = i;
+        if (clamped < 2) clamped = 2;
+        // Width 100% (255) -> 1.0x speed multiplier (256 in Q8)
+        // Width 50% (128) -> 2.0x speed multiplier (512 in Q8)
+        env_multiplier_lut[i] = (255 * 256) / clamped;
+    }
+}
+
+// Fast division-free LUT interpolation
+inline int16_t __not_in_flash_func(interpolate_sine)(uint32_t phase) {
+    uint32_t idx = phase >> 24;
+    uint32_t frac = (phase >> 8) & 0xFFFF;
+    int16_t y0 = sine_lut[idx];
+    int16_t y1 = sine_lut[(idx + 1) & 0xFF];
+    return y0 + (((y1 - y0) * (int32_t)frac) >> 16);
+}
+
+inline int16_t __not_in_flash_func(interpolate_exp)(uint32_t phase) {
+    uint32_t idx = phase >> 24;
+    uint32_t frac = (phase >> 8) & 0xFFFF;
+    uint16_t y0 = exp_lut[idx];
+    uint16_t y1 = (idx < 255) ? exp_lut[idx + 1] : 0;
+    return (int16_t)(y0 + (((int32_t)(y1 - y0) * (int32_t)frac) >> 16));
+}
+
+// Fast LCG random number generator running from RAM
+static uint32_t rand_seed = 0x12345678;
+inline uint32_t __not_in_flash_func(fast_rand)() {
+    rand_seed = rand_seed * 1103515245 + 12345;
+    return rand_seed;
+}
+
+inline int __not_in_flash_func(safe_abs)(int x) {
+    return x < 0 ? -x : x;
+}
+
+inline uint32_t __not_in_flash_func(safe_div_u32)(uint32_t dividend, uint32_t divisor) {
+#if defined(__arm__)
+    // RP2040 SIO divider takes exactly 8 cycles to produce a result after
+    // the divisor is written. hw_divider_u32_quotient_wait() burns those
+    // cycles via compiler barriers, then reads the settled quotient.
+    sio_hw->div_udividend = dividend;
+    sio_hw->div_udivisor  = divisor;
+    return hw_divider_u32_quotient_wait();
+#else
+    return divisor ? dividend / divisor : 0xFFFFFFFF; // Host build: what the SIO divider gives
+#endif
+}
+
+// Phase increment per sample for a clock of (period_q4 / 16) samples per pulse at ppqn
+// pulses per cycle: 2^32 / (period_q4 * ppqn) * 16, as two 32-bit divides so the
+// fractional period survives (period_q4 * ppqn stays under 2^21 within 30..300 BPM)
+inline uint32_t __not_in_flash_func(period_q4_to_increment)(uint32_t period_q4, uint32_t ppqn) {
+    uint32_t d = period_q4 * ppqn;
+    if (d == 0) return 0;
+    uint32_t q = safe_div_u32(0xFFFFFFFFU, d);
+    uint32_t r = 0xFFFFFFFFU - q * d;
+    return (q << 4) + safe_div_u32(r << 4, d);
+}
+
+inline uint32_t __not_in_flash_func(mul16_16)(uint32_t a, uint32_t b) {
+#if defined(__arm__)
+    uint32_t res;
+    asm ("mul %0, %1" : "=l" (res) : "l" (b), "0" (a) : "cc");
+    return res;
+#else
+    return a * b; // Host build (host/)
+#endif
+}
+
+inline uint32_t __not_in_flash_func(mul_u32_u32_high)(uint32_t a, uint32_t b) {
+    uint32_t a_lo = a & 0xFFFF;
+    uint32_t a_hi = a >> 16;
+    uint32_t b_lo = b & 0xFFFF;
+    uint32_t b_hi = b >> 16;
+    
+    uint32_t p0 = mul16_16(a_lo, b_lo);
+    uint32_t p1 = mul16_16(a_hi, b_lo);
+    uint32_t p2 = mul16_16(a_lo, b_hi);
+    uint32_t p3 = mul16_16(a_hi, b_hi);
+    
+    uint32_t carry = (p0 >> 16) + (p1 & 0xFFFF) + (p2 & 0xFFFF);
+    return p3 + (p1 >> 16) + (p2 >> 16) + (carry >> 16);
+}
+
+inline uint32_t __not_in_flash_func(mul_u32_u32_shift16)(uint32_t a, uint32_t b) {
+    uint32_t a_lo = a & 0xFFFF;
+    uint32_t a_hi = a >> 16;
+    uint32_t b_lo = b & 0xFFFF;
+    uint32_t b_hi = b >> 16;
+    
+    uint32_t p0 = mul16_16(a_lo, b_lo);
+    uint32_t p1 = mul16_16(a_hi, b_lo);
+    uint32_t p2 = mul16_16(a_lo, b_hi);
+    uint32_t p3 = mul16_16(a_hi, b_hi);
+    
+    return (p3 << 16) + p1 + p2 + (p0 >> 16);
+}
+
+inline uint32_t __not_in_flash_func(mul_u32_u32_shift8)(uint32_t a, uint32_t b) {
+    uint32_t a_lo = a & 0xFFFF;
+    uint32_t a_hi = a >> 16;
+    uint32_t b_lo = b & 0xFFFF;
+    uint32_t b_hi = b >> 16;
+    
+    uint32_t p0 = mul16_16(a_lo, b_lo);
+    uint32_t p1 = mul16_16(a_hi, b_lo);
+    uint32_t p2 = mul16_16(a_lo, b_hi);
+    uint32_t p3 = mul16_16(a_hi, b_hi);
+    
+    return (p3 << 24) + ((p1 + p2) << 8) + (p0 >> 8);
+}
+
+inline uint32_t __not_in_flash_func(mul_u32_u16_shift8_clamp)(uint32_t a, uint32_t b) {
+    uint32_t a_lo = a & 0xFFFF;
+    uint32_t a_hi = a >> 16;
+    
+    uint32_t p0 = mul16_16(a_lo, b);
+    uint32_t p1 = mul16_16(a_hi, b);
+    
+    if (p1 >= 0x01000000) {
+        return 0xFFFFFFFF;
+    }
+    uint32_t part1 = p1 << 8;
+    uint32_t part0 = p0 >> 8;
+    if (part1 > 0xFFFFFFFF - part0) {
+        return 0xFFFFFFFF;
+    }
+    return part1 + part0;
+}
+
+// Glided pitch (Q24 semitones from note 60) to DAC steps (256/9 a semitone) or millivolts
+// (250/3 a semitone), truncated toward zero: k = 2^40 * steps per semitone / 2^24
+#define PITCH_Q24_TO_DAC 1864135U
+#define PITCH_Q24_TO_MV  5461333U
+inline int32_t __not_in_flash_func(pitch_q24_scale)(int32_t pitch, uint32_t k) {
+    uint32_t mag = (pitch < 0) ? (uint32_t)-pitch : (uint32_t)pitch;
+    int32_t scaled = (int32_t)(mul_u32_u32_high(mag, k) >> 8);
+    return (pitch < 0) ? -scaled : scaled;
+}
+
+// UTILITY pulse output: N pulses per beat of the master clock (N = 1, 4 or 24), each
+// 10ms or half the period if that is shorter
+inline bool __not_in_flash_func(utility_pulse_high)(uint32_t master_phase, uint32_t base_inc, uint32_t bpm, uint32_t N) {
+    uint32_t period_samples = safe_div_u32(SAMPLES_PER_MINUTE, bpm * N);
+    uint32_t pulse_width = SAMPLE_RATE / 100; // 10ms
+    if (pulse_width > period_samples / 2) {
+        pulse_width = period_samples / 2;
+    }
+    if (pulse_width < 1) {
+        pulse_width = 1;
+    }
+    // Phase within the current 1/N beat, without a divide
+    uint32_t phase_mod = master_phase;
+    if (N == 4) {
+        phase_mod = master_phase & 0x3FFFFFFF;
+    } else if (N == 24) {
+        phase_mod = master_phase - mul_u32_u32_high(master_phase, 24) * 178956970U; // 2^32 / 24
+    }
+    return phase_mod < base_inc * pulse_width;
+}
+
+// Scale Quantization snap function
+int __not_in_flash_func(quantize_to_scale)(int note, int scale) {
+    if (scale == SCALE_OFF || scale == SCALE_CHROMATIC) return note;
+
+    // Guaranteed positive floor division-free calculation for note >= -240
+    int positive_note = note + 240;
+    int octave = ((positive_note * 1366) >> 14) - 20;
+    int note_in_octave = positive_note - (octave + 20) * 12;
+
+    const int* scale_notes = nullptr;
+    int scale_size = 0;
+
+    if (scale == SCALE_MAJOR) {
+        scale_notes = scale_notes_major;
+        scale_size = 7;
+    } else if (scale == SCALE_MINOR_PENTATONIC) {
+        scale_notes = scale_notes_minor_pentatonic;
+        scale_size = 5;
+    } else if (scale == SCALE_NATURAL_MINOR) {
+        scale_notes = scale_notes_natural_minor;
+        scale_size = 7;
+    } else if (scale == SCALE_MAJOR_PENTATONIC) {
+        scale_notes = scale_notes_major_pentatonic;
+        scale_size = 5;
+    } else if (scale == SCALE_DORIAN) {
+        scale_notes = scale_notes_dorian;
+        scale_size = 7;
+    } else if (scale == SCALE_MIXOLYDIAN) {
+        scale_notes = scale_notes_mixolydian;
+        scale_size = 7;
+    } else if (scale == SCALE_LYDIAN) {
+        scale_notes = scale_notes_lydian;
+        scale_size = 7;
+    } else if (scale == SCALE_PHRYGIAN) {
+        scale_notes = scale_notes_phrygian;
+        scale_size = 7;
+    } else if (scale == SCALE_HARMONIC_MINOR) {
+        scale_notes = scale_notes_harmonic_minor;
+        scale_size = 7;
+    }
+
+    if (scale_notes == nullptr || scale_size <= 0) {
+        return note;
+    }
+
+    int best_note = scale_notes[0];
+    int min_diff = 999;
+    for (int i = 0; i < scale_size; ++i) {
+        int diff = safe_abs(note_in_octave - scale_notes[i]);
+        if (diff < min_diff) {
+            min_diff = diff;
+            best_note = scale_notes[i];
+        }
+    }
+
+    return octave * 12 + best_note;
+}
+
+inline int16_t __attribute__((always_inline)) scale_and_quantize_val(int16_t raw_val, const ChannelConfig& ch_config, uint8_t current_scale) {
+    int32_t val = raw_val;
+    // 1. Level Attenuation
+    int32_t signed_level = (int32_t)ch_config.level - 100;
+    int32_t abs_scale = signed_level >= 0 ? signed_level : -signed_level;
+    bool is_bipolar = (ch_config.wave_shape == WAVE_SINE || 
+                       ch_config.wave_shape == WAVE_TRIANGLE || 
+                       ch_config.wave_shape == WAVE_SAW_UP || 
+                       ch_config.wave_shape == WAVE_SAW_DOWN || 
+                       ch_config.wave_shape == WAVE_RANDOM_SH || 
+                       ch_config.wave_shape == WAVE_RANDOM_SM || 
+                       ch_config.wave_shape == WAVE_CV_DELAY || 
+                       ch_config.wave_shape == WAVE_TRAPEZOID);
+    if (is_bipolar) {
+        if (signed_level < 0) {
+            // Negative level (left side): bipolar mode
+            int32_t temp_level = val * abs_scale;
+            int32_t abs_level = temp_level < 0 ? -temp_level : temp_level;
+            int32_t quotient_level = (abs_level * 5243) >> 19;
+            val = (int16_t)(temp_level < 0 ? -quotient_level : quotient_level);
+        } else {
+            // Positive level (right side): unipolar scaling (0V to +6V) scaling up from 0V
+            int32_t uni_val = (val + 2048) >> 1; // 0..2047
+            val = (int16_t)((uni_val * abs_scale * 5243) >> 19);
+        }
+    } else {
+        int32_t temp_level = val * abs_scale;
+        int16_t scaled = (int16_t)((temp_level * 5243) >> 19);
+        val = (signed_level >= 0) ? scaled : -scaled;
+    }
+    // 2. Scale Quantization
+    if (current_scale != SCALE_OFF) {
+        int note = 60 + ((val * 9 + 128) >> 8);
+        int q_note = quantize_to_scale(note, current_scale);
+        int32_t temp_note = (q_note - 60) * 256;
+        int32_t abs_note = temp_note < 0 ? -temp_note : temp_note;
+        int32_t quotient_note = (abs_note * 58255) >> 19;
+        val = (int16_t)(temp_note < 0 ? -quotient_note : quotient_note);
+        if (val > 2047) val = 2047;
+        if (val < -2048) val = -2048;
+    }
+    return val;
+}
+
+// S&H / smooth random endpoints through level and quantizer. Reworked only when the raw
+// values, level or scale change (once a step), not on every sample.
+inline void __attribute__((always_inline)) update_random_levels(ChannelState& state, const ChannelConfig& ch_config, uint8_t current_scale) {
+    if (state.rand_current != state.rand_key_current || state.rand_next != state.rand_key_next ||
+        ch_config.level != state.rand_key_level || current_scale != state.rand_key_scale) {
+        state.rand_key_current = state.rand_current;
+        state.rand_key_next = state.rand_next;
+        state.rand_key_level = ch_config.level;
+        state.rand_key_scale = current_scale;
+        state.rand_q_current = scale_and_quantize_val(state.rand_current, ch_config, current_scale);
+        state.rand_q_next = scale_and_quantize_val(state.rand_next, ch_config, current_scale);
+    }
+}
+
+// ============================================================================
+// Engine
+// ============================================================================
+
+// Jacks, in ComputerCard::Input order
+enum EngineJack {
+    JACK_AUDIO1 = 0,
+    JACK_AUDIO2,
+    JACK_CV1,
+    JACK_CV2,
+    JACK_PULSE1,
+    JACK_PULSE2
+};
+
+// One sample of the jacks: inputs filled in before process(), outputs read after. An
+// output keeps its last value until the engine writes it again.
+struct EngineJacks {
+    int16_t audio_in[2] = {0, 0};
+    int16_t cv_in[2] = {0, 0};
+    bool pulse_in[2] = {false, false};
+    bool pulse_rising[2] = {false, false};
+    bool connected[6] = {false, false, false, false, false, false};
+
+    int16_t audio_out[2] = {0, 0};
+    int32_t cv_out_mv[2] = {0, 0};      // before the card's calibration
+    bool pulse_out[2] = {false, false};
+};
+
+class ClockworkEngine {
+public:
+    // Core 0. init() once the LUTs are built and settings loaded.
+    void init(const ChannelConfig channels[6]);
+    void calculate_state_inverses(int ch, uint8_t shape, uint8_t param);
+    void publish_params(const SavedSettings& s, bool pulse1_connected, bool paused, uint32_t manual_reset_counter);
+
+    // Core 1, once a sample
+    void process(EngineJacks& io);
+    void reset_channels(uint8_t global_seed);
+
+    // Parameters as Core 1 last took them from g_shared_params
+    const SharedParams& params() const { return cached_params_; }
+
+    // Owned by Core 1, bar the shape inverses and ext_sync_pulses (set with the
+    // parameters) and the MIDI note fields, which Core 0 writes as notes arrive
+    ChannelState states_[6];
+
+    // External sync engine variables on Core 1
+    volatile uint32_t ext_period_samples_ = 0;
+    volatile uint32_t sync_sample_counter_ = 0;
+    volatile uint32_t samples_since_last_pulse_ = 0;
+    volatile bool external_clock_active_ = false;
+    volatile uint32_t ext_pulse_counter_ = 0;
+
+    // MIDI sync variables shared between Core 0 and Core 1
+    volatile uint32_t midi_clock_tick_count_ = 0;
+    volatile uint32_t midi_reset_counter_ = 0;
+    volatile uint32_t midi_period_samples_ = 0;
+    volatile uint32_t samples_since_last_midi_clock_ = 999999;
+    volatile uint32_t midi_pulse_counter_ = 0;
+    volatile uint32_t master_phase_ = 0;
+
+private:
+    SharedParams cached_params_ = {};
+
+    // Smoothed clock periods in 1/256 samples; the *_period_samples_ above are these rounded
+    uint32_t ext_period_q8_ = 0;
+    uint32_t midi_period_q8_ = 0;
+};
+
+void ClockworkEngine::init(const ChannelConfig channels[6]) {
+    for (int i = 0; i < 6; i++) {
+        calculate_state_inverses(i, channels[i].wave_shape, channels[i].wave_param);
+        states_[i].ext_sync_pulses = 4;
+        states_[i].ext_pulse_ch_counter = 0;
+        for (int j = 0; j < 64; j++) {
+            if (i >= 4) {
+                states_[i].random_history[j] = (int16_t)(rand() % 256);
+            } else {
+                states_[i].random_history[j] = (int16_t)((rand() % 4096) - 2048);
+            }
+        }
+        states_[i].rand_current = states_[i].random_history[0];
+        states_[i].rand_next = states_[i].random_history[1];
+    }
+}
+
+void ClockworkEngine::calculate_state_inverses(int ch, uint8_t shape, uint8_t param) {
+    if (ch >= 4) {
+        return; // No pre-calculations needed for digital pulse outputs
+    }
+    // Clamp parameters as the shapes do (the LUTs were worked out for the same range)
+    uint32_t clamped_param = param;
+    if (clamped_param < 2) clamped_param = 2;
+    if (clamped_param > 253) clamped_param = 253;
+
+    if (shape == WAVE_TRIANGLE || shape == WAVE_HUMP) {
+        states_[ch].inv_skew = inv_skew_lut[clamped_param];
+        states_[ch].inv_rem = inv_rem_lut[clamped_param];
+    } else if (shape == WAVE_TRAPEZOID) {
+        states_[ch].inv_skew = inv_trap_lut[clamped_param];
+    } else if (shape == WAVE_RANDOM_SH) {
+        states_[ch].inv_slew = inv_slew_lut[clamped_param];
+    } else if (shape == WAVE_RATCHET) {
+        // Map 0-255 parameter to ratchet subdivisions: 2, 3, 4, 6, 8, 12, 16
+        uint8_t ratchet_table[] = {2, 3, 4, 6, 8, 12, 16};
+        int idx = (param * 7) >> 8;
+        if (idx < 0) idx = 0;
+        if (idx > 6) idx = 6;
+        states_[ch].ratchet_count = ratchet_table[idx];
+    }
+}
+
+void ClockworkEngine::publish_params(const SavedSettings& s, bool pulse1_connected, bool paused, uint32_t manual_reset_counter) {
+    uint32_t next_idx = 1 - g_shared_params_idx;
+    volatile SharedParams &p = g_shared_params[next_idx];
+
+    p.bpm = s.bpm;
+    p.sync_source = pulse1_connected ? 1 : s.sync_source;
+    p.reset_mode = s.reset_mode;
+    p.ext_ppqn = s.ext_ppqn;
+    p.global_swing = s.global_swing;
+    p.global_humanize = s.global_humanize;
+    p.global_seed = s.global_seed;
+    p.global_paused = paused;
+    p.manual_reset_counter = manual_reset_counter;
+    
+    // Pre-calculate baseline x1 step increment: (bpm * 2^32) / (60 * SAMPLE_RATE)
+    p.base_increment = ((uint64_t)s.bpm << 32) / SAMPLES_PER_MINUTE;
+
+    // Pre-calculate global swing Q16 multipliers (runs on Core 0)
+    uint32_t s_q8 = ((uint32_t)s.global_swing * 256) / 100;
+    if (s_q8 > 128) s_q8 = 128; // Cap swing offset at 50% to prevent extreme/unstable clocks
+    if (s_q8 > 0) {
+        p.swing_mult_even = (256 * 65536) / (256 + s_q8);
+        p.swing_mult_odd = (256 * 65536) / (256 - s_q8);
+    } else {
+        p.swing_mult_even = 65536;
+        p.swing_mult_odd = 65536;
+    }
+    p.swing_recip_even = (uint32_t)((1ULL << 46) / p.swing_mult_even);
+    p.swing_recip_odd = (uint32_t)((1ULL << 46) / p.swing_mult_odd);
+
+    // Glide: one-pole pitch smoothing with a time constant of glide^2 * 8 samples at
+    // 24kHz, as first tuned. The pole is raised to 24000 / SAMPLE_RATE so the curve is
+    // the same at any rate; Core 1 then needs a single Q32 multiply per sample.
+    for (int i = 0; i < 6; i++) {
+        uint32_t g = s.channels[i].glide;
+        if (g == 0) {
+            p.glide_coef[i] = 0;
+        } else {
+            double tau = (double)(g * g * 8);
+            double pole = pow(tau / (1.0 + tau), 24000.0 / SAMPLE_RATE);
+            uint32_t coef = (uint32_t)((1.0 - pole) * 4294967296.0);
+            p.glide_coef[i] = coef ? coef : 1;
+        }
+    }
+
+    // Update external sync pulses counts per channel division-free on Core 0
+    for (int i = 0; i < 6; i++) {
+        uint8_t mod = s.channels[i].get_clock_modifier();
+        if (mod >= 33) mod = 19;
+        uint32_t pulses = ((uint32_t)s.ext_ppqn * 65536) / clock_multipliers_q16[mod];
+        if (pulses == 0) pulses = 1;
+        states_[i].ext_sync_pulses = pulses;
+    }
+
+    std::memcpy((void*)p.channels, s.channels, sizeof(s.channels));
+    // Do NOT copy states_ here. Core 1 owns states_ exclusively.
+    // Copying would silently teleport phase/step/rand values mid-audio-sample.
+
+    // Flip index atomically
+    g_shared_params_idx = next_idx;
+}
+
+void __not_in_flash_func(ClockworkEngine::reset_channels)(uint8_t global_seed) {
+    ext_pulse_counter_ = 0;
+    midi_pulse_counter_ = 0;
+    master_phase_ = 0;
+    for (int i = 0; i < 6; i++) {
+        states_[i].phase = 0;
+        states_[i].step_index = 0;
+        states_[i].loop_step_count = 0;
+        states_[i].pitch_q24 = 0;
+        // Compute correct initial step_active from euclidean pattern at step_index=0.
+        // Without this, every channel fires on the very first beat regardless of offset.
+        {
+            volatile const ChannelConfig& vcfg = g_shared_params[g_shared_params_idx].channels[i];
+            uint8_t eu_steps   = vcfg.euclidean_steps;
+            uint8_t eu_fills   = vcfg.euclidean_fills;
+            // get_euclidean_offset() = (quantizer_scale_and_offset >> 4) & 0x0F
+            uint8_t eu_offset  = (vcfg.quantizer_scale_and_offset >> 4) & 0x0F;
+            if (eu_steps > 0 && eu_fills > 0) {
+                uint32_t adjusted = eu_offset % eu_steps; // step_index=0
+                uint32_t num = adjusted * eu_fills;
+                uint32_t rem = num - (num / eu_steps) * eu_steps;
+                states_[i].step_active = (rem < (uint32_t)eu_fills);
+            } else {
+                states_[i].step_active = true;
+            }
+        }
+        states_[i].ext_pulse_ch_counter = 0;
+        states_[i].step_triggered = true;
+        states_[i].bounce_decay = 0;
+        states_[i].delay_impulse_counter = 0;
+        states_[i].delay_write_ptr = 0;
+        states_[i].delay_out = 0;
+        states_[i].rand_pending = false;
+        states_[i].rand_pending_val = 0;
+        states_[i].bounce_decay_coeff = 65536; // Reset to neutral so CV_DELAY bounce decays correctly after reset
+        states_[i].last_value = 0;
+        states_[i].last_gate_high = false;
+        states_[i].telemetry_max = 0;
+        states_[i].telemetry_min = 0;
+        states_[i].last_q_input_note = INT16_MIN;
+        states_[i].last_q_scale = 0xFF;
+        states_[i].last_q_output_note = 60;
+        states_[i].jitter_phase = 0;
+
+        if (i < 4) {
+            std::memset(delay_buffers[i], 0, (delay_buffer_masks[i] + 1) * sizeof(int16_t));
+        }
+
+        // Seed the generator uniquely for each channel
+        rand_seed = 0x12345678U + ((uint32_t)global_seed * 0x7FEDCBA9U) + (uint32_t)i * 0x13579BDFU;
+
+        for (int j = 0; j < 64; j++) {
+            if (i >= 4) {
+                states_[i].random_history[j] = (int16_t)(fast_rand() & 0xFF);
+            } else {
+                states_[i].random_history[j] = (int16_t)((fast_rand() & 0xFFF) - 2048);
+            }
+        }
+        states_[i].rand_current = states_[i].random_history[0];
+        states_[i].rand_next = states_[i].random_history[1];
+    }
+}
+
+void __not_in_flash_func(ClockworkEngine::process)(EngineJacks& io) {
+    // Sync external period counters (one per ISR call at 48kHz)
+    sync_sample_counter_++;
+    samples_since_last_pulse_++;
+    samples_since_last_midi_clock_++;
+
+    // Load parameters from Core 0
+    uint32_t active_idx = g_shared_params_idx;
+
+    bool external_pulse_received = false;
+
+    static uint32_t last_active_idx = 0xFFFFFFFF;
+    if (active_idx != last_active_idx) {
+        last_active_idx = active_idx;
+        volatile SharedParams &p = g_shared_params[active_idx];
+        cached_params_.bpm = p.bpm;
+        cached_params_.sync_source = p.sync_source;
+        cached_params_.reset_mode = p.reset_mode;
+        cached_params_.ext_ppqn = p.ext_ppqn;
+        cached_params_.global_swing = p.global_swing;
+        cached_params_.global_humanize = p.global_humanize;
+        cached_params_.global_seed = p.global_seed;
+        cached_params_.global_paused = p.global_paused;
+        cached_params_.manual_reset_counter = p.manual_reset_counter;
+        cached_params_.base_increment = p.base_increment;
+        cached_params_.swing_mult_even = p.swing_mult_even;
+        cached_params_.swing_mult_odd = p.swing_mult_odd;
+        cached_params_.swing_recip_even = p.swing_recip_even;
+        cached_params_.swing_recip_odd = p.swing_recip_odd;
+        for (int i = 0; i < 6; i++) {
+            cached_params_.glide_coef[i] = p.glide_coef[i];
+            cached_params_.channels[i].clock_modifier = p.channels[i].clock_modifier;
+            cached_params_.channels[i].euclidean_steps = p.channels[i].euclidean_steps;
+            cached_params_.channels[i].euclidean_fills = p.channels[i].euclidean_fills;
+            cached_params_.channels[i].wave_shape = p.channels[i].wave_shape;
+            cached_params_.channels[i].wave_param = p.channels[i].wave_param;
+            cached_params_.channels[i].probability = p.channels[i].probability;
+            cached_params_.channels[i].quantizer_scale_and_offset = p.channels[i].quantizer_scale_and_offset;
+            cached_params_.channels[i].loop_length = p.channels[i].loop_length;
+            cached_params_.channels[i].level = p.channels[i].level;
+            cached_params_.channels[i].glide = p.channels[i].glide;
+        }
+    }
+
+    static uint8_t last_global_seed = 0xFF;
+    bool seed_changed = (cached_params_.global_seed != last_global_seed);
+    if (seed_changed) {
+        last_global_seed = cached_params_.global_seed;
+    }
+
+    static bool first_run = true;
+    if (first_run || seed_changed) {
+        reset_channels(cached_params_.global_seed);
+        first_run = false;
+    }
+
+    // Detect MIDI Reset
+    static uint32_t last_seen_midi_resets = 0;
+    uint32_t current_midi_resets = midi_reset_counter_;
+    if (current_midi_resets != last_seen_midi_resets) {
+        last_seen_midi_resets = current_midi_resets;
+        reset_channels(cached_params_.global_seed);
+    }
+
+    // Parse MIDI clock tick
+    static uint32_t last_seen_midi_ticks = 0;
+    uint32_t current_midi_ticks = midi_clock_tick_count_;
+    bool midi_clock_tick_received = false;
+    if (current_midi_ticks != last_seen_midi_ticks) {
+        last_seen_midi_ticks = current_midi_ticks;
+        midi_clock_tick_received = true;
+        samples_since_last_midi_clock_ = 0;
+    }
+
+    bool midi_clock_active = (samples_since_last_midi_clock_ < 2 * SAMPLE_RATE);
+
+    static uint32_t sync_midi_sample_counter = 0;
+    sync_midi_sample_counter++;
+
+    static uint32_t last_midi_period_candidate = 0;
+    bool midi_pulse_processed = false;
+
+    if (!midi_clock_active) {
+        midi_pulse_counter_ = 0;
+    }
+
+    if (midi_clock_tick_received) {
+        uint32_t period = sync_midi_sample_counter;
+        sync_midi_sample_counter = 0;
+
+        uint32_t ppqn = 24;
+        uint32_t min_period = SAMPLES_PER_MINUTE / (300 * ppqn);
+        uint32_t max_period = SAMPLES_PER_MINUTE / (30 * ppqn);
+        if (min_period < 5) min_period = 5;
+        if (max_period > 10 * SAMPLE_RATE) max_period = 10 * SAMPLE_RATE;
+
+        bool is_restart = (midi_period_samples_ > 0) && (period > SAMPLE_RATE / 2); // 500ms threshold
+        if (midi_pulse_counter_ == 0 || is_restart) {
+            for (int i = 0; i < 6; i++) {
+                states_[i].phase = 0;
+                states_[i].step_index = 0;
+                states_[i].loop_step_count = 0;
+                {
+                    volatile const ChannelConfig& vcfg = g_shared_params[g_shared_params_idx].channels[i];
+                    uint8_t eu_steps  = vcfg.euclidean_steps;
+                    uint8_t eu_fills  = vcfg.euclidean_fills;
+                    uint8_t eu_offset = (vcfg.quantizer_scale_and_offset >> 4) & 0x0F;
+                    if (eu_steps > 0 && eu_fills > 0) {
+                        uint32_t adjusted = eu_offset % eu_steps;
+                        uint32_t num = adjusted * eu_fills;
+                        uint32_t rem = num - (num / eu_steps) * eu_steps;
+                        states_[i].step_active = (rem < (uint32_t)eu_fills);
+                    } else {
+                        states_[i].step_active = true;
+                    }
+                }
+                states_[i].ext_pulse_ch_counter = 0;
+                states_[i].step_triggered = true;
+                states_[i].bounce_decay = 0;
+                states_[i].delay_impulse_counter = 0;
+            }
+            if (midi_period_samples_ == 0 || is_restart) {
+                if (midi_period_samples_ == 0) {
+                    midi_period_samples_ = safe_div_u32(SAMPLES_PER_MINUTE, (uint32_t)cached_params_.bpm * ppqn);
+                    midi_period_q8_ = midi_period_samples_ << 8;
+                }
+            }
+            midi_pulse_counter_ = 1;
+            last_midi_period_candidate = 0;
+        } else {
+            if (period >= min_period && period <= max_period) {
+                if (midi_pulse_counter_ == 1) {
+                    last_midi_period_candidate = period;
+                    midi_pulse_counter_ = 2;
+                } else if (midi_pulse_counter_ == 2) {
+                    uint32_t diff = (period > last_midi_period_candidate) ? (period - last_midi_period_candidate) : (last_midi_period_candidate - period);
+                    if (diff * 8 <= last_midi_period_candidate) {
+                        midi_period_samples_ = period;
+                        midi_period_q8_ = period << 8;
+                        midi_pulse_counter_ = 3;
+                        midi_pulse_processed = true;
+                    } else {
+                        last_midi_period_candidate = period;
+                    }
+                } else {
+                    midi_period_q8_ += ((int32_t)(period << 8) - (int32_t)midi_period_q8_) >> 3;
+                    midi_period_samples_ = (midi_period_q8_ + 128) >> 8;
+                    midi_pulse_counter_++;
+                    midi_pulse_processed = true;
+                }
+            }
+        }
+    }
+
+    // Detect external clock (Pulse 1, Jack 5)
+    if (io.pulse_rising[0]) {
+        uint32_t period = sync_sample_counter_;
+        sync_sample_counter_ = 0;
+
+        uint32_t ppqn = cached_params_.ext_ppqn;
+        if (ppqn == 0) ppqn = 4; // safety fallback
+        
+        // Calculate valid period bounds corresponding to 30 to 300 BPM at the active PPQN
+        uint32_t min_period = SAMPLES_PER_MINUTE / (300 * ppqn);
+        uint32_t max_period = SAMPLES_PER_MINUTE / (30 * ppqn);
+        if (min_period < 50) min_period = 50;
+        if (max_period > 10 * SAMPLE_RATE) max_period = 10 * SAMPLE_RATE;
+
+        static uint32_t last_period_candidate = 0;
+
+        // Detect a restart if the clock has stopped for a significant period
+        bool is_restart = external_clock_active_ && (ext_period_samples_ > 0) && (period > 2 * ext_period_samples_);
+        if (!external_clock_active_ || is_restart) {
+            // First pulse of the clock: reset phases to start in perfect alignment
+            // ONLY if MIDI clock is not taking priority
+            if (!midi_clock_active) {
+                for (int i = 0; i < 6; i++) {
+                    states_[i].phase = 0;
+                    states_[i].step_index = 0;
+                    states_[i].loop_step_count = 0;
+                    {
+                        volatile const ChannelConfig& vcfg = g_shared_params[g_shared_params_idx].channels[i];
+                        uint8_t eu_steps  = vcfg.euclidean_steps;
+                        uint8_t eu_fills  = vcfg.euclidean_fills;
+                        uint8_t eu_offset = (vcfg.quantizer_scale_and_offset >> 4) & 0x0F;
+                        if (eu_steps > 0 && eu_fills > 0) {
+                            uint32_t adjusted = eu_offset % eu_steps;
+                            uint32_t num = adjusted * eu_fills;
+                            uint32_t rem = num - (num / eu_steps) * eu_steps;
+                            states_[i].step_active = (rem < (uint32_t)eu_fills);
+                        } else {
+                            states_[i].step_active = true;
+                        }
+                    }
+                    states_[i].ext_pulse_ch_counter = 0;
+                    states_[i].step_triggered = true;
+                    states_[i].bounce_decay = 0;
+                    states_[i].delay_impulse_counter = 0;
+                }
+            }
+            external_clock_active_ = true;
+            samples_since_last_pulse_ = 0;
+            if (ext_period_samples_ == 0 || is_restart) {
+                // Keep the last measured period if restarting, to avoid startup glitches
+                if (ext_period_samples_ == 0) {
+                    ext_period_samples_ = safe_div_u32(SAMPLES_PER_MINUTE, (uint32_t)cached_params_.bpm * ppqn);
+                    ext_period_q8_ = ext_period_samples_ << 8;
+                }
+            }
+            ext_pulse_counter_ = 0; // Start counter at 0 on first pulse
+            last_period_candidate = 0;
+        } else {
+            // Clock is already active, process the interval period if within valid bounds
+            if (period >= min_period && period <= max_period) {
+                if (ext_pulse_counter_ == 0) {
+                    // Store the first measured interval as a candidate
+                    last_period_candidate = period;
+                    ext_pulse_counter_ = 1;
+                    samples_since_last_pulse_ = 0;
+                } else if (ext_pulse_counter_ == 1) {
+                    // Check consistency with the first interval (within 12.5%)
+                    uint32_t diff = (period > last_period_candidate) ? (period - last_period_candidate) : (last_period_candidate - period);
+                    if (diff * 8 <= last_period_candidate) {
+                        // Consistent: lock instantly and snap the running period
+                        ext_period_samples_ = period;
+                        ext_period_q8_ = period << 8;
+                        ext_pulse_counter_ = 2; // Locked state
+                        external_pulse_received = true;
+                    } else {
+                        // Inconsistent: treat this as the new candidate
+                        last_period_candidate = period;
+                    }
+                    samples_since_last_pulse_ = 0;
+                } else {
+                    // Already locked: apply PPQN-adaptive smoothing window
+                    uint32_t shift = 4;
+                    if (ppqn == 1) {
+                        shift = 2;
+                    } else if (ppqn == 4) {
+                        shift = 3;
+                    }
+                    // Averaged in 1/256 samples: a whole-sample average sticks up to 2^shift
+                    // samples off (short, under jitter) and the nudge below turns that
+                    // into a steady phase lead
+                    ext_period_q8_ += ((int32_t)(period << 8) - (int32_t)ext_period_q8_) >> shift;
+                    ext_period_samples_ = (ext_period_q8_ + 128) >> 8;
+                    samples_since_last_pulse_ = 0;
+                    ext_pulse_counter_++;
+                    external_pulse_received = true;
+                }
+            }
+        }
+    }
+
+    uint32_t sync_ppqn = 4;
+    uint32_t sync_pulse_counter = 0;
+    bool sync_pulse_received = false;
+
+    if (midi_clock_active) {
+        sync_ppqn = 24;
+        // The first tick (phase 0) leaves the counter at 1, so tick n counts n + 1; before
+        // any tick it is 0
+        sync_pulse_counter = midi_pulse_counter_ ? midi_pulse_counter_ - 1 : 0;
+        sync_pulse_received = midi_pulse_processed;
+    } else if (external_clock_active_ && ext_period_samples_ > 0) {
+        sync_ppqn = cached_params_.ext_ppqn;
+        sync_pulse_counter = ext_pulse_counter_;
+        sync_pulse_received = external_pulse_received;
+    }
+
+    // Timeout external clock
+    if (samples_since_last_pulse_ > (2 * SAMPLE_RATE)) { // 2 seconds
+        external_clock_active_ = false;
+        // Keep ext_period_samples_ intact as the flywheel memory
+        ext_pulse_counter_ = 0;
+        for (int i = 0; i < 6; i++) {
+            states_[i].ext_pulse_ch_counter = 0;
+        }
+    }
+
+    // Handle Reset Input (Pulse 2, Jack 6) or Manual/Factory Reset from Core 0
+    static uint32_t last_manual_reset_counter = 0;
+    bool manual_reset_triggered = (cached_params_.manual_reset_counter != last_manual_reset_counter);
+    if (manual_reset_triggered) {
+        last_manual_reset_counter = cached_params_.manual_reset_counter;
+    }
+
+    bool run_gate_paused = cached_params_.global_paused;
+    bool pulse2_connected = io.connected[JACK_PULSE2];
+
+    if ((pulse2_connected && io.pulse_rising[1] && cached_params_.reset_mode == 0) || manual_reset_triggered) {
+        // Reset Mode: Align all step counts and phases to 0
+        reset_channels(cached_params_.global_seed);
+    } else if (pulse2_connected && cached_params_.reset_mode == 1) {
+        // Run Gate Mode: Pause clock execution when Pulse 2 is LOW, reset phases on transition
+        static bool was_pulse2_low = true;
+        if (!io.pulse_in[1]) {
+            run_gate_paused = true;
+            if (!was_pulse2_low) {
+                // Transitioned from HIGH to LOW (run end): Reset all phases, steps, and loops immediately!
+                reset_channels(cached_params_.global_seed);
+                was_pulse2_low = true;
+            }
+        } else {
+            if (was_pulse2_low) {
+                // Transitioned from LOW to HIGH (run start): align all phases and step indices to 0 for instant sync!
+                reset_channels(cached_params_.global_seed);
+                was_pulse2_low = false;
+            }
+        }
+    }
+
+    // Determine base step increment
+    uint32_t base_inc = cached_params_.base_increment;
+    if (midi_clock_active && midi_period_samples_ > 0) {
+        static uint32_t last_midi_period = 0;
+        static uint32_t cached_midi_base_inc = 0;
+        if (midi_period_q8_ != last_midi_period) {
+            last_midi_period = midi_period_q8_;
+            cached_midi_base_inc = period_q4_to_increment(midi_period_q8_ >> 4, 24);
+        }
+        base_inc = cached_midi_base_inc;
+    } else if (external_clock_active_ && ext_period_samples_ > 0 && cached_params_.ext_ppqn > 0) {
+        static uint32_t last_active_idx = 0xFFFFFFFF;
+        static uint32_t last_ext_period = 0;
+        static uint32_t cached_ext_base_inc = 0;
+        if (active_idx != last_active_idx || ext_period_q8_ != last_ext_period) {
+            last_active_idx = active_idx;
+            last_ext_period = ext_period_q8_;
+            cached_ext_base_inc = period_q4_to_increment(ext_period_q8_ >> 4, cached_params_.ext_ppqn);
+        }
+        base_inc = cached_ext_base_inc;
+    }
+
+    // Global swing is applied per-channel inside the channel loop below.
+
+    // Static variables for analog trigger state tracking (Schmitt trigger)
+    static bool last_analog_states[4] = {false, false, false, false};
+
+    // Pre-compute rising-edge gate status for all 6 channels based on the previous sample
+    bool gate_rising[6] = {false};
+    for (int ch = 0; ch < 6; ch++) {
+        bool current_gate_high = (states_[ch].last_value > 0);
+        if (current_gate_high && !states_[ch].last_gate_high) {
+            gate_rising[ch] = true;
+        }
+        states_[ch].last_gate_high = current_gate_high;
+    }
+
+    if (!run_gate_paused) {
+        master_phase_ += base_inc;
+    }
+
+    // CV delay tick (every DELAY_DECIMATION samples)
+    static uint32_t delay_tick_count = 0;
+    bool delay_tick = (delay_tick_count == 0);
+    if (++delay_tick_count >= DELAY_DECIMATION) {
+        delay_tick_count = 0;
+    }
+
+    // Process all 6 channels
+    for (int i = 0; i < 6; i++) {
+        // Snapshot the volatile shared config in one memcpy to guarantee a
+        // consistent view (no torn reads between individual volatile field loads).
+        const ChannelConfig &ch_config = cached_params_.channels[i];
+        ChannelState &state = states_[i];
+
+        int16_t local_prob = ch_config.probability;
+        int16_t local_param = ch_config.wave_param;
+        int16_t local_modifier = ch_config.get_clock_modifier();
+        uint8_t trigger_src = ch_config.get_trigger_source();
+        int16_t local_fills = ch_config.euclidean_fills;
+        uint8_t current_scale = ch_config.get_quantizer_scale();
+
+        if (trigger_src == 7) {
+            if (state.midi_trigger_pending) {
+                state.midi_trigger_pending = false;
+                state.phase = 0;
+                state.step_active = true;
+                state.step_triggered = true;
+            }
+        }
+
+        bool is_one_shot = (ch_config.wave_shape == WAVE_GATE ||
+                            ch_config.wave_shape == WAVE_RATCHET ||
+                            ch_config.wave_shape == WAVE_ENVELOPE ||
+                            ch_config.wave_shape == WAVE_LOG_ENVELOPE ||
+                            ch_config.wave_shape == WAVE_RANDOM_SH ||
+                            ch_config.wave_shape == WAVE_RANDOM_SM);
+
+        // Check if a cable is connected to this channel's dedicated input jack (Jacks 1-4 for Channels 0-3 only)
+        bool input_connected = (i < 4) && io.connected[i];
+        int32_t channel_cv = 0;
+        if (input_connected) {
+            if (i == 0) channel_cv = io.audio_in[0];
+            else if (i == 1) channel_cv = io.audio_in[1];
+            else if (i == 2) channel_cv = io.cv_in[0];
+            else if (i == 3) channel_cv = io.cv_in[1];
+        }
+
+        // Schmitt trigger for analog channel trigger detection
+        bool is_analog_triggered = false;
+        if (input_connected) {
+            bool last_state = last_analog_states[i];
+            if (!last_state && channel_cv > 1000) {
+                last_analog_states[i] = true;
+                is_analog_triggered = true;
+            } else if (last_state && channel_cv < 200) {
+                last_analog_states[i] = false;
+            }
+        }
+
+        // Rising-edge trigger status for channel i
+        bool channel_trigger = false;
+        if (input_connected) {
+            channel_trigger = is_analog_triggered;
+        }
+
+        // WAVE_GATE / WAVE_RATCHET / LFO Shapes: Modulate parameter by channel-specific CV
+        if (input_connected && ch_config.wave_shape != WAVE_RANDOM_SH && ch_config.wave_shape != WAVE_RANDOM_SM && ch_config.wave_shape != WAVE_ENVELOPE && ch_config.wave_shape != WAVE_LOG_ENVELOPE && ch_config.wave_shape != WAVE_CV_DELAY) {
+            int32_t cv_mod = channel_cv >> 4; // Map -2048..2047 to -128..127
+            local_param += cv_mod;
+            if (local_param < 0) local_param = 0;
+            if (local_param > 255) local_param = 255;
+        }
+
+        // Apply clock modifier Q16 multiplier
+        if (local_modifier < 0 || local_modifier >= 34) {
+            local_modifier = 20;
+        }
+        uint32_t phase_inc = mul_u32_u32_shift16(base_inc, clock_multipliers_q16[local_modifier]);
+
+        // Apply global swing per-channel (only for x2 and faster clock multipliers)
+        if (cached_params_.global_swing > 0 && local_modifier >= 21) {
+            if (state.loop_step_count % 2 == 0) {
+                phase_inc = mul_u32_u32_shift16(phase_inc, cached_params_.swing_mult_even);
+            } else {
+                phase_inc = mul_u32_u32_shift16(phase_inc, cached_params_.swing_mult_odd);
+            }
+        }
+
+        // Step-rate dependent limits, reworked only when the step rate changes
+        if (phase_inc != state.ctl_phase_inc) {
+            state.ctl_phase_inc = phase_inc;
+            state.min_trig_phase = MIN_TRIG_SAMPLES * phase_inc;
+            uint32_t gap_phase = MIN_TRIG_GAP_SAMPLES * phase_inc;
+            state.max_trig_phase = (gap_phase < 0xFFFFFFFF) ? 0xFFFFFFFF - gap_phase : 0xFFFFFFFF;
+            state.delay_step_ticks = safe_div_u32(0xFFFFFFFFU, phase_inc * DELAY_DECIMATION);
+        }
+
+        bool is_envelope_triggered_mode = ((ch_config.wave_shape == WAVE_ENVELOPE || ch_config.wave_shape == WAVE_LOG_ENVELOPE) && input_connected);
+
+        if (is_envelope_triggered_mode) {
+            // Triggered Envelope Generator Mode: Bypasses standard clock step index advance
+            if (channel_trigger) {
+                state.phase = 0;
+                state.step_active = true;
+                state.jitter_phase = 0;
+            } else if (state.phase < 0xFFFFFFFF) {
+                uint32_t old_phase = state.phase;
+                state.phase += phase_inc;
+                if (state.phase < old_phase) {
+                    state.phase = 0xFFFFFFFF; // Clamp decay output at 0
+                }
+            }
+        } else if (!run_gate_paused) {
+            // Align phase to match external clock pulse grid
+            if (trigger_src == 0 && (midi_clock_active || (external_clock_active_ && ext_period_samples_ > 0)) && sync_pulse_received) {
+                uint32_t expected_phase = 0;
+                if (sync_ppqn > 0) {
+                    // 2^32 itself doesn't fit: at 1 PPQN this was 0, and divided channels
+                    // snapped to phase 0 on every pulse
+                    uint32_t pulse_phase_step = (sync_ppqn > 1) ? (uint32_t)(0x100000000ULL / sync_ppqn) : 0xFFFFFFFFU;
+                    uint32_t step = (uint32_t)(((uint64_t)pulse_phase_step * clock_multipliers_q16[local_modifier]) >> 16);
+                    expected_phase = sync_pulse_counter * step;
+                }
+                int32_t phase_diff = (int32_t)(expected_phase - state.phase);
+                
+                // If we are in the initial lock phase (first 8 pulses) or phase error is very large (> 1/8th cycle),
+                // snap phase directly to expected_phase for instant, perfect synchronization.
+                uint32_t abs_diff = (phase_diff < 0) ? -phase_diff : phase_diff;
+                if (sync_pulse_counter < 8 || abs_diff > 0x20000000) {
+                    state.phase = expected_phase;
+                } else {
+                    int32_t nudge = phase_diff / 16;
+                    if (nudge < 0) {
+                        if (state.phase < (uint32_t)(-nudge)) {
+                            state.phase = 0;
+                        } else {
+                            state.phase += nudge;
+                        }
+                    } else if (nudge > 0) {
+                        if (state.phase > 0xFFFFFFFFU - (uint32_t)nudge) {
+                            state.phase = 0xFFFFFFFFU;
+                        } else {
+                            state.phase += nudge;
+                        }
+                    }
+                }
+            }
+
+            uint32_t old_phase = state.phase;
+            if (trigger_src > 0 && is_one_shot) {
+                if (state.phase < 0xFFFFFFFF) {
+                    state.phase += phase_inc;
+                    if (state.phase < old_phase) {
+                        state.phase = 0xFFFFFFFF;
+                    }
+                }
+            } else {
+                state.phase += phase_inc;
+            }
+
+            bool step_wrap = false;
+            if (trigger_src == 7) {
+                step_wrap = false;
+            } else if (trigger_src > 0) {
+                step_wrap = gate_rising[trigger_src - 1];
+            } else {
+                step_wrap = (state.phase < old_phase);
+            }
+
+            // Check clock phase wrap (next step)
+            if (step_wrap) {
+                state.step_triggered = true;
+                if (trigger_src > 0) {
+                    state.phase = 0; // Reset phase on trigger
+                }
+                // Apply humanize timing jitter on step start
+                if (cached_params_.global_humanize > 0) {
+                    uint32_t max_j = 5368709ULL * cached_params_.global_humanize;
+                    if (max_j > 0) {
+                        state.jitter_phase = mul_u32_u32_high(fast_rand(), max_j);
+                    } else {
+                        state.jitter_phase = 0;
+                    }
+                } else {
+                    state.jitter_phase = 0;
+                }
+
+                // Advance step indices
+                state.step_index++;
+                if (ch_config.euclidean_steps > 0) {
+                    if (state.step_index >= ch_config.euclidean_steps) {
+                        state.step_index = 0;
+                    }
+                } else {
+                    if (state.step_index >= 16) {
+                        state.step_index = 0;
+                    }
+                }
+
+                // Advance loop step counters
+                state.loop_step_count++;
+                uint8_t loop_len = ch_config.loop_length; // 0 = infinite, 1..64 = steps
+                if (loop_len > 0 && state.loop_step_count >= loop_len) {
+                    state.loop_step_count = 0;
+                    state.step_index = 0;
+                    state.phase = 0; // Reset phase to align sines/LFOs perfectly at loop start
+                }
+
+                // Populate random history on every step in infinite mode
+                if (ch_config.loop_length == 0) {
+                    if (i >= 4) {
+                        state.random_history[state.loop_step_count & 63] = (int16_t)(fast_rand() & 0xFF);
+                    } else {
+                        state.random_history[state.loop_step_count & 63] = (int16_t)((fast_rand() & 0xFFF) - 2048);
+                    }
+                }
+
+                // Calculate Euclidean step state
+                if (ch_config.euclidean_steps > 0) {
+                    uint32_t offset = ch_config.get_euclidean_offset();
+                    uint32_t adjusted_step = (state.step_index + offset) % ch_config.euclidean_steps;
+                    uint32_t num = adjusted_step * local_fills;
+                    uint32_t den = ch_config.euclidean_steps;
+                    uint32_t rem = num - safe_div_u32(num, den) * den;
+                    state.step_active = (rem < (uint32_t)local_fills);
+                } else {
+                    state.step_active = true;
+                }
+
+                // Apply trigger probability
+                if (state.step_active) {
+                    if (local_prob < 100) {
+                        uint8_t roll;
+                        if (ch_config.loop_length > 0) {
+                            uint32_t hist_val = state.random_history[state.loop_step_count % ch_config.loop_length];
+                            if (i < 4) {
+                                int32_t val_abs = (int16_t)hist_val;
+                                if (val_abs < 0) val_abs = -val_abs;
+                                roll = (uint8_t)((val_abs * 100) >> 11);
+                            } else {
+                                roll = (uint8_t)((hist_val * 100) >> 8);
+                            }
+                        } else {
+                            roll = mul_u32_u32_high(fast_rand(), 100);
+                        }
+                        if (roll >= local_prob) {
+                            state.step_active = false;
+                        }
+                    }
+                }
+
+                // Humanize loop trigger mutation (fills/ghost notes) starting at 50%
+                if (cached_params_.global_humanize > 50) {
+                    uint32_t mutate_chance = (cached_params_.global_humanize - 50) / 2;
+                    if (mul_u32_u32_high(fast_rand(), 100) < mutate_chance) {
+                        state.step_active = !state.step_active;
+                    }
+                }
+
+                // Sample random gate width for RANDOM shape on Pulse outputs (Channels 4 & 5)
+                if (i >= 4 && ch_config.wave_shape == 4) {
+                    if (ch_config.loop_length > 0) {
+                        uint8_t loop_len_r = ch_config.loop_length;
+                        uint8_t idx = state.loop_step_count % loop_len_r;
+                        int16_t r_val = state.random_history[idx];
+                        if (cached_params_.global_humanize > 50) {
+                            uint32_t mutate_chance = (cached_params_.global_humanize - 50);
+                            if (mul_u32_u32_high(fast_rand(), 100) < mutate_chance) {
+                                r_val = (int16_t)(fast_rand() & 0xFF);
+                            }
+                        }
+                        state.rand_current = r_val;
+                    } else {
+                        state.rand_current = state.random_history[state.loop_step_count & 63];
+                    }
+                }
+
+                // Fetch S&H random targets on new step.
+                // Store into rand_pending_val so the voltage latch is deferred
+                // until the humanize jitter delay expires (see rendering below).
+                // Without humanize this fires at jitter_phase==0 and pending
+                // resolves on the same sample the gate opens — perfectly in sync.
+                if (state.step_active && (ch_config.wave_shape == WAVE_RANDOM_SH || ch_config.wave_shape == WAVE_RANDOM_SM)) {
+                    state.rand_pending = true;
+                    if (input_connected) {
+                        state.rand_pending_val = channel_cv;
+                        state.rand_next = channel_cv;
+                    } else {
+                        state.rand_pending_val = state.rand_next;
+                        if (ch_config.loop_length > 0) {
+                            uint8_t loop_len_r = ch_config.loop_length;
+                            uint8_t next_idx = (state.loop_step_count + 1) % loop_len_r;
+                            int16_t next_val = state.random_history[next_idx];
+                            
+                            // Non-destructive loop mutation starting at 50%
+                            if (cached_params_.global_humanize > 50) {
+                                uint32_t mutate_chance = (cached_params_.global_humanize - 50);
+                                if (mul_u32_u32_high(fast_rand(), 100) < mutate_chance) {
+                                    // Scale mutation to +/- 1 octave (approx 341 steps)
+                                    int16_t offset = (int16_t)(((fast_rand() & 3) - 1) * 341);
+                                    if (offset == 0) offset = 341;
+                                    next_val += offset;
+                                    if (next_val > 2047) next_val = 2047 - (fast_rand() & 0xFF);
+                                    if (next_val < -2048) next_val = -2048 + (fast_rand() & 0xFF);
+                                }
+                            }
+                            state.rand_next = next_val;
+                        } else {
+                            int16_t next_val = (int16_t)((fast_rand() & 0xFFF) - 2048);
+                            state.rand_next = next_val;
+                            state.random_history[state.loop_step_count & 63] = next_val;
+                        }
+                    }
+                }
+            }
+        }
+
+
+        // Output waveform generation
+        int16_t val = 0;
+        bool humanize_muted = false;
+
+        if (run_gate_paused) {
+            // Keep outputs at low level when run gate is paused (rest at 0V)
+            val = 0;
+        } else if (trigger_src == 7) {
+            // ==========================================
+            // MIDI Mode Synthesis & CV Generation
+            // ==========================================
+            uint32_t rendering_phase = state.phase;
+            
+            if (i < 4) {
+                // Analog/CV Outputs 0-3
+                switch (ch_config.wave_shape) {
+                    case WAVE_GATE: {
+                        val = state.midi_note_active ? 2047 : 0;
+                        break;
+                    }
+                    case WAVE_RATCHET: {
+                        uint32_t trig_width = 429496730; // ~10% of LFO cycle
+                        uint32_t min_delay = trig_width;
+                        uint32_t max_delay = 0xFFFFFFFF - trig_width;
+                        uint32_t delay = min_delay + mul_u32_u32_shift8(local_param, max_delay - min_delay);
+                        bool trig1 = rendering_phase < trig_width;
+                        bool trig2 = rendering_phase >= delay && rendering_phase < (delay + trig_width);
+                        bool high = state.midi_note_active && (trig1 || trig2);
+                        val = high ? 2047 : 0;
+                        break;
+                    }
+                    case WAVE_SINE: {
+                        uint32_t offset = (uint32_t)local_param << 24;
+                        val = interpolate_sine(rendering_phase + offset);
+                        break;
+                    }
+                    case WAVE_TRIANGLE: {
+                        uint32_t clamped = local_param;
+                        if (clamped < 2) clamped = 2;
+                        if (clamped > 253) clamped = 253;
+                        uint32_t skew_point = clamped << 24;
+                        uint32_t inv_skew = inv_skew_lut[clamped];
+                        uint32_t inv_rem = inv_rem_lut[clamped];
+                        if (rendering_phase < skew_point) {
+                            val = -2048 + (int16_t)mul_u32_u32_high(rendering_phase, inv_skew);
+                        } else {
+                            uint32_t rem_phase = rendering_phase - skew_point;
+                            val = 2047 - (int16_t)mul_u32_u32_high(rem_phase, inv_rem);
+                        }
+                        break;
+                    }
+                    case WAVE_SAW_UP: {
+                        int32_t lin = -2048 + (int16_t)mul_u32_u32_high(rendering_phase, 4095);
+                        int32_t exp = -2048 + (4095 - interpolate_exp(rendering_phase));
+                        int32_t log = -2048 + interpolate_exp(0xFFFFFFFF - rendering_phase);
+                        if (local_param == 128) {
+                            val = lin;
+                        } else if (local_param < 128) {
+                            val = log + (((lin - log) * local_param) >> 7);
+                        } else {
+                            val = lin + (((exp - lin) * (local_param - 128)) >> 7);
+                        }
+                        break;
+                    }
+                    case WAVE_SAW_DOWN: {
+                        int32_t lin = 2047 - (int16_t)mul_u32_u32_high(rendering_phase, 4095);
+                        int32_t exp = 2047 - (4095 - interpolate_exp(rendering_phase));
+                        int32_t log = 2047 - interpolate_exp(0xFFFFFFFF - rendering_phase);
+                        if (local_param == 128) {
+                            val = lin;
+                        } else if (local_param < 128) {
+                            val = log + (((lin - log) * local_param) >> 7);
+                        } else {
+                            val = lin + (((exp - lin) * (local_param - 128)) >> 7);
+                        }
+                        break;
+                    }
+                    case WAVE_ENVELOPE: {
+                        uint32_t mult_phase = mul_u32_u16_shift8_clamp(rendering_phase, env_multiplier_lut[local_param]);
+                        uint16_t env_val = interpolate_exp(mult_phase);
+                        val = (int16_t)(env_val >> 1); // 0..2047
+                        val = (val * state.midi_velocity) / 127;
+                        break;
+                    }
+                    case WAVE_LOG_ENVELOPE: {
+                        uint32_t mult_phase = mul_u32_u16_shift8_clamp(rendering_phase, env_multiplier_lut[local_param]);
+                        uint16_t env_val = 4095 - interpolate_exp(0xFFFFFFFFU - mult_phase);
+                        val = (int16_t)(env_val >> 1); // 0..2047
+                        val = (val * state.midi_velocity) / 127;
+                        break;
+                    }
+                    case WAVE_RANDOM_SH: { // S&H -> Pitch CV
+                        int note_num = state.midi_note_num;
+                        if (current_scale != SCALE_OFF) {
+                            note_num = quantize_to_scale(note_num, current_scale);
+                        }
+                        int32_t temp_note = (note_num - 60) * 256;
+                        int32_t abs_note = temp_note < 0 ? -temp_note : temp_note;
+                        int32_t quotient_note = (abs_note * 58255) >> 19;
+                        val = (int16_t)(temp_note < 0 ? -quotient_note : quotient_note);
+                        if (val > 2047) val = 2047;
+                        if (val < -2048) val = -2048;
+                        break;
+                    }
+                    case WAVE_RANDOM_SM: { // Smooth -> Velocity CV (0V to 6V)
+                        val = (state.midi_velocity * 2047) / 127;
+                        break;
+                    }
+                    case WAVE_TRAPEZOID: {
+                        uint32_t clamped = local_param;
+                        if (clamped < 2) clamped = 2;
+                        if (clamped > 253) clamped = 253;
+                        uint32_t F = (clamped * 0x40000000ULL) >> 8;
+                        uint32_t R = 0x80000000ULL - F;
+                        if (rendering_phase < R) {
+                            val = -2048 + (int16_t)mul_u32_u32_high(rendering_phase, state.inv_skew);
+                        } else if (rendering_phase < R + F) {
+                            val = 2047;
+                        } else if (rendering_phase < 2 * R + F) {
+                            uint32_t rem = rendering_phase - (R + F);
+                            val = 2047 - (int16_t)mul_u32_u32_high(rem, state.inv_skew);
+                        } else {
+                            val = -2048;
+                        }
+                        break;
+                    }
+                    case WAVE_HUMP: {
+                        uint32_t clamped = local_param;
+                        if (clamped < 2) clamped = 2;
+                        if (clamped > 253) clamped = 253;
+                        uint32_t skew_point = clamped << 24;
+                        if (rendering_phase < skew_point) {
+                            uint32_t frac = mul_u32_u32_high(rendering_phase, state.inv_skew);
+                            if (frac > 4095) frac = 4095;
+                            val = interpolate_sine(frac << 18);
+                        } else {
+                            uint32_t rem_phase = rendering_phase - skew_point;
+                            uint32_t frac = mul_u32_u32_high(rem_phase, state.inv_rem);
+                            if (frac > 4095) frac = 4095;
+                            val = interpolate_sine(0x40000000U + (frac << 18));
+                        }
+                        break;
+                    }
+                    case WAVE_CV_DELAY: {
+                        break;
+                    }
+                    case WAVE_MATH: {
+                        uint32_t skew_point = 0x80000000U;
+                        if (rendering_phase < skew_point) {
+                            val = -2048 + (int16_t)mul_u32_u32_high(rendering_phase, inv_skew_lut[128]);
+                        } else {
+                            uint32_t rem_phase = rendering_phase - skew_point;
+                            val = 2047 - (int16_t)mul_u32_u32_high(rem_phase, inv_rem_lut[128]);
+                        }
+                        break;
+                    }
+                }
+            } else {
+                // Digital Gate/Pulse Outputs 4-5
+                uint8_t scaled_delay = ch_config.level / 2;
+                uint32_t delay_phase = (uint32_t)scaled_delay * 42949672U;
+                if (rendering_phase < delay_phase) {
+                    val = 0;
+                } else {
+                    uint32_t shifted_phase = rendering_phase - delay_phase;
+                    switch (ch_config.wave_shape) {
+                        case 0: { // GATE
+                            val = state.midi_note_active ? 2047 : 0;
+                            break;
+                        }
+                        case 1: { // RATCHET
+                            uint32_t trig_width = 429496730;
+                            uint32_t min_delay = trig_width;
+                            uint32_t max_delay = 0xFFFFFFFF - trig_width;
+                            uint32_t delay = min_delay + mul_u32_u32_shift8(local_param, max_delay - min_delay);
+                            bool trig1 = shifted_phase < trig_width;
+                            bool trig2 = shifted_phase >= delay && shifted_phase < (delay + trig_width);
+                            bool high = state.midi_note_active && (trig1 || trig2);
+                            val = high ? 2047 : 0;
+                            break;
+                        }
+                        case 2: { // TRIGGER (DELAY)
+                            uint32_t trig_width = state.min_trig_phase;
+                            if (trig_width > 3865470565U) {
+                                trig_width = 3865470565U;
+                            }
+                            uint32_t max_extra_delay = 3865470565U - trig_width;
+                            uint32_t extra_delay = mul_u32_u32_shift8(local_param, max_extra_delay);
+                            bool high = state.midi_note_active && (shifted_phase >= extra_delay) && (shifted_phase < (extra_delay + trig_width));
+                            val = high ? 2047 : 0;
+                            break;
+                        }
+                        case 3: { // BURST
+                            uint32_t num_pulses = 1 + (((uint32_t)local_param * 7) >> 8);
+                            uint32_t W = segment_widths_ram[num_pulses - 1];
+                            uint32_t k = mul_u32_u32_high(shifted_phase, num_pulses);
+                            uint32_t phase_within_segment = shifted_phase - k * W;
+                            uint32_t pulse_width = W >> 1;
+                            uint32_t min_trig_phase = state.min_trig_phase;
+                            if (pulse_width < min_trig_phase) {
+                                pulse_width = min_trig_phase;
+                            }
+                            bool high = state.midi_note_active && (phase_within_segment < pulse_width);
+                            val = high ? 2047 : 0;
+                            break;
+                        }
+                        case 4: { // RANDOM
+                            val = state.midi_note_active ? ((state.midi_velocity * 2047) / 127) : 0;
+                            break;
+                        }
+                        case 5: { // UTILITY
+                            if (local_param >= 192) {
+                                val = (!run_gate_paused) ? 2047 : 0;
+                            } else {
+                                uint32_t N = 1;
+                                if (local_param >= 128)      N = 24;
+                                else if (local_param >= 64)  N = 4;
+
+                                bool high = (!run_gate_paused) && utility_pulse_high(master_phase_, base_inc, cached_params_.bpm, N);
+                                val = high ? 2047 : 0;
+                            }
+                            break;
+                        }
+                    }
+                }
+            }
+        } else {
+            uint32_t base_phase = state.phase;
+            if (i < 4 && ch_config.euclidean_steps == 0) {
+                uint32_t offset = (uint32_t)ch_config.euclidean_fills * 16843009U;
+                if (is_one_shot) {
+                    if (state.phase < offset) {
+                        base_phase = 0;
+                    } else {
+                        base_phase = state.phase - offset;
+                    }
+                } else {
+                    base_phase = state.phase - offset;
+                }
+            }
+            uint32_t rendering_phase = base_phase;
+            bool can_humanize = (ch_config.wave_shape == WAVE_GATE || 
+                                 ch_config.wave_shape == WAVE_RATCHET || 
+                                 ch_config.wave_shape == WAVE_ENVELOPE || 
+                                 ch_config.wave_shape == WAVE_RANDOM_SH || 
+                                 ch_config.wave_shape == WAVE_RANDOM_SM ||
+                                 i >= 4);
+            if (can_humanize) {
+                if (state.phase < (uint32_t)state.jitter_phase) {
+                    humanize_muted = true;
+                } else {
+                    // Jitter delay just expired or never existed: latch any pending S&H voltage
+                    // exactly here so CV and gate edge are sample-accurate.
+                    if (state.rand_pending) {
+                        state.rand_current = state.rand_pending_val;
+                        state.rand_pending  = false;
+                    }
+                    rendering_phase = base_phase - state.jitter_phase;
+                }
+            }
+
+            if (i < 4) {
+                switch (ch_config.wave_shape) {
+                    case WAVE_GATE: {
+                        uint32_t threshold = (uint32_t)local_param << 24;
+                        if (local_param > 0) {
+                            uint32_t min_trig_phase = state.min_trig_phase;
+                            if (threshold < min_trig_phase) {
+                                threshold = min_trig_phase;
+                            }
+                            if (local_param < 255) {
+                                uint32_t max_trig_phase = state.max_trig_phase;
+                                if (threshold > max_trig_phase) {
+                                    threshold = max_trig_phase;
+                                }
+                            }
+                        }
+                        bool high = state.step_active && (rendering_phase < threshold);
+                        val = high ? 2047 : 0;
+                        break;
+                    }
+                    case WAVE_RATCHET: {
+                        // Ratchet: a double trigger where local_param controls the spacing between them
+                        // Fixed trigger width: 10% of the step cycle
+                        uint32_t trig_width = 429496730; // ~10% of 0xFFFFFFFF
+                        uint32_t min_trig_phase = state.min_trig_phase;
+                        if (trig_width < min_trig_phase) {
+                            trig_width = min_trig_phase;
+                        }
+                        if (trig_width > 1932735282U) { // Cap at 45% of 0xFFFFFFFF to avoid underflow
+                            trig_width = 1932735282U;
+                        }
+                        // Scale local_param to determine the start phase of the second trigger
+                        // Spacing can range from right after the first trigger (trig_width) to near the end of the step
+                        uint32_t min_delay = trig_width;
+                        uint32_t max_delay = 0xFFFFFFFF - trig_width;
+                        uint32_t delay = min_delay + mul_u32_u32_shift8(local_param, max_delay - min_delay);
+
+                        bool trig1 = rendering_phase < trig_width;
+                        bool trig2 = rendering_phase >= delay && rendering_phase < (delay + trig_width);
+                        bool high = state.step_active && (trig1 || trig2);
+                        val = high ? 2047 : 0;
+                        break;
+                    }
+                    case WAVE_SINE: {
+                        uint32_t offset = (uint32_t)local_param << 24;
+                        int16_t sine_val = interpolate_sine(rendering_phase + offset);
+                        val = state.step_active ? sine_val : 0;
+                        break;
+                    }
+                    case WAVE_TRIANGLE: {
+                        uint32_t clamped = local_param;
+                        if (clamped < 2) clamped = 2;
+                        if (clamped > 253) clamped = 253;
+                        uint32_t skew_point = clamped << 24;
+                        uint32_t inv_skew = inv_skew_lut[clamped];
+                        uint32_t inv_rem = inv_rem_lut[clamped];
+
+                        if (rendering_phase < skew_point) {
+                            val = -2048 + (int16_t)mul_u32_u32_high(rendering_phase, inv_skew);
+                        } else {
+                            uint32_t rem_phase = rendering_phase - skew_point;
+                            val = 2047 - (int16_t)mul_u32_u32_high(rem_phase, inv_rem);
+                        }
+                        val = state.step_active ? val : 0;
+                        break;
+                    }
+                    case WAVE_SAW_UP: {
+                        int32_t lin = -2048 + (int16_t)mul_u32_u32_high(rendering_phase, 4095);
+                        int32_t exp = -2048 + (4095 - interpolate_exp(rendering_phase));
+                        int32_t log = -2048 + interpolate_exp(0xFFFFFFFF - rendering_phase);
+                        
+                        if (local_param == 128) {
+                            val = lin;
+                        } else if (local_param < 128) {
+                            // Blend log ↔ linear
+                            val = log + (((lin - log) * local_param) >> 7);
+                        } else {
+                            // Blend linear ↔ exp
+                            val = lin + (((exp - lin) * (local_param - 128)) >> 7);
+                        }
+                        val = state.step_active ? val : 0;
+                        break;
+                    }
+                    case WAVE_SAW_DOWN: {
+                        int32_t lin = 2047 - (int16_t)mul_u32_u32_high(rendering_phase, 4095);
+                        int32_t exp = 2047 - (4095 - interpolate_exp(rendering_phase));
+                        int32_t log = 2047 - interpolate_exp(0xFFFFFFFF - rendering_phase);
+
+                        if (local_param == 128) {
+                            val = lin;
+                        } else if (local_param < 128) {
+                            // Blend log ↔ linear
+                            val = log + (((lin - log) * local_param) >> 7);
+                        } else {
+                            // Blend linear ↔ exp
+                            val = lin + (((exp - lin) * (local_param - 128)) >> 7);
+                        }
+                        val = state.step_active ? val : 0;
+                        break;
+                    }
+                    case WAVE_ENVELOPE: {
+                        // Prevent wrapping (decay stops at 0). env_multiplier_lut modulates the decay time.
+                        // For WAVE_ENVELOPE, we want the trigger timing to be swung, but the decay phase increment
+                        // to remain constant so the envelope decay duration doesn't alternate between steps.
+                        uint32_t env_phase = rendering_phase;
+                        if (cached_params_.global_swing > 0 && local_modifier >= 14) {
+                            // (phase << 16) / swing_mult, clamped: the reciprocal gives phase << 14 / mult
+                            uint32_t swing_recip = (state.loop_step_count % 2 == 0) ? cached_params_.swing_recip_even : cached_params_.swing_recip_odd;
+                            uint32_t calc = mul_u32_u32_high(rendering_phase, swing_recip);
+                            env_phase = (calc >= 0x40000000U) ? 0xFFFFFFFFU : (calc << 2);
+                        }
+                        uint32_t mult_phase = mul_u32_u16_shift8_clamp(env_phase, env_multiplier_lut[local_param]);
+                        uint16_t env_val = interpolate_exp(mult_phase);
+                        val = (int16_t)(env_val >> 1); // unipolar envelope 0 to 2047
+                        val = state.step_active ? val : 0;
+                        break;
+                    }
+                    case WAVE_RANDOM_SH: {
+                        uint32_t clamped = local_param;
+                        if (clamped < 2) clamped = 2;
+                        uint32_t slew_duration = clamped << 24;
+                        uint32_t inv_slew = inv_slew_lut[clamped];
+
+                        update_random_levels(state, ch_config, current_scale);
+                        int16_t q_current = state.rand_q_current;
+                        int16_t q_next = state.rand_q_next;
+
+                        if (rendering_phase < slew_duration) {
+                            uint32_t frac = mul_u32_u32_high(rendering_phase, inv_slew);
+                            val = q_current + (((q_next - q_current) * (int32_t)frac) >> 16);
+                        } else {
+                            val = q_next;
+                        }
+                        val = state.step_active ? val : 0;
+                        break;
+                    }
+                    case WAVE_RANDOM_SM: {
+                        uint32_t clamped = local_param;
+                        if (clamped < 2) clamped = 2;
+                        uint32_t slew_duration = clamped << 24;
+                        uint32_t inv_slew = inv_slew_lut[clamped];
+
+                        update_random_levels(state, ch_config, current_scale);
+                        int16_t q_current = state.rand_q_current;
+                        int16_t q_next = state.rand_q_next;
+
+                        if (rendering_phase < slew_duration) {
+                            uint32_t frac = mul_u32_u32_high(rendering_phase, inv_slew);
+                            // Map frac (0..65536) to a half-sine cycle (0x40000000..0xC0000000) for smooth cosine curve
+                            uint32_t table_phase = (frac << 15) + 0x40000000;
+                            int16_t sine_val = interpolate_sine(table_phase);
+                            uint32_t interp_frac = 2048 - sine_val; // ranges from 1 to 4095 (Q12)
+                            val = q_current + (((q_next - q_current) * (int32_t)interp_frac) >> 12);
+                        } else {
+                            val = q_next;
+                        }
+                        val = state.step_active ? val : 0;
+                        break;
+                    }
+                    case WAVE_CV_DELAY: {
+                        // Runs at DELAY_RATE so the buffers keep their length in time; the
+                        // output holds between ticks
+                        if (!delay_tick) {
+                            val = state.delay_out;
+                            break;
+                        }
+                        uint32_t mask = delay_buffer_masks[i];
+                        uint32_t max_samples = mask + 1;
+                        uint32_t delay_samples = 0;
+                        uint32_t step_period_samples = state.delay_step_ticks;
+                        if (step_period_samples > (2 * DELAY_RATE)) step_period_samples = (2 * DELAY_RATE);
+                        if (step_period_samples < (DELAY_RATE / 100)) step_period_samples = (DELAY_RATE / 100);
+                        if (local_param < 128) {
+                            delay_samples = 10 + (((uint32_t)local_param * (max_samples - 20)) >> 7);
+                        } else {
+                            uint32_t sync_idx = (local_param - 128) >> 4;
+                            switch (sync_idx) {
+                                case 0: delay_samples = step_period_samples / 16; break;
+                                case 1: delay_samples = step_period_samples / 8; break;
+                                case 2: delay_samples = step_period_samples / 4; break;
+                                case 3: delay_samples = step_period_samples / 2; break;
+                                case 4: delay_samples = step_period_samples; break;
+                                case 5: delay_samples = (step_period_samples * 3) / 2; break;
+                                case 6: delay_samples = step_period_samples * 2; break;
+                                default: delay_samples = step_period_samples * 4; break;
+                            }
+                            if (delay_samples > max_samples - 10) {
+                                  delay_samples = max_samples - 10;
+                            }
+                            if (delay_samples < 10) {
+                                  delay_samples = 10;
+                            }
+                        }
+
+                        int32_t input_val = 0;
+                        uint32_t actual_delay = delay_samples;
+
+                        if (input_connected) {
+                            input_val = channel_cv;
+                        } else {
+                            if (state.step_triggered) {
+                                if (state.step_active) {
+                                    state.delay_impulse_counter = (DELAY_RATE / 1000); // 1ms pulse width
+                                    state.bounce_decay = 2047;
+                                    uint32_t denom = (step_period_samples * ((uint32_t)local_prob + 10)) / 60;
+                                    if (denom < 1) denom = 1;
+                                    uint32_t sub = 262144 / denom;
+                                    if (sub > 65536) sub = 65536;
+                                    state.bounce_decay_coeff = 65536 - sub;
+                                }
+                                state.step_triggered = false;
+                            }
+
+                            // Decay bounce envelope on every tick
+                            state.bounce_decay = ((int32_t)state.bounce_decay * (int32_t)state.bounce_decay_coeff) >> 16;
+
+                            if (state.delay_impulse_counter > 0) {
+                                input_val = 2047;
+                                if (state.delay_impulse_counter > 1) {
+                                    state.delay_impulse_counter -= 1;
+                                } else {
+                                    state.delay_impulse_counter = 0;
+                                }
+                            } else {
+                                input_val = 0;
+                            }
+
+                            uint32_t min_delay = (DELAY_RATE * 25) / 10000; // 2.5ms
+                            if (delay_samples > min_delay) {
+                                actual_delay = min_delay + (((delay_samples - min_delay) * state.bounce_decay) / 2047);
+                            }
+                        }
+
+                        uint32_t write_ptr = state.delay_write_ptr;
+                        uint32_t read_ptr = (write_ptr - actual_delay) & mask;
+                        int16_t delayed_val = delay_buffers[i][read_ptr];
+
+                        int32_t fb_gain = ((int32_t)local_prob * 15) >> 4; // 0 to 93
+                        int32_t next_write_val = input_val + ((delayed_val * fb_gain) / 100);
+                        
+                        if (next_write_val > 2047) next_write_val = 2047;
+                        if (next_write_val < -2048) next_write_val = -2048;
+
+                        delay_buffers[i][write_ptr] = (int16_t)next_write_val;
+                        state.delay_write_ptr = (write_ptr + 1) & mask;
+
+                        state.delay_out = delayed_val;
+                        val = delayed_val;
+                        break;
+                    }
+                    case WAVE_TRAPEZOID: {
+                        uint32_t clamped = local_param;
+                        if (clamped < 2) clamped = 2;
+                        if (clamped > 253) clamped = 253;
+                        uint32_t F = (clamped * 0x40000000ULL) >> 8;
+                        uint32_t R = 0x80000000ULL - F;
+                        if (rendering_phase < R) {
+                            val = -2048 + (int16_t)mul_u32_u32_high(rendering_phase, state.inv_skew);
+                        } else if (rendering_phase < R + F) {
+                            val = 2047;
+                        } else if (rendering_phase < 2 * R + F) {
+                            uint32_t rem = rendering_phase - (R + F);
+                            val = 2047 - (int16_t)mul_u32_u32_high(rem, state.inv_skew);
+                        } else {
+                            val = -2048;
+                        }
+                        val = state.step_active ? val : 0;
+                        break;
+                    }
+                    case WAVE_HUMP: {
+                        uint32_t clamped = local_param;
+                        if (clamped < 2) clamped = 2;
+                        if (clamped > 253) clamped = 253;
+                        uint32_t skew_point = clamped << 24;
+                        if (rendering_phase < skew_point) {
+                            uint32_t frac = mul_u32_u32_high(rendering_phase, state.inv_skew);
+                            if (frac > 4095) frac = 4095;
+                            val = interpolate_sine(frac << 18);
+                        } else {
+                            uint32_t rem_phase = rendering_phase - skew_point;
+                            uint32_t frac = mul_u32_u32_high(rem_phase, state.inv_rem);
+                            if (frac > 4095) frac = 4095;
+                            val = interpolate_sine(0x40000000U + (frac << 18));
+                        }
+                        val = state.step_active ? val : 0;
+                        break;
+                    }
+                    case WAVE_LOG_ENVELOPE: {
+                        uint32_t env_phase = rendering_phase;
+                        if (cached_params_.global_swing > 0 && local_modifier >= 14) {
+                            // (phase << 16) / swing_mult, clamped: the reciprocal gives phase << 14 / mult
+                            uint32_t swing_recip = (state.loop_step_count % 2 == 0) ? cached_params_.swing_recip_even : cached_params_.swing_recip_odd;
+                            uint32_t calc = mul_u32_u32_high(rendering_phase, swing_recip);
+                            env_phase = (calc >= 0x40000000U) ? 0xFFFFFFFFU : (calc << 2);
+                        }
+                        uint32_t mult_phase = mul_u32_u16_shift8_clamp(env_phase, env_multiplier_lut[local_param]);
+                        uint16_t env_val = 4095 - interpolate_exp(0xFFFFFFFFU - mult_phase);
+                        val = (int16_t)(env_val >> 1); // unipolar envelope 0 to 2047
+                        val = state.step_active ? val : 0;
+                        break;
+                    }
+                    case WAVE_MATH: {
+                        // 1. Compute Carrier
+                        int16_t carrier = 0;
+                        if (input_connected) {
+                            carrier = channel_cv;
+                        } else {
+                            // Standard 50% skew triangle LFO (inv_skew/rem_lut[128])
+                            uint32_t skew_point = 0x80000000U;
+                            if (rendering_phase < skew_point) {
+                                carrier = -2048 + (int16_t)mul_u32_u32_high(rendering_phase, inv_skew_lut[128]);
+                            } else {
+                                uint32_t rem_phase = rendering_phase - skew_point;
+                                carrier = 2047 - (int16_t)mul_u32_u32_high(rem_phase, inv_rem_lut[128]);
+                            }
+                        }
+
+                        // 2. Retrieve Modulator
+                        int16_t modulator = 0;
+                        uint8_t op = local_param / 32;       // 0..7 discrete operations
+                        if (trigger_src > 0) {
+                            modulator = states_[trigger_src - 1].last_value;
+                        } else {
+                            // Neutral defaults for stand-alone mode
+                            if (op == 0 || op == 1) { // Sum, Difference
+                                modulator = 0;
+                            } else if (op == 2 || op == 4 || op == 5) { // Min, Mult, AND
+                                modulator = 2047;
+                            } else { // Max, OR, XOR
+                                modulator = -2048;
+                            }
+                        }
+
+                        // 3. Perform Operation
+                        int32_t result = carrier;
+                        switch (op) {
+                            case 0: // Mix/Sum
+                                result = (int32_t)carrier + (int32_t)modulator;
+                                break;
+                            case 1: // Difference
+                                result = (int32_t)carrier - (int32_t)modulator;
+                                break;
+                            case 2: // Minimum
+                                result = (carrier < modulator) ? carrier : modulator;
+                                break;
+                            case 3: // Maximum
+                                result = (carrier > modulator) ? carrier : modulator;
+                                break;
+                            case 4: // Multiplication (VCA/RingMod)
+                                result = ((int32_t)carrier * (int32_t)modulator) >> 11;
+                                break;
+                            case 5: // AND Logic
+                                result = (carrier > 0 && modulator > 0) ? 2047 : -2048;
+                                break;
+                            case 6: // OR Logic
+                                result = (carrier > 0 || modulator > 0) ? 2047 : -2048;
+                                break;
+                            case 7: // XOR Logic
+                                result = ((carrier > 0) ^ (modulator > 0)) ? 2047 : -2048;
+                                break;
+                        }
+
+                        if (result > 2047) result = 2047;
+                        if (result < -2048) result = -2048;
+                        val = (int16_t)result;
+                        val = state.step_active ? val : 0;
+                        break;
+                    }
+                }
+            } else {
+                // Specialized Digital Pulse shapes for Channels 4 and 5
+                // level parameter (0-200) acts as Phase Offset (Pulse Delay)
+                // where 0 = 0% delay, 200 = 100% delay (internally scaled 0-100 by division by 2)
+                uint8_t scaled_delay = ch_config.level / 2;
+                uint32_t delay_phase = (uint32_t)scaled_delay * 42949672U;
+                if (rendering_phase < delay_phase) {
+                    val = 0;
+                } else {
+                    uint32_t shifted_phase = rendering_phase - delay_phase;
+                    switch (ch_config.wave_shape) {
+                        case 0: { // GATE
+                            uint32_t width_phase = (uint32_t)local_param * 16843009U;
+                            if (local_param > 0) {
+                                uint32_t min_trig_phase = state.min_trig_phase;
+                                if (width_phase < min_trig_phase) {
+                                    width_phase = min_trig_phase;
+                                }
+                                if (local_param < 255) {
+                                    uint32_t max_trig_phase = state.max_trig_phase;
+                                    if (width_phase > max_trig_phase) {
+                                        width_phase = max_trig_phase;
+                                    }
+                                }
+                            }
+                            bool high = state.step_active && (shifted_phase < width_phase);
+                            val = high ? 2047 : 0;
+                            break;
+                        }
+                        case 1: { // RATCHET
+                            uint32_t trig_width = 429496730; // ~10% of 0xFFFFFFFF
+                            uint32_t min_trig_phase = state.min_trig_phase;
+                            if (trig_width < min_trig_phase) {
+                                trig_width = min_trig_phase;
+                            }
+                            if (trig_width > 1932735282U) { // Cap at 45% of 0xFFFFFFFF to avoid underflow
+                                trig_width = 1932735282U;
+                            }
+                            uint32_t min_delay = trig_width;
+                            uint32_t max_delay = 0xFFFFFFFF - trig_width;
+                            uint32_t delay = min_delay + mul_u32_u32_shift8(local_param, max_delay - min_delay);
+
+                            bool trig1 = shifted_phase < trig_width;
+                            bool trig2 = shifted_phase >= delay && shifted_phase < (delay + trig_width);
+                            bool high = state.step_active && (trig1 || trig2);
+                            val = high ? 2047 : 0;
+                            break;
+                        }
+                        case 2: { // TRIGGER (DELAY)
+                            uint32_t trig_width = state.min_trig_phase;
+                            if (trig_width > 3865470565U) { // 90% of 0xFFFFFFFF
+                                trig_width = 3865470565U;
+                            }
+                            uint32_t max_extra_delay = 3865470565U - trig_width;
+                            uint32_t extra_delay = mul_u32_u32_shift8(local_param, max_extra_delay);
+                            bool high = state.step_active && (shifted_phase >= extra_delay) && (shifted_phase < (extra_delay + trig_width));
+                            val = high ? 2047 : 0;
+                            break;
+                        }
+                        case 3: { // BURST
+                            uint32_t num_pulses = 1 + (((uint32_t)local_param * 7) >> 8); // 1..8
+                            uint32_t W = segment_widths_ram[num_pulses - 1];
+                            uint32_t k = mul_u32_u32_high(shifted_phase, num_pulses);
+                            uint32_t phase_within_segment = shifted_phase - k * W;
+                            uint32_t pulse_width = W >> 1;
+                            uint32_t min_trig_phase = state.min_trig_phase;
+                            if (pulse_width < min_trig_phase) {
+                                  pulse_width = min_trig_phase;
+                            }
+                            bool high = state.step_active && (phase_within_segment < pulse_width);
+                            val = high ? 2047 : 0;
+                            break;
+                        }
+                        case 4: { // RANDOM
+                            uint32_t gate_width_scale = ((uint32_t)state.rand_current * local_param) >> 8;
+                            uint32_t threshold = gate_width_scale << 24;
+                            if (local_param > 0 && state.rand_current > 0) {
+                                uint32_t min_trig_phase = state.min_trig_phase;
+                                if (threshold < min_trig_phase) {
+                                    threshold = min_trig_phase;
+                                }
+                                uint32_t max_trig_phase = state.max_trig_phase;
+                                if (threshold > max_trig_phase) {
+                                    threshold = max_trig_phase;
+                                }
+                            }
+                            bool high = state.step_active && (shifted_phase < threshold);
+                            val = high ? 2047 : 0;
+                            break;
+                        }
+                        case 5: { // UTILITY
+                            if (local_param >= 192) {
+                                val = (!run_gate_paused) ? 2047 : 0;
+                            } else {
+                                uint32_t N = 1;
+                                if (local_param >= 128)      N = 24;
+                                else if (local_param >= 64)  N = 4;
+
+                                bool high = (!run_gate_paused) && utility_pulse_high(master_phase_, base_inc, cached_params_.bpm, N);
+                                val = high ? 2047 : 0;
+                            }
+                            break;
+                        }
+                        default: {
+                            val = 0;
+                            break;
+                        }
+                    }
+                }
+            }
+            if (humanize_muted) {
+                val = 0;
+            }
+        }
+
+        // Apply Level Attenuation first (only for analog channels 0-3; digital outputs 4-5 ignore level scaling for trigger consistency)
+        if (i < 4 && ch_config.wave_shape != WAVE_RANDOM_SH && ch_config.wave_shape != WAVE_RANDOM_SM) {
+            int32_t signed_level = (int32_t)ch_config.level - 100;
+            int32_t abs_scale = signed_level >= 0 ? signed_level : -signed_level;
+            bool is_bipolar = (ch_config.wave_shape == WAVE_SINE || 
+                               ch_config.wave_shape == WAVE_TRIANGLE || 
+                               ch_config.wave_shape == WAVE_SAW_UP || 
+                               ch_config.wave_shape == WAVE_SAW_DOWN || 
+                               ch_config.wave_shape == WAVE_RANDOM_SH || 
+                               ch_config.wave_shape == WAVE_RANDOM_SM || 
+                               ch_config.wave_shape == WAVE_CV_DELAY || 
+                               ch_config.wave_shape == WAVE_TRAPEZOID);
+            if (is_bipolar) {
+                if (signed_level < 0) {
+                    // Negative level (left side): bipolar mode
+                    int32_t temp_level = (int32_t)val * abs_scale;
+                    int32_t abs_level = temp_level < 0 ? -temp_level : temp_level;
+                    int32_t quotient_level = (abs_level * 5243) >> 19;
+                    val = (int16_t)(temp_level < 0 ? -quotient_level : quotient_level);
+                } else {
+                    // Positive level (right side): unipolar scaling (0V to +6V) scaling up from 0V
+                    int32_t uni_val = ((int32_t)val + 2048) >> 1; // 0..2047
+                    val = (int16_t)((uni_val * abs_scale * 5243) >> 19);
+                }
+            } else {
+                // Unipolar shape
+                int32_t temp_level = (int32_t)val * abs_scale;
+                int16_t scaled = (int16_t)((temp_level * 5243) >> 19);
+                val = (signed_level >= 0) ? scaled : -scaled;
+            }
+        }
+
+        // Apply Scale Quantizer (Calibrated for 1V/Octave on a -6V to +6V DAC: 28.44 steps per semitone)
+        bool is_quantized = false;
+        int q_note = 60;
+        if (trigger_src == 7 && ch_config.wave_shape == WAVE_RANDOM_SH) {
+            is_quantized = true;
+            q_note = state.midi_note_num;
+            if (current_scale != SCALE_OFF) {
+                q_note = quantize_to_scale(q_note, current_scale);
+            }
+        } else if (i < 4 && state.step_active && !humanize_muted && current_scale != SCALE_OFF && 
+            ch_config.wave_shape != WAVE_GATE && ch_config.wave_shape != WAVE_RATCHET && 
+            ch_config.wave_shape != WAVE_RANDOM_SH && ch_config.wave_shape != WAVE_RANDOM_SM) {
+            int note = 60 + ((val * 9 + 128) >> 8); // ~28.44 steps per semitone with rounding
+            // Only re-run the scale search when the input semitone or scale changed.
+            // At a held step this fires once and then caches, saving ~7 comparisons/sample.
+            if ((int16_t)note != state.last_q_input_note || current_scale != state.last_q_scale) {
+                state.last_q_input_note  = (int16_t)note;
+                state.last_q_scale       = current_scale;
+                state.last_q_output_note = (int16_t)quantize_to_scale(note, current_scale);
+            }
+            q_note = state.last_q_output_note;
+            int32_t temp_note = (q_note - 60) * 256;
+            int32_t abs_note = temp_note < 0 ? -temp_note : temp_note;
+            int32_t quotient_note = (abs_note * 58255) >> 19;
+            val = (int16_t)(temp_note < 0 ? -quotient_note : quotient_note);
+            if (val > 2047) val = 2047;
+            if (val < -2048) val = -2048;
+            is_quantized = true;
+        }
+        
+        if (is_quantized) {
+            int32_t target = (int32_t)(q_note - 60) << 24;
+            uint32_t glide_coef = cached_params_.glide_coef[i];
+            if (glide_coef == 0) {
+                state.pitch_q24 = target;
+            } else {
+                // One-pole glide, at least one LSB a sample so it always lands on the note
+                uint32_t dist = (target > state.pitch_q24) ? (uint32_t)target - (uint32_t)state.pitch_q24
+                                                           : (uint32_t)state.pitch_q24 - (uint32_t)target;
+                uint32_t step = mul_u32_u32_high(dist, glide_coef);
+                if (step == 0) step = 1;
+                if (step > dist) step = dist;
+                state.pitch_q24 += (target > state.pitch_q24) ? (int32_t)step : -(int32_t)step;
+            }
+            // Update val with the smoothed gliding pitch for Audio Out 1 and 2 (channels 0 and 1)
+            int32_t smooth_val = pitch_q24_scale(state.pitch_q24, PITCH_Q24_TO_DAC);
+            if (smooth_val > 2047) smooth_val = 2047;
+            if (smooth_val < -2048) smooth_val = -2048;
+            val = (int16_t)smooth_val;
+        }
+
+        state.last_value = val;
+        if (val > state.telemetry_max) state.telemetry_max = val;
+        if (val < state.telemetry_min) state.telemetry_min = val;
+
+        // Route output value to the correct hardware channel
+        if (i == 0) {
+            io.audio_out[0] = val;
+        } else if (i == 1) {
+            io.audio_out[1] = val;
+        } else if (i == 2) {
+            // Calibrated output scaling using custom calibration mV DAC table
+            int32_t mv;
+            if (is_quantized) {
+                mv = pitch_q24_scale(state.pitch_q24, PITCH_Q24_TO_MV);
+            } else {
+                mv = ((int32_t)val * 375) >> 7;
+            }
+            io.cv_out_mv[0] = mv;
+        } else if (i == 3) {
+            // Calibrated output scaling using custom calibration mV DAC table
+            int32_t mv;
+            if (is_quantized) {
+                mv = pitch_q24_scale(state.pitch_q24, PITCH_Q24_TO_MV);
+            } else {
+                mv = ((int32_t)val * 375) >> 7;
+            }
+            io.cv_out_mv[1] = mv;
+        } else if (i == 4) {
+            io.pulse_out[0] = val > 0;
+        } else if (i == 5) {
+            io.pulse_out[1] = val > 0;
+        }
+    }
+}
@@ -0,0 +1,449 @@
+// clockwork_bench — Clockwork's six-channel engine on Linux: the 48 kHz fixed-point engine
+// checked against golden renders of the 24 kHz engine it replaced, and the cost of each.
+//
+// Every build #includes a whole main.cpp against shim/ (Pico SDK, TinyUSB and ComputerCard
+// stand-ins): clockwork_bench the current ../main.cpp, clockwork_bench_24k the 24 kHz
+// engine it replaced (ref/main_24k.cpp, see Makefile), clockwork_bench_24k_now the current
+// ../main.cpp at 24 kHz. Each scene sets the card up through
+// apply_parameter_change() and MIDI packets, as the web editor and a sequencer would, then
+// drives the jacks sample by sample. Every scene runs in a forked child so the card and
+// ProcessSample's statics start fresh.
+//
+// At every 24 kHz sample of a golden render, each output of the 48 kHz render must be
+// within a couple of LSBs (a few mV on the CV outs) of what the golden render held within
+// the scene's slack of that instant, and the pulse outs must have the same edges, each
+// moved by no more than the slack. Free running, the slack is 100 us: the 24 kHz engine
+// rounded its period to twice as coarse a sample and runs ~25 ppm fast. Under an external
+// or MIDI clock the slack is 3 ms. The clocked scenes' golden renders come from this
+// engine at 24 kHz, not the old one: its clock timing has been fixed since (MIDI clock ran
+// a tick early, the period average truncated), and timing_bench checks it against the
+// clock itself.
+// Glide never reached Core 1 at 24 kHz, so it is checked against the float glide it
+// replaces, run at 24 kHz beside it.
+//
+//   ./clockwork_bench_24k -w golden         write golden renders
+//   ./clockwork_bench_24k_now -w golden "ext clock" "midi clock"
+//   ./clockwork_bench -c golden             check against them, cost side by side
+//   ./clockwork_bench [-s sec] [scene...]   cost only
+//
+// Host ns are only relative: x86 has an FPU and a 64-bit divider, the RP2040 neither, so
+// the float glide and 64-bit divides removed cost far more on the card — compare the
+// columns, not the numbers.
+#define main clockwork_firmware_main
+#include CLOCKWORK_MAIN
+#undef main
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+// ─── Scenes ──────────────────────────────────────────────────────────────────
+struct Param { uint8_t ch, id, value; };   // apply_parameter_change(ch, id, value); ch 6 = global
+
+struct Scene {
+    const char *name;
+    double seconds;
+    std::vector<Param> params;
+    void (*drive)(ClockworksCard &card, double t);   // jacks and MIDI, once a sample (may be null)
+    uint8_t connected;                               // Input bits plugged before the params
+    uint32_t slackUs;                                // timing allowed to move against golden
+};
+
+static void midi(ClockworksCard &card, uint8_t cin, uint8_t b0, uint8_t b1 = 0, uint8_t b2 = 0)
+{
+    const uint8_t packet[4] = { cin, b0, b1, b2 };
+    card.process_incoming_midi_packet(packet);
+}
+
+// True on the first sample at or after time `at`
+static bool crossed(double t, double at) { return t >= at && t - 1.0 / SAMPLE_RATE < at; }
+
+// Pulse 1: 133 BPM at 4 PPQN, 5 ms pulses, each edge up to ±0.3 ms off the grid
+static void drive_ext_clock(ClockworksCard &card, double t)
+{
+    const double period = 60.0 / 133.0 / 4.0;
+    bool high = false;
+    long k = (long)(t / period);
+    for (long e = k - 1; e <= k + 1 && !high; e++) {
+        if (e < 0) continue;
+        double jitter = 0.0003 * std::sin(e * 2.3999);
+        double start = 0.05 + e * period + jitter;
+        high = t >= start && t < start + 0.005;
+    }
+    card.in_pulse[0] = high;
+}
+
+// MIDI clock: Start, then 24 PPQN at 100 BPM
+static void drive_midi_clock(ClockworksCard &card, double t)
+{
+    if (crossed(t, 0.02)) midi(card, 0x0F, 0xFA);
+    const double tick = 60.0 / 100.0 / 24.0;
+    double rel = t - 0.03;
+    if (rel >= 0 && (long)(rel / tick) != (long)((rel - 1.0 / SAMPLE_RATE) / tick))
+        midi(card, 0x0F, 0xF8);
+    if (crossed(t, 0.03)) midi(card, 0x0F, 0xF8);
+}
+
+// Notes on MIDI channels 1 and 2 every 250 ms, 150 ms long
+static void drive_midi_notes(ClockworksCard &card, double t)
+{
+    static const uint8_t notes[] = { 60, 67, 63, 72, 55, 70, 58, 64, 79, 48, 62, 66 };
+    for (int k = 0; k < 12; k++) {
+        double on = 0.1 + 0.25 * k;
+        uint8_t note = notes[k], vel = (uint8_t)(40 + 7 * k);
+        if (crossed(t, on)) { midi(card, 0x09, 0x90, note, vel); midi(card, 0x09, 0x91, note, vel); }
+        if (crossed(t, on + 0.15)) { midi(card, 0x08, 0x80, note, 0); midi(card, 0x08, 0x81, note, 0); }
+    }
+}
+
+// Audio 1: 2 ms triggers every 370 ms; Audio 2: a 3 Hz square into the delay;
+// CV 1: a slow sine sweeping channel 2's shape parameter
+static void drive_cv_inputs(ClockworksCard &card, double t)
+{
+    double ph = std::fmod(t, 0.37);
+    card.in_audio[0] = (t > 0.05 && ph < 0.002) ? 1800 : 0;
+    card.in_audio[1] = std::fmod(t, 1.0 / 3.0) < 1.0 / 6.0 ? 1200 : -1200;
+    card.in_cv[0] = (int16_t)(1500.0 * std::sin(2.0 * M_PI * 0.4 * t));
+}
+
+// Pulse 2 resets at 0.7 s and 1.9 s
+static void drive_reset(ClockworksCard &card, double t)
+{
+    card.in_pulse[1] = (t >= 0.7 && t < 0.71) || (t >= 1.9 && t < 1.91);
+}
+
+static const uint8_t kPulse1 = 1 << ComputerCard::Pulse1, kPulse2 = 1 << ComputerCard::Pulse2;
+static const uint8_t kAudio1 = 1 << ComputerCard::Audio1, kAudio2 = 1 << ComputerCard::Audio2;
+static const uint8_t kCV1 = 1 << ComputerCard::CV1;
+
+// Shapes: 0 GATE 1 RTCH 2 SINE 3 TRI 4 SAW+ 5 SAW- 6 TRAP 7 HUMP 8 ENV 9 LOGE 10 RSH 11 RSM
+// 12 DELAY 13 MATH; pulse outs 0 GATE 1 RTCH 2 TRIG 3 BURST 4 RANDOM 5 UTILITY.
+// Modifiers: 17 /4, 19 /2, 20 x1, 21 x2, 22 x3, 23 x4, 25 x8; 40+ MIDI channel.
+static const Scene kScenes[] = {
+    { "gates", 3.0, {
+        {0, 3, 0}, {1, 0, 21}, {1, 3, 1}, {1, 4, 100}, {2, 0, 23}, {2, 4, 10},
+        {3, 0, 19}, {3, 4, 250}, {4, 0, 23}, {4, 3, 2}, {5, 3, 3}, {5, 4, 200} }, nullptr, 0, 100 },
+    { "lfos", 4.0, {
+        {6, 0, 97}, {0, 3, 2}, {0, 4, 64}, {1, 0, 21}, {1, 3, 3}, {1, 4, 40},
+        {2, 3, 4}, {2, 4, 200}, {3, 0, 19}, {3, 3, 6}, {3, 4, 100},
+        {4, 0, 21}, {4, 3, 4}, {4, 4, 200}, {4, 7, 8}, {5, 3, 5}, {5, 4, 100} }, nullptr, 0, 100 },
+    { "shapes+swing", 4.0, {
+        {6, 0, 140}, {6, 4, 30}, {0, 0, 22}, {0, 3, 5}, {0, 4, 60}, {1, 3, 7}, {1, 4, 180},
+        {2, 0, 21}, {2, 3, 8}, {3, 0, 23}, {3, 3, 9}, {3, 4, 200},
+        {4, 0, 21}, {4, 3, 1}, {5, 3, 5}, {5, 4, 150} }, nullptr, 0, 100 },
+    { "random+euclid", 4.0, {
+        {6, 6, 5}, {0, 3, 10}, {0, 4, 64}, {0, 7, 8}, {0, 6, 2}, {1, 3, 11}, {1, 4, 200}, {1, 7, 16},
+        {2, 3, 10}, {2, 4, 30}, {3, 5, 60}, {3, 7, 8},
+        {4, 1, 8}, {4, 2, 3}, {4, 6, 2}, {5, 0, 21}, {5, 1, 5}, {5, 2, 2}, {5, 5, 70} }, nullptr, 0, 100 },
+    { "delay", 3.0, {
+        {0, 3, 12}, {0, 4, 40}, {0, 5, 60}, {1, 0, 21}, {1, 3, 12}, {1, 4, 160}, {1, 5, 80},
+        {2, 0, 19}, {2, 3, 12}, {2, 4, 200}, {2, 5, 30}, {3, 3, 2} }, nullptr, 0, 100 },
+    { "quantizer", 4.0, {
+        {0, 3, 4}, {0, 6, 3}, {0, 8, 150}, {1, 3, 3}, {1, 4, 90}, {1, 6, 2},
+        {2, 0, 21}, {2, 3, 2}, {2, 6, 6}, {3, 3, 10}, {3, 4, 100}, {3, 6, 5}, {3, 7, 4} }, nullptr, 0, 100 },
+    { "ext clock", 4.0, {
+        {6, 3, 4}, {1, 0, 21}, {1, 3, 2}, {2, 0, 19}, {2, 3, 4}, {3, 0, 23}, {3, 3, 8},
+        {4, 0, 25}, {4, 4, 64}, {5, 3, 5}, {5, 4, 100} }, drive_ext_clock, kPulse1, 3000 },
+    { "midi clock", 4.0, {
+        {1, 0, 21}, {1, 3, 2}, {2, 0, 19}, {2, 3, 4}, {3, 0, 23}, {3, 3, 8},
+        {4, 0, 25}, {4, 4, 64}, {5, 3, 5}, {5, 4, 180} }, drive_midi_clock, 0, 3000 },
+    { "midi notes", 3.2, {
+        {0, 0, 40}, {0, 3, 8}, {1, 0, 40}, {1, 3, 1}, {2, 0, 40}, {2, 3, 10}, {3, 0, 41}, {3, 3, 11},
+        {4, 0, 40}, {5, 0, 41}, {5, 3, 2} }, drive_midi_notes, 0, 100 },
+    { "humanize", 4.0, {
+        {6, 5, 40}, {0, 3, 0}, {1, 0, 21}, {1, 3, 8}, {2, 3, 10}, {2, 7, 8}, {3, 0, 23}, {3, 3, 1},
+        {4, 0, 21}, {5, 0, 23} }, nullptr, 0, 100 },
+    { "cv inputs", 3.0, {
+        {0, 3, 8}, {0, 4, 100}, {1, 3, 12}, {1, 4, 50}, {1, 5, 50}, {2, 3, 3}, {2, 4, 128} },
+        drive_cv_inputs, kAudio1 | kAudio2 | kCV1, 100 },
+    { "reset", 3.0, {
+        {0, 0, 19}, {0, 3, 4}, {1, 0, 22}, {1, 3, 2}, {2, 3, 10}, {2, 7, 4}, {3, 0, 17}, {3, 3, 3},
+        {4, 0, 22}, {5, 0, 17}, {5, 3, 3} }, drive_reset, kPulse2, 100 },
+};
+static const int kNumScenes = sizeof kScenes / sizeof kScenes[0];
+
+// ─── Render ──────────────────────────────────────────────────────────────────
+// Per sample: Audio 1, Audio 2, CV 1 mV, CV 2 mV, Pulse 1, Pulse 2
+struct Frame { int16_t out[6]; };
+
+struct Render {
+    std::vector<Frame> frames;
+    double nsPerChannelSample = 0;
+};
+
+static void setup(const Scene &s)
+{
+    for (int i = 0; i < 6; i++) card.in_connected[i] = (s.connected >> i) & 1;
+    for (const Param &p : s.params) card.apply_parameter_change(p.ch, p.id, p.value);
+}
+
+// The first pass is the render; the cost is the best of `passes`, the scene running on
+static Render render(const Scene &s, double seconds, int passes = 5)
+{
+    setup(s);
+    Render r;
+    uint32_t n = (uint32_t)(seconds * SAMPLE_RATE);
+    r.frames.resize(n);
+    std::vector<Frame> scratch(n);
+    double best = 1e300;
+    for (int pass = 0; pass < passes; pass++) {
+        std::vector<Frame> &frames = pass ? scratch : r.frames;
+        auto t0 = std::chrono::steady_clock::now();
+        for (uint32_t k = 0; k < n; k++) {
+            double t = ((double)pass * n + k) / SAMPLE_RATE;
+            host_now_us = (uint64_t)(t * 1e6);
+            if (s.drive) s.drive(card, t);
+            card.Tick();
+            Frame &f = frames[k];
+            f.out[0] = card.out_audio[0];
+            f.out[1] = card.out_audio[1];
+            f.out[2] = (int16_t)card.out_cv_mv[0];
+            f.out[3] = (int16_t)card.out_cv_mv[1];
+            f.out[4] = card.out_pulse[0];
+            f.out[5] = card.out_pulse[1];
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::nano>(t1 - t0).count());
+    }
+    r.nsPerChannelSample = best / ((double)n * 6);
+    return r;
+}
+
+// ─── Golden files ────────────────────────────────────────────────────────────
+struct GoldenHeader {
+    char magic[8];
+    uint32_t rate, frames;
+    double nsPerChannelSample;
+};
+
+static std::string golden_path(const std::string &dir, const Scene &s)
+{
+    std::string name = s.name;
+    for (char &c : name) if (c == ' ' || c == '+') c = '_';
+    return dir + "/" + name + ".bin";
+}
+
+static bool write_golden(const std::string &dir, const Scene &s, const Render &r)
+{
+    FILE *f = fopen(golden_path(dir, s).c_str(), "wb");
+    if (!f) return false;
+    GoldenHeader h = { {'C','L','K','G','O','L','D','1'}, SAMPLE_RATE, (uint32_t)r.frames.size(), r.nsPerChannelSample };
+    bool ok = fwrite(&h, sizeof h, 1, f) == 1 && fwrite(r.frames.data(), sizeof(Frame), r.frames.size(), f) == r.frames.size();
+    return fclose(f) == 0 && ok;
+}
+
+static bool read_golden(const std::string &dir, const Scene &s, GoldenHeader &h, std::vector<Frame> &frames)
+{
+    FILE *f = fopen(golden_path(dir, s).c_str(), "rb");
+    if (!f) return false;
+    bool ok = fread(&h, sizeof h, 1, f) == 1 && memcmp(h.magic, "CLKGOLD1", 8) == 0;
+    if (ok) {
+        frames.resize(h.frames);
+        ok = fread(frames.data(), sizeof(Frame), h.frames, f) == h.frames;
+    }
+    fclose(f);
+    return ok;
+}
+
+// ─── Compare ─────────────────────────────────────────────────────────────────
+struct ChannelResult {
+    uint32_t mismatches = 0;
+    int32_t worst = 0;          // largest error outside the slack window
+    double firstAt = -1;        // s
+    uint32_t edgesOld = 0, edgesNew = 0;
+    double worstEdgeUs = 0;
+};
+
+static const int32_t kTolerance[6] = { 2, 2, 6, 6, 0, 0 };   // DAC LSBs, mV, pulses
+static const int32_t kJump[6] = { 256, 256, 750, 750, 1, 1 };   // a step, not a slope, from 1/8 of range
+
+// Golden at goldRate (24 kHz), the current render at a whole multiple m of it. Each
+// sample is the output one sample period on, so golden sample n lines up with m*n + m-1.
+// Sampling a steep curve (an envelope's attack) twice as often can land up to one golden
+// step of it away, so each sample's tolerance grows by the golden's local slope.
+static ChannelResult compare_channel(const std::vector<Frame> &gold, uint32_t goldRate,
+                                     const std::vector<Frame> &cur, int c, uint32_t slackUs)
+{
+    ChannelResult res;
+    uint32_t m = SAMPLE_RATE / goldRate;
+    int32_t tol = kTolerance[c];
+    size_t w = (size_t)((uint64_t)slackUs * goldRate / 1000000) + 1;
+    for (size_t n = 0; n < gold.size() && n * m + m - 1 < cur.size(); n++) {
+        int32_t g = gold[n].out[c], v = cur[n * m + m - 1].out[c];
+        if (std::abs(v - g) <= tol) continue;
+        int32_t slope = 0;
+        for (size_t k = n > 0 ? n - 1 : 0; k <= n + 1 && k + 1 < gold.size(); k++) {
+            int32_t d = std::abs(gold[k + 1].out[c] - gold[k].out[c]);
+            if (d < kJump[c]) slope = std::max(slope, d);
+        }
+        int32_t lo = g, hi = g;
+        size_t a = n > w ? n - w : 0, b = std::min(gold.size() - 1, n + w);
+        for (size_t k = a; k <= b; k++) {
+            lo = std::min<int32_t>(lo, gold[k].out[c]);
+            hi = std::max<int32_t>(hi, gold[k].out[c]);
+        }
+        if (v >= lo - tol - slope && v <= hi + tol + slope) continue;
+        int32_t err = v < lo ? lo - v : v - hi;
+        if (res.mismatches++ == 0) res.firstAt = (double)n / goldRate;
+        if (err > res.worst) res.worst = err;
+    }
+    if (c < 4) return res;
+
+    // Pulse outs: rising edges, matched in order
+    std::vector<double> eg, ec;
+    for (size_t n = 1; n < gold.size(); n++)
+        if (gold[n].out[c] && !gold[n - 1].out[c]) eg.push_back((double)(n + 1) / goldRate);
+    for (size_t n = 1; n < cur.size() && n < gold.size() * m; n++)
+        if (cur[n].out[c] && !cur[n - 1].out[c]) ec.push_back((double)(n + 1) / SAMPLE_RATE);
+    res.edgesOld = (uint32_t)eg.size();
+    res.edgesNew = (uint32_t)ec.size();
+    for (size_t k = 0; k < eg.size() && k < ec.size(); k++)
+        res.worstEdgeUs = std::max(res.worstEdgeUs, std::fabs(ec[k] - eg[k]) * 1e6);
+    return res;
+}
+
+// ─── Glide ───────────────────────────────────────────────────────────────────
+// CV 1 (channel 2) tracks MIDI notes with glide; the float glide the engine had, run at
+// 24 kHz, is the reference: tau = glide^2 * 8 samples, the output truncated to mV.
+static bool glide_check(uint8_t glide)
+{
+    Scene s = { "glide", 3.5, { {2, 0, 40}, {2, 3, 10}, {2, 9, glide} }, nullptr, 0, 0 };
+    setup(s);
+    const double noteAt[3] = { 0.01, 0.8, 2.0 };
+    const uint8_t note[3] = { 60, 72, 53 };
+
+    float pitch = 60.0f, target = 60.0f;
+    int32_t prev = 0;
+    float tauSamples = (float)glide * (float)glide * 8.0f;
+    float coef = 1.0f / (1.0f + tauSamples);
+    int32_t worst = 0;
+    double worstAt = 0;
+    uint32_t n = (uint32_t)(s.seconds * SAMPLE_RATE), m = SAMPLE_RATE / 24000;
+    for (uint32_t k = 0; k < n; k++) {
+        double t = (double)k / SAMPLE_RATE;
+        for (int j = 0; j < 3; j++) {
+            if (crossed(t, noteAt[j])) {
+                if (j) midi(card, 0x08, 0x80, note[j - 1], 0);
+                midi(card, 0x09, 0x90, note[j], 100);
+            }
+        }
+        card.Tick();
+        if (k % m) continue;
+        // The reference sees the note from the same 24 kHz sample on
+        for (int j = 0; j < 3; j++) if (t >= noteAt[j]) target = note[j];
+        pitch += (target - pitch) * coef;
+        int32_t ref = (int32_t)((pitch - 60.0f) * 83.333333f);
+        // Against the reference's step into this sample: a note seen a 48 kHz sample apart
+        int32_t v = card.out_cv_mv[0], lo = std::min(prev, ref), hi = std::max(prev, ref);
+        int32_t err = v < lo ? lo - v : v > hi ? v - hi : 0;
+        prev = ref;
+        if (err > worst) { worst = err; worstAt = t; }
+    }
+    // Within 2 mV all the way (the float glide itself stalls a few mV short at long glides)
+    bool ok = worst <= 2 + (glide >= 64 ? 8 : 0);
+    printf("%-16s  glide %3u: worst %3d mV from the float glide (at %.3f s)%s\n", "glide", glide,
+           worst, worstAt, ok ? "" : "  FAIL");
+    return ok;
+}
+
+// ─── Driver ──────────────────────────────────────────────────────────────────
+// Each scene in a child: the card and ProcessSample's statics start fresh
+template <typename F>
+static bool in_child(F f)
+{
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0) { bool ok = f(); fflush(stdout); _exit(ok ? 0 : 1); }
+    int status = 0;
+    waitpid(pid, &status, 0);
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+static void usage()
+{
+    fprintf(stderr, "usage: clockwork_bench [-w dir | -c dir] [-s seconds] [scene...]\n");
+    exit(2);
+}
+
+int main(int argc, char **argv)
+{
+    std::string writeDir, checkDir;
+    double seconds = 0;   // 0 = each scene's own length
+    std::vector<std::string> only;
+    for (int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        if (a == "-w" && i + 1 < argc) writeDir = argv[++i];
+        else if (a == "-c" && i + 1 < argc) checkDir = argv[++i];
+        else if (a == "-s" && i + 1 < argc) seconds = atof(argv[++i]);
+        else if (a[0] == '-') usage();
+        else only.push_back(a);
+    }
+    if (!writeDir.empty() && !checkDir.empty()) usage();
+
+    printf("Clockwork engine at %d Hz (%s)\n\n", SAMPLE_RATE, CLOCKWORK_MAIN);
+    if (!checkDir.empty())
+        printf("%-16s %9s %9s %8s  %s\n", "scene", "golden ns", "ns", "per sec", "check (ns per channel-sample)");
+    else
+        printf("%-16s %9s\n", "scene", "ns/ch-smp");
+
+    int failures = 0;
+    for (const Scene &s : kScenes) {
+        if (!only.empty()) {
+            bool want = false;
+            for (const std::string &o : only) want |= o == s.name;
+            if (!want) continue;
+        }
+        bool ok = in_child([&]() {
+            Render r = render(s, seconds > 0 ? seconds : s.seconds);
+            if (!writeDir.empty()) {
+                bool written = write_golden(writeDir, s, r);
+                printf("%-16s %9.1f  %s\n", s.name, r.nsPerChannelSample,
+                       written ? golden_path(writeDir, s).c_str() : "WRITE FAILED");
+                return written;
+            }
+            if (checkDir.empty()) {
+                printf("%-16s %9.1f\n", s.name, r.nsPerChannelSample);
+                return true;
+            }
+            GoldenHeader h;
+            std::vector<Frame> gold;
+            if (!read_golden(checkDir, s, h, gold) || SAMPLE_RATE % h.rate != 0) {
+                printf("%-16s no golden render in %s\n", s.name, checkDir.c_str());
+                return false;
+            }
+            // Cost of a second of audio, this engine against the golden one
+            double perSec = (r.nsPerChannelSample * SAMPLE_RATE) / (h.nsPerChannelSample * h.rate);
+            bool same = true;
+            double edgeUs = 0;
+            std::string detail;
+            for (int c = 0; c < 6; c++) {
+                ChannelResult cr = compare_channel(gold, h.rate, r.frames, c, s.slackUs);
+                edgeUs = std::max(edgeUs, cr.worstEdgeUs);
+                bool edgesOk = cr.edgesOld == cr.edgesNew && cr.worstEdgeUs <= s.slackUs + 1e6 / h.rate;
+                if (cr.mismatches == 0 && edgesOk) continue;
+                same = false;
+                char buf[200];
+                snprintf(buf, sizeof buf, "\n    out %d: %u samples off (worst %d, first %.4f s), edges %u/%u (worst %.0f us)",
+                         c, cr.mismatches, cr.worst, cr.firstAt, cr.edgesNew, cr.edgesOld, cr.worstEdgeUs);
+                detail += buf;
+            }
+            printf("%-16s %9.1f %9.1f %7.2fx  %s, pulse edges within %.0f us%s\n", s.name, h.nsPerChannelSample,
+                   r.nsPerChannelSample, perSec, same ? "matches golden" : "FAIL", edgeUs, detail.c_str());
+            return same;
+        });
+        failures += !ok;
+    }
+
+    if (!checkDir.empty() && only.empty()) {
+        const uint8_t glides[] = { 4, 16, 40, 64 };
+        for (uint8_t g : glides) failures += !in_child([g]() { return glide_check(g); });
+    }
+    if (failures) printf("\n%d FAILED\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,75 @@
+// ComputerCard.h (host) — the card's API as plain fields, for Clockwork's main.cpp on Linux.
+//
+// Same method names and semantics as ComputerCard/ComputerCard.h for everything main.cpp
+// uses. The harness writes the public in_* fields, then calls Tick() once per sample;
+// ProcessSample's outputs land in the out_* fields (CV outputs as the millivolts asked
+// for, before calibration).
+#pragma once
+
+#include "host_sdk.h"
+
+class ComputerCard {
+public:
+    enum Knob {Main, X, Y};
+    enum Switch {Down, Middle, Up};
+    enum Input {Audio1, Audio2, CV1, CV2, Pulse1, Pulse2};
+    enum HardwareVersion_t {Proto1=0x2a, Proto2_Rev1=0x30, Rev1_1=0x0C, Unknown=0xFF};
+    enum USBPowerState_t {DFP, UFP, Unsupported};
+
+    int32_t in_knob[3] = {2048, 2048, 2048};
+    Switch  in_switch = Middle;
+    int16_t in_audio[2] = {0, 0};
+    int16_t in_cv[2] = {0, 0};
+    bool    in_pulse[2] = {false, false};
+    bool    in_connected[6] = {};
+
+    int16_t out_audio[2] = {0, 0};
+    int32_t out_cv_mv[2] = {0, 0};
+    bool    out_pulse[2] = {false, false};
+
+    virtual ~ComputerCard() {}
+    virtual void ProcessSample() = 0;
+
+    // One sample, through the RAM callback as AudioWorker calls it
+    void Tick()
+    {
+        if (audio_callback_ptr) audio_callback_ptr(audio_callback_inst);
+        else ProcessSample();
+        last_pulse[0] = in_pulse[0];
+        last_pulse[1] = in_pulse[1];
+    }
+
+    void Run() {}
+    void EnableNormalisationProbe() {}
+    static void (*audio_callback_ptr)(void*);
+    static void *audio_callback_inst;
+
+protected:
+    int32_t KnobVal(Knob k) { return in_knob[k]; }
+    Switch  SwitchVal() { return in_switch; }
+    int16_t AudioIn1() { return in_audio[0]; }
+    int16_t AudioIn2() { return in_audio[1]; }
+    int16_t CVIn1() { return in_cv[0]; }
+    int16_t CVIn2() { return in_cv[1]; }
+    bool PulseIn1() { return in_pulse[0]; }
+    bool PulseIn2() { return in_pulse[1]; }
+    bool PulseIn1RisingEdge() { return in_pulse[0] && !last_pulse[0]; }
+    bool PulseIn2RisingEdge() { return in_pulse[1] && !last_pulse[1]; }
+    bool Connected(Input i) { return in_connected[i]; }
+    bool Disconnected(Input i) { return !in_connected[i]; }
+
+    void AudioOut1(int16_t v) { out_audio[0] = v; }
+    void AudioOut2(int16_t v) { out_audio[1] = v; }
+    bool CVOut1Millivolts(int32_t mv) { out_cv_mv[0] = mv; return false; }
+    bool CVOut2Millivolts(int32_t mv) { out_cv_mv[1] = mv; return false; }
+    void PulseOut1(bool v) { out_pulse[0] = v; }
+    void PulseOut2(bool v) { out_pulse[1] = v; }
+
+    void LedBrightness(uint32_t, uint16_t) {}
+    void LedOn(uint32_t, bool = true) {}
+    void LedOff(uint32_t) {}
+    USBPowerState_t USBPowerState() { return UFP; }
+
+private:
+    bool last_pulse[2] = {false, false};
+};
@@ -0,0 +1,72 @@
+// host_sdk.h — just enough of the Pico SDK and TinyUSB to compile Clockwork's main.cpp on
+// Linux. Every SDK header main.cpp includes (pico/stdlib.h, hardware/*.h, tusb.h, ...) is
+// a one-line file in this directory that includes this one; host/Makefile puts it first
+// on the include path.
+//
+// Flash is a RAM array (erased, so load_settings() falls back to the defaults), the SIO
+// divider divides, USB is never mounted, and time is whatever the harness sets
+// host_now_us to. Nothing here touches Core 1's audio path except safe_div_u32's divider.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+typedef unsigned int uint;
+
+#define __not_in_flash_func(f) f
+
+// ─── Time ────────────────────────────────────────────────────────────────────
+static uint64_t host_now_us = 0;
+typedef uint64_t absolute_time_t;
+static inline absolute_time_t get_absolute_time() { return host_now_us; }
+static inline uint32_t to_ms_since_boot(absolute_time_t t) { return (uint32_t)(t / 1000); }
+static inline void sleep_ms(uint32_t ms) { host_now_us += (uint64_t)ms * 1000; }
+
+// ─── Clocks, power, cores, interrupts ────────────────────────────────────────
+enum vreg_voltage { VREG_VOLTAGE_1_10 = 11, VREG_VOLTAGE_1_25 = 14 };
+static inline void vreg_set_voltage(vreg_voltage) {}
+static inline bool set_sys_clock_khz(uint32_t, bool) { return true; }
+static inline void multicore_launch_core1(void (*)()) {}
+static inline uint32_t save_and_disable_interrupts() { return 0; }
+static inline void restore_interrupts(uint32_t) {}
+
+// ─── Flash (2 MB, erased) ────────────────────────────────────────────────────
+#define FLASH_SECTOR_SIZE 4096u
+#define FLASH_PAGE_SIZE 256u
+struct HostFlash {
+    uint8_t bytes[2 * 1024 * 1024];
+    HostFlash() { memset(bytes, 0xFF, sizeof bytes); }
+};
+static HostFlash host_flash;
+#define XIP_BASE ((uintptr_t)host_flash.bytes)
+static inline void flash_range_erase(uint32_t off, size_t n) { memset(host_flash.bytes + off, 0xFF, n); }
+static inline void flash_range_program(uint32_t off, const uint8_t *src, size_t n) { memcpy(host_flash.bytes + off, src, n); }
+
+// ─── SIO hardware divider ────────────────────────────────────────────────────
+struct sio_hw_t {
+    volatile uint32_t div_udividend;
+    volatile uint32_t div_udivisor;
+};
+static sio_hw_t host_sio_hw;
+#define sio_hw (&host_sio_hw)
+// Divide by zero gives all ones, as the RP2040's divider does
+static inline uint32_t hw_divider_u32_quotient_wait()
+{
+    return host_sio_hw.div_udivisor ? host_sio_hw.div_udividend / host_sio_hw.div_udivisor : 0xFFFFFFFFu;
+}
+
+// ─── TinyUSB: never mounted, nothing to read ─────────────────────────────────
+#define TU_ATTR_WEAK __attribute__((weak))
+typedef struct { uint8_t bLength; } tusb_desc_interface_t;
+typedef enum { XFER_RESULT_SUCCESS = 0 } xfer_result_t;
+static inline bool tud_init(uint8_t) { return true; }
+static inline bool tuh_init(uint8_t) { return true; }
+static inline void tud_task() {}
+static inline void tuh_task() {}
+static inline bool tud_midi_mounted() { return false; }
+static inline bool tud_cdc_connected() { return false; }
+static inline uint32_t tud_midi_available() { return 0; }
+static inline bool tud_midi_packet_read(uint8_t *) { return false; }
+static inline uint32_t tud_midi_stream_write(uint8_t, const uint8_t *, uint32_t n) { return n; }
+extern "C" bool tuh_midi_packet_read(uint8_t, uint8_t *) { return false; }
@@ -0,0 +1,363 @@
+// timing_bench — how closely Clockwork's channels follow the clock they are given.
+//
+// Builds ../clockwork_engine.h on its own (no card, no SDK) and drives it the way the card
+// does: parameters through publish_params(), the jacks through EngineJacks once a sample,
+// MIDI clock through the engine's tick counter as Core 0 would bump it. Each scene clocks
+// the engine internally, from Pulse 1 at 1, 4, 24 or 48 PPQN, or from MIDI clock; with
+// the pulses jittered and the tempo steady or ramping. All six outputs are gates at
+// different clock modifiers, and every rising edge is placed against the ideal grid,
+// the beat position the unjittered clock implies at that instant:
+//
+//   error  = edge time - time of the nearest ideal step (us; + is late)
+//   mean   = average error after the settle time (lock-in excluded), rms and max |error|
+//   drift  = slope of error against time (us/s): a tempo the engine has wrong
+//   miss / extra = ideal steps with no edge, and edges beyond one per step
+//
+// and cost is ns per channel-sample (best of three passes; host-relative).
+//
+//   ./timing_bench                        all scenes
+//   ./timing_bench -w timing.txt          ... and save the figures as a baseline
+//   ./timing_bench -c timing.txt          ... and fail where timing got worse than it
+//   ./timing_bench -v "ext 24 ramp"       one scene, every edge listed
+//
+// A check fails on any new missed or extra edge, mean or max error more than 50 us
+// further from zero, rms up 20 us, or drift up 5 us/s — beyond a sample either way.
+#include "../clockwork_engine.h"
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// ─── Clock sources ───────────────────────────────────────────────────────────
+enum Source { INTERNAL, EXT_PULSE, MIDI_CLOCK };
+
+struct Scene {
+    const char *name;
+    Source source;
+    uint8_t ppqn;          // Pulse 1 PPQN (MIDI clock is always 24)
+    double bpm0, bpm1;     // tempo ramps linearly from bpm0 to bpm1 over rampSeconds...
+    double rampSeconds;    // ...then holds (0: steady at bpm0)
+    double jitterUs;       // each pulse moved up to ± this, uniformly
+    double seconds;
+};
+
+// Beat position of the unjittered clock, from its first pulse at 50 ms (the internal
+// clock starts with the first sample)
+static const double kSettle = 2.0;    // s after the first pulse before errors count
+
+static double start_of(const Scene &s) { return s.source == INTERNAL ? 0.0 : 0.05; }
+
+static double beats_at(const Scene &s, double t)
+{
+    double u = t - start_of(s);
+    if (s.rampSeconds <= 0 || u <= s.rampSeconds) {
+        double k = s.rampSeconds > 0 ? (s.bpm1 - s.bpm0) / s.rampSeconds : 0;
+        return (s.bpm0 * u + 0.5 * k * u * u) / 60.0;
+    }
+    double atEnd = (s.bpm0 + s.bpm1) * 0.5 * s.rampSeconds / 60.0;
+    return atEnd + s.bpm1 * (u - s.rampSeconds) / 60.0;
+}
+
+// Time of beat position b (inverse of beats_at)
+static double time_of(const Scene &s, double b)
+{
+    double k = s.rampSeconds > 0 ? (s.bpm1 - s.bpm0) / s.rampSeconds : 0;
+    double atEnd = (s.bpm0 + s.bpm1) * 0.5 * s.rampSeconds / 60.0;
+    double t0 = start_of(s);
+    if (k == 0) return t0 + b * 60.0 / s.bpm0;
+    if (b <= atEnd) return t0 + (-s.bpm0 + std::sqrt(s.bpm0 * s.bpm0 + 2.0 * k * 60.0 * b)) / k;
+    return t0 + s.rampSeconds + (b - atEnd) * 60.0 / s.bpm1;
+}
+
+// Deterministic jitter for pulse n, in -1..1
+static double jitter_of(long n)
+{
+    uint32_t h = (uint32_t)n * 2654435761u;
+    h ^= h >> 15; h *= 2246822519u; h ^= h >> 13;
+    return (double)(h & 0xFFFF) / 32767.5 - 1.0;
+}
+
+// Clock pulse times up to `seconds`, jittered
+static std::vector<double> pulse_times(const Scene &s, uint32_t ppqn)
+{
+    std::vector<double> t;
+    for (long n = 0;; n++) {
+        double at = time_of(s, (double)n / ppqn) + s.jitterUs * 1e-6 * jitter_of(n);
+        if (at >= s.seconds) break;
+        t.push_back(at < 0 ? 0 : at);
+    }
+    return t;
+}
+
+// ─── Channels ────────────────────────────────────────────────────────────────
+// Modifier indexes into clock_multipliers_q16: 19 /2, 20 x1, 21 x2, 22 x3, 23 x4, 25 x8
+static const uint8_t kModifier[6] = { 20, 21, 22, 19, 23, 25 };
+static const char *const kModifierName[6] = { "x1", "x2", "x3", "/2", "x4", "x8" };
+static const char *const kOutName[6] = { "Audio 1", "Audio 2", "CV 1", "CV 2", "Pulse 1", "Pulse 2" };
+
+static SavedSettings settings_for(const Scene &s)
+{
+    SavedSettings st;
+    st.bpm = (uint16_t)s.bpm0;
+    st.sync_source = s.source == EXT_PULSE;
+    st.ext_ppqn = s.ppqn ? s.ppqn : 4;
+    for (int i = 0; i < 6; i++) {
+        ChannelConfig &c = st.channels[i];
+        c.clock_modifier = kModifier[i];
+        c.wave_shape = WAVE_GATE;
+        c.wave_param = 128;
+        c.probability = 100;
+        c.level = (i < 4) ? 200 : 0;
+    }
+    return st;
+}
+
+// ─── Measure ─────────────────────────────────────────────────────────────────
+struct ChannelStats {
+    uint32_t edges = 0, expected = 0, missed = 0, extra = 0;
+    double meanUs = 0, rmsUs = 0, maxUs = 0, driftUsPerS = 0;
+};
+
+struct SceneResult {
+    ChannelStats ch[6];
+    double nsPerChannelSample = 0;
+};
+
+static bool g_verbose = false;   // -v: every edge, as it is measured
+
+static SceneResult run_scene(const Scene &s)
+{
+    init_luts();
+    ClockworkEngine engine;
+    SavedSettings st = settings_for(s);
+    engine.init(st.channels);
+    bool pulse1 = s.source == EXT_PULSE;
+    engine.publish_params(st, pulse1, false, 0);
+
+    std::vector<double> pulses;
+    if (s.source == EXT_PULSE) pulses = pulse_times(s, s.ppqn);
+    if (s.source == MIDI_CLOCK) pulses = pulse_times(s, 24);
+
+    // Rising edges per output, as sample times
+    std::vector<double> edges[6];
+    EngineJacks io;
+    io.connected[JACK_PULSE1] = pulse1;
+    const double pulseWidth = 0.005;
+    uint32_t n = (uint32_t)(s.seconds * SAMPLE_RATE);
+    SceneResult res;
+    double best = 1e300;
+    for (int pass = 0; pass < 3; pass++) {
+        size_t next = 0;          // next clock pulse
+        double pulseEnd = -1;
+        bool last[6] = {}, lastPulse = false;
+        auto t0 = std::chrono::steady_clock::now();
+        for (uint32_t k = 0; k < n; k++) {
+            double t = (double)k / SAMPLE_RATE;
+            bool tick = next < pulses.size() && t >= pulses[next];
+            if (tick) next++;
+            if (s.source == EXT_PULSE) {
+                if (tick) pulseEnd = t + pulseWidth;
+                bool high = t < pulseEnd;
+                io.pulse_in[0] = high;
+                io.pulse_rising[0] = high && !lastPulse;
+                lastPulse = high;
+            } else if (s.source == MIDI_CLOCK && tick) {
+                engine.midi_clock_tick_count_ = engine.midi_clock_tick_count_ + 1;
+            }
+
+            engine.process(io);
+
+            if (pass) continue;
+            bool now[6] = { io.audio_out[0] > 0, io.audio_out[1] > 0, io.cv_out_mv[0] > 0,
+                            io.cv_out_mv[1] > 0, io.pulse_out[0], io.pulse_out[1] };
+            for (int c = 0; c < 6; c++) {
+                if (now[c] && !last[c]) edges[c].push_back(t);
+                last[c] = now[c];
+            }
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::nano>(t1 - t0).count());
+        // Later passes play the same clock again, for the cost alone
+    }
+    res.nsPerChannelSample = best / ((double)n * 6);
+
+    // Against the grid: steps of channel c fall at beat positions k / M
+    double from = start_of(s) + kSettle, to = s.seconds - 0.1;
+    for (int c = 0; c < 6; c++) {
+        ChannelStats &cs = res.ch[c];
+        double m = clock_multipliers_q16[kModifier[c]] / 65536.0;   // steps per beat
+        double firstStep = std::ceil(beats_at(s, from) * m), lastStep = std::floor(beats_at(s, to) * m);
+        cs.expected = lastStep >= firstStep ? (uint32_t)(lastStep - firstStep + 1) : 0;
+        std::vector<long> steps;
+        double sum = 0, sumSq = 0, st = 0, stt = 0, se = 0;
+        for (double e : edges[c]) {
+            // By nearest step, so an edge a sample early still counts at the window's ends
+            long step = std::lround(beats_at(s, e) * m);
+            if (step < firstStep || step > lastStep) continue;
+            double errUs = (e - time_of(s, (double)step / m)) * 1e6;
+            if (g_verbose) printf("  %s %-8s %9.6f s  step %5ld  %+9.1f us\n", s.name, kOutName[c], e, step, errUs);
+            cs.edges++;
+            steps.push_back(step);
+            sum += errUs;
+            sumSq += errUs * errUs;
+            cs.maxUs = std::max(cs.maxUs, std::fabs(errUs));
+            st += e; stt += e * e; se += e * errUs;
+        }
+        std::sort(steps.begin(), steps.end());
+        uint32_t unique = (uint32_t)(std::unique(steps.begin(), steps.end()) - steps.begin());
+        cs.extra = cs.edges - unique;
+        cs.missed = cs.expected > unique ? cs.expected - unique : 0;
+        if (cs.edges) {
+            double N = cs.edges;
+            cs.meanUs = sum / N;
+            cs.rmsUs = std::sqrt(sumSq / N);
+            double var = stt / N - (st / N) * (st / N);
+            if (var > 0) cs.driftUsPerS = (se / N - (st / N) * cs.meanUs) / var;
+        }
+    }
+    return res;
+}
+
+// ─── Scenes ──────────────────────────────────────────────────────────────────
+static const Scene kScenes[] = {
+    { "internal 120",        INTERNAL,    0, 120, 120, 0, 0,    10 },
+    { "ext 4 120",           EXT_PULSE,   4, 120, 120, 0, 0,    10 },
+    { "ext 4 120 jitter",    EXT_PULSE,   4, 120, 120, 0, 1000, 10 },
+    { "ext 1 90 jitter",     EXT_PULSE,   1,  90,  90, 0, 2000, 12 },
+    { "ext 24 100 jitter",   EXT_PULSE,  24, 100, 100, 0, 500,  10 },
+    { "ext 48 140",          EXT_PULSE,  48, 140, 140, 0, 0,    10 },
+    { "ext 4 ramp",          EXT_PULSE,   4,  90, 150, 8, 0,    12 },
+    { "ext 24 ramp",         EXT_PULSE,  24, 140,  70, 8, 300,  12 },
+    { "midi 120",            MIDI_CLOCK,  0, 120, 120, 0, 0,    10 },
+    { "midi 120 jitter",     MIDI_CLOCK,  0, 120, 120, 0, 1000, 10 },
+    { "midi ramp",           MIDI_CLOCK,  0, 100, 130, 8, 0,    12 },
+};
+
+// ─── Baseline ────────────────────────────────────────────────────────────────
+struct Line { std::string scene; int ch; ChannelStats s; };
+
+static void write_line(FILE *f, const char *scene, int c, const ChannelStats &s)
+{
+    fprintf(f, "%s\t%d\t%u\t%u\t%u\t%.1f\t%.1f\t%.1f\t%.2f\n", scene, c, s.edges, s.missed, s.extra,
+            s.meanUs, s.rmsUs, s.maxUs, s.driftUsPerS);
+}
+
+static std::vector<Line> read_baseline(const char *path)
+{
+    std::vector<Line> lines;
+    FILE *f = fopen(path, "r");
+    if (!f) return lines;
+    char buf[256];
+    while (fgets(buf, sizeof buf, f)) {
+        char *tab = strchr(buf, '\t');
+        if (!tab) continue;
+        Line l;
+        l.scene.assign(buf, tab);
+        if (sscanf(tab + 1, "%d\t%u\t%u\t%u\t%lf\t%lf\t%lf\t%lf", &l.ch, &l.s.edges, &l.s.missed, &l.s.extra,
+                   &l.s.meanUs, &l.s.rmsUs, &l.s.maxUs, &l.s.driftUsPerS) == 8)
+            lines.push_back(l);
+    }
+    fclose(f);
+    return lines;
+}
+
+// Empty if no worse than the baseline
+static std::string regressions(const ChannelStats &now, const ChannelStats &was)
+{
+    std::string why;
+    if (now.missed > was.missed) why += " missed";
+    if (now.extra > was.extra) why += " extra";
+    if (std::fabs(now.meanUs) > std::fabs(was.meanUs) + 50) why += " mean";
+    if (now.maxUs > was.maxUs + 50) why += " max";
+    if (now.rmsUs > was.rmsUs + 20) why += " rms";
+    if (std::fabs(now.driftUsPerS) > std::fabs(was.driftUsPerS) + 5) why += " drift";
+    return why;
+}
+
+// ─── Driver ──────────────────────────────────────────────────────────────────
+int main(int argc, char **argv)
+{
+    const char *writePath = nullptr, *checkPath = nullptr;
+    std::vector<std::string> only;
+    for (int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        if (a == "-v") g_verbose = true;
+        else if (a == "-w" && i + 1 < argc) writePath = argv[++i];
+        else if (a == "-c" && i + 1 < argc) checkPath = argv[++i];
+        else if (a[0] == '-') {
+            fprintf(stderr, "usage: timing_bench [-v] [-w file | -c file] [scene...]\n");
+            return 2;
+        }
+        else only.push_back(a);
+    }
+    std::vector<Line> baseline;
+    if (checkPath) {
+        baseline = read_baseline(checkPath);
+        if (baseline.empty()) {
+            fprintf(stderr, "no baseline in %s\n", checkPath);
+            return 2;
+        }
+    }
+    FILE *out = writePath ? fopen(writePath, "w") : nullptr;
+    if (writePath && !out) {
+        fprintf(stderr, "can't write %s\n", writePath);
+        return 2;
+    }
+
+    printf("Clockwork timing against the ideal grid, %d Hz; errors after %.0f s settle, in us\n\n",
+           SAMPLE_RATE, kSettle);
+    int failures = 0;
+    for (const Scene &s : kScenes) {
+        if (!only.empty() && std::find(only.begin(), only.end(), s.name) == only.end()) continue;
+
+        // In a child, so the engine's statics start fresh; results come back through a pipe
+        int fd[2];
+        if (pipe(fd) != 0) return 2;
+        fflush(stdout);
+        pid_t pid = fork();
+        if (pid == 0) {
+            close(fd[0]);
+            SceneResult r = run_scene(s);
+            fflush(stdout);
+            ssize_t w = write(fd[1], &r, sizeof r);
+            _exit(w == (ssize_t)sizeof r ? 0 : 1);
+        }
+        close(fd[1]);
+        SceneResult r;
+        ssize_t got = read(fd[0], &r, sizeof r);
+        close(fd[0]);
+        int status = 0;
+        waitpid(pid, &status, 0);
+        if (got != (ssize_t)sizeof r || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            printf("%s: crashed\n", s.name);
+            failures++;
+            continue;
+        }
+
+        printf("%-18s %5.1f ns/ch-smp\n", s.name, r.nsPerChannelSample);
+        printf("  %-8s %3s %6s %5s %6s %8s %8s %8s %8s\n", "out", "mod", "edges", "miss", "extra",
+               "mean", "rms", "max", "drift/s");
+        for (int c = 0; c < 6; c++) {
+            const ChannelStats &cs = r.ch[c];
+            std::string why;
+            if (checkPath) {
+                const Line *was = nullptr;
+                for (const Line &l : baseline) if (l.scene == s.name && l.ch == c) was = &l;
+                why = was ? regressions(cs, was->s) : " no baseline";
+                if (!why.empty()) failures++;
+            }
+            printf("  %-8s %3s %6u %5u %6u %8.1f %8.1f %8.1f %8.2f%s%s\n", kOutName[c], kModifierName[c],
+                   cs.edges, cs.missed, cs.extra, cs.meanUs, cs.rmsUs, cs.maxUs, cs.driftUsPerS,
+                   why.empty() ? "" : "  WORSE:", why.c_str());
+            if (out) write_line(out, s.name, c, cs);
+        }
+    }
+    if (out) fclose(out);
+    if (failures) printf("\n%d FAILED\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,247 @@
+#ifndef ADDITIVE_H
+#define ADDITIVE_H
+
+#include <cstdint>
+
+// Recursive sine partials for the additive banks (SINE, DTON)
+//
+// Each partial is a magic-circle oscillator (the modified coupled form):
+//     c -= e * s;  s += e * c;      e = 2 sin(pi f / fs)
+// two rounded multiplies a sample and no table reads. s is the sine (phase 0 at
+// s = 0, rising, as sine_table), c the matching cosine.
+//
+// Integer shears are exact bijections, so the orbit can't decay or blow
+// up, but it is an ellipse whose size depends on e: after retunes it
+// drifts. renormalise() pulls one partial back each control block.
+//
+// e is kept as a 15-bit mantissa and a shift, so a 55 Hz partial is as
+// well tuned as a 5 kHz one, and s * m always fits 32 bits.
+//
+// Everything that isn't the per-sample recursion (tuning, gains, the
+// renormalisation) runs once per ADD_CTRL_BLOCK samples; gains ramp
+// across the block. The banks then render the whole block at once and
+// play it out a sample per call. They run two or four partials per loop
+// (mixPair(), weighQuad()): each recursion is a chain of dependent
+// multiplies, and independent chains side by side fill each other's
+// waits and share the loads and stores of the mix.
+
+static constexpr int ADD_CTRL_SHIFT = 4;
+static constexpr int ADD_CTRL_BLOCK = 1 << ADD_CTRL_SHIFT; // 16 samples, 3 kHz control rate
+
+// Peak of c and s, matching sine_table
+static constexpr int32_t PARTIAL_AMP = 32767;
+
+// Partials above 0.45 fs are parked silent instead of aliasing
+static constexpr uint32_t PARTIAL_MAX_INC = 0x73333333u;
+
+// A Q15 gain that moves to its target linearly over one control block
+struct GainRamp
+{
+    int32_t cur = 0;  // Q30
+    int32_t step = 0;
+
+    void to(int32_t target_q15)
+    {
+        step = ((target_q15 << 15) - cur) >> ADD_CTRL_SHIFT;
+    }
+
+    inline int32_t next()
+    {
+        cur += step;
+        return cur >> 15;
+    }
+};
+
+template <int N>
+struct PartialBank
+{
+    int32_t c[N];
+    int32_t s[N];
+    int32_t m[N];      // e = m / 2^sh
+    int32_t sh[N];
+    int32_t rnd[N];    // 2^(sh-1), rounds the products
+    uint32_t inc[N];   // phase increment m/sh were made for
+    int renorm_next = 0;
+
+    PartialBank()
+    {
+        for (int i = 0; i < N; i++)
+        {
+            c[i] = PARTIAL_AMP;
+            s[i] = 0;
+            m[i] = 0;
+            sh[i] = 15;
+            rnd[i] = 1 << 14;
+            inc[i] = 0;
+        }
+    }
+
+    // n samples of partial i into out_s (and out_c, if given), with its
+    // state held in registers for the whole run: the banks render a
+    // control block at a time, partial by partial
+    inline void render(int i, int32_t* out_s, int32_t* out_c, int n)
+    {
+        int32_t ci = c[i], si = s[i];
+        const int32_t mi = m[i], shi = sh[i], ri = rnd[i];
+        if (out_c)
+        {
+            for (int k = 0; k < n; k++)
+            {
+                ci -= (si * mi + ri) >> shi;
+                si += (ci * mi + ri) >> shi;
+                out_s[k] = si;
+                out_c[k] = ci;
+            }
+        }
+        else
+        {
+            for (int k = 0; k < n; k++)
+            {
+                ci -= (si * mi + ri) >> shi;
+                si += (ci * mi + ri) >> shi;
+                out_s[k] = si;
+            }
+        }
+        c[i] = ci;
+        s[i] = si;
+    }
+
+    // Partials i and i + 1 in one pass, each weighted by its gain ramp: the
+    // pair goes into sum and, times pan (Q12), into panned; partial i's own
+    // samples go to out. The gains sum to at most 1, so the pair can't
+    // overflow the Q30 products.
+    inline void mixPair(int i, GainRamp& g0, GainRamp& g1, int32_t pan,
+                        int32_t* out, int32_t* sum, int32_t* panned, int n)
+    {
+        int32_t c0 = c[i], s0 = s[i], c1 = c[i + 1], s1 = s[i + 1];
+        const int32_t m0 = m[i], sh0 = sh[i], r0 = rnd[i];
+        const int32_t m1 = m[i + 1], sh1 = sh[i + 1], r1 = rnd[i + 1];
+        int32_t a0 = g0.cur, a1 = g1.cur;
+        const int32_t d0 = g0.step, d1 = g1.step;
+        for (int k = 0; k < n; k++)
+        {
+            c0 -= (s0 * m0 + r0) >> sh0;
+            c1 -= (s1 * m1 + r1) >> sh1;
+            s0 += (c0 * m0 + r0) >> sh0;
+            s1 += (c1 * m1 + r1) >> sh1;
+            a0 += d0;
+            a1 += d1;
+            int32_t y = (s0 * (a0 >> 15) + s1 * (a1 >> 15)) >> 15;
+            out[k] = s0;
+            sum[k] += y;
+            panned[k] += y * pan;
+        }
+        c[i] = c0; s[i] = s0; c[i + 1] = c1; s[i + 1] = s1;
+        g0.cur = a0;
+        g1.cur = a1;
+    }
+
+    // Partials i to i + 3 in one pass, weighted per sample by w[0..3] (Q15)
+    // into acc (Q30); partials i and i + 1 also go to out0 and out1. The
+    // weights' magnitudes must sum below 2^16 for acc to fit.
+    inline void weighQuad(int i, const int32_t (*w)[ADD_CTRL_BLOCK], int32_t* acc,
+                          int32_t* out0, int32_t* out1)
+    {
+        int32_t c0 = c[i], s0 = s[i], c1 = c[i + 1], s1 = s[i + 1];
+        int32_t c2 = c[i + 2], s2 = s[i + 2], c3 = c[i + 3], s3 = s[i + 3];
+        const int32_t m0 = m[i], sh0 = sh[i], r0 = rnd[i];
+        const int32_t m1 = m[i + 1], sh1 = sh[i + 1], r1 = rnd[i + 1];
+        const int32_t m2 = m[i + 2], sh2 = sh[i + 2], r2 = rnd[i + 2];
+        const int32_t m3 = m[i + 3], sh3 = sh[i + 3], r3 = rnd[i + 3];
+        for (int k = 0; k < ADD_CTRL_BLOCK; k++)
+        {
+            c0 -= (s0 * m0 + r0) >> sh0;
+            c1 -= (s1 * m1 + r1) >> sh1;
+            c2 -= (s2 * m2 + r2) >> sh2;
+            c3 -= (s3 * m3 + r3) >> sh3;
+            s0 += (c0 * m0 + r0) >> sh0;
+            s1 += (c1 * m1 + r1) >> sh1;
+            s2 += (c2 * m2 + r2) >> sh2;
+            s3 += (c3 * m3 + r3) >> sh3;
+            acc[k] = s0 * w[0][k] + s1 * w[1][k] + s2 * w[2][k] + s3 * w[3][k];
+            out0[k] = s0;
+            out1[k] = s1;
+        }
+        c[i] = c0; s[i] = s0; c[i + 1] = c1; s[i + 1] = s1;
+        c[i + 2] = c2; s[i + 2] = s2; c[i + 3] = c3; s[i + 3] = s3;
+    }
+
+    // Control rate: set partial i to a phase increment (2^32 = one cycle per
+    // sample, as the table oscillators use). Unchanged increments cost one
+    // compare.
+    void tune(int i, uint32_t phase_inc)
+    {
+        if (phase_inc == inc[i]) return;
+        inc[i] = phase_inc;
+
+        if (phase_inc > PARTIAL_MAX_INC)
+        {
+            m[i] = 0;
+            c[i] = 0;
+            s[i] = 0;
+            return;
+        }
+        if (c[i] == 0 && s[i] == 0) c[i] = PARTIAL_AMP; // back from parked
+
+        // a = pi * inc / 2^32 in Q30 (pi/4 in Q32 = 3373259426), a < 1.42
+        int64_t a = (int64_t)((uint64_t)phase_inc * 3373259426u >> 32);
+        int64_t a2 = a * a >> 30;
+        // sin a = a (1 - a^2/6 (1 - a^2/20 (1 - a^2/42))), Q30, the divides
+        // as multiplies by 2^30/n
+        const int64_t one = (int64_t)1 << 30;
+        int64_t t = one - (a2 * 25565282 >> 30);
+        t = one - ((a2 * t >> 30) * 53687091 >> 30);
+        t = one - ((a2 * t >> 30) * 178956971 >> 30);
+        int64_t e = 2 * (a * t >> 30); // Q30, < 2
+
+        // Round to 15 bits in one go
+        int32_t shift = 30;
+        if (e > 32767)
+        {
+            int n = 17 - __builtin_clz((uint32_t)e);
+            e = (e + (1 << (n - 1))) >> n;
+            shift -= n;
+            if (e > 32767)
+            {
+                e >>= 1;
+                shift--;
+            }
+        }
+        m[i] = (int32_t)e;
+        sh[i] = shift;
+        rnd[i] = 1 << (shift - 1);
+    }
+
+    // Control rate: rescale the next partial in turn so c and s peak at
+    // PARTIAL_AMP again. On the magic circle c^2 + s^2 - e c s is constant
+    // and sets the peak to sqrt(I / (1 - e^2/4)); one Newton step of the
+    // square root is plenty for the drift a few blocks build up.
+    void renormalise()
+    {
+        int i = renorm_next;
+        renorm_next = (renorm_next + 1 == N) ? 0 : renorm_next + 1;
+        if (m[i] == 0) return;
+
+        int64_t ci = c[i], si = s[i];
+        int64_t inv = ci * ci + si * si - ((ci * si >> sh[i]) * m[i]);
+        const int64_t amp2 = (int64_t)PARTIAL_AMP * PARTIAL_AMP;
+        int64_t target = amp2 - ((amp2 >> sh[i]) * ((int64_t)m[i] * m[i] >> sh[i]) >> 2);
+        if (inv <= 0 || target <= 0)
+        {
+            c[i] = PARTIAL_AMP;
+            s[i] = 0;
+            return;
+        }
+
+        // g = 1 + (target - inv) / (2 target), Q15
+        int64_t d = target - inv;
+        int32_t den = (int32_t)(target >> 14);
+        if (d > den * 8192LL) d = den * 8192LL;
+        if (d < -den * 8192LL) d = -den * 8192LL;
+        int32_t g = 32768 + (int32_t)d / den;
+        c[i] = c[i] * g >> 15;
+        s[i] = s[i] * g >> 15;
+    }
+};
+
+#endif // ADDITIVE_H
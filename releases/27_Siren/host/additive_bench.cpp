@@ -0,0 +1,280 @@
+// additive_bench — Siren's recursive partials against the sine table, on Linux.
+//
+// Builds ../additive.h and ../oscillators.h as the firmware does, plus the banks before
+// them (REF: ref/oscillators.h, the table-lookup SINE and DTON) in namespace ref. Reports:
+//
+//   purity     one partial at a time, table oscillator (phase accumulator +
+//              table_lookup) against PartialBank: SFDR and SINAD from a
+//              Blackman-Harris windowed 64k FFT, and the measured frequency's error
+//              from the requested one in cents
+//   amplitude  a partial gliding 55 Hz <-> 3.5 kHz, retuned every control block for
+//              20 s, with and without renormalise(): its peak at the end, as % of
+//              PARTIAL_AMP
+//   cost       ns and host TSC cycles per sample for SINE and DTON at REF and now,
+//              held and with BASIS sweeping (every control block retunes), and per
+//              partial
+//
+// Best of 101 passes, REF and now alternating. Host figures are only relative (x86, not a Cortex-M0+):
+// compare the rows.
+//
+//   ./additive_bench
+#include "oscillators.h"
+
+namespace ref {
+#include "ref/oscillators.h"
+}
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC 1
+#else
+#define HAVE_TSC 0
+#endif
+
+namespace {
+
+constexpr double Fs = 48000.0;
+constexpr int FftN = 1 << 16;
+
+uint32_t incForHz(double hz)
+{
+    return (uint32_t)(hz / Fs * 4294967296.0 + 0.5);
+}
+
+void fft(std::vector<std::complex<double>>& a)
+{
+    const size_t n = a.size();
+    for (size_t i = 1, j = 0; i < n; ++i) {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+        if (i < j) std::swap(a[i], a[j]);
+    }
+    for (size_t len = 2; len <= n; len <<= 1) {
+        const double ang = -2.0 * M_PI / (double)len;
+        const std::complex<double> wl(std::cos(ang), std::sin(ang));
+        for (size_t i = 0; i < n; i += len) {
+            std::complex<double> w(1.0);
+            for (size_t k = 0; k < len / 2; ++k) {
+                const std::complex<double> u = a[i + k], v = a[i + k + len / 2] * w;
+                a[i + k] = u + v;
+                a[i + k + len / 2] = u - v;
+                w *= wl;
+            }
+        }
+    }
+}
+
+struct Purity {
+    double sfdr;    // dB, fundamental over the largest other bin
+    double sinad;   // dB, fundamental over everything else
+    double cents;   // measured frequency against requested
+};
+
+Purity analyse(const std::vector<int16_t>& x, double requestedHz)
+{
+    std::vector<std::complex<double>> a(FftN);
+    for (int i = 0; i < FftN; ++i) {
+        const double t = 2.0 * M_PI * i / (FftN - 1);
+        const double w = 0.35875 - 0.48829 * std::cos(t) + 0.14128 * std::cos(2 * t) -
+                         0.01168 * std::cos(3 * t);
+        a[i] = x[i] * w;
+    }
+    fft(a);
+    std::vector<double> p(FftN / 2);
+    for (int i = 0; i < FftN / 2; ++i) p[i] = std::norm(a[i]);
+
+    constexpr int Skirt = 8;   // Blackman-Harris main lobe and then some
+    int peak = Skirt;
+    for (int i = Skirt; i < FftN / 2; ++i)
+        if (p[i] > p[peak]) peak = i;
+    double fund = 0, rest = 0, spur = 0;
+    for (int i = Skirt; i < FftN / 2; ++i) {
+        if (std::abs(i - peak) <= Skirt) {
+            fund += p[i];
+        } else {
+            rest += p[i];
+            spur = std::max(spur, p[i]);
+        }
+    }
+
+    // Frequency from rising zero crossings, interpolated
+    double first = -1, last = -1;
+    int crossings = 0;
+    for (size_t i = 1; i < x.size(); ++i) {
+        if (x[i - 1] < 0 && x[i] >= 0) {
+            const double t = (double)(i - 1) + (double)-x[i - 1] / (double)(x[i] - x[i - 1]);
+            if (first < 0) first = t;
+            else crossings++;
+            last = t;
+        }
+    }
+    const double hz = crossings ? crossings * Fs / (last - first) : 0.0;
+    return {10 * std::log10(p[peak] / std::max(spur, 1e-30)),
+        10 * std::log10(fund / std::max(rest, 1e-30)), 1200 * std::log2(hz / requestedHz)};
+}
+
+std::vector<int16_t> tableSine(uint32_t inc, size_t n)
+{
+    std::vector<int16_t> out(n);
+    uint32_t phase = 0;
+    for (size_t i = 0; i < n; ++i) {
+        phase += inc;
+        out[i] = table_lookup(sine_table, phase);
+    }
+    return out;
+}
+
+std::vector<int16_t> recursiveSine(uint32_t inc, size_t n)
+{
+    std::vector<int16_t> out(n);
+    PartialBank<1> partial;
+    partial.tune(0, inc);
+    int32_t block[ADD_CTRL_BLOCK];
+    for (size_t i = 0; i + ADD_CTRL_BLOCK <= n; i += ADD_CTRL_BLOCK) {
+        partial.renormalise();
+        partial.render(0, block, nullptr, ADD_CTRL_BLOCK);
+        for (int k = 0; k < ADD_CTRL_BLOCK; ++k) out[i + k] = q15_clip(block[k]);
+    }
+    return out;
+}
+
+// Peak over the last second of a 20 s glide, as % of PARTIAL_AMP
+double glidePeak(bool renormalise)
+{
+    PartialBank<1> partial;
+    const int blocks = 20 * 48000 / ADD_CTRL_BLOCK;
+    int32_t peak = 0;
+    for (int b = 0; b < blocks; ++b) {
+        // 55 Hz -> 3.5 kHz -> 55 Hz every 2 s, exponentially
+        const double t = std::fmod(b * ADD_CTRL_BLOCK / Fs, 2.0);
+        const double octaves = 6.0 * (t < 1.0 ? t : 2.0 - t);
+        partial.tune(0, incForHz(55.0 * std::pow(2.0, octaves)));
+        if (renormalise) partial.renormalise();
+        int32_t block[ADD_CTRL_BLOCK];
+        partial.render(0, block, nullptr, ADD_CTRL_BLOCK);
+        for (int i = 0; i < ADD_CTRL_BLOCK; ++i)
+            if (b >= blocks - 48000 / ADD_CTRL_BLOCK) peak = std::max(peak, std::abs(block[i]));
+    }
+    return 100.0 * peak / PARTIAL_AMP;
+}
+
+struct Cost {
+    double ns;
+    double cycles;
+};
+
+// Params as the firmware builds them; `sweep` moves BASIS every sample. P is
+// OscParams or REF's copy of it.
+template <typename P>
+P params(int i, bool sweep)
+{
+    P p;
+    p.warp = 0;
+    p.span = 1200;
+    p.morph = 2048;
+    p.seed = 300;
+    p.scan = 0;
+    const int32_t hz = sweep ? 110 + (i / 48) % 330 : 110;
+    p.basis_freq = (int32_t)freq_hz_to_phase_inc(hz);
+    return p;
+}
+
+// One pass of `Samples` through a fresh Bank, timed
+template <typename Bank, typename P>
+Cost pass(const std::vector<P>& ps)
+{
+    Bank bank;
+    int32_t acc = 0;
+    const auto t0 = std::chrono::steady_clock::now();
+#if HAVE_TSC
+    const uint64_t c0 = __rdtsc();
+#endif
+    for (const P& p : ps) {
+        int16_t l, r;
+        bank.process(p, l, r);
+        acc += l ^ r;
+    }
+#if HAVE_TSC
+    const double cycles = (double)(__rdtsc() - c0) / ps.size();
+#else
+    const double cycles = 0.0;
+#endif
+    const auto t1 = std::chrono::steady_clock::now();
+    static volatile int32_t sink = 0;
+    sink = acc;
+    (void)sink;
+    return {std::chrono::duration<double, std::nano>(t1 - t0).count() / ps.size(), cycles};
+}
+
+template <typename P>
+std::vector<P> paramRun(int32_t warp, int32_t scan, bool sweep)
+{
+    constexpr int Samples = 48000;
+    std::vector<P> ps(Samples);
+    for (int i = 0; i < Samples; ++i) {
+        ps[i] = params<P>(i, sweep);
+        ps[i].warp = warp;
+        ps[i].scan = scan;
+    }
+    return ps;
+}
+
+template <typename Ref, typename New>
+void costRows(const char* name, int refPartials, int newPartials, int32_t warp, int32_t scan)
+{
+    for (bool sweep : {false, true}) {
+        // REF and now alternate pass by pass, so both see the same machine
+        const std::vector<ref::OscParams> rp = paramRun<ref::OscParams>(warp, scan, sweep);
+        const std::vector<OscParams> np = paramRun<OscParams>(warp, scan, sweep);
+        Cost a = {1e30, 1e30}, b = {1e30, 1e30};
+        for (int i = 0; i < 101; ++i) {
+            const Cost x = pass<Ref>(rp), y = pass<New>(np);
+            a = {std::min(a.ns, x.ns), std::min(a.cycles, x.cycles)};
+            b = {std::min(b.ns, y.ns), std::min(b.cycles, y.cycles)};
+        }
+        char label[48];
+        std::snprintf(label, sizeof(label), "%s%s%s", name, warp ? " warp" : "",
+            sweep ? " sweep" : "");
+        std::printf("%-22s %8.1f %8.1f %8.1f  %8.1f %8.1f %8.1f  %6.2fx\n", label, a.ns, a.cycles,
+            a.cycles / refPartials, b.ns, b.cycles, b.cycles / newPartials, a.cycles / b.cycles);
+    }
+}
+
+} // namespace
+
+int main()
+{
+    init_wavetables();
+
+    std::printf("%-10s %24s   %24s\n", "", "table (REF)", "recursive");
+    std::printf("%-10s %7s %7s %8s   %7s %7s %8s\n", "purity Hz", "SFDR", "SINAD", "cents",
+        "SFDR", "SINAD", "cents");
+    for (double hz : {55.0, 220.0, 880.0, 3520.0, 10000.0}) {
+        const uint32_t inc = incForHz(hz);
+        const double exact = inc * Fs / 4294967296.0;
+        const Purity t = analyse(tableSine(inc, FftN), exact);
+        const Purity r = analyse(recursiveSine(inc, FftN), exact);
+        std::printf("%-10.0f %7.1f %7.1f %8.3f   %7.1f %7.1f %8.3f\n", hz, t.sfdr, t.sinad,
+            t.cents, r.sfdr, r.sinad, r.cents);
+    }
+
+    std::printf("\namplitude after a 20 s glide: renormalised %.1f%%, not %.1f%%\n",
+        glidePeak(true), glidePeak(false));
+
+    std::printf("\n%-22s %26s  %26s\n", "", "REF (table)", "now (recursive)");
+    std::printf("%-22s %8s %8s %8s  %8s %8s %8s  %7s\n", "cost per sample", "ns", "cycles",
+        "/partial", "ns", "cycles", "/partial", "speedup");
+    costRows<ref::BankSine, BankSine>("SINE 4 -> 8", 4, BankSine::N, 0, 0);
+    costRows<ref::BankSine, BankSine>("SINE 4 -> 8", 4, BankSine::N, 2048, 2048);
+    costRows<ref::BankDiatonic, BankDiatonic>("DTON 4 -> 16", 4,
+        BankDiatonic::VOICES * BankDiatonic::HARMONICS, 0, 0);
+    return 0;
+}
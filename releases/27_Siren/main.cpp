@@ -430,9 +430,9 @@ private:
     {
         switch (bank_idx)
         {
-            case 0: return bank_sine.phase[0];
+            case 0: return bank_sine.phase0();
             case 1: return bank_cluster.phase[0];
-            case 2: return bank_diatonic.phase[0];
+            case 2: return bank_diatonic.phase0();
             case 3: return bank_analogue.phase[0];
             case 4: return bank_waveshape.phase[0];
             case 5: return bank_wavetable.phase[0];
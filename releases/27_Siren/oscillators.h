@@ -4,12 +4,13 @@
 #include <cstdint>
 #include "wavetables.h"
 #include "dsp.h"
+#include "additive.h"
 
 // Number of oscillator bank types
 static constexpr int NUM_BANKS = 6;
 
-// Maximum oscillators per bank
-static constexpr int MAX_OSCS = 6;
+// Maximum oscillators (partials) per bank
+static constexpr int MAX_OSCS = 16;
 
 // All parameters are 0-4095 (12-bit knob range) unless noted
 
@@ -25,88 +26,160 @@ struct OscParams
 
 // ═══════════════════════════════════════════════
 // BANK 0: SINE (Multi-sine cluster)
-// Purest drone. 4 sine oscillators in harmonic cluster.
+// Purest drone. 8 recursive sine partials: harmonics 1-4, each with a
+// slightly sharp twin.
 // ═══════════════════════════════════════════════
 struct BankSine
 {
-    uint32_t phase[4] = {};
+    static constexpr int N = 8;
+    // WARP's phase feedback costs two table reads a sample, so it bends
+    // harmonics 1 and 2 and their twins, the four the table bank warped
+    static constexpr int WARP_PARTIALS = 4;
 
-    // Harmonic ratios in Q16.16: [1.0, 1.002, 2.0, 2.01]
-    static constexpr int32_t ratios_q16[4] = {65536, 65667, 131072, 131728};
+    // Harmonic ratios in Q16.16: [1.0, 1.002, 2.0, 2.01, 3.0, 3.015, 4.0, 4.02]
+    static constexpr int32_t ratios_q16[N] = {65536, 65667, 131072, 131728,
+                                              196608, 197591, 262144, 263455};
 
-    void process(const OscParams& p, int16_t& out_l, int16_t& out_r)
+    PartialBank<N> partials;
+    GainRamp gain[N];      // morph weight; the pan is fixed per partial
+    int32_t warp = 0, scan = 0;
+
+    // The rendered control block, played out a sample per process()
+    int16_t block_l[ADD_CTRL_BLOCK], block_r[ADD_CTRL_BLOCK];
+    int32_t fund[ADD_CTRL_BLOCK] = {}; // partial 0, for the pulse outputs
+    int pos = ADD_CTRL_BLOCK;
+
+    // Phase MSB of the fundamental (for the pulse outputs): set while the sine is negative
+    uint32_t phase0() const { return fund[pos - 1] < 0 ? 0x80000000u : 0u; }
+
+    // Once per control block: tune the partials and aim the gain ramps
+    void control(const OscParams& p)
     {
-        int32_t mix_l = 0, mix_r = 0;
+        warp = p.warp;
+        scan = p.scan;
 
         // MORPH: controls per-oscillator amplitude weighting
-        // 0 = emphasize fundamentals (oscs 0,1), 4095 = emphasize harmonics (oscs 2,3)
-        // Each osc gets a different gain based on morph position
-        int32_t gains[4];
+        // 0 = emphasize fundamentals (oscs 0,1), 4095 = emphasize harmonics (oscs 2-7)
+        // Harmonics 3 and 4 follow harmonic 2 at 2/3 and 1/2 level
+        int32_t gains[N];
         gains[0] = 4095 - p.morph;                          // fundamental, fades out
         gains[1] = (p.morph < 2048) ? p.morph * 2 : (4095 - p.morph) * 2; // peaks mid
         gains[2] = (p.morph > 1365) ? (p.morph - 1365) * 3 >> 1 : 0;      // rises late
         gains[3] = p.morph;                                  // harmonics, fades in
+        gains[4] = gains[2] * 2 / 3;
+        gains[5] = gains[3] * 2 / 3;
+        gains[6] = gains[2] >> 1;
+        gains[7] = gains[3] >> 1;
         // Normalize so total is roughly constant
-        // Compute reciprocal with enough precision to avoid volume jumps
-        int32_t gain_sum = gains[0] + gains[1] + gains[2] + gains[3];
+        int32_t gain_sum = 0;
+        for (int i = 0; i < N; i++) gain_sum += gains[i];
         if (gain_sum < 1) gain_sum = 1;
-        // High-precision reciprocal: range ~455-1024, hundreds of distinct values
-        int32_t gain_recip = (4 << 20) / gain_sum;
+        const int32_t inv_sum = (1 << 30) / gain_sum; // one divide for the eight
 
-        for (int i = 0; i < 4; i++)
+        // SPAN: scale the deviation of each ratio from the fundamental
+        // At span=0, ratios are tight. At span=4095, deviations are doubled.
+        // Scale deviation: 0.5x at span=0, 2.0x at span=4095
+        int32_t span_scale = 2048 + ((int32_t)p.span * 3 >> 1); // Q12: 0.5 to ~1.5
+
+        for (int i = 0; i < N; i++)
         {
-            // SPAN: scale the deviation of each ratio from the fundamental
-            // At span=0, ratios are tight. At span=4095, deviations are doubled.
-            int32_t base_ratio = ratios_q16[i];
-            int32_t deviation = base_ratio - 65536; // how far from 1.0
-            // Scale deviation: 0.5x at span=0, 2.0x at span=4095
-            int32_t span_scale = 2048 + ((int32_t)p.span * 3 >> 1); // Q12: 0.5 to ~1.5
+            int32_t deviation = ratios_q16[i] - 65536; // how far from 1.0
             int64_t ratio = 65536 + ((int64_t)deviation * span_scale >> 12);
 
-            // Seed: per-oscillator detuning (moderate range, max ~5% per osc)
-            int32_t seed_detune = 65536 + ((int32_t)p.seed * i * 2);
+            // Seed: per-oscillator detuning; upper harmonics follow their lower pair
+            int32_t seed_detune = 65536 + ((int32_t)p.seed * (i & 3) * 2);
             ratio = ratio * seed_detune >> 16;
 
-            uint32_t inc = (uint32_t)((int64_t)p.basis_freq * ratio >> 16);
-            phase[i] += inc;
+            uint64_t inc = (uint64_t)((int64_t)p.basis_freq * ratio >> 16);
+            partials.tune(i, inc > 0xFFFFFFFFu ? 0xFFFFFFFFu : (uint32_t)inc);
 
-            // Basic sine lookup
-            int16_t osc = table_lookup(sine_table, phase[i]);
+            // Morph weight (Q15)
+            gain[i].to((int32_t)((int64_t)gains[i] * inv_sum >> 15));
+        }
+        partials.renormalise();
+    }
 
-            // WARP: phase feedback — re-read sine with osc output as phase offset
-            // Gentle scaling: at max warp, feedback is ~±0.5 of a full cycle
-            if (p.warp > 50)
+    // One control block, a harmonic and its twin at a time. The pair's
+    // weighted output goes into sum and, times its pan, into panned:
+    // L = sum - panned and R = panned (pan in Q12), so panning costs one
+    // multiply, not a second gain ramp. A twin shares its harmonic's pan.
+    void render()
+    {
+        int32_t sum[ADD_CTRL_BLOCK] = {}, panned[ADD_CTRL_BLOCK] = {};
+        int32_t ring[ADD_CTRL_BLOCK];
+        int32_t s0[ADD_CTRL_BLOCK], c0[ADD_CTRL_BLOCK], s1[ADD_CTRL_BLOCK], c1[ADD_CTRL_BLOCK];
+        const int first = warp > 50 ? WARP_PARTIALS : 0;
+        for (int i = 0; i < first; i += 2)
+        {
+            partials.render(i, s0, c0, ADD_CTRL_BLOCK);
+            partials.render(i + 1, s1, c1, ADD_CTRL_BLOCK);
+            if (i == 0)
+                for (int k = 0; k < ADD_CTRL_BLOCK; k++) fund[k] = s0[k];
+            if (i == 2)
+                for (int k = 0; k < ADD_CTRL_BLOCK; k++) ring[k] = s0[k];
+
+            // WARP: phase feedback — the sine read at its own output as phase offset.
+            // sin(phase + d) from the quadrature pair: s cos d + c sin d
+            for (int k = 0; k < ADD_CTRL_BLOCK; k++)
             {
-                // Scale: osc (±32767) * warp (0-4095) >> 14 gives ±8191 max
-                // Then shift into phase accumulator range
-                int32_t fb_amount = (int32_t)osc * p.warp >> 14;
-                uint32_t fb_phase = phase[i] + (fb_amount << (PHASE_FRAC_BITS - 2));
-                osc = table_lookup(sine_table, fb_phase);
+                uint32_t d0 = (uint32_t)(s0[k] * warp >> 14) << (PHASE_FRAC_BITS - 2);
+                uint32_t d1 = (uint32_t)(s1[k] * warp >> 14) << (PHASE_FRAC_BITS - 2);
+                s0[k] = (s0[k] * table_lookup(sine_table, d0 + 0x40000000u) +
+                         c0[k] * table_lookup(sine_table, d0)) >> 15;
+                s1[k] = (s1[k] * table_lookup(sine_table, d1 + 0x40000000u) +
+                         c1[k] * table_lookup(sine_table, d1)) >> 15;
             }
 
-            // Apply morph gain (multiply by precomputed reciprocal instead of dividing)
-            // Split to avoid overflow: (osc * gains >> 8) * recip >> 12
-            int32_t gained = ((int32_t)osc * gains[i] >> 8) * gain_recip >> 12;
-
-            // Pan: spread oscillators across stereo field
-            int32_t pan = i * 1365; // 0, 1365, 2730, 4095
-            mix_l += (gained * (4095 - pan)) >> 14;
-            mix_r += (gained * pan) >> 14;
+            const int32_t pan = (i >> 1) * 1170 + 292;
+            int32_t g0 = gain[i].cur, g1 = gain[i + 1].cur;
+            const int32_t d0 = gain[i].step, d1 = gain[i + 1].step;
+            for (int k = 0; k < ADD_CTRL_BLOCK; k++)
+            {
+                g0 += d0;
+                g1 += d1;
+                int32_t y = (s0[k] * (g0 >> 15) + s1[k] * (g1 >> 15)) >> 15;
+                sum[k] += y;
+                panned[k] += y * pan;
+            }
+            gain[i].cur = g0;
+            gain[i + 1].cur = g1;
         }
+        for (int i = first; i < N; i += 2)
+        {
+            int32_t* out = i == 0 ? fund : i == 2 ? ring : s0;
+            partials.mixPair(i, gain[i], gain[i + 1], (i >> 1) * 1170 + 292, out, sum, panned,
+                             ADD_CTRL_BLOCK);
+        }
+        // SCAN: inter-oscillator ring modulation of partials 0 and 2
+        if (scan > 100)
+            for (int k = 0; k < ADD_CTRL_BLOCK; k++) ring[k] = fund[k] * ring[k] >> 15;
 
-        // SCAN: inter-oscillator ring modulation
-        if (p.scan > 100)
+        for (int k = 0; k < ADD_CTRL_BLOCK; k++)
         {
-            int16_t osc0 = table_lookup(sine_table, phase[0]);
-            int16_t osc2 = table_lookup(sine_table, phase[2]);
-            int32_t ring = q15_mul(osc0, osc2);
-            // Stronger scaling: scan 0-4095 maps to 0-1.0 mix amount
-            mix_l += (int32_t)ring * p.scan >> 12;
-            mix_r += (int32_t)ring * p.scan >> 12;
+            int32_t l = sum[k] - (panned[k] >> 12);
+            int32_t r = panned[k] >> 12;
+            if (scan > 100)
+            {
+                // Stronger scaling: scan 0-4095 maps to 0-1.0 mix amount
+                l += ring[k] * scan >> 12;
+                r += ring[k] * scan >> 12;
+            }
+            block_l[k] = q15_clip(l);
+            block_r[k] = q15_clip(r);
         }
+    }
 
-        out_l = q15_clip(mix_l);
-        out_r = q15_clip(mix_r);
+    void process(const OscParams& p, int16_t& out_l, int16_t& out_r)
+    {
+        if (pos == ADD_CTRL_BLOCK)
+        {
+            control(p);
+            render();
+            pos = 0;
+        }
+        out_l = block_l[pos];
+        out_r = block_r[pos];
+        pos++;
     }
 };
 
@@ -191,11 +264,14 @@ struct BankCluster
 
 // ═══════════════════════════════════════════════
 // BANK 2: DTON (Diatonic quantized cluster)
-// Musical intervals with just intonation ratios.
+// Musical intervals with just intonation ratios. Each of the 4 voices is
+// its first 4 harmonics as recursive partials, so the waveforms are
+// band-limited.
 // ═══════════════════════════════════════════════
 struct BankDiatonic
 {
-    uint32_t phase[4] = {};
+    static constexpr int VOICES = 4;
+    static constexpr int HARMONICS = 4;
 
     // Two sets of interval ratios in Q16.16
     // Set 0 (tight): unison, major 3rd, 5th, major 7th
@@ -203,70 +279,128 @@ struct BankDiatonic
     // Set 1 (wide): major 2nd, 4th, major 6th, octave
     static constexpr int32_t ratios_wide[4] = {73728, 87381, 109227, 131072};
 
-    void process(const OscParams& p, int16_t& out_l, int16_t& out_r)
-    {
-        int32_t mix_l = 0, mix_r = 0;
+    // Harmonic weights (Q15, all sine phase so blends never cancel the
+    // fundamental): sine, triangle 8/pi^2 (-1)^k/n^2 scaled to peak 1,
+    // descending saw 2/pi 1/n
+    static constexpr int32_t wave_sine[HARMONICS] = {32767, 0, 0, 0};
+    static constexpr int32_t wave_tri[HARMONICS] = {29491, 0, -3277, 0};
+    static constexpr int32_t wave_saw[HARMONICS] = {20861, 10430, 6954, 5215};
+
+    PartialBank<VOICES * HARMONICS> partials; // voice v, harmonic h at v * HARMONICS + h
+    GainRamp harmonic_gain[HARMONICS];        // shared by the voices
+    GainRamp h2_gain;                         // SCAN, Q12
+    int32_t drive = 4096;
+
+    // The rendered control block, played out a sample per process()
+    int16_t block_l[ADD_CTRL_BLOCK], block_r[ADD_CTRL_BLOCK];
+    int32_t fund[ADD_CTRL_BLOCK] = {}; // voice 0's fundamental, for the pulse outputs
+    int pos = ADD_CTRL_BLOCK;
+
+    // Phase MSB of voice 0 (for the pulse outputs)
+    uint32_t phase0() const { return fund[pos - 1] < 0 ? 0x80000000u : 0u; }
 
+    void control(const OscParams& p)
+    {
         // SPAN crossfades between tight and wide interval sets
         int32_t span_blend = p.span;
 
-        for (int i = 0; i < 4; i++)
+        for (int v = 0; v < VOICES; v++)
         {
             // Blend between interval sets based on span
             // Difference fits in 17 bits (max 65536), span in 12 bits — 32-bit multiply is safe
-            int32_t ratio = ratios_tight[i] +
-                (((ratios_wide[i] - ratios_tight[i]) * span_blend) >> 12);
+            int32_t ratio = ratios_tight[v] +
+                (((ratios_wide[v] - ratios_tight[v]) * span_blend) >> 12);
 
             // Seed: micro-detuning per oscillator
             static constexpr int32_t dton_seed_scale[4] = {0, 3, -2, 5};
-            ratio += (int32_t)p.seed * dton_seed_scale[i];
+            ratio += (int32_t)p.seed * dton_seed_scale[v];
 
             uint32_t inc = (uint32_t)((int64_t)p.basis_freq * ratio >> 16);
-            phase[i] += inc;
-
-            // MORPH: waveform scan (sine -> tri -> saw)
-            int16_t wave;
-            if (p.morph < 2048)
+            for (int h = 0; h < HARMONICS; h++)
             {
-                int32_t blend = p.morph * 2;
-                wave = q15_lerp(table_lookup(sine_table, phase[i]),
-                               table_lookup(tri_table, phase[i]), blend);
+                // Past PARTIAL_MAX_INC the partial parks, so saturate rather than wrap
+                uint32_t hinc = (inc > PARTIAL_MAX_INC / (h + 1)) ? 0xFFFFFFFFu : inc * (h + 1);
+                partials.tune(v * HARMONICS + h, hinc);
             }
+        }
+        partials.renormalise();
+
+        // MORPH: waveform scan (sine -> tri -> saw) as harmonic weights
+        for (int h = 0; h < HARMONICS; h++)
+        {
+            int32_t w;
+            if (p.morph < 2048)
+                w = wave_sine[h] + ((wave_tri[h] - wave_sine[h]) * (p.morph * 2) >> 12);
             else
-            {
-                int32_t blend = (p.morph - 2048) * 2;
-                wave = q15_lerp(table_lookup(tri_table, phase[i]),
-                               table_lookup(saw_table, phase[i]), blend);
-            }
+                w = wave_tri[h] + ((wave_saw[h] - wave_tri[h]) * ((p.morph - 2048) * 2) >> 12);
+            harmonic_gain[h].to(w);
+        }
+
+        // WARP: wavefold intensity (gradual onset)
+        // Smoothly scales from 1.0x to 4.0x drive, then folds
+        drive = 4096 + ((int32_t)p.warp * p.warp >> 10); // quadratic for smooth onset
+
+        // SCAN: 2nd harmonic for richer timbre, up to 100%
+        h2_gain.to(p.scan);
+    }
+
+    // One control block, voice by voice: the voice's four harmonics are run
+    // and summed in one pass, then folded, given SCAN and panned per sample.
+    // The shared ramps are stepped once for the block, not once per voice.
+    void render()
+    {
+        int32_t w[HARMONICS][ADD_CTRL_BLOCK], h2_amt[ADD_CTRL_BLOCK];
+        for (int h = 0; h < HARMONICS; h++)
+            for (int k = 0; k < ADD_CTRL_BLOCK; k++) w[h][k] = harmonic_gain[h].next();
+        for (int k = 0; k < ADD_CTRL_BLOCK; k++) h2_amt[k] = h2_gain.next();
 
-            // WARP: wavefold intensity (gradual onset)
-            // Smoothly scales from 1.0x to 4.0x drive, then folds
+        int32_t mix_l[ADD_CTRL_BLOCK] = {}, mix_r[ADD_CTRL_BLOCK] = {};
+        int32_t acc[ADD_CTRL_BLOCK], s[ADD_CTRL_BLOCK], h2[ADD_CTRL_BLOCK];
+
+        for (int v = 0; v < VOICES; v++)
+        {
+            const int i = v * HARMONICS;
+            partials.weighQuad(i, w, acc, v == 0 ? fund : s, h2);
+
+            // Pan across stereo (oscillators spread L to R)
+            const int32_t pan = v * 1365;
+            for (int k = 0; k < ADD_CTRL_BLOCK; k++)
             {
-                int32_t drive = 4096 + ((int32_t)p.warp * p.warp >> 10); // quadratic for smooth onset
+                int16_t wave = q15_clip(acc[k] >> 15);
+
+                // WARP: wavefold
                 int32_t scaled = (int32_t)wave * drive >> 12;
                 int32_t fold_idx = (scaled >> 6) + 512;
                 if (fold_idx < 0) fold_idx = 0;
                 if (fold_idx > 1023) fold_idx = 1023;
                 wave = fold_table[fold_idx];
-            }
 
-            // SCAN: add 2nd harmonic for richer timbre
-            {
-                uint32_t h2_phase = phase[i] << 1;
-                int16_t h2 = table_lookup(sine_table, h2_phase);
-                // scan 0-4095: h2 up to 75% mix
-                int32_t h2_amt = (int32_t)h2 * p.scan >> 12;
-                wave = q15_clip((int32_t)wave + h2_amt);
+                // SCAN: add the voice's own 2nd harmonic after the fold
+                wave = q15_clip((int32_t)wave + (h2[k] * h2_amt[k] >> 12));
+
+                mix_l[k] += ((int32_t)wave * (4095 - pan)) >> 14;
+                mix_r[k] += ((int32_t)wave * pan) >> 14;
             }
+        }
 
-            // Pan across stereo (oscillators spread L to R)
-            int32_t pan = i * 1365;
-            mix_l += ((int32_t)wave * (4095 - pan)) >> 14;
-            mix_r += ((int32_t)wave * pan) >> 14;
+        for (int k = 0; k < ADD_CTRL_BLOCK; k++)
+        {
+            block_l[k] = q15_clip(mix_l[k]);
+            block_r[k] = q15_clip(mix_r[k]);
         }
+    }
 
-        out_l = q15_clip(mix_l);
-        out_r = q15_clip(mix_r);
+    void process(const OscParams& p, int16_t& out_l, int16_t& out_r)
+    {
+        if (pos == ADD_CTRL_BLOCK)
+        {
+            control(p);
+            render();
+            pos = 0;
+        }
+        out_l = block_l[pos];
+        out_r = block_r[pos];
+        pos++;
     }
 };
 
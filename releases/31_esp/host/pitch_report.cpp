@@ -0,0 +1,340 @@
+// pitch_report — how ESP's 1V/oct output follows a played line, on Linux.
+//
+// Builds ../main.cpp against shim/ (ComputerCard and the SDK calls as plain fields),
+// and ref/main.cpp (the zero-crossing tracker) in namespace ref. Both
+// cards get the same takes with the switch up (continuous tracking), 4x gain and the
+// band-pass wide open. Core 1's PitchTask() runs straight after each sample, as if it
+// took no time. Reports, per take:
+//
+//   gross    % of the time from 60 ms into each note to its end that CVOut1 is more
+//            than 20% (316 cents) off the note: octave slips and wrong harmonics
+//   latency  from each note's onset until CVOut1 is within 50 cents and stays there
+//            for 20 ms: median and 90th percentile, ms. miss counts notes it never
+//            settled on
+//   cost     ns per sample for ProcessSample, and per core 1 analysis (host, only
+//            relative: compare the rows)
+//
+// The synthetic takes are 24 notes drawn from B1..A5 (62..880 Hz), 350 ms each with
+// 50 ms gaps, at about -6 dBFS with noise at -40 dB. Recordings of single notes can be
+// added as WAV (16-bit PCM, any rate) and their pitch:
+//
+//   ./pitch_report
+//   ./pitch_report cello_g2.wav 98 voice_a3.wav 220
+#include "ComputerCard.h"
+#include "hardware/sync.h"
+#include "pico/multicore.h"
+#include <stdint.h>
+#include <limits.h>
+
+#define main esp_main
+namespace ref {
+#include "ref/main.cpp"
+}
+#include "../main.cpp"
+#undef main
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+constexpr double Fs = 48000.0;
+constexpr int Ms = 48;             // samples per ms
+constexpr double Amp = 1000.0;     // of the card's +-2048 input
+
+struct Note {
+    double hz;
+    int start;    // samples
+    int length;
+};
+
+struct Take {
+    std::string name;
+    std::vector<int16_t> audio;
+    std::vector<Note> notes;
+};
+
+std::vector<Note> drawNotes(std::mt19937& rng, int lowMidi, int highMidi)
+{
+    std::uniform_int_distribution<int> midi(lowMidi, highMidi);
+    std::vector<Note> notes;
+    for (int i = 0; i < 24; ++i)
+        notes.push_back({440.0 * std::pow(2.0, (midi(rng) - 69) / 12.0), i * 400 * Ms, 350 * Ms});
+    return notes;
+}
+
+int16_t clip(double v)
+{
+    return (int16_t)std::lrint(std::max(-2047.0, std::min(2047.0, v)));
+}
+
+// Each note from harmonics 1..N at the given amplitudes, peaking at Amp, with 5 ms attack
+// and release
+Take additive(const std::string& name, const std::vector<Note>& notes, const std::vector<double>& harm,
+    std::mt19937& rng)
+{
+    Take t{name, std::vector<int16_t>(notes.back().start + notes.back().length + 100 * Ms), notes};
+    std::uniform_real_distribution<double> noise(-Amp / 100, Amp / 100);
+    double norm = 0;
+    for (int i = 0; i < 4096; ++i) {
+        double v = 0;
+        for (size_t k = 0; k < harm.size(); ++k) v += harm[k] * std::sin(2 * M_PI * (double)(k + 1) * i / 4096);
+        norm = std::max(norm, std::fabs(v));
+    }
+    for (const Note& n : notes) {
+        for (int i = 0; i < n.length; ++i) {
+            const double env = std::min({1.0, i / (5.0 * Ms), (n.length - i) / (5.0 * Ms)});
+            double v = 0;
+            for (size_t k = 0; k < harm.size(); ++k) {
+                const double f = n.hz * (double)(k + 1);
+                if (f < Fs / 2) v += harm[k] * std::sin(2 * M_PI * f * i / Fs);
+            }
+            t.audio[n.start + i] = clip(Amp * env * v / norm);
+        }
+    }
+    for (int16_t& s : t.audio) s = clip(s + noise(rng));
+    return t;
+}
+
+// Karplus-Strong plucks: a noise burst into an averaging loop, decaying through the note
+Take pluck(const std::string& name, const std::vector<Note>& notes, std::mt19937& rng)
+{
+    Take t{name, std::vector<int16_t>(notes.back().start + notes.back().length + 100 * Ms), notes};
+    std::uniform_real_distribution<double> uni(-1.0, 1.0);
+    for (const Note& n : notes) {
+        const double delay = Fs / n.hz - 0.5;   // the average adds half a sample
+        std::vector<double> s(n.length);
+        for (int i = 0; i < n.length; ++i) {
+            if (i < (int)delay + 2) {
+                s[i] = uni(rng);
+                continue;
+            }
+            const double p = i - delay;
+            const int k = (int)p;
+            const double frac = p - k;
+            const double a = s[k] + frac * (s[k + 1] - s[k]);
+            const double b = s[k - 1] + frac * (s[k] - s[k - 1]);
+            s[i] = 0.996 * 0.5 * (a + b);
+        }
+        for (int i = 0; i < n.length; ++i) {
+            const double release = std::min(1.0, (n.length - i) / (5.0 * Ms));
+            t.audio[n.start + i] = clip(Amp * 0.8 * release * s[i]);
+        }
+    }
+    for (int16_t& s : t.audio) s = clip(s + uni(rng) * Amp / 100);
+    return t;
+}
+
+uint32_t le32(const uint8_t* p) { return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24; }
+uint16_t le16(const uint8_t* p) { return (uint16_t)(p[0] | p[1] << 8); }
+
+// One note at `hz` from a 16-bit PCM WAV: first channel, resampled to 48 kHz, peak at Amp
+bool wavTake(const char* path, double hz, Take& t)
+{
+    FILE* f = std::fopen(path, "rb");
+    if (!f) return false;
+    std::vector<uint8_t> bytes;
+    uint8_t buf[4096];
+    size_t got;
+    while ((got = std::fread(buf, 1, sizeof buf, f)) > 0) bytes.insert(bytes.end(), buf, buf + got);
+    std::fclose(f);
+    if (bytes.size() < 12 || std::memcmp(bytes.data(), "RIFF", 4) || std::memcmp(&bytes[8], "WAVE", 4))
+        return false;
+
+    int channels = 0, bits = 0;
+    double rate = 0;
+    const uint8_t* data = nullptr;
+    size_t dataBytes = 0;
+    for (size_t p = 12; p + 8 <= bytes.size();) {
+        const uint32_t size = le32(&bytes[p + 4]);
+        if (!std::memcmp(&bytes[p], "fmt ", 4) && size >= 16) {
+            channels = le16(&bytes[p + 10]);
+            rate = le32(&bytes[p + 12]);
+            bits = le16(&bytes[p + 22]);
+        } else if (!std::memcmp(&bytes[p], "data", 4)) {
+            data = &bytes[p + 8];
+            dataBytes = std::min<size_t>(size, bytes.size() - p - 8);
+        }
+        p += 8 + size + (size & 1);
+    }
+    if (!data || bits != 16 || channels < 1 || rate <= 0) return false;
+
+    const size_t frames = dataBytes / (2 * channels);
+    std::vector<double> x(frames);
+    double peak = 1;
+    for (size_t i = 0; i < frames; ++i) {
+        x[i] = (int16_t)le16(data + 2 * channels * i);
+        peak = std::max(peak, std::fabs(x[i]));
+    }
+    const size_t out = (size_t)(frames * Fs / rate);
+    t.name = path;
+    t.audio.resize(out);
+    for (size_t i = 0; i < out; ++i) {
+        const double p = i * rate / Fs;
+        const size_t k = std::min((size_t)p, frames - 1);
+        const double v = k + 1 < frames ? x[k] + (p - k) * (x[k + 1] - x[k]) : x[k];
+        t.audio[i] = clip(Amp * v / peak);
+    }
+    t.notes = {{hz, 0, (int)out}};
+    return true;
+}
+
+// CVOut1 every ms over a take. Fast attack is switched on (a switch-down flick) first.
+template <typename Card>
+std::vector<int32_t> play(const Take& t, bool fast)
+{
+    auto card = std::make_unique<Card>();
+    card->in_knob[ComputerCard::Main] = 2048;   // 4x
+    card->in_knob[ComputerCard::X] = 0;         // band-pass wide open
+    card->in_knob[ComputerCard::Y] = 4095;
+    card->in_switch = ComputerCard::Up;
+    if (fast) {
+        card->in_switch = ComputerCard::Down;
+        card->Tick();
+        card->in_switch = ComputerCard::Up;
+    }
+    std::vector<int32_t> cv(t.audio.size() / Ms);
+    for (size_t i = 0; i < cv.size() * Ms; ++i) {
+        card->in_audio[0] = t.audio[i];
+        card->Tick();
+        if constexpr (std::is_same_v<Card, ESPCard>)
+            while (card->PitchTask()) {}
+        if (i % Ms == Ms - 1) cv[i / Ms] = card->out_cv_mv[0];
+    }
+    return cv;
+}
+
+struct Score {
+    double gross;    // %
+    double latP50;   // ms
+    double latP90;
+    int missed;
+};
+
+Score score(const Take& t, const std::vector<int32_t>& cv)
+{
+    const double grossMv = 1000.0 * std::log2(1.2);
+    long frames = 0, gross = 0;
+    int missed = 0;
+    std::vector<double> lat;
+    for (const Note& n : t.notes) {
+        const double want = 1000.0 * std::log2(n.hz / 440.0) + 4750.0;
+        const int from = n.start / Ms, to = std::min<int>((n.start + n.length) / Ms, (int)cv.size());
+        auto off = [&](int ms) { return std::fabs(cv[ms] - want); };
+
+        int settled = -1;
+        for (int ms = from; ms + 20 <= to && settled < 0; ++ms) {
+            bool hold = true;
+            for (int k = 0; k < 20 && hold; ++k) hold = off(ms + k) <= 50.0;
+            if (hold) settled = ms;
+        }
+        if (settled < 0) missed++;
+        else lat.push_back(settled - from);
+
+        for (int ms = from + 60; ms < to; ++ms) {
+            frames++;
+            if (off(ms) > grossMv) gross++;
+        }
+    }
+    std::sort(lat.begin(), lat.end());
+    auto pct = [&](double p) { return lat.empty() ? 0.0 : lat[(size_t)(p * (lat.size() - 1) + 0.5)]; };
+    return {frames ? 100.0 * gross / frames : 0.0, pct(0.5), pct(0.9), missed};
+}
+
+void row(const Take& t)
+{
+    const Score a = score(t, play<ref::ESPCard>(t, false));
+    const Score b = score(t, play<ESPCard>(t, false));
+    const Score c = score(t, play<ESPCard>(t, true));
+    std::printf("%-18s", t.name.c_str());
+    for (const Score& s : {a, b, c}) {
+        if (s.missed == (int)t.notes.size()) std::printf("  %6.1f %5s %5s %4d", s.gross, "-", "-", s.missed);
+        else std::printf("  %6.1f %5.0f %5.0f %4d", s.gross, s.latP50, s.latP90, s.missed);
+    }
+    std::printf("\n");
+}
+
+template <typename Card>
+double processNs(const Take& t)
+{
+    double best = 1e30;
+    for (int pass = 0; pass < 5; ++pass) {
+        auto card = std::make_unique<Card>();
+        const auto t0 = std::chrono::steady_clock::now();
+        for (int16_t s : t.audio) {
+            card->in_audio[0] = s;
+            card->Tick();
+        }
+        const auto t1 = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::nano>(t1 - t0).count() / t.audio.size());
+    }
+    return best;
+}
+
+double analysisNs(const Take& t, int window)
+{
+    PitchRing ring;
+    PitchYin yin;
+    for (int16_t s : t.audio) PitchRing_Push(ring, s);
+    const uint32_t end = ring.written;
+    double best = 1e30;
+    volatile uint32_t sink = 0;
+    for (int pass = 0; pass < 5; ++pass) {
+        int runs = 0;
+        const auto t0 = std::chrono::steady_clock::now();
+        for (uint32_t w = 1024; w <= end; w += PITCH_HOP, ++runs) {
+            PitchYin_Load(yin, ring, w, window);
+            PitchYin_Analyse(yin, window);
+            sink = sink + yin.periodQ8;
+        }
+        const auto t1 = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::nano>(t1 - t0).count() / runs);
+    }
+    return best;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::mt19937 rng(75);
+    const std::vector<Note> line = drawNotes(rng, 35, 81);
+    const std::vector<Note> low = drawNotes(rng, 35, 52);
+
+    std::vector<Take> takes;
+    takes.push_back(additive("sine", line, {1}, rng));
+    takes.push_back(additive("saw", line, {1, 1 / 2.0, 1 / 3.0, 1 / 4.0, 1 / 5.0, 1 / 6.0, 1 / 7.0, 1 / 8.0,
+        1 / 9.0, 1 / 10.0, 1 / 11.0, 1 / 12.0}, rng));
+    takes.push_back(additive("weak fundamental", line, {0.15, 1, 0.8, 0.6, 0.4, 0.3, 0.2, 0.1}, rng));
+    takes.push_back(additive("low saw", low, {1, 1 / 2.0, 1 / 3.0, 1 / 4.0, 1 / 5.0, 1 / 6.0, 1 / 7.0,
+        1 / 8.0, 1 / 9.0, 1 / 10.0, 1 / 11.0, 1 / 12.0}, rng));
+    takes.push_back(pluck("pluck", line, rng));
+    for (int i = 1; i + 1 < argc; i += 2) {
+        Take t;
+        if (wavTake(argv[i], std::atof(argv[i + 1]), t)) takes.push_back(t);
+        else std::fprintf(stderr, "%s: not a 16-bit PCM WAV\n", argv[i]);
+    }
+
+    std::printf("%-18s  %-27s  %-27s  %-27s\n", "", "REF (zero crossings)", "now (YIN)",
+        "now, fast attack");
+    std::printf("%-18s", "take");
+    for (int i = 0; i < 3; ++i) std::printf("  %6s %5s %5s %4s", "gross%", "p50", "p90", "miss");
+    std::printf("\n");
+    for (const Take& t : takes) row(t);
+
+    std::printf("\ncost (host ns, only relative)\n");
+    std::printf("ProcessSample per sample      REF %6.1f   now %6.1f\n", processNs<ref::ESPCard>(takes[1]),
+        processNs<ESPCard>(takes[1]));
+    std::printf("core 1 per analysis (%.1f ms) window %d: %8.0f   fast, window %d: %8.0f\n",
+        PITCH_HOP * 1000.0 / PITCH_FS, PITCH_WINDOW, analysisNs(takes[1], PITCH_WINDOW), PITCH_WINDOW_FAST,
+        analysisNs(takes[1], PITCH_WINDOW_FAST));
+    return 0;
+}
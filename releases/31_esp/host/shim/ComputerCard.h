@@ -0,0 +1,64 @@
+// ComputerCard.h (host) — the card's API as plain fields, for ESP's main.cpp on Linux.
+//
+// Same method names and semantics as ../../ComputerCard.h for everything main.cpp uses.
+// The harness writes the public in_* fields, then calls Tick() once per sample;
+// ProcessSample's outputs land in the out_* fields (CV outputs as the millivolts asked
+// for, before calibration). It takes the real header's include guard, so main.cpp's
+// #include "ComputerCard.h" next to it finds this one already in.
+#ifndef COMPUTERCARD_H
+#define COMPUTERCARD_H
+
+#include <cstdint>
+
+class ComputerCard {
+public:
+    enum Knob {Main, X, Y};
+    enum Switch {Down, Middle, Up};
+
+    int32_t in_knob[3] = {2048, 2048, 2048};
+    Switch  in_switch = Up;
+    int16_t in_audio[2] = {0, 0};
+
+    int16_t out_audio[2] = {0, 0};
+    int32_t out_cv_mv[2] = {0, 0};
+    int16_t out_cv[2] = {0, 0};
+    bool    out_pulse[2] = {false, false};
+    uint16_t out_led[6] = {};
+
+    virtual ~ComputerCard() {}
+    virtual void ProcessSample() = 0;
+
+    // One sample, as the audio interrupt calls it
+    void Tick()
+    {
+        ProcessSample();
+        last_switch = in_switch;
+    }
+
+    void Run() {}
+    void EnableNormalisationProbe() {}
+
+protected:
+    int32_t KnobVal(Knob k) { return in_knob[k]; }
+    Switch  SwitchVal() { return in_switch; }
+    bool    SwitchChanged() { return in_switch != last_switch; }
+    int16_t AudioIn1() { return in_audio[0]; }
+    int16_t AudioIn2() { return in_audio[1]; }
+
+    void AudioOut1(int16_t v) { out_audio[0] = v; }
+    void AudioOut2(int16_t v) { out_audio[1] = v; }
+    bool CVOutMillivolts(int i, int32_t mv) { out_cv_mv[i] = mv; return false; }
+    void CVOut1(int16_t v) { out_cv[0] = v; }
+    void CVOut2(int16_t v) { out_cv[1] = v; }
+    void PulseOut1(bool v) { out_pulse[0] = v; }
+    void PulseOut2(bool v) { out_pulse[1] = v; }
+
+    void LedBrightness(uint32_t i, uint16_t v) { out_led[i] = v; }
+    void LedOn(uint32_t i, bool v = true) { out_led[i] = v ? 4095 : 0; }
+    void LedOff(uint32_t i) { out_led[i] = 0; }
+
+private:
+    Switch last_switch = Up;
+};
+
+#endif // COMPUTERCARD_H
@@ -0,0 +1,7 @@
+// hardware/sync.h (host) — barriers and events are no-ops: the harness runs core 1's
+// work on the same thread, straight after each sample.
+#pragma once
+
+static inline void __dmb() {}
+static inline void __sev() {}
+static inline void __wfe() {}
@@ -0,0 +1,4 @@
+// pico/multicore.h (host) — core 1 is never launched; the harness calls its work itself.
+#pragma once
+
+static inline void multicore_launch_core1(void (*)()) {}
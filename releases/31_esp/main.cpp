@@ -1,5 +1,7 @@
 // main.cpp
 #include "ComputerCard.h"
+#include "pico/multicore.h"
+#include "pitch_track.h"
 #include <stdint.h>
 #include <limits.h>
 
@@ -11,7 +13,7 @@
     - Adjustable bandpass filter
     - Envelope follower (rectify + separate attack/release)
     - Gate (Schmitt) from envelope
-    - Pitch estimator (zero-crossing w/ hysteresis)
+    - Pitch tracker (YIN on core 1, see pitch_track.h)
     - 1V/oct output
 
   Control mapping (adjust in UpdateControls()):
@@ -20,6 +22,7 @@
     Knob3: Bandpass filter upper cutoff (~20 Hz .. ~5 kHz pegged to lower cutoff)
 
     Switch: When set to middle, pitch updates only when gate is high, otherwise continuous
+            Down (momentary) toggles fast-attack pitch tracking (LED 5 lit)
 
   Input and Output Mapping:
     AudioIn1 : Audio In
@@ -29,6 +32,7 @@
     CVOut2 : Envelope
     Pulse1 : Gate
     Pulse2 : Trigger
+    LED 1  : Pitch confidence
   
 */
 
@@ -133,19 +137,20 @@ struct ESPState {
   uint16_t trig_off_Q15 = 1600;  // this sets the gate threshold hysteresis, prevents flickering
   bool gate = false;
 
-  // Pitch (zero-crossing with hysteresis)
-  int32_t n = 0;
-  int32_t zc_last_cross_n = 0;
-  int16_t zc_pos_thresh = 2000;
-  int16_t zc_neg_thresh = -2000;
-  bool zc_was_pos = false;
+  // Pitch controls (core 0 writes, core 1 reads)
+  volatile bool hold_pitch = false;   // switch middle and gate low
+  volatile bool fast_attack = false;  // toggled by switch down
+
+  // Pitch (core 1 only)
+  uint32_t pitch_hzQ16_16 = 0;   // Hz in Q16.16, smoothed, as on CVOut1
+  uint32_t jump_hzQ16_16 = 0;    // a far estimate waiting to be seen again
 
   // Outputs
   int16_t env_out = 0;           // Q15 envelope
   int16_t trig_out = 0;          // 0 or 32767 (unused, retained for reference)
-  uint32_t pitch_hzQ16_16 = 0;   // Hz in Q16.16 (updated on new ZC)
-  int32_t pitch_mv = 0;          // cached millivolts for CVOut1
-  uint16_t pitch_led = 0;        // brightness for LED 2
+  volatile int32_t pitch_mv = 0;       // cached millivolts for CVOut1 (core 1 writes)
+  volatile uint16_t pitch_led = 0;     // brightness for LED 2 (core 1 writes)
+  volatile uint16_t conf_led = 0;      // brightness for LED 1 (core 1 writes)
   uint16_t trig_countdown = 0;   // remaining samples for trigger pulse
 };
 
@@ -154,11 +159,16 @@ class ESPCard : public ComputerCard {
 public:
   ESPState esp;
   OneVOct  onev;
-  uint32_t sm_hzQ16 = 0; // control-rate smoothed Hz (Q16.16)
   uint32_t control_counter = 0;
 
+  // Band-passed audio to core 1, and core 1's tracker
+  PitchRing pitch_ring;
+  PitchYin  yin;
+  uint32_t  analysed = 0;  // ring position of the last analysis (core 1)
+
   static constexpr uint32_t kControlIntervalSamples = 240; // ~200 Hz
   static constexpr uint16_t kTriggerPulseSamples = 96;      // 2 ms @ 48 kHz
+  static constexpr uint16_t kPitchConfMin = 26214;          // 0.8 in Q15: below this the CV holds
 
   ESPCard() {
     OneVOct_Init(onev);
@@ -216,44 +226,64 @@ public:
   }
 
 
-  inline uint32_t PitchZC(int16_t bp) {
-    // hysteresis polarity tracking
-    if (bp > esp.zc_pos_thresh) esp.zc_was_pos = true;
-    else if (bp < esp.zc_neg_thresh) esp.zc_was_pos = false;
+  // ----- Pitch (core 1) -----
+  // Take one analysis into the CV. Normal mode smooths small moves (prevents
+  // warble) and lets a jump of more than a fourth through only once two
+  // analyses in a row agree on it, so a single octave slip never reaches
+  // the output. Fast attack follows every confident analysis directly.
+  void UpdatePitch(bool fast) {
+    esp.conf_led = (uint16_t)(yin.confQ15 >> 3);
+    if (!yin.periodQ8 || yin.confQ15 < kPitchConfMin || esp.hold_pitch) return; // CV holds
 
-    uint32_t hzQ16 = 0;
-    if (!esp.zc_was_pos && bp >= 0) {
-      int32_t period = esp.n - esp.zc_last_cross_n;
-      esp.zc_last_cross_n = esp.n;
-      // plausible period window: ~60..1500 Hz at 48k → 32..800 samples
-      if (period > 16 && period < 800) {
-        hzQ16 = ((uint32_t)48000 << 16) / (uint32_t)period;
-      }
+    uint32_t hzQ16 = PitchYin_HzQ16(yin.periodQ8);
+    uint32_t sm = esp.pitch_hzQ16_16;
+    if (fast || !sm) {
+      sm = hzQ16;
+    }
+    else if ((uint64_t)hzQ16 * 3 > (uint64_t)sm * 4 || (uint64_t)hzQ16 * 4 < (uint64_t)sm * 3) {
+      uint32_t j = esp.jump_hzQ16_16;
+      uint32_t diff = hzQ16 > j ? hzQ16 - j : j - hzQ16;
+      esp.jump_hzQ16_16 = hzQ16;
+      if (diff > (hzQ16 >> 5)) return;   // not seen twice (within 3%) yet
+      sm = hzQ16;
+    }
+    else {
+      const int32_t a = 13107; // ~0.2 in Q16.16
+      sm = (uint32_t)(((int64_t)a * hzQ16 + (int64_t)(65536 - a) * sm) >> 16);
     }
-    esp.n++;
-    return hzQ16;
+    esp.jump_hzQ16_16 = 0;
+    esp.pitch_hzQ16_16 = sm;
+
+    int32_t vQ16 = OneVOct_VoltsQ16(onev, sm); // Hz -> volts (Q16.16)
+    int32_t mv   = VoltsQ16_to_mV(vQ16);       // volts -> millivolts (int)
+    esp.pitch_led = (uint16_t)(((uint32_t)mv * 4095) / CV_FULL_SCALE_MV);
+    esp.pitch_mv = mv;
   }
 
-  void RunControlFrame() {
-    UpdateControls();
+  // Analyse the newest hop the ISR has filled. Returns false once caught up.
+  bool PitchTask() {
+    uint32_t w = pitch_ring.written & ~(uint32_t)(PITCH_HOP - 1);
+    if (w == analysed) return false;
+    analysed = w;   // if core 1 fell behind, skip straight to the newest
+    __dmb();
+
+    bool fast = esp.fast_attack;
+    int window = fast ? PITCH_WINDOW_FAST : PITCH_WINDOW;
+    if (w < (uint32_t)(window + PITCH_MAX_LAG + 1)) return true; // not enough audio yet
+    PitchYin_Load(yin, pitch_ring, w, window);
+    PitchYin_Analyse(yin, window);
+    UpdatePitch(fast);
+    return true;
+  }
 
-    // Smooth the Hz estimate a bit (prevents warble)
-    uint32_t inQ16 = esp.pitch_hzQ16_16;
-    if (inQ16) {
-      const int32_t a = 13107; // ~0.2 in Q16.16
-      sm_hzQ16 = (uint32_t)(((int64_t)a * inQ16 + (int64_t)(65536 - a) * sm_hzQ16) >> 16);
+  void PitchLoop() {
+    while (true) {
+      if (!PitchTask()) __wfe();
     }
+  }
 
-    if (sm_hzQ16) {
-      int32_t vQ16 = OneVOct_VoltsQ16(onev, sm_hzQ16); // Hz -> volts (Q16.16)
-      int32_t mv   = VoltsQ16_to_mV(vQ16);             // volts -> millivolts (int)
-      esp.pitch_mv = mv;
-      esp.pitch_led = (uint16_t)(((uint32_t)mv * 4095) / CV_FULL_SCALE_MV);
-    }
-    else {
-      esp.pitch_mv = 0;
-      esp.pitch_led = 0;
-    }
+  void RunControlFrame() {
+    UpdateControls();
   }
 
   void ProcessSample() override {
@@ -297,16 +327,16 @@ public:
     PulseOut1(esp.gate);
     LedOn(4, esp.gate);
 
-    // Pitch estimate (update on crossings)
-    uint32_t hzQ16 = PitchZC(bp);
-    if ((SwitchVal() != Switch::Middle) || esp.gate) {
-      if (hzQ16) esp.pitch_hzQ16_16 = hzQ16;
-    };
-    
+    // Pitch: core 1 tracks the band-passed audio; only hand it samples here
+    if (PitchRing_Push(pitch_ring, bp)) __sev();
+    esp.hold_pitch = (SwitchVal() == Switch::Middle) && !esp.gate;
+    if (SwitchChanged() && SwitchVal() == Switch::Down) esp.fast_attack = !esp.fast_attack;
+    LedOn(5, esp.fast_attack);
 
     // Pitch CV outs
     (void)CVOutMillivolts(0, esp.pitch_mv);
     LedBrightness(2, esp.pitch_led);
+    LedBrightness(1, esp.conf_led);
 
     // Envelope Out
     if (esp.env_out > 2047) esp.env_out = 2047;
@@ -324,9 +354,18 @@ public:
   }
 };
 
+static ESPCard *core1Card = nullptr;
+
+static void core1_entry()
+{
+  core1Card->PitchLoop();
+}
+
 int main()
 {
-  ESPCard esp;
+  static ESPCard esp;  // static: the pitch buffers don't fit core 0's stack
+  core1Card = &esp;
+  multicore_launch_core1(core1_entry);
   esp.Run();
   esp.EnableNormalisationProbe();
 }
@@ -0,0 +1,157 @@
+// pitch_track.h
+#ifndef PITCH_TRACK_H
+#define PITCH_TRACK_H
+
+#include <stdint.h>
+#include "hardware/sync.h"
+
+/*
+  Pitch tracker — YIN over a decimated block, for core 1
+
+  The audio ISR only pushes the band-passed signal into PitchRing: four
+  samples are averaged down to 12 kHz and stored as 12-bit values. Every
+  PITCH_HOP decimated samples (5.3 ms) it SEVs core 1, which copies the
+  newest window out of the ring and runs PitchYin_Analyse() on it.
+
+  YIN (de Cheveigne & Kawahara, 2002):
+    d(t)  = sum over the window of (x[j] - x[j+t])^2
+    d'(t) = d(t) * t / sum(d(1..t))     cumulative mean normalised difference
+  The period is the first lag whose d' dips under PITCH_YIN_THRESH, taken
+  down to the bottom of that dip and interpolated. Picking the first dip
+  rather than the deepest is what keeps a strong second or third harmonic
+  from pulling the answer up an octave, and the normalisation keeps the
+  short lags (the upper octaves) from winning on bright inputs. 1 - d' at
+  the dip is the confidence: near 1 for a clean periodic note, low for
+  noise, chords and silence.
+
+  Lags run 8..200 decimated samples: 60 Hz to 1.5 kHz, as the zero-crossing
+  tracker allowed.
+*/
+
+#define PITCH_DECIM        4
+#define PITCH_FS           (48000 / PITCH_DECIM)
+#define PITCH_RING_SIZE    1024                 // decimated samples, power of two
+#define PITCH_HOP          64                   // decimated samples between analyses
+#define PITCH_MIN_LAG      8                    // 1500 Hz
+#define PITCH_MAX_LAG      200                  // 60 Hz
+#define PITCH_WINDOW       160                  // integration window, decimated samples
+#define PITCH_WINDOW_FAST  80                   // fast-attack window
+#define PITCH_YIN_THRESH   (4096 * 15 / 100)    // d' under 0.15 (Q12) counts as a dip
+
+// ================= Core 0 -> core 1 sample ring =================
+// One writer per field: core 0 owns buf, written, acc and phase; core 1
+// only reads buf[] behind `written`.
+struct PitchRing {
+  int16_t buf[PITCH_RING_SIZE];
+  volatile uint32_t written = 0;  // decimated samples pushed
+  int32_t acc = 0;
+  uint8_t phase = 0;
+};
+
+// Audio rate. Returns true when a hop has filled (the caller SEVs core 1).
+static inline bool PitchRing_Push(PitchRing &r, int16_t x) {
+  r.acc += x;
+  if (++r.phase < PITCH_DECIM) return false;
+  r.phase = 0;
+  uint32_t w = r.written;
+  r.buf[w & (PITCH_RING_SIZE - 1)] = (int16_t)(r.acc >> 6);  // sum of 4 int16 -> 12 bits
+  r.acc = 0;
+  __dmb();
+  r.written = w + 1;
+  return ((w + 1) & (PITCH_HOP - 1)) == 0;
+}
+
+// ================= YIN (core 1) =================
+struct PitchYin {
+  int16_t  x[PITCH_WINDOW + PITCH_MAX_LAG + 1];
+  uint32_t d[PITCH_MAX_LAG + 2];
+  uint16_t dn[PITCH_MAX_LAG + 2];  // d', Q12
+
+  // Last analysis
+  uint32_t periodQ8 = 0;   // decimated samples, Q8 (0: no pitch)
+  uint16_t confQ15 = 0;    // 1 - d' at the dip
+};
+
+// Copy the window and the lags behind it (window + PITCH_MAX_LAG + 1
+// samples) ending at `end` out of the ring
+static inline void PitchYin_Load(PitchYin &y, const PitchRing &r, uint32_t end, int window) {
+  int len = window + PITCH_MAX_LAG + 1;
+  uint32_t start = end - (uint32_t)len;
+  for (int i = 0; i < len; i++) y.x[i] = r.buf[(start + (uint32_t)i) & (PITCH_RING_SIZE - 1)];
+}
+
+// d(t) for t = 1..PITCH_MAX_LAG+1 over the newest `window` samples, each
+// against the one t before it. 12-bit input keeps each square under 2^24
+// and 160 of them under 2^32.
+static inline void PitchYin_Difference(PitchYin &y, int window) {
+  for (int t = 1; t <= PITCH_MAX_LAG + 1; t++) {
+    const int16_t *a = y.x + PITCH_MAX_LAG + 1;
+    const int16_t *b = a - t;
+    uint32_t sum = 0;
+    int j = 0;
+    for (; j + 4 <= window; j += 4) {
+      int32_t e0 = a[j] - b[j], e1 = a[j + 1] - b[j + 1];
+      int32_t e2 = a[j + 2] - b[j + 2], e3 = a[j + 3] - b[j + 3];
+      sum += (uint32_t)(e0 * e0) + (uint32_t)(e1 * e1) + (uint32_t)(e2 * e2) + (uint32_t)(e3 * e3);
+    }
+    for (; j < window; j++) {
+      int32_t e = a[j] - b[j];
+      sum += (uint32_t)(e * e);
+    }
+    y.d[t] = sum;
+  }
+}
+
+// Analyse the window loaded by PitchYin_Load. Leaves periodQ8/confQ15 set
+// and returns true if the signal had any periodicity at all.
+static inline bool PitchYin_Analyse(PitchYin &y, int window) {
+  PitchYin_Difference(y, window);
+
+  // d'(t), with the running sum of d in 64 bits
+  uint64_t cum = 0;
+  y.dn[0] = 4096;
+  for (int t = 1; t <= PITCH_MAX_LAG + 1; t++) {
+    cum += y.d[t];
+    if (!cum) { y.dn[t] = 4096; continue; }
+    uint64_t q = (((uint64_t)y.d[t] * (uint32_t)t) << 12) / cum;
+    y.dn[t] = (uint16_t)(q > 0xFFFF ? 0xFFFF : q);
+  }
+  if (!cum) { y.periodQ8 = 0; y.confQ15 = 0; return false; }
+
+  // First dip under the threshold, followed to its bottom; else the deepest
+  int best = 0;
+  for (int t = PITCH_MIN_LAG; t <= PITCH_MAX_LAG; t++) {
+    if (y.dn[t] < PITCH_YIN_THRESH) {
+      while (t < PITCH_MAX_LAG && y.dn[t + 1] < y.dn[t]) t++;
+      best = t;
+      break;
+    }
+  }
+  if (!best) {
+    best = PITCH_MIN_LAG;
+    for (int t = PITCH_MIN_LAG + 1; t <= PITCH_MAX_LAG; t++)
+      if (y.dn[t] < y.dn[best]) best = t;
+  }
+
+  // Parabola through d at the dip: offset = (a - c) / (2 (a - 2b + c)), Q8
+  int64_t a = y.d[best - 1], b = y.d[best], c = y.d[best + 1];
+  int64_t den = a - 2 * b + c;
+  int32_t offQ8 = 0;
+  if (den > 0) {
+    int64_t off = ((a - c) * 128) / den;
+    offQ8 = (int32_t)(off > 128 ? 128 : (off < -128 ? -128 : off));
+  }
+  y.periodQ8 = (uint32_t)((best << 8) + offQ8);
+
+  int32_t conf = 32767 - ((int32_t)y.dn[best] << 3);
+  y.confQ15 = (uint16_t)(conf < 0 ? 0 : conf);
+  return true;
+}
+
+// Hz in Q16.16 for a period in decimated samples (Q8)
+static inline uint32_t PitchYin_HzQ16(uint32_t periodQ8) {
+  if (!periodQ8) return 0;
+  return (uint32_t)(((uint64_t)PITCH_FS << 24) / periodQ8);
+}
+
+#endif // PITCH_TRACK_H
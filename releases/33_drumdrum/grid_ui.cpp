@@ -16,6 +16,7 @@
 #include "grid_ui.h"
 #include "monome_mext.h"
 #include "shared_state.h"
+#include "seq_events.h"
 
 #include "pico/time.h"
 
@@ -31,7 +32,6 @@ struct RenderSnap {
     uint8_t  editStep;
     uint8_t  currentStep;
     uint8_t  playing;
-    uint32_t tickEpoch;
     bool     valid;
 };
 static RenderSnap snap = {};
@@ -125,10 +125,12 @@ void grid_ui_process_input(void)
                 gState.seqLength = newLen;
                 if (gState.editStep    >= newLen) gState.editStep    = 0;
                 if (gState.currentStep >= newLen) gState.currentStep = 0;
+                seq_batch_note_local(SEQ_EVENT_LENGTH, newLen);
             } else {
                 // any other left cell selects the edit step for that column
                 if (x < gState.seqLength) {
                     gState.editStep = x;
+                    seq_batch_note_local(SEQ_EVENT_EDIT_STEP, x);
                 }
             }
         } else {
@@ -137,6 +139,7 @@ void grid_ui_process_input(void)
                 // only col 15 row 0 is a button; cols 8..14 are reserved
                 if (x == 15) {
                     gState.playing = gState.playing ? 0 : 1;
+                    seq_batch_note_local(SEQ_EVENT_PLAYING, gState.playing);
                 }
             } else if (y >= 1 && y <= 5) {
                 // pitch picker — 40 cells covering all 128 MIDI pitches
@@ -146,6 +149,7 @@ void grid_ui_process_input(void)
                 uint8_t off = (uint8_t)(((5 - y) << 3) + (x - 8));
                 if (off < PITCH_GRID_CELLS) {
                     gState.pitch[gState.editStep] = cell_to_pitch(off);
+                    seq_batch_note_local(SEQ_EVENT_PITCH, gState.editStep);
                 }
             } else {
                 // y == 6 or 7 — velocity bar (16 cells, bottom-left = low)
@@ -153,6 +157,7 @@ void grid_ui_process_input(void)
                 uint16_t v = (uint16_t)((idx + 1) << 4);             // 16..256
                 if (v > 255) v = 255;
                 gState.velocity[gState.editStep] = (uint8_t)v;
+                seq_batch_note_local(SEQ_EVENT_VELOCITY, gState.editStep);
             }
         }
     }
@@ -165,7 +170,6 @@ static bool snap_matches(const RenderSnap &a)
     if (a.editStep    != gState.editStep)    return false;
     if (a.currentStep != gState.currentStep) return false;
     if (a.playing     != gState.playing)     return false;
-    if (a.tickEpoch   != gState.tickEpoch)   return false;
     if (memcmp((const void*)a.pitch,    (const void*)gState.pitch,    8) != 0) return false;
     if (memcmp((const void*)a.velocity, (const void*)gState.velocity, 8) != 0) return false;
     return true;
@@ -179,7 +183,6 @@ static void take_snapshot(RenderSnap &out)
     out.editStep    = gState.editStep;
     out.currentStep = gState.currentStep;
     out.playing     = gState.playing;
-    out.tickEpoch   = gState.tickEpoch;
     out.valid       = true;
 }
 
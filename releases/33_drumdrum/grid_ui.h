@@ -13,9 +13,9 @@ void grid_ui_init(void);
 // gState. Call from the Core 1 USB loop.
 void grid_ui_process_input(void);
 
-// Repaint LEDs from gState whenever the displayed state has changed.
-// Call from the Core 1 USB loop. Internally rate-limited so it's cheap
-// to call every iteration.
+// Repaint LEDs from gState if the displayed state has changed. The
+// Core 1 loop calls this at most once per frame, only when its event
+// batch says something changed.
 void grid_ui_render(void);
 
 #ifdef __cplusplus
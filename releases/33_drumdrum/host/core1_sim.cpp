@@ -0,0 +1,235 @@
+// core1_sim — drumdrum's Core 0 → Core 1 signalling as two host threads.
+//
+// Builds ../seq_events.h as the firmware does. One thread plays Core 0: at the
+// fastest internal tempo (about 30 steps/s) it posts a step event per step and,
+// for half of every second, pitch and velocity edits as a fast knob twist would,
+// one per value change. The other plays Core 1 three ways:
+//
+//   spin         the old loop's shape: never sleeps, redraws / sends as soon
+//                as it sees a change (it polled gState.tickEpoch and diffed)
+//   wfe          sleeps in WFE until an SEV or the 1 ms backstop, flushes
+//                whatever arrived straight away
+//   wfe+frame    the firmware loop: as wfe, but flushes at most once per 1 ms
+//                frame, folding everything in between into one SeqBatch
+//
+// WFE/SEV are a latched event flag and a condition variable. Flushes do no work:
+// what matters is how often they happen.
+//
+// Columns:
+//   wake/s      Core 1 loop passes a second (each one pumps USB in the firmware)
+//   cpu %       Core 1 thread CPU time over wall time
+//   flush/s     Grid redraws / MIDI batches a second
+//   ev/flush    events folded into each flush
+//   lat avg/p99/max   from the post on Core 0 to the flush that carries it, in us
+//
+// Host figures are only relative (Linux scheduler wake-ups, not an M0+ WFE):
+// compare the rows.
+//
+//   ./core1_sim [seconds per mode]
+#include "../seq_events.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <time.h>
+#include <vector>
+
+volatile SeqEventRing gSeqEvents = {};
+
+void seq_batch_note_local(SeqEventType type, uint8_t arg)
+{
+    (void)type;
+    (void)arg;
+}
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr uint32_t FrameUs = 1000;   // CORE1_FRAME_US
+constexpr uint32_t IdleUs = 1000;    // CORE1_IDLE_US
+constexpr uint32_t StepUs = 33333;   // fastest internal tempo
+constexpr uint32_t MaxEvents = 1u << 20;
+
+std::mutex eventMutex;
+std::condition_variable eventCv;
+bool eventRegister = false;
+
+void wfeUntil(Clock::time_point deadline)
+{
+    std::unique_lock<std::mutex> lock(eventMutex);
+    eventCv.wait_until(lock, deadline, [] { return eventRegister; });
+    eventRegister = false;
+}
+
+int64_t nowUs(Clock::time_point t0)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - t0).count();
+}
+
+double threadCpuSeconds()
+{
+    timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+enum class Mode { Spin, Wfe, WfeFrame };
+const char* const ModeNames[] = {"spin", "wfe", "wfe+frame"};
+
+struct Run {
+    Mode mode;
+    double seconds;
+
+    // Post time of the n-th queued event, written by Core 0 before it publishes.
+    std::vector<int64_t> postUs = std::vector<int64_t>(MaxEvents);
+    std::atomic<bool> stop{false};
+    uint32_t posted = 0;
+    uint32_t dropped = 0;
+
+    uint64_t wakes = 0;
+    uint64_t flushes = 0;
+    double cpu = 0;
+    std::vector<int64_t> latencies;
+};
+
+void core0(Run& run, Clock::time_point t0)
+{
+    int64_t nextStep = 0;
+    int64_t nextEdit = 0;
+    uint8_t step = 0;
+    uint8_t edit = 0;
+    const int64_t endUs = (int64_t)(run.seconds * 1e6);
+
+    auto post = [&](SeqEventType type, uint8_t arg) {
+        if (run.posted >= MaxEvents)
+            return;
+        run.postUs[run.posted] = nowUs(t0);
+        if (seq_event_post(type, arg))
+            run.posted++;
+        else
+            run.dropped++;
+    };
+
+    for (;;) {
+        const int64_t next = std::min(nextStep, nextEdit);
+        if (next >= endUs)
+            break;
+        std::this_thread::sleep_until(t0 + std::chrono::microseconds(next));
+
+        if (next == nextStep) {
+            step = (uint8_t)((step + 1) & 7);
+            post(SEQ_EVENT_STEP, step);
+            nextStep += StepUs;
+        }
+        if (next == nextEdit) {
+            // A fast knob twist on every other half second: the pitch value
+            // changes every 250 us, velocity (twice the range) every 125 us.
+            const bool sweeping = (next / 500000) % 2 == 0;
+            if (sweeping) {
+                if (edit & 1)
+                    post(SEQ_EVENT_PITCH, 3);
+                post(SEQ_EVENT_VELOCITY, 3);
+            }
+            edit++;
+            nextEdit += 125;
+        }
+    }
+}
+
+void core1(Run& run, Clock::time_point t0)
+{
+    SeqBatch batch = {};
+    uint8_t seenOverflows = 0;
+    uint32_t drained = 0;
+    uint32_t flushed = 0;
+    int64_t nextFlushUs = 0;
+    const double cpu0 = threadCpuSeconds();
+
+    auto flush = [&] {
+        const int64_t now = nowUs(t0);
+        for (; flushed < drained; ++flushed)
+            run.latencies.push_back(now - run.postUs[flushed]);
+        run.flushes++;
+        batch = {};
+        nextFlushUs = run.mode == Mode::WfeFrame ? now + FrameUs : 0;
+    };
+
+    while (!run.stop.load(std::memory_order_relaxed)) {
+        run.wakes++;
+        drained += seq_events_drain(batch, seenOverflows);
+        if (batch.any() && nowUs(t0) >= nextFlushUs)
+            flush();
+        if (run.mode == Mode::Spin)
+            continue;
+
+        const int64_t wakeUs = batch.any() ? nextFlushUs : nowUs(t0) + IdleUs;
+        if (seq_events_pending() || nowUs(t0) >= wakeUs)
+            continue;
+        wfeUntil(t0 + std::chrono::microseconds(wakeUs));
+    }
+    drained += seq_events_drain(batch, seenOverflows);
+    if (batch.any())
+        flush();
+    run.cpu = threadCpuSeconds() - cpu0;
+}
+
+void measure(Run& run)
+{
+    gSeqEvents.w = gSeqEvents.r = 0;
+    gSeqEvents.overflows = 0;
+    eventRegister = false;
+
+    const Clock::time_point t0 = Clock::now();
+    std::thread consumer(core1, std::ref(run), t0);
+    std::thread producer(core0, std::ref(run), t0);
+    producer.join();
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    run.stop = true;
+    host_sev();
+    consumer.join();
+}
+
+} // namespace
+
+extern "C" void host_sev(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(eventMutex);
+        eventRegister = true;
+    }
+    eventCv.notify_one();
+}
+
+int main(int argc, char** argv)
+{
+    const double seconds = argc > 1 ? std::atof(argv[1]) : 3.0;
+
+    std::printf("%-10s %8s %9s %7s %8s %8s %8s %8s %8s\n", "core 1", "events", "wake/s", "cpu %",
+        "flush/s", "ev/flush", "lat avg", "lat p99", "lat max");
+    for (Mode mode : {Mode::Spin, Mode::Wfe, Mode::WfeFrame}) {
+        Run run;
+        run.mode = mode;
+        run.seconds = seconds;
+        measure(run);
+
+        std::vector<int64_t>& lat = run.latencies;
+        std::sort(lat.begin(), lat.end());
+        double sum = 0;
+        for (int64_t l : lat)
+            sum += (double)l;
+        const size_t n = lat.size();
+        std::printf("%-10s %8u %9.0f %7.1f %8.0f %8.1f %8.0f %8lld %8lld\n", ModeNames[(int)mode],
+            run.posted, run.wakes / seconds, 100.0 * run.cpu / seconds, run.flushes / seconds,
+            run.flushes ? (double)run.posted / run.flushes : 0.0, n ? sum / n : 0.0,
+            n ? (long long)lat[n * 99 / 100] : 0LL, n ? (long long)lat[n - 1] : 0LL);
+        if (run.dropped)
+            std::printf("%-10s %u events overflowed the ring\n", "", run.dropped);
+    }
+    return 0;
+}
@@ -0,0 +1,17 @@
+/* hardware/sync.h — the two barriers ../seq_events.h uses, for the host simulation.
+ * __dmb is a full fence. __sev sets the simulated event register of core1_sim.cpp
+ * and wakes a thread waiting in its WFE. */
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void host_sev(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#define __dmb() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __sev() host_sev()
@@ -45,6 +45,7 @@
 
 #include "ComputerCard.h"
 #include "shared_state.h"
+#include "seq_events.h"
 #include "usb_core1.h"
 #include "hardware/clocks.h"
 #include "pico/multicore.h"
@@ -56,7 +57,9 @@
 
 // Cross-core sequencer state. Defined once here, declared extern in
 // shared_state.h so Core 1 (USB host / device task) can read & write it.
+// gSeqEvents (seq_events.h) tells Core 1 what ProcessSample changed.
 volatile SharedState gState = {};
+volatile SeqEventRing gSeqEvents = {};
 
 
 class DFAMSequencer : public ComputerCard
@@ -227,7 +230,6 @@ public:
         gState.editStep    = 0;
         gState.currentStep = 0;
         gState.playing     = 1;
-        gState.tickEpoch   = 0;
         lastSeenSeqLength  = gState.seqLength;
     }
 
@@ -308,12 +310,14 @@ public:
                 if (gState.playing) {
                     // Pause the sequencer — step position is preserved
                     gState.playing = 0;
+                    seq_event_post(SEQ_EVENT_PLAYING, 0);
                 } else {
                     // Resume playback from the step after the last one played.
                     // This avoids re-triggering a step the user already heard.
                     gState.playing = 1;
                     gState.currentStep = (gState.currentStep + 1) % gState.seqLength;
-                    gState.tickEpoch++;
+                    seq_event_post(SEQ_EVENT_PLAYING, 1);
+                    seq_event_post(SEQ_EVENT_STEP, gState.currentStep);
                     tickCounter = 0;
                     trigCounter = TRIGGER_LEN;
                     if (gState.currentStep == 0) {
@@ -328,6 +332,7 @@ public:
             if (!longPressHandled) {
                 // Short press: advance edit cursor, wrapping at sequence length
                 gState.editStep = (gState.editStep + 1) % gState.seqLength;
+                seq_event_post(SEQ_EVENT_EDIT_STEP, gState.editStep);
                 xPickedUp = false;
                 yPickedUp = false;
 
@@ -375,8 +380,11 @@ public:
                     if (d <= PICKUP_THRESH_LENGTH) lengthPickedUp = true;
                 }
             }
-            if (lengthPickedUp) {
+            // Core 1 only hears about real changes, not 48k rewrites of
+            // the same value.
+            if (lengthPickedUp && knobLength != gState.seqLength) {
                 gState.seqLength = static_cast<uint8_t>(knobLength);
+                seq_event_post(SEQ_EVENT_LENGTH, gState.seqLength);
             }
 
             // Y knob → VCO 2 pitch offset relative to VCO 1 (±24 semitones)
@@ -434,8 +442,9 @@ public:
                     if (d <= PICKUP_THRESH) xPickedUp = true;
                 }
             }
-            if (xPickedUp) {
+            if (xPickedUp && knobPitch != gState.pitch[es]) {
                 gState.pitch[es] = static_cast<uint8_t>(knobPitch);
+                seq_event_post(SEQ_EVENT_PITCH, es);
             }
 
             // Y knob → velocity for the current edit step (0–255)
@@ -449,8 +458,9 @@ public:
                     if (d <= PICKUP_THRESH) yPickedUp = true;
                 }
             }
-            if (yPickedUp) {
+            if (yPickedUp && knobVel != gState.velocity[es]) {
                 gState.velocity[es] = static_cast<uint8_t>(knobVel);
+                seq_event_post(SEQ_EVENT_VELOCITY, es);
             }
 
             // Refresh the "last seen" snapshot so we don't false-trigger
@@ -467,7 +477,7 @@ public:
         // ════════════════════════════════════════════
         if (PulseIn2RisingEdge()) {
             gState.currentStep = 0;
-            gState.tickEpoch++;
+            seq_event_post(SEQ_EVENT_STEP, 0);
             tickCounter = 0;
             trigCounter = TRIGGER_LEN;
         }
@@ -505,7 +515,7 @@ public:
 
             if (advance) {
                 gState.currentStep = (gState.currentStep + 1) % gState.seqLength;
-                gState.tickEpoch++;
+                seq_event_post(SEQ_EVENT_STEP, gState.currentStep);
                 trigCounter = TRIGGER_LEN;
                 // Fire end-of-cycle when wrapping from last step back to first
                 if (gState.currentStep == 0) {
@@ -522,16 +532,19 @@ public:
             }
         }
 
-        // Clamp positions if sequence length was shortened. Bump
-        // tickEpoch on a currentStep clamp so Core 1 (browser editor)
-        // sees the position change immediately — otherwise it would
-        // keep highlighting a stale step until the next natural tick,
-        // and indefinitely if playback is paused.
+        // Clamp positions if sequence length was shortened. Post the
+        // currentStep clamp as a step so Core 1 (browser editor) sees
+        // the position change immediately — otherwise it would keep
+        // highlighting a stale step until the next natural tick, and
+        // indefinitely if playback is paused.
         if (gState.currentStep >= gState.seqLength) {
             gState.currentStep = 0;
-            gState.tickEpoch++;
+            seq_event_post(SEQ_EVENT_STEP, 0);
+        }
+        if (gState.editStep >= gState.seqLength) {
+            gState.editStep = 0;
+            seq_event_post(SEQ_EVENT_EDIT_STEP, 0);
         }
-        if (gState.editStep    >= gState.seqLength) gState.editStep    = 0;
 
 
         // ════════════════════════════════════════════
@@ -3,6 +3,7 @@
 
 #include "midi_host.h"
 #include "shared_state.h"
+#include "seq_events.h"
 
 #include "tusb.h"
 #include "host/usbh_pvt.h"
@@ -60,8 +61,8 @@ static uint32_t midi_xorshift(void) {
 // Re-roll all 8 step pitches and velocities. Matches the constructor's
 // boot randomisation in main.cpp: pitches in C2..B4 (the musical sweet
 // spot of the MIDI range) and velocities biased toward the upper half
-// so every step stays audible. Bumps tickEpoch once at the end so a
-// future browser/Grid replug sees the new pattern in one go.
+// so every step stays audible. Marks all eight steps in the Core 1
+// batch so the Grid repaints the new pattern in one go.
 //
 // Single-byte writes are atomic on M0+, so the audio ISR reading a
 // pitch/velocity mid-randomize may see one new value and one old —
@@ -71,36 +72,38 @@ static void randomize_pattern(void) {
     for (int i = 0; i < 8; i++) {
         gState.pitch[i]    = (uint8_t)(36 + (midi_xorshift() % 36));
         gState.velocity[i] = (uint8_t)(100 + (midi_xorshift() % 156));
+        seq_batch_note_local(SEQ_EVENT_PITCH, (uint8_t)i);
+        seq_batch_note_local(SEQ_EVENT_VELOCITY, (uint8_t)i);
     }
 }
 
 static void handle_cc(uint8_t cc, uint8_t v) {
-    bool changed = false;
     if (cc >= 34 && cc <= 41) {
         const uint8_t i = (uint8_t)(cc - 34);
         if (gState.midiHostVelocityMode) {
             gState.velocity[i] = (uint8_t)(v << 1);
+            seq_batch_note_local(SEQ_EVENT_VELOCITY, i);
         } else {
             gState.pitch[i] = v;
+            seq_batch_note_local(SEQ_EVENT_PITCH, i);
         }
-        changed = true;
     } else if (cc >= 50 && cc <= 57) {
         gState.velocity[cc - 50] = (uint8_t)(v << 1);
-        changed = true;
+        seq_batch_note_local(SEQ_EVENT_VELOCITY, (uint8_t)(cc - 50));
     } else if (cc == 28) {
         uint8_t step = (uint8_t)((v * 8u) >> 7);
         if (step > 7) step = 7;
         gState.editStep = step;
-        changed = true;
+        seq_batch_note_local(SEQ_EVENT_EDIT_STEP, step);
     } else if (cc == 22) {
+        // Not shown on the Grid; nothing for Core 1 to redraw.
         if (button_press_edge(&s_btn22_prev, v)) {
             gState.midiHostVelocityMode ^= 1;
-            changed = true;
         }
     } else if (cc == 23) {
         if (button_press_edge(&s_btn23_prev, v)) {
             gState.playing ^= 1;
-            changed = true;
+            seq_batch_note_local(SEQ_EVENT_PLAYING, gState.playing);
         }
     } else if (cc == 24) {
         if (button_press_edge(&s_btn24_prev, v)) {
@@ -110,10 +113,9 @@ static void handle_cc(uint8_t cc, uint8_t v) {
             // ISR's only "reaction" is to display/play step 0, which
             // is exactly what we want.
             gState.currentStep = 0;
-            changed = true;
+            seq_batch_note_local(SEQ_EVENT_STEP, 0);
         }
     }
-    if (changed) gState.tickEpoch++;
 }
 
 // 8mu factory button mappings. The 8mu firmware sends note-on with a
@@ -122,26 +124,25 @@ static void handle_cc(uint8_t cc, uint8_t v) {
 // only — drop anything with velocity 0.
 static void handle_note_on(uint8_t note, uint8_t vel) {
     if (vel == 0) return;
-    bool changed = true;
     switch (note) {
         case 36:  // button 1 — C2
             gState.midiHostVelocityMode ^= 1;
             break;
         case 48:  // button 2 — C3
             gState.playing ^= 1;
+            seq_batch_note_local(SEQ_EVENT_PLAYING, gState.playing);
             break;
         case 60:  // button 3 — C4 (middle C)
             // Mirrors Pulse In 2 reset (and the CC 24 alt mapping).
             gState.currentStep = 0;
+            seq_batch_note_local(SEQ_EVENT_STEP, 0);
             break;
         case 72:  // button 4 — C5
             randomize_pattern();
             break;
         default:
-            changed = false;
             break;
     }
-    if (changed) gState.tickEpoch++;
 }
 
 static void rearm_rx(void) {
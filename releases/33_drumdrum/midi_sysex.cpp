@@ -4,6 +4,7 @@
 
 #include "midi_sysex.h"
 #include "shared_state.h"
+#include "seq_events.h"
 
 #include "tusb.h"
 #include <string.h>
@@ -17,16 +18,15 @@ static uint16_t rx_len     = 0;
 static bool     rx_in_msg  = false;
 
 // ── Outbound state mirror ─────────────────────────────────────
-// We send param updates whenever Core 1's snapshot diverges from gState.
-// This catches changes from any source (panel knobs, future Grid mode,
-// our own SysEx writes) with a single polling loop.
+// What the browser was last told. midi_device_flush() compares the
+// fields its batch flags against this, so a knob swept away and back
+// within one frame sends nothing.
 struct Mirror {
     uint8_t  pitch[8];
     uint8_t  velocity[8];
     uint8_t  seqLength;
     uint8_t  playing;
     uint8_t  currentStep;
-    uint32_t tickEpoch;
     bool     dumped;            // initial dump sent for current connection
     bool     was_mounted;
 };
@@ -124,6 +124,7 @@ static void apply_sysex(const uint8_t *body, uint16_t len)
             uint8_t step  = body[2] & 0x07;
             uint8_t pitch = body[3] & 0x7F;
             gState.pitch[step] = pitch;
+            seq_batch_note_local(SEQ_EVENT_PITCH, step);
         }
         break;
 
@@ -133,6 +134,7 @@ static void apply_sysex(const uint8_t *body, uint16_t len)
             uint8_t hi   = body[3] & 0x0F;
             uint8_t lo   = body[4] & 0x0F;
             gState.velocity[step] = (uint8_t)((hi << 4) | lo);
+            seq_batch_note_local(SEQ_EVENT_VELOCITY, step);
         }
         break;
 
@@ -142,12 +144,14 @@ static void apply_sysex(const uint8_t *body, uint16_t len)
             if (v < 1) v = 1;
             if (v > 8) v = 8;
             gState.seqLength = v;
+            seq_batch_note_local(SEQ_EVENT_LENGTH, v);
         }
         break;
 
     case DRUMDRUM_SYSEX_SET_PLAYING:
         if (len >= 3) {
             gState.playing = body[2] ? 1 : 0;
+            seq_batch_note_local(SEQ_EVENT_PLAYING, gState.playing);
         }
         break;
 
@@ -160,7 +164,6 @@ static void apply_sysex(const uint8_t *body, uint16_t len)
         mirror.seqLength   = gState.seqLength;
         mirror.playing     = gState.playing;
         mirror.currentStep = gState.currentStep;
-        mirror.tickEpoch   = gState.tickEpoch;
         break;
 
     default:
@@ -206,7 +209,6 @@ void midi_device_task(void)
         mirror.seqLength   = gState.seqLength;
         mirror.playing     = gState.playing;
         mirror.currentStep = gState.currentStep;
-        mirror.tickEpoch   = gState.tickEpoch;
         mirror.dumped      = true;
     }
 
@@ -216,18 +218,23 @@ void midi_device_task(void)
         uint32_t n = tud_midi_stream_read(in_buf, sizeof(in_buf));
         for (uint32_t i = 0; i < n; i++) feed_byte(in_buf[i]);
     }
+}
 
-    if (!mounted_now) return;
+void midi_device_flush(const SeqBatch *batch)
+{
+    if (!tud_midi_mounted() || !mirror.dumped) return;
 
-    // 3. Tick notification — fires whenever core 0 advances a step.
-    if (gState.tickEpoch != mirror.tickEpoch) {
-        mirror.tickEpoch   = gState.tickEpoch;
+    // 1. Tick notification — one per frame, carrying the latest step,
+    //    however many steps core 0 advanced since the last flush.
+    if (batch->step) {
         mirror.currentStep = gState.currentStep;
         send_tick(mirror.currentStep);
     }
 
-    // 4. Param diff — pushes panel-knob and switch changes to the browser.
+    // 2. Param updates for what the batch flags and the browser doesn't
+    //    already have — panel knobs, the switch, and our own SysEx echo.
     for (int i = 0; i < 8; i++) {
+        if (!(batch->pitchMask & (1u << i))) continue;
         uint8_t v = gState.pitch[i];
         if (v != mirror.pitch[i]) {
             mirror.pitch[i] = v;
@@ -235,17 +242,18 @@ void midi_device_task(void)
         }
     }
     for (int i = 0; i < 8; i++) {
+        if (!(batch->velocityMask & (1u << i))) continue;
         uint8_t v = gState.velocity[i];
         if (v != mirror.velocity[i]) {
             mirror.velocity[i] = v;
             send_param_velocity((uint8_t)i);
         }
     }
-    if (gState.seqLength != mirror.seqLength) {
+    if (batch->length && gState.seqLength != mirror.seqLength) {
         mirror.seqLength = gState.seqLength;
         send_param_length();
     }
-    if (gState.playing != mirror.playing) {
+    if (batch->playing && gState.playing != mirror.playing) {
         mirror.playing = gState.playing;
         send_param_playing();
     }
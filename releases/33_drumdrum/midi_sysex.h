@@ -33,11 +33,18 @@ extern "C" {
 #define DRUMDRUM_SYSEX_TICK             0x11
 #define DRUMDRUM_SYSEX_PARAM_UPDATE     0x12
 
-// Called from the Core 1 USB loop. Drains incoming MIDI, parses SysEx,
-// applies updates to gState, and sends outbound state messages to the
-// browser when the host is mounted.
+struct SeqBatch;
+
+// Called from the Core 1 USB loop on every wake. Sends the full dump on
+// (re)connection, drains incoming MIDI, parses SysEx and applies updates
+// to gState.
 void midi_device_task(void);
 
+// Called from the Core 1 USB loop at most once per frame with what
+// changed since the last call (seq_events.h). Sends the step tick and
+// param updates to the browser when the host is mounted.
+void midi_device_flush(const struct SeqBatch *batch);
+
 #ifdef __cplusplus
 }
 #endif
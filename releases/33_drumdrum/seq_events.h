@@ -0,0 +1,132 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "hardware/sync.h"
+
+// Core 0 → Core 1 doorbell for sequencer changes.
+//
+// DFAMSequencer::ProcessSample posts a typed event whenever it changes
+// something Core 1 shows or sends (step advance, knob edits, play/pause),
+// then SEVs so a sleeping Core 1 wakes from WFE. Core 1 drains the ring
+// into a SeqBatch, folding repeats, and redraws the Grid / sends MIDI at
+// most once per frame. gState still holds the values; events only say
+// what changed.
+//
+// One producer (core 0) and one consumer (core 1), so the ring needs no
+// lock — the M0+ has no atomic read-modify-write to build one from anyway.
+// If it ever fills, core 0 counts the overflow and core 1 resyncs
+// everything on its next drain.
+
+enum SeqEventType : uint8_t {
+    SEQ_EVENT_STEP,        // arg: new currentStep (advance, reset, clamp)
+    SEQ_EVENT_PITCH,       // arg: step
+    SEQ_EVENT_VELOCITY,    // arg: step
+    SEQ_EVENT_LENGTH,
+    SEQ_EVENT_PLAYING,
+    SEQ_EVENT_EDIT_STEP,
+};
+
+struct SeqEvent {
+    uint8_t type;
+    uint8_t arg;
+};
+
+#define SEQ_EVENT_RING_SIZE 64   // power of two, index fits a uint8_t
+
+struct SeqEventRing {
+    SeqEvent buf[SEQ_EVENT_RING_SIZE];
+    uint8_t  w;            // written by core 0 only
+    uint8_t  r;            // written by core 1 only
+    uint8_t  overflows;    // ++ by core 0 when an event didn't fit
+};
+
+extern volatile SeqEventRing gSeqEvents;
+
+// Core 0 only. Cheap enough for the audio ISR: a store, a barrier, SEV.
+inline bool seq_event_post(SeqEventType type, uint8_t arg)
+{
+    uint8_t w = gSeqEvents.w;
+    uint8_t next = (uint8_t)((w + 1) & (SEQ_EVENT_RING_SIZE - 1));
+    bool queued = next != gSeqEvents.r;
+    if (queued) {
+        gSeqEvents.buf[w].type = type;
+        gSeqEvents.buf[w].arg  = arg;
+        __dmb();
+        gSeqEvents.w = next;
+    } else {
+        gSeqEvents.overflows = (uint8_t)(gSeqEvents.overflows + 1);
+    }
+    __sev();
+    return queued;
+}
+
+inline bool seq_events_pending(void)
+{
+    return gSeqEvents.r != gSeqEvents.w;
+}
+
+// What changed since Core 1 last flushed. Repeats fold: ten pitch edits
+// to one step in a frame are one param update and one redraw.
+struct SeqBatch {
+    uint8_t  pitchMask;
+    uint8_t  velocityMask;
+    bool     step;
+    bool     length;
+    bool     playing;
+    bool     editStep;
+    uint32_t events;       // folded into this batch
+
+    bool any() const { return events != 0; }
+
+    void note(uint8_t type, uint8_t arg)
+    {
+        switch (type) {
+        case SEQ_EVENT_STEP:      step = true;                              break;
+        case SEQ_EVENT_PITCH:     pitchMask    |= (uint8_t)(1u << (arg & 7)); break;
+        case SEQ_EVENT_VELOCITY:  velocityMask |= (uint8_t)(1u << (arg & 7)); break;
+        case SEQ_EVENT_LENGTH:    length = true;                            break;
+        case SEQ_EVENT_PLAYING:   playing = true;                           break;
+        case SEQ_EVENT_EDIT_STEP: editStep = true;                          break;
+        default:                                                            break;
+        }
+        events++;
+    }
+
+    void all()
+    {
+        pitchMask = velocityMask = 0xFF;
+        step = length = playing = editStep = true;
+        events++;
+    }
+};
+
+// Core 1 only: move everything queued so far into `batch`. `seenOverflows`
+// is the consumer's copy of gSeqEvents.overflows; a difference means
+// events were lost, so the whole state is marked changed.
+inline uint32_t seq_events_drain(SeqBatch &batch, uint8_t &seenOverflows)
+{
+    uint32_t n = 0;
+    uint8_t r = gSeqEvents.r;
+    uint8_t w = gSeqEvents.w;
+    __dmb();
+    while (r != w) {
+        batch.note(gSeqEvents.buf[r].type, gSeqEvents.buf[r].arg);
+        r = (uint8_t)((r + 1) & (SEQ_EVENT_RING_SIZE - 1));
+        n++;
+    }
+    __dmb();
+    gSeqEvents.r = r;
+
+    uint8_t overflows = gSeqEvents.overflows;
+    if (overflows != seenOverflows) {
+        seenOverflows = overflows;
+        batch.all();
+    }
+    return n;
+}
+
+// Core 1's own gState writers (Grid keys, SysEx from the browser, the
+// 8mu) report here so their changes join the same batch. Core 1 only;
+// defined in usb_core1.cpp.
+void seq_batch_note_local(SeqEventType type, uint8_t arg);
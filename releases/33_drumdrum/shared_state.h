@@ -15,11 +15,12 @@
 // Direction of writes:
 //   pitch, velocity, seqLength, playing — written by either core
 //   editStep                            — written by either core
-//   currentStep                         — written by core 0 only
-//   tickEpoch                           — incremented by core 0 on every
-//                                         step advance; core 1 polls it
-//                                         to know when to redraw / send
-//                                         a tick notification
+//   currentStep                         — written by core 0, except the
+//                                         Grid/8mu resets to step 0
+//
+// Nothing here is polled for changes. Core 0 posts every write to
+// gSeqEvents (seq_events.h) and SEVs; Core 1's own writers note theirs
+// with seq_batch_note_local(). Core 1 sleeps until one of those arrives.
 struct SharedState {
     uint8_t  pitch[8];      // 0..127  MIDI note number per step
     uint8_t  velocity[8];   // 0..255  CV scaling per step
@@ -28,7 +29,6 @@ struct SharedState {
     uint8_t  currentStep;   // 0..7    playback position
     uint8_t  playing;       // 0/1     playback enable
     uint8_t  midiHostVelocityMode; // 0=8mu faders edit pitch, 1=velocity
-    uint32_t tickEpoch;     // ++ on every step advance (cross-core signal)
 };
 
 // Right-half Grid pitch picker. We have 5 rows × 8 cols = 40 cells to
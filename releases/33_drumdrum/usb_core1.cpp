@@ -13,9 +13,18 @@
 //                (not tuh_init) is required because our tusb_config has
 //                CFG_TUSB_RHPORT0_MODE = HOST | DEVICE — going through
 //                tusb_init configures the USB hardware for the chosen role.
+//
+// Either loop sleeps in WFE between wakes instead of spinning. Core 0
+// SEVs with every event it posts (seq_events.h); a hardware alarm on
+// this core bounds each sleep so the USB stack is still pumped every
+// millisecond. Device-mode USB IRQs land on core 0 (tud_init ran there)
+// and mext's 60 Hz refresh runs off its own clock, so neither wakes us.
+// What changed is folded into one SeqBatch and flushed — Grid redraw or
+// browser MIDI — at most once per frame.
 
 #include "usb_core1.h"
 #include "shared_state.h"
+#include "seq_events.h"
 #include "midi_sysex.h"
 #include "monome_mext.h"
 #include "grid_ui.h"
@@ -24,9 +33,71 @@
 #include "tusb.h"
 #include "bsp/board_api.h"
 #include "pico/multicore.h"
+#include "hardware/sync.h"
+#include "hardware/timer.h"
 
 volatile uint8_t gUsbHostMode = 0;
 
+#define CORE1_FRAME_US  1000   // flush at most once per USB frame
+#define CORE1_IDLE_US   1000   // longest sleep without a USB pump
+
+static SeqBatch s_batch         = {};
+static uint8_t  s_seenOverflows = 0;
+static uint64_t s_nextFlushUs   = 0;
+static uint     s_wakeAlarm     = 0;
+
+void seq_batch_note_local(SeqEventType type, uint8_t arg)
+{
+    s_batch.note(type, arg);
+}
+
+// Taking the alarm IRQ is the wake-up; there's nothing else to do.
+static void wake_alarm_cb(uint alarm)
+{
+    (void)alarm;
+}
+
+static void core1_sleep_init(void)
+{
+    // Claimed from Core 1 so the alarm IRQ is enabled on this core and
+    // can end our WFE. The SDK's default alarm pool lives on core 0.
+    s_wakeAlarm = (uint)hardware_alarm_claim_unused(true);
+    hardware_alarm_set_callback(s_wakeAlarm, wake_alarm_cb);
+}
+
+// Sleep until core 0 posts an event, a USB IRQ lands on this core, or
+// `deadline_us`. An SEV between the pending check and the WFE isn't
+// lost: it sets the event register and the WFE returns at once.
+static void core1_sleep_until(uint64_t deadline_us)
+{
+    if (seq_events_pending()) return;
+    if (hardware_alarm_set_target(s_wakeAlarm, from_us_since_boot(deadline_us))) {
+        return;   // deadline already passed
+    }
+    __wfe();
+    hardware_alarm_cancel(s_wakeAlarm);
+}
+
+// Fold core 0's events into the batch. True when it holds something and
+// the last flush is at least a frame ago.
+static bool core1_batch_due(void)
+{
+    seq_events_drain(s_batch, s_seenOverflows);
+    return s_batch.any() && time_us_64() >= s_nextFlushUs;
+}
+
+static void core1_batch_flushed(void)
+{
+    s_batch = {};
+    s_nextFlushUs = time_us_64() + CORE1_FRAME_US;
+}
+
+static uint64_t core1_next_wake(void)
+{
+    if (s_batch.any()) return s_nextFlushUs;
+    return time_us_64() + CORE1_IDLE_US;
+}
+
 static void run_host_loop(void)
 {
     board_init();
@@ -39,10 +110,24 @@ static void run_host_loop(void)
     midi_host_init();
     tusb_init();
     grid_ui_init();
+    core1_sleep_init();
+    bool gridReady = false;
     while (true) {
         mext_task();
         grid_ui_process_input();
-        grid_ui_render();
+        if (mext_grid_ready() != gridReady) {
+            gridReady = !gridReady;
+            // Paint a newly (re)connected Grid from scratch.
+            if (gridReady) {
+                grid_ui_init();
+                s_batch.all();
+            }
+        }
+        if (core1_batch_due()) {
+            grid_ui_render();
+            core1_batch_flushed();
+        }
+        core1_sleep_until(core1_next_wake());
     }
 }
 
@@ -50,9 +135,15 @@ static void run_device_loop(void)
 {
     // board_init + tud_init were called from Core 0 in main(), so Core 1
     // just pumps the task here.
+    core1_sleep_init();
     while (true) {
         tud_task();
         midi_device_task();
+        if (core1_batch_due()) {
+            midi_device_flush(&s_batch);
+            core1_batch_flushed();
+        }
+        core1_sleep_until(core1_next_wake());
     }
 }
 
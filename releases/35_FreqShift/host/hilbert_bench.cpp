@@ -0,0 +1,282 @@
+// hilbert_bench — the IIR allpass Hilbert pair (iir_hilbert.h) against the 63-tap FIR
+// FreqShift used before, on Linux.
+//
+// Image rejection: a sine through each quadrature pair, I + jQ measured at +f and -f
+// (what's left at -f is the unwanted sideband of an ideal mixer). Covers the FIR and the
+// pair as FreqShift runs it (Q31, 64-bit products) and as OffAir does (12-bit audio,
+// 32-bit products). Then whole upper-sideband shifts, oscillator included (the old 4096
+// point table without interpolation, the new 256 point table with it), and the cost of
+// each per sample.
+//
+//   ./hilbert_bench
+//
+// Host cycles are only relative (x86, not an RP2040) — compare the rows, not the numbers.
+// x86 multiplies 64 bits as cheaply as 32; on the M0+ each 64-bit multiply is an
+// __aeabi_lmul call, so the multiply column is the closer guide to the card.
+#include "../iir_hilbert.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <functional>
+#include <vector>
+
+static constexpr int    FS  = 48000;
+static constexpr double kPi = 3.141592653589793238462643383279502884;
+
+static int32_t sat(int64_t a)
+{
+    if (a >  0x7FFFFFFFLL) return  0x7FFFFFFF;
+    if (a < -0x80000000LL) return static_cast<int32_t>(0x80000000U);
+    return static_cast<int32_t>(a);
+}
+static int32_t mul(int32_t a, int32_t b) { return sat((static_cast<int64_t>(a) * b) >> 31); }
+
+// The FIR quadrature pair and oscillator from FreqShift before the IIR pair
+class OldFir
+{
+    static constexpr int HTAPS = 63, DELAYRB = 64;
+    int32_t h[HTAPS] = {}, firState[HTAPS] = {};
+    int firStatePtr = 0;
+    int32_t delayBuf[DELAYRB] = {};
+    int dWrite = 0, dRead = DELAYRB - (HTAPS - 1) / 2;
+
+public:
+    static constexpr int MULTIPLIES = (HTAPS - 1) / 4;
+
+    OldFir()
+    {
+        const int mid = (HTAPS - 1) / 2;
+        for (int n = 0; n < HTAPS; ++n) {
+            int k = n - mid;
+            double ideal = (k != 0 && (k & 1)) ? (2.0 / (kPi * k)) : 0.0;
+            double w = 0.54 - 0.46 * std::cos(2.0 * kPi * n / (HTAPS - 1));
+            h[n] = static_cast<int32_t>(std::llround(ideal * w * 2147483647.0));
+        }
+        for (int n = 0; n < mid; ++n) {
+            int64_t val = static_cast<int64_t>(h[n]) - static_cast<int64_t>(h[HTAPS - 1 - n]);
+            h[n] = static_cast<int32_t>(val / 2);
+            h[HTAPS - 1 - n] = -h[n];
+        }
+        h[mid] = 0;
+    }
+
+    void process(int32_t x, int32_t& I, int32_t& Q)
+    {
+        firState[firStatePtr] = x;
+        if (++firStatePtr >= HTAPS) firStatePtr = 0;
+        int64_t acc = 0;
+        constexpr int mid = (HTAPS - 1) / 2;
+        for (int n = 0; n < mid; n += 2) {
+            int new_idx = firStatePtr - 1 - n;
+            if (new_idx < 0) new_idx += HTAPS;
+            int old_idx = firStatePtr + n;
+            if (old_idx >= HTAPS) old_idx -= HTAPS;
+            int32_t diff = firState[new_idx] - firState[old_idx];
+            acc += static_cast<int64_t>(h[n]) * static_cast<int64_t>(diff);
+        }
+        Q = sat(acc >> 31);
+        delayBuf[dWrite] = x;
+        if (++dWrite >= DELAYRB) dWrite = 0;
+        I = delayBuf[dRead];
+        if (++dRead >= DELAYRB) dRead = 0;
+    }
+};
+
+class OldNco
+{
+    int32_t sinLUT[4096];
+
+public:
+    uint32_t phase = 0, inc = 0;
+    OldNco()
+    {
+        for (int i = 0; i < 4096; ++i)
+            sinLUT[i] = static_cast<int32_t>(std::llround(std::sin(2.0 * kPi * i / 4096) * 2147483647.0));
+    }
+    void step(int32_t& s, int32_t& c)
+    {
+        phase += inc;
+        uint32_t idx = phase >> 20;
+        s = sinLUT[idx & 4095];
+        c = sinLUT[(idx + 1024) & 4095];
+    }
+};
+
+// Q31 sin/cos from either oscillator (the new one is Q15)
+static void q31(OldNco& n, int32_t& s, int32_t& c) { n.step(s, c); }
+static void q31(SinCosNco& n, int32_t& s, int32_t& c) { n.step(s, c); s <<= 16; c <<= 16; }
+
+static uint32_t hz_to_inc(double hz) { return static_cast<uint32_t>(static_cast<int64_t>(std::llround(hz * 4294967296.0 / FS))); }
+
+// Magnitude of the component at hz (negative = the -hz image), Hann window
+static double component(const std::vector<std::complex<double>>& z, double hz)
+{
+    std::complex<double> acc = 0;
+    size_t n = z.size();
+    for (size_t i = 0; i < n; i++) {
+        double w = 0.5 - 0.5 * std::cos(2 * kPi * i / n);
+        acc += w * z[i] * std::polar(1.0, -2 * kPi * hz * (double)i / FS);
+    }
+    return std::abs(acc);
+}
+
+static double db(double a, double b) { return 20 * std::log10(a / (b > 0 ? b : 1e-300)); }
+
+static constexpr int WARMUP = 9600, N = 48000;
+
+// I + jQ for a sine at hz of amplitude amp; Pair::process(int32_t, int32_t&, int32_t&)
+template <typename Pair>
+static std::vector<std::complex<double>> analytic(Pair& p, double hz, double amp)
+{
+    std::vector<std::complex<double>> z;
+    for (int i = 0; i < WARMUP + N; i++) {
+        int32_t x = static_cast<int32_t>(std::lround(amp * std::sin(2 * kPi * hz * i / FS)));
+        int32_t I, Q;
+        p.process(x, I, Q);
+        if (i >= WARMUP) z.emplace_back(I, Q);
+    }
+    return z;
+}
+
+// Upper-sideband shift of a sine (as FreqShift's AudioOut2): wanted / unwanted sideband
+template <typename Pair, typename Nco>
+static double usb_suppression(double hz, double shiftHz)
+{
+    Pair p;
+    Nco nco;
+    nco.inc = hz_to_inc(shiftHz);
+    std::vector<std::complex<double>> y;
+    for (int i = 0; i < WARMUP + N; i++) {
+        int32_t x = static_cast<int32_t>(std::lround(2047.0 * (1 << 19) * std::sin(2 * kPi * hz * i / FS)));
+        int32_t I, Q, s, c;
+        p.process(x, I, Q);
+        q31(nco, s, c);
+        int32_t high = sat(static_cast<int64_t>(mul(I, c)) - mul(Q, s));
+        if (i >= WARMUP) y.emplace_back(high, 0);
+    }
+    return db(component(y, hz + shiftHz), component(y, hz - shiftHz));
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+static uint64_t ticks() { return __rdtsc(); }
+#define TICKS "TSC cycles"
+#else
+static uint64_t ticks()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+#define TICKS "ns"
+#endif
+
+// Best of PASSES runs of 100000 samples each, every candidate taking its turn in each
+// round so that all of them see the same machine load
+template <size_t K, typename F>
+static void per_sample(F (&f)[K], double (&best)[K])
+{
+    constexpr int PASSES = 31, n = 100000;
+    for (auto& b : best) b = 1e30;
+    for (int p = 0; p < PASSES; p++)
+        for (size_t k = 0; k < K; k++) {
+            uint64_t t0 = ticks();
+            f[k](n);
+            best[k] = std::min(best[k], (double)(ticks() - t0) / n);
+        }
+}
+
+int main()
+{
+    static const double freqs[] = { 20, 30, 50, 100, 200, 500, 1000, 2000, 5000, 10000, 15000, 20000, 23000 };
+    const double q31amp = 2047.0 * (1 << 19);   // FreqShift's full-scale input
+    int failures = 0;
+
+    printf("Image rejection of I + jQ, dB (wanted at +f / image at -f)\n");
+    printf("     f Hz   FIR 63 taps   IIR Q31   IIR 12-bit\n");
+    double iirWorst = 1e9;
+    for (double f : freqs) {
+        OldFir fir;
+        IirHilbert<30> iir;
+        IirHilbert<14> iir12;
+        auto zf = analytic(fir, f, q31amp), zi = analytic(iir, f, q31amp), z12 = analytic(iir12, f, 2047.0);
+        double rf = db(component(zf, f), component(zf, -f));
+        double ri = db(component(zi, f), component(zi, -f));
+        double r12 = db(component(z12, f), component(z12, -f));
+        if (ri < 0 || r12 < 0) failures++;   // Q leads I the wrong way: sidebands swapped
+        if (f >= 20 && f <= 20000) iirWorst = std::min(iirWorst, ri);
+        printf("%9.0f %13.1f %9.1f %12.1f\n", f, rf, ri, r12);
+    }
+
+    printf("\nUpper sideband out, oscillator included, dB (wanted / unwanted)\n");
+    printf("     f Hz  shift Hz   old: FIR + 4096 table   new: IIR + interpolated 256\n");
+    const double shifts[][2] = { { 100, 50 }, { 300, 100 }, { 1000, 440 }, { 5000, 1000 }, { 10000, 7000 } };
+    for (auto& fs : shifts) {
+        double o = usb_suppression<OldFir, OldNco>(fs[0], fs[1]);
+        double n = usb_suppression<IirHilbert<30>, SinCosNco>(fs[0], fs[1]);
+        printf("%9.0f %9.0f %23.1f %29.1f\n", fs[0], fs[1], o, n);
+    }
+
+    // Oscillators against an exact sine: worst error, in dB below full scale
+    printf("\nOscillator error at 437 Hz, dB below full scale: ");
+    {
+        OldNco o; SinCosNco n;
+        o.inc = n.inc = hz_to_inc(437);
+        double eo = 0, en = 0;
+        for (int i = 0; i < FS; i++) {
+            int32_t s, c;
+            double phase = 2 * kPi * (double)(uint32_t)((uint64_t)o.inc * (i + 1)) / 4294967296.0;
+            q31(o, s, c);
+            eo = std::max(eo, std::fabs(s / 2147483648.0 - std::sin(phase)));
+            q31(n, s, c);
+            en = std::max(en, std::fabs(s / 2147483648.0 - std::sin(phase)));
+        }
+        printf("old %.1f, new %.1f\n", db(1, eo), db(1, en));
+    }
+
+    // Cost per sample: quadrature pair + oscillator + mix, as in ProcessSample()
+    volatile int32_t sink = 0;
+    auto shifter = [&](auto& pair, auto& nco, int n) {
+        int64_t acc = 0;
+        uint32_t lcg = 1;
+        nco.inc = hz_to_inc(440);
+        for (int i = 0; i < n; i++) {
+            lcg = lcg * 1664525u + 1013904223u;
+            int32_t x = static_cast<int32_t>(lcg) >> 2, I, Q, s, c;
+            pair.process(x, I, Q);
+            q31(nco, s, c);
+            acc += sat(static_cast<int64_t>(mul(I, c)) - mul(Q, s));
+        }
+        sink = static_cast<int32_t>(acc);
+    };
+    OldFir fir; OldNco onco;
+    IirHilbert<30> iir; SinCosNco nnco;
+    IirHilbert<14> iir12;
+    std::function<void(int)> runs[] = {
+        [&](int n) { shifter(fir, onco, n); },
+        [&](int n) { shifter(iir, nnco, n); },
+        [&](int n) {
+            int64_t acc = 0;
+            uint32_t lcg = 1, ph = 0;
+            for (int i = 0; i < n; i++) {
+                lcg = lcg * 1664525u + 1013904223u;
+                int32_t x = static_cast<int32_t>(lcg) >> 20, I, Q;
+                iir12.process(x, I, Q);
+                ph += 39370534u;
+                acc += (I * sinQ15(ph + 0x40000000u) - Q * sinQ15(ph)) >> 15;
+            }
+            sink = static_cast<int32_t>(acc);
+        },
+    };
+    double t[3];
+    per_sample(runs, t);
+    (void)sink;
+    printf("\nCost per sample (pair + oscillator + mix)  %10s    multiplies in the pair\n", TICKS);
+    printf("old: FIR 63 taps, Q31                  %10.1f    %d (64-bit)\n", t[0], OldFir::MULTIPLIES);
+    printf("new: IIR 2x6 sections, Q31             %10.1f    12 (64-bit)\n", t[1]);
+    printf("new: IIR 2x6 sections, 12-bit (OffAir) %10.1f    12 (32-bit)\n", t[2]);
+    printf("\nIIR image rejection 20 Hz..20 kHz: worst %.1f dB | %s\n", iirWorst, failures ? "FAIL" : "ok");
+    return failures ? 1 : 0;
+}
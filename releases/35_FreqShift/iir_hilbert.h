@@ -0,0 +1,123 @@
+// iir_hilbert.h — quadrature pair and sin/cos oscillator for single-sideband shifting
+//
+// IirHilbert turns one signal into two, I and Q, 90 degrees apart: two chains of six
+// first-order allpass sections in z^-2 (polyphase IIR), the Q chain one sample later.
+// The coefficients are the elliptic half-band design (as in Laurent de Soras' HIIR) for
+// 12 coefficients and a transition band of 0.00082 fs, which makes the phase error
+// equiripple from 20 Hz to 23.5 kHz at 48 kHz: within 0.05 degrees of quadrature, 66 dB
+// of image rejection (61 at 14 bits). One multiply per section: 12 a sample. The 63-tap
+// FIR it replaces in FreqShift took 15, so the pair costs about as much (0.75x the FIR
+// on host/hilbert_bench), but the FIR was no better than 90 degrees +-6 below 200 Hz.
+// Four sections a chain (Olli Niemitalo's design) would take 8 but only hold 0.7
+// degrees, 44 dB.
+//
+// SinCosNco is a 32-bit phase accumulator with a 256-point Q15 sine table read with
+// linear interpolation: worst error 77 dB below full scale (FreqShift's old 4096-point
+// table without interpolation: 56).
+//
+// Shifting a signal up by the NCO frequency: I*cos - Q*sin; down: I*cos + Q*sin.
+//
+// FreqShift (releases/35_FreqShift) and OffAir (releases/95_offair2) each carry a copy
+// of this file; keep the two the same.
+
+#pragma once
+#include <stdint.h>
+
+// SHIFT is the coefficients' fraction bits, which sets the sample range:
+//   IirHilbert<30>: 64-bit products, samples anywhere in int32 (Q31 audio paths)
+//   IirHilbert<14>: 32-bit products, samples within about ±2^16 (12-bit audio)
+template <int SHIFT>
+class IirHilbert
+{
+public:
+    // One input sample in; i and q out (q lags i by 90 degrees).
+    void process(int32_t x, int32_t& i, int32_t& q)
+    {
+        i = chain(kCoefB, x, b);
+        q = aDelay;
+        aDelay = chain(kCoefA, x, a);
+    }
+
+    void reset() { *this = IirHilbert(); }
+
+private:
+    static constexpr int kSections = 6;
+    struct Chain {
+        int32_t x1[kSections] = {}, x2[kSections] = {}, y1[kSections] = {}, y2[kSections] = {};
+    };
+
+    // The design's 12 coefficients in ascending order go alternately to B and A
+    static constexpr int32_t coef(double c) { return (int32_t)(c * (double)(1LL << SHIFT) + 0.5); }
+    static constexpr int32_t kCoefA[kSections] = {
+        coef(0.279130907073), coef(0.682408024594), coef(0.889089178277),
+        coef(0.964538224228), coef(0.989449460276), coef(0.998464918864) };
+    static constexpr int32_t kCoefB[kSections] = {
+        coef(0.081642059655), coef(0.500258349451), coef(0.809111650804),
+        coef(0.936857271351), coef(0.980365211733), coef(0.994858394046) };
+
+    // y = a^2 * (x + y[n-2]) - x[n-2], per section
+    static int32_t chain(const int32_t* c, int32_t x, Chain& s)
+    {
+        for (int k = 0; k < kSections; k++) {
+            int32_t y;
+            if constexpr (SHIFT > 15) {
+                int64_t v = (((int64_t)c[k] * ((int64_t)x + s.y2[k])) >> SHIFT) - s.x2[k];
+                y = v > INT32_MAX ? INT32_MAX : (v < INT32_MIN ? INT32_MIN : (int32_t)v);
+            } else {
+                y = ((c[k] * (x + s.y2[k])) >> SHIFT) - s.x2[k];
+            }
+            s.x2[k] = s.x1[k]; s.x1[k] = x;
+            s.y2[k] = s.y1[k]; s.y1[k] = y;
+            x = y;
+        }
+        return x;
+    }
+
+    Chain   a, b;
+    int32_t aDelay = 0;
+};
+
+// sin(2*pi*i/256), Q15, with the first point repeated at the end for interpolation
+static const int16_t kSinQ15[257] = {
+         0,    804,   1608,   2410,   3212,   4011,   4808,   5602,   6393,   7179,   7962,   8739,   9512,  10278,  11039,  11793,
+     12539,  13279,  14010,  14732,  15446,  16151,  16846,  17530,  18204,  18868,  19519,  20159,  20787,  21403,  22005,  22594,
+     23170,  23731,  24279,  24811,  25329,  25832,  26319,  26790,  27245,  27683,  28105,  28510,  28898,  29268,  29621,  29956,
+     30273,  30571,  30852,  31113,  31356,  31580,  31785,  31971,  32137,  32285,  32412,  32521,  32609,  32678,  32728,  32757,
+     32767,  32757,  32728,  32678,  32609,  32521,  32412,  32285,  32137,  31971,  31785,  31580,  31356,  31113,  30852,  30571,
+     30273,  29956,  29621,  29268,  28898,  28510,  28105,  27683,  27245,  26790,  26319,  25832,  25329,  24811,  24279,  23731,
+     23170,  22594,  22005,  21403,  20787,  20159,  19519,  18868,  18204,  17530,  16846,  16151,  15446,  14732,  14010,  13279,
+     12539,  11793,  11039,  10278,   9512,   8739,   7962,   7179,   6393,   5602,   4808,   4011,   3212,   2410,   1608,    804,
+         0,   -804,  -1608,  -2410,  -3212,  -4011,  -4808,  -5602,  -6393,  -7179,  -7962,  -8739,  -9512, -10278, -11039, -11793,
+    -12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530, -18204, -18868, -19519, -20159, -20787, -21403, -22005, -22594,
+    -23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790, -27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956,
+    -30273, -30571, -30852, -31113, -31356, -31580, -31785, -31971, -32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757,
+    -32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285, -32137, -31971, -31785, -31580, -31356, -31113, -30852, -30571,
+    -30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683, -27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731,
+    -23170, -22594, -22005, -21403, -20787, -20159, -19519, -18868, -18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279,
+    -12539, -11793, -11039, -10278,  -9512,  -8739,  -7962,  -7179,  -6393,  -5602,  -4808,  -4011,  -3212,  -2410,  -1608,   -804,
+         0,
+};
+
+// Q15 sine of a 32-bit phase (2^32 = one cycle)
+static inline int32_t sinQ15(uint32_t phase)
+{
+    uint32_t i = phase >> 24;
+    int32_t frac = (int32_t)((phase >> 9) & 0x7FFF);
+    int32_t s0 = kSinQ15[i];
+    return s0 + (((kSinQ15[i + 1] - s0) * frac) >> 15);
+}
+
+class SinCosNco
+{
+public:
+    uint32_t phase = 0;
+    uint32_t inc   = 0;   // 2^32 * f / fs; negative frequencies wrap (two's complement)
+
+    // Advance one sample, then s = sin, c = cos of the new phase (Q15)
+    void step(int32_t& s, int32_t& c)
+    {
+        phase += inc;
+        s = sinQ15(phase);
+        c = sinQ15(phase + 0x40000000u);
+    }
+};
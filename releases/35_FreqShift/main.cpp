@@ -31,20 +31,12 @@
 #include <cstdint>
 #include "hardware/clocks.h"
 #include "hardware/vreg.h"
+#include "iir_hilbert.h"
 
 class FreqShifter : public ComputerCard {
 public:
     static constexpr int FS = 48000;
 
-    // Hilbert FIR tap count.  Must be odd with an odd centre index
-    // (i.e. HTAPS = 4k+3).  Increasing improves sideband rejection.
-    static constexpr int HTAPS = 63;
-
-    // Delay ring-buffer for I-path alignment; must be >= (HTAPS-1)/2.
-    static constexpr int DELAYRB = 64;
-
-    static constexpr int      SIN_LUT_N    = 4096;
-    static constexpr int      SIN_LUT_BITS = 12;
     static constexpr int      FREQ_LUT_N   = 2048;
     static constexpr uint32_t PHASE_BITS   = 32;
 
@@ -54,19 +46,16 @@ public:
     static constexpr int16_t  AUDIO_MAX       = 2047;
     static constexpr int16_t  AUDIO_MIN       = -2048;
 
-    static constexpr double   kPi                = 3.141592653589793238462643383279502884;
     static constexpr int32_t WIDE_MIN_SHIFT_HZ   = 2;
     static constexpr int32_t WIDE_MAX_SHIFT_HZ   = 7000;
     static constexpr int32_t NARROW_MAX_SHIFT_HZ = 440;
 
     void Init() {
-        buildHilbert();
-        buildSinLUT();
         buildFreqLUT();
         EnableNormalisationProbe();
 
-        phase          = 0;
-        phaseIncSigned = 0;
+        nco.phase = 0;
+        nco.inc   = 0;
 
         CVOut1(-2048);  // static -5V
         CVOut2(2047);   // static +5V
@@ -88,20 +77,8 @@ public:
         int32_t x = sat(static_cast<int64_t>(inMix) + static_cast<int64_t>(fbApplied));
         inputLevel = smoothLevel(inputLevel, abs32(x));
 
-        // I path: delayed to align with the FIR group delay.
-        int32_t I = delay(x);
-        int32_t Q = hilbert(x);
-
-        // Advance oscillator and look up sin/cos.
-        phase += phaseIncSigned;
-        int32_t sn, cs;
-        sincos(phase, sn, cs);
-
-        // Single-sideband mixing.
-        int32_t yI     = mul(I, cs);
-        int32_t yQ     = mul(Q, sn);
-        lowSideband  = sat(static_cast<int64_t>(yI) + static_cast<int64_t>(yQ));
-        highSideband = sat(static_cast<int64_t>(yI) - static_cast<int64_t>(yQ));
+        // Quadrature pair, oscillator and single-sideband mixing.
+        shift(x, lowSideband, highSideband);
 
         int32_t absLow  = abs32(lowSideband);
         int32_t absHigh = abs32(highSideband);
@@ -112,23 +89,12 @@ public:
     }
 
 private:
-    // Hilbert FIR
-    int32_t h[HTAPS]        = {};
-    int32_t firState[HTAPS] = {};
-    int     firStatePtr     = 0;
-
-    // I-path alignment delay
-    int32_t delayBuf[DELAYRB] = {};
-    int     dWrite = 0;
-    int     dRead  = DELAYRB - (HTAPS - 1) / 2;  // pre-offset by group delay
-
-    // Oscillator (phaseIncSigned is uint32_t but treated as two's-complement
-    // so negative frequencies correctly decrement the accumulator)
-    uint32_t phase          = 0;
-    uint32_t phaseIncSigned = 0;
+    // Quadrature pair and oscillator (nco.inc is two's-complement, so negative
+    // frequencies decrement the phase)
+    IirHilbert<30> hilbert;
+    SinCosNco      nco;
 
     // Lookup tables
-    int32_t  sinLUT[SIN_LUT_N]          = {};
     uint32_t freqLUT[FREQ_LUT_N] = {};
 
     // Signal state
@@ -207,49 +173,18 @@ private:
     }
 
     // -----------------------------------------------------------------------
-    // Hilbert FIR
-    //
-    // Exploits two properties of the antisymmetric Hilbert filter:
-    //   h[n] = -h[N-1-n]  → one multiply per symmetric pair
-    //   h[n] = 0 for even (n-mid)  → half of all pairs are zero
-    // This yields (HTAPS-1)/4 multiplies per sample.
-    //
-    // static_assert enforces that mid=(HTAPS-1)/2 is odd, placing non-zero
-    // coefficients on even-indexed taps. If mid is even, change loop start
-    // from 0 to 1.
-    // -----------------------------------------------------------------------
-    int32_t hilbert(int32_t x) {
-        firState[firStatePtr] = x;
-        if (++firStatePtr >= HTAPS) firStatePtr = 0;
-
-        int64_t acc = 0;
-        constexpr int mid = (HTAPS - 1) / 2;
-
-        static_assert(((HTAPS - 1) / 2) % 2 == 1,
-            "HTAPS gives even mid; change loop start from 0 to 1");
-
-        for (int n = 0; n < mid; n += 2) {
-            int new_idx = firStatePtr - 1 - n;
-            if (new_idx < 0) new_idx += HTAPS;
-            int old_idx = firStatePtr + n;
-            if (old_idx >= HTAPS) old_idx -= HTAPS;
-            // Keep operands as int32_t so the compiler uses smull (32×32→64)
-            // rather than a slow software 64×64 multiply.
-            int32_t diff = firState[new_idx] - firState[old_idx];
-            acc += static_cast<int64_t>(h[n]) * static_cast<int64_t>(diff);
-        }
-        return sat(acc >> 31);
-    }
-
-    // -----------------------------------------------------------------------
-    // I-path alignment delay
+    // Single-sideband shift: quadrature pair (iir_hilbert.h), mixed with the
+    // oscillator. Q15 sin/cos << 16 = Q31.
     // -----------------------------------------------------------------------
-    int32_t delay(int32_t x) {
-        delayBuf[dWrite] = x;
-        if (++dWrite >= DELAYRB) dWrite = 0;
-        int32_t y = delayBuf[dRead];
-        if (++dRead >= DELAYRB) dRead = 0;
-        return y;
+    void shift(int32_t x, int32_t& low, int32_t& high) {
+        int32_t I, Q, sn, cs;
+        hilbert.process(x, I, Q);
+        nco.step(sn, cs);
+
+        int32_t yI = mul(I, cs << 16);
+        int32_t yQ = mul(Q, sn << 16);
+        low  = sat(static_cast<int64_t>(yI) + static_cast<int64_t>(yQ));
+        high = sat(static_cast<int64_t>(yI) - static_cast<int64_t>(yQ));
     }
 
     // -----------------------------------------------------------------------
@@ -276,7 +211,7 @@ private:
             currentShiftHz   = (centered * NARROW_MAX_SHIFT_HZ) / 2048;
         }
 
-        phaseIncSigned = hzToPhaseInc(currentShiftHz);
+        nco.inc = hzToPhaseInc(currentShiftHz);
         updateLeds();
 
         int32_t xQ12    = clamp12(KnobVal(Knob::X));
@@ -321,14 +256,6 @@ private:
         return static_cast<uint32_t>(n / FS);
     }
 
-    void sincos(uint32_t ph, int32_t& s, int32_t& c) const {
-        constexpr uint32_t LUT_MASK = SIN_LUT_N - 1;
-        uint32_t idx   = ph >> (PHASE_BITS - SIN_LUT_BITS);
-        uint32_t idx90 = (idx + SIN_LUT_N / 4) & LUT_MASK;
-        s = sinLUT[idx & LUT_MASK];
-        c = sinLUT[idx90];
-    }
-
     // -----------------------------------------------------------------------
     // LED display
     // -----------------------------------------------------------------------
@@ -356,35 +283,6 @@ private:
     // -----------------------------------------------------------------------
     // Initialisation 
     // -----------------------------------------------------------------------
-    void buildHilbert() {
-        const int mid = (HTAPS - 1) / 2;
-
-        for (int n = 0; n < HTAPS; ++n) {
-            int    k     = n - mid;
-            double ideal = (k != 0 && (k & 1)) ? (2.0 / (kPi * k)) : 0.0;
-            double w     = 0.54 - 0.46 * std::cos(2.0 * kPi * n / (HTAPS - 1));
-            double scaled = ideal * w * 2147483647.0;
-            if (scaled >  2147483647.0) scaled =  2147483647.0;
-            if (scaled < -2147483648.0) scaled = -2147483648.0;
-            h[n] = static_cast<int32_t>(std::llround(scaled));
-        }
-
-        // Enforce exact antisymmetry after quantisation.
-        for (int n = 0; n < mid; ++n) {
-            int64_t val  = static_cast<int64_t>(h[n]) - static_cast<int64_t>(h[HTAPS - 1 - n]);
-            h[n]         = static_cast<int32_t>(val / 2);
-            h[HTAPS-1-n] = static_cast<int32_t>(-h[n]);
-        }
-        h[mid] = 0;
-    }
-
-    void buildSinLUT() {
-        for (int i = 0; i < SIN_LUT_N; ++i) {
-            double angle = 2.0 * kPi * i / SIN_LUT_N;
-            sinLUT[i] = static_cast<int32_t>(std::llround(std::sin(angle) * 2147483647.0));
-        }
-    }
-
     void buildFreqLUT() {
         const double minHz = static_cast<double>(WIDE_MIN_SHIFT_HZ);
         const double maxHz = static_cast<double>(WIDE_MAX_SHIFT_HZ);
@@ -0,0 +1,10 @@
+// host_shim.h — lets src/oscillator.h compile on Linux (-DTRACE_HOST, see host/Makefile).
+//
+// The oscillators only need __not_in_flash_func() from the SDK; the card itself
+// (ComputerCard, main.cpp) is not built on the host.
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+
+#define __not_in_flash_func(f) f
@@ -0,0 +1,213 @@
+// trace_bench — per-shape cost of Trace's oscillators on Linux, and what control-rate
+// transform caching costs in accuracy.
+//
+// Every oscillator in src/oscillator.h runs for a few seconds of 48 kHz samples with the
+// rotation turning and audio-rate modulation on both inputs, once at 1x (compute() per
+// sample) and once 2x oversampled (two compute() calls + HalfbandDecimator, as main.cpp
+// does with TRACE_OVERSAMPLE 2). The mesh shapes are also run through a per-sample
+// reference (two sine() calls, rotation and projection on every sample, as the
+// oscillators used to) to time the old way and to measure how far the cached transform
+// strays from it.
+//
+//   ./trace_bench                 table: ns per output sample, 1x / 2x / per-sample
+//   ./trace_bench -n 960000       longer runs
+//   ./trace_bench -p out -f 1500  also write out/<shape>_1x.pgm / _2x.pgm XY plots at 1.5 kHz
+//
+// Host ns are only relative (x86, not an RP2040) — compare the columns, not the numbers.
+#include "../src/oscillator.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+// The mesh oscillator before control-rate caching: same paths and segment search, the
+// rotation and projection done in full on every call.
+class PerSampleMesh : public Oscillator
+{
+    const MeshPath &mesh;
+    uint32_t seg_index = 0;
+
+public:
+    explicit PerSampleMesh(const MeshPath &mp) : mesh(mp) {}
+
+    void compute(uint32_t ph, int32_t mod_grow, int32_t mod_rot, int32_t *out) override
+    {
+        uint32_t grow = (uint32_t)(mod_grow < 0 ? 0 : (mod_grow > 4096 ? 4096 : mod_grow)) << 20;
+        ph = (uint32_t)(((uint64_t)ph * grow) >> 32);
+        ph_rot += (uint32_t)(mod_rot - 2048) << (10 - oversample_shift);
+
+        const PathSegment *seg = mesh.segments;
+        uint32_t i = seg_index;
+        if (ph < seg[i].start)
+            i = 0;
+        while (i + 1 < mesh.count && seg[i + 1].start <= ph)
+            i++;
+        seg_index = i;
+        int32_t frac = (int32_t)((((ph - seg[i].start) >> 12) * seg[i].rcp) >> 16);
+
+        Point3D p1 = mesh.points[i], p2 = mesh.points[i + 1];
+        int32_t x = p1.x + (((p2.x - p1.x) * frac) >> 16);
+        int32_t y = p1.y + (((p2.y - p1.y) * frac) >> 16);
+        int32_t z = p1.z + (((p2.z - p1.z) * frac) >> 16);
+
+        int32_t s = sine(ph_rot);
+        int32_t c = sine(ph_rot - 0x40000000);
+        int32_t rx = (x * c - z * s) >> 11;
+        int32_t ry = y;
+        int32_t rz = (x * s + z * c) >> 11;
+        out[0] = rx >> 1;
+        out[1] = ((rz >> 1) + ((ry * 3547) >> 12)) >> 1;
+    }
+};
+
+struct Shape {
+    const char *name;
+    Oscillator *(*make)();
+    const MeshPath *mesh;   // per-sample reference, mesh shapes only
+};
+
+template <typename T> static Oscillator *make() { return new T; }
+
+static const Shape SHAPES[] = {
+    {"yinyang",     make<YinYang>,            nullptr},
+    {"cube",        make<PolyCube>,           &CUBE_PATH},
+    {"cone",        make<PolyCone>,           &CONE_PATH},
+    {"icosphere",   make<PolyICO>,            &ICOSPHERE_PATH},
+    {"calligraphy", make<YinYangCalligraphy>, nullptr},
+    {"ribbon",      make<RibbonWC>,           nullptr},
+    {"outline",     make<OutlineWC>,          nullptr},
+};
+#define NUM_SHAPES ((int)(sizeof(SHAPES) / sizeof(SHAPES[0])))
+
+// Inputs per sample: growth full, rotation turning, a little audio-rate wobble on both
+// (as Audio In 1/2 would add), pitch fixed.
+struct Drive {
+    uint32_t phase = 0, inc;
+    uint32_t n = 0;
+    explicit Drive(double hz) : inc((uint32_t)(hz / 48000.0 * 4294967296.0)) {}
+    void mods(int32_t &m1, int32_t &m2) {
+        int32_t w = (int32_t)((n * 2654435761u) >> 26) - 32;   // ±32 hash noise
+        m1 = 4000 + w;
+        m2 = 2300 + w;
+        n++;
+    }
+};
+
+// Run `samples` output samples; `sink(out)` sees each one. Returns ns per output sample.
+template <typename F>
+static double run(Oscillator &o, int os, double hz, int samples, F sink) {
+    using clock = std::chrono::steady_clock;
+    o.SetOversample(os == 2 ? 1 : 0);
+    HalfbandDecimator dec;
+    Drive d(hz);
+    auto t0 = clock::now();
+    for (int i = 0; i < samples; i++) {
+        int32_t m1, m2, out[2];
+        d.mods(m1, m2);
+        if (os == 2) {
+            int32_t half[2], full[2];
+            o.compute(d.phase + (d.inc >> 1), m1, m2, half);
+            d.phase += d.inc;
+            o.compute(d.phase, m1, m2, full);
+            dec.process(half, full, out);
+        } else {
+            d.phase += d.inc;
+            o.compute(d.phase, m1, m2, out);
+        }
+        sink(out);
+    }
+    auto t1 = clock::now();
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / samples;
+}
+
+static void write_xy(const char *dir, const char *name, const char *tag,
+                     const std::vector<int32_t> &xy) {
+    const int W = 256;
+    std::vector<int> hits(W * W, 0);
+    for (size_t i = 0; i + 1 < xy.size(); i += 2) {
+        int x = W / 2 + xy[i] / 16, y = W / 2 - xy[i + 1] / 16;
+        if (x >= 0 && x < W && y >= 0 && y < W) hits[y * W + x]++;
+    }
+    char path[512];
+    snprintf(path, sizeof path, "%s/%s_%s.pgm", dir, name, tag);
+    FILE *f = fopen(path, "wb");
+    if (!f) { perror(path); return; }
+    fprintf(f, "P5\n%d %d\n255\n", W, W);
+    for (int h : hits) fputc(std::min(255, h * 8), f);
+    fclose(f);
+}
+
+int main(int argc, char **argv) {
+    int samples = 480000;
+    double hz = 110.0;
+    const char *pgm_dir = nullptr;
+    for (int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        if (a == "-n" && i + 1 < argc) samples = atoi(argv[++i]);
+        else if (a == "-f" && i + 1 < argc) hz = atof(argv[++i]);
+        else if (a == "-p" && i + 1 < argc) pgm_dir = argv[++i];
+        else { fprintf(stderr, "usage: %s [-n samples] [-f hz] [-p pgm_dir]\n", argv[0]); return 2; }
+    }
+    if (samples < 1) samples = 1;
+
+    printf("%d samples at %.0f Hz, control tick %u calls\n", samples, hz,
+           (unsigned)Oscillator::CONTROL_TICK);
+    printf("%-12s %9s %9s %11s | %9s\n", "shape", "1x ns", "2x ns", "per-sample", "max err");
+    volatile int32_t keep = 0;
+    int failures = 0;
+    for (int s = 0; s < NUM_SHAPES; s++) {
+        const Shape &sh = SHAPES[s];
+        std::vector<int32_t> xy1, xy2;
+        bool dump = pgm_dir != nullptr;
+
+        Oscillator *o1 = sh.make();
+        double ns1 = run(*o1, 1, hz, samples, [&](const int32_t *out) {
+            keep = keep + out[0];
+            if (dump) { xy1.push_back(out[0]); xy1.push_back(out[1]); }
+        });
+        delete o1;
+        Oscillator *o2 = sh.make();
+        double ns2 = run(*o2, 2, hz, samples, [&](const int32_t *out) {
+            keep = keep + out[0];
+            if (dump) { xy2.push_back(out[0]); xy2.push_back(out[1]); }
+        });
+        delete o2;
+
+        if (!sh.mesh) {
+            printf("%-12s %9.1f %9.1f %11s | %9s\n", sh.name, ns1, ns2, "-", "-");
+        } else {
+            // Per-sample reference, timed alone, then in lockstep with the cached path.
+            PerSampleMesh ref(*sh.mesh);
+            double nsr = run(ref, 1, hz, samples, [&](const int32_t *out) { keep = keep + out[0]; });
+            PerSampleMesh r2(*sh.mesh);
+            Oscillator *o = sh.make();
+            o->SetOversample(0);
+            Drive d(hz);
+            int err = 0;
+            for (int i = 0; i < samples; i++) {
+                int32_t m1, m2, a[2], b[2];
+                d.mods(m1, m2);
+                d.phase += d.inc;
+                o->compute(d.phase, m1, m2, a);
+                r2.compute(d.phase, m1, m2, b);
+                err = std::max(err, std::max(std::abs(a[0] - b[0]), std::abs(a[1] - b[1])));
+            }
+            delete o;
+            // The cached rotation lags by < CONTROL_TICK samples; anything beyond a few
+            // LSB (output is ±2047) means the transform itself is wrong.
+            bool ok = err <= 16;
+            if (!ok) failures++;
+            printf("%-12s %9.1f %9.1f %11.1f | %9d%s\n", sh.name, ns1, ns2, nsr, err,
+                   ok ? "" : "  FAIL");
+        }
+        if (dump) {
+            write_xy(pgm_dir, sh.name, "1x", xy1);
+            write_xy(pgm_dir, sh.name, "2x", xy2);
+        }
+    }
+    return failures ? 1 : 0;
+}
@@ -3,6 +3,12 @@
 #include "oscillator.h"
 #include "lookup_tables.h"
 
+// Oscillator evaluations per output sample: 2 = 2x oversampled (half-band decimated back
+// to 48 kHz) for cleaner XY traces at high pitches, 1 = one per sample
+#ifndef TRACE_OVERSAMPLE
+#define TRACE_OVERSAMPLE 2
+#endif
+
 class WT : public ComputerCard
 {
   uint32_t phase;
@@ -15,6 +21,8 @@ class WT : public ComputerCard
   // One-pole lowpass coefficient for ~21kHz cutoff at 48kHz sample rate
   static constexpr int32_t FILTER_COEF = 57344; // 0.875 * 65536
 
+  HalfbandDecimator decimator;
+
   YinYang yinyang;
   PolyCube polycube;
   PolyCone polycone;
@@ -59,6 +67,9 @@ public:
   {
     phase = 0;
     currentOsc = bankFunc[0];
+    for (int b = 0; b < 3; b++)
+      for (int i = 0; i < bankSizes[b]; i++)
+        banks[b][i]->SetOversample(TRACE_OVERSAMPLE == 2 ? 1 : 0);
   }
 
   void CycleOscillator()
@@ -150,13 +161,22 @@ public:
 
     // oscillator phase increment
     int32_t freq = KnobVal(Main) + CVIn1();
-    phase += FREQ_INC_LUT_EXP[freq > 4095 ? 4095 : (freq < 0 ? 0 : freq)];
+    uint32_t inc = FREQ_INC_LUT_EXP[freq > 4095 ? 4095 : (freq < 0 ? 0 : freq)];
 
     // prepare output
     int32_t out[2];
 
     // Call compute on the current oscillator using pointer
+#if TRACE_OVERSAMPLE == 2
+    int32_t half[2], full[2];
+    currentOsc->compute(phase + (inc >> 1), mod1, mod2, half);
+    phase += inc;
+    currentOsc->compute(phase, mod1, mod2, full);
+    decimator.process(half, full, out);
+#else
+    phase += inc;
     currentOsc->compute(phase, mod1, mod2, out);
+#endif
 
     // Apply anti-aliasing filter to both channels
     filter_L += ((out[0] - filter_L) * FILTER_COEF) >> 16;
@@ -1,4 +1,6 @@
 #pragma once
+// Generated by tools/mesh_to_path.py — edit the meshes and re-run, don't edit by hand:
+//   python3 tools/mesh_to_path.py -o src/mesh_data.h CUBE=tools/meshes/cube.obj CONE=tools/meshes/cone.obj ICOSPHERE=tools/meshes/icosphere.obj
 
 #include <cstdint>
 
@@ -6,75 +8,127 @@ struct Point3D
 {
     int16_t x, y, z;
 };
-constexpr uint32_t CUBE_PATH_COUNT = 16;
-constexpr Point3D CUBE_PATH[] = {
-    {2047, 2047, -2047},
-    {2047, -2047, -2047},
+
+// One segment of a closed beam path: it runs from points[i] to points[i + 1], starts at
+// phase `start` (the whole path is one 32-bit phase cycle, time ∝ segment length), and
+// rcp = 2^44 / duration, so the position along it is (((ph - start) >> 12) * rcp) >> 16
+// in Q16 — the product stays under 2^32.
+struct PathSegment
+{
+    uint32_t start, rcp;
+};
+
+struct MeshPath
+{
+    const Point3D *points;     // count + 1 (the last equals the first)
+    const PathSegment *segments;
+    uint32_t count;
+};
+
+// CUBE: 12 edges, 16 segments (0 re-traced, 4 jumps), 92.2% of the cycle on edges.
+constexpr Point3D CUBE_POINTS[] = {
     {-2047, -2047, -2047},
     {-2047, -2047, 2047},
     {2047, -2047, 2047},
+    {2047, -2047, -2047},
+    {2047, 2047, -2047},
     {2047, 2047, 2047},
     {2047, 2047, -2047},
     {-2047, 2047, -2047},
     {-2047, 2047, 2047},
-    {-2047, -2047, 2047},
-    {-2047, -2047, -2047},
-    {-2047, 2047, -2047},
-    {-2047, 2047, 2047},
     {2047, 2047, 2047},
     {2047, -2047, 2047},
     {2047, -2047, -2047},
+    {-2047, -2047, -2047},
+    {-2047, 2047, -2047},
+    {-2047, 2047, 2047},
+    {-2047, -2047, 2047},
+    {-2047, -2047, -2047},
+};
+constexpr PathSegment CUBE_SEGMENTS[] = {
+    {0x00000000, 0x000338C0}, {0x04F76276, 0x0000D027}, {0x18A4EC4E, 0x000338C0},
+    {0x1D9C4EC4, 0x0000D027}, {0x3149D89C, 0x000338C0}, {0x36413B12, 0x0000D027},
+    {0x49EEC4EA, 0x0000D027}, {0x5D9C4EC2, 0x000338C0}, {0x6293B138, 0x0000D027},
+    {0x76413B10, 0x0000D027}, {0x89EEC4E8, 0x0000D027}, {0x9D9C4EC0, 0x0000D027},
+    {0xB149D898, 0x0000D027}, {0xC4F76270, 0x0000D027}, {0xD8A4EC48, 0x0000D027},
+    {0xEC527620, 0x0000D027},
 };
+constexpr MeshPath CUBE_PATH = {CUBE_POINTS, CUBE_SEGMENTS, 16};
 
-constexpr uint32_t CONE_PATH_COUNT = 10;
-constexpr Point3D CONE_PATH[] = {
+// CONE: 8 edges, 10 segments (0 re-traced, 2 jumps), 95.3% of the cycle on edges.
+constexpr Point3D CONE_POINTS[] = {
     {0, -2047, -2047},
     {2047, -2047, 0},
+    {0, 2047, 0},
+    {-2047, -2047, 0},
     {0, -2047, 2047},
     {0, 2047, 0},
     {0, -2047, -2047},
     {-2047, -2047, 0},
-    {0, 2047, 0},
-    {2047, -2047, 0},
     {0, -2047, 2047},
-    {-2047, -2047, 0},
+    {2047, -2047, 0},
+    {0, -2047, -2047},
+};
+constexpr PathSegment CONE_SEGMENTS[] = {
+    {0x00000000, 0x0002AF2F}, {0x05F5E67E, 0x00006D9F}, {0x2B535946, 0x00006D9F},
+    {0x50B0CC0E, 0x0002AF2F}, {0x56A6B28C, 0x00006D9F}, {0x7C042554, 0x00006D9F},
+    {0xA161981C, 0x0000AD28}, {0xB9093214, 0x0000AD28}, {0xD0B0CC0C, 0x0000AD28},
+    {0xE8586604, 0x0000AD28},
 };
-const uint32_t ICOSPHERE_PATH_COUNT = 36;
-const Point3D ICOSPHERE_PATH[] = {
+constexpr MeshPath CONE_PATH = {CONE_POINTS, CONE_SEGMENTS, 10};
+
+// ICOSPHERE: 30 edges, 36 segments (0 re-traced, 6 jumps), 95.1% of the cycle on edges.
+constexpr Point3D ICOSPHERE_POINTS[] = {
     {-1831, -915, 0},
-    {-566, -915, -1741},
-    {566, 915, -1741},
     {-1481, 915, -1076},
-    {-566, -915, -1741},
-    {1481, -915, -1076},
-    {1831, 915, 0},
     {566, 915, -1741},
     {0, 2047, 0},
+    {1831, 915, 0},
+    {1481, -915, -1076},
+    {1831, 915, 0},
+    {1481, -915, 1076},
     {566, 915, 1741},
+    {1831, 915, 0},
+    {566, 915, -1741},
+    {1481, -915, -1076},
     {1481, -915, 1076},
+    {566, 915, 1741},
+    {0, 2047, 0},
+    {566, 915, -1741},
+    {-566, -915, -1741},
     {0, -2047, 0},
-    {-566, -915, 1741},
     {1481, -915, 1076},
-    {1481, -915, -1076},
-    {0, -2047, 0},
-    {-566, -915, -1741},
-    {-1481, 915, -1076},
-    {0, 2047, 0},
-    {1831, 915, 0},
-    {566, 915, 1741},
-    {-1481, 915, 1076},
-    {-1831, -915, 0},
-    {-1481, 915, -1076},
+    {-566, -915, 1741},
     {-1481, 915, 1076},
+    {566, 915, 1741},
     {-566, -915, 1741},
-    {-1831, -915, 0},
     {0, -2047, 0},
     {1481, -915, -1076},
-    {566, 915, -1741},
-    {1831, 915, 0},
-    {1481, -915, 1076},
-    {566, 915, 1741},
+    {-566, -915, -1741},
+    {0, -2047, 0},
+    {-1831, -915, 0},
     {-566, -915, 1741},
     {-1481, 915, 1076},
     {0, 2047, 0},
-};
\ No newline at end of file
+    {-1481, 915, -1076},
+    {-566, -915, -1741},
+    {-1831, -915, 0},
+    {-1481, 915, 1076},
+    {-1481, 915, -1076},
+    {-1831, -915, 0},
+};
+constexpr PathSegment ICOSPHERE_SEGMENTS[] = {
+    {0x00000000, 0x0007B512}, {0x02137164, 0x0001F87C}, {0x0A31F0AB, 0x0007B44F},
+    {0x0C459692, 0x0001F867}, {0x14646E3B, 0x0007B512}, {0x1677DF9F, 0x0001F8A9},
+    {0x1E95A532, 0x0001F8A9}, {0x26B36AC5, 0x0007B53E}, {0x28C6D063, 0x0001F88C},
+    {0x30E50F60, 0x0001F88C}, {0x39034E5D, 0x0001F8B5}, {0x4120E4D8, 0x0001F88F},
+    {0x493F1852, 0x0001F8B5}, {0x515CAECD, 0x0001F876}, {0x597B466A, 0x0001F876},
+    {0x6199DE07, 0x0001F89A}, {0x69B7E50B, 0x0007B44F}, {0x6BCB8AF2, 0x0001F87B},
+    {0x73EA1176, 0x0001F87C}, {0x7C0890BD, 0x0007B53E}, {0x7E1BF65B, 0x0001F87C},
+    {0x863A75A2, 0x0001F89A}, {0x8E587CA6, 0x0001F876}, {0x96771443, 0x0001F87B},
+    {0x9E959AC7, 0x0001F87C}, {0xA6B41A0E, 0x0001F876}, {0xAED2B1AB, 0x0001F867},
+    {0xB6F18954, 0x0001F88C}, {0xBF0FC851, 0x0001F8B5}, {0xC72D5ECC, 0x0001F87B},
+    {0xCF4BE550, 0x0001F87B}, {0xD76A6BD4, 0x0001F8B5}, {0xDF88024F, 0x0001F88C},
+    {0xE7A6414C, 0x0001F8A9}, {0xEFC406DF, 0x0001F88F}, {0xF7E23A59, 0x0001F8A9},
+};
+constexpr MeshPath ICOSPHERE_PATH = {ICOSPHERE_POINTS, ICOSPHERE_SEGMENTS, 36};
@@ -1,6 +1,10 @@
 #pragma once
 
+#ifdef TRACE_HOST
+#include "../host/host_shim.h"
+#else
 #include "ComputerCard.h"
+#endif
 #include <cstdint>
 #include <cmath>
 #include "lookup_tables.h"
@@ -9,7 +13,33 @@
 // Base Oscillator class
 class Oscillator
 {
+public:
+    // Rotation/projection is rebuilt once every CONTROL_TICK compute() calls; the calls in
+    // between only accumulate the rotation speed and reuse the cached transform.
+    static constexpr uint32_t CONTROL_TICK = 16;
+
 protected:
+    // compute() runs 1 << oversample_shift times per output sample (see SetOversample)
+    uint32_t oversample_shift = 0;
+
+    // Rotation at control rate: every call adds its speed; every CONTROL_TICK calls the
+    // angle moves on by the sum, scaled by 2^gain_shift per call at 1x, and this returns
+    // true — rebuild the transform then (two sine() calls per tick instead of per call).
+    uint32_t ph_rot = 0;
+    int32_t rot_acc = 0;
+    uint32_t rot_tick = CONTROL_TICK - 1; // first call builds the transform
+
+    bool __not_in_flash_func(rotation_tick)(int32_t speed, uint32_t gain_shift)
+    {
+        rot_acc += speed;
+        if (++rot_tick < CONTROL_TICK)
+            return false;
+        ph_rot += (uint32_t)rot_acc << (gain_shift - oversample_shift);
+        rot_acc = 0;
+        rot_tick = 0;
+        return true;
+    }
+
     // Shared waveform
     int32_t __not_in_flash_func(sine)(uint32_t ph)
     {
@@ -41,6 +71,10 @@ public:
     // Virtual function to be overridden by derived classes
     virtual void __not_in_flash_func(compute)(uint32_t ph, int32_t mod1, int32_t mod2, int32_t *out) = 0;
     virtual ~Oscillator() = default;
+
+    // 0: compute() once per sample; 1: twice (2x oversampling) — internal motion such
+    // as rotation keeps the same speed per second either way
+    void SetOversample(uint32_t shift) { oversample_shift = shift; }
 };
 
 /// Derived oscillator classes
@@ -50,14 +84,18 @@ public:
 // YinYang Shape Oscillator
 class YinYang : public Oscillator
 {
-    // rotation phase accumulator
-    uint32_t ph_rot = 0;
+    // rotation, rebuilt per control tick
+    int32_t rot_s = 0, rot_c = 0;
 
 public:
     void __not_in_flash_func(compute)(uint32_t ph, int32_t mod_grow, int32_t mod_rot, int32_t *out) override
     {
-        // increment rotation phase
-        ph_rot += mod_rot - 2048 << 11;
+        // advance rotation phase
+        if (rotation_tick(mod_rot - 2048, 11))
+        {
+            rot_s = sine(ph_rot);
+            rot_c = sine(ph_rot + 0x40000000);
+        }
 
         // clamp grow factor
         uint32_t grow = (uint32_t)(mod_grow < 0 ? 0 : (mod_grow > 4096 ? 4096 : mod_grow)) << 20;
@@ -101,145 +139,93 @@ public:
         int64_t y = sign * (out[1] + 8);
 
         // apply rotation
-        int32_t s = sine(ph_rot);
-        int32_t c = sine(ph_rot + 0x40000000);
-
-        out[0] = (int32_t)((x * s + y * c) >> 11);
-        out[1] = (int32_t)((x * c - y * s) >> 11);
+        out[0] = (int32_t)((x * rot_s + y * rot_c) >> 11);
+        out[1] = (int32_t)((x * rot_c - y * rot_s) >> 11);
     }
 };
 
 /// OSC Bank 2 - Mesh geometry shapes
 
-// Polygon Waveform Oscillator
-class PolyCube : public Oscillator
+// Polygon Waveform Oscillator: sweeps one closed path through the mesh per cycle
+// (paths and timing are generated by tools/mesh_to_path.py into mesh_data.h)
+class PolyMesh : public Oscillator
 {
-    const Point3D *path = CUBE_PATH;
-    const uint32_t path_count = CUBE_PATH_COUNT;
-    uint32_t ph_rot = 0;
-
-public:
-    void __not_in_flash_func(compute)(uint32_t ph, int32_t mod_grow, int32_t mod_rot, int32_t *out) override
-    {
-        // clamp grow factor
-        uint32_t grow = (uint32_t)(mod_grow < 0 ? 0 : (mod_grow > 4096 ? 4096 : mod_grow)) << 20;
-        ph = (uint32_t)(((uint64_t)ph * grow) >> 32);
-
-        ph_rot += mod_rot - 2048 << 10;
-
-        // interpolate position along cube path
-        uint32_t segment = ((uint64_t)ph * (path_count - 1)) >> 32;
-        uint16_t frac = (uint16_t)(((uint64_t)ph * (path_count - 1) & 0xFFFFFFFF) >> 22);
-
-        Point3D p1 = path[segment];
-        Point3D p2 = path[(segment + 1) % path_count];
+    const MeshPath &mesh;
+    uint32_t seg_index = 0;
 
-        int32_t x = p1.x + (((p2.x - p1.x) * (int32_t)frac) >> 10);
-        int32_t y = p1.y + (((p2.y - p1.y) * (int32_t)frac) >> 10);
-        int32_t z = p1.z + (((p2.z - p1.z) * (int32_t)frac) >> 10);
+    // rotation about y then isometric projection (30 degrees) as one 2x3 matrix, Q13,
+    // rebuilt per control tick; and the current segment's end points through it
+    int32_t m[2][3] = {};
+    uint32_t proj_index = UINT32_MAX;
+    int32_t pu[2] = {}, pv[2] = {};
 
-        // apply rotation
-        int32_t s = sine(ph_rot);
-        int32_t c = sine(ph_rot - 0x40000000);
-
-        int32_t rx = int(x * c - z * s) >> 11;
-        int32_t ry = y;
-        int32_t rz = (x * s + z * c) >> 11;
-
-        // isometric projection, 30 degrees
-        int32_t u = rx;
-        int32_t v = (rz >> 1) + ((ry * 3547) >> 12);
-
-        out[0] = u >> 1; // Scale to fit your specific output range
-        out[1] = v >> 1;
+    void __not_in_flash_func(project)(const Point3D &p, int32_t &u, int32_t &v)
+    {
+        u = (m[0][0] * p.x + m[0][1] * p.y + m[0][2] * p.z) >> 13;
+        v = (m[1][0] * p.x + m[1][1] * p.y + m[1][2] * p.z) >> 13;
     }
-};
-
-class PolyCone : public Oscillator
-{
-    const Point3D *path = CONE_PATH;
-    const uint32_t path_count = CONE_PATH_COUNT;
-    uint32_t ph_rot = 0;
 
 public:
+    explicit PolyMesh(const MeshPath &mp) : mesh(mp) {}
+
     void __not_in_flash_func(compute)(uint32_t ph, int32_t mod_grow, int32_t mod_rot, int32_t *out) override
     {
         // clamp grow factor
         uint32_t grow = (uint32_t)(mod_grow < 0 ? 0 : (mod_grow > 4096 ? 4096 : mod_grow)) << 20;
         ph = (uint32_t)(((uint64_t)ph * grow) >> 32);
 
-        ph_rot += mod_rot - 2048 << 10;
-
-        // interpolate position along cube path
-        uint32_t segment = ((uint64_t)ph * (path_count - 1)) >> 32;
-        uint16_t frac = (uint16_t)(((uint64_t)ph * (path_count - 1) & 0xFFFFFFFF) >> 22);
-
-        Point3D p1 = path[segment];
-        Point3D p2 = path[(segment + 1) % path_count];
-
-        int32_t x = p1.x + (((p2.x - p1.x) * (int32_t)frac) >> 10);
-        int32_t y = p1.y + (((p2.y - p1.y) * (int32_t)frac) >> 10);
-        int32_t z = p1.z + (((p2.z - p1.z) * (int32_t)frac) >> 10);
+        if (rotation_tick(mod_rot - 2048, 10))
+        {
+            int32_t s = sine(ph_rot);
+            int32_t c = sine(ph_rot - 0x40000000);
 
-        // apply rotation
-        int32_t s = sine(ph_rot);
-        int32_t c = sine(ph_rot - 0x40000000);
+            // rx = x*c - z*s, rz = x*s + z*c; u = rx / 2, v = (rz / 2 + ry * cos 30) / 2
+            m[0][0] = 2 * c; m[0][1] = 0;    m[0][2] = -2 * s;
+            m[1][0] = s;     m[1][1] = 3547; m[1][2] = c;
+            proj_index = UINT32_MAX;
+        }
 
-        int32_t rx = int(x * c - z * s) >> 11;
-        int32_t ry = y;
-        int32_t rz = (x * s + z * c) >> 11;
+        // find the segment holding ph (segments get time in proportion to their length):
+        // the phase only moves forward between wraps, so step on from the last segment
+        const PathSegment *seg = mesh.segments;
+        uint32_t i = seg_index;
+        if (ph < seg[i].start)
+            i = 0;
+        while (i + 1 < mesh.count && seg[i + 1].start <= ph)
+            i++;
+        seg_index = i;
+
+        if (i != proj_index)
+        {
+            project(mesh.points[i], pu[0], pv[0]);
+            project(mesh.points[i + 1], pu[1], pv[1]);
+            proj_index = i;
+        }
 
-        // isometric projection, 30 degrees
-        int32_t u = rx;
-        int32_t v = (rz >> 1) + ((ry * 3547) >> 12);
+        // position along the segment, Q16, from its precomputed reciprocal duration
+        int32_t frac = (int32_t)((((ph - seg[i].start) >> 12) * seg[i].rcp) >> 16);
 
-        out[0] = u >> 1; // Scale to fit your specific output range
-        out[1] = v >> 1;
+        out[0] = pu[0] + (((pu[1] - pu[0]) * frac) >> 16);
+        out[1] = pv[0] + (((pv[1] - pv[0]) * frac) >> 16);
     }
 };
 
-class PolyICO : public Oscillator
+class PolyCube : public PolyMesh
 {
-    const Point3D *path = ICOSPHERE_PATH;
-    const uint32_t path_count = ICOSPHERE_PATH_COUNT;
-
-    uint32_t ph_rot = 0;
-
 public:
-    void __not_in_flash_func(compute)(uint32_t ph, int32_t mod_grow, int32_t mod_rot, int32_t *out) override
-    {
-        // clamp grow factor
-        uint32_t grow = (uint32_t)(mod_grow < 0 ? 0 : (mod_grow > 4096 ? 4096 : mod_grow)) << 20;
-        ph = (uint32_t)(((uint64_t)ph * grow) >> 32);
-
-        ph_rot += mod_rot - 2048 << 10;
-
-        // interpolate position along cube path
-        uint32_t segment = ((uint64_t)ph * (path_count - 1)) >> 32;
-        uint16_t frac = (uint16_t)(((uint64_t)ph * (path_count - 1) & 0xFFFFFFFF) >> 22);
-
-        Point3D p1 = path[segment];
-        Point3D p2 = path[(segment + 1) % path_count];
-
-        int32_t x = p1.x + (((p2.x - p1.x) * (int32_t)frac) >> 10);
-        int32_t y = p1.y + (((p2.y - p1.y) * (int32_t)frac) >> 10);
-        int32_t z = p1.z + (((p2.z - p1.z) * (int32_t)frac) >> 10);
-
-        // apply rotation
-        int32_t s = sine(ph_rot);
-        int32_t c = sine(ph_rot - 0x40000000);
-
-        int32_t rx = int(x * c - z * s) >> 11;
-        int32_t ry = y;
-        int32_t rz = (x * s + z * c) >> 11;
+    PolyCube() : PolyMesh(CUBE_PATH) {}
+};
 
-        // isometric projection, 30 degrees
-        int32_t u = rx;
-        int32_t v = (rz >> 1) + ((ry * 3547) >> 12);
+class PolyCone : public PolyMesh
+{
+public:
+    PolyCone() : PolyMesh(CONE_PATH) {}
+};
 
-        out[0] = u >> 1; // Scale to fit your specific output range
-        out[1] = v >> 1;
-    }
+class PolyICO : public PolyMesh
+{
+public:
+    PolyICO() : PolyMesh(ICOSPHERE_PATH) {}
 };
 
 /// OSC Bank 3 - Wavetable shapes (single cycle stereo samples from vector graphics)
@@ -353,4 +339,29 @@ protected:
         // Linear interpolation: ((s2 - s1) * r >> 16) + s1
         return (s2 * (int32_t)r + s1 * (int32_t)(65536 - r)) >> 20;
     }
-};
\ No newline at end of file
+};
+
+/// Output
+
+// 2x decimator for oversampled output: 7-tap half-band (-1 0 9 16 9 0 -1) / 32 over the
+// doubled-rate stream, one output per pair of inputs (gain 1, delay 1.5 output samples)
+class HalfbandDecimator
+{
+    int32_t h[2][5] = {}; // per channel, newest first
+
+public:
+    // a = first (earlier) half-step, b = second; the decimated pair is written to out
+    void __not_in_flash_func(process)(const int32_t *a, const int32_t *b, int32_t *out)
+    {
+        for (int ch = 0; ch < 2; ch++)
+        {
+            int32_t *x = h[ch];
+            out[ch] = (16 * x[1] + 9 * (x[0] + x[2]) - b[ch] - x[4]) >> 5;
+            x[4] = x[2];
+            x[3] = x[1];
+            x[2] = x[0];
+            x[1] = a[ch];
+            x[0] = b[ch];
+        }
+    }
+};
@@ -0,0 +1,501 @@
+#!/usr/bin/env python3
+"""
+mesh_to_path.py — turn wireframes into Trace's beam paths (src/mesh_data.h)
+
+Trace's mesh oscillators (PolyCube / PolyCone / PolyICO) draw a wireframe by sweeping
+the beam along ONE closed path per cycle. This script builds those paths from OBJ or SVG
+wireframes and rewrites src/mesh_data.h.
+
+--------------------------------------------------------------------------------
+USAGE
+--------------------------------------------------------------------------------
+Run from the release directory (stdlib only, no pip installs):
+
+    python3 tools/mesh_to_path.py -o src/mesh_data.h \\
+        CUBE=tools/meshes/cube.obj CONE=tools/meshes/cone.obj \\
+        ICOSPHERE=tools/meshes/icosphere.obj
+
+Each NAME=file becomes NAME_POINTS / NAME_SEGMENTS / NAME_PATH in the header. The
+oscillators reference CUBE_PATH, CONE_PATH and ICOSPHERE_PATH — to swap a shape, point
+one of those names at a different file; to add a shape, add a name and a PolyMesh
+subclass in src/oscillator.h. Then rebuild the firmware.
+
+Inputs:
+  .obj  `v` vertices plus `l` polylines and/or `f` faces (face outlines become edges).
+        Coordinates are scaled so the largest |x|, |y|, |z| is 2047; the origin is kept
+        (it is the rotation centre) unless --center is given.
+  .svg  <line> <polyline> <polygon> <rect> and <path> (M L H V C Q Z, absolute and
+        relative; curves are flattened to --curve-steps lines). z = 0, y flipped up,
+        always centred. `transform` attributes are ignored — flatten them first.
+
+--------------------------------------------------------------------------------
+WHAT IT SOLVES
+--------------------------------------------------------------------------------
+1. Traversal. Every wireframe edge must be drawn at least once in a closed loop. That
+   is the route-inspection (Chinese postman) problem: the vertices of odd degree are
+   paired up (minimum total cost, exact for up to 16 odd vertices, greedy + 2-opt
+   beyond) and each pair is joined by the cheaper of
+     - re-tracing existing edges (shortest path along the mesh), or
+     - a straight jump, costed at 1/--jump-speed of its length (the beam crosses it
+       faster, so it is fainter than a real edge).
+   Separate pieces (SVG letters, loose parts) are linked by their nearest jumps first.
+   An Euler circuit of the result is the path.
+
+2. Timing. Each segment gets beam time in proportion to its length (jumps at
+   1/--jump-speed), so every edge is drawn at the same brightness and no time is spent
+   idling on short hops. The cycle is one 32-bit phase; every segment stores its start
+   phase and rcp = 2^44 / duration, so the oscillator finds its position along a
+   segment as (((ph - start) >> 12) * rcp) >> 16 (Q16) — one 32-bit multiply, no divide
+   at audio rate. The product stays under 2^32, and rcp >= 2^12 keeps the position
+   within 0.03% of exact at the segment's end.
+
+The summary printed per shape compares edge brightness against the old uniform time per
+segment (brightness ~ time / length).
+"""
+
+import argparse
+import math
+import re
+import sys
+import xml.etree.ElementTree as ET
+
+FULL_SCALE = 2047
+PHASE = 1 << 32
+MIN_DURATION = 1 << 20        # ≥ 256 steps of (ph - start) >> 12 per segment; rcp ≤ 2^24
+MAX_EXACT_ODD = 16            # bitmask matching up to this many odd vertices
+
+
+# ─── Loading ─────────────────────────────────────────────────────────────────
+
+def load_obj(path):
+    verts, edges = [], []
+    with open(path) as f:
+        for line in f:
+            tok = line.split()
+            if not tok:
+                continue
+            if tok[0] == "v":
+                verts.append(tuple(float(t) for t in tok[1:4]))
+            elif tok[0] in ("l", "f"):
+                idx = []
+                for t in tok[1:]:
+                    i = int(t.split("/")[0])
+                    idx.append(i - 1 if i > 0 else len(verts) + i)
+                pairs = list(zip(idx, idx[1:]))
+                if tok[0] == "f" and len(idx) > 2:
+                    pairs.append((idx[-1], idx[0]))
+                edges.extend(pairs)
+    return verts, edges
+
+
+def _floats(s):
+    return [float(t) for t in re.findall(r"[-+]?(?:\d+\.?\d*|\.\d+)(?:[eE][-+]?\d+)?", s)]
+
+
+def _svg_path(d, steps):
+    """Polylines (lists of (x, y)) from an SVG path string."""
+    out, cur, start = [], None, (0.0, 0.0)
+    pos = (0.0, 0.0)
+    for cmd, args in re.findall(r"([MmLlHhVvCcQqZz])([^MmLlHhVvCcQqZz]*)", d):
+        v = _floats(args)
+        rel = cmd.islower()
+        c = cmd.upper()
+
+        def pt(x, y):
+            return (pos[0] + x, pos[1] + y) if rel else (x, y)
+
+        if c == "M":
+            for i in range(0, len(v) - 1, 2):
+                p = pt(v[i], v[i + 1])
+                if i == 0:
+                    cur = [p]
+                    out.append(cur)
+                    start = p
+                else:
+                    cur.append(p)
+                pos = p
+        elif c == "L":
+            for i in range(0, len(v) - 1, 2):
+                pos = pt(v[i], v[i + 1])
+                cur.append(pos)
+        elif c in "HV":
+            for a in v:
+                if c == "H":
+                    pos = (pos[0] + a if rel else a, pos[1])
+                else:
+                    pos = (pos[0], pos[1] + a if rel else a)
+                cur.append(pos)
+        elif c in "CQ":
+            n = 6 if c == "C" else 4
+            for i in range(0, len(v) - n + 1, n):
+                ctrl = [pt(v[i + k], v[i + k + 1]) for k in range(0, n, 2)]
+                p0 = pos
+                for s in range(1, steps + 1):
+                    t = s / steps
+                    if c == "C":
+                        a, b, e = ctrl
+                        q = [(1 - t) ** 3 * p0[j] + 3 * (1 - t) ** 2 * t * a[j]
+                             + 3 * (1 - t) * t * t * b[j] + t ** 3 * e[j] for j in (0, 1)]
+                    else:
+                        a, e = ctrl
+                        q = [(1 - t) ** 2 * p0[j] + 2 * (1 - t) * t * a[j] + t * t * e[j]
+                             for j in (0, 1)]
+                    cur.append(tuple(q))
+                pos = ctrl[-1]
+        elif c == "Z":
+            cur.append(start)
+            pos = start
+    return out
+
+
+def load_svg(path, steps):
+    lines = []
+    for el in ET.parse(path).getroot().iter():
+        tag = el.tag.rsplit("}", 1)[-1]
+        g = lambda k: float(el.get(k, 0))
+        if tag == "line":
+            lines.append([(g("x1"), g("y1")), (g("x2"), g("y2"))])
+        elif tag in ("polyline", "polygon"):
+            v = _floats(el.get("points", ""))
+            pts = list(zip(v[0::2], v[1::2]))
+            if tag == "polygon" and pts:
+                pts.append(pts[0])
+            lines.append(pts)
+        elif tag == "rect":
+            x, y, w, h = g("x"), g("y"), g("width"), g("height")
+            lines.append([(x, y), (x + w, y), (x + w, y + h), (x, y + h), (x, y)])
+        elif tag == "path":
+            lines.extend(_svg_path(el.get("d", ""), steps))
+    verts, edges, index = [], [], {}
+    for pl in lines:
+        prev = None
+        for x, y in pl:
+            key = (round(x, 4), round(-y, 4))
+            if key not in index:
+                index[key] = len(verts)
+                verts.append((key[0], key[1], 0.0))
+            i = index[key]
+            if prev is not None and prev != i:
+                edges.append((prev, i))
+            prev = i
+    return verts, edges
+
+
+def normalise(verts, edges, center):
+    """Scale to ±FULL_SCALE, snap to ints, merge coincident vertices, drop duplicate edges."""
+    if center:
+        lo = [min(v[k] for v in verts) for k in range(3)]
+        hi = [max(v[k] for v in verts) for k in range(3)]
+        mid = [(a + b) / 2 for a, b in zip(lo, hi)]
+        verts = [tuple(v[k] - mid[k] for k in range(3)) for v in verts]
+    m = max(abs(c) for v in verts for c in v) or 1.0
+    pts, index, remap = [], {}, []
+    for v in verts:
+        p = tuple(int(round(c * FULL_SCALE / m)) for c in v)
+        if p not in index:
+            index[p] = len(pts)
+            pts.append(p)
+        remap.append(index[p])
+    seen = set()
+    for a, b in edges:
+        a, b = remap[a], remap[b]
+        if a != b:
+            seen.add((min(a, b), max(a, b)))
+    used = sorted({i for e in seen for i in e})
+    keep = {old: new for new, old in enumerate(used)}
+    return [pts[i] for i in used], sorted((keep[a], keep[b]) for a, b in seen)
+
+
+# ─── Route ───────────────────────────────────────────────────────────────────
+
+def dist(p, q):
+    return math.sqrt(sum((a - b) ** 2 for a, b in zip(p, q)))
+
+
+def components(n, edges):
+    parent = list(range(n))
+
+    def find(i):
+        while parent[i] != i:
+            parent[i] = parent[parent[i]]
+            i = parent[i]
+        return i
+    for a, b in edges:
+        parent[find(a)] = find(b)
+    groups = {}
+    for i in range(n):
+        groups.setdefault(find(i), []).append(i)
+    return list(groups.values())
+
+
+def link_components(pts, edges):
+    """Jump edges joining separate pieces: Prim over pieces, nearest vertex pairs."""
+    comps = components(len(pts), edges)
+    links = []
+    joined = comps[0][:]
+    rest = comps[1:]
+    while rest:
+        best = None
+        for ci, comp in enumerate(rest):
+            for a in joined:
+                for b in comp:
+                    d = dist(pts[a], pts[b])
+                    if best is None or d < best[0]:
+                        best = (d, a, b, ci)
+        _, a, b, ci = best
+        links.append((a, b))
+        joined += rest.pop(ci)
+    return links
+
+
+def all_pairs(pts, edges, jump_speed):
+    """Cheapest move between any two vertices (along edges or by jumping) + next hops."""
+    n = len(pts)
+    d = [[dist(pts[i], pts[j]) / jump_speed for j in range(n)] for i in range(n)]
+    hop = [[("jump", j) for j in range(n)] for i in range(n)]
+    for a, b in edges:
+        w = dist(pts[a], pts[b])
+        if w <= d[a][b]:
+            d[a][b] = d[b][a] = w
+            hop[a][b] = ("edge", b)
+            hop[b][a] = ("edge", a)
+    for k in range(n):
+        dk = d[k]
+        for i in range(n):
+            dik = d[i][k]
+            di = d[i]
+            hi = hop[i]
+            for j in range(n):
+                if dik + dk[j] < di[j] - 1e-9:
+                    di[j] = dik + dk[j]
+                    hi[j] = hi[k]
+    return d, hop
+
+
+def match_odd(odd, d):
+    """Minimum-cost perfect matching of the odd-degree vertices."""
+    n = len(odd)
+    if n <= MAX_EXACT_ODD:
+        memo = {}
+
+        def best(mask):
+            if mask == 0:
+                return 0.0, ()
+            if mask in memo:
+                return memo[mask]
+            i = (mask & -mask).bit_length() - 1
+            rest = mask & ~(1 << i)
+            res = None
+            m = rest
+            while m:
+                j = (m & -m).bit_length() - 1
+                m &= m - 1
+                c, pairs = best(rest & ~(1 << j))
+                c += d[odd[i]][odd[j]]
+                if res is None or c < res[0]:
+                    res = (c, pairs + ((odd[i], odd[j]),))
+            memo[mask] = res
+            return res
+        return list(best((1 << n) - 1)[1])
+    # Greedy, then 2-opt over pairs of pairs until nothing improves.
+    left = list(odd)
+    pairs = []
+    while left:
+        a = left.pop(0)
+        b = min(left, key=lambda v: d[a][v])
+        left.remove(b)
+        pairs.append((a, b))
+    improved = True
+    while improved:
+        improved = False
+        for i in range(len(pairs)):
+            for j in range(i + 1, len(pairs)):
+                (a, b), (c, e) = pairs[i], pairs[j]
+                now = d[a][b] + d[c][e]
+                for p, q in (((a, c), (b, e)), ((a, e), (b, c))):
+                    if d[p[0]][p[1]] + d[q[0]][q[1]] < now - 1e-9:
+                        pairs[i], pairs[j] = p, q
+                        now = d[p[0]][p[1]] + d[q[0]][q[1]]
+                        improved = True
+    return pairs
+
+
+def euler_circuit(n, multi, start):
+    """Hierholzer. multi = list of (a, b, kind); returns [(vertex, kind of edge into it)]."""
+    adj = [[] for _ in range(n)]
+    for k, (a, b, kind) in enumerate(multi):
+        adj[a].append((b, k, kind))
+        adj[b].append((a, k, kind))
+    used = [False] * len(multi)
+    stack, out = [(start, None)], []
+    while stack:
+        v, kind = stack[-1]
+        while adj[v] and used[adj[v][-1][1]]:
+            adj[v].pop()
+        if adj[v]:
+            w, k, kd = adj[v].pop()
+            used[k] = True
+            stack.append((w, kd))
+        else:
+            out.append(stack.pop())
+    out.reverse()
+    return out
+
+
+def route(pts, edges, jump_speed):
+    multi = [(a, b, "edge") for a, b in edges]
+    multi += [(a, b, "jump") for a, b in link_components(pts, edges)]
+    deg = [0] * len(pts)
+    for a, b, _ in multi:
+        deg[a] += 1
+        deg[b] += 1
+    odd = [i for i in range(len(pts)) if deg[i] & 1]
+    d, hop = all_pairs(pts, edges, jump_speed)
+    for a, b in match_odd(odd, d):
+        while a != b:                       # walk the cheapest move, hop by hop
+            kind, nxt = hop[a][b]
+            multi.append((a, nxt, "retrace" if kind == "edge" else "jump"))
+            a = nxt
+    circuit = euler_circuit(len(pts), multi, 0)
+    return circuit, len(odd)
+
+
+# ─── Timing + output ─────────────────────────────────────────────────────────
+
+def schedule(pts, circuit, jump_speed):
+    """Per segment: (start phase, rcp). Durations ∝ length (jumps ∝ length / speed)."""
+    cost = []
+    for (a, _), (b, kind) in zip(circuit, circuit[1:]):
+        w = dist(pts[a], pts[b])
+        cost.append(w / jump_speed if kind == "jump" else w)
+    total = sum(cost)
+    n = len(cost)
+    # Floor every segment at MIN_DURATION, share the rest of the cycle by cost.
+    spare = PHASE - n * MIN_DURATION
+    if spare < 0:
+        sys.exit("path has %d segments — too many for one 32-bit cycle" % n)
+    dur = [MIN_DURATION + int(spare * c / total) for c in cost]
+    dur[-1] += PHASE - sum(dur)
+    segs, start = [], 0
+    for t in dur:
+        segs.append((start, (1 << 44) // t))
+        start += t
+    return segs
+
+
+def summary(name, pts, edges, circuit, segs, n_odd):
+    kinds = [k for _, k in circuit[1:]]
+    lens = [dist(pts[a], pts[b]) for (a, _), (b, _) in zip(circuit, circuit[1:])]
+    durs = [(segs[i + 1][0] if i + 1 < len(segs) else PHASE) - segs[i][0]
+            for i in range(len(segs))]
+    # Brightness of each wireframe edge ~ beam time per unit length, summed over every
+    # pass along it (a jump that runs along an edge counts too); same for the old
+    # uniform time per segment.
+    bright = {e: 0.0 for e in edges}
+    uniform = {e: 0.0 for e in edges}
+    for ((a, _), (b, _)), t, l in zip(zip(circuit, circuit[1:]), durs, lens):
+        e = (min(a, b), max(a, b))
+        if e in bright:
+            bright[e] += t / l
+            uniform[e] += 1 / l
+    on_edges = sum(t for t, k in zip(durs, kinds) if k != "jump") / PHASE
+    spread = lambda d: max(d.values()) / min(d.values())
+    print("%-10s %3d verts %3d edges %2d odd | %3d segs: %2d retraced, %d jumps | "
+          "beam on edges %5.1f%% | brightness max/min %.2f (uniform time: %.2f)"
+          % (name, len(pts), len(edges), n_odd, len(segs), kinds.count("retrace"),
+             kinds.count("jump"), 100 * on_edges, spread(bright), spread(uniform)),
+          file=sys.stderr)
+    return ("// %s: %d edges, %d segments (%d re-traced, %d jumps), %.1f%% of the cycle "
+            "on edges." % (name, len(edges), len(segs), kinds.count("retrace"),
+                           kinds.count("jump"), 100 * on_edges))
+
+
+def emit(name, pts, circuit, segs, note):
+    lines = [note]
+    lines.append("constexpr Point3D %s_POINTS[] = {" % name)
+    for v, _ in circuit:
+        lines.append("    {%d, %d, %d}," % pts[v])
+    lines.append("};")
+    lines.append("constexpr PathSegment %s_SEGMENTS[] = {" % name)
+    for i in range(0, len(segs), 3):
+        lines.append("    " + " ".join("{0x%08X, 0x%08X}," % s for s in segs[i:i + 3]))
+    lines.append("};")
+    lines.append("constexpr MeshPath %s_PATH = {%s_POINTS, %s_SEGMENTS, %d};"
+                 % (name, name, name, len(segs)))
+    return "\n".join(lines)
+
+
+HEADER = """#pragma once
+// Generated by tools/mesh_to_path.py — edit the meshes and re-run, don't edit by hand:
+//   python3 tools/mesh_to_path.py -o src/mesh_data.h %s
+
+#include <cstdint>
+
+struct Point3D
+{
+    int16_t x, y, z;
+};
+
+// One segment of a closed beam path: it runs from points[i] to points[i + 1], starts at
+// phase `start` (the whole path is one 32-bit phase cycle, time ∝ segment length), and
+// rcp = 2^44 / duration, so the position along it is (((ph - start) >> 12) * rcp) >> 16
+// in Q16 — the product stays under 2^32.
+struct PathSegment
+{
+    uint32_t start, rcp;
+};
+
+struct MeshPath
+{
+    const Point3D *points;     // count + 1 (the last equals the first)
+    const PathSegment *segments;
+    uint32_t count;
+};
+"""
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[1],
+                                 formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("shapes", nargs="+", metavar="NAME=file.obj|svg")
+    ap.add_argument("-o", "--output", help="header to write (default: stdout)")
+    ap.add_argument("--jump-speed", type=float, default=4.0,
+                    help="how much faster the beam crosses a jump than an edge (default 4)")
+    ap.add_argument("--center", action="store_true", help="centre OBJ meshes on their bounds")
+    ap.add_argument("--curve-steps", type=int, default=8, help="lines per SVG curve")
+    args = ap.parse_args()
+
+    blocks = []
+    for spec in args.shapes:
+        name, _, path = spec.partition("=")
+        if not path or not re.match(r"^[A-Z_][A-Z0-9_]*$", name):
+            ap.error("expected NAME=file with an UPPER_CASE name, got %r" % spec)
+        if path.lower().endswith(".svg"):
+            verts, edges = load_svg(path, args.curve_steps)
+            pts, edges = normalise(verts, edges, True)
+        else:
+            verts, edges = load_obj(path)
+            pts, edges = normalise(verts, edges, args.center)
+        if not edges:
+            sys.exit("%s: no edges" % path)
+        circuit, n_odd = route(pts, edges, args.jump_speed)
+        segs = schedule(pts, circuit, args.jump_speed)
+        note = summary(name, pts, edges, circuit, segs, n_odd)
+        blocks.append(emit(name, pts, circuit, segs, note))
+
+    argv, skip = [], False
+    for a in sys.argv[1:]:                  # the command line, minus -o
+        if skip or a in ("-o", "--output") or a.startswith("--output="):
+            skip = a in ("-o", "--output") and not skip
+            continue
+        argv.append(a)
+    text = HEADER % " ".join(argv) + "\n" + "\n\n".join(blocks) + "\n"
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+
+
+if __name__ == "__main__":
+    main()
@@ -7,14 +7,17 @@
 // - separate frame and sample evaluation, allowing independent
 //   speaking speed and pitch modification
 
+// The card now runs src/LpcSynth.h; this version is kept as the reference that
+// host/talker_bench checks it against.
+
 #pragma once
 
 #include <inttypes.h>
 #ifdef ARDUINO
 #include "Print.h"
 #endif
-#include "Vocab_Special.h"
-#include "Vocab_US_Large.h"
+#include "../vocab/Vocab_Special.h"
+#include "../vocab/Vocab_US_Large.h"
 //#include "Vocab_Toms_Diner.h"
 
 #define CHIRP_SIZE 41
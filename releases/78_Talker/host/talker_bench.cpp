@@ -0,0 +1,325 @@
+// talker_bench — checks the card's LPC engine (src/LpcSynth.h, rendered in blocks by
+// src/TalkerStream.h) against the TalkiePCM code it replaced, and times both.
+//
+// The reference replays the old ProcessSample() on top of host/TalkiePCM.h; the new path
+// renders the same TalkerControl stream through TalkerStream. Speech, exciter and both CV
+// outputs must match on every sample, through speed and pitch changes, triggered words,
+// and audio in 1 replacing the exciter. Continuous babbling is compared by how long each
+// path sits silent between numbers (the old one stops for a frame or more; queued
+// phrases shouldn't). Then the cost per LPC frame (25ms of speech at nominal speed).
+//
+// Vocabulary banks (src/vocab_builtin.h, and any bank files from tools/vocab_pack.py -o
+// given on the command line) are checked too: every word found by name, in any case,
+// the number words identical to the source arrays, and the cost of a lookup.
+//
+//   ./talker_bench                  check + timing
+//   ./talker_bench -s 120           time over 120 s of audio
+//   ./talker_bench banks/*.bin      also check these banks
+//
+// Host ns/cycles are only relative (x86, not an RP2040) — compare the rows, not the numbers.
+#include "../src/TalkerStream.h"
+#include "../src/vocab_builtin.h"
+#include "TalkiePCM.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC 1
+#endif
+
+// ─── Reference: the old ProcessSample() on TalkiePCM ─────────────────────────
+// TalkiePCM keeps its frame clock, subframe counter and noise generator in function
+// statics, so there is only ever one of these per process.
+static TalkiePCM ref_voice;
+
+struct RefCard {
+    int sampleRamp = 0;
+    int16_t sample = 0, pre = 0, cvenergy = 0, cvpitch = 0;
+    int32_t cvenergy2 = 0;
+    uint32_t lcg_seed = 1;
+    bool finished = false;
+
+    int RandomDigit() {
+        lcg_seed = 1664525 * lcg_seed + 1013904223;
+        return lcg_seed / 429496730;
+    }
+
+    RefCard() {
+        // TalkiePCM's frame clock starts at 10,000,000; a thousand idle calls bring it to 0
+        // with the subframe counter at 0, where LpcSynth starts.
+        for (int i = 0; i < 1000; i++) ref_voice.calculateNextFrame(0, cvenergy, cvpitch);
+        ref_voice.sayNumber(RandomDigit());
+    }
+
+    void step(const TalkerControl &c, TalkerOutput &o) {
+        sampleRamp += c.incr;
+        finished = ref_voice.calculateNextFrame(c.frameIncr, cvenergy, cvpitch);
+        cvenergy2 = (15 * int32_t(cvenergy2) + (cvenergy << 3)) >> 4;
+        if ((finished && (c.flags & TalkerControl::Continuous)) || (c.flags & TalkerControl::Trigger))
+            ref_voice.sayNumber(RandomDigit());
+        if (sampleRamp > 8192) {
+            sampleRamp -= 8192;
+            sample = ref_voice.calculateNextSample(c.flags & TalkerControl::Tone, c.tone, pre);
+        }
+        o.speech = sample;
+        o.exciter = pre;
+        o.energy = cvenergy2;
+        o.pitch = cvpitch;
+        o.flags = 0;
+    }
+};
+
+// ─── Control streams ─────────────────────────────────────────────────────────
+// Nominal speed: 8 kHz LPC samples (incr 1365) and 25 ms frames (frameIncr 83).
+struct Segment {
+    const char *name;
+    double seconds;
+    TalkerControl (*at)(uint32_t n);   // controls for sample n of the segment
+};
+
+static TalkerControl ctl(int incr, int frameIncr, bool trigger, uint8_t flags = 0, int16_t tone = 0) {
+    TalkerControl c;
+    c.incr = incr;
+    c.frameIncr = frameIncr;
+    c.tone = tone;
+    c.flags = flags | (trigger ? TalkerControl::Trigger : 0);
+    return c;
+}
+
+static int16_t saw(uint32_t n, double hz) {
+    double p = n * hz / 48000.0;
+    return (int16_t)lround(4094 * (p - std::floor(p)) - 2047);
+}
+
+static uint32_t hash(uint32_t n) { return (n * 2654435761u) >> 16; }
+
+static const Segment SEGMENTS[] = {
+    {"nominal", 8, [](uint32_t n) { return ctl(1365, 83, n % 33600 == 16000); }},
+    {"fast, high", 6, [](uint32_t n) { return ctl(3000, 250, n % 14400 == 100); }},
+    {"slow, low", 10, [](uint32_t n) { return ctl(600, 30, n % 72000 == 1000); }},
+    {"tone in", 8, [](uint32_t n) {
+        return ctl(1365, 83, n % 33600 == 5000, TalkerControl::Tone, saw(n, 110.0));
+    }},
+    {"modulated", 10, [](uint32_t n) {
+        double t = n / 48000.0;
+        int incr = (int)lround(1365 + 1000 * std::sin(2 * M_PI * 3 * t));
+        int fi = (int)lround(83 + 60 * std::sin(2 * M_PI * 0.5 * t));
+        bool tone = (n / 96000) & 1;
+        return ctl(incr, fi, hash(n) % 19200 == 0, tone ? TalkerControl::Tone : 0, saw(n, 82.4));
+    }},
+    {"stopped (0 speed)", 2, [](uint32_t n) { return ctl(0, 0, n == 1000); }},
+};
+#define NUM_SEGMENTS ((int)(sizeof(SEGMENTS) / sizeof(SEGMENTS[0])))
+
+static bool same(const TalkerOutput &a, const TalkerOutput &b) {
+    return a.speech == b.speech && a.exciter == b.exciter && a.energy == b.energy && a.pitch == b.pitch;
+}
+
+// Time in ns and (where there is one) TSC cycles.
+struct Cost { double ns, cycles; };
+
+template <typename F>
+static Cost measure(F fn) {
+    using clock = std::chrono::steady_clock;
+#ifdef HAVE_TSC
+    uint64_t c0 = __rdtsc();
+#endif
+    auto t0 = clock::now();
+    fn();
+    auto t1 = clock::now();
+    Cost c = {std::chrono::duration<double, std::nano>(t1 - t0).count(), 0};
+#ifdef HAVE_TSC
+    c.cycles = (double)(__rdtsc() - c0);
+#endif
+    return c;
+}
+
+// ─── Banks ────────────────────────────────────────────────────────────────────
+struct SourceWord { const char *name; const uint8_t *data; size_t bytes; };
+#define SRC(sym, name) {name, sym, sizeof(sym)}
+static const SourceWord NUMBER_SOURCES[] = {
+    SRC(sp2_ZERO, "ZERO"), SRC(sp2_ONE, "one"), SRC(sp2_TWO, "Two"), SRC(sp2_THREE, "THREE"),
+    SRC(sp2_FOUR, "FOUR"), SRC(sp2_FIVE, "FIVE"), SRC(sp2_SIX, "SIX"), SRC(sp2_SEVEN, "SEVEN"),
+    SRC(sp2_EIGHT, "EIGHT"), SRC(sp2_NINE, "NINE"), SRC(sp2_TEN, "TEN"),
+    SRC(sp2_ELEVEN, "ELEVEN"), SRC(sp2_TWELVE, "TWELVE"), SRC(sp2_THIR_, "THIR_"),
+    SRC(sp2_FIF_, "FIF_"), SRC(sp2__TEEN, "_TEEN"), SRC(sp2_TWENTY, "TWENTY"),
+    SRC(sp2_T, "T"), SRC(sp2_HUNDRED, "HUNDRED"), SRC(sp2_THOUSAND, "THOUSAND"),
+    SRC(sp2_AND, "AND"), SRC(sp2_MINUS, "MINUS"), SRC(spPAUSE1, "PAUSE1"),
+};
+#undef SRC
+
+// Returns the number of problems found.
+static int check_bank(const char *label, const VocabBank &b, bool builtin) {
+    int bad = 0;
+    size_t longest = 0;
+    for (int i = 0; i < b.NumWords(); i++) {
+        std::string name = b.WordName(i), lower = name;
+        for (char &ch : lower) ch = (char)tolower((unsigned char)ch);
+        if (b.Find(name.c_str()) != i || b.Find(lower.c_str()) != i) {
+            if (!bad++) printf("  %s: word %d \"%s\" not found by name\n", label, i, name.c_str());
+        }
+        longest = std::max(longest, (size_t)b.Word(i).bytes);
+    }
+    if (b.Find("NO SUCH WORD") != -1 || b.Find("") != -1) {
+        bad++;
+        printf("  %s: found a word that isn't there\n", label);
+    }
+    if (builtin) {
+        for (const SourceWord &w : NUMBER_SOURCES) {
+            LpcWord lw = b.Word(b.Find(w.name));
+            if (lw.bytes != w.bytes || memcmp(lw.data, w.data, w.bytes)) {
+                bad++;
+                printf("  %s: %s differs from its source array\n", label, w.name);
+            }
+        }
+    }
+    using clock = std::chrono::steady_clock;
+    const int reps = 200;
+    volatile int sink = 0;
+    auto t0 = clock::now();
+    for (int r = 0; r < reps; r++)
+        for (int i = 0; i < b.NumWords(); i++) sink = sink + b.Find(b.WordName(i));
+    auto t1 = clock::now();
+    double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / reps / b.NumWords();
+    printf("%-20s %-10s %5d words %7u bytes, longest word %3zu bytes, Find %5.1f ns | %s\n",
+           label, b.Name(), b.NumWords(), b.Size(), longest, ns, bad ? "FAIL" : "ok");
+    return bad;
+}
+
+int main(int argc, char **argv) {
+    double seconds = 60;
+    std::vector<std::string> bank_files;
+    for (int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        if (a == "-s" && i + 1 < argc) seconds = atof(argv[++i]);
+        else if (a[0] != '-') bank_files.push_back(a);
+        else { fprintf(stderr, "usage: %s [-s seconds] [bank.bin...]\n", argv[0]); return 2; }
+    }
+    if (seconds < 1) seconds = 1;
+
+    int failures = 0;
+    VocabBank builtin;
+    if (!builtin.Load(VOCAB_BUILTIN, sizeof(VOCAB_BUILTIN))) {
+        printf("built-in bank does not load\n");
+        return 1;
+    }
+    failures += check_bank("built-in", builtin, true) != 0;
+    std::vector<std::vector<uint8_t>> images;
+    for (const std::string &f : bank_files) {
+        std::ifstream in(f, std::ios::binary);
+        std::vector<uint8_t> image((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        image.resize((image.size() + 3) & ~3u);
+        VocabBank b;
+        if (!b.Load(image.data(), image.size())) {
+            printf("%-20s does not load\n", f.c_str());
+            failures++;
+            continue;
+        }
+        failures += check_bank(f.c_str(), b, false) != 0;
+        images.push_back(std::move(image));
+    }
+    printf("\n");
+
+    // Bit-exact check. One session, segment after segment, as the card would run.
+    const int BLOCK = 16;
+    RefCard card;
+    TalkerStream stream(&builtin, 1);
+    printf("%-20s %9s %9s | %s\n", "segment", "samples", "words", "check");
+    for (int s = 0; s < NUM_SEGMENTS; s++) {
+        const Segment &sg = SEGMENTS[s];
+        uint32_t total = (uint32_t)(sg.seconds * 48000) / BLOCK * BLOCK;
+        long mismatch = -1, words = 0;
+        TalkerOutput ref_out, mismatch_ref = {}, mismatch_new = {};
+        for (uint32_t n = 0; n < total; n += BLOCK) {
+            TalkerControl in[BLOCK];
+            TalkerOutput out[BLOCK];
+            for (int i = 0; i < BLOCK; i++) in[i] = sg.at(n + i);
+            stream.render(in, out, BLOCK);
+            for (int i = 0; i < BLOCK; i++) {
+                card.step(in[i], ref_out);
+                if (out[i].flags & TalkerOutput::PhraseStart) words++;
+                if (mismatch < 0 && !same(ref_out, out[i])) {
+                    mismatch = n + i;
+                    mismatch_ref = ref_out;
+                    mismatch_new = out[i];
+                }
+            }
+        }
+        if (mismatch >= 0) {
+            failures++;
+            printf("%-20s %9u %9ld | FAIL at sample %ld: speech %d/%d exciter %d/%d energy %d/%d "
+                   "pitch %d/%d (old/new)\n", sg.name, total, words, mismatch,
+                   mismatch_ref.speech, mismatch_new.speech, mismatch_ref.exciter,
+                   mismatch_new.exciter, mismatch_ref.energy, mismatch_new.energy,
+                   mismatch_ref.pitch, mismatch_new.pitch);
+        } else {
+            printf("%-20s %9u %9ld | bit-exact\n", sg.name, total, words);
+        }
+    }
+
+    // Continuous babbling at nominal speed: silence between numbers. The old card only
+    // said the next number once the last one had stopped; now it is queued while the
+    // last one plays. "idle" is time the engine spends stopped.
+    {
+        const uint32_t total = 20 * 48000;
+        TalkerControl c = ctl(1365, 83, false, TalkerControl::Continuous);
+        TalkerOutput o;
+        long ref_idle = 0, ref_words = 0;
+        bool was_finished = false;
+        for (uint32_t n = 0; n < total; n++) {
+            card.step(c, o);
+            if (card.finished) ref_idle++;
+            else if (was_finished) ref_words++;
+            was_finished = card.finished;
+        }
+        LpcSynth voice;
+        NumberWords numbers = TalkerStream::NumberWordsFrom(builtin);
+        long new_idle = 0, new_words = 0;
+        uint32_t seed = 1;
+        for (uint32_t n = 0; n < total; n++) {
+            if (voice.queued() == 0) {
+                seed = 1664525 * seed + 1013904223;
+                voice.sayNumber(seed / 429496730, numbers);
+            }
+            if (voice.tick(83)) new_idle++;
+            if (voice.phraseStarted) { new_words++; voice.phraseStarted = false; }
+        }
+        printf("\ncontinuous, 20 s:  old %ld numbers, idle %.1f ms/number  |  "
+               "new %ld numbers, idle %.1f ms/number\n",
+               ref_words, ref_words ? ref_idle / 48.0 / ref_words : 0.0,
+               new_words, new_words ? new_idle / 48.0 / new_words : 0.0);
+        if (new_idle) { failures++; printf("FAIL: queued phrases left gaps\n"); }
+    }
+
+    // Cost, over `seconds` of the nominal segment.
+    const uint32_t total = (uint32_t)(seconds * 48000) / BLOCK * BLOCK;
+    const double frames = total * 83.0 / 100000.0;   // LPC frames = 10 subframes of 10000
+    std::vector<TalkerControl> in(total);
+    std::vector<TalkerOutput> out(total);
+    for (uint32_t n = 0; n < total; n++) in[n] = SEGMENTS[0].at(n);
+    volatile int32_t keep = 0;
+    Cost old_cost = measure([&] {
+        for (uint32_t n = 0; n < total; n++) card.step(in[n], out[n]);
+        keep = keep + out[total - 1].speech;
+    });
+    TalkerStream timed(&builtin, 1);
+    Cost new_cost = measure([&] {
+        for (uint32_t n = 0; n < total; n += BLOCK) timed.render(&in[n], &out[n], BLOCK);
+        keep = keep + out[total - 1].speech;
+    });
+    printf("\n%.0f s nominal speech, %.0f LPC frames\n", seconds, frames);
+    printf("%-28s %12s %12s %14s\n", "", "ns/sample", "ns/frame", "cycles/frame");
+    printf("%-28s %12.1f %12.0f %14.0f\n", "TalkiePCM, per sample", old_cost.ns / total,
+           old_cost.ns / frames, old_cost.cycles / frames);
+    printf("%-28s %12.1f %12.0f %14.0f\n", "LpcSynth, blocks of 16", new_cost.ns / total,
+           new_cost.ns / frames, new_cost.cycles / frames);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,398 @@
+// LpcSynth - integer LPC speech engine for the Talker card
+//
+// Based on the TalkiePCM library (Talkie, Copyright 2011 Peter Knight, GPLv2; per-sample
+// rework by Chris Johnson 2024), and produces the same samples from the same calls: same
+// bit reader, coefficient tables, subframe smoothing, exciter and lattice, down to the
+// 16-bit wrap of the filter state. What changed:
+// - integer only, tables are static (flash) rather than copied into every instance,
+//   no Print/callback/float volume output paths
+// - all state belongs to the instance (TalkiePCM kept some in function statics)
+// - words go through a phrase queue. sayNumber() queues all of a number's words (say()
+//   used to overwrite the previous word, so "thirteen" came out as "teen"), and when a
+//   word reaches its stop frame with another word queued, the next word's first frame is
+//   read in the same frame slot: queued phrases run back to back without a silent frame
+// - words are given as LpcWord (data + length, usually from a VocabBank) and copied to
+//   RAM as they start, so frames are never read from flash
+// - the frame clock starts settled (TalkiePCM's started at 10,000,000 and raced through
+//   its first thousand calls, skipping the first word)
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+// One word's LPC bitstream, in speech ROM bit order
+struct LpcWord
+{
+	const uint8_t *data = nullptr;
+	uint16_t bytes = 0;
+};
+
+// The words sayNumber() builds numbers from, in the VM61002 ROM's scheme: 13..19 are
+// units[3..9] + teen, 30..90 are tens[] + t (20 is a word of its own)
+struct NumberWords
+{
+	LpcWord units[20]; // ZERO..TWELVE; [13..19] = THIR_, FOUR, FIF_, SIX .. NINE
+	LpcWord tens[10];  // [2..9] = TWENTY, THIR_, FOUR, FIF_, SIX .. NINE
+	LpcWord minus, thousand, hundred, and_, t, teen;
+};
+
+class LpcSynth
+{
+public:
+	static constexpr int QUEUE_SIZE = 16;      // words; longest number phrase is 15 words
+	static constexpr int MAX_WORD_BYTES = 512; // longest word say() takes
+
+	// Queue a word. phraseStart marks the first word of a phrase; tick() sets
+	// phraseStarted when that word begins to play.
+	bool say(LpcWord word, bool phraseStart = true)
+	{
+		if (queueCount == QUEUE_SIZE || !word.data || !word.bytes || word.bytes > MAX_WORD_BYTES)
+			return false;
+		queue[(queueHead + queueCount) % QUEUE_SIZE] = {word, phraseStart};
+		queueCount++;
+		return true;
+	}
+
+	// Drop anything queued; the next word said starts at the next frame slot, cutting off
+	// the word playing now.
+	void interrupt()
+	{
+		queueCount = 0;
+		restart = true;
+	}
+
+	int queued() const { return queueCount; }
+
+	// Queue any number between -999,999 and 999,999 as one phrase. False (and nothing
+	// queued) if the queue can't take all of its words.
+	bool sayNumber(long number, const NumberWords &nw)
+	{
+		LpcWord words[QUEUE_SIZE];
+		int n = 0;
+		numberWords(number, nw, words, n);
+		if (n > QUEUE_SIZE - queueCount) return false;
+		for (int i = 0; i < n; i++)
+			if (!say(words[i], i == 0)) return false;
+		return true;
+	}
+
+	// Advance the frame clock by incr (10000 = one subframe); call once per audio sample.
+	// Every subframe the filter coefficients, energy and pitch move a quarter of the way to
+	// their targets; every ten subframes the next frame is read. Returns true while
+	// stopped: the last word has ended and nothing is queued.
+	bool tick(int incr)
+	{
+		frameAcc += incr;
+		if (frameAcc >= 10000)
+		{
+			frameAcc -= 10000;
+
+			for (int i = 1; i <= 10; i++)
+				kv[i] = (kv[i] * 3 + k[i]) >> 2;
+			smoothedEnergy = (smoothedEnergy * 3 + synthEnergy) >> 2;
+			smoothedPitch = (smoothedPitch * 3 + framePitch) >> 2;
+
+			if (++subframe == 10)
+			{
+				subframe = 0;
+				readFrame();
+			}
+		}
+		return energy == STOP_FRAME && queueCount == 0;
+	}
+
+	// Smoothed exciter energy and pitch CV, as of the last subframe
+	int16_t energyOut() const { return smoothedEnergy; }
+	int16_t pitchOut() const { return smoothedPitch; }
+
+	// Set by tick() when the first word of a phrase starts; the caller clears it
+	bool phraseStarted = false;
+
+	// Next speech sample, 16-bit. replaceExciter swaps the pitched source for inputTone
+	// (12-bit); preFilter receives the unfiltered exciter. Like the TMS5220's PWM output,
+	// the sample returned is the one computed on the previous call.
+	int16_t sample(bool replaceExciter, int16_t inputTone, int16_t &preFilter)
+	{
+		int16_t out = nextSample;
+
+		int16_t e;
+		if (period)
+		{
+			// Voiced source
+			if (periodCounter < period)
+				periodCounter++;
+			else
+				periodCounter = 0;
+			e = periodCounter < CHIRP_SIZE ? (chirp[periodCounter] * (uint32_t)synthEnergy) >> 8 : 0;
+		}
+		else
+		{
+			// Unvoiced source
+			e = noise() ? synthEnergy : -synthEnergy;
+		}
+		preFilter = e;
+		if (replaceExciter)
+		{
+			e = inputTone >> 3;
+			if (!period)
+				e += (noise() ? synthEnergy : -synthEnergy) >> 1;
+		}
+
+		// Lattice filter forward path: K1, K2 are Q15, K3..K10 Q7
+		int16_t u9 = e - ((kv[10] * x[9]) >> 7);
+		int16_t u8 = u9 - ((kv[9] * x[8]) >> 7);
+		int16_t u7 = u8 - ((kv[8] * x[7]) >> 7);
+		int16_t u6 = u7 - ((kv[7] * x[6]) >> 7);
+		int16_t u5 = u6 - ((kv[6] * x[5]) >> 7);
+		int16_t u4 = u5 - ((kv[5] * x[4]) >> 7);
+		int16_t u3 = u4 - ((kv[4] * x[3]) >> 7);
+		int16_t u2 = u3 - ((kv[3] * x[2]) >> 7);
+		int16_t u1 = u2 - ((kv[2] * x[1]) >> 15);
+		int16_t u0 = u1 - ((kv[1] * x[0]) >> 15);
+
+		// Output clamp
+		if (u0 < -512) u0 = -512;
+		if (u0 > 511) u0 = 511;
+
+		// Reverse path
+		x[9] = x[8] + ((kv[9] * u8) >> 7);
+		x[8] = x[7] + ((kv[8] * u7) >> 7);
+		x[7] = x[6] + ((kv[7] * u6) >> 7);
+		x[6] = x[5] + ((kv[6] * u5) >> 7);
+		x[5] = x[4] + ((kv[5] * u4) >> 7);
+		x[4] = x[3] + ((kv[4] * u3) >> 7);
+		x[3] = x[2] + ((kv[3] * u2) >> 7);
+		x[2] = x[1] + ((kv[2] * u1) >> 15);
+		x[1] = x[0] + ((kv[1] * u0) >> 15);
+		x[0] = u0;
+
+		nextSample = u0;
+		return out * 64; // 10-bit lattice output to 16 bits
+	}
+
+private:
+	static constexpr int CHIRP_SIZE = 41;
+	static constexpr uint8_t STOP_FRAME = 0xf;
+
+	struct QueuedWord
+	{
+		LpcWord word;
+		bool phraseStart;
+	};
+	QueuedWord queue[QUEUE_SIZE];
+	int queueHead = 0, queueCount = 0;
+	bool restart = false;
+
+	// Bit reader, over the RAM copy of the word playing (plus a 0 byte to read ahead into)
+	uint8_t current[MAX_WORD_BYTES + 1];
+	const uint8_t *ptrAddr = nullptr;
+	uint8_t ptrBit = 0;
+
+	// Frame state: targets read from the stream, and their smoothed values
+	int frameAcc = 0, subframe = 0;
+	uint8_t energy = STOP_FRAME; // stopped until the first word
+	uint16_t synthEnergy = 0;
+	uint8_t period = 0;
+	int16_t framePitch = 0;
+	int16_t k[11] = {};  // k[1], k[2] Q15; k[3]..k[10] Q7
+	int16_t kv[11] = {}; // smoothed k
+	int16_t smoothedEnergy = 0, smoothedPitch = 0;
+
+	// Sample state
+	uint8_t periodCounter = 0;
+	uint16_t synthRand = 1;
+	int16_t nextSample = 0;
+	int16_t x[10] = {};
+
+	bool noise()
+	{
+		synthRand = (synthRand >> 1) ^ ((synthRand & 1) ? 0xB800 : 0);
+		return synthRand & 1;
+	}
+
+	bool popWord()
+	{
+		if (!queueCount) return false;
+		const QueuedWord &w = queue[queueHead];
+		memcpy(current, w.word.data, w.word.bytes);
+		current[w.word.bytes] = 0;
+		ptrAddr = current;
+		ptrBit = 0;
+		if (w.phraseStart) phraseStarted = true;
+		queueHead = (queueHead + 1) % QUEUE_SIZE;
+		queueCount--;
+		return true;
+	}
+
+	// The ROMs used with the TI speech were serial, not byte wide, so are bit reversed
+	static uint8_t rev(uint8_t a)
+	{
+		a = (a >> 4) | (a << 4);
+		a = ((a & 0xcc) >> 2) | ((a & 0x33) << 2);
+		a = ((a & 0xaa) >> 1) | ((a & 0x55) << 1);
+		return a;
+	}
+
+	uint8_t getBits(uint8_t bits)
+	{
+		if (ptrAddr == nullptr) return 0;
+		uint16_t data = rev(*ptrAddr) << 8;
+		if (ptrBit + bits > 8)
+			data |= rev(*(ptrAddr + 1));
+		data <<= ptrBit;
+		uint8_t value = data >> (16 - bits);
+		ptrBit += bits;
+		if (ptrBit >= 8)
+		{
+			ptrBit -= 8;
+			ptrAddr++;
+		}
+		return value;
+	}
+
+	void readFrame()
+	{
+		if (restart)
+		{
+			restart = false;
+			energy = 0;
+			popWord();
+		}
+		else if (energy == STOP_FRAME && popWord())
+		{
+			energy = 0; // resume after stopping
+		}
+		if (energy == STOP_FRAME)
+			return;
+
+		energy = getBits(4);
+		if (energy == STOP_FRAME && popWord())
+			energy = getBits(4); // next queued word starts in this frame slot
+
+		if (energy == 0)
+		{
+			// Rest frame
+			synthEnergy = 0;
+			framePitch = 0;
+		}
+		else if (energy == STOP_FRAME)
+		{
+			// Stop frame: silence the synthesiser
+			synthEnergy = 0;
+			framePitch = 0;
+			for (int i = 1; i <= 10; i++) k[i] = 0;
+		}
+		else
+		{
+			synthEnergy = tmsEnergy[energy];
+			bool repeat = getBits(1);
+			int pitchInd = getBits(6);
+			framePitch = pitchcv[pitchInd];
+			period = tmsPeriod[pitchInd];
+			// A repeat frame uses the last coefficients
+			if (!repeat)
+			{
+				// All frames use the first 4 coefficients
+				k[1] = (int16_t)tmsK1[getBits(5)];
+				k[2] = (int16_t)tmsK2[getBits(5)];
+				k[3] = (int8_t)tmsK3[getBits(4)];
+				k[4] = (int8_t)tmsK4[getBits(4)];
+				if (period)
+				{
+					// Voiced frames use 6 extra coefficients
+					k[5] = (int8_t)tmsK5[getBits(4)];
+					k[6] = (int8_t)tmsK6[getBits(4)];
+					k[7] = (int8_t)tmsK7[getBits(4)];
+					k[8] = (int8_t)tmsK8[getBits(3)];
+					k[9] = (int8_t)tmsK9[getBits(3)];
+					k[10] = (int8_t)tmsK10[getBits(3)];
+				}
+			}
+		}
+	}
+
+	static void numberWords(long n, const NumberWords &nw, LpcWord *w, int &count)
+	{
+		if (n < 0)
+		{
+			w[count++] = nw.minus;
+			n = -n;
+		}
+		if (n == 0)
+		{
+			w[count++] = nw.units[0];
+			return;
+		}
+		if (n >= 1000)
+		{
+			numberWords(n / 1000, nw, w, count);
+			w[count++] = nw.thousand;
+			n %= 1000;
+			if (n > 0 && n < 100) w[count++] = nw.and_;
+		}
+		if (n >= 100)
+		{
+			numberWords(n / 100, nw, w, count);
+			w[count++] = nw.hundred;
+			n %= 100;
+			if (n > 0) w[count++] = nw.and_;
+		}
+		if (n > 19)
+		{
+			w[count++] = nw.tens[n / 10];
+			if (n / 10 != 2) w[count++] = nw.t;
+			n %= 10;
+		}
+		if (n > 0)
+		{
+			w[count++] = nw.units[n];
+			if (n >= 13) w[count++] = nw.teen;
+		}
+	}
+
+	static constexpr uint8_t tmsEnergy[0x10] = {0x00, 0x02, 0x03, 0x04, 0x05, 0x07, 0x0a, 0x0f,
+	                                            0x14, 0x20, 0x29, 0x39, 0x51, 0x72, 0xa1, 0xff};
+	static constexpr uint8_t tmsPeriod[0x40] = {
+		0x00, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+		0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24,
+		0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2D, 0x2F, 0x31, 0x33,
+		0x35, 0x36, 0x39, 0x3B, 0x3D, 0x3F, 0x42, 0x45, 0x47, 0x49, 0x4D,
+		0x4F, 0x51, 0x55, 0x57, 0x5C, 0x5F, 0x63, 0x66, 0x6A, 0x6E, 0x73,
+		0x77, 0x7B, 0x80, 0x85, 0x8A, 0x8F, 0x95, 0x9A, 0xA0};
+	// Pitch CV per pitch index
+	static constexpr int16_t pitchcv[0x40] = {
+		0, 1133, 1104, 1075, 1049, 1023, 999, 977, 955, 934, 914, 894, 876, 858, 841, 824,
+		808, 792, 777, 762, 748, 734, 721, 707, 695, 682, 670, 658, 647, 624, 603, 582,
+		563, 544, 534, 508, 491, 474, 458, 436, 414, 400, 386, 360, 347, 335, 311, 300,
+		272, 256, 236, 221, 202, 184, 162, 145, 129, 109, 91, 72, 55, 35, 18, 0};
+
+	static constexpr uint16_t tmsK1[0x20] = {
+		0x82C0, 0x8380, 0x83C0, 0x8440, 0x84C0, 0x8540, 0x8600, 0x8780,
+		0x8880, 0x8980, 0x8AC0, 0x8C00, 0x8D40, 0x8F00, 0x90C0, 0x92C0,
+		0x9900, 0xA140, 0xAB80, 0xB840, 0xC740, 0xD8C0, 0xEBC0, 0x0000,
+		0x1440, 0x2740, 0x38C0, 0x47C0, 0x5480, 0x5EC0, 0x6700, 0x6D40};
+	static constexpr uint16_t tmsK2[0x20] = {
+		0xAE00, 0xB480, 0xBB80, 0xC340, 0xCB80, 0xD440, 0xDDC0, 0xE780,
+		0xF180, 0xFBC0, 0x0600, 0x1040, 0x1A40, 0x2400, 0x2D40, 0x3600,
+		0x3E40, 0x45C0, 0x4CC0, 0x5300, 0x5880, 0x5DC0, 0x6240, 0x6640,
+		0x69C0, 0x6CC0, 0x6F80, 0x71C0, 0x73C0, 0x7580, 0x7700, 0x7E80};
+	static constexpr uint8_t tmsK3[0x10] = {0x92, 0x9F, 0xAD, 0xBA, 0xC8, 0xD5, 0xE3, 0xF0,
+	                                        0xFE, 0x0B, 0x19, 0x26, 0x34, 0x41, 0x4F, 0x5C};
+	static constexpr uint8_t tmsK4[0x10] = {0xAE, 0xBC, 0xCA, 0xD8, 0xE6, 0xF4, 0x01, 0x0F,
+	                                        0x1D, 0x2B, 0x39, 0x47, 0x55, 0x63, 0x71, 0x7E};
+	static constexpr uint8_t tmsK5[0x10] = {0xAE, 0xBA, 0xC5, 0xD1, 0xDD, 0xE8, 0xF4, 0xFF,
+	                                        0x0B, 0x17, 0x22, 0x2E, 0x39, 0x45, 0x51, 0x5C};
+	static constexpr uint8_t tmsK6[0x10] = {0xC0, 0xCB, 0xD6, 0xE1, 0xEC, 0xF7, 0x03, 0x0E,
+	                                        0x19, 0x24, 0x2F, 0x3A, 0x45, 0x50, 0x5B, 0x66};
+	static constexpr uint8_t tmsK7[0x10] = {0xB3, 0xBF, 0xCB, 0xD7, 0xE3, 0xEF, 0xFB, 0x07,
+	                                        0x13, 0x1F, 0x2B, 0x37, 0x43, 0x4F, 0x5A, 0x66};
+	static constexpr uint8_t tmsK8[0x08] = {0xC0, 0xD8, 0xF0, 0x07, 0x1F, 0x37, 0x4F, 0x66};
+	static constexpr uint8_t tmsK9[0x08] = {0xC0, 0xD4, 0xE8, 0xFC, 0x10, 0x25, 0x39, 0x4D};
+	static constexpr uint8_t tmsK10[0x08] = {0xCD, 0xDF, 0xF1, 0x04, 0x16, 0x20, 0x3B, 0x4D};
+	static constexpr uint8_t chirp[CHIRP_SIZE] = {
+		0x00, 0x2a, 0xd4, 0x32, 0xb2, 0x12, 0x25, 0x14, 0x02, 0xe1, 0xc5,
+		0x02, 0x5f, 0x5a, 0x05, 0x0f, 0x26, 0xfc, 0xa5, 0xa5, 0xd6, 0xdd,
+		0xdc, 0xfc, 0x25, 0x2b, 0x22, 0x21, 0x0f, 0xff, 0xf8, 0xee, 0xed,
+		0xef, 0xf7, 0xf6, 0xfa, 0x00, 0x03, 0x02, 0x01};
+};
@@ -0,0 +1,153 @@
+// TalkerStream - the Talker card's voice, rendered a block at a time
+//
+// Everything the card used to do per sample in ProcessSample(), apart from reading and
+// writing the jacks: frame clock, pitch ramp, babbling and CV smoothing. The audio
+// interrupt records its inputs as TalkerControl frames; core 1 turns a block of them
+// into TalkerOutput frames ahead of time (see main.cpp). Rendering is sample-by-sample
+// identical to doing the same work in the interrupt.
+
+#pragma once
+
+#include <cstdint>
+#include "LpcSynth.h"
+#include "VocabBank.h"
+
+// One audio sample's worth of inputs
+struct TalkerControl
+{
+	enum Flags : uint8_t
+	{
+		Trigger = 1,    // say a new number now (switch pulled down / pulse in 1)
+		Continuous = 2, // switch up: keep a number queued behind the current one
+		Tone = 4,       // audio in 1 connected: tone replaces the pitched exciter
+		Select = 8,     // audio in 2 connected: say word `select` of the bank, not numbers
+		NextBank = 16,  // step to the next vocabulary bank (pulse in 2)
+	};
+	int16_t incr;      // pitch ramp increment, 8192 = one LPC sample per audio sample
+	int16_t frameIncr; // frame clock increment, 10000 = one subframe per audio sample
+	int16_t tone;      // audio in 1
+	int16_t select;    // audio in 2: -2048..2047 across the bank's words
+	uint8_t flags;
+};
+
+// One audio sample's worth of outputs
+struct TalkerOutput
+{
+	enum Flags : uint8_t
+	{
+		PhraseStart = 1, // a number (or selected word) started speaking on this sample
+	};
+	int16_t speech;  // 16-bit speech
+	int16_t exciter; // 12-bit exciter, before any tone replacement
+	int16_t energy;  // smoothed exciter amplitude CV
+	int16_t pitch;   // exciter pitch CV
+	uint8_t flags;
+};
+
+class TalkerStream
+{
+public:
+	// banks[0] must hold the number words (the built-in VM61002 bank does); any others are
+	// extra vocabularies for word selection
+	TalkerStream(const VocabBank *banks, int numBanks)
+		: banks(banks), numBanks(numBanks), numbers(NumberWordsFrom(banks[0]))
+	{
+		voice.interrupt();
+		voice.sayNumber(RandomDigit(), numbers);
+	}
+
+	// The number words, looked up by name in a bank with the VM61002 ROM's words
+	static NumberWords NumberWordsFrom(const VocabBank &b)
+	{
+		static const char *const units[20] = {
+			"ZERO", "ONE", "TWO", "THREE", "FOUR", "FIVE", "SIX", "SEVEN", "EIGHT", "NINE",
+			"TEN", "ELEVEN", "TWELVE", "THIR_", "FOUR", "FIF_", "SIX", "SEVEN", "EIGHT", "NINE"};
+		static const char *const tens[10] = {
+			"", "", "TWENTY", "THIR_", "FOUR", "FIF_", "SIX", "SEVEN", "EIGHT", "NINE"};
+		NumberWords nw;
+		for (int i = 0; i < 20; i++) nw.units[i] = b.Word(b.Find(units[i]));
+		for (int i = 2; i < 10; i++) nw.tens[i] = b.Word(b.Find(tens[i]));
+		nw.minus = b.Word(b.Find("MINUS"));
+		nw.thousand = b.Word(b.Find("THOUSAND"));
+		nw.hundred = b.Word(b.Find("HUNDRED"));
+		nw.and_ = b.Word(b.Find("AND"));
+		nw.t = b.Word(b.Find("T"));
+		nw.teen = b.Word(b.Find("_TEEN"));
+		return nw;
+	}
+
+	int Bank() const { return bank; }
+
+	void render(const TalkerControl *in, TalkerOutput *out, int n)
+	{
+		for (int i = 0; i < n; i++)
+		{
+			const TalkerControl &c = in[i];
+			sampleRamp += c.incr;
+
+			voice.tick(c.frameIncr);
+			cvenergy2 = (15 * cvenergy2 + (voice.energyOut() << 3)) >> 4;
+
+			if (c.flags & TalkerControl::NextBank)
+				bank = (bank + 1) % numBanks;
+			if (c.flags & TalkerControl::Trigger)
+			{
+				voice.interrupt();
+				SayNext(c);
+			}
+			else if ((c.flags & TalkerControl::Continuous) && voice.queued() == 0)
+			{
+				// Queue the next number while this one plays, so it follows on without a gap
+				SayNext(c);
+			}
+
+			if (sampleRamp > 8192) // Each new sample
+			{
+				sampleRamp -= 8192;
+				sample = voice.sample(c.flags & TalkerControl::Tone, c.tone, exciter);
+			}
+
+			TalkerOutput &o = out[i];
+			o.speech = sample;
+			o.exciter = exciter;
+			o.energy = cvenergy2;
+			o.pitch = voice.pitchOut();
+			o.flags = voice.phraseStarted ? TalkerOutput::PhraseStart : 0;
+			voice.phraseStarted = false;
+		}
+	}
+
+private:
+	void SayNext(const TalkerControl &c)
+	{
+		if (c.flags & TalkerControl::Select)
+		{
+			const VocabBank &b = banks[bank];
+			int v = c.select + 2048;
+			if (v < 0) v = 0;
+			if (v > 4095) v = 4095;
+			voice.say(b.Word((v * b.NumWords()) >> 12));
+		}
+		else
+		{
+			voice.sayNumber(RandomDigit(), numbers);
+		}
+	}
+
+	int RandomDigit()
+	{
+		// Random number up to 2^32-1 divided down to get digits 0-9
+		lcg_seed = 1664525 * lcg_seed + 1013904223;
+		return lcg_seed / 429496730;
+	}
+
+	const VocabBank *banks;
+	int numBanks;
+	int bank = 0;
+	NumberWords numbers;
+	LpcSynth voice;
+	uint32_t lcg_seed = 1;
+	int sampleRamp = 0;
+	int16_t sample = 0, exciter = 0;
+	int32_t cvenergy2 = 0;
+};
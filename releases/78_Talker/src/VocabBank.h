@@ -0,0 +1,128 @@
+// VocabBank - a packed LPC vocabulary, as built by tools/vocab_pack.py
+//
+// The bank is used where it lies (the built-in bank in the firmware image, or banks
+// uploaded to the end of flash): nothing is copied at load, and words are reached by
+// ordinal (CV / MIDI selection) or by name through the bank's hash index, both O(1).
+// The format is described at the top of tools/vocab_pack.py.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include "LpcSynth.h"
+
+class VocabBank
+{
+public:
+	static constexpr uint32_t MAGIC = 0x42564B54; // "TKVB"
+	static constexpr uint16_t VERSION = 1;
+
+	// Check the image and use it; false (and an empty bank) if it isn't a bank, or
+	// claims to be bigger than maxSize
+	bool Load(const uint8_t *image, uint32_t maxSize = 0xFFFFFFFF)
+	{
+		base = nullptr;
+		if (!image)
+			return false;
+		hdr = reinterpret_cast<const Header *>(image);
+		if (hdr->magic != MAGIC || hdr->version != VERSION)
+			return false;
+		if (hdr->bucketBits < 1 || hdr->bucketBits > 16)
+			return false;
+		uint32_t buckets = (1u << hdr->bucketBits) + 1;
+		if (hdr->size > maxSize || hdr->wordCount == 0
+			|| hdr->wordsOffset + 12u * hdr->wordCount > hdr->size
+			|| hdr->indexOffset + 8u * hdr->wordCount > hdr->size
+			|| hdr->bucketsOffset + 2u * buckets > hdr->size)
+			return false;
+		base = image;
+		words = reinterpret_cast<const Entry *>(base + hdr->wordsOffset);
+		index = reinterpret_cast<const IndexEntry *>(base + hdr->indexOffset);
+		bucket = reinterpret_cast<const uint16_t *>(base + hdr->bucketsOffset);
+		return true;
+	}
+
+	bool Valid() const { return base != nullptr; }
+	int NumWords() const { return base ? hdr->wordCount : 0; }
+	uint32_t Size() const { return base ? hdr->size : 0; }
+	const char *Name() const { return base ? hdr->name : ""; }
+
+	LpcWord Word(int i) const
+	{
+		if (!base || i < 0 || i >= hdr->wordCount) return LpcWord();
+		return LpcWord{base + words[i].dataOffset, words[i].dataBytes};
+	}
+
+	const char *WordName(int i) const
+	{
+		if (!base || i < 0 || i >= hdr->wordCount) return "";
+		return reinterpret_cast<const char *>(base + words[i].nameOffset);
+	}
+
+	// Ordinal of the word called name (any case), or -1
+	int Find(const char *name) const
+	{
+		if (!base) return -1;
+		uint32_t h = Hash(name);
+		uint32_t b = h >> (32 - hdr->bucketBits);
+		for (uint32_t i = bucket[b]; i < bucket[b + 1]; i++)
+		{
+			if (index[i].hash != h) continue;
+			if (SameName(WordName(index[i].word), name))
+				return index[i].word;
+		}
+		return -1;
+	}
+
+	LpcWord Find(const char *name, const VocabBank &fallback) const
+	{
+		int i = Find(name);
+		return i >= 0 ? Word(i) : fallback.Word(fallback.Find(name));
+	}
+
+	// 32-bit FNV-1a over the upper-cased name, as the tool hashes it
+	static uint32_t Hash(const char *name)
+	{
+		uint32_t h = 0x811C9DC5;
+		for (; *name; name++)
+			h = (h ^ (uint8_t)Upper(*name)) * 0x01000193;
+		return h;
+	}
+
+private:
+	struct Header
+	{
+		uint32_t magic;
+		uint16_t version, wordCount;
+		uint32_t size;
+		uint16_t bucketBits, maxWordBytes;
+		uint32_t wordsOffset, indexOffset, bucketsOffset;
+		char name[16];
+	};
+	struct Entry
+	{
+		uint32_t dataOffset, nameOffset;
+		uint16_t dataBytes, reserved;
+	};
+	struct IndexEntry
+	{
+		uint32_t hash;
+		uint16_t word, reserved;
+	};
+	static_assert(sizeof(Header) == 44 && sizeof(Entry) == 12 && sizeof(IndexEntry) == 8,
+	              "bank layout");
+
+	static char Upper(char c) { return (c >= 'a' && c <= 'z') ? c - 32 : c; }
+
+	static bool SameName(const char *stored, const char *name)
+	{
+		while (*stored && *stored == Upper(*name)) stored++, name++;
+		return *stored == 0 && *name == 0;
+	}
+
+	const uint8_t *base = nullptr;
+	const Header *hdr = nullptr;
+	const Entry *words = nullptr;
+	const IndexEntry *index = nullptr;
+	const uint16_t *bucket = nullptr;
+};
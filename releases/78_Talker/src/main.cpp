@@ -1,51 +1,131 @@
 #include "ComputerCard.h"
-#include "TalkiePCM.h"
+#include "pico/multicore.h"
+#include "TalkerStream.h"
+#include "VocabBank.h"
+#include "vocab_builtin.h"
 
 #include <cstdlib> // for abs
 
+// Single-producer single-consumer ring of frames between the two cores. N is a power of two.
+template <typename T, uint32_t N>
+class FrameRing
+{
+	T buf[N];
+	volatile uint32_t head = 0, tail = 0; // written only by the producer / consumer
+
+public:
+	uint32_t count() const { return head - tail; }
+	uint32_t space() const { return N - (head - tail); }
+
+	bool push(const T &v)
+	{
+		uint32_t h = head;
+		if (h - tail == N) return false;
+		buf[h & (N - 1)] = v;
+		__dmb(); // frame contents visible before the new head
+		head = h + 1;
+		return true;
+	}
+
+	bool pop(T &v)
+	{
+		uint32_t t = tail;
+		if (head == t) return false;
+		__dmb(); // read the frame after seeing the head that published it
+		v = buf[t & (N - 1)];
+		__dmb();
+		tail = t + 1;
+		return true;
+	}
+};
+
 class TalkiePCMCard : public ComputerCard
 {
+	// Core 1 renders BLOCK samples at a time. The output ring starts LEAD frames ahead of
+	// the audio interrupt, so inputs reach the outputs LEAD samples (0.7ms) later.
+	static constexpr int BLOCK = 16;
+	static constexpr int LEAD = 32;
+	static constexpr int MAX_BANKS = 16;
+
 public:
-	TalkiePCMCard()
+	TalkiePCMCard() : numBanks(LoadBanks()), stream(banks, numBanks)
+	{
+		lastOut = {};
+		for (int i = 0; i < LEAD; i++) outputs.push(lastOut);
+		multicore_launch_core1(core1);
+	}
+
+	// Boilerplate to call member function as second core
+	static void core1()
 	{
-		sampleRamp = 0;
-		sample = 0;
-		voice.sayNumber(RandomDigit());
+		((TalkiePCMCard *)ThisPtr())->SpeechCore();
+	}
+
+	// Second core: speech synthesis, a block at a time, as inputs arrive
+	void SpeechCore()
+	{
+		TalkerControl in[BLOCK];
+		TalkerOutput out[BLOCK];
+		while (1)
+		{
+			if (controls.count() < BLOCK || outputs.space() < BLOCK)
+				continue;
+			for (int i = 0; i < BLOCK; i++) controls.pop(in[i]);
+			stream.render(in, out, BLOCK);
+			for (int i = 0; i < BLOCK; i++) outputs.push(out[i]);
+		}
 	}
 
-	int16_t cvenergy, cvpitch;
-	int32_t cvenergy2, cvpitch2;
-	
 	virtual void ProcessSample()
 	{
 		Switch s = SwitchVal();
-		
+		TalkerControl c;
+
 		// Filter speed (pitch) set by CV 1 with knob X as attenuverter, added to main knob
 		int incr = KnobVal(Knob::Main) + (CVIn1() * (KnobVal(Knob::X)-2048) >> 11);
 		if (incr<0) incr = 0;
-		sampleRamp += incr;
+		c.incr = incr;
 
 		// Frame speed (speaking speed) set by Knob Y + CV 2
 		int frameIncr = (KnobVal(Knob::Y)>>3) + (CVIn2()>>3);
 		if (frameIncr<0) frameIncr = 0;
-		bool finished = voice.calculateNextFrame(frameIncr,cvenergy, cvpitch);
-
-		cvenergy2 = (15*int32_t(cvenergy2) + (cvenergy<<3))>>4;
-		cvpitch2 = (15*int32_t(cvpitch2) + cvpitch)>>4;
-		CVOut1(cvenergy2);
-		CVOut2(cvpitch);
-		// If: word has finished and switch up,
-		//     or switch pulled down,
-		//     or rising edge on pulse 1,
-		//  then say a new digit
-		if ((finished && s == Switch::Up)
-			|| (s == Switch::Down && lasts != Switch::Down)
-			|| PulseIn1RisingEdge())
+		c.frameIncr = frameIncr;
+
+		// Audio in 1, if plugged in, replaces the pitched part of the exciter
+		c.tone = AudioIn1();
+		c.flags = Connected(Input::Audio1) ? TalkerControl::Tone : 0;
+
+		// Audio in 2, if plugged in, picks the word to say from the current bank;
+		// pulse in 2 steps through the banks
+		c.select = AudioIn2();
+		if (Connected(Input::Audio2))
+			c.flags |= TalkerControl::Select;
+		if (PulseIn2RisingEdge())
+			c.flags |= TalkerControl::NextBank;
+
+		// Switch up: babble continuously
+		// Switch pulled down, or rising edge on pulse 1: say a new digit now
+		if (s == Switch::Up)
+			c.flags |= TalkerControl::Continuous;
+		if ((s == Switch::Down && lasts != Switch::Down) || PulseIn1RisingEdge())
+			c.flags |= TalkerControl::Trigger;
+		lasts = s;
+
+		controls.push(c);
+
+		// Take the next rendered sample; if core 1 has fallen behind, hold the last one
+		TalkerOutput o;
+		if (outputs.pop(o))
+			lastOut = o;
+		else
+			o = lastOut;
+
+		CVOut1(o.energy);
+		CVOut2(o.pitch);
+
+		// Each number that starts speaking: pulse on Pulse out 1 and LED 1
+		if (o.flags & TalkerOutput::PhraseStart)
 		{
-			// Say the new digit
-			voice.sayNumber(RandomDigit());
-			
-			// Start a new pulse on Pulse out 1 and LED 1
 			pulseTimer=100; // 100 is ~2ms, enough to trigger Slopes
 			PulseOut1(true);
 			LedOn(1, true);
@@ -61,39 +141,47 @@ public:
 				LedOn(1, false);
 			}
 		}
-		
-		int16_t preFilterOutput;
-		if (sampleRamp>8192) // Each new sample
-		{
-			sampleRamp-=8192;
 
-			// Calculate new sample
-			sample = voice.calculateNextSample(Connected(Input::Audio1), AudioIn1(), preFilterOutput);
-			
-			// Light LED 0 according to signal
-			LedBrightness(0, abs(sample)<<1);
-		}
+		// Light LED 0 according to signal
+		LedBrightness(0, abs(o.speech)<<1);
 
 		// Play the last sample through audio out, no fancy interpolation
-		AudioOut1(sample>>4);
-		AudioOut2(preFilterOutput<<4);
-		lasts = s;
+		AudioOut1(o.speech>>4);
+		AudioOut2(o.exciter<<4);
 	}
-	
+
 private:
-	int RandomDigit()
+	// Vocabulary banks: the built-in one, then any uploaded to the end of flash by a UF2
+	// from tools/vocab_pack.py (same layout as the sample_upload example: the last 256
+	// bytes of flash hold the address of the first bank and the number of banks)
+	int LoadBanks()
 	{
-		// Random number up to 2^32-1 divided down to get digits 0-9
-		static uint32_t lcg_seed = 1;
-		lcg_seed = 1664525 * lcg_seed + 1013904223;
-		return lcg_seed/429496730;
+		banks[0].Load(VOCAB_BUILTIN);
+		int n = 1;
+
+		const uint32_t *dir = (const uint32_t *)(XIP_BASE + PICO_FLASH_SIZE_BYTES - 256);
+		uint32_t addr = dir[0], count = dir[1];
+		const uint32_t flashEnd = XIP_BASE + PICO_FLASH_SIZE_BYTES - 256;
+		if (count == 0 || count >= MAX_BANKS || addr < XIP_BASE || addr >= flashEnd)
+			return n;
+		for (uint32_t i = 0; i < count && addr < flashEnd; i++)
+		{
+			if (!banks[n].Load((const uint8_t *)addr, flashEnd - addr))
+				break;
+			addr += banks[n].Size();
+			n++;
+		}
+		return n;
 	}
-	
-	TalkiePCM voice;
-	int sampleRamp;
-	int16_t sample;
-	int pulseTimer;
-	Switch lasts;
+
+	VocabBank banks[MAX_BANKS];
+	int numBanks;
+	TalkerStream stream;
+	FrameRing<TalkerControl, 64> controls;
+	FrameRing<TalkerOutput, 64> outputs;
+	TalkerOutput lastOut;
+	int pulseTimer = 0;
+	Switch lasts = Switch::Middle;
 };
 
 
@@ -105,4 +193,4 @@ int main()
 	tpcm.Run();
 }
 
-  
+
@@ -0,0 +1,1361 @@
+// Generated by tools/vocab_pack.py - do not edit. Regenerate with:
+// python3 tools/vocab_pack.py --header src/vocab_builtin.h VM61002=vocab/Vocab_US_Large.h:sp2_ VM61002=vocab/Vocab_Special.h
+//
+// Bank VM61002, 21588 bytes (format: tools/vocab_pack.py, read by VocabBank.h)
+
+#pragma once
+
+#include <cstdint>
+
+alignas(4) static const uint8_t VOCAB_BUILTIN[21588] = {
+	0x54,0x4B,0x56,0x42,0x01,0x00,0xD0,0x00,0x54,0x54,0x00,0x00,0x08,0x00,0x96,0x00,
+	0x2C,0x00,0x00,0x00,0xEC,0x09,0x00,0x00,0x6C,0x10,0x00,0x00,0x56,0x4D,0x36,0x31,
+	0x30,0x30,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF1,0x16,0x00,0x00,
+	0x6E,0x12,0x00,0x00,0x4D,0x00,0x00,0x00,0x3E,0x17,0x00,0x00,0x73,0x12,0x00,0x00,
+	0x43,0x00,0x00,0x00,0x81,0x17,0x00,0x00,0x77,0x12,0x00,0x00,0x37,0x00,0x00,0x00,
+	0xB8,0x17,0x00,0x00,0x7B,0x12,0x00,0x00,0x4C,0x00,0x00,0x00,0x04,0x18,0x00,0x00,
+	0x81,0x12,0x00,0x00,0x4C,0x00,0x00,0x00,0x50,0x18,0x00,0x00,0x86,0x12,0x00,0x00,
+	0x53,0x00,0x00,0x00,0xA3,0x18,0x00,0x00,0x8B,0x12,0x00,0x00,0x32,0x00,0x00,0x00,
+	0xD5,0x18,0x00,0x00,0x8F,0x12,0x00,0x00,0x4A,0x00,0x00,0x00,0x1F,0x19,0x00,0x00,
+	0x95,0x12,0x00,0x00,0x33,0x00,0x00,0x00,0x52,0x19,0x00,0x00,0x9B,0x12,0x00,0x00,
+	0x58,0x00,0x00,0x00,0xAA,0x19,0x00,0x00,0xA0,0x12,0x00,0x00,0x36,0x00,0x00,0x00,
+	0xE0,0x19,0x00,0x00,0xA4,0x12,0x00,0x00,0x68,0x00,0x00,0x00,0x48,0x1A,0x00,0x00,
+	0xAB,0x12,0x00,0x00,0x49,0x00,0x00,0x00,0x91,0x1A,0x00,0x00,0xB2,0x12,0x00,0x00,
+	0x38,0x00,0x00,0x00,0xC9,0x1A,0x00,0x00,0xB8,0x12,0x00,0x00,0x26,0x00,0x00,0x00,
+	0xEF,0x1A,0x00,0x00,0xBD,0x12,0x00,0x00,0x36,0x00,0x00,0x00,0x25,0x1B,0x00,0x00,
+	0xC3,0x12,0x00,0x00,0x4C,0x00,0x00,0x00,0x71,0x1B,0x00,0x00,0xCA,0x12,0x00,0x00,
+	0x57,0x00,0x00,0x00,0xC8,0x1B,0x00,0x00,0xD2,0x12,0x00,0x00,0x79,0x00,0x00,0x00,
+	0x41,0x1C,0x00,0x00,0xDB,0x12,0x00,0x00,0x2E,0x00,0x00,0x00,0x6F,0x1C,0x00,0x00,
+	0xDD,0x12,0x00,0x00,0x32,0x00,0x00,0x00,0xA1,0x1C,0x00,0x00,0xDF,0x12,0x00,0x00,
+	0x42,0x00,0x00,0x00,0xE3,0x1C,0x00,0x00,0xE1,0x12,0x00,0x00,0x34,0x00,0x00,0x00,
+	0x17,0x1D,0x00,0x00,0xE3,0x12,0x00,0x00,0x36,0x00,0x00,0x00,0x4D,0x1D,0x00,0x00,
+	0xE5,0x12,0x00,0x00,0x3A,0x00,0x00,0x00,0x87,0x1D,0x00,0x00,0xE7,0x12,0x00,0x00,
+	0x3E,0x00,0x00,0x00,0xC5,0x1D,0x00,0x00,0xE9,0x12,0x00,0x00,0x3B,0x00,0x00,0x00,
+	0x00,0x1E,0x00,0x00,0xEB,0x12,0x00,0x00,0x42,0x00,0x00,0x00,0x42,0x1E,0x00,0x00,
+	0xED,0x12,0x00,0x00,0x3F,0x00,0x00,0x00,0x81,0x1E,0x00,0x00,0xEF,0x12,0x00,0x00,
+	0x43,0x00,0x00,0x00,0xC4,0x1E,0x00,0x00,0xF1,0x12,0x00,0x00,0x41,0x00,0x00,0x00,
+	0x05,0x1F,0x00,0x00,0xF3,0x12,0x00,0x00,0x3F,0x00,0x00,0x00,0x44,0x1F,0x00,0x00,
+	0xF5,0x12,0x00,0x00,0x40,0x00,0x00,0x00,0x84,0x1F,0x00,0x00,0xF7,0x12,0x00,0x00,
+	0x2E,0x00,0x00,0x00,0xB2,0x1F,0x00,0x00,0xF9,0x12,0x00,0x00,0x36,0x00,0x00,0x00,
+	0xE8,0x1F,0x00,0x00,0xFB,0x12,0x00,0x00,0x34,0x00,0x00,0x00,0x1C,0x20,0x00,0x00,
+	0xFD,0x12,0x00,0x00,0x2C,0x00,0x00,0x00,0x48,0x20,0x00,0x00,0xFF,0x12,0x00,0x00,
+	0x30,0x00,0x00,0x00,0x78,0x20,0x00,0x00,0x01,0x13,0x00,0x00,0x3A,0x00,0x00,0x00,
+	0xB2,0x20,0x00,0x00,0x03,0x13,0x00,0x00,0x3E,0x00,0x00,0x00,0xF0,0x20,0x00,0x00,
+	0x05,0x13,0x00,0x00,0x54,0x00,0x00,0x00,0x44,0x21,0x00,0x00,0x07,0x13,0x00,0x00,
+	0x66,0x00,0x00,0x00,0xAA,0x21,0x00,0x00,0x09,0x13,0x00,0x00,0x39,0x00,0x00,0x00,
+	0xE3,0x21,0x00,0x00,0x0B,0x13,0x00,0x00,0x42,0x00,0x00,0x00,0x25,0x22,0x00,0x00,
+	0x0D,0x13,0x00,0x00,0x3C,0x00,0x00,0x00,0x61,0x22,0x00,0x00,0x0F,0x13,0x00,0x00,
+	0x41,0x00,0x00,0x00,0xA2,0x22,0x00,0x00,0x15,0x13,0x00,0x00,0x5D,0x00,0x00,0x00,
+	0xFF,0x22,0x00,0x00,0x1B,0x13,0x00,0x00,0x51,0x00,0x00,0x00,0x50,0x23,0x00,0x00,
+	0x23,0x13,0x00,0x00,0x53,0x00,0x00,0x00,0xA3,0x23,0x00,0x00,0x29,0x13,0x00,0x00,
+	0x42,0x00,0x00,0x00,0xE5,0x23,0x00,0x00,0x2E,0x13,0x00,0x00,0x6F,0x00,0x00,0x00,
+	0x54,0x24,0x00,0x00,0x36,0x13,0x00,0x00,0x38,0x00,0x00,0x00,0x8C,0x24,0x00,0x00,
+	0x3B,0x13,0x00,0x00,0x50,0x00,0x00,0x00,0xDC,0x24,0x00,0x00,0x41,0x13,0x00,0x00,
+	0x54,0x00,0x00,0x00,0x30,0x25,0x00,0x00,0x47,0x13,0x00,0x00,0x66,0x00,0x00,0x00,
+	0x96,0x25,0x00,0x00,0x4E,0x13,0x00,0x00,0x4F,0x00,0x00,0x00,0xE5,0x25,0x00,0x00,
+	0x53,0x13,0x00,0x00,0x49,0x00,0x00,0x00,0x2E,0x26,0x00,0x00,0x58,0x13,0x00,0x00,
+	0x42,0x00,0x00,0x00,0x70,0x26,0x00,0x00,0x5D,0x13,0x00,0x00,0x77,0x00,0x00,0x00,
+	0xE7,0x26,0x00,0x00,0x66,0x13,0x00,0x00,0x53,0x00,0x00,0x00,0x3A,0x27,0x00,0x00,
+	0x6C,0x13,0x00,0x00,0x42,0x00,0x00,0x00,0x7C,0x27,0x00,0x00,0x71,0x13,0x00,0x00,
+	0x47,0x00,0x00,0x00,0xC3,0x27,0x00,0x00,0x78,0x13,0x00,0x00,0x60,0x00,0x00,0x00,
+	0x23,0x28,0x00,0x00,0x7E,0x13,0x00,0x00,0x57,0x00,0x00,0x00,0x7A,0x28,0x00,0x00,
+	0x85,0x13,0x00,0x00,0x58,0x00,0x00,0x00,0xD2,0x28,0x00,0x00,0x8B,0x13,0x00,0x00,
+	0x7E,0x00,0x00,0x00,0x50,0x29,0x00,0x00,0x93,0x13,0x00,0x00,0x57,0x00,0x00,0x00,
+	0xA7,0x29,0x00,0x00,0x9A,0x13,0x00,0x00,0x59,0x00,0x00,0x00,0x00,0x2A,0x00,0x00,
+	0xA1,0x13,0x00,0x00,0x64,0x00,0x00,0x00,0x64,0x2A,0x00,0x00,0xA6,0x13,0x00,0x00,
+	0x63,0x00,0x00,0x00,0xC7,0x2A,0x00,0x00,0xAD,0x13,0x00,0x00,0x49,0x00,0x00,0x00,
+	0x10,0x2B,0x00,0x00,0xB2,0x13,0x00,0x00,0x6A,0x00,0x00,0x00,0x7A,0x2B,0x00,0x00,
+	0xB8,0x13,0x00,0x00,0x5D,0x00,0x00,0x00,0xD7,0x2B,0x00,0x00,0xBE,0x13,0x00,0x00,
+	0x61,0x00,0x00,0x00,0x38,0x2C,0x00,0x00,0xC5,0x13,0x00,0x00,0x5B,0x00,0x00,0x00,
+	0x93,0x2C,0x00,0x00,0xCB,0x13,0x00,0x00,0x37,0x00,0x00,0x00,0xCA,0x2C,0x00,0x00,
+	0xCF,0x13,0x00,0x00,0x3B,0x00,0x00,0x00,0x05,0x2D,0x00,0x00,0xD4,0x13,0x00,0x00,
+	0x57,0x00,0x00,0x00,0x5C,0x2D,0x00,0x00,0xD8,0x13,0x00,0x00,0x53,0x00,0x00,0x00,
+	0xAF,0x2D,0x00,0x00,0xDD,0x13,0x00,0x00,0x2F,0x00,0x00,0x00,0xDE,0x2D,0x00,0x00,
+	0xE0,0x13,0x00,0x00,0x7E,0x00,0x00,0x00,0x5C,0x2E,0x00,0x00,0xEA,0x13,0x00,0x00,
+	0x5C,0x00,0x00,0x00,0xB8,0x2E,0x00,0x00,0xF2,0x13,0x00,0x00,0x44,0x00,0x00,0x00,
+	0xFC,0x2E,0x00,0x00,0xF8,0x13,0x00,0x00,0x4E,0x00,0x00,0x00,0x4A,0x2F,0x00,0x00,
+	0xFF,0x13,0x00,0x00,0x74,0x00,0x00,0x00,0xBE,0x2F,0x00,0x00,0x09,0x14,0x00,0x00,
+	0x3C,0x00,0x00,0x00,0xFA,0x2F,0x00,0x00,0x0E,0x14,0x00,0x00,0x46,0x00,0x00,0x00,
+	0x40,0x30,0x00,0x00,0x15,0x14,0x00,0x00,0x5B,0x00,0x00,0x00,0x9B,0x30,0x00,0x00,
+	0x1D,0x14,0x00,0x00,0x69,0x00,0x00,0x00,0x04,0x31,0x00,0x00,0x24,0x14,0x00,0x00,
+	0x34,0x00,0x00,0x00,0x38,0x31,0x00,0x00,0x2A,0x14,0x00,0x00,0x5B,0x00,0x00,0x00,
+	0x93,0x31,0x00,0x00,0x32,0x14,0x00,0x00,0x3E,0x00,0x00,0x00,0xD1,0x31,0x00,0x00,
+	0x38,0x14,0x00,0x00,0x6A,0x00,0x00,0x00,0x3B,0x32,0x00,0x00,0x41,0x14,0x00,0x00,
+	0x4D,0x00,0x00,0x00,0x88,0x32,0x00,0x00,0x49,0x14,0x00,0x00,0x67,0x00,0x00,0x00,
+	0xEF,0x32,0x00,0x00,0x51,0x14,0x00,0x00,0x54,0x00,0x00,0x00,0x43,0x33,0x00,0x00,
+	0x57,0x14,0x00,0x00,0x4E,0x00,0x00,0x00,0x91,0x33,0x00,0x00,0x5D,0x14,0x00,0x00,
+	0x53,0x00,0x00,0x00,0xE4,0x33,0x00,0x00,0x64,0x14,0x00,0x00,0x96,0x00,0x00,0x00,
+	0x7A,0x34,0x00,0x00,0x6C,0x14,0x00,0x00,0x4E,0x00,0x00,0x00,0xC8,0x34,0x00,0x00,
+	0x73,0x14,0x00,0x00,0x6E,0x00,0x00,0x00,0x36,0x35,0x00,0x00,0x7D,0x14,0x00,0x00,
+	0x5B,0x00,0x00,0x00,0x91,0x35,0x00,0x00,0x85,0x14,0x00,0x00,0x41,0x00,0x00,0x00,
+	0xD2,0x35,0x00,0x00,0x8A,0x14,0x00,0x00,0x71,0x00,0x00,0x00,0x43,0x36,0x00,0x00,
+	0x96,0x14,0x00,0x00,0x34,0x00,0x00,0x00,0x77,0x36,0x00,0x00,0x9C,0x14,0x00,0x00,
+	0x52,0x00,0x00,0x00,0xC9,0x36,0x00,0x00,0xA2,0x14,0x00,0x00,0x4E,0x00,0x00,0x00,
+	0x17,0x37,0x00,0x00,0xA7,0x14,0x00,0x00,0x45,0x00,0x00,0x00,0x5C,0x37,0x00,0x00,
+	0xAC,0x14,0x00,0x00,0x50,0x00,0x00,0x00,0xAC,0x37,0x00,0x00,0xB2,0x14,0x00,0x00,
+	0x4E,0x00,0x00,0x00,0xFA,0x37,0x00,0x00,0xB7,0x14,0x00,0x00,0x3F,0x00,0x00,0x00,
+	0x39,0x38,0x00,0x00,0xBC,0x14,0x00,0x00,0x53,0x00,0x00,0x00,0x8C,0x38,0x00,0x00,
+	0xC1,0x14,0x00,0x00,0x41,0x00,0x00,0x00,0xCD,0x38,0x00,0x00,0xC6,0x14,0x00,0x00,
+	0x6E,0x00,0x00,0x00,0x3B,0x39,0x00,0x00,0xD0,0x14,0x00,0x00,0x30,0x00,0x00,0x00,
+	0x6B,0x39,0x00,0x00,0xD5,0x14,0x00,0x00,0x64,0x00,0x00,0x00,0xCF,0x39,0x00,0x00,
+	0xDD,0x14,0x00,0x00,0x42,0x00,0x00,0x00,0x11,0x3A,0x00,0x00,0xE1,0x14,0x00,0x00,
+	0x49,0x00,0x00,0x00,0x5A,0x3A,0x00,0x00,0xE6,0x14,0x00,0x00,0x4F,0x00,0x00,0x00,
+	0xA9,0x3A,0x00,0x00,0xEC,0x14,0x00,0x00,0x26,0x00,0x00,0x00,0xCF,0x3A,0x00,0x00,
+	0xEF,0x14,0x00,0x00,0x6F,0x00,0x00,0x00,0x3E,0x3B,0x00,0x00,0xF5,0x14,0x00,0x00,
+	0x34,0x00,0x00,0x00,0x72,0x3B,0x00,0x00,0xFB,0x14,0x00,0x00,0x36,0x00,0x00,0x00,
+	0xA8,0x3B,0x00,0x00,0x00,0x15,0x00,0x00,0x5A,0x00,0x00,0x00,0x02,0x3C,0x00,0x00,
+	0x05,0x15,0x00,0x00,0x65,0x00,0x00,0x00,0x67,0x3C,0x00,0x00,0x0B,0x15,0x00,0x00,
+	0x46,0x00,0x00,0x00,0xAD,0x3C,0x00,0x00,0x10,0x15,0x00,0x00,0x71,0x00,0x00,0x00,
+	0x1E,0x3D,0x00,0x00,0x1A,0x15,0x00,0x00,0x73,0x00,0x00,0x00,0x91,0x3D,0x00,0x00,
+	0x23,0x15,0x00,0x00,0x37,0x00,0x00,0x00,0xC8,0x3D,0x00,0x00,0x26,0x15,0x00,0x00,
+	0x3F,0x00,0x00,0x00,0x07,0x3E,0x00,0x00,0x2B,0x15,0x00,0x00,0x50,0x00,0x00,0x00,
+	0x57,0x3E,0x00,0x00,0x31,0x15,0x00,0x00,0x54,0x00,0x00,0x00,0xAB,0x3E,0x00,0x00,
+	0x36,0x15,0x00,0x00,0x30,0x00,0x00,0x00,0xDB,0x3E,0x00,0x00,0x3A,0x15,0x00,0x00,
+	0x5E,0x00,0x00,0x00,0x39,0x3F,0x00,0x00,0x42,0x15,0x00,0x00,0x77,0x00,0x00,0x00,
+	0xB0,0x3F,0x00,0x00,0x49,0x15,0x00,0x00,0x51,0x00,0x00,0x00,0x01,0x40,0x00,0x00,
+	0x51,0x15,0x00,0x00,0x4A,0x00,0x00,0x00,0x4B,0x40,0x00,0x00,0x56,0x15,0x00,0x00,
+	0x4B,0x00,0x00,0x00,0x96,0x40,0x00,0x00,0x5C,0x15,0x00,0x00,0x54,0x00,0x00,0x00,
+	0xEA,0x40,0x00,0x00,0x62,0x15,0x00,0x00,0x39,0x00,0x00,0x00,0x23,0x41,0x00,0x00,
+	0x68,0x15,0x00,0x00,0x3B,0x00,0x00,0x00,0x5E,0x41,0x00,0x00,0x6D,0x15,0x00,0x00,
+	0x50,0x00,0x00,0x00,0xAE,0x41,0x00,0x00,0x73,0x15,0x00,0x00,0x46,0x00,0x00,0x00,
+	0xF4,0x41,0x00,0x00,0x7B,0x15,0x00,0x00,0x45,0x00,0x00,0x00,0x39,0x42,0x00,0x00,
+	0x81,0x15,0x00,0x00,0x5B,0x00,0x00,0x00,0x94,0x42,0x00,0x00,0x86,0x15,0x00,0x00,
+	0x53,0x00,0x00,0x00,0xE7,0x42,0x00,0x00,0x8C,0x15,0x00,0x00,0x4D,0x00,0x00,0x00,
+	0x34,0x43,0x00,0x00,0x90,0x15,0x00,0x00,0x45,0x00,0x00,0x00,0x79,0x43,0x00,0x00,
+	0x94,0x15,0x00,0x00,0x60,0x00,0x00,0x00,0xD9,0x43,0x00,0x00,0x9B,0x15,0x00,0x00,
+	0x2C,0x00,0x00,0x00,0x05,0x44,0x00,0x00,0x9F,0x15,0x00,0x00,0x54,0x00,0x00,0x00,
+	0x59,0x44,0x00,0x00,0xA4,0x15,0x00,0x00,0x3C,0x00,0x00,0x00,0x95,0x44,0x00,0x00,
+	0xA7,0x15,0x00,0x00,0x49,0x00,0x00,0x00,0xDE,0x44,0x00,0x00,0xAC,0x15,0x00,0x00,
+	0x7D,0x00,0x00,0x00,0x5B,0x45,0x00,0x00,0xB5,0x15,0x00,0x00,0x35,0x00,0x00,0x00,
+	0x90,0x45,0x00,0x00,0xB9,0x15,0x00,0x00,0x4B,0x00,0x00,0x00,0xDB,0x45,0x00,0x00,
+	0xBE,0x15,0x00,0x00,0x51,0x00,0x00,0x00,0x2C,0x46,0x00,0x00,0xC3,0x15,0x00,0x00,
+	0x4C,0x00,0x00,0x00,0x78,0x46,0x00,0x00,0xC8,0x15,0x00,0x00,0x52,0x00,0x00,0x00,
+	0xCA,0x46,0x00,0x00,0xD0,0x15,0x00,0x00,0x42,0x00,0x00,0x00,0x0C,0x47,0x00,0x00,
+	0xD6,0x15,0x00,0x00,0x56,0x00,0x00,0x00,0x62,0x47,0x00,0x00,0xDB,0x15,0x00,0x00,
+	0x3C,0x00,0x00,0x00,0x9E,0x47,0x00,0x00,0xE0,0x15,0x00,0x00,0x4F,0x00,0x00,0x00,
+	0xED,0x47,0x00,0x00,0xE6,0x15,0x00,0x00,0x5F,0x00,0x00,0x00,0x4C,0x48,0x00,0x00,
+	0xEF,0x15,0x00,0x00,0x4E,0x00,0x00,0x00,0x9A,0x48,0x00,0x00,0xF5,0x15,0x00,0x00,
+	0x44,0x00,0x00,0x00,0xDE,0x48,0x00,0x00,0xFE,0x15,0x00,0x00,0x43,0x00,0x00,0x00,
+	0x21,0x49,0x00,0x00,0x04,0x16,0x00,0x00,0x4A,0x00,0x00,0x00,0x6B,0x49,0x00,0x00,
+	0x0A,0x16,0x00,0x00,0x3A,0x00,0x00,0x00,0xA5,0x49,0x00,0x00,0x0F,0x16,0x00,0x00,
+	0x30,0x00,0x00,0x00,0xD5,0x49,0x00,0x00,0x14,0x16,0x00,0x00,0x5E,0x00,0x00,0x00,
+	0x33,0x4A,0x00,0x00,0x1A,0x16,0x00,0x00,0x40,0x00,0x00,0x00,0x73,0x4A,0x00,0x00,
+	0x20,0x16,0x00,0x00,0x4F,0x00,0x00,0x00,0xC2,0x4A,0x00,0x00,0x24,0x16,0x00,0x00,
+	0x61,0x00,0x00,0x00,0x23,0x4B,0x00,0x00,0x2B,0x16,0x00,0x00,0x64,0x00,0x00,0x00,
+	0x87,0x4B,0x00,0x00,0x32,0x16,0x00,0x00,0x49,0x00,0x00,0x00,0xD0,0x4B,0x00,0x00,
+	0x38,0x16,0x00,0x00,0x40,0x00,0x00,0x00,0x10,0x4C,0x00,0x00,0x3D,0x16,0x00,0x00,
+	0x6A,0x00,0x00,0x00,0x7A,0x4C,0x00,0x00,0x45,0x16,0x00,0x00,0x56,0x00,0x00,0x00,
+	0xD0,0x4C,0x00,0x00,0x4D,0x16,0x00,0x00,0x3E,0x00,0x00,0x00,0x0E,0x4D,0x00,0x00,
+	0x51,0x16,0x00,0x00,0x37,0x00,0x00,0x00,0x45,0x4D,0x00,0x00,0x56,0x16,0x00,0x00,
+	0x48,0x00,0x00,0x00,0x8D,0x4D,0x00,0x00,0x5B,0x16,0x00,0x00,0x41,0x00,0x00,0x00,
+	0xCE,0x4D,0x00,0x00,0x61,0x16,0x00,0x00,0x56,0x00,0x00,0x00,0x24,0x4E,0x00,0x00,
+	0x67,0x16,0x00,0x00,0x4A,0x00,0x00,0x00,0x6E,0x4E,0x00,0x00,0x6D,0x16,0x00,0x00,
+	0x4B,0x00,0x00,0x00,0xB9,0x4E,0x00,0x00,0x73,0x16,0x00,0x00,0x2F,0x00,0x00,0x00,
+	0xE8,0x4E,0x00,0x00,0x78,0x16,0x00,0x00,0x4D,0x00,0x00,0x00,0x35,0x4F,0x00,0x00,
+	0x7F,0x16,0x00,0x00,0x55,0x00,0x00,0x00,0x8A,0x4F,0x00,0x00,0x8B,0x16,0x00,0x00,
+	0x3E,0x00,0x00,0x00,0xC8,0x4F,0x00,0x00,0x90,0x16,0x00,0x00,0x27,0x00,0x00,0x00,
+	0xEF,0x4F,0x00,0x00,0x94,0x16,0x00,0x00,0x4B,0x00,0x00,0x00,0x3A,0x50,0x00,0x00,
+	0x9A,0x16,0x00,0x00,0x3D,0x00,0x00,0x00,0x77,0x50,0x00,0x00,0x9F,0x16,0x00,0x00,
+	0x3F,0x00,0x00,0x00,0xB6,0x50,0x00,0x00,0xA4,0x16,0x00,0x00,0x43,0x00,0x00,0x00,
+	0xF9,0x50,0x00,0x00,0xA9,0x16,0x00,0x00,0x29,0x00,0x00,0x00,0x22,0x51,0x00,0x00,
+	0xAC,0x16,0x00,0x00,0x54,0x00,0x00,0x00,0x76,0x51,0x00,0x00,0xB2,0x16,0x00,0x00,
+	0x5D,0x00,0x00,0x00,0xD3,0x51,0x00,0x00,0xB7,0x16,0x00,0x00,0x2B,0x00,0x00,0x00,
+	0xFE,0x51,0x00,0x00,0xBA,0x16,0x00,0x00,0x5E,0x00,0x00,0x00,0x5C,0x52,0x00,0x00,
+	0xC0,0x16,0x00,0x00,0x54,0x00,0x00,0x00,0xB0,0x52,0x00,0x00,0xC4,0x16,0x00,0x00,
+	0x3D,0x00,0x00,0x00,0xED,0x52,0x00,0x00,0xCA,0x16,0x00,0x00,0x4F,0x00,0x00,0x00,
+	0x3C,0x53,0x00,0x00,0xD0,0x16,0x00,0x00,0x4F,0x00,0x00,0x00,0x8B,0x53,0x00,0x00,
+	0xD7,0x16,0x00,0x00,0x53,0x00,0x00,0x00,0xDE,0x53,0x00,0x00,0xDC,0x16,0x00,0x00,
+	0x52,0x00,0x00,0x00,0x30,0x54,0x00,0x00,0xE3,0x16,0x00,0x00,0x0F,0x00,0x00,0x00,
+	0x3F,0x54,0x00,0x00,0xEA,0x16,0x00,0x00,0x13,0x00,0x00,0x00,0x66,0xD5,0xDF,0x00,
+	0xB6,0x00,0x00,0x00,0xB0,0x15,0x35,0x01,0x38,0x00,0x00,0x00,0x5B,0x1B,0x95,0x01,
+	0x8A,0x00,0x00,0x00,0x62,0x66,0x07,0x02,0xA5,0x00,0x00,0x00,0x76,0x80,0x8A,0x06,
+	0x45,0x00,0x00,0x00,0x61,0x7B,0x70,0x07,0x71,0x00,0x00,0x00,0xE5,0x5F,0xA5,0x08,
+	0xBA,0x00,0x00,0x00,0xAC,0xA9,0x8B,0x0A,0x3D,0x00,0x00,0x00,0x3F,0xA6,0x94,0x0D,
+	0xB9,0x00,0x00,0x00,0x70,0x20,0x3C,0x10,0x81,0x00,0x00,0x00,0x89,0x5D,0x50,0x11,
+	0x98,0x00,0x00,0x00,0xCE,0xF9,0x2F,0x13,0x85,0x00,0x00,0x00,0xDB,0xA5,0x98,0x13,
+	0x46,0x00,0x00,0x00,0xB1,0x90,0x60,0x14,0x53,0x00,0x00,0x00,0x67,0x79,0x2E,0x15,
+	0x83,0x00,0x00,0x00,0x5C,0x73,0x00,0x17,0xC8,0x00,0x00,0x00,0x5E,0xBB,0x38,0x18,
+	0x07,0x00,0x00,0x00,0x95,0xD3,0x8D,0x18,0x09,0x00,0x00,0x00,0x27,0xF5,0x3A,0x1B,
+	0x59,0x00,0x00,0x00,0x85,0xD7,0x97,0x1B,0xAF,0x00,0x00,0x00,0x23,0x26,0x98,0x1B,
+	0x0D,0x00,0x00,0x00,0xB6,0x66,0x02,0x1C,0x0F,0x00,0x00,0x00,0xC2,0x2C,0x02,0x1D,
+	0xCA,0x00,0x00,0x00,0x34,0xB4,0xFD,0x1D,0x0C,0x00,0x00,0x00,0xD0,0xAD,0x8E,0x21,
+	0x76,0x00,0x00,0x00,0x24,0xFB,0xBE,0x22,0xC0,0x00,0x00,0x00,0xFF,0x20,0xEE,0x23,
+	0x87,0x00,0x00,0x00,0x98,0x50,0x96,0x24,0x9C,0x00,0x00,0x00,0x07,0x4F,0x07,0x26,
+	0xC5,0x00,0x00,0x00,0xC2,0xDA,0xA5,0x28,0xBF,0x00,0x00,0x00,0xE8,0xF9,0xB7,0x29,
+	0x10,0x00,0x00,0x00,0x1B,0xDC,0xC3,0x29,0x6C,0x00,0x00,0x00,0x9D,0x5B,0x96,0x2B,
+	0x9D,0x00,0x00,0x00,0xBE,0x27,0x61,0x2D,0xA8,0x00,0x00,0x00,0xB5,0x01,0x94,0x2D,
+	0x34,0x00,0x00,0x00,0x3D,0x39,0x98,0x2D,0x99,0x00,0x00,0x00,0x3F,0xB2,0xF4,0x2D,
+	0x9A,0x00,0x00,0x00,0xEA,0x05,0x15,0x2E,0x95,0x00,0x00,0x00,0x43,0xB9,0x24,0x2F,
+	0x8C,0x00,0x00,0x00,0x0F,0x86,0xE7,0x2F,0x9B,0x00,0x00,0x00,0x2D,0xDC,0x82,0x31,
+	0xC4,0x00,0x00,0x00,0xCA,0x8E,0x5C,0x32,0x96,0x00,0x00,0x00,0x1D,0x17,0xA4,0x33,
+	0xA9,0x00,0x00,0x00,0x63,0x39,0xC4,0x33,0x03,0x00,0x00,0x00,0xCE,0xD2,0xEB,0x35,
+	0x42,0x00,0x00,0x00,0x27,0x7B,0x13,0x36,0x39,0x00,0x00,0x00,0xD9,0xE7,0x7D,0x36,
+	0x47,0x00,0x00,0x00,0x48,0x31,0xD5,0x36,0x4F,0x00,0x00,0x00,0xB1,0x04,0xE5,0x36,
+	0xBB,0x00,0x00,0x00,0x39,0x26,0x08,0x3A,0xCB,0x00,0x00,0x00,0xC1,0x32,0xED,0x3A,
+	0x30,0x00,0x00,0x00,0x74,0x0C,0x3D,0x3F,0x0A,0x00,0x00,0x00,0x51,0x15,0x9F,0x3F,
+	0x60,0x00,0x00,0x00,0x49,0xA0,0x5F,0x40,0x02,0x00,0x00,0x00,0x6F,0x08,0x84,0x40,
+	0x6D,0x00,0x00,0x00,0xBE,0x4A,0xCF,0x40,0x8B,0x00,0x00,0x00,0x76,0x79,0x8A,0x41,
+	0x67,0x00,0x00,0x00,0x1E,0xAF,0x75,0x44,0x48,0x00,0x00,0x00,0x21,0x53,0x16,0x45,
+	0xC7,0x00,0x00,0x00,0x0A,0xD5,0x2C,0x47,0x64,0x00,0x00,0x00,0xFA,0x1D,0x89,0x48,
+	0x9E,0x00,0x00,0x00,0xE3,0x82,0x01,0x49,0xB3,0x00,0x00,0x00,0xD9,0x75,0x15,0x49,
+	0x4A,0x00,0x00,0x00,0x0F,0x60,0xE1,0x4C,0x82,0x00,0x00,0x00,0x00,0x92,0xE3,0x4C,
+	0x0B,0x00,0x00,0x00,0x8B,0x83,0x0A,0x4D,0x06,0x00,0x00,0x00,0x51,0x64,0xCE,0x4D,
+	0xA7,0x00,0x00,0x00,0x55,0x5C,0x54,0x4E,0xBC,0x00,0x00,0x00,0x86,0x15,0x30,0x51,
+	0x57,0x00,0x00,0x00,0xDB,0xBB,0xFA,0x52,0x56,0x00,0x00,0x00,0x7E,0xCE,0x04,0x53,
+	0x49,0x00,0x00,0x00,0x7E,0x13,0x07,0x53,0x36,0x00,0x00,0x00,0xFD,0x12,0x13,0x54,
+	0x7D,0x00,0x00,0x00,0x1E,0xE2,0x39,0x54,0x4C,0x00,0x00,0x00,0xD2,0xF0,0x50,0x54,
+	0x75,0x00,0x00,0x00,0xC7,0xD6,0x7B,0x54,0xC1,0x00,0x00,0x00,0x24,0x92,0x61,0x55,
+	0x4B,0x00,0x00,0x00,0xBA,0x9E,0xCC,0x56,0xC2,0x00,0x00,0x00,0x52,0xF4,0x1F,0x58,
+	0x43,0x00,0x00,0x00,0xF3,0xEA,0x88,0x5B,0x88,0x00,0x00,0x00,0x2D,0x8D,0x43,0x5C,
+	0x6B,0x00,0x00,0x00,0xA2,0x53,0x2D,0x5D,0x54,0x00,0x00,0x00,0xE0,0xD5,0x35,0x5E,
+	0xB8,0x00,0x00,0x00,0x7D,0xEA,0x98,0x5E,0x3C,0x00,0x00,0x00,0xCB,0xF7,0xD0,0x61,
+	0x77,0x00,0x00,0x00,0xA0,0x8B,0xF3,0x62,0xC6,0x00,0x00,0x00,0xB2,0xE1,0x21,0x65,
+	0xAA,0x00,0x00,0x00,0xA4,0x83,0x4F,0x65,0x91,0x00,0x00,0x00,0xEA,0xC8,0x88,0x65,
+	0xAE,0x00,0x00,0x00,0xB3,0xED,0x11,0x68,0x63,0x00,0x00,0x00,0xA5,0x2A,0xBC,0x6C,
+	0x04,0x00,0x00,0x00,0x95,0x0F,0xE9,0x6D,0x80,0x00,0x00,0x00,0xB5,0x74,0x67,0x6E,
+	0xA1,0x00,0x00,0x00,0x18,0xB0,0x5D,0x70,0x9F,0x00,0x00,0x00,0x8F,0xD7,0x28,0x76,
+	0x8D,0x00,0x00,0x00,0x04,0x17,0x96,0x76,0x50,0x00,0x00,0x00,0x8A,0xE8,0x08,0x78,
+	0xA3,0x00,0x00,0x00,0xD9,0x3C,0x2B,0x78,0x5D,0x00,0x00,0x00,0x05,0x61,0x83,0x79,
+	0x6A,0x00,0x00,0x00,0x68,0xB1,0xF3,0x7A,0xC3,0x00,0x00,0x00,0xFD,0xEE,0x2F,0x7B,
+	0x7A,0x00,0x00,0x00,0x50,0xB0,0xE4,0x80,0x97,0x00,0x00,0x00,0xFC,0x97,0xCE,0x83,
+	0xAC,0x00,0x00,0x00,0xFB,0x38,0x75,0x8A,0xC9,0x00,0x00,0x00,0xEE,0x07,0x85,0x8C,
+	0x61,0x00,0x00,0x00,0x26,0x72,0xCA,0x8C,0xA4,0x00,0x00,0x00,0xA3,0xB4,0x51,0x90,
+	0x00,0x00,0x00,0x00,0x56,0x2C,0xBD,0x90,0x7F,0x00,0x00,0x00,0xC6,0x6D,0x66,0x91,
+	0x4D,0x00,0x00,0x00,0xA1,0xE8,0xC9,0x91,0x2F,0x00,0x00,0x00,0x09,0x4E,0x93,0x92,
+	0x44,0x00,0x00,0x00,0x75,0xB4,0xBE,0x93,0x72,0x00,0x00,0x00,0x58,0xD0,0x2C,0x9B,
+	0x52,0x00,0x00,0x00,0xEC,0x35,0x6B,0xA0,0x35,0x00,0x00,0x00,0x44,0x52,0x90,0xA0,
+	0x4E,0x00,0x00,0x00,0x5F,0xA6,0x8A,0xA5,0xB4,0x00,0x00,0x00,0xD4,0xB0,0xB3,0xA5,
+	0x7C,0x00,0x00,0x00,0x38,0x3E,0xEE,0xA5,0x92,0x00,0x00,0x00,0x0A,0x8E,0xE2,0xA8,
+	0xB1,0x00,0x00,0x00,0xBC,0x4F,0x6F,0xA9,0x66,0x00,0x00,0x00,0x98,0xBE,0x79,0xAA,
+	0xB0,0x00,0x00,0x00,0x0F,0x3D,0x25,0xAB,0x32,0x00,0x00,0x00,0xCF,0xCC,0x2A,0xAB,
+	0x69,0x00,0x00,0x00,0x5C,0x93,0x62,0xAB,0x78,0x00,0x00,0x00,0x78,0x48,0x85,0xAB,
+	0xB5,0x00,0x00,0x00,0xE0,0x53,0xC9,0xAB,0x37,0x00,0x00,0x00,0xAA,0x47,0xEE,0xAB,
+	0x93,0x00,0x00,0x00,0xF3,0x9A,0x1F,0xAC,0x41,0x00,0x00,0x00,0xCB,0x4A,0x7F,0xAD,
+	0x12,0x00,0x00,0x00,0xB4,0xB0,0xBE,0xAD,0x5A,0x00,0x00,0x00,0xEE,0xAC,0xEF,0xAD,
+	0xCC,0x00,0x00,0x00,0x49,0xCF,0xAB,0xB0,0xCD,0x00,0x00,0x00,0x79,0xC3,0xC2,0xB0,
+	0x73,0x00,0x00,0x00,0xE9,0x54,0x43,0xB1,0x55,0x00,0x00,0x00,0xE3,0x36,0x5B,0xB1,
+	0x2E,0x00,0x00,0x00,0x8E,0xC1,0x76,0xB2,0x7E,0x00,0x00,0x00,0x74,0xC3,0xC4,0xB2,
+	0xAD,0x00,0x00,0x00,0xE5,0x39,0xD7,0xB2,0xBD,0x00,0x00,0x00,0x5F,0x8C,0x9A,0xB3,
+	0x3A,0x00,0x00,0x00,0xAD,0x94,0x79,0xB5,0x68,0x00,0x00,0x00,0xDA,0xCE,0x90,0xB6,
+	0xB7,0x00,0x00,0x00,0x61,0x84,0x1A,0xBA,0x3E,0x00,0x00,0x00,0xC3,0x1F,0x6E,0xBB,
+	0x11,0x00,0x00,0x00,0xD4,0x12,0x65,0xBC,0xCE,0x00,0x00,0x00,0xE6,0x5E,0x6E,0xBC,
+	0x5F,0x00,0x00,0x00,0xFD,0x4C,0x6E,0xBD,0x5B,0x00,0x00,0x00,0x84,0xE7,0x57,0xBE,
+	0x31,0x00,0x00,0x00,0x8D,0x17,0x65,0xBF,0xCF,0x00,0x00,0x00,0x80,0xF0,0x0B,0xC0,
+	0x17,0x00,0x00,0x00,0x13,0xF2,0x0B,0xC1,0x16,0x00,0x00,0x00,0x42,0xA2,0xF9,0xC1,
+	0x5C,0x00,0x00,0x00,0x54,0x41,0x06,0xC2,0x90,0x00,0x00,0x00,0xA6,0xF3,0x0B,0xC2,
+	0x19,0x00,0x00,0x00,0x39,0xF5,0x0B,0xC3,0x18,0x00,0x00,0x00,0xCC,0xF6,0x0B,0xC4,
+	0x13,0x00,0x00,0x00,0xF2,0xF9,0x0B,0xC6,0x15,0x00,0x00,0x00,0x85,0xFB,0x0B,0xC7,
+	0x14,0x00,0x00,0x00,0x18,0xFD,0x0B,0xC8,0x1F,0x00,0x00,0x00,0xAB,0xFE,0x0B,0xC9,
+	0x1C,0x00,0x00,0x00,0x3E,0x00,0x0C,0xCA,0x21,0x00,0x00,0x00,0xAF,0x9D,0xF1,0xCA,
+	0x74,0x00,0x00,0x00,0xD1,0x01,0x0C,0xCB,0x20,0x00,0x00,0x00,0xD9,0x4B,0xFD,0xCB,
+	0x6F,0x00,0x00,0x00,0x64,0x03,0x0C,0xCC,0x1B,0x00,0x00,0x00,0xF7,0x04,0x0C,0xCD,
+	0x1A,0x00,0x00,0x00,0xA3,0x3D,0x1B,0xCD,0x86,0x00,0x00,0x00,0xD4,0x2C,0xDA,0xCD,
+	0xAB,0x00,0x00,0x00,0x8A,0x06,0x0C,0xCE,0x1E,0x00,0x00,0x00,0x1D,0x08,0x0C,0xCF,
+	0x1D,0x00,0x00,0x00,0xB0,0x09,0x0C,0xD0,0x27,0x00,0x00,0x00,0x43,0x0B,0x0C,0xD1,
+	0x26,0x00,0x00,0x00,0xD6,0x0C,0x0C,0xD2,0x29,0x00,0x00,0x00,0x61,0xE6,0x2B,0xD2,
+	0x84,0x00,0x00,0x00,0x69,0x0E,0x0C,0xD3,0x28,0x00,0x00,0x00,0x94,0xB5,0xC3,0xD3,
+	0xA6,0x00,0x00,0x00,0x86,0xEF,0x03,0xD4,0x40,0x00,0x00,0x00,0xFC,0x0F,0x0C,0xD4,
+	0x23,0x00,0x00,0x00,0x82,0xD7,0xAD,0xD4,0x89,0x00,0x00,0x00,0x8F,0x11,0x0C,0xD5,
+	0x22,0x00,0x00,0x00,0x22,0x13,0x0C,0xD6,0x25,0x00,0x00,0x00,0xB5,0x14,0x0C,0xD7,
+	0x24,0x00,0x00,0x00,0x44,0x03,0x0C,0xD9,0xB2,0x00,0x00,0x00,0x0E,0xE8,0xD7,0xDA,
+	0x62,0x00,0x00,0x00,0xD2,0x9F,0xDC,0xDA,0x8F,0x00,0x00,0x00,0x94,0x1C,0x0C,0xDC,
+	0x2B,0x00,0x00,0x00,0x27,0x1E,0x0C,0xDD,0x2A,0x00,0x00,0x00,0x7E,0xE9,0x0D,0xDE,
+	0x5E,0x00,0x00,0x00,0x4D,0x21,0x0C,0xDF,0x2C,0x00,0x00,0x00,0x76,0xEC,0x7F,0xE0,
+	0x79,0x00,0x00,0x00,0x47,0x0B,0x2F,0xE2,0x0E,0x00,0x00,0x00,0xEB,0x81,0x4E,0xE2,
+	0x3F,0x00,0x00,0x00,0x10,0x3C,0x47,0xE4,0x08,0x00,0x00,0x00,0x44,0x70,0x76,0xEA,
+	0xA0,0x00,0x00,0x00,0x78,0x4F,0xB6,0xEB,0x7B,0x00,0x00,0x00,0xF9,0x3D,0xBA,0xEB,
+	0x33,0x00,0x00,0x00,0x95,0x78,0x06,0xEC,0x05,0x00,0x00,0x00,0x4B,0x85,0x02,0xED,
+	0x2D,0x00,0x00,0x00,0x31,0x20,0x2A,0xF0,0xA2,0x00,0x00,0x00,0xA0,0x07,0x3C,0xF3,
+	0x94,0x00,0x00,0x00,0x0F,0x59,0x3C,0xF3,0x3B,0x00,0x00,0x00,0x7C,0x65,0x49,0xF6,
+	0xBE,0x00,0x00,0x00,0x4E,0x22,0x3E,0xF8,0x8E,0x00,0x00,0x00,0x35,0x16,0x4F,0xF8,
+	0x65,0x00,0x00,0x00,0x15,0x85,0x25,0xF9,0x6E,0x00,0x00,0x00,0x55,0xAF,0xB9,0xFB,
+	0x70,0x00,0x00,0x00,0x0F,0x31,0x01,0xFD,0x01,0x00,0x00,0x00,0xCF,0x46,0x86,0xFD,
+	0x51,0x00,0x00,0x00,0x3D,0x86,0x29,0xFF,0x58,0x00,0x00,0x00,0x00,0x00,0x01,0x00,
+	0x03,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x05,0x00,0x06,0x00,0x07,0x00,
+	0x07,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x09,0x00,0x09,0x00,0x09,0x00,0x0A,0x00,
+	0x0B,0x00,0x0B,0x00,0x0D,0x00,0x0E,0x00,0x0F,0x00,0x0F,0x00,0x10,0x00,0x12,0x00,
+	0x12,0x00,0x12,0x00,0x15,0x00,0x16,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,
+	0x19,0x00,0x1A,0x00,0x1B,0x00,0x1C,0x00,0x1C,0x00,0x1D,0x00,0x1D,0x00,0x1E,0x00,
+	0x20,0x00,0x20,0x00,0x21,0x00,0x21,0x00,0x25,0x00,0x26,0x00,0x28,0x00,0x28,0x00,
+	0x29,0x00,0x2A,0x00,0x2C,0x00,0x2C,0x00,0x2D,0x00,0x31,0x00,0x31,0x00,0x31,0x00,
+	0x31,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x35,0x00,0x38,0x00,
+	0x39,0x00,0x39,0x00,0x39,0x00,0x3A,0x00,0x3B,0x00,0x3B,0x00,0x3C,0x00,0x3D,0x00,
+	0x3F,0x00,0x3F,0x00,0x3F,0x00,0x41,0x00,0x43,0x00,0x44,0x00,0x44,0x00,0x44,0x00,
+	0x45,0x00,0x46,0x00,0x48,0x00,0x4C,0x00,0x4D,0x00,0x4E,0x00,0x4E,0x00,0x4F,0x00,
+	0x4F,0x00,0x4F,0x00,0x50,0x00,0x51,0x00,0x52,0x00,0x54,0x00,0x54,0x00,0x54,0x00,
+	0x55,0x00,0x56,0x00,0x56,0x00,0x56,0x00,0x59,0x00,0x59,0x00,0x59,0x00,0x5A,0x00,
+	0x5A,0x00,0x5A,0x00,0x5A,0x00,0x5B,0x00,0x5C,0x00,0x5D,0x00,0x5D,0x00,0x5E,0x00,
+	0x5E,0x00,0x5E,0x00,0x5E,0x00,0x5E,0x00,0x5E,0x00,0x60,0x00,0x60,0x00,0x62,0x00,
+	0x63,0x00,0x64,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x65,0x00,0x66,0x00,
+	0x66,0x00,0x66,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,0x67,0x00,
+	0x67,0x00,0x68,0x00,0x68,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6A,0x00,0x6C,0x00,
+	0x6E,0x00,0x6F,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,
+	0x70,0x00,0x70,0x00,0x71,0x00,0x71,0x00,0x71,0x00,0x71,0x00,0x71,0x00,0x73,0x00,
+	0x73,0x00,0x73,0x00,0x73,0x00,0x73,0x00,0x76,0x00,0x76,0x00,0x76,0x00,0x77,0x00,
+	0x78,0x00,0x79,0x00,0x7F,0x00,0x80,0x00,0x83,0x00,0x83,0x00,0x83,0x00,0x85,0x00,
+	0x87,0x00,0x8A,0x00,0x8B,0x00,0x8B,0x00,0x8C,0x00,0x8D,0x00,0x8D,0x00,0x8D,0x00,
+	0x8D,0x00,0x8E,0x00,0x8F,0x00,0x91,0x00,0x92,0x00,0x93,0x00,0x94,0x00,0x95,0x00,
+	0x97,0x00,0x99,0x00,0x9A,0x00,0x9B,0x00,0x9B,0x00,0x9C,0x00,0x9D,0x00,0x9E,0x00,
+	0x9F,0x00,0xA1,0x00,0xA3,0x00,0xA4,0x00,0xA7,0x00,0xA8,0x00,0xA9,0x00,0xAA,0x00,
+	0xAB,0x00,0xAD,0x00,0xAF,0x00,0xB2,0x00,0xB3,0x00,0xB4,0x00,0xB5,0x00,0xB5,0x00,
+	0xB6,0x00,0xB8,0x00,0xB8,0x00,0xB9,0x00,0xBA,0x00,0xBB,0x00,0xBC,0x00,0xBD,0x00,
+	0xBD,0x00,0xBF,0x00,0xBF,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,
+	0xC0,0x00,0xC1,0x00,0xC3,0x00,0xC4,0x00,0xC5,0x00,0xC5,0x00,0xC5,0x00,0xC6,0x00,
+	0xC6,0x00,0xC6,0x00,0xC8,0x00,0xC8,0x00,0xC8,0x00,0xC9,0x00,0xC9,0x00,0xCB,0x00,
+	0xCC,0x00,0xCC,0x00,0xCD,0x00,0xCD,0x00,0xCF,0x00,0xCF,0x00,0xD0,0x00,0x5A,0x45,
+	0x52,0x4F,0x00,0x4F,0x4E,0x45,0x00,0x54,0x57,0x4F,0x00,0x54,0x48,0x52,0x45,0x45,
+	0x00,0x46,0x4F,0x55,0x52,0x00,0x46,0x49,0x56,0x45,0x00,0x53,0x49,0x58,0x00,0x53,
+	0x45,0x56,0x45,0x4E,0x00,0x45,0x49,0x47,0x48,0x54,0x00,0x4E,0x49,0x4E,0x45,0x00,
+	0x54,0x45,0x4E,0x00,0x45,0x4C,0x45,0x56,0x45,0x4E,0x00,0x54,0x57,0x45,0x4C,0x56,
+	0x45,0x00,0x54,0x48,0x49,0x52,0x5F,0x00,0x46,0x49,0x46,0x5F,0x00,0x5F,0x54,0x45,
+	0x45,0x4E,0x00,0x54,0x57,0x45,0x4E,0x54,0x59,0x00,0x48,0x55,0x4E,0x44,0x52,0x45,
+	0x44,0x00,0x54,0x48,0x4F,0x55,0x53,0x41,0x4E,0x44,0x00,0x41,0x00,0x42,0x00,0x43,
+	0x00,0x44,0x00,0x45,0x00,0x46,0x00,0x47,0x00,0x48,0x00,0x49,0x00,0x4C,0x00,0x4A,
+	0x00,0x4B,0x00,0x4D,0x00,0x4E,0x00,0x4F,0x00,0x50,0x00,0x51,0x00,0x52,0x00,0x53,
+	0x00,0x54,0x00,0x55,0x00,0x56,0x00,0x57,0x00,0x58,0x00,0x59,0x00,0x5A,0x00,0x41,
+	0x4C,0x50,0x48,0x41,0x00,0x42,0x52,0x41,0x56,0x4F,0x00,0x43,0x48,0x41,0x52,0x4C,
+	0x49,0x45,0x00,0x44,0x45,0x4C,0x54,0x41,0x00,0x45,0x43,0x48,0x4F,0x00,0x46,0x4F,
+	0x58,0x54,0x52,0x4F,0x54,0x00,0x47,0x4F,0x4C,0x46,0x00,0x48,0x45,0x4E,0x52,0x59,
+	0x00,0x49,0x4E,0x44,0x49,0x41,0x00,0x4A,0x55,0x4C,0x49,0x45,0x54,0x00,0x4B,0x49,
+	0x4C,0x4F,0x00,0x4C,0x49,0x4D,0x41,0x00,0x4D,0x49,0x4B,0x45,0x00,0x4E,0x4F,0x56,
+	0x45,0x4D,0x42,0x45,0x52,0x00,0x4F,0x53,0x43,0x41,0x52,0x00,0x50,0x41,0x50,0x41,
+	0x00,0x51,0x55,0x45,0x42,0x45,0x43,0x00,0x52,0x4F,0x4D,0x45,0x4F,0x00,0x53,0x49,
+	0x45,0x52,0x52,0x41,0x00,0x54,0x41,0x4E,0x47,0x4F,0x00,0x55,0x4E,0x49,0x46,0x4F,
+	0x52,0x4D,0x00,0x56,0x49,0x43,0x54,0x4F,0x52,0x00,0x57,0x48,0x49,0x53,0x4B,0x59,
+	0x00,0x58,0x52,0x41,0x59,0x00,0x59,0x41,0x4E,0x4B,0x45,0x45,0x00,0x5A,0x55,0x4C,
+	0x55,0x00,0x41,0x42,0x4F,0x52,0x54,0x00,0x41,0x42,0x4F,0x55,0x54,0x00,0x41,0x44,
+	0x4A,0x55,0x53,0x54,0x00,0x41,0x4C,0x45,0x52,0x54,0x00,0x41,0x4C,0x4C,0x00,0x41,
+	0x4D,0x50,0x53,0x00,0x41,0x4E,0x44,0x00,0x41,0x52,0x45,0x41,0x00,0x41,0x54,0x00,
+	0x41,0x55,0x54,0x4F,0x4D,0x41,0x54,0x49,0x43,0x00,0x42,0x45,0x54,0x57,0x45,0x45,
+	0x4E,0x00,0x42,0x52,0x45,0x41,0x4B,0x00,0x42,0x55,0x54,0x54,0x4F,0x4E,0x00,0x43,
+	0x41,0x4C,0x49,0x42,0x52,0x41,0x54,0x45,0x00,0x43,0x41,0x4C,0x4C,0x00,0x43,0x41,
+	0x4E,0x43,0x45,0x4C,0x00,0x43,0x41,0x55,0x54,0x49,0x4F,0x4E,0x00,0x43,0x48,0x41,
+	0x4E,0x47,0x45,0x00,0x43,0x48,0x45,0x43,0x4B,0x00,0x43,0x49,0x52,0x43,0x55,0x49,
+	0x54,0x00,0x43,0x4C,0x4F,0x43,0x4B,0x00,0x43,0x4F,0x4D,0x50,0x4C,0x45,0x54,0x45,
+	0x00,0x43,0x4F,0x4E,0x4E,0x45,0x43,0x54,0x00,0x43,0x4F,0x4E,0x54,0x52,0x4F,0x4C,
+	0x00,0x43,0x52,0x41,0x4E,0x45,0x00,0x43,0x59,0x43,0x4C,0x45,0x00,0x44,0x41,0x4E,
+	0x47,0x45,0x52,0x00,0x44,0x45,0x47,0x52,0x45,0x45,0x53,0x00,0x44,0x45,0x56,0x49,
+	0x43,0x45,0x00,0x44,0x49,0x52,0x45,0x43,0x54,0x49,0x4F,0x4E,0x00,0x44,0x49,0x53,
+	0x50,0x4C,0x41,0x59,0x00,0x45,0x41,0x53,0x54,0x00,0x45,0x4C,0x45,0x43,0x54,0x52,
+	0x49,0x43,0x49,0x41,0x4E,0x00,0x45,0x4E,0x54,0x45,0x52,0x00,0x45,0x51,0x55,0x41,
+	0x4C,0x00,0x45,0x58,0x49,0x54,0x00,0x46,0x41,0x49,0x4C,0x00,0x46,0x41,0x52,0x41,
+	0x44,0x00,0x46,0x41,0x53,0x54,0x00,0x46,0x45,0x45,0x54,0x00,0x46,0x49,0x52,0x45,
+	0x00,0x46,0x4C,0x4F,0x57,0x00,0x46,0x52,0x45,0x51,0x55,0x45,0x4E,0x43,0x59,0x00,
+	0x46,0x52,0x4F,0x4D,0x00,0x47,0x41,0x4C,0x4C,0x4F,0x4E,0x53,0x00,0x47,0x41,0x50,
+	0x00,0x47,0x41,0x54,0x45,0x00,0x47,0x41,0x55,0x47,0x45,0x00,0x47,0x4F,0x00,0x47,
+	0x52,0x45,0x45,0x4E,0x00,0x48,0x45,0x52,0x54,0x5A,0x00,0x48,0x49,0x47,0x48,0x00,
+	0x48,0x4F,0x4C,0x44,0x00,0x48,0x4F,0x55,0x52,0x53,0x00,0x49,0x4E,0x43,0x48,0x00,
+	0x49,0x4E,0x53,0x50,0x45,0x43,0x54,0x4F,0x52,0x00,0x49,0x4E,0x54,0x52,0x55,0x44,
+	0x45,0x52,0x00,0x49,0x53,0x00,0x4C,0x45,0x46,0x54,0x00,0x4C,0x49,0x47,0x48,0x54,
+	0x00,0x4C,0x49,0x4E,0x45,0x00,0x4C,0x4F,0x57,0x00,0x4D,0x41,0x43,0x48,0x49,0x4E,
+	0x45,0x00,0x4D,0x41,0x4E,0x55,0x41,0x4C,0x00,0x4D,0x45,0x41,0x53,0x55,0x52,0x45,
+	0x00,0x4D,0x45,0x47,0x41,0x00,0x4D,0x45,0x54,0x45,0x52,0x00,0x4D,0x49,0x43,0x52,
+	0x4F,0x00,0x4D,0x49,0x4C,0x4C,0x49,0x00,0x4D,0x49,0x4C,0x4C,0x00,0x4D,0x49,0x4E,
+	0x55,0x53,0x00,0x4D,0x49,0x4E,0x55,0x54,0x45,0x53,0x00,0x4D,0x4F,0x54,0x4F,0x52,
+	0x00,0x4D,0x4F,0x56,0x45,0x00,0x4E,0x4F,0x52,0x54,0x48,0x00,0x4E,0x4F,0x52,0x00,
+	0x4E,0x4F,0x54,0x00,0x4E,0x55,0x4D,0x42,0x45,0x52,0x00,0x4F,0x46,0x46,0x00,0x4F,
+	0x48,0x4D,0x53,0x00,0x4F,0x4E,0x00,0x4F,0x50,0x45,0x4E,0x00,0x4F,0x50,0x45,0x52,
+	0x41,0x54,0x4F,0x52,0x00,0x4F,0x55,0x54,0x00,0x4F,0x56,0x45,0x52,0x00,0x50,0x41,
+	0x53,0x53,0x00,0x50,0x41,0x53,0x54,0x00,0x50,0x45,0x52,0x43,0x45,0x4E,0x54,0x00,
+	0x50,0x48,0x41,0x53,0x45,0x00,0x50,0x49,0x43,0x4F,0x00,0x50,0x4C,0x55,0x53,0x00,
+	0x50,0x4F,0x49,0x4E,0x54,0x00,0x50,0x4F,0x53,0x49,0x54,0x49,0x4F,0x4E,0x00,0x50,
+	0x4F,0x57,0x45,0x52,0x00,0x50,0x52,0x45,0x53,0x53,0x55,0x52,0x45,0x00,0x50,0x52,
+	0x45,0x53,0x53,0x00,0x50,0x52,0x4F,0x42,0x45,0x00,0x50,0x55,0x4C,0x4C,0x00,0x50,
+	0x55,0x53,0x48,0x00,0x52,0x41,0x4E,0x47,0x45,0x00,0x52,0x45,0x41,0x44,0x59,0x00,
+	0x52,0x45,0x44,0x00,0x52,0x45,0x50,0x41,0x49,0x52,0x00,0x52,0x45,0x50,0x45,0x41,
+	0x54,0x00,0x52,0x49,0x47,0x48,0x54,0x00,0x53,0x41,0x46,0x45,0x00,0x53,0x45,0x43,
+	0x4F,0x4E,0x44,0x53,0x00,0x53,0x45,0x52,0x56,0x49,0x43,0x45,0x00,0x53,0x45,0x54,
+	0x00,0x53,0x48,0x55,0x54,0x00,0x53,0x4C,0x4F,0x57,0x00,0x53,0x4D,0x4F,0x4B,0x45,
+	0x00,0x53,0x4F,0x55,0x54,0x48,0x00,0x53,0x50,0x45,0x45,0x44,0x00,0x53,0x54,0x41,
+	0x52,0x54,0x00,0x53,0x54,0x4F,0x50,0x00,0x53,0x57,0x49,0x54,0x43,0x48,0x00,0x54,
+	0x45,0x4D,0x50,0x45,0x52,0x41,0x54,0x55,0x52,0x45,0x00,0x54,0x45,0x53,0x54,0x00,
+	0x54,0x48,0x45,0x00,0x54,0x49,0x4D,0x45,0x52,0x00,0x54,0x49,0x4D,0x45,0x00,0x54,
+	0x4F,0x4F,0x4C,0x00,0x54,0x55,0x52,0x4E,0x00,0x55,0x48,0x00,0x55,0x4E,0x44,0x45,
+	0x52,0x00,0x55,0x4E,0x49,0x54,0x00,0x55,0x50,0x00,0x56,0x41,0x4C,0x56,0x45,0x00,
+	0x56,0x41,0x4C,0x00,0x56,0x4F,0x4C,0x54,0x53,0x00,0x57,0x41,0x54,0x54,0x53,0x00,
+	0x57,0x45,0x49,0x47,0x48,0x54,0x00,0x57,0x45,0x53,0x54,0x00,0x59,0x45,0x4C,0x4C,
+	0x4F,0x57,0x00,0x50,0x41,0x55,0x53,0x45,0x31,0x00,0x50,0x41,0x55,0x53,0x45,0x32,
+	0x00,0x69,0xFB,0x59,0xDD,0x51,0xD5,0xD7,0xB5,0x6F,0x0A,0x78,0xC0,0x52,0x01,0x0F,
+	0x50,0xAC,0xF6,0xA8,0x16,0x15,0xF2,0x7B,0xEA,0x19,0x47,0xD0,0x64,0xEB,0xAD,0x76,
+	0xB5,0xEB,0xD1,0x96,0x24,0x6E,0x62,0x6D,0x5B,0x1F,0x0A,0xA7,0xB9,0xC5,0xAB,0xFD,
+	0x1A,0x62,0xF0,0xF0,0xE2,0x6C,0x73,0x1C,0x73,0x52,0x1D,0x19,0x94,0x6F,0xCE,0x7D,
+	0xED,0x6B,0xD9,0x82,0xDC,0x48,0xC7,0x2E,0x71,0x8B,0xBB,0xDF,0xFF,0x1F,0x66,0x4E,
+	0xA8,0x7A,0x8D,0xED,0xC4,0xB5,0xCD,0x89,0xD4,0xBC,0xA2,0xDB,0xD1,0x27,0xBE,0x33,
+	0x4C,0xD9,0x4F,0x9B,0x4D,0x57,0x8A,0x76,0xBE,0xF5,0xA9,0xAA,0x2E,0x4F,0xD5,0xCD,
+	0xB7,0xD9,0x43,0x5B,0x87,0x13,0x4C,0x0D,0xA7,0x75,0xAB,0x7B,0x3E,0xE3,0x19,0x6F,
+	0x7F,0xA7,0xA7,0xF9,0xD0,0x30,0x5B,0x1D,0x9E,0x9A,0x34,0x44,0xBC,0xB6,0x7D,0xFE,
+	0x1F,0x06,0xB8,0x59,0x34,0x00,0x27,0xD6,0x38,0x60,0x58,0xD3,0x91,0x55,0x2D,0xAA,
+	0x65,0x9D,0x4F,0xD1,0xB8,0x39,0x17,0x67,0xBF,0xC5,0xAE,0x5A,0x1D,0xB5,0x7A,0x06,
+	0xF6,0xA9,0x7D,0x9D,0xD2,0x6C,0x55,0xA5,0x26,0x75,0xC9,0x9B,0xDF,0xFC,0x6E,0x0E,
+	0x63,0x3A,0x34,0x70,0xAF,0x3E,0xFF,0x1F,0x0C,0xE8,0x2E,0x94,0x01,0x4D,0xBA,0x4A,
+	0x40,0x03,0x16,0x68,0x69,0x36,0x1C,0xE9,0xBA,0xB8,0xE5,0x39,0x70,0x72,0x84,0xDB,
+	0x51,0xA4,0xA8,0x4E,0xA3,0xC9,0x77,0xB1,0xCA,0xD6,0x52,0xA8,0x71,0xED,0x2A,0x7B,
+	0x4B,0xA6,0xE0,0x37,0xB7,0x5A,0xDD,0x48,0x8E,0x94,0xF1,0x64,0xCE,0x6D,0x19,0x55,
+	0x91,0xBC,0x6E,0xD7,0xAD,0x1E,0xF5,0xAA,0x77,0x7A,0xC6,0x70,0x22,0xCD,0xC7,0xF9,
+	0x89,0xCF,0xFF,0x03,0x08,0x68,0x21,0x0D,0x03,0x04,0x28,0xCE,0x92,0x03,0x23,0x4A,
+	0xCA,0xA6,0x1C,0xDA,0xAD,0xB4,0x70,0xED,0x19,0x64,0xB7,0xD3,0x91,0x45,0x51,0x35,
+	0x89,0xEA,0x66,0xDE,0xEA,0xE0,0xAB,0xD3,0x29,0x4F,0x1F,0xFA,0x52,0xF6,0x90,0x52,
+	0x3B,0x25,0x7F,0xDD,0xCB,0x9D,0x72,0x72,0x8C,0x79,0xCB,0x6F,0xFA,0xD2,0x10,0x9E,
+	0xB4,0x2C,0xE1,0x4F,0x25,0x70,0x3A,0xDC,0xBA,0x2F,0x6F,0xC1,0x75,0xCB,0xF2,0xFF,
+	0x08,0x68,0x4E,0x9D,0x02,0x1C,0x60,0xC0,0x8C,0x69,0x12,0xB0,0xC0,0x28,0xAB,0x8C,
+	0x9C,0xC0,0x2D,0xBB,0x38,0x79,0x31,0x15,0xA3,0xB6,0xE4,0x16,0xB7,0xDC,0xF5,0x6E,
+	0x57,0xDF,0x54,0x5B,0x85,0xBE,0xD9,0xE3,0x5C,0xC6,0xD6,0x6D,0xB1,0xA5,0xBF,0x99,
+	0x5B,0x3B,0x5A,0x30,0x09,0xAF,0x2F,0xED,0xEC,0x31,0xC4,0x5C,0xBE,0xD6,0x33,0xDD,
+	0xAD,0x88,0x87,0xE2,0xD2,0xF2,0xF4,0xE0,0x16,0x2A,0xB2,0xE3,0x63,0x1F,0xF9,0xF0,
+	0xE7,0xFF,0x01,0x04,0xF8,0xAD,0x4C,0x02,0x16,0xB0,0x80,0x06,0x56,0x35,0x5D,0xA8,
+	0x2A,0x6D,0xB9,0xCD,0x69,0xBB,0x2B,0x55,0xB5,0x2D,0xB7,0xDB,0xFD,0x9C,0x0D,0xD8,
+	0x32,0x8A,0x7B,0xBC,0x02,0x00,0x03,0x0C,0xB1,0x2E,0x80,0xDF,0xD2,0x35,0x20,0x01,
+	0x0E,0x60,0xE0,0xFF,0x01,0x0C,0xF8,0x5E,0x4C,0x01,0xBF,0x95,0x7B,0xC0,0x02,0x16,
+	0xB0,0xC0,0xC8,0xBA,0x36,0x4D,0xB7,0x27,0x37,0xBB,0xC5,0x29,0xBA,0x71,0x6D,0xB7,
+	0xB5,0xAB,0xA8,0xCE,0xBD,0xD4,0xDE,0xA6,0xB2,0x5A,0xB1,0x34,0x6A,0x1D,0xA7,0x35,
+	0x37,0xE5,0x5A,0xAE,0x6B,0xEE,0xD2,0xB6,0x26,0x4C,0x37,0xF5,0x4D,0xB9,0x9A,0x34,
+	0x39,0xB7,0xC6,0xE1,0x1E,0x81,0xD8,0xA2,0xEC,0xE6,0xC7,0x7F,0xFE,0xFB,0x7F,0x65,
+	0x69,0x89,0xC5,0x73,0x66,0xDF,0xE9,0x8C,0x33,0x0E,0x41,0xC6,0xEA,0x5B,0xEF,0x7A,
+	0xF5,0x33,0x25,0x50,0xE5,0xEA,0x39,0xD7,0xC5,0x6E,0x08,0x14,0xC1,0xDD,0x45,0x64,
+	0x03,0x00,0x80,0x00,0xAE,0x70,0x33,0xC0,0x73,0x33,0x1A,0x10,0x40,0x8F,0x2B,0x14,
+	0xF8,0x7F,0xE6,0xA8,0x1A,0x35,0x5D,0xD6,0x9A,0x35,0x4B,0x8C,0x4E,0x6B,0x1A,0xD6,
+	0xA6,0x51,0xB2,0xB5,0xEE,0x58,0x9A,0x13,0x4F,0xB5,0x35,0x67,0x68,0x26,0x3D,0x4D,
+	0x97,0x9C,0xBE,0xC9,0x75,0x2F,0x6D,0x7B,0xBB,0x5B,0xDF,0xFA,0x36,0xA7,0xEF,0xBA,
+	0x25,0xDA,0x16,0xDF,0x69,0xAC,0x23,0x05,0x45,0xF9,0xAC,0xB9,0x8F,0xA3,0x97,0x20,
+	0x73,0x9F,0x54,0xCE,0x1E,0x45,0xC2,0xA2,0x4E,0x3E,0xD3,0xD5,0x3D,0xB1,0x79,0x24,
+	0x0D,0xD7,0x48,0x4C,0x6E,0xE1,0x2C,0xDE,0xFF,0x0F,0x0E,0x38,0x3C,0x2D,0x00,0x5F,
+	0xB6,0x19,0x60,0xA8,0x90,0x93,0x36,0x2B,0xE2,0x99,0xB3,0x4E,0xD9,0x7D,0x89,0x85,
+	0x2F,0xBE,0xD5,0xAD,0x4F,0x3F,0x64,0xAB,0xA4,0x3E,0xBA,0xD3,0x59,0x9A,0x2E,0x75,
+	0xD5,0x39,0x6D,0x6B,0x0A,0x2D,0x3C,0xEC,0xE5,0xDD,0x1F,0xFE,0xB0,0xE7,0xFF,0x03,
+	0xA5,0xEF,0xD6,0x50,0x3B,0x67,0x8F,0xB9,0x3B,0x23,0x49,0x7F,0x33,0x87,0x31,0x0C,
+	0xE9,0x22,0x49,0x7D,0x56,0xDF,0x69,0xAA,0x39,0x6D,0x59,0xDD,0x82,0x56,0x92,0xDA,
+	0xE5,0x74,0x9D,0xA7,0xA6,0xD3,0x9A,0x53,0x37,0x99,0x56,0xA6,0x6F,0x4F,0x59,0x9D,
+	0x7B,0x89,0x2F,0xDD,0xC5,0x28,0xAA,0x15,0x4B,0xA3,0xD6,0xAE,0x8C,0x8A,0xAD,0x54,
+	0x3B,0xA7,0xA9,0x3B,0xB3,0x54,0x5D,0x33,0xE6,0xA6,0x5C,0xCB,0x75,0xCD,0x5E,0xC6,
+	0xDA,0xA4,0xCA,0xB9,0x35,0xAE,0x67,0xB8,0x46,0x40,0xB6,0x28,0xBB,0xF1,0xF6,0xB7,
+	0xB9,0x47,0x20,0xB6,0x28,0xBB,0xFF,0x0F,0x09,0x98,0xDA,0x22,0x01,0x37,0x78,0x1A,
+	0x20,0x85,0xD1,0x50,0x3A,0x33,0x11,0x81,0x5D,0x5B,0x95,0xD4,0x44,0x04,0x76,0x9D,
+	0xD5,0xA9,0x3A,0xAB,0xF0,0xA1,0x3E,0xB7,0xBA,0xD5,0xA9,0x2B,0xEB,0xCC,0xA0,0x3E,
+	0xB7,0xBD,0xC3,0x5A,0x3B,0xC8,0x69,0x67,0xBD,0xFB,0xE8,0x67,0xBF,0xCA,0x9D,0xE9,
+	0x74,0x08,0xE7,0xCE,0x77,0x78,0x06,0x89,0x32,0x57,0xD6,0xF1,0xF1,0x8F,0x7D,0xFE,
+	0x1F,0x04,0xA8,0xBE,0x5C,0x00,0xDD,0xA5,0x11,0xA0,0xFA,0x72,0x02,0x74,0x97,0xC6,
+	0x01,0x09,0x9C,0xA6,0xAB,0x30,0x0D,0xCE,0x7A,0xEA,0x6A,0x4A,0x39,0x35,0xFB,0xAA,
+	0x8B,0x1B,0xC6,0x76,0xF7,0xAB,0x2E,0x79,0x19,0xCA,0xD5,0xEF,0xCA,0x57,0x08,0x14,
+	0xA1,0xDC,0x45,0x64,0x03,0x00,0xC0,0xFF,0x03,0x08,0x98,0x31,0x93,0x02,0x1C,0xE0,
+	0x80,0x07,0x5A,0xD6,0x1C,0x6B,0x78,0x2E,0xBD,0xE5,0x2D,0x4F,0xDD,0xAD,0xAB,0xAA,
+	0x6D,0xC9,0x23,0x02,0x56,0x4C,0x93,0x00,0x05,0x10,0x90,0x89,0x31,0xFC,0x3F,0x09,
+	0x58,0x2A,0x25,0x00,0xCB,0x9F,0x95,0x6C,0x14,0x21,0x89,0xA9,0x78,0xB3,0x5B,0xEC,
+	0xBA,0xB5,0x23,0x13,0x46,0x97,0x99,0x3E,0xD6,0xB9,0x2E,0x79,0xC9,0x5B,0xD8,0x47,
+	0x41,0x53,0x1F,0xC7,0xE1,0x9C,0x85,0x54,0x22,0xEC,0xFA,0xDB,0xDD,0x23,0x93,0x49,
+	0xB8,0xE6,0x78,0xFF,0x3F,0x0A,0xE8,0x4A,0xCD,0x01,0xDB,0xB9,0x33,0xC0,0xA6,0x54,
+	0x0C,0xA4,0x34,0xD9,0xF2,0x0A,0x6C,0xBB,0xB3,0x53,0x0E,0x5D,0xA6,0x25,0x9B,0x6F,
+	0x75,0xCA,0x61,0x52,0xDC,0x74,0x49,0xA9,0x8A,0xC4,0x76,0x4D,0xD7,0xB1,0x76,0xC0,
+	0x55,0xA6,0x65,0xD8,0x26,0x99,0x5C,0x56,0xAD,0xB9,0x25,0x23,0xD5,0x7C,0x32,0x96,
+	0xE9,0x9B,0x20,0x7D,0xCB,0x3C,0xFA,0x55,0xAE,0x99,0x1A,0x30,0xFC,0x4B,0x3C,0xFF,
+	0x1F,0x04,0xC8,0x7E,0x5C,0x02,0x0A,0xA8,0x62,0x43,0x03,0xA7,0xA8,0x62,0x43,0x4B,
+	0x97,0xDC,0xF2,0x14,0xC5,0xA7,0x9B,0x7A,0xD3,0x95,0x37,0xC3,0x1E,0x16,0x4A,0x66,
+	0x36,0xF3,0x5A,0x89,0x6E,0xD4,0x30,0x55,0xB5,0x32,0xB7,0x31,0xB5,0xC1,0x69,0x2C,
+	0xE9,0xF7,0xBC,0x96,0x12,0x39,0xD4,0xB5,0xFD,0xDA,0x9B,0x0F,0xD1,0x90,0xEE,0xF5,
+	0xE4,0x17,0x02,0x45,0x28,0x77,0x11,0xD9,0x40,0x9E,0x45,0xDD,0x2B,0x33,0x71,0x7A,
+	0xBA,0x0B,0x13,0x95,0x2D,0xF9,0xF9,0x7F,0x0C,0xE8,0x2E,0xD4,0x02,0x06,0x98,0xD2,
+	0x55,0x03,0x16,0x68,0x7D,0x17,0xE9,0x6E,0xBC,0x65,0x8C,0x45,0x6D,0xA6,0xE9,0x96,
+	0xDD,0xDE,0xF6,0xB6,0xB7,0x5E,0x75,0xD4,0x93,0xA5,0x9C,0x7B,0x57,0xB3,0x6E,0x7D,
+	0x12,0x19,0xAD,0xDC,0x29,0x8D,0x4F,0x93,0xB4,0x87,0xD2,0xB6,0xFC,0xDD,0xAC,0x22,
+	0x56,0x02,0x70,0x18,0xCA,0x18,0x26,0xB5,0x90,0xD4,0xDE,0x6B,0x29,0xDA,0x2D,0x25,
+	0x17,0x8D,0x79,0x88,0xD4,0x48,0x79,0x5D,0xF7,0x74,0x75,0xA1,0x94,0xA9,0xD1,0xF2,
+	0xED,0x9E,0xAA,0x51,0xA6,0xD4,0x9E,0x7F,0xED,0x6F,0xFE,0x2B,0xD1,0xC7,0x3D,0x89,
+	0xFA,0xB7,0x0D,0x57,0xD3,0xB4,0xF5,0x37,0x55,0x37,0x2E,0xE6,0xB2,0xD7,0x57,0xFF,
+	0x0F,0x65,0x2C,0x96,0xAD,0x7B,0x6A,0x9F,0x66,0xE4,0x20,0x8D,0x9C,0x73,0xAB,0x5B,
+	0xDC,0xE2,0x96,0xB7,0xBA,0xF5,0x6A,0x66,0x28,0xA0,0xCE,0xD5,0xBB,0xDB,0xFD,0x1E,
+	0xE6,0x38,0xA7,0x36,0xCF,0x9C,0x80,0x51,0x8B,0xEB,0x52,0xD7,0xBC,0xFF,0x3F,0xA6,
+	0x2F,0xAA,0x05,0x5C,0xD6,0x8C,0xBC,0xC7,0x16,0x70,0x59,0x33,0xB2,0x95,0x0B,0xC1,
+	0xFD,0xCD,0xCC,0x66,0x3A,0xF3,0x51,0xAD,0x98,0x00,0x55,0x8B,0x67,0xDB,0xC7,0x3E,
+	0xD5,0xAD,0xEE,0x75,0x2F,0xE7,0x2C,0x4D,0x60,0xBE,0x26,0xDF,0xF1,0x89,0xEF,0xFF,
+	0x03,0x04,0xF8,0xA5,0x83,0x03,0x12,0xB0,0x80,0x07,0x22,0xB0,0xC2,0xEE,0x8D,0x45,
+	0x7D,0xC9,0xCA,0x67,0x29,0x42,0xF5,0x35,0x3B,0xDF,0xF9,0x28,0x66,0x0D,0x40,0xCF,
+	0xD7,0xB3,0x1C,0xCD,0xAC,0x06,0x14,0xB5,0x68,0x0E,0x7D,0xEE,0x4B,0xDF,0xD2,0x39,
+	0x5B,0x02,0x44,0xBD,0xCE,0x57,0xBE,0xF2,0x9D,0xEE,0x55,0x0A,0xC1,0x73,0x4D,0x7E,
+	0xF2,0xF3,0xFF,0x06,0x98,0x30,0x68,0xE4,0x6B,0x84,0xA0,0xE8,0xD3,0x93,0x8D,0xEC,
+	0x84,0x9E,0x4B,0x6E,0x36,0x8A,0x19,0x0D,0xA8,0xEA,0x71,0xAF,0x7A,0xDF,0xE7,0xB2,
+	0xAD,0xE0,0x00,0xD3,0x8B,0xEB,0x9E,0x8F,0x7C,0xA6,0x73,0xE5,0x40,0xA8,0x5A,0x1C,
+	0xAF,0x78,0xC5,0xDB,0xDF,0xFF,0x0F,0xA2,0x59,0x95,0x51,0xBA,0x17,0xF7,0x6A,0x95,
+	0xAB,0x38,0x42,0xE4,0x92,0x5D,0xEE,0x62,0x15,0x33,0x3B,0x50,0xD6,0x92,0x5D,0xAE,
+	0x6A,0xC5,0x04,0xA8,0x5A,0xBC,0xEB,0xDD,0xEC,0x76,0x77,0xBB,0xDF,0xD3,0x9E,0xF6,
+	0x32,0x97,0xBE,0xF5,0xAD,0xED,0xB3,0x34,0x81,0xF9,0x9A,0xFF,0x07,0xAB,0x1B,0x61,
+	0x94,0xDD,0xD6,0xDC,0xF1,0x74,0xDD,0x37,0xB9,0xE7,0xEA,0xD3,0x35,0xB3,0x1C,0xE1,
+	0xAF,0x6F,0x77,0xC7,0xB5,0xD4,0xE0,0x56,0x9C,0x77,0xDB,0x5A,0x9D,0xEB,0x98,0x8C,
+	0x61,0xC0,0x30,0xE9,0x1A,0xB0,0x80,0x05,0x14,0x30,0x6D,0xBB,0x06,0x24,0x20,0x01,
+	0x0E,0x10,0xA0,0x06,0xB5,0xFF,0x07,0x6E,0x3F,0x29,0x8D,0x98,0x95,0xCD,0x3D,0x00,
+	0xAB,0x38,0x95,0xE2,0xD4,0xEB,0x34,0x81,0x7A,0xF2,0x51,0x53,0x50,0x75,0xEB,0xCE,
+	0x76,0xB6,0xD3,0x95,0x8D,0x92,0x48,0x99,0xAB,0x77,0xBE,0xCB,0xDD,0x8E,0x71,0x96,
+	0x04,0x8C,0x5A,0x3C,0xE7,0x39,0xF7,0xAD,0x6E,0xF5,0x2A,0xD7,0x2A,0x85,0xE0,0xB9,
+	0x26,0x3E,0xF1,0xF9,0x7F,0x65,0x18,0x6D,0x90,0x2D,0xD6,0xEC,0xF6,0x56,0xB7,0xBC,
+	0xC5,0xAE,0xC7,0x30,0xA3,0x01,0x6D,0x2D,0xCE,0x8B,0x3D,0xDC,0xD6,0x3C,0x61,0x76,
+	0xC5,0x25,0x9B,0x08,0xE5,0x2E,0x22,0x1B,0x00,0x80,0x01,0x2B,0x87,0x38,0x60,0xE5,
+	0xED,0x08,0x58,0xC0,0x02,0x16,0xB0,0x80,0x06,0x34,0x40,0x80,0x76,0xD3,0xFE,0x1F,
+	0xAA,0x8D,0x63,0xA8,0xAA,0x66,0xAD,0xB9,0xA8,0xCB,0x08,0xDD,0x7C,0xFB,0x5B,0xDF,
+	0xFA,0x36,0xB7,0x39,0x6D,0xB5,0xA3,0x15,0xBA,0xF8,0x76,0xBB,0xDF,0xD3,0x9E,0xD7,
+	0xDA,0x5C,0x49,0xA5,0x2D,0xDE,0x7B,0xDB,0x6B,0x76,0x29,0xAF,0xC7,0x6D,0xEF,0x31,
+	0xD8,0x5C,0x1E,0xF7,0xBD,0x1E,0xF5,0x48,0xE7,0x28,0x89,0xE2,0xF2,0x38,0x5F,0xF9,
+	0xFE,0x7F,0x6B,0x68,0x2E,0xD8,0x2A,0x37,0xDF,0xFE,0xF6,0xA7,0xAF,0x21,0xBC,0xC4,
+	0x17,0xDF,0xFE,0xF6,0x67,0xC8,0x6A,0xC3,0x4D,0x3A,0xDF,0x61,0x4D,0x95,0x6C,0xA6,
+	0x71,0x9E,0xB1,0x36,0x98,0x53,0x49,0x5E,0xFB,0x5A,0x8E,0x0A,0x7A,0x43,0xD9,0x4F,
+	0x3C,0xC2,0x59,0xE0,0xF4,0x08,0xF9,0x09,0x67,0x03,0x31,0x19,0xA2,0x25,0x9E,0xFF,
+	0x0F,0x6E,0x5A,0xC1,0x99,0x54,0xB2,0x09,0x60,0x49,0x22,0x07,0xEC,0xA8,0x16,0x80,
+	0x5D,0x26,0xC7,0xD0,0xA3,0x92,0x78,0x74,0x3E,0x55,0x2F,0x21,0x6A,0xB1,0xFA,0x56,
+	0xB7,0xBA,0xD5,0xAD,0x6F,0x7D,0xBB,0x3D,0x8E,0x75,0xB4,0x22,0x36,0x7F,0x53,0xCF,
+	0x7E,0xB5,0x67,0x96,0x61,0x34,0xDB,0x52,0x9F,0xF4,0x8E,0xDC,0x88,0xE1,0x5F,0xF2,
+	0x9D,0xEF,0xFF,0x07,0x01,0x18,0x91,0xB9,0x00,0x4D,0x91,0x46,0x60,0x65,0x2D,0xB3,
+	0xB8,0x67,0xED,0x53,0xF4,0x14,0x64,0x11,0x4B,0x6E,0x79,0x8B,0x5B,0xDE,0xF2,0x74,
+	0xC3,0x05,0x6A,0xE7,0xEA,0x3D,0xEC,0x71,0x2F,0x6D,0x1F,0xB1,0x00,0x2B,0xDF,0xF4,
+	0xA3,0x1D,0xB3,0x24,0x60,0xD4,0xE2,0x7A,0xE5,0x2B,0xDF,0xE9,0x1E,0x43,0x48,0xA3,
+	0xEB,0xE4,0xFB,0xFF,0x01,0xA9,0xE8,0xC5,0xD8,0x73,0x16,0xCF,0xE2,0x0E,0xB7,0xBB,
+	0xCD,0xA9,0xBB,0x6F,0xF1,0xF0,0xD5,0xB7,0xBE,0xCD,0xEE,0xC6,0x50,0x63,0x72,0x98,
+	0x58,0xEE,0x73,0x5F,0xDB,0xD6,0x62,0x72,0x98,0x58,0xAE,0x7B,0xDD,0xD3,0x5E,0x45,
+	0x72,0x93,0xD8,0x8D,0x87,0x3D,0xEC,0x61,0xCF,0x70,0x96,0x58,0xE1,0xA2,0x4D,0xE2,
+	0x15,0xEF,0xFF,0x07,0x41,0xEE,0xD1,0xC8,0xB3,0x16,0xEF,0xEE,0xD4,0xC3,0x35,0x59,
+	0xC4,0xE3,0x5B,0xDD,0xEA,0x56,0xBB,0x59,0xED,0x92,0xCD,0x91,0xB4,0x78,0x4F,0x63,
+	0x19,0x9E,0x38,0x2C,0x9C,0xCE,0xA5,0xAF,0xF5,0x08,0xC7,0xB0,0xC2,0x61,0x1E,0x35,
+	0x1E,0xF1,0x8C,0x57,0xBC,0xD3,0xDD,0x4D,0x49,0xB8,0xCE,0x0E,0xF7,0x34,0xAD,0x16,
+	0xBC,0xF9,0xFF,0x01,0xA3,0x6D,0xB4,0xBA,0x8D,0xBC,0xAD,0xA6,0x92,0xEC,0x0E,0xF2,
+	0xB6,0xAB,0x5D,0x8C,0xA2,0xE0,0xEE,0x16,0xF6,0x3F,0xCB,0x39,0xCC,0xB1,0xAC,0x91,
+	0xE5,0x0C,0x8B,0xBF,0xB0,0x3B,0xD3,0x1D,0x28,0x59,0xE2,0xE9,0x4F,0x7B,0xF9,0xE7,
+	0xFF,0x01,0x02,0x88,0x26,0xD4,0x00,0x6D,0x96,0xB5,0xB8,0x25,0x05,0x89,0x6C,0x3D,
+	0xD2,0xE6,0x51,0xB3,0xA6,0xF4,0x48,0x67,0x09,0xA0,0x8C,0xC7,0x33,0x9B,0x79,0xCB,
+	0x67,0x0E,0x80,0xCA,0xD7,0xBD,0x6A,0xD5,0x72,0x06,0xB4,0xB5,0xBA,0xB7,0xBD,0xAF,
+	0x73,0x5D,0xF3,0x91,0x8F,0x78,0xFE,0x3F,0x0E,0x98,0xD5,0x28,0x02,0x11,0x18,0xE9,
+	0xCC,0x46,0x98,0xF1,0x66,0xA7,0x27,0x1D,0x21,0x99,0x92,0xB6,0xDC,0x7C,0x17,0xAB,
+	0x2C,0xD2,0x2D,0x13,0x3B,0xEF,0xAA,0x75,0xCE,0x94,0x47,0xD0,0xEE,0x3A,0xC4,0x29,
+	0x2F,0x61,0x35,0x31,0xA2,0x50,0xB6,0xF8,0xCD,0x1F,0xFF,0x0F,0xAB,0xC8,0x72,0x33,
+	0x93,0xBB,0xDC,0xEE,0xB6,0xB7,0xB9,0xF5,0x68,0x53,0x5C,0xA9,0xA6,0x4D,0xB3,0x6B,
+	0x73,0x0A,0xCB,0x71,0xD8,0xBB,0xAF,0x7D,0x2F,0x47,0xB6,0xC7,0xF4,0x94,0x37,0x9D,
+	0xA9,0x34,0xF8,0x53,0x97,0x78,0xFD,0x3F,0x6B,0x6E,0xD9,0x34,0x6C,0xE6,0xDC,0xF6,
+	0x36,0xB7,0xBE,0xF5,0x19,0xAA,0x0F,0x2D,0xDA,0x25,0x7B,0x19,0x5B,0x4D,0x9A,0xA2,
+	0xE7,0xB8,0x1D,0x23,0xA5,0x26,0x71,0x2A,0x03,0xFC,0x94,0xE6,0x01,0x0F,0x68,0x40,
+	0x03,0x12,0xE0,0x00,0x07,0x30,0xF0,0xFF,0x01,0xD8,0xB6,0xDD,0x01,0x2F,0xF4,0x38,
+	0x60,0xD5,0xD1,0x91,0x4D,0x97,0x84,0xE6,0x4B,0x4E,0x36,0xB2,0x10,0x67,0xCD,0x19,
+	0xD9,0x2C,0x01,0x94,0xF1,0x78,0x66,0x33,0xEB,0x79,0xAF,0x7B,0x57,0x87,0x36,0xAF,
+	0x52,0x08,0x9E,0x6B,0xEA,0x5A,0xB7,0x7A,0x94,0x73,0x45,0x47,0xAC,0x5A,0x9C,0xAF,
+	0xFF,0x07,0xA1,0x9F,0x9C,0x94,0x72,0x26,0x8D,0x76,0x07,0x55,0x90,0x78,0x3C,0xEB,
+	0x59,0x9D,0xA2,0x87,0x60,0x76,0xDA,0x72,0x8B,0x53,0x36,0xA5,0x64,0x2D,0x7B,0x6E,
+	0xB5,0xFA,0x24,0xDC,0x32,0xB1,0x73,0x1F,0xFA,0x1C,0x16,0xAB,0xC6,0xCA,0xE0,0xB5,
+	0xDF,0xCD,0xA1,0xD4,0x78,0x1B,0xB6,0x53,0x97,0x74,0xA7,0x21,0xBC,0xE4,0xFF,0x01,
+	0x66,0xF3,0xD2,0x38,0x43,0xB3,0xD8,0x2D,0xAC,0x4D,0xBB,0x70,0xB0,0xDB,0xB0,0x0E,
+	0x17,0x2C,0x26,0xAE,0xD3,0x32,0x6C,0xBB,0x32,0xAB,0x19,0x63,0xF7,0x21,0x6C,0x9C,
+	0xE5,0xD4,0x33,0xB6,0x80,0xCB,0x9A,0x9B,0xAF,0x6C,0xE5,0x42,0x70,0x7F,0xB3,0xB3,
+	0x9D,0xEE,0x7C,0x55,0x2B,0x26,0x40,0xD5,0xE2,0xD9,0xF6,0xB1,0x4F,0x75,0xAB,0x7B,
+	0x3D,0xCA,0x35,0x4B,0x13,0x98,0xAF,0xA9,0x57,0x7E,0xF3,0x97,0xBE,0x19,0x0B,0x31,
+	0xF3,0xCD,0xFF,0x03,0xA1,0xDE,0xC2,0x44,0xC2,0xFC,0x9C,0x6A,0x88,0x70,0x09,0x59,
+	0x7B,0x8A,0xCA,0x3B,0x3D,0xA4,0xCF,0xCD,0x56,0x96,0xC4,0xA6,0xBB,0xF4,0x6E,0x59,
+	0xE2,0x9D,0xEA,0xE2,0x4A,0xD5,0x12,0x65,0xBB,0xB3,0xEB,0x51,0x57,0x12,0x99,0xC1,
+	0xD9,0x6E,0xB7,0xC7,0x31,0x35,0x92,0x6A,0xC9,0x9B,0xC7,0x34,0x4C,0x12,0x46,0x6C,
+	0x99,0x73,0x5F,0xDA,0xD2,0x92,0x92,0x64,0x6C,0xEE,0x6B,0xD9,0x6A,0x22,0x71,0x8F,
+	0xCF,0xE5,0x2C,0x41,0xD4,0xDD,0x36,0xA5,0x3B,0x19,0xF5,0x0C,0xEE,0x13,0xEF,0xFC,
+	0x9A,0xD7,0x85,0xC8,0x62,0xEE,0x6D,0xBF,0xFF,0x07,0xAD,0x68,0xC9,0xC5,0x32,0x56,
+	0xDF,0xFA,0x54,0x2D,0x35,0x7B,0xF8,0xEA,0x5B,0xDD,0xE6,0x4C,0x6D,0x04,0xA6,0xC5,
+	0xEA,0xB9,0x84,0xB5,0x75,0x23,0x37,0x4F,0x83,0x40,0x11,0xCA,0x5D,0x44,0x36,0x00,
+	0x28,0xA0,0xE6,0x31,0x0F,0x68,0xC0,0x00,0xBF,0x8D,0x79,0xC0,0x03,0x16,0xD0,0x00,
+	0x07,0xFE,0x1F,0x6A,0xB1,0xA2,0xA7,0x95,0xD2,0xD8,0x25,0x0F,0xA3,0x2D,0xB2,0x7A,
+	0x1C,0xB3,0xDE,0xE6,0xD4,0x45,0x6D,0x56,0xCA,0x9A,0x5B,0xDF,0xFA,0xB6,0xBB,0xDB,
+	0xFD,0x1A,0x8A,0x6F,0x2B,0xF3,0x37,0x7B,0x19,0x4B,0xD3,0x25,0x39,0xFA,0xB9,0x6F,
+	0x6D,0xEB,0x31,0xC4,0x5C,0x1E,0xF7,0xAD,0x1F,0xE5,0x1C,0xA5,0x48,0x5C,0x1E,0xD7,
+	0x2B,0x5F,0xF9,0xFA,0x7F,0x6D,0xFD,0xC6,0x5C,0x95,0xD5,0xF5,0xD5,0x02,0x7B,0x5D,
+	0xFD,0x51,0x2D,0x2A,0xE4,0x77,0x75,0xA3,0x3A,0xB1,0xFA,0x9B,0x5D,0xEF,0x6A,0x55,
+	0x33,0x27,0x60,0xD4,0xE2,0xD9,0xCC,0x76,0x4E,0x73,0x9D,0x7B,0x3F,0xFB,0x59,0xAE,
+	0x55,0x0A,0xC1,0x73,0x4D,0xBD,0xEA,0x9D,0x9E,0x15,0x12,0xA0,0x6B,0x75,0x7E,0xFE,
+	0x1F,0xAD,0xED,0x6A,0xDC,0x4B,0x57,0xEF,0xF6,0xB4,0x53,0x6C,0x6A,0x4B,0x97,0x53,
+	0x77,0x7E,0x19,0xC9,0x9B,0x57,0x99,0xCC,0x7B,0x9A,0x6E,0x9E,0x45,0x2B,0xA2,0xA9,
+	0x0A,0x91,0xCC,0xB5,0x00,0x02,0x14,0x67,0xA1,0x80,0x16,0x2C,0x3C,0x60,0x80,0xE6,
+	0x2C,0x4A,0x51,0x54,0x47,0x38,0x6F,0xDE,0xC3,0x5D,0xF6,0x36,0xF7,0x7A,0xE5,0xFB,
+	0xFF,0x01,0x61,0x5A,0xBA,0xC2,0xDD,0x62,0x85,0xD6,0xE8,0x15,0x59,0xB1,0x97,0x9A,
+	0x30,0xD5,0xBC,0x85,0xDF,0xA8,0x63,0x0F,0xE9,0x50,0xE5,0xA7,0xCA,0x6E,0x22,0x5D,
+	0x57,0xEF,0x72,0x97,0xB3,0x2A,0x6D,0x74,0x15,0xE9,0xBA,0x3A,0xF6,0x66,0xE8,0x3E,
+	0xD4,0x5C,0x65,0xD7,0x31,0x2D,0x95,0x54,0xBB,0x8B,0xDF,0xD9,0xAE,0xB1,0xA1,0xAC,
+	0x0E,0x51,0x3F,0xE7,0xB6,0x14,0xD2,0x35,0x4E,0xEE,0xFB,0x5E,0x77,0xB3,0x7B,0xDF,
+	0x19,0x2C,0x7D,0xEC,0xE9,0x2F,0x73,0x05,0xDF,0x19,0x2C,0x7D,0xF8,0xF3,0xFF,0x06,
+	0xD8,0x2D,0x2C,0x01,0x33,0xB7,0x67,0x60,0xC4,0x35,0x94,0xAA,0x5A,0xEA,0x93,0x15,
+	0xD7,0xAA,0x23,0xEE,0x56,0x9E,0xD3,0xAA,0x2E,0xE5,0xDB,0xF9,0xC8,0x4B,0x6A,0x8E,
+	0xE3,0x3E,0x33,0x2F,0x45,0x6E,0x62,0x39,0x9A,0x76,0x74,0x4D,0xA5,0xA5,0x73,0xD2,
+	0x3B,0xAC,0xA9,0xD9,0x61,0x0D,0xDF,0x32,0xE6,0xEE,0x0A,0x39,0xE3,0xF3,0x58,0x97,
+	0x2D,0xC2,0x8C,0x2D,0x7D,0x4D,0xE7,0xCC,0x09,0x18,0xB5,0x38,0x5E,0xFE,0xFE,0x7F,
+	0x02,0xE8,0x54,0x6D,0xB5,0x35,0x84,0xB9,0xDA,0x9A,0x5B,0x9F,0xAA,0x98,0x71,0x77,
+	0xDB,0x7C,0x8A,0x64,0x2F,0x5C,0xBD,0xF7,0xCA,0x33,0x9F,0x4A,0x95,0x2C,0x2D,0xCB,
+	0xD2,0xAA,0x95,0xDD,0x9A,0x7C,0x7B,0x15,0xD2,0x48,0x8C,0x40,0x11,0xCA,0x5D,0x44,
+	0x36,0x28,0xE0,0x47,0x73,0x01,0x24,0xEA,0xB2,0xBA,0x6A,0xC2,0xC3,0x7C,0xCB,0x1D,
+	0xCF,0xD6,0x54,0xA5,0x87,0x74,0xDD,0xE7,0xBA,0xAB,0x1A,0xF3,0x94,0xCE,0xFD,0xC9,
+	0xEF,0xFF,0x03,0x2B,0x6F,0xB1,0xD9,0xD3,0x36,0xDF,0xF6,0x36,0xB7,0x26,0x85,0x08,
+	0xE5,0x2E,0x22,0x1B,0x20,0x00,0x25,0xAC,0x2A,0x20,0xCF,0xD3,0x52,0x45,0x53,0x6A,
+	0xA9,0x9E,0x4F,0x9B,0x54,0x47,0xB9,0xE4,0xDF,0xC3,0x1C,0xC6,0x98,0x45,0x65,0xBB,
+	0x78,0x9F,0xCB,0x5C,0xD2,0xEA,0x43,0x67,0xB0,0xE5,0xCD,0x7B,0x38,0x9D,0xAD,0x2C,
+	0x15,0x37,0xF1,0xFC,0x7F,0x08,0x98,0xB1,0x53,0x02,0x1E,0x88,0xC0,0xCA,0x8B,0xDA,
+	0x4A,0x97,0x2E,0xB7,0xBA,0xD5,0x2A,0x73,0xE8,0x48,0xD3,0xCD,0xAD,0xA8,0x35,0xA2,
+	0xC5,0xAA,0x90,0x42,0x84,0x72,0x17,0x91,0x0D,0x0A,0xA8,0xA1,0xC5,0x01,0xAF,0xF8,
+	0x78,0x40,0x01,0x6F,0xB5,0x23,0xA0,0x47,0x53,0x0C,0x44,0xC0,0x03,0xAD,0x49,0x85,
+	0x53,0x53,0xDD,0x8D,0x26,0x56,0xCB,0x70,0xCD,0xB7,0xA6,0x64,0xC7,0x2B,0x39,0xEF,
+	0x5A,0xAA,0xB8,0xF4,0xE2,0x3E,0xF3,0x1C,0x57,0x0E,0x1D,0x69,0xBA,0xD9,0x5F,0x08,
+	0x14,0xA1,0xDC,0x45,0x64,0x03,0x80,0x00,0x8E,0xE0,0x30,0xC0,0xB2,0x53,0x04,0xA8,
+	0xCA,0xE5,0xFF,0x01,0x0A,0x88,0xA1,0x71,0x15,0x85,0x76,0x45,0x8A,0xFF,0x9B,0xDF,
+	0x6C,0x65,0x99,0x5C,0xB7,0x72,0xDE,0x9D,0xED,0x72,0x77,0x73,0x6C,0x4B,0x54,0x35,
+	0x63,0xE4,0xA6,0xEE,0xF9,0x34,0x57,0x94,0x39,0x63,0xE4,0x86,0x5F,0x04,0x98,0x34,
+	0xDD,0x02,0x0E,0x98,0x32,0x5D,0x03,0x12,0xE0,0xC0,0xFF,0x03,0x08,0xC8,0x4A,0x8C,
+	0x03,0x1A,0x68,0x49,0x0B,0xAC,0xE5,0x11,0xFA,0x14,0xCD,0x35,0x59,0xC4,0xE3,0x5B,
+	0xEC,0xBC,0xA5,0xD5,0x88,0x96,0x99,0xBD,0x9E,0x95,0x3C,0x1B,0xB3,0x64,0x69,0x1A,
+	0xEB,0xD2,0xA7,0xA9,0x1C,0xE6,0xD1,0xDB,0x98,0x07,0xA7,0x5A,0xAA,0x5F,0x53,0x4D,
+	0xAA,0x61,0x9E,0x7D,0xAC,0xDD,0x8E,0x48,0xC8,0x9E,0xB1,0x77,0x5B,0x44,0x95,0xAB,
+	0xEB,0x15,0xAE,0x1E,0x0D,0x2D,0xF3,0x4D,0x7C,0xFC,0xF3,0xFF,0xA3,0x9D,0xD6,0x99,
+	0x32,0x17,0xAF,0x66,0x86,0x16,0x74,0x5F,0x73,0x9A,0xE1,0x4A,0xC4,0xF4,0xCE,0xAD,
+	0x46,0xD1,0x1D,0x5A,0x46,0x3A,0x99,0x45,0x2B,0xAA,0x82,0xAC,0x08,0x27,0xBE,0x5A,
+	0xDD,0x0C,0x25,0x42,0xBC,0xFB,0xF4,0xD3,0x17,0x61,0xF8,0x96,0x3B,0xDC,0xF1,0x4C,
+	0xDD,0x26,0x4B,0xD9,0x9E,0xBB,0xAC,0xB5,0xBB,0x36,0x0D,0xDA,0x7B,0xF6,0xA6,0xD3,
+	0x3A,0xA5,0xF7,0x7E,0xE7,0x3B,0xBF,0xF2,0x55,0x17,0xD6,0xCE,0xAB,0xFD,0xFF,0xFF,
+	0x61,0x5D,0x96,0x49,0x34,0xD2,0x06,0x60,0xC7,0x90,0x0C,0x8C,0x66,0xF6,0x15,0x22,
+	0x4D,0x37,0xAA,0x6A,0xC8,0x2C,0x6D,0xCD,0x28,0xB2,0x15,0x8B,0xE4,0x35,0xB3,0x68,
+	0x79,0x51,0xE6,0xDA,0x9C,0xBE,0x15,0x43,0x89,0xF0,0xA2,0xDB,0x95,0x77,0xA7,0xA6,
+	0x66,0x49,0x77,0xB1,0x9A,0x9E,0x0A,0xD5,0x75,0xEB,0xEE,0xF6,0xB0,0xC6,0xE6,0x83,
+	0xD2,0xE3,0xEB,0x5E,0xD7,0xDA,0x5C,0x48,0x87,0x6D,0x9E,0x7B,0xDF,0xF3,0x89,0x40,
+	0x11,0xCA,0x5D,0x44,0x36,0x00,0x38,0x60,0xEA,0x8C,0x00,0x2C,0xB3,0x6D,0x01,0x01,
+	0x14,0x5F,0x8E,0x81,0xFF,0x07,0x06,0xD8,0x29,0x25,0x01,0x5D,0x22,0x7B,0xA0,0x85,
+	0x33,0x1A,0x52,0xD7,0xDB,0x19,0xCF,0x68,0x44,0xD3,0x29,0x51,0x79,0xBC,0x99,0xAC,
+	0x6C,0x71,0x0B,0x4D,0xCA,0xB6,0xC7,0x35,0x55,0xEE,0x39,0x4E,0x7D,0xEF,0xBA,0xD6,
+	0xC2,0x32,0xAB,0xB8,0xEF,0xDE,0xDB,0x99,0x4C,0x65,0x2B,0xF5,0xED,0x67,0xB9,0x7D,
+	0xAC,0x6C,0xD4,0x35,0xF1,0x8E,0x4F,0x78,0x83,0x9A,0xCA,0x20,0xBF,0xEE,0x4F,0x62,
+	0xBC,0x82,0xF4,0xFD,0x3F,0x61,0x5A,0x90,0xBA,0xC0,0xD7,0xA6,0x69,0x00,0x19,0x85,
+	0x6A,0xDA,0x9A,0xCD,0x24,0xD9,0xCC,0xCB,0x29,0x46,0x76,0x66,0xF5,0x37,0x3B,0x9B,
+	0xC9,0x48,0x7B,0x50,0xD4,0x8E,0xD9,0xBD,0xA8,0x75,0x6B,0xB3,0x62,0xEE,0xF4,0xB8,
+	0xB5,0xAD,0xFD,0x98,0x8A,0x51,0x0E,0x91,0xB4,0xA3,0x6F,0xBC,0x32,0x8B,0x3A,0xDF,
+	0xE1,0xEE,0xE3,0xCC,0x6A,0x23,0x43,0x57,0xF5,0xA7,0xBE,0xF5,0xFD,0x7F,0x66,0x31,
+	0x3C,0x7C,0x52,0xE3,0xC4,0x69,0xF5,0x85,0x57,0x86,0x51,0xAA,0xD3,0x56,0x75,0xA1,
+	0x69,0x9D,0x6F,0x7D,0xCA,0x6A,0x57,0x23,0x6D,0xF5,0xCD,0x57,0xD1,0x4B,0x50,0x78,
+	0x2C,0xDA,0x75,0x69,0x46,0x77,0xB4,0xCE,0xDB,0xB1,0x45,0xAD,0x08,0xE5,0x2E,0x22,
+	0x1B,0x00,0x18,0xD0,0x3C,0x91,0x03,0x5A,0x09,0xB1,0x80,0x00,0xB2,0x13,0xFE,0x7F,
+	0x6A,0x2B,0x02,0x62,0x4B,0xE3,0xDA,0x75,0x2C,0x5D,0x87,0xB8,0x73,0x9B,0xD5,0x66,
+	0x1D,0x16,0x66,0x7D,0x57,0x9B,0x45,0x59,0x07,0xB7,0x6B,0x55,0xB0,0x99,0xCD,0x9C,
+	0xAD,0x56,0xA1,0x88,0xCE,0x3A,0x99,0x33,0xFB,0xC5,0xCC,0xD5,0xA8,0xA5,0xA9,0x1B,
+	0xDF,0x8E,0xBA,0x05,0xB3,0x34,0xED,0x7C,0xCB,0x9B,0x8F,0xAC,0x38,0xCB,0x0C,0x6D,
+	0x5C,0xB2,0xA2,0x94,0xDA,0xCD,0x4D,0x2C,0x55,0x2B,0x75,0x4A,0xA7,0xBB,0xD5,0x3D,
+	0xA4,0x2D,0x77,0xE5,0x2A,0xEE,0x9C,0xD7,0xB4,0x65,0x77,0xA0,0x9B,0xFA,0xE2,0x9E,
+	0xAE,0x5C,0x0B,0xAA,0xD4,0xB7,0xBF,0xFD,0x6D,0x9E,0xE2,0x1A,0x7C,0x43,0xAF,0x7A,
+	0xCB,0x30,0xCA,0xE6,0x2D,0xFF,0x0F,0x6B,0xC8,0xE2,0xB2,0x42,0x3A,0xDF,0xFA,0x16,
+	0x27,0x4F,0xAE,0x7D,0xC4,0x17,0xB7,0x2C,0x45,0xAF,0xA4,0xB6,0x6D,0x80,0x03,0xD8,
+	0x0C,0xF0,0xA7,0x9B,0x07,0x3C,0xE0,0x80,0xEB,0xB5,0xC1,0x6C,0x4D,0x5D,0x45,0x69,
+	0xDC,0xD4,0x17,0x37,0x49,0x26,0x4A,0x5B,0x9B,0x53,0x91,0x0D,0xE7,0x9D,0xFD,0x1C,
+	0xDB,0x92,0x9B,0x61,0xB5,0xF4,0x9E,0x5B,0xDD,0xEB,0x99,0xEE,0x12,0x07,0x75,0x52,
+	0x6F,0xFE,0xC2,0x5F,0x5A,0x91,0x0E,0x67,0xF9,0x7F,0x0A,0x70,0x4A,0xB5,0xA5,0x45,
+	0x55,0x84,0x49,0xCC,0x93,0x66,0xD7,0x19,0x26,0x4B,0x4E,0x96,0xDD,0x44,0xBA,0xAE,
+	0xBE,0xD9,0xCC,0x10,0x28,0x42,0xB9,0x8B,0xC8,0x06,0x60,0x80,0xF1,0xE9,0xAB,0xCA,
+	0xA6,0x23,0xD4,0x36,0xDF,0xE1,0x8C,0x55,0x74,0x86,0x6B,0x9F,0xB1,0x67,0xBD,0xE1,
+	0xE6,0xBB,0xDB,0x97,0x53,0x45,0x88,0xCF,0xAE,0xDF,0xFF,0x03,0x0C,0x88,0x7E,0x8C,
+	0x02,0xA5,0x0A,0x31,0xDD,0x5C,0xB2,0xAC,0x26,0x5B,0xCF,0x4C,0xEE,0xBB,0xBB,0xDE,
+	0xA7,0xCD,0xA8,0xB4,0x75,0x4D,0x1C,0xB7,0xD1,0xD5,0x28,0xEE,0xE6,0x5B,0x76,0x7B,
+	0x9A,0x1A,0xC4,0x33,0xF3,0xF1,0x6D,0x76,0x3F,0xE7,0xB6,0xB6,0xEC,0x12,0x91,0x9B,
+	0xF2,0x8E,0x40,0x11,0xCA,0x5D,0x44,0x36,0x80,0x00,0x7A,0x2F,0x53,0x40,0x2D,0x24,
+	0x14,0xF8,0x7F,0xA2,0xD5,0x39,0x38,0xCA,0xEC,0xDB,0xA5,0x4C,0xA1,0x98,0x5A,0xB9,
+	0xF2,0xD3,0x47,0x6F,0xE9,0x69,0xCA,0x4E,0xDD,0x89,0x57,0x0E,0x69,0x3F,0x45,0x61,
+	0xD9,0x95,0x98,0x65,0x67,0x25,0x6B,0x86,0x64,0x4C,0xAC,0xF5,0xE2,0x54,0xCD,0x86,
+	0x7A,0xD0,0xE6,0x35,0x4C,0xD7,0x02,0xA5,0x7B,0xF6,0xB0,0xA7,0xBD,0xAC,0xB5,0xAA,
+	0x54,0x1D,0xDB,0xB2,0xF6,0xEC,0xC3,0xD3,0x64,0x73,0xD9,0x63,0xC8,0x2C,0xD5,0xDF,
+	0xE9,0x0C,0xA1,0x33,0xD8,0xF2,0xE6,0x33,0x5E,0xEE,0x09,0xB6,0xB2,0x54,0xDC,0xF8,
+	0xE7,0xFF,0x01,0x0C,0xF8,0xAD,0xDC,0x02,0x1E,0xB0,0x80,0x06,0x4A,0xDE,0x7D,0x90,
+	0xB8,0xBD,0x1E,0xD5,0xC8,0x45,0xE8,0xF6,0x76,0x56,0xB3,0xDE,0xF5,0xAD,0x4F,0x35,
+	0x72,0xB1,0xB8,0xAE,0x39,0x65,0x0F,0x45,0x56,0xFA,0xE5,0xE4,0x25,0x24,0xE5,0xC8,
+	0xE6,0x91,0xC6,0xC9,0x99,0x6E,0x69,0x7B,0xDA,0xF3,0xD5,0xA4,0xA4,0x95,0x6E,0x5D,
+	0xF6,0xB0,0xB7,0xB5,0x17,0x5B,0xD6,0x2A,0x9B,0xC7,0x9D,0x5D,0x5B,0x9B,0xEF,0xEA,
+	0x77,0x7D,0xCA,0x5F,0x55,0xD9,0x94,0xF4,0xFE,0x7F,0x0E,0x58,0x5A,0xC3,0x02,0x27,
+	0xEB,0xA1,0xC4,0x2B,0x97,0xDC,0xF2,0x16,0x27,0xEF,0x51,0xB9,0x2A,0x2B,0xEF,0xAC,
+	0x64,0x3D,0x60,0x79,0x99,0xE2,0x52,0x74,0x8F,0x9E,0x56,0xAA,0x43,0x99,0x24,0x75,
+	0x5A,0x3A,0x0E,0x4D,0x31,0xC1,0xAC,0x96,0x24,0xCD,0x35,0x96,0x38,0xC9,0xAA,0xD6,
+	0x25,0x17,0x96,0xA6,0xBB,0xE7,0xB0,0xA6,0x2C,0x2A,0xDB,0xC5,0xFB,0x9E,0xE6,0x92,
+	0x76,0x1F,0x3A,0x83,0x2D,0x6F,0x3C,0xC3,0xE5,0x6C,0x65,0xA9,0xB8,0xF1,0xB7,0xBD,
+	0xFF,0x1F,0x61,0x3D,0x56,0x98,0xD4,0xB6,0xE6,0xA5,0x8D,0xC7,0xA8,0x01,0xC5,0xDA,
+	0x33,0x2C,0x97,0x06,0x12,0xD9,0x4F,0xD9,0x6D,0x30,0xA6,0x65,0xDF,0x79,0x4B,0x8B,
+	0x11,0xCF,0xE0,0xAE,0x29,0xCD,0x4E,0x5D,0x38,0xEA,0xF5,0xF4,0x64,0x45,0x47,0x84,
+	0xCA,0xE6,0x5D,0xF5,0x96,0x01,0xCD,0x97,0x6A,0x40,0x03,0x1A,0x28,0x5D,0xD0,0xDB,
+	0x61,0xEC,0x7D,0xF7,0x7B,0x3C,0x53,0x16,0xDB,0x9A,0xEA,0xF5,0x2E,0x6B,0x2D,0x6A,
+	0x43,0x46,0xBC,0xCD,0xB3,0x3D,0xD9,0xB5,0xDA,0x70,0xDF,0x72,0xE7,0x94,0xEA,0xCD,
+	0x9D,0xDD,0x9D,0xBC,0x73,0xA9,0x28,0x35,0x4F,0x12,0x41,0xE1,0x96,0xD4,0x3D,0x4D,
+	0x24,0xA7,0x8A,0x94,0xF8,0xFA,0x37,0x7C,0xCD,0x76,0x78,0x50,0xEA,0xF8,0xFD,0x3F,
+	0x6E,0x2D,0xCA,0xD8,0x43,0xD5,0x99,0xBD,0x58,0xE6,0x70,0xF1,0x9A,0x97,0xD5,0xB6,
+	0x54,0xAA,0x26,0x7D,0x6E,0xB5,0xB2,0xD6,0x8D,0x4D,0x74,0xCB,0x4E,0x4D,0x3C,0xB2,
+	0xAA,0x8B,0x38,0x16,0x40,0xE5,0x8C,0x18,0x40,0xA0,0x08,0xE5,0x2E,0x22,0x1B,0x0C,
+	0xB0,0xED,0xA4,0x02,0xAA,0x15,0x5A,0x43,0xF5,0x21,0x54,0x96,0x6D,0x2C,0xA5,0x26,
+	0x7A,0xB9,0xB7,0xBE,0xA5,0x27,0x57,0x87,0x2E,0xF7,0x1F,0xFE,0xDC,0x49,0xBB,0xBC,
+	0x6F,0xFC,0xFD,0xEF,0xFF,0xFF,0x07,0x04,0x88,0xAE,0x8C,0x03,0x12,0x08,0x51,0x74,
+	0x65,0xE9,0xEC,0x68,0x24,0x59,0x46,0x78,0x41,0xD7,0x13,0x37,0x6D,0x62,0xC3,0x5B,
+	0x6F,0xDC,0xD2,0xEA,0x54,0xD2,0xE3,0x89,0x01,0x7E,0x2B,0xF7,0x80,0x07,0x14,0xD0,
+	0xE5,0x15,0x38,0x60,0x8C,0x70,0x03,0x04,0x29,0x36,0xBA,0x5E,0x14,0x34,0x72,0xF6,
+	0xE8,0xA7,0x6F,0x82,0xF4,0x2D,0x73,0xEA,0x47,0x3A,0x67,0x6A,0xC0,0xF0,0x2F,0xF1,
+	0x4E,0xCF,0xA8,0x8A,0x1C,0xB9,0xD8,0xFF,0xEE,0x1F,0xBB,0x59,0xD0,0xD6,0xFE,0x3F,
+	0x69,0xAE,0xDE,0x34,0x3A,0x6B,0x9F,0xAC,0xA5,0x66,0x0F,0x5F,0x7D,0x8B,0x5B,0xAD,
+	0xAA,0x8D,0xC0,0xB4,0x58,0xDD,0xDB,0xD0,0xB6,0x6E,0xE4,0xE6,0x69,0x10,0x28,0x42,
+	0xB9,0x8B,0xC8,0x06,0x10,0x40,0xCD,0x63,0x1A,0x60,0xC0,0x6F,0x63,0x1C,0xA0,0x00,
+	0x5B,0xFD,0x54,0xEA,0x54,0xE7,0x66,0x4E,0x8D,0xC3,0xD3,0xF4,0xE6,0xA9,0x4F,0x6B,
+	0xAE,0x2E,0x39,0x42,0xFB,0xEE,0x6D,0x1C,0xCD,0x24,0x45,0xF9,0xE7,0x7E,0xF6,0x33,
+	0x5F,0xF9,0x0A,0xCF,0xB4,0x4B,0x94,0xBE,0x27,0x3E,0xF1,0x75,0xEF,0xCC,0x09,0x18,
+	0xB5,0xF8,0xFF,0x01,0x6E,0xEF,0x42,0x58,0xB6,0x6B,0xA7,0x7D,0x68,0x25,0xCC,0x59,
+	0xB4,0xF6,0x11,0x82,0xC8,0x6A,0xF1,0x1A,0x46,0x2E,0x12,0x8D,0x37,0xA7,0xEF,0xC9,
+	0xC9,0xA3,0x6E,0x9F,0x76,0xD4,0x22,0x73,0x7F,0xB4,0xEA,0x51,0x0B,0x2D,0x62,0xE2,
+	0xA8,0x47,0x43,0xD7,0x2E,0x29,0xAE,0x4D,0x92,0xAA,0x28,0x5C,0x8B,0xB9,0x6A,0xEB,
+	0x24,0x95,0xE3,0x80,0x1D,0x93,0x35,0x90,0xBA,0x59,0x03,0x45,0xB3,0x75,0x19,0x46,
+	0x27,0x96,0x98,0xC5,0x65,0x1F,0xCD,0x88,0xBC,0x16,0xD7,0x3D,0x3D,0x63,0x10,0x49,
+	0x6E,0xED,0xF8,0xFA,0xEF,0xFF,0x01,0x6D,0xFE,0xDE,0xC4,0xC4,0xE8,0x29,0x60,0x00,
+	0x2E,0x0F,0x9C,0x6C,0x29,0x71,0x2A,0x4E,0x77,0x93,0x15,0x77,0x2A,0xAE,0xC3,0xCE,
+	0x76,0x3C,0x92,0xA5,0x44,0x78,0xD1,0x6D,0xCF,0x47,0x3B,0xB8,0xBB,0x07,0xF6,0x5B,
+	0x43,0x91,0x6E,0xA9,0xF2,0x65,0x4C,0xC9,0x98,0x97,0x69,0x9F,0xBA,0xE5,0x33,0x9C,
+	0xC1,0x9A,0x8F,0xCA,0xDE,0x70,0x07,0x9D,0xEE,0xC9,0x79,0xE2,0xED,0xFF,0xFF,0x07,
+	0x63,0xC9,0xA6,0x2A,0x54,0xD7,0x9C,0xA5,0xF0,0xEC,0x0A,0xCA,0xBB,0x67,0xB6,0x1B,
+	0xD9,0xA6,0xAA,0x59,0xE9,0x46,0x8E,0x20,0xC2,0x83,0x25,0x0B,0x39,0x1D,0x4D,0x4D,
+	0x77,0x37,0x76,0x1A,0x55,0x54,0x53,0xA9,0x94,0x65,0x17,0xAB,0xC8,0xAC,0xDA,0x53,
+	0xB9,0xEF,0x72,0x35,0x51,0x5E,0x58,0xAB,0xFE,0xD5,0x66,0xB5,0x12,0x23,0xFA,0xD7,
+	0x94,0x63,0x53,0x95,0xF8,0x69,0x6B,0xEE,0x4E,0x51,0xE2,0x2F,0x6C,0xB9,0x13,0x57,
+	0x59,0x7F,0x04,0x8A,0x50,0xEE,0x22,0xB2,0x01,0x1C,0xB0,0x9D,0xBA,0x03,0x7E,0x0F,
+	0x53,0xC0,0x48,0x53,0x08,0x88,0xD2,0xEC,0xFF,0x01,0x63,0xCF,0xA6,0x2A,0x54,0xD7,
+	0xDC,0x6D,0xAD,0x85,0x67,0x57,0x50,0x5E,0x76,0x1A,0xD9,0xA6,0xAA,0x59,0xF9,0x26,
+	0xB6,0x20,0xC2,0x83,0x25,0x0B,0x5B,0x1C,0x4D,0x4D,0x77,0x37,0xA1,0x6F,0xD4,0x45,
+	0xCD,0xB2,0xAC,0xBE,0x98,0xCD,0x34,0xDD,0x72,0xDA,0xAA,0xDA,0x2B,0x79,0xCD,0x6D,
+	0x6F,0x77,0xC7,0xBD,0x94,0x23,0xA4,0xCE,0x22,0xDB,0x15,0x8F,0xF0,0x45,0xEB,0x55,
+	0xC2,0x79,0xC4,0x2F,0x42,0xB9,0x8B,0xC8,0x06,0x00,0x03,0x4C,0xA7,0xEE,0x80,0xD7,
+	0x53,0x09,0x50,0x83,0xCB,0xFF,0x03,0xAD,0xAD,0xA1,0xD5,0xC4,0x5A,0x9F,0xB1,0xFA,
+	0x14,0xB3,0x78,0xBC,0x87,0x31,0x55,0x9B,0xEC,0xC2,0x6B,0xC4,0xE6,0xB9,0xDB,0xB8,
+	0x97,0x24,0x87,0xA6,0x99,0x59,0x61,0x4B,0x1C,0x05,0x63,0x56,0x79,0x6C,0x05,0x4C,
+	0xC5,0x14,0x81,0x35,0xB4,0x98,0xAC,0xAE,0x7D,0x6E,0x77,0xAA,0xE2,0xD2,0x5A,0x63,
+	0xD5,0xAD,0x6E,0xBD,0xBA,0xE2,0xD3,0x8A,0xAB,0xF2,0x1C,0x15,0x50,0x41,0x8A,0x03,
+	0x7E,0x29,0xF1,0x80,0x05,0x2C,0xA0,0x01,0x01,0xFC,0xD6,0x2A,0x01,0x60,0xC0,0x0B,
+	0xEC,0x16,0x60,0x40,0xB7,0x63,0xFF,0x0F,0xA5,0xCF,0xC6,0xAB,0x55,0x5B,0xAF,0x39,
+	0xDA,0xC9,0x54,0xDD,0xBC,0xC6,0xC2,0x3C,0x27,0x20,0xCF,0x1C,0xD7,0x30,0xB0,0x45,
+	0x16,0x69,0x1D,0xC3,0x11,0xE4,0x59,0x8A,0x7C,0xB5,0x9B,0x8B,0xD9,0x30,0xB7,0xD3,
+	0x76,0x19,0x9A,0x25,0x59,0x57,0x59,0xEC,0x11,0xAF,0xE8,0xD9,0xF9,0x2A,0x8A,0x1D,
+	0xF0,0x75,0x3F,0x73,0xAC,0x87,0x3B,0xA2,0x0B,0xAA,0x2B,0xCF,0xE4,0x10,0xA1,0xDC,
+	0x45,0x64,0x03,0x00,0x80,0x01,0x66,0x36,0x33,0xC0,0xAB,0xD5,0x0A,0x68,0x25,0x85,
+	0x02,0xFF,0x0F,0x65,0x0D,0xFA,0x3B,0x84,0xFB,0x8D,0x2E,0xB1,0x9D,0x34,0xCA,0xBA,
+	0xAB,0x5D,0xEC,0x62,0x15,0x89,0x5F,0xA7,0x49,0xB6,0x5D,0xEF,0x6E,0x0E,0x73,0x99,
+	0xEB,0x3C,0xCA,0x11,0x65,0xCE,0x18,0xB9,0x89,0x67,0xBC,0xDC,0x15,0xF8,0xE5,0xA0,
+	0xE6,0x71,0x77,0x94,0x51,0x8F,0x96,0xE6,0xFF,0x01,0x69,0xEA,0xA5,0x45,0xD2,0x57,
+	0xEF,0xF1,0x0E,0x77,0xB8,0xDD,0x6D,0x4F,0x53,0x43,0x49,0x79,0xCC,0xDE,0x5D,0x19,
+	0x9B,0x08,0x2C,0x31,0xA7,0x6E,0x49,0x3C,0x39,0xC5,0xBC,0xEA,0x07,0x81,0x22,0x94,
+	0xBB,0x88,0x6C,0x00,0x06,0x44,0x16,0xC6,0x80,0x5F,0xD3,0x39,0xC0,0x01,0x0E,0x50,
+	0x00,0x03,0x18,0xF8,0x7F,0xA9,0x6B,0x21,0xB9,0x22,0x66,0x9F,0xAE,0xC7,0xE1,0x70,
+	0x7B,0x72,0xBB,0x5B,0xDF,0xEA,0x56,0xBB,0x5C,0x65,0xCB,0x66,0xC5,0x3D,0x67,0xD7,
+	0xAB,0x6D,0x2E,0x64,0x30,0x93,0xEE,0xB1,0xCD,0x3D,0x92,0xB9,0x9A,0xDA,0xB2,0x8E,
+	0x40,0x12,0x9A,0x6A,0xEB,0x96,0x8F,0x78,0x98,0xB3,0x2A,0xB4,0xD3,0x48,0xAA,0x2F,
+	0x7D,0xA7,0x7B,0xFB,0x0C,0x73,0x71,0x5C,0xCE,0x6E,0x5C,0x52,0x6C,0x73,0x79,0x9A,
+	0x13,0x4B,0x89,0x45,0xE9,0x6E,0x49,0x42,0xA9,0x57,0xFF,0x3F,0x2D,0xEF,0xA1,0xC8,
+	0x32,0x36,0xDF,0xE5,0x0C,0xDD,0x0D,0xCB,0x68,0xDF,0xDB,0xAC,0xBA,0x0C,0xB1,0x32,
+	0xED,0x3A,0xAA,0xD4,0x39,0x2C,0x4D,0xEF,0xAC,0x67,0xB3,0xFA,0xD2,0x58,0xD3,0x3D,
+	0xEF,0x1A,0xBA,0x2B,0xD0,0xF2,0xDD,0x73,0x1E,0x4B,0xF7,0x89,0xE6,0xF1,0x79,0xAF,
+	0x63,0xED,0x3E,0xD8,0xDD,0x3E,0x8F,0xAD,0x3A,0xF7,0x76,0x5D,0xD3,0xB7,0xBE,0xB7,
+	0xBB,0xE9,0xB4,0x4E,0xE9,0x5D,0x3F,0xF7,0xA7,0x1C,0x9E,0xEA,0x4B,0xFE,0x1F,0xAD,
+	0xA8,0xC9,0xB5,0xBC,0xA6,0xDC,0xFE,0x36,0xB7,0xB9,0xF5,0x6D,0xC7,0x58,0x9B,0x69,
+	0xF9,0x4C,0x99,0x73,0xDD,0xC8,0x24,0x42,0xB9,0x8B,0xC8,0x06,0x00,0x50,0xC0,0x52,
+	0x2E,0x0E,0xB8,0x66,0x8A,0x01,0xAD,0x95,0x20,0x20,0x3A,0xF2,0xFF,0x07,0x6B,0xAC,
+	0xA4,0xA7,0x82,0xFD,0xDD,0xF1,0x0E,0x67,0x68,0xB2,0xA2,0x83,0x72,0x1B,0xA0,0x52,
+	0x65,0x03,0xFC,0x24,0x3A,0xEA,0xAD,0xCD,0xD5,0x4C,0xDB,0xA9,0xAB,0x76,0x4B,0x93,
+	0x2D,0x67,0x28,0xA2,0xCC,0xC2,0xF3,0x8C,0x21,0x2B,0xD7,0x70,0xC9,0xD8,0x86,0x4A,
+	0x8D,0xC6,0x35,0x49,0xE9,0x8B,0x54,0x29,0x76,0x37,0x63,0xC8,0xCE,0xDD,0x54,0x6A,
+	0x9D,0xBA,0xC6,0xD2,0xD2,0x58,0x72,0xAB,0x5B,0xDE,0x72,0x35,0x35,0x5B,0x84,0x54,
+	0x6D,0xD3,0xEE,0x90,0x11,0xEA,0x4E,0x5A,0x5B,0x53,0xAA,0xB3,0x2F,0xB9,0xD3,0x59,
+	0xBB,0x6B,0xE5,0x94,0x35,0x7B,0x6F,0xE7,0x34,0xAD,0xD8,0xBA,0x17,0x81,0x22,0x94,
+	0xBB,0x88,0x6C,0x00,0x03,0xB4,0x12,0x22,0x01,0x0E,0xFC,0x3F,0xA2,0xED,0xD9,0x59,
+	0x4C,0xFB,0xEC,0xE2,0x0C,0x33,0x34,0x83,0xD9,0x96,0x3B,0x8E,0x69,0xC6,0x15,0x14,
+	0xDA,0x03,0xE0,0x80,0x6E,0xCD,0x03,0xD0,0xE3,0xB8,0x02,0x72,0x48,0x2B,0x45,0xB0,
+	0xE9,0x69,0x12,0x77,0x55,0x99,0xA7,0x57,0x42,0x93,0x53,0x74,0x19,0xE6,0x89,0x6B,
+	0x4E,0x39,0x82,0xB3,0xA6,0x3E,0x3A,0xE5,0x2C,0x81,0x5C,0x59,0xE9,0xD6,0xAB,0xEB,
+	0x81,0x31,0x27,0xCA,0xCC,0xA5,0x6F,0x65,0x1B,0x09,0x5D,0x3D,0xDC,0xD4,0x23,0x9F,
+	0xE9,0xA9,0x8A,0xB4,0xDD,0x92,0xFC,0x3F,0x90,0xC6,0x62,0x2D,0xDC,0xCC,0x76,0xE9,
+	0x63,0x55,0xD3,0x32,0xF5,0xAD,0x4F,0x5D,0x42,0x53,0xF5,0x9D,0xB6,0x14,0x49,0x0D,
+	0xCD,0x73,0xEA,0x5A,0x4C,0xC3,0x6D,0xF3,0x69,0x7A,0x0B,0x52,0x8D,0x25,0xBB,0x9D,
+	0x8B,0xDB,0xC7,0x13,0x90,0x8A,0xC7,0x08,0x14,0xA1,0xDC,0x45,0x64,0x03,0x00,0x03,
+	0xC6,0xA8,0x14,0x40,0xCD,0x4A,0x16,0xE0,0x00,0x06,0xFE,0x1F,0x10,0xA6,0x28,0xDD,
+	0xCD,0x2D,0xD5,0x6A,0x8B,0xEE,0x6C,0xB1,0x4D,0xA7,0xAC,0x2E,0xA3,0x44,0x97,0xDC,
+	0xA6,0xF5,0xCD,0x6B,0x34,0x46,0x13,0x32,0x89,0x50,0xEE,0x22,0xB2,0x01,0x20,0xA5,
+	0xDD,0xA1,0x94,0xBB,0xB3,0xB6,0x0C,0x2F,0xA4,0xE6,0xF1,0xFA,0x96,0x8F,0x70,0x8F,
+	0xC2,0x2A,0xE6,0x4A,0xDD,0xD3,0x2D,0x51,0x7A,0xDA,0xF3,0xAF,0x7B,0x47,0x63,0x51,
+	0x73,0x67,0xE1,0x6B,0x46,0xDD,0x49,0xEB,0xFE,0x3F,0x0E,0x18,0xC9,0xD9,0x01,0x55,
+	0x29,0x9E,0xA0,0x16,0x97,0x70,0x5F,0x7C,0xB2,0xAA,0xDB,0x2B,0x79,0xCD,0xCD,0x56,
+	0x51,0xC9,0x54,0x0D,0x26,0x1E,0x45,0xC3,0x55,0xDE,0xE2,0xF8,0x54,0xC5,0x94,0xA7,
+	0x73,0x97,0xDB,0x94,0x3E,0xE9,0x52,0x2F,0xF6,0xC2,0x16,0xA9,0x4B,0xB3,0xCC,0x5E,
+	0xD8,0xAA,0x34,0x31,0x73,0x27,0xE5,0x4C,0x8D,0xC3,0xD3,0xF4,0xF6,0xA9,0x2F,0xEB,
+	0xA8,0x2E,0x39,0x42,0xFB,0x8E,0xAB,0x99,0xA4,0x28,0xFF,0x5C,0xEE,0x69,0x97,0x28,
+	0x7D,0x4F,0x7D,0xD2,0xDF,0xAB,0x92,0x98,0x6F,0x41,0x8F,0x08,0xE5,0x2E,0x22,0x1B,
+	0x00,0x18,0xB0,0x42,0xA4,0x02,0x5E,0xA8,0x26,0xC0,0xF0,0xE7,0xFF,0x0F,0x02,0x48,
+	0xA5,0xD8,0x02,0x1A,0x18,0x71,0x16,0x15,0x95,0xA4,0x7A,0x65,0x95,0xD5,0x44,0x88,
+	0xFB,0x5B,0xDC,0x62,0x95,0x49,0x4E,0xA7,0x49,0xB6,0x5D,0xED,0x76,0x76,0x73,0x9A,
+	0x4B,0xD9,0x83,0xBD,0x2A,0xB4,0xCE,0xF5,0x0A,0x77,0x50,0xB9,0x25,0x92,0x25,0xDE,
+	0xE1,0x49,0xC2,0x77,0x44,0x5D,0xFB,0xEF,0xFF,0x01,0x01,0x98,0x29,0xC4,0x00,0xDD,
+	0x29,0x9C,0xAC,0x25,0xD7,0xD2,0x9C,0x7C,0x8B,0x5B,0xAE,0xBC,0x26,0xB3,0x94,0x89,
+	0x52,0xF2,0xE6,0x29,0x42,0x52,0x53,0x28,0xAA,0xC1,0xB6,0xB0,0xC4,0x0C,0xF8,0xDE,
+	0xC2,0x02,0x1E,0xF0,0x80,0x05,0x46,0x5C,0x78,0x45,0x25,0xE5,0x19,0x53,0x45,0x93,
+	0xE3,0xA2,0x77,0xAE,0x75,0x4B,0x67,0x92,0xD5,0x6D,0x98,0x25,0x3F,0xF9,0xFD,0x7F,
+	0x02,0x48,0x69,0x4D,0x03,0x06,0xE8,0x34,0xA2,0x85,0x95,0x4C,0x78,0xA8,0xD2,0x93,
+	0x66,0xB1,0xE9,0x4D,0x79,0x6F,0x7A,0xD3,0x9D,0xF5,0xCC,0x01,0x2B,0x86,0x06,0x60,
+	0xC5,0xAB,0x08,0x44,0x20,0x00,0xCD,0x10,0x8D,0xB6,0x26,0x11,0x8B,0xE8,0x3C,0xE6,
+	0x62,0x5D,0x3D,0x63,0xF7,0x58,0xBB,0x4E,0xF1,0xB0,0x2E,0xED,0x28,0xCA,0x74,0xCC,
+	0x9B,0xB8,0xB7,0x69,0xA6,0x0E,0x8F,0x66,0xBE,0xAC,0x48,0xC6,0xAD,0xAE,0xFB,0x9A,
+	0x16,0x0E,0xF3,0x78,0xFE,0xF3,0xBF,0xFF,0xED,0xFF,0xFF,0x06,0x58,0xD5,0xC3,0x01,
+	0x73,0x6E,0x64,0xC0,0x03,0x2B,0x1B,0xB9,0x95,0xDC,0xFB,0xDE,0xE2,0x14,0xA3,0x06,
+	0x4B,0xE5,0xA2,0x9B,0xEF,0x7C,0x95,0xC3,0x1B,0xCA,0x64,0xA5,0x5D,0xED,0x76,0xCE,
+	0x7D,0x2D,0x6B,0xB3,0x24,0x19,0x11,0x3A,0x1D,0xDD,0x93,0x94,0x7A,0x54,0x7F,0xBA,
+	0xBB,0x4B,0xC5,0x08,0xAD,0x1A,0x9E,0xEE,0x85,0x43,0x2D,0x9E,0x79,0xAA,0x10,0xCA,
+	0xD2,0x2A,0xEA,0xC9,0x82,0xAC,0xC3,0x6B,0xCB,0x87,0x3D,0x51,0xB2,0x75,0x74,0x2D,
+	0xF4,0xCE,0x30,0x2C,0x62,0x76,0x14,0x30,0x94,0x92,0x02,0xC6,0x5C,0xB7,0x00,0x02,
+	0x5A,0x17,0xF9,0x7F,0x0E,0x58,0x25,0x25,0x00,0xB3,0x8E,0x7B,0x60,0xC5,0x35,0xB3,
+	0x68,0xE4,0xEA,0x53,0xB4,0x1C,0x12,0xEE,0x9B,0x6F,0x79,0xAB,0x5B,0xEF,0x71,0xEF,
+	0xE6,0xAE,0x49,0xA9,0x2A,0x17,0x21,0x50,0x84,0x72,0x17,0x91,0x0D,0x00,0x0A,0x68,
+	0xC5,0x49,0x02,0x12,0xE0,0xC0,0xFF,0x03,0x02,0x78,0x2D,0x55,0x02,0x12,0xB0,0x80,
+	0x01,0x5E,0x49,0x5D,0x49,0x35,0xAE,0x1A,0xD6,0xF6,0x94,0x25,0x05,0x5B,0x4A,0xD7,
+	0x55,0x94,0x3C,0x28,0x2D,0xFE,0x76,0x11,0xCA,0xEA,0x06,0x25,0x35,0x29,0x02,0x45,
+	0x28,0x77,0x11,0xD9,0x08,0x28,0x4E,0x15,0x1C,0x50,0x1C,0xD3,0xEA,0x6A,0x14,0x49,
+	0xF7,0x4D,0x7B,0x19,0x67,0x53,0x45,0x65,0xB1,0xA7,0x3E,0x08,0x14,0xA1,0xDC,0x45,
+	0x64,0x03,0x80,0x00,0x96,0x56,0x53,0xC0,0x1F,0xAD,0x02,0x78,0xAE,0x06,0x01,0xCB,
+	0xB7,0xFF,0x3F,0x06,0x48,0x65,0x34,0x00,0x93,0xA7,0x5B,0xA0,0xA4,0x95,0xBA,0x5F,
+	0x82,0x9B,0x95,0x07,0x37,0x55,0x24,0x4D,0x4E,0x51,0xE9,0x54,0x25,0x76,0xB9,0xE5,
+	0x2D,0x4F,0x93,0x7D,0xE5,0x98,0xAE,0xDE,0x63,0x3B,0x72,0xC9,0x2C,0x8E,0xD9,0xF1,
+	0x41,0xA0,0x08,0xE5,0x2E,0x22,0x1B,0x00,0x40,0x00,0x35,0x0D,0x69,0x80,0x02,0xFF,
+	0x0F,0x0E,0x68,0xA1,0x43,0x03,0xA7,0x2E,0xB2,0x22,0x0B,0xBB,0xDC,0x76,0x75,0x55,
+	0x99,0xB7,0x53,0xB4,0xD1,0x77,0xA6,0x1C,0xA5,0xD6,0x7A,0x9F,0xFA,0x44,0x39,0x5A,
+	0xDC,0x1E,0x9D,0x0C,0x50,0x94,0xB8,0x01,0x46,0x14,0x2F,0x69,0x97,0x9C,0x69,0xA6,
+	0xE4,0x14,0x8D,0x85,0xBB,0x73,0xB3,0x93,0x75,0x6D,0xA2,0x29,0x6F,0x56,0xD6,0xB3,
+	0xB2,0xA8,0x3F,0x59,0xF9,0x18,0x4E,0xA4,0xBE,0x66,0xB6,0x69,0x9F,0xB9,0x08,0xD2,
+	0xDE,0xC4,0x1D,0x81,0x22,0x94,0xBB,0x88,0x6C,0x00,0x00,0x05,0x1C,0xD9,0x6E,0x80,
+	0x65,0x7E,0x18,0xD0,0xEB,0x3A,0x02,0x6A,0x09,0xFC,0x7F,0x06,0xA8,0xD5,0x29,0x24,
+	0x3D,0xAC,0xB3,0x52,0xE6,0x55,0x97,0xA0,0x56,0x12,0x8D,0x4F,0xDB,0x9C,0x6A,0x4B,
+	0x2C,0x2D,0xDD,0xC8,0xA8,0xEE,0xE9,0xB4,0xF6,0xAB,0x6B,0x4E,0xB5,0x28,0x93,0xAC,
+	0xB6,0xC5,0x66,0x4F,0xDB,0x7C,0xBB,0xDB,0xEF,0x69,0x9E,0xE5,0x69,0xA1,0x39,0x3C,
+	0x96,0x20,0x50,0x84,0x72,0x17,0x91,0x0D,0x00,0x20,0x80,0xA5,0xC3,0x1C,0xB0,0xEC,
+	0x97,0x05,0x18,0xD0,0xCB,0xDA,0xFF,0x03,0x06,0x68,0xA5,0xCD,0x02,0x2B,0xA9,0x36,
+	0xD5,0x43,0x5A,0x9F,0xA6,0xA9,0x36,0x4F,0xEE,0x73,0xDA,0xC1,0xDA,0x35,0x79,0x73,
+	0x6B,0x9B,0x62,0xEA,0xB0,0x78,0xB3,0x4B,0x7D,0x91,0x18,0xED,0xE6,0x16,0x81,0x22,
+	0x94,0xBB,0x88,0x6C,0x10,0x40,0x0B,0xE1,0x1E,0x88,0xC0,0x48,0x53,0xE2,0x0A,0x17,
+	0x67,0x3B,0x3B,0x59,0xB2,0x11,0x95,0xA2,0x7C,0x64,0x91,0x4F,0x47,0x92,0xF7,0x99,
+	0xAF,0xA2,0xE0,0xEE,0x76,0x56,0xBF,0x9B,0x39,0xB4,0x29,0xB1,0x9C,0x76,0xF4,0x56,
+	0xD7,0xBA,0xE5,0x3B,0x3F,0xF1,0x29,0x77,0xE6,0x9D,0x63,0x9C,0xE7,0xFF,0x01,0x0A,
+	0xC8,0xBD,0xD5,0x03,0x16,0x50,0x40,0x5E,0x15,0x23,0x4F,0x5D,0xCC,0x87,0xB3,0xAE,
+	0xA2,0xE4,0x64,0x1D,0x73,0x7F,0x8A,0x9A,0x9B,0xB5,0xA5,0xEB,0x29,0x7A,0x4D,0x36,
+	0xB7,0x45,0xB7,0x58,0xF5,0x28,0x8E,0xDA,0x31,0x69,0x77,0x7B,0x98,0x73,0x5F,0xEA,
+	0x1A,0xF6,0x1E,0x99,0xB3,0x62,0x74,0xB8,0xBA,0x47,0x73,0x4F,0xA7,0xF1,0x0A,0x77,
+	0x4F,0xE4,0x2A,0xEE,0xD5,0x3D,0xCD,0x91,0x86,0x86,0xBB,0xF0,0x8C,0xC8,0x6C,0x9A,
+	0xCE,0xFE,0x1F,0x08,0xF8,0xB3,0x5C,0x03,0x16,0xB0,0x80,0x06,0x56,0x55,0x64,0xB9,
+	0xBB,0xB7,0x39,0x4D,0x71,0xA5,0x15,0xBA,0xF8,0x36,0xBB,0x19,0x75,0xCB,0x8A,0xED,
+	0x35,0xB1,0xB7,0xAC,0x15,0xA1,0xDC,0x45,0x64,0x03,0x03,0xE2,0x10,0x2A,0x53,0x54,
+	0xE3,0x69,0xDC,0x79,0xAD,0x1D,0x67,0x57,0xB0,0xB7,0x76,0x6C,0xAC,0xDD,0xC9,0xEC,
+	0xDB,0xD5,0x70,0x4C,0x07,0x69,0xCD,0x8F,0x7B,0x13,0x9B,0x49,0xA1,0xBC,0xFE,0xFB,
+	0x7F,0x2D,0xBF,0x21,0x92,0x59,0xB4,0x9F,0xA2,0x87,0x10,0x8E,0xDC,0x72,0xAB,0x5B,
+	0x9D,0x62,0xA6,0x42,0x9E,0x9C,0xB8,0xB3,0x95,0x0D,0xAF,0x14,0x15,0xA5,0x47,0xDE,
+	0x1D,0x7A,0x78,0x3A,0x49,0x65,0x55,0xD0,0x5E,0xAE,0x3A,0xB5,0x53,0x93,0x88,0x65,
+	0xE2,0x00,0xEC,0x9A,0xEA,0x80,0x65,0x82,0xC7,0xD8,0x63,0x0A,0x9A,0x65,0x5D,0x53,
+	0xC9,0x49,0x5C,0xE1,0x7D,0x2F,0x73,0x2F,0x47,0x59,0xC2,0xDE,0x9A,0x27,0x5F,0xF1,
+	0x8B,0xDF,0xFF,0x03,0x65,0x9F,0x5A,0x48,0x42,0x1D,0x8F,0x61,0xB8,0x62,0x56,0xFE,
+	0xB2,0xFA,0x51,0x9C,0x85,0xED,0xCD,0xEA,0x47,0x4B,0x64,0xD5,0x35,0x69,0xE8,0xC7,
+	0x41,0xD4,0x5E,0x8B,0x25,0x6B,0xB4,0x75,0xB7,0x84,0x40,0x11,0xCA,0x5D,0x44,0x36,
+	0x98,0xAD,0xA9,0xAB,0x28,0x8D,0x1B,0xFA,0xE2,0x26,0xC9,0x44,0x69,0x6A,0xA3,0x13,
+	0x8F,0x70,0xAD,0xA5,0xC9,0x99,0x42,0xDC,0x9C,0x8D,0xA6,0x36,0x4E,0x72,0xB3,0xBF,
+	0xEA,0xD6,0x54,0xD9,0x25,0xFD,0xAA,0x46,0x19,0x86,0x90,0xAF,0xB3,0xEE,0x4D,0x19,
+	0x47,0x12,0x90,0xCE,0x5B,0x75,0xC9,0x5B,0xDA,0x47,0x31,0x14,0xF3,0xD7,0xF9,0xCC,
+	0x77,0xFC,0xFC,0xEF,0xFE,0xE6,0x99,0xC2,0x7C,0x93,0xFE,0xC5,0xDF,0x44,0x08,0x5B,
+	0x75,0x36,0xFF,0xD2,0xC6,0xE2,0x91,0xCE,0xFD,0xDF,0x89,0x9A,0x68,0x3A,0x01,0x4C,
+	0x48,0x2A,0x80,0x5F,0x33,0x34,0x40,0x81,0xFF,0x07,0x64,0x8E,0x38,0x3C,0x4B,0x62,
+	0x8F,0x7D,0x89,0x14,0xD4,0xCC,0xB5,0x86,0x11,0x9A,0xD1,0xB5,0xCF,0x1C,0xDC,0xDC,
+	0xA5,0x23,0xB5,0x3B,0xCB,0x73,0x9D,0x46,0x99,0x6D,0x59,0x35,0xE5,0xD9,0xF5,0x69,
+	0xAA,0x1E,0xCB,0xE2,0xCD,0xB7,0xB9,0xDD,0x19,0xAA,0x2F,0xE9,0xD0,0xD5,0x7B,0x69,
+	0x57,0xF3,0x49,0x1E,0xF1,0x28,0xDE,0x0C,0xB8,0x36,0x54,0x00,0xBF,0x55,0x6A,0x40,
+	0x03,0x1A,0xE0,0x00,0x07,0x28,0xF0,0xFF,0xA5,0x7E,0xBE,0x3C,0x49,0x14,0xAF,0x6E,
+	0xAA,0x52,0x72,0xCD,0x77,0xBA,0x66,0x4A,0x38,0xAC,0xDB,0xE9,0x8A,0x0F,0xB6,0xB0,
+	0xF4,0xAD,0x4B,0x5D,0xDC,0x35,0xED,0xCF,0xF6,0xD4,0xA5,0x68,0xB8,0x85,0xFB,0x53,
+	0xD6,0x90,0x34,0x1E,0x9D,0x6E,0x31,0xF2,0x36,0x9D,0x4A,0x6C,0x91,0xC9,0x47,0x18,
+	0x63,0xD1,0xD8,0x02,0xE8,0xC1,0xCC,0x01,0x63,0x6C,0x45,0x20,0x02,0x1E,0x68,0x45,
+	0x8D,0xAA,0x6E,0xD1,0x69,0x36,0x63,0x69,0x81,0x2D,0x25,0x9A,0xD4,0x23,0x1D,0x5D,
+	0x0B,0xA5,0x7B,0xB4,0x78,0xF9,0xDB,0x7D,0x23,0x18,0xB9,0x58,0x7C,0xFF,0xBB,0xAF,
+	0x19,0xC1,0x54,0x4B,0xF6,0xFF,0x04,0x88,0xD0,0x63,0x2C,0x53,0xB5,0xB1,0x52,0x9F,
+	0x3B,0xDF,0x79,0x4F,0x65,0xF8,0xCE,0x5D,0x4D,0xB9,0x29,0xE0,0xCF,0x52,0x0B,0x78,
+	0x40,0x03,0x08,0xC8,0xDC,0x15,0x40,0x02,0xA9,0x2D,0x4A,0x6A,0x45,0xEC,0xB5,0xB6,
+	0xA0,0xCA,0x71,0x4C,0x73,0xEA,0xCA,0x3B,0xC2,0xA5,0xCB,0xAD,0x6E,0x75,0x9A,0xA6,
+	0x93,0xAD,0x62,0xF3,0xED,0xEE,0xB4,0x96,0x1E,0x13,0x25,0x7D,0xF3,0xDE,0xFB,0xDE,
+	0xCE,0xE6,0x15,0xA3,0x6A,0x55,0x7D,0xCA,0x3B,0x62,0x22,0x67,0x6C,0xCE,0xDF,0xFF,
+	0x03,0xAD,0x1D,0x59,0x50,0xBC,0x17,0x8F,0x7A,0x96,0x02,0x8C,0x7C,0xB2,0xEB,0x5D,
+	0xCD,0x7A,0x0C,0x63,0x10,0x71,0xCC,0xEC,0x3E,0xA5,0x75,0x0C,0x41,0xF2,0x7A,0x4C,
+	0x80,0x6F,0x67,0x24,0xA0,0x01,0x05,0xFC,0x3C,0xA5,0x01,0x0D,0x58,0x40,0x02,0x04,
+	0xF8,0xDA,0x1C,0x03,0x1A,0x30,0xC0,0x31,0x37,0x02,0xE8,0xF5,0x8D,0x00,0xD5,0x39,
+	0xFC,0x3F,0x6B,0x9D,0xA6,0x88,0xD3,0x36,0xDF,0xF1,0x8C,0x5B,0x84,0x93,0x79,0xBB,
+	0x35,0x5C,0x26,0xA9,0xEC,0x6B,0xCF,0x70,0xB8,0x87,0xBA,0x68,0x3F,0x5D,0x4B,0xA1,
+	0x29,0xB6,0xF9,0xB6,0xAD,0x69,0xB1,0x48,0x5B,0x1B,0x23,0x50,0x84,0x72,0x17,0x91,
+	0x0D,0x00,0x06,0x38,0xAE,0xD2,0x03,0xA3,0xAC,0x59,0x4D,0xDD,0x9D,0xAE,0xA2,0x16,
+	0x63,0x37,0xEB,0xBA,0x8B,0x51,0x36,0x63,0x1A,0x9E,0x6B,0x7A,0x65,0x80,0x55,0xB7,
+	0x3D,0x10,0x81,0x0C,0x58,0x60,0x75,0xCD,0x98,0x84,0xF9,0xA6,0xBD,0xF4,0xAD,0x5C,
+	0x43,0x19,0x46,0x58,0xB4,0x7C,0xE7,0x27,0x7D,0x3D,0x0A,0xBB,0x87,0xDD,0xF8,0xC7,
+	0xFF,0xFF,0x01,0xAB,0x18,0xB6,0x39,0xDC,0x5E,0xDD,0xFA,0x96,0xAB,0xE8,0x41,0x24,
+	0xC9,0x17,0xE5,0x0A,0x0C,0x70,0x4C,0x65,0xE9,0x4A,0x37,0xCC,0xE4,0xDE,0xB3,0x6F,
+	0x73,0xA9,0x0D,0x36,0x9C,0x37,0xEF,0xE9,0xCA,0x35,0xA0,0x5A,0xFA,0x94,0xB7,0xD4,
+	0xC4,0x48,0xC9,0x93,0xBF,0xFF,0x07,0x6D,0x18,0x49,0x91,0xBC,0x17,0xEF,0x6E,0x15,
+	0xA3,0x15,0xA2,0xE5,0x93,0x9D,0xB5,0x7C,0x6C,0x07,0xB6,0x7C,0x1C,0xF2,0x11,0x19,
+	0xAC,0xB2,0x0E,0x02,0x45,0x28,0x77,0x11,0xD9,0x00,0x04,0xF0,0xA3,0x88,0x01,0xBE,
+	0x65,0xB4,0x36,0xC8,0x8D,0x08,0xF4,0x33,0xBB,0x39,0xB4,0xB5,0xE2,0xAE,0x0E,0xF2,
+	0xDB,0xD7,0x7A,0xA4,0x33,0xD3,0xEA,0x0E,0xF0,0x9B,0xCE,0xC8,0xAE,0x92,0x24,0x77,
+	0xB8,0x33,0xF8,0x68,0xE6,0xD6,0xF1,0xFE,0x7F,0x6B,0x68,0xC1,0x24,0xAD,0xEE,0xAC,
+	0xA6,0xE7,0x66,0x57,0x7F,0x73,0x9B,0x5B,0xB6,0xA2,0x1F,0x56,0xC5,0x69,0x6A,0xDA,
+	0x96,0x94,0x02,0xB2,0x89,0x02,0x9A,0x1C,0x35,0xC0,0xCF,0x99,0x16,0xB0,0x80,0x04,
+	0xDA,0x5C,0x83,0x4A,0xF0,0xDC,0x5E,0x5B,0x33,0x49,0xA1,0xFE,0xB9,0x9F,0xE1,0x6B,
+	0x41,0x39,0xD8,0x1E,0x23,0x50,0x84,0x72,0x17,0x91,0x0D,0x00,0x02,0x38,0xCC,0xDC,
+	0x02,0x04,0x18,0xF6,0xF3,0xFF,0x01,0x04,0x98,0x3E,0x8D,0x03,0x1C,0xD0,0x80,0x07,
+	0x4A,0xBF,0x54,0x9B,0x3A,0x79,0x9C,0xCD,0xAA,0x9B,0x0F,0x31,0x8F,0x37,0xB7,0xBE,
+	0xCD,0x6A,0x47,0x2A,0x66,0xB3,0xB7,0xB3,0xDB,0x6B,0x5F,0xC7,0x56,0x44,0x58,0x8E,
+	0x76,0xAA,0x7B,0xD8,0x33,0xB9,0x32,0xD7,0x3C,0xF9,0x0C,0x67,0xD4,0x13,0x9E,0x98,
+	0xC7,0x5F,0xEE,0x49,0x7C,0xAA,0x8D,0xF3,0xF9,0xF7,0xFF,0x01,0x04,0x58,0x3E,0x8D,
+	0x03,0x1C,0xD0,0x80,0x05,0x4A,0xB9,0x54,0x9B,0x3A,0x79,0x9C,0xD5,0xA9,0x7B,0x0C,
+	0x71,0xF7,0xD7,0xB7,0xBE,0xCD,0x68,0x4B,0x56,0xF1,0x12,0x3F,0xB5,0x4B,0x6B,0x2C,
+	0x6C,0x91,0x26,0xBF,0x4E,0x63,0x2E,0x91,0x43,0x5D,0xDB,0xAF,0xA5,0xF9,0x10,0x0D,
+	0xE9,0x3E,0xF7,0x7A,0xF2,0x0B,0x81,0x22,0x94,0xBB,0x88,0x6C,0x20,0xCF,0xA2,0xEE,
+	0x95,0x99,0x38,0x3D,0xDD,0x85,0x89,0xCA,0x96,0xFC,0xFC,0x3F,0x08,0x68,0xD6,0x55,
+	0x02,0x0A,0x18,0x22,0x5D,0x02,0x1A,0x58,0x45,0x75,0xA3,0x5E,0xFA,0xE6,0x96,0xB7,
+	0x39,0x6D,0xD3,0xA3,0xD6,0xBA,0xFA,0xF6,0x6B,0xAE,0xAE,0xA4,0xCA,0xEE,0xAC,0xAD,
+	0x99,0xD1,0x28,0x5B,0x5C,0x8E,0xE2,0x4A,0x2B,0xFD,0x4E,0xBE,0xE2,0x85,0x80,0x25,
+	0x5B,0x39,0xC0,0x80,0xDF,0x32,0x24,0xA0,0x01,0x0B,0x58,0x80,0x02,0xC0,0x80,0x3B,
+	0x4C,0x14,0xF0,0xBC,0x38,0x03,0x96,0xDD,0xF9,0x7F,0x08,0x98,0x31,0x93,0x02,0x1C,
+	0xE0,0x80,0x07,0x5A,0x3E,0x4A,0x28,0x99,0x3F,0x59,0xE9,0xE8,0x4E,0x64,0xFE,0x64,
+	0x67,0xA3,0x98,0x45,0x41,0xB2,0x67,0xF7,0x36,0x4F,0x6A,0x9F,0x9D,0x91,0xB3,0x6E,
+	0xA3,0x7B,0xCA,0x30,0x53,0x95,0x03,0x00,0x00,0x08,0x18,0xD2,0x4D,0x00,0xC7,0x6C,
+	0x6A,0x40,0x00,0x3D,0xAC,0x62,0xE0,0xFF,0x01,0x04,0x18,0xCE,0x4D,0x02,0x1A,0xD0,
+	0x80,0x04,0x46,0x91,0x55,0x57,0x07,0x6D,0xD9,0xCD,0xAE,0x4F,0x55,0x5D,0x59,0x87,
+	0xAE,0xB9,0xD5,0x6D,0x5B,0xDB,0x7D,0x93,0xB6,0xED,0xEE,0xE3,0x5A,0x6B,0x6A,0xF4,
+	0x91,0xD5,0x73,0x6B,0x67,0xF5,0x47,0xBC,0xD4,0xA7,0x9C,0xA5,0x34,0xE4,0xD0,0xA6,
+	0xF0,0xE4,0xAA,0xB8,0x2D,0xAB,0xC3,0x9B,0x62,0xC2,0xAC,0x74,0xF6,0x9F,0xFB,0x72,
+	0x0B,0xEC,0x92,0xCD,0xEE,0xCF,0x43,0x69,0x4C,0x5B,0xFF,0x3F,0x04,0xE8,0x3E,0x83,
+	0x02,0x1C,0xE0,0x80,0x04,0x3C,0x10,0xB2,0x24,0x75,0xD9,0xAC,0x4D,0xCD,0x5A,0x9D,
+	0x85,0xAC,0x93,0x79,0x39,0x75,0xA3,0xDE,0x15,0x98,0xED,0x56,0xB7,0x5A,0x55,0xE2,
+	0xD3,0xE9,0xE4,0x6F,0xD6,0xB3,0x9B,0x43,0x5F,0xEB,0x91,0x4F,0x77,0x5B,0xBB,0x15,
+	0xC2,0x7E,0xFC,0x63,0x5E,0x1B,0xD7,0x0B,0xA5,0xB7,0x7E,0xFF,0x1F,0x04,0xA8,0x4A,
+	0x9D,0x01,0x33,0x8C,0x71,0x40,0x02,0x1A,0x08,0x71,0x4E,0x5C,0x52,0xEA,0x7E,0x67,
+	0x2B,0xEB,0xB5,0x98,0x82,0xB7,0xEE,0x64,0xA4,0x7D,0x18,0xB2,0xDB,0x1B,0x9B,0x22,
+	0x50,0x84,0x72,0x17,0x91,0x0D,0x04,0xF0,0x35,0x2D,0x25,0x59,0xB9,0x57,0xCA,0xE2,
+	0x39,0xB4,0xB1,0x69,0xB4,0xF2,0xB4,0x5B,0x97,0xB0,0x14,0x05,0x15,0x91,0x6A,0xF4,
+	0x2A,0x80,0x5F,0x4A,0x2D,0xE0,0x01,0x0B,0x68,0x40,0x03,0x63,0x69,0x56,0xC5,0x25,
+	0x57,0x8D,0xAD,0x27,0x63,0xB1,0x78,0xDC,0x8F,0x7E,0x95,0x6B,0xE6,0x24,0x32,0x5B,
+	0x93,0xEE,0xD1,0x83,0x58,0xEC,0x4D,0x7E,0xE3,0xF7,0xFF,0x04,0x18,0x26,0x8D,0x03,
+	0x12,0xF0,0x80,0xAB,0x42,0x57,0x8B,0x61,0x6F,0xAB,0x4C,0xCE,0x2B,0xD2,0xD4,0xDD,
+	0xE2,0x96,0xA7,0xCC,0x72,0xCA,0x93,0xDB,0xEC,0x6A,0xB7,0x73,0x68,0x4B,0xA7,0x61,
+	0xA1,0x6C,0xB6,0xAF,0xF9,0x88,0x47,0x3C,0xFD,0xF3,0xFF,0x0E,0x28,0x8A,0xE5,0xB4,
+	0xAD,0x04,0x9B,0xF9,0x9A,0x5B,0x9F,0xBA,0xE9,0x91,0x4A,0x5D,0x7D,0xAB,0x53,0x15,
+	0x35,0xBE,0xA2,0x8B,0x77,0x35,0xEA,0xCC,0xC6,0x4F,0xA9,0x6E,0x6B,0x07,0xC8,0xEC,
+	0x45,0xCF,0x6B,0x2C,0xA2,0x7C,0x4D,0x36,0xCF,0x65,0xAC,0x8D,0x97,0xB6,0xE9,0xE2,
+	0x7A,0x86,0x7B,0x44,0xD4,0xB0,0x54,0x1A,0xEE,0xA6,0x51,0x32,0xC2,0xA9,0x7F,0xCC,
+	0xD3,0x2D,0xA3,0xA7,0xC4,0xB7,0xAF,0x7E,0xE4,0xE7,0xBE,0xAF,0x4D,0x54,0x53,0x19,
+	0x03,0xBE,0x60,0x62,0xC0,0xAF,0xAE,0x12,0x90,0x00,0x02,0x6A,0x70,0xFE,0x7F,0x0C,
+	0x08,0xDA,0x75,0x2C,0xB3,0x27,0x19,0xBB,0xDD,0xD1,0xB7,0x44,0xE4,0x51,0x73,0x4E,
+	0x3B,0x7A,0x90,0x49,0x2C,0x39,0x75,0x77,0xAD,0x66,0xB6,0xE6,0x56,0xA7,0xAA,0x31,
+	0x25,0x2D,0xD7,0xEC,0x61,0x2E,0x71,0x41,0xA0,0x08,0xE5,0x2E,0x22,0x1B,0x00,0x00,
+	0x01,0x5D,0x85,0x29,0xE0,0x88,0x76,0x05,0x4C,0xF7,0xCE,0x80,0xEE,0x9B,0x29,0xF0,
+	0xFF,0x0C,0x08,0xDA,0x75,0x2C,0xB3,0x27,0x19,0xBB,0xDD,0xD1,0xB7,0x44,0xE4,0x51,
+	0x73,0x4E,0x3D,0x7A,0x90,0x49,0x2C,0xB9,0xE5,0xAD,0x6E,0xB5,0xBA,0x99,0x0A,0x24,
+	0xE3,0xF1,0x1E,0xFA,0x1E,0xEE,0x31,0x13,0x59,0xE3,0x8D,0xFA,0x47,0x21,0x32,0xAF,
+	0xC7,0x08,0x14,0xA1,0xDC,0x45,0x64,0x03,0x00,0x38,0x60,0x89,0x52,0x03,0x6C,0xF3,
+	0xC3,0x80,0xDE,0xD7,0x08,0x50,0x8D,0xE1,0xFF,0x03,0x0E,0x18,0xD5,0xB0,0xB5,0x2B,
+	0x24,0x09,0x7B,0x92,0x55,0xF7,0x4C,0xA2,0xD1,0x8D,0x6F,0x7D,0x9A,0x91,0x83,0x34,
+	0x72,0xCE,0x6D,0x6E,0x73,0xDB,0xD5,0xCD,0x50,0x40,0x9D,0xAB,0xF7,0xB8,0xE7,0xBD,
+	0xB5,0x7D,0xA5,0x46,0x8C,0x58,0x5D,0x0F,0x76,0x15,0x05,0xBE,0x96,0x8D,0xD8,0x59,
+	0x0D,0xE8,0x58,0xD5,0xA2,0x97,0x7A,0xC6,0x72,0x17,0x31,0x5B,0xB2,0x65,0xC0,0x9A,
+	0xCE,0x12,0xB0,0x80,0x02,0xE6,0x50,0xF9,0x7F,0x06,0x08,0xDA,0x75,0xB5,0x8D,0x87,
+	0x4B,0x4B,0xBA,0x5B,0xDD,0xE2,0xE4,0x49,0x4E,0xA6,0x73,0xBE,0x9B,0xEF,0x62,0x37,
+	0xBB,0x9B,0x4B,0xDB,0x82,0x1A,0x5F,0xC1,0x7C,0x79,0xF7,0xA7,0xBF,0xFE,0x1F,0xE1,
+	0x6A,0xEA,0x2A,0x4A,0xE3,0xA6,0xA1,0xB8,0x49,0x32,0x51,0x9A,0xFA,0xE8,0xCC,0xAC,
+	0x2C,0x59,0xED,0x5A,0x5B,0x3A,0x05,0x27,0x77,0x9D,0xF5,0x29,0xDA,0x70,0x91,0x90,
+	0xB6,0xA7,0x18,0x35,0x90,0xD3,0x17,0xED,0x7C,0xE5,0x33,0x06,0xE2,0x54,0xA5,0x5D,
+	0xCC,0xAA,0xF5,0xB3,0x07,0x50,0xD6,0xA8,0x36,0x8E,0xA0,0x68,0x6B,0x61,0xFA,0x52,
+	0xB7,0xB2,0x8F,0x44,0x54,0x15,0x41,0xD2,0x31,0x12,0x86,0xB8,0xBB,0xCE,0x67,0xBA,
+	0xAA,0x66,0x4B,0xF1,0xB8,0xE9,0xEA,0x91,0x43,0xCC,0x5C,0xC7,0x33,0x5E,0xE5,0x6A,
+	0xD6,0x25,0xDC,0x67,0xA5,0xA7,0x55,0x0D,0xD5,0x98,0x9C,0xDF,0xFF,0x07,0x04,0xC8,
+	0xA1,0xD8,0x02,0x1E,0x58,0x71,0x2E,0x81,0x31,0xDC,0x65,0x25,0xD5,0x9E,0xC2,0x9A,
+	0xFE,0x9D,0xED,0x7A,0x8E,0x61,0xAD,0x25,0xC1,0x4A,0xF3,0x01,0x00,0x02,0xB6,0x09,
+	0x65,0xC0,0x6F,0x65,0x1C,0xB0,0x80,0x05,0x34,0xE0,0x01,0x0D,0x10,0xA0,0x09,0x97,
+	0xFF,0x07,0x04,0xC8,0x7E,0x9C,0x02,0x12,0xD0,0x80,0x06,0x56,0x96,0x7D,0x67,0x4B,
+	0x2C,0xB9,0xC5,0x6D,0x6E,0x7D,0xEB,0xDB,0xDC,0xEE,0x8C,0x4D,0x8F,0x65,0xF1,0xE6,
+	0xBD,0xEE,0x6D,0xEC,0xCD,0x97,0x74,0xE8,0xEA,0x79,0xCE,0xAB,0x5C,0x23,0x06,0x69,
+	0xC4,0xA3,0x7C,0xC7,0xC7,0xBF,0xFF,0x0F,0x08,0x68,0x34,0x5A,0x03,0x06,0x98,0x42,
+	0xCC,0x02,0x23,0x4F,0x7C,0xD6,0x85,0xDA,0xAC,0xAC,0xE2,0xD8,0x32,0x4C,0xD3,0xF2,
+	0x8C,0xF3,0x9C,0xA9,0x4B,0xCF,0x5A,0x51,0x91,0xEE,0x04,0xBA,0xEB,0x55,0xED,0xCB,
+	0x12,0x85,0x6F,0x0A,0xBB,0xCB,0x6B,0xDC,0xE3,0x61,0x0F,0x73,0x65,0x41,0xAB,0x6A,
+	0x69,0xCC,0x95,0x04,0x75,0x93,0xA7,0x35,0x67,0xD3,0x28,0xE3,0x9A,0x56,0x5D,0x85,
+	0x93,0x65,0x68,0xB6,0x74,0x55,0x63,0xE6,0x62,0x6B,0xDC,0x59,0x2D,0x87,0xBB,0x3F,
+	0xF9,0x7F,0x63,0xC9,0x66,0xA2,0xCC,0x57,0x9F,0xB1,0xF1,0xCE,0x6E,0xEE,0x72,0xBB,
+	0xD3,0x24,0x3B,0x99,0x49,0x79,0x6E,0x35,0x2A,0x1F,0x27,0xBD,0xC8,0x4B,0x69,0x4D,
+	0xDA,0xB0,0x54,0x2E,0x65,0xB0,0x65,0x34,0x43,0xF8,0x96,0x31,0x75,0xA5,0x6E,0xEA,
+	0x53,0xD7,0x7C,0xA4,0x27,0xD7,0x00,0x6F,0xD7,0x1B,0x1F,0xFF,0xB8,0xB7,0x26,0x16,
+	0x49,0xEB,0xE6,0x5F,0xF7,0x56,0x2B,0x62,0xEA,0xEB,0xDC,0xDB,0x83,0xB2,0x9A,0x74,
+	0x73,0xEF,0x76,0x9E,0xC4,0xAA,0xDE,0x7D,0xBF,0x87,0xA6,0xA0,0x52,0x06,0x7C,0x4B,
+	0x24,0x01,0x09,0x70,0xE0,0xFF,0x01,0x23,0x1B,0xD6,0x48,0x2A,0x67,0x9F,0x76,0xC4,
+	0x20,0x89,0xBC,0x7D,0xEB,0x53,0x8F,0x90,0xEC,0x12,0xB7,0x77,0xBB,0xC6,0xEE,0x55,
+	0x92,0x6B,0x72,0x59,0xAA,0x82,0x28,0x4F,0x35,0xE9,0x68,0x0A,0xB9,0xD3,0x6D,0x93,
+	0xA6,0x28,0xC8,0xB1,0xB0,0x85,0x40,0x11,0xCA,0x5D,0x44,0x36,0x00,0x02,0xD6,0xDC,
+	0xD2,0x80,0x05,0x32,0xE0,0x01,0x0F,0x10,0xA0,0x26,0xA1,0xFF,0x07,0x29,0xEB,0x5E,
+	0xD9,0x32,0x27,0x9D,0x6E,0xFA,0x66,0x17,0x59,0x7D,0xDB,0xDB,0xB4,0xB6,0x7B,0xD0,
+	0xCC,0x70,0xD2,0xDB,0xD6,0x0D,0xC7,0x38,0xAC,0x4D,0xD2,0xF0,0x0D,0xB3,0xA9,0xBB,
+	0x73,0xC0,0x4F,0xE9,0x11,0xF0,0x80,0x02,0x86,0x52,0x01,0x03,0x44,0xEA,0x7A,0xA2,
+	0x1A,0x43,0xD3,0x6C,0xF3,0x4D,0x6F,0xDA,0xB2,0x56,0x0C,0x82,0xAD,0x31,0x29,0x44,
+	0x28,0x77,0x11,0xD9,0x00,0xE0,0x80,0xED,0x3C,0x46,0x5F,0xEB,0xA0,0xB4,0xF8,0x2D,
+	0x53,0xF5,0x27,0xB0,0xEC,0x3F,0x6F,0x69,0x2F,0xB1,0x50,0x4E,0xF2,0x86,0xB3,0x86,
+	0x13,0x18,0xF5,0x17,0xDF,0xF0,0x96,0x65,0x58,0xC9,0x59,0xFC,0xF7,0xFF,0xAB,0x1D,
+	0xA9,0x88,0xCC,0x37,0x9F,0x66,0xBA,0x16,0x31,0xFE,0xBC,0xEB,0x55,0x0F,0xCF,0x98,
+	0x69,0x55,0x47,0xD3,0x0C,0xF2,0xA4,0x45,0xAB,0x6D,0x6D,0x43,0x57,0x34,0xF8,0x78,
+	0x34,0x45,0xA0,0x08,0xE5,0x2E,0x22,0x1B,0x14,0xD0,0x4A,0x46,0x06,0x34,0xD0,0xD2,
+	0xEC,0x39,0xCC,0xCC,0xDD,0xCC,0x56,0x9E,0x95,0x58,0x14,0xB5,0xDB,0x45,0xAB,0xAB,
+	0x27,0x4B,0xF6,0x74,0xA2,0x62,0xCE,0xB2,0x3C,0x66,0xB7,0x7A,0x2C,0x0B,0x61,0x95,
+	0xBB,0x96,0x96,0x4C,0xD9,0x35,0xDB,0x98,0xAB,0x29,0xA2,0xB3,0x7C,0x73,0xED,0x47,
+	0xBB,0x4A,0x2E,0xD0,0x71,0x3F,0xF9,0x8B,0x5F,0xF8,0x4A,0x0F,0xF4,0xD1,0x3C,0xFF,
+	0x0F,0xAD,0xED,0xD5,0x58,0xA4,0x9E,0xCE,0x76,0xF5,0xDD,0xAB,0x29,0xF5,0xD2,0xDD,
+	0xEF,0x7E,0x0C,0xC3,0xA9,0x06,0xFA,0xD3,0x32,0x0F,0x6E,0x94,0x22,0x8F,0xF3,0x92,
+	0xF6,0x05,0x43,0xCC,0x74,0x77,0x3E,0xC3,0xF5,0x95,0x98,0xA9,0xBA,0x8B,0x8F,0x00,
+	0x7E,0x73,0xE5,0x00,0x05,0x28,0xF0,0xFF,0x69,0x1D,0xC0,0xDA,0xCC,0xD3,0xA6,0xB5,
+	0x81,0x68,0xD1,0xF4,0xDA,0xC7,0xD3,0x57,0x6F,0x11,0xDC,0x4B,0x6E,0x73,0x9A,0xE6,
+	0x5D,0x5B,0x72,0xF5,0xED,0xF7,0xD2,0xCE,0x92,0x2C,0x5C,0xEA,0x0D,0x03,0x8A,0x0E,
+	0x25,0xC0,0x74,0xE3,0x12,0xD0,0x80,0x04,0x10,0x90,0x89,0x2B,0x08,0x60,0x8B,0x71,
+	0x0B,0x10,0xA0,0xB5,0xF3,0xFF,0x07,0x61,0x69,0xC0,0x2B,0x82,0xB3,0xA5,0x79,0x01,
+	0x9A,0x52,0x71,0x57,0xC7,0x31,0x0C,0x5C,0x5D,0xC1,0x59,0x6F,0x7B,0x9A,0xC6,0x3B,
+	0xCB,0xA5,0xCB,0xA9,0xAA,0x6D,0x6B,0xB3,0xCD,0xA7,0x6C,0x29,0xB4,0x34,0x56,0xAF,
+	0xBA,0x0F,0x23,0x93,0x5C,0x32,0xC7,0xB6,0xF6,0x46,0xA4,0x39,0xB3,0xF3,0x86,0x40,
+	0x11,0xCA,0x5D,0x44,0x36,0x00,0x80,0x02,0x96,0x2A,0x35,0xC0,0xB6,0x97,0x0C,0xE8,
+	0xF9,0x04,0x01,0xC5,0x19,0xFC,0x3F,0x61,0xED,0x40,0xC7,0xCD,0xD2,0x96,0x65,0x01,
+	0x9E,0x50,0x73,0x5B,0x96,0x83,0x70,0x87,0x2D,0xD9,0x9A,0x3B,0xA9,0x49,0x97,0x2E,
+	0xB7,0xBF,0xDD,0x6D,0x4F,0x5B,0xD5,0xBA,0x95,0x75,0xD9,0xFD,0x1A,0x86,0x6B,0xD6,
+	0x8A,0xC5,0x7B,0x9A,0xF3,0x3C,0xFA,0x51,0xAE,0x9E,0x59,0x55,0x2A,0x72,0xBE,0xC2,
+	0x35,0x12,0xB9,0x88,0xBB,0x89,0x57,0xB8,0x7A,0x72,0x77,0xB0,0x3A,0xE9,0xEF,0x2E,
+	0xC5,0xDD,0x1F,0x87,0xBF,0x8A,0xD0,0xEA,0x68,0xF8,0xFF,0x65,0xDF,0x98,0xA3,0x4A,
+	0xB4,0xE5,0x65,0x4E,0xAB,0x9F,0xD4,0xA2,0x92,0xBC,0x9E,0xB6,0xF2,0xC8,0x71,0xEA,
+	0x7B,0x9B,0xD5,0x24,0x5E,0x3D,0xCC,0x79,0x77,0x3B,0xFB,0xB9,0xF4,0xBD,0xEE,0xF5,
+	0x0C,0x97,0x37,0x5D,0x0B,0x92,0xC7,0xDF,0xFE,0xFD,0x7F,0xC2,0x56,0x3C,0x7D,0xDC,
+	0x12,0xDB,0x3E,0x8C,0x89,0xBA,0x4C,0x4A,0x96,0xD3,0x75,0x95,0x12,0x6E,0xBD,0x6F,
+	0xB7,0xBA,0x16,0x5A,0x58,0x3D,0xB3,0x03,0xA6,0x14,0x76,0xC0,0xCC,0x37,0x11,0xC8,
+	0x40,0x04,0x22,0xB0,0x92,0xD9,0x9A,0xC1,0x7D,0xF5,0xCD,0x6F,0x3E,0x8A,0x39,0x14,
+	0xA5,0x72,0xD4,0x28,0x67,0x56,0xD4,0x89,0xD2,0xB3,0xE9,0x63,0x5D,0xD2,0xDA,0x03,
+	0x49,0xA9,0xDB,0xCD,0x47,0x3C,0xE3,0xEB,0xBF,0xF4,0x75,0x57,0xEC,0xEE,0x9B,0xF2,
+	0x9B,0xBE,0x56,0x34,0xCC,0xA2,0xF2,0xFF,0x03,0x6E,0x8A,0x42,0x6C,0xD5,0x9A,0xA4,
+	0xB1,0x72,0xA5,0x2A,0x49,0x5B,0x87,0xD3,0x75,0x5B,0x1A,0x2E,0xAB,0x6F,0x7D,0xAB,
+	0x53,0x76,0xDF,0x12,0xE6,0xAF,0x6F,0x71,0x8A,0x1E,0x43,0x52,0x72,0xF1,0x2A,0x7A,
+	0x24,0x4D,0x4E,0xD7,0xA5,0x6A,0x06,0x32,0x2D,0x34,0x8F,0x7A,0x24,0x12,0x97,0x4E,
+	0xB8,0xFA,0xE1,0x1D,0xD5,0xB3,0xE1,0x1A,0x7A,0x0D,0x12,0xB5,0xD5,0x6B,0xAC,0x51,
+	0x24,0xD4,0x56,0x97,0x25,0x5A,0xB3,0x32,0x59,0x93,0xB6,0xA8,0x27,0x3C,0x31,0x4F,
+	0xDE,0xEB,0x5E,0xCF,0x72,0x26,0x3E,0xD5,0xC6,0xF9,0xCA,0x55,0x71,0x77,0x39,0x7B,
+	0x2B,0xD7,0x40,0xD1,0x1D,0xAC,0xBD,0xDC,0x05,0x57,0x77,0x90,0xB7,0xFC,0xFC,0x3F,
+	0x66,0x71,0x52,0xED,0xD2,0x92,0x86,0x39,0x2B,0xE6,0x4E,0x8F,0x9B,0xC7,0xD1,0x17,
+	0xA3,0x1C,0x22,0x69,0x4F,0xD7,0x73,0xA8,0x9B,0xAE,0xBE,0xF5,0xAD,0x6E,0x39,0xF2,
+	0xEE,0x45,0xD4,0x7C,0xA5,0x01,0x1A,0x63,0x0E,0xC0,0xA8,0x81,0x11,0x18,0x7D,0x8F,
+	0x29,0x68,0x96,0x75,0x0C,0x25,0x27,0x71,0x85,0xF7,0x39,0xCF,0x7D,0x1E,0xE5,0x2A,
+	0x4B,0xD8,0x5B,0xF3,0xE4,0x27,0x3E,0xFE,0x75,0x7F,0x19,0x46,0xD9,0xBC,0xE5,0xFF,
+	0x01,0x66,0x31,0x3C,0x7C,0x52,0xE3,0xF8,0xC5,0xCF,0x6B,0x2A,0x5E,0x3C,0x34,0x96,
+	0x9C,0xBE,0xC7,0x10,0x77,0x7F,0x7D,0x9B,0x51,0xF5,0xA1,0x6C,0xE2,0x8F,0x53,0xDD,
+	0x1A,0x52,0x68,0x4D,0x0E,0x43,0xF5,0x48,0xE3,0x55,0xBA,0xCD,0x7D,0xA4,0x28,0x6B,
+	0x93,0x35,0xB7,0xC2,0x12,0x9A,0x4F,0xCE,0x5A,0x5D,0x68,0xBA,0x6E,0xDE,0xDB,0x3C,
+	0xC7,0x59,0xA2,0x66,0x6A,0xCC,0xE9,0x6F,0x7D,0xFF,0x1F,0xA1,0x8F,0x5C,0xB5,0x56,
+	0x92,0xE4,0xE1,0xF4,0xDD,0x0B,0x59,0x6B,0xE3,0x53,0x8C,0x14,0x44,0x15,0x8B,0x46,
+	0x3A,0xB3,0x03,0x7B,0xBE,0x99,0x89,0x49,0xB7,0x72,0xC4,0xEA,0x4C,0x01,0xD8,0x2E,
+	0xC8,0x03,0xA3,0xAB,0x91,0x39,0x2C,0x17,0x8D,0xAE,0x36,0xE6,0x34,0x7F,0x3D,0xE6,
+	0xEA,0x13,0x6C,0x79,0x73,0x3B,0xAA,0x1B,0xB0,0xD3,0x3C,0xFD,0x6A,0x4F,0xF1,0x09,
+	0x35,0x9E,0xA5,0xBE,0xFF,0x0F,0x22,0x8B,0x44,0xF5,0x92,0x9B,0xDA,0xC5,0xCF,0x6B,
+	0xA8,0xBC,0x2B,0x8B,0xB3,0xDC,0xEE,0xB6,0xA7,0x6E,0x3E,0xB9,0xC2,0x56,0x9F,0xA2,
+	0x57,0x93,0xD0,0x9C,0x5D,0x8A,0x3E,0x88,0x52,0xA6,0x32,0x2B,0xAA,0x15,0x34,0xCB,
+	0xD4,0xC0,0x80,0x12,0x23,0x22,0x60,0x81,0x30,0xC5,0xAA,0x61,0x25,0xF9,0x7A,0xDF,
+	0x87,0x31,0x17,0xDE,0x1E,0xC5,0xFE,0xDB,0x96,0xD5,0xD8,0x38,0xF4,0xAB,0x47,0x78,
+	0xBC,0xAB,0x18,0xE1,0x3C,0xFE,0xF5,0xDF,0xFF,0x03,0x6E,0xF0,0x8A,0xB3,0x4B,0xEB,
+	0xC6,0xAE,0x36,0xA7,0x1A,0x3A,0x54,0x53,0xD6,0xDC,0xEC,0x66,0x23,0xDF,0x58,0x26,
+	0x43,0xB4,0xCD,0xEA,0x74,0x5D,0x94,0x46,0xF0,0x96,0x3B,0x9D,0x79,0x98,0x26,0x75,
+	0xDB,0xB3,0xD7,0xB6,0xF5,0x90,0xA8,0x91,0x9F,0xEA,0x9E,0xEE,0xE9,0x9B,0x20,0x7D,
+	0xCB,0xFF,0x03,0x66,0x8E,0x8A,0xA2,0xC2,0x93,0xFA,0x29,0x8E,0xB9,0x1B,0x6D,0x4B,
+	0xA6,0x26,0xF9,0xE4,0xD6,0xB7,0xBA,0xD5,0x6A,0xAB,0x4C,0x6B,0xD5,0xC7,0x6B,0x28,
+	0xA4,0xB3,0x8D,0xFB,0xCC,0xB9,0xEC,0x05,0x75,0x97,0x61,0xDE,0xBA,0xE7,0x33,0x5D,
+	0x0D,0x47,0x4D,0x80,0x97,0x78,0x9B,0xC7,0xEA,0xA9,0x62,0xED,0xFC,0xFF,0xE6,0x28,
+	0xC4,0xF8,0x44,0x9A,0xFB,0xCD,0xAD,0x8D,0x2A,0x4E,0x4A,0xBC,0xB8,0x8C,0xB9,0x8A,
+	0xA9,0x48,0xED,0x72,0x87,0xD3,0x74,0x3B,0x1A,0xA9,0x9D,0x6F,0xB3,0xCA,0x5E,0x8C,
+	0xC3,0x7B,0xF2,0xCE,0x5A,0x5E,0x35,0x66,0x5A,0x3A,0xAE,0x55,0xEB,0x9A,0x57,0x75,
+	0xA9,0x29,0x6B,0xEE,0xB6,0xD5,0x4D,0x37,0xEF,0xB5,0x5D,0xC5,0x95,0x84,0xE5,0xA6,
+	0xFC,0x30,0xE0,0x97,0x0C,0x0D,0x58,0x40,0x03,0x1C,0xA0,0xC0,0xFF,0x03,0x61,0xCA,
+	0xCC,0x38,0x5B,0x9A,0xE6,0xA9,0xB6,0xA7,0xEC,0x2A,0xC5,0xDD,0x17,0xDF,0xE2,0xE6,
+	0x23,0x6B,0x16,0xC3,0x2D,0x92,0xCC,0x72,0xB5,0xD5,0xBA,0x86,0xD5,0xEC,0xB9,0x94,
+	0xAD,0x98,0x90,0xF4,0x79,0x14,0xDE,0x8E,0x53,0x3C,0x63,0x23,0x02,0x45,0x28,0x77,
+	0x11,0xD9,0x00,0x80,0x80,0xCF,0x58,0x05,0xF0,0x7B,0x99,0x04,0x38,0xC0,0x01,0x0A,
+	0x50,0xE0,0xFF,0x01,0x66,0xAA,0x8C,0x69,0x53,0x92,0xC4,0x2D,0x2F,0x6B,0x2A,0x74,
+	0xDA,0x9D,0xB2,0xDD,0xF6,0x36,0xAB,0xCE,0x78,0xDA,0x9D,0xB2,0xD5,0x9A,0x01,0xDB,
+	0x77,0x45,0xA0,0x75,0xC5,0xB8,0x71,0x59,0xDA,0x31,0xE5,0x6A,0x22,0x63,0xDE,0xDA,
+	0x9A,0xBB,0xA3,0x75,0x68,0xAF,0x7B,0x3E,0xC3,0x9D,0x97,0x60,0x87,0xE6,0x8B,0x4F,
+	0x78,0x4B,0x76,0xB2,0x09,0xAF,0xFE,0xFD,0x7F,0x6A,0xD7,0xC2,0xF2,0xD2,0xEC,0xB8,
+	0x39,0x08,0xF6,0x4D,0x4D,0x1A,0xC6,0x24,0x31,0xB2,0xCC,0x69,0x1E,0x56,0x9D,0x85,
+	0x7B,0x15,0xA4,0x3B,0x55,0x23,0x9E,0x3E,0xE0,0x6D,0xE7,0x23,0xAF,0x20,0xC6,0x0A,
+	0xBC,0xCE,0xA2,0x34,0x91,0x6C,0x89,0x43,0xDF,0x3A,0x94,0x31,0x83,0x6E,0x4D,0xE8,
+	0x9A,0x96,0x0C,0x3A,0x63,0x20,0x5B,0xD8,0xAC,0xEC,0xC8,0x20,0x37,0x7E,0xB7,0xA7,
+	0x3D,0xCD,0xD9,0x8A,0x78,0x28,0x2E,0xB5,0x97,0xBD,0xED,0xCD,0x80,0x52,0x32,0x28,
+	0x80,0x81,0xFF,0x07,0x66,0x8E,0x54,0xAC,0x9A,0xE7,0x84,0xA9,0x0A,0xE2,0x1C,0xAE,
+	0x5B,0xC6,0xE6,0x51,0xCD,0x23,0xE9,0xE9,0x8B,0x71,0x77,0xD3,0xAE,0xA7,0x2A,0x22,
+	0x3D,0x8B,0xB2,0x9E,0x32,0x8B,0xCE,0x6C,0xD6,0x76,0x8B,0x55,0x26,0xB7,0xE2,0xCB,
+	0x7A,0x77,0x35,0x87,0xB6,0xE5,0x92,0x54,0xA9,0xF9,0xC6,0x91,0x63,0x88,0xA7,0x77,
+	0xEE,0x67,0xBA,0x4B,0x60,0x2F,0xAB,0xD6,0x04,0x18,0xB2,0x44,0x03,0x06,0xC8,0xB2,
+	0x44,0x03,0x14,0xA0,0xC0,0xFF,0x03,0xE9,0x38,0x5C,0x84,0x33,0xBD,0x8E,0xB6,0x9A,
+	0x70,0x09,0x6B,0xBB,0x8B,0x93,0x66,0xDE,0x91,0xC9,0xFE,0x6E,0xBA,0xB2,0x24,0xAA,
+	0x26,0x51,0xDD,0xCC,0x47,0x1D,0x7C,0x75,0x3A,0xE5,0x99,0xC3,0x5C,0xCA,0x1E,0x52,
+	0x6A,0xA7,0xE4,0xCF,0x7B,0xB9,0x53,0x4E,0x8E,0x31,0x6F,0xFD,0x4C,0x77,0x1A,0xC2,
+	0x93,0x96,0x25,0xDD,0xA9,0x04,0x4E,0x87,0xDB,0xF0,0xE4,0x2D,0xB4,0x6E,0x59,0xE2,
+	0xE3,0xDF,0xFF,0x07,0x66,0x6B,0x1A,0x25,0x5B,0xEB,0xFA,0x35,0x2D,0xCD,0x89,0xA7,
+	0xDA,0x9A,0x31,0x34,0x93,0x9E,0xA6,0x4B,0x4E,0x57,0xE5,0x86,0x85,0x6C,0xBE,0xED,
+	0x6D,0x57,0x93,0xFC,0xB9,0x96,0x2D,0x1E,0x4D,0xCE,0xAD,0xE9,0x3E,0x7B,0xF7,0x7D,
+	0x66,0xB3,0x08,0xE5,0x2E,0x22,0x1B,0x00,0x40,0x01,0x4B,0xB8,0x2B,0xE0,0x87,0x68,
+	0x05,0x74,0x9D,0x82,0x80,0x62,0x55,0xFE,0x1F,0x66,0xA9,0x12,0x72,0x42,0x9B,0x86,
+	0xA5,0x1B,0x90,0x0E,0x6D,0x76,0xA6,0x26,0x2B,0xDC,0xA5,0xCF,0x6D,0x4F,0x95,0x4D,
+	0xA5,0xBB,0x6E,0x5E,0x45,0x31,0x5E,0x65,0x92,0x66,0x14,0x45,0xAA,0xB4,0x98,0x9D,
+	0x5A,0x84,0x2A,0x18,0xF6,0x92,0x74,0x43,0x3A,0xAD,0x5C,0x27,0xDD,0x6D,0x98,0xA3,
+	0x09,0xF5,0x92,0xA4,0x65,0x4C,0x4D,0xA4,0x82,0x56,0x97,0x39,0x77,0xC7,0x68,0xF1,
+	0x5D,0xD6,0xDC,0x1D,0x63,0xD4,0x4F,0xBE,0xC3,0x9D,0x53,0x81,0x4E,0xF3,0x89,0x9F,
+	0xFF,0xDC,0x5F,0x66,0x92,0xB5,0x7A,0xFE,0x7F,0x6B,0x4A,0xE2,0xBA,0x8D,0xBC,0xED,
+	0x66,0xD7,0xBB,0x9E,0xC3,0x98,0x93,0xB9,0x18,0xB2,0xDE,0x7D,0x73,0x67,0x88,0xDD,
+	0xC5,0xF6,0x59,0x15,0x55,0x44,0x56,0x71,0x6B,0x06,0x74,0x53,0xA6,0x01,0x0D,0x68,
+	0x80,0x03,0x1C,0xF8,0x7F,0xAD,0xC9,0x74,0x37,0x59,0xD2,0xED,0xE6,0xD4,0x95,0xF8,
+	0x56,0xB0,0xD2,0x5D,0x9D,0xAA,0x12,0xAF,0x2D,0xB7,0xBA,0xDB,0xDE,0xB7,0x79,0x68,
+	0x93,0x32,0x96,0xD2,0x97,0xBA,0xE6,0x3D,0x9F,0xEE,0x6A,0x92,0xB9,0x22,0x9C,0x98,
+	0x2B,0x33,0x8E,0x16,0x8F,0xEB,0xEE,0x6E,0xD1,0x5A,0x3C,0x4D,0xB8,0x06,0x09,0x35,
+	0xA5,0xDE,0xE1,0xFA,0xC5,0xD8,0x4D,0xE4,0x2A,0xE0,0x5B,0x15,0x05,0x7C,0x27,0xA4,
+	0x01,0x0E,0x70,0x00,0x01,0xDE,0x6C,0xFE,0x3F,0x65,0x4A,0xEA,0x3A,0x5C,0xB2,0xCE,
+	0x6E,0x57,0xA7,0x48,0xE6,0xD2,0x5D,0xBB,0xEC,0x62,0x17,0xBB,0xDE,0x7D,0x9F,0xDA,
+	0x5C,0x5C,0x7A,0xAA,0xB5,0x6E,0xCB,0xD0,0x0E,0xAD,0x6E,0xAF,0xEE,0xF9,0x88,0x67,
+	0xBC,0xDC,0x3D,0xAC,0x60,0xB8,0x45,0xF3,0xB7,0xBF,0xC3,0xDD,0xA2,0xBB,0xAB,0xCD,
+	0x89,0x8F,0x7F,0xFE,0x1F,0x61,0xCC,0xB8,0x7B,0x8C,0xB2,0xF5,0x61,0x8F,0xAB,0xA9,
+	0x30,0xA7,0x83,0xBC,0xCD,0xBA,0x95,0x19,0x57,0x97,0xB1,0x6B,0xD2,0x58,0x12,0x31,
+	0x11,0x89,0x01,0x01,0x2E,0x9A,0x48,0x60,0x94,0xC5,0x86,0xBB,0xC9,0xA6,0x35,0x36,
+	0x95,0x1A,0xA6,0x7B,0xF6,0x3E,0x8E,0x26,0x42,0x3D,0x78,0xF1,0x3C,0xCB,0xD5,0x0D,
+	0x71,0x78,0x24,0xAB,0x77,0xBA,0x47,0x12,0x73,0xB1,0xB8,0xF9,0xFE,0x7F,0xB0,0x9A,
+	0xAC,0xB6,0xC2,0xAD,0xCD,0xA9,0x3B,0x9D,0xCE,0x94,0x2C,0xB7,0x5A,0x65,0xB6,0x9B,
+	0x61,0xBA,0x66,0x15,0xC5,0x65,0x8C,0xF3,0x62,0x94,0x89,0x50,0xEE,0x22,0xB2,0x01,
+	0x5A,0x95,0x7C,0xB9,0xAB,0x25,0x29,0x55,0x5C,0xC2,0xD3,0x94,0xB5,0x37,0xA9,0x0B,
+	0x9B,0x2C,0x4B,0xB9,0xE6,0xA1,0x8E,0x63,0xCE,0x83,0x53,0xD2,0xFC,0xAE,0xA5,0x16,
+	0x97,0x70,0xCD,0x3B,0xD6,0x11,0x4F,0x30,0xB4,0x4F,0xDB,0x46,0x3C,0x62,0xE3,0x3D,
+	0xF9,0x00,0x07,0xCC,0xD4,0x29,0x81,0xB6,0xD5,0x3A,0x28,0x2D,0x7E,0xDB,0x51,0xFD,
+	0x09,0x2C,0xFB,0xCF,0x77,0x7A,0x4A,0x2C,0x94,0x93,0xBC,0xE1,0xA9,0xE1,0x04,0x46,
+	0xFD,0xC5,0x37,0xFC,0x65,0x19,0x56,0x72,0x96,0xFF,0x07,0xAD,0xCF,0xE6,0xDD,0xD3,
+	0x17,0xED,0xFE,0xF4,0x9D,0x4F,0x56,0x71,0x97,0xDB,0xDD,0xEE,0x76,0xA7,0xCF,0xAE,
+	0x6A,0x54,0x5A,0xEF,0x7E,0x0F,0x7B,0x4C,0x6B,0x88,0x95,0x21,0xBC,0xD9,0x6F,0x08,
+	0x14,0xA1,0xDC,0x45,0x64,0x03,0x00,0x08,0xE0,0xE8,0x2E,0x0F,0x50,0xE0,0xFF,0x01,
+	0x63,0x6F,0xC4,0x7A,0x1D,0xB5,0xED,0x61,0x37,0xBB,0x6E,0x75,0x62,0xD9,0x2D,0xEC,
+	0xBF,0x56,0xAD,0x09,0xBA,0x32,0x8C,0x13,0xC7,0xD6,0xED,0x4D,0x85,0x86,0x99,0xE3,
+	0x3E,0xB7,0x29,0x86,0x90,0x2C,0x76,0xDB,0xE6,0x98,0x95,0xBB,0x38,0x4F,0x5B,0x72,
+	0x29,0xB4,0x51,0x6F,0x7D,0xAF,0x47,0xB9,0x73,0x71,0x8C,0x31,0x3F,0xE1,0xC9,0xA9,
+	0x50,0xD6,0xFD,0xBA,0x27,0x57,0xC5,0x6E,0xCD,0xFD,0xFF,0x0A,0xC8,0x33,0x83,0x03,
+	0xA3,0xEC,0x55,0x2D,0xD4,0x12,0xAF,0xAA,0x04,0xC9,0xD4,0x0E,0x7D,0xAA,0x16,0x4A,
+	0x33,0x65,0xCE,0xAD,0x6F,0x7D,0x9A,0x9A,0xDC,0xDB,0x62,0xEE,0x6D,0x6E,0x73,0xC6,
+	0x12,0xDD,0x5B,0x6B,0xEE,0x5D,0xF6,0x3A,0xCE,0xAA,0xD2,0x26,0xED,0x75,0xBB,0x9B,
+	0x4D,0x6D,0xF1,0x25,0xFD,0x77,0x7F,0xEF,0xD2,0xCE,0x9D,0x46,0x00,0x4B,0x17,0x2B,
+	0xE0,0x8F,0x52,0x0B,0x68,0x40,0x02,0x1C,0x90,0xC0,0xFF,0x03,0x0A,0x88,0x29,0x4C,
+	0x02,0x25,0xAB,0x4E,0xB4,0xCC,0x6B,0x9E,0x22,0x47,0x89,0xF2,0xAA,0x7C,0xEA,0x1A,
+	0xDC,0x3A,0xED,0xCE,0xAD,0x6F,0x77,0x87,0x3B,0xCF,0x7D,0x9C,0xD5,0xBA,0x75,0xEA,
+	0xE2,0x7E,0xB5,0xAB,0x05,0x8D,0x96,0x5C,0xE2,0xCE,0x3E,0x39,0x93,0xCA,0x0D,0x03,
+	0xBE,0x37,0xD5,0x80,0x05,0x3C,0x60,0x01,0x0D,0x00,0x02,0x9E,0xE7,0xB0,0x80,0x00,
+	0xA6,0x5E,0x47,0x40,0x1D,0x4B,0xFF,0x0F,0x02,0xC8,0xD9,0x5C,0x03,0x2D,0x8A,0xB1,
+	0x30,0x46,0x52,0xAF,0xBA,0x86,0x26,0x1A,0xF6,0x77,0x9B,0xD3,0xD5,0x18,0x68,0x69,
+	0x59,0x63,0xEF,0x80,0x5F,0x5A,0x2D,0x60,0x01,0x0B,0x68,0xC0,0x03,0xAB,0x6E,0xDE,
+	0x25,0x2D,0x17,0xDF,0xFA,0x36,0xBB,0x1D,0x53,0xB1,0x6E,0x23,0x5D,0xA7,0x5D,0x23,
+	0x92,0xB9,0xA7,0x62,0x7F,0x20,0x50,0x84,0x72,0x17,0x91,0x0D,0x00,0xA0,0x80,0xA5,
+	0x33,0x0C,0xF0,0xB3,0x27,0x02,0x5A,0x4A,0xFD,0x7F,0x22,0x5E,0x2E,0xD5,0xC4,0x64,
+	0xA5,0xF6,0x9A,0x52,0x26,0xF1,0xB6,0xDA,0xEA,0x54,0x2C,0x6B,0xCE,0x69,0x7A,0x0A,
+	0x51,0x89,0xB7,0xA7,0x19,0xA9,0x98,0xCD,0xDE,0xDC,0xE6,0x36,0xAB,0x9B,0xA1,0x11,
+	0x23,0x3E,0xCF,0xB1,0xAF,0x7D,0xAB,0x7B,0x3C,0xFC,0x19,0x9E,0xA6,0x55,0x9C,0x6D,
+	0xB7,0x7F,0xEC,0xCB,0x80,0xEF,0xCB,0x39,0x40,0x81,0xFF,0x07,0x08,0xC8,0x8E,0x48,
+	0x03,0x2B,0xEA,0xC1,0x48,0xD2,0x57,0x9F,0x6C,0xE6,0x25,0x08,0x5B,0x73,0xB3,0x54,
+	0x8C,0xC1,0xE0,0x56,0xB3,0x75,0x15,0x80,0xE6,0x47,0x3D,0x30,0x86,0xE2,0x82,0x35,
+	0xB4,0xF7,0x1A,0xB2,0x71,0xF3,0xD6,0xBC,0x6B,0xA9,0xA2,0x2C,0x8A,0xBD,0x8F,0x23,
+	0x89,0xF5,0x34,0xC9,0xDF,0xCF,0x76,0x45,0x57,0x51,0x22,0x79,0xD3,0xED,0xFD,0x6A,
+	0xA8,0x75,0x8D,0x8F,0x79,0x6C,0xCD,0x74,0xB6,0xDD,0xEA,0xB5,0x65,0xD4,0xCD,0xFA,
+	0xFC,0x3F,0x0A,0x18,0x4D,0x44,0x01,0x23,0x70,0x12,0x40,0x8B,0xD8,0x92,0x7A,0xD3,
+	0x63,0x10,0xAD,0x57,0x91,0xC4,0xB5,0x8A,0xAE,0x39,0x45,0xE1,0x93,0xE9,0xBC,0xE5,
+	0x96,0xB7,0x59,0x43,0x15,0x63,0xE9,0xBA,0x6B,0x6E,0xF5,0x64,0x40,0xF0,0xEE,0x0A,
+	0xF8,0x25,0x43,0x03,0x1E,0xD0,0x80,0x04,0x38,0x40,0x01,0x0C,0xFC,0x3F,0x06,0xA8,
+	0xCC,0x4B,0x03,0x2D,0xF3,0x69,0x2B,0x8C,0x1A,0xAF,0x2C,0x98,0xE9,0x28,0x4A,0xB3,
+	0xF3,0x53,0xC6,0x90,0x9E,0xC1,0x6D,0x76,0x77,0xE6,0x9C,0x5D,0xD3,0x75,0xF1,0x58,
+	0x5B,0x75,0x76,0xB7,0x4F,0xE3,0xE8,0xCE,0x31,0x3A,0x17,0xB6,0xB3,0x45,0x96,0xF4,
+	0xAA,0x6D,0x4F,0x75,0x76,0xA3,0x94,0x66,0x6E,0x10,0x28,0x42,0xB9,0x8B,0xC8,0x06,
+	0x50,0xC0,0x32,0x11,0x0A,0x58,0x76,0x87,0x01,0x3D,0xB5,0xFE,0x3F,0x02,0xC8,0x3C,
+	0x78,0x24,0x5D,0xB8,0xBB,0x53,0xB7,0x5B,0xDC,0x62,0xD5,0x4B,0x38,0x87,0xA1,0x1F,
+	0x05,0x5C,0x40,0x66,0x81,0x95,0x1D,0x19,0xA6,0x4E,0x7E,0x4E,0x3C,0x75,0xA8,0x39,
+	0xF5,0x3D,0x51,0xB7,0xA9,0xA6,0xBA,0xE7,0x44,0x2D,0x99,0x2A,0xC7,0xA6,0x04,0x8C,
+	0x3E,0x95,0x81,0x0C,0x78,0xA0,0xF5,0x2D,0xA8,0x98,0xD9,0x96,0x3D,0x8D,0x69,0xE8,
+	0x64,0x4B,0xE9,0x3B,0x8E,0xA1,0x9D,0xBD,0xA4,0x4B,0x3B,0xBA,0x16,0x2C,0x77,0x7B,
+	0xF9,0xCA,0x4F,0x78,0x7B,0x20,0x35,0x0B,0xA7,0xF1,0xFF,0x7F,0x0C,0xF0,0xDC,0x4C,
+	0x03,0x2B,0xCD,0x36,0xAB,0x85,0x1B,0x9F,0xBC,0xB1,0xAE,0x6A,0xEA,0x7A,0xB3,0x95,
+	0x15,0xD5,0x39,0x85,0x5D,0x46,0x96,0x7C,0x57,0x3B,0xB6,0x19,0x79,0x30,0x93,0x55,
+	0xA4,0xBB,0xD4,0x2E,0xAD,0x79,0xB1,0xDE,0x3E,0x8D,0x29,0x85,0x61,0x1F,0xF6,0x3B,
+	0xB7,0x7E,0x94,0x33,0x97,0x46,0x5B,0xCE,0x9D,0x9F,0xF0,0x16,0x3F,0x48,0xE7,0x7E,
+	0xC3,0x5B,0xE3,0xA2,0xAC,0xEB,0xF6,0xDF,0xFF,0x03,0x06,0x28,0xC1,0x4C,0x03,0x2D,
+	0x49,0x59,0x4A,0x9A,0x3D,0x9F,0xAC,0x04,0x2D,0x2D,0x69,0x73,0xB2,0x56,0x4C,0x43,
+	0x6D,0xF5,0xCD,0x5A,0x3E,0x6A,0x89,0x09,0x65,0x71,0xC0,0xAA,0xDB,0x1E,0x88,0x40,
+	0x04,0x46,0xDF,0x63,0x0A,0x9A,0x65,0x1D,0x43,0xC9,0x49,0x5C,0xE1,0x7D,0xCF,0x7B,
+	0x9F,0x47,0xB9,0xCA,0x12,0xF6,0xD6,0x3C,0xF9,0x8B,0x9F,0xFD,0xFF,0x1F,0x02,0x28,
+	0x31,0x43,0x03,0x25,0xCB,0xBE,0xDC,0x5D,0xED,0x94,0x22,0x0E,0xCE,0x70,0xC9,0xBD,
+	0xF2,0x9C,0xD5,0xBD,0x24,0xEF,0xC9,0xAB,0x77,0xF5,0x92,0x3E,0x27,0x6B,0xA1,0x25,
+	0xD5,0x56,0xDF,0xEC,0x34,0x5D,0xA7,0x94,0xF9,0xEB,0x3B,0xEC,0x69,0xEE,0x75,0x15,
+	0xC0,0x57,0xC1,0x02,0xF8,0x3D,0x5D,0x02,0x1A,0xD0,0x80,0x04,0x28,0x80,0x81,0xFF,
+	0x07,0x02,0xC8,0x29,0x5D,0x03,0x2E,0x0A,0x83,0xCB,0x5D,0x33,0xF7,0xFC,0x94,0xD1,
+	0x96,0x57,0x71,0xF2,0x53,0x66,0xDE,0xE9,0x8D,0xDE,0x76,0x3D,0xDB,0x3E,0x95,0xDD,
+	0xBB,0x8E,0x54,0xEA,0x13,0x0F,0x73,0x19,0x95,0x91,0x46,0x9E,0xD8,0x23,0x68,0x47,
+	0x47,0x24,0xE1,0x1F,0xFF,0xC3,0xEF,0x4D,0x6A,0x99,0x25,0x49,0x67,0xF4,0x96,0x69,
+	0xBA,0x24,0x5E,0xEE,0xAA,0x91,0x2B,0x59,0xD7,0xFE,0x3F,0x06,0xF0,0xB6,0x9C,0x01,
+	0x2C,0xB7,0x8F,0x28,0xCA,0x1E,0x53,0x5A,0xBA,0x93,0x95,0x0C,0x2C,0xD3,0x81,0xDA,
+	0x76,0xBA,0xB3,0x51,0x57,0x14,0xB3,0x8E,0xEE,0x67,0xDF,0x87,0x34,0x17,0xE2,0x3B,
+	0x86,0x5E,0xEB,0x11,0xCE,0x24,0x62,0xD3,0xB0,0x69,0xBE,0xFD,0xE3,0xDE,0x20,0x67,
+	0x54,0xA5,0xCD,0xFF,0x03,0x06,0x28,0x22,0x5D,0x03,0xCB,0x4B,0x2A,0x23,0x03,0xDB,
+	0x9E,0xB8,0x88,0x8C,0x18,0xCC,0x7A,0xD3,0x9B,0xAF,0xBA,0x78,0xE7,0x70,0xEB,0xDA,
+	0xC6,0x9E,0x27,0x44,0x44,0xAB,0x01,0x56,0xBE,0x8A,0x40,0x04,0x22,0xE0,0x01,0x0F,
+	0x78,0x40,0x02,0xFF,0x0F,0x6C,0xE7,0xA5,0xD9,0x33,0xAD,0xAA,0x4D,0xF7,0xC0,0x6C,
+	0x93,0xEA,0x66,0x3F,0x95,0x3A,0xD5,0x79,0xEB,0x62,0x17,0x69,0x0B,0xE7,0xAB,0x29,
+	0x45,0x8A,0x4B,0xBD,0x9E,0xBA,0x17,0x63,0xB7,0x58,0x7D,0xAB,0x5B,0xAD,0x7A,0x94,
+	0x00,0xAB,0x9C,0xB5,0xBB,0x39,0xCC,0xB9,0xAF,0x75,0x4F,0x7B,0x8F,0x10,0xEE,0x69,
+	0x27,0x9C,0x3D,0x93,0xA4,0x79,0x5C,0x7F,0x87,0xB7,0x7B,0xE6,0x30,0x8B,0xE7,0x5F,
+	0xF3,0x54,0xCD,0x92,0xA1,0x75,0xFC,0xC3,0x80,0x51,0x9C,0x24,0x60,0x01,0x01,0x8C,
+	0xEC,0xF4,0xFF,0x6A,0xB4,0xD9,0x25,0x4A,0xE5,0xDB,0xD9,0x8D,0xB1,0xB2,0x45,0x9A,
+	0xF6,0xD8,0x9F,0xAE,0x26,0xD7,0x30,0xED,0x72,0xDA,0x9E,0xCD,0x9C,0x6D,0xC9,0x6D,
+	0x76,0xED,0xFA,0xE1,0x93,0x8D,0xAD,0x51,0x1F,0xC7,0xD8,0x13,0x8B,0x5A,0x3F,0x99,
+	0x4B,0x39,0x7A,0x13,0xE2,0xE8,0x3B,0xF5,0xCA,0x77,0x7E,0xC2,0xDB,0x2B,0x8A,0xC7,
+	0xD6,0xFA,0x7F,0x6A,0xB5,0xD9,0x25,0x4A,0xE5,0xDB,0xC5,0x4F,0x6D,0x88,0x95,0x2D,
+	0xD2,0xB4,0x8F,0x2E,0x37,0x0E,0x33,0xCF,0x7E,0xAA,0x9A,0x5C,0xC3,0xB4,0xCB,0xA9,
+	0x86,0x69,0x76,0xD3,0x37,0xB7,0xBE,0xCD,0xED,0xEF,0xB4,0xB7,0xB0,0x35,0x69,0x94,
+	0x22,0x6D,0x10,0x28,0x42,0xB9,0x8B,0xC8,0x06,0x00,0x50,0xCF,0x0E,0xEE,0x62,0xEA,
+	0xA6,0xBC,0xC3,0x14,0xBB,0x4A,0x9F,0xFA,0xA5,0xAF,0x25,0x13,0x17,0xDF,0x9C,0xBF,
+	0xFF,0x07,0x69,0x8E,0x8D,0xCD,0x22,0x95,0xB7,0xA9,0x74,0x09,0xB2,0x54,0x7F,0xC6,
+	0x16,0x83,0xCD,0xB5,0xEF,0x1A,0x7A,0x18,0x22,0x97,0xBE,0x75,0x62,0x93,0x08,0xE5,
+	0x2E,0x22,0x1B,0x00,0x04,0xE0,0x93,0x59,0xCB,0x92,0x53,0xCB,0x8C,0x9A,0xAB,0x68,
+	0xD1,0xC5,0xC2,0x5E,0x9F,0xB2,0xA5,0x22,0x0F,0xD9,0x72,0xAB,0x5B,0xDF,0xE6,0x4E,
+	0x63,0xA9,0x25,0xB0,0x4A,0x3B,0xCF,0xAD,0x1F,0xE9,0xAE,0x7A,0x85,0x4E,0xF2,0xE5,
+	0x27,0xBF,0xF9,0xCD,0x5F,0xFA,0x4A,0x1C,0x92,0xE3,0xDC,0xE9,0x2B,0x35,0xA9,0x5A,
+	0x72,0xFF,0x3F,0x6E,0xF1,0x49,0x42,0x33,0xD8,0xC5,0xB9,0x8C,0xB9,0x62,0x8A,0x87,
+	0xF6,0xD3,0xB7,0xCC,0xC6,0x1A,0xE9,0x4E,0x33,0x9C,0x23,0x79,0x7C,0xDE,0x4D,0x6B,
+	0x5B,0x62,0xB0,0xF4,0x95,0x64,0x16,0xA1,0xDC,0x45,0x64,0x03,0x04,0xA0,0xB5,0x94,
+	0x96,0xF6,0x14,0x4C,0x62,0xAF,0x4E,0xD6,0x13,0x93,0x66,0xCD,0x3E,0xD9,0x6C,0x89,
+	0x64,0xB1,0xFA,0x66,0xBB,0x18,0xFD,0xAC,0x0A,0x92,0xB5,0xA8,0xAD,0xA3,0x10,0x8B,
+	0x4D,0x6D,0x7B,0x21,0x50,0x84,0x72,0x17,0x91,0x0D,0x00,0x06,0xB8,0xDC,0xCD,0x01,
+	0x33,0x6C,0x62,0x00,0x03,0xFF,0x0F,0x66,0xD7,0xB1,0x24,0xDC,0xE3,0x98,0xCD,0x95,
+	0xA4,0x28,0xB5,0x97,0xD6,0xD0,0x8C,0x3A,0x55,0xFE,0x18,0x43,0xB1,0x4C,0x37,0x6F,
+	0xA7,0x2D,0x72,0x22,0x8A,0xF3,0x9E,0xA6,0xFA,0x94,0x0A,0xDD,0x7C,0x9B,0xDB,0xAD,
+	0xB1,0xD7,0x40,0xF3,0x78,0x3D,0xE7,0x7E,0xE6,0x07,0x81,0x22,0x94,0xBB,0x88,0x6C,
+	0x00,0x50,0xC0,0xB6,0xD7,0x1E,0x10,0x40,0x9B,0xEB,0x0C,0x28,0x56,0xE9,0xFF,0x01,
+	0x08,0xF8,0x39,0x4C,0x02,0x1A,0xD0,0x80,0x05,0x3C,0x60,0x81,0x95,0x0F,0x15,0xE2,
+	0x6A,0xAB,0x4F,0xD1,0x43,0x8A,0x8A,0xBF,0xB9,0xD5,0xAD,0x57,0x3F,0xAA,0x23,0xBB,
+	0x3F,0x9E,0xCB,0xDC,0xF3,0x99,0x9E,0x5E,0x19,0xCD,0xEB,0x8E,0x79,0x7A,0x43,0x13,
+	0xED,0x39,0x0C,0x18,0x7E,0x5C,0x02,0x12,0x90,0x00,0x07,0x28,0x40,0x81,0xFF,0x07,
+	0x04,0xF8,0xC5,0x51,0x01,0xBF,0xA6,0x6A,0x40,0x03,0x16,0xD0,0xC0,0xCA,0xAB,0x75,
+	0x2D,0xCD,0x25,0x37,0xBB,0xD9,0xCA,0xDA,0x54,0x0F,0xEE,0xD9,0x29,0x6B,0x47,0x30,
+	0xD8,0xE3,0x80,0x00,0x6A,0x26,0x6D,0x55,0xEB,0xCA,0x21,0xB9,0xE4,0xD4,0xDD,0x26,
+	0xA5,0xF9,0xE3,0x3D,0xB6,0x75,0x38,0xA3,0x31,0x5B,0x9A,0xB6,0x11,0x51,0x32,0xD2,
+	0xAA,0x3F,0xFC,0x21,0xCE,0x22,0xD1,0xD7,0x2D,0x9E,0x39,0x0B,0x37,0x4E,0xD7,0x26,
+	0xE1,0xFA,0xC4,0x55,0x42,0xFD,0x85,0xFB,0x7B,0x77,0x13,0xA3,0x27,0x80,0x03,0xD0,
+	0x25,0x20,0x01,0x0A,0x20,0x20,0x69,0xD6,0xFF,0x07,0x04,0xF8,0xAD,0x94,0x03,0x1A,
+	0xB0,0x80,0x07,0x2C,0xB0,0xA2,0xE6,0xCD,0xD4,0xB4,0xEB,0xC9,0xAA,0x4D,0xE1,0xD6,
+	0xEC,0x23,0x2B,0xBE,0x85,0x96,0xFD,0xCD,0xBC,0x15,0xB9,0x16,0xE9,0xB0,0xBF,0x51,
+	0x66,0x5F,0x24,0xA3,0x7A,0x53,0x97,0xBD,0x89,0xBB,0xC4,0x52,0x4B,0xB1,0xAE,0xE6,
+	0x9A,0xB9,0xEE,0x63,0xAD,0xCE,0x35,0xD4,0x7A,0xCF,0xA3,0x9F,0xE9,0x2E,0xD2,0x25,
+	0xDD,0x77,0x13,0xE0,0xB7,0x52,0x09,0x48,0xC0,0x02,0x16,0x90,0x00,0x05,0xFE,0x1F,
+	0x08,0xF8,0x35,0x95,0x03,0x02,0xF8,0xC5,0x58,0x03,0x16,0xB0,0xC0,0x2A,0xA6,0x08,
+	0x13,0xD7,0xCE,0xA7,0xEC,0xAE,0xD5,0xCC,0xD6,0xDC,0xEA,0x54,0x35,0xA6,0xA4,0xE5,
+	0x9A,0x3D,0xCC,0x25,0x2E,0x08,0x14,0xA1,0xDC,0x45,0x64,0x03,0x00,0x30,0x60,0x88,
+	0x30,0x05,0xFC,0x1C,0x25,0x80,0x65,0xB6,0x10,0x50,0xA2,0xD0,0xFF,0x03,0x04,0x58,
+	0xE3,0x5A,0x03,0x16,0xF0,0x80,0x07,0x22,0x60,0x81,0x55,0xB4,0xE4,0xA2,0x61,0x5D,
+	0x6E,0x71,0xCA,0x12,0x3C,0xCA,0x7C,0xCE,0xAD,0x76,0x31,0xD7,0xBC,0x23,0x50,0x84,
+	0x72,0x17,0x91,0x0D,0x00,0x06,0xE8,0x44,0x5D,0x01,0x3F,0x66,0x11,0xE0,0x98,0x59,
+	0x04,0xF4,0x38,0xFE,0xFF,0x04,0xF8,0xCB,0x44,0x01,0xBF,0x86,0x5B,0xC0,0x02,0x1C,
+	0x28,0xD3,0xC6,0x1C,0x55,0xA2,0xAD,0x0F,0xB3,0x3D,0xC5,0xA4,0x16,0x95,0xE4,0xF5,
+	0x64,0x95,0x7B,0x8E,0x53,0xDF,0x9B,0xAD,0x22,0xF1,0xEA,0x61,0xCE,0xBB,0x9B,0xD9,
+	0xCF,0xB9,0x2F,0x7D,0x0D,0x9B,0xD7,0x5D,0x0B,0x92,0x27,0x1E,0xEE,0xD4,0xA5,0x32,
+	0x50,0xDB,0xD8,0xD3,0x5E,0xEE,0xF6,0xB1,0xDD,0x55,0xBB,0xFC,0x3F,0x08,0xF8,0xBB,
+	0x4D,0x02,0x0A,0x78,0x33,0xCC,0x03,0x1E,0x40,0x40,0x53,0x1A,0x22,0xC8,0x92,0x35,
+	0x87,0x92,0xD4,0x74,0x95,0x99,0x55,0x7B,0x52,0xB7,0x5D,0xEE,0x72,0x57,0xAD,0xF7,
+	0x6E,0xA2,0x84,0xFB,0xD6,0xD1,0x6D,0x4E,0x6E,0x84,0xA3,0x37,0x84,0x8B,0x50,0xEE,
+	0x22,0xB2,0x01,0x80,0x01,0x75,0x14,0x7B,0x80,0x01,0x39,0x98,0xFC,0x3F,0x08,0xF8,
+	0x2E,0x8C,0x03,0x0C,0xF8,0xB5,0xCD,0x02,0x16,0x50,0xC0,0x6F,0xA5,0x1E,0x50,0xC0,
+	0x37,0xEE,0x23,0x69,0xCA,0x35,0x55,0x57,0xAF,0xA2,0xD8,0x8E,0x16,0x5D,0x7D,0xEB,
+	0xDB,0xDC,0x76,0xF5,0xC9,0x4C,0x95,0x71,0xEF,0x3D,0xCD,0xBD,0x9C,0xC1,0x75,0x95,
+	0x72,0x97,0xFC,0x84,0x3F,0xAA,0xAE,0x31,0xF1,0x2D,0x5E,0x5B,0x72,0x9C,0x62,0xB5,
+	0xF9,0x92,0x8E,0x18,0x93,0xC4,0x04,0x18,0xB2,0x45,0x02,0x1C,0xA0,0x00,0x05,0x28,
+	0x40,0x81,0xFF,0x07,0x04,0xF8,0xBD,0x5C,0x02,0x1A,0xD0,0x80,0x04,0x30,0x40,0x00,
+	0x6E,0x55,0x59,0xCB,0x75,0x7A,0x7A,0xA5,0x59,0xC5,0xC8,0x41,0x64,0xBA,0x66,0xE5,
+	0x33,0x95,0x82,0xEB,0xD6,0x9B,0xEE,0x6C,0xE5,0x33,0x8D,0x82,0xEB,0xD6,0x5D,0xAD,
+	0x7E,0xC5,0x22,0x48,0xDF,0xB2,0xC7,0xBD,0xCC,0x6D,0x1E,0xF5,0x60,0xA7,0x65,0x1E,
+	0x95,0x91,0x88,0x9F,0xF4,0x2A,0xD7,0xD0,0x4D,0x64,0xBE,0xE5,0xFF,0x01,0x04,0xF8,
+	0xC5,0x9C,0x03,0x1A,0xD0,0x80,0x04,0x38,0x00,0x06,0x58,0x22,0x7D,0x65,0x9D,0x87,
+	0x8B,0x5B,0xD7,0x53,0x67,0x37,0x96,0x21,0x79,0x6F,0x7D,0xEB,0xD5,0x64,0xB7,0x92,
+	0x43,0x9B,0xC7,0x50,0xDD,0x92,0x1D,0xF7,0x9E,0x53,0xDF,0xDD,0x59,0xCB,0x21,0xAD,
+	0xF6,0x46,0xA0,0x08,0xE5,0x2E,0x22,0x1B,0x40,0x01,0xDD,0xB2,0x2A,0xE0,0xB7,0x0C,
+	0x03,0x4C,0x9D,0x4A,0x80,0xEA,0x54,0xFE,0x1F,0x0C,0xF8,0xA5,0x4C,0x02,0x1A,0xD0,
+	0x80,0x04,0x38,0x00,0x1A,0x58,0x59,0x95,0x13,0x51,0xDC,0xE7,0x16,0xB7,0x3A,0x75,
+	0x95,0xE3,0x1D,0xB4,0xF9,0x8E,0x77,0xDD,0x7B,0x7F,0xD8,0x2E,0x42,0xB9,0x8B,0xC8,
+	0x06,0x60,0x80,0x0B,0x16,0x18,0xF8,0x7F,0x08,0xF8,0x3B,0x93,0x03,0x1A,0xB0,0x80,
+	0x01,0xAE,0xCF,0x54,0x40,0x33,0x99,0x2E,0xF6,0xB2,0x4B,0x9D,0x52,0xA7,0x36,0xF0,
+	0x2E,0x2F,0x70,0xDB,0xCB,0x93,0x75,0xEE,0xA6,0x4B,0x79,0x4F,0x36,0x4C,0x89,0x34,
+	0x77,0xB9,0xF9,0xAA,0x5B,0x08,0x76,0xF5,0xCD,0x73,0xE4,0x13,0x99,0x45,0x28,0x77,
+	0x11,0xD9,0x40,0x80,0x55,0xCB,0x25,0xE0,0x80,0x59,0x2F,0x23,0xE0,0x01,0x0B,0x08,
+	0xA0,0x46,0xB1,0xFF,0x07,0x0E,0xF8,0x2E,0x2C,0x00,0xCB,0x8F,0x8F,0xA8,0x59,0x15,
+	0xF7,0x58,0x79,0xD2,0x9A,0x5D,0x22,0xB5,0xF5,0x4D,0x47,0x96,0xAB,0x5A,0x87,0x69,
+	0x0E,0x85,0xF7,0x46,0x1D,0xA1,0x0C,0x10,0xE0,0x32,0xBB,0x04,0x56,0x5E,0x62,0x91,
+	0xA6,0x79,0xEF,0x7D,0xEC,0xC1,0x00,0x63,0x6C,0x46,0xC0,0x03,0x16,0x18,0x7D,0x8F,
+	0x29,0x68,0x96,0xB5,0x4D,0x25,0x27,0x71,0x85,0xF7,0xBE,0xF6,0xBD,0x9F,0xF5,0x09,
+	0x77,0x59,0xC2,0xDE,0x9A,0x27,0xBE,0xFE,0xFD,0x7F,0x0E,0x98,0x6A,0xC9,0x00,0x2B,
+	0x37,0xAF,0xA4,0x45,0x91,0xB0,0x5A,0x72,0xEA,0x9A,0x9D,0x23,0xE3,0xCD,0x6D,0x56,
+	0x57,0x93,0x5A,0x78,0x2D,0xD9,0xE3,0x9E,0xEB,0x4E,0x77,0x02,0x6C,0x95,0x4A,0x80,
+	0xDF,0xD2,0x39,0xA0,0x01,0x0D,0x48,0x80,0x01,0x4F,0x2B,0x53,0x00,0x14,0x70,0x45,
+	0x9A,0x06,0x10,0x50,0x73,0xC3,0xFF,0x03,0x6E,0xAD,0xCC,0x34,0x9C,0x97,0xE8,0x23,
+	0xED,0x5D,0xA4,0xBB,0xF1,0x96,0xD9,0xEE,0xFA,0xD4,0x45,0x75,0xA6,0xC9,0xE6,0x5B,
+	0xDF,0xE6,0x0E,0x67,0xAE,0x7C,0xD3,0x43,0xFB,0xEC,0x7D,0x9E,0xFD,0xFE,0x7F,0x0E,
+	0xB8,0x36,0xC3,0x01,0xCD,0x98,0xB4,0x38,0x87,0x8C,0x0A,0x59,0x72,0x8B,0x5B,0x9D,
+	0xAA,0x15,0x35,0x0B,0x9F,0x7D,0x8B,0x5D,0xB4,0xAA,0x78,0x96,0xB4,0xB0,0x5B,0xFB,
+	0x32,0xE7,0xE8,0x9C,0x85,0x6D,0xDA,0x96,0xC3,0x10,0x9F,0x78,0x49,0x67,0x35,0xA7,
+	0xF0,0xA6,0x2F,0xDD,0x39,0x2D,0xF2,0x89,0x9F,0xFC,0xC4,0xD7,0xFD,0xC5,0x1F,0xC3,
+	0xBA,0x3F,0xF3,0x97,0x6D,0x54,0xC9,0xFD,0xFE,0x1F,0x0E,0xD8,0x5A,0x2D,0x00,0x37,
+	0xA6,0x39,0xA0,0x9B,0xB0,0x95,0x17,0x9B,0x1E,0x21,0x2D,0x4F,0x51,0xF4,0x86,0x25,
+	0x6F,0xB9,0xD5,0xA9,0xBB,0x9E,0xE0,0xD6,0x36,0xB7,0xBE,0xED,0x1E,0xD6,0xDC,0x5D,
+	0x29,0xB7,0xAF,0xDE,0x6B,0xDD,0xCB,0xDE,0xB4,0xB1,0xAB,0xD6,0xC9,0x67,0x3C,0xDD,
+	0x35,0x85,0x73,0x98,0xD8,0xFD,0x7F,0x09,0x38,0xD6,0xCC,0x01,0xCB,0x76,0xB5,0x38,
+	0x73,0x0B,0x4F,0xCA,0x3A,0x92,0x42,0xAD,0x25,0x29,0xFD,0x4E,0x47,0x9A,0x78,0x64,
+	0x34,0xA4,0xEB,0xC5,0xA8,0x0A,0xB1,0xCA,0x02,0x77,0xB5,0xAF,0x73,0x5A,0x83,0x88,
+	0x69,0xA3,0x6C,0x69,0xCD,0xCC,0x67,0x94,0xDC,0xE7,0x3D,0x5E,0xF1,0x09,0x7F,0x11,
+	0xDA,0xC3,0xE2,0xF5,0xFF,0x01,0x01,0x18,0xA9,0xCC,0x02,0x06,0x28,0x4E,0xA9,0x14,
+	0x39,0x25,0x69,0x4B,0xBA,0x5D,0xAE,0xAA,0x84,0x15,0x5A,0xF5,0xBE,0xAB,0x59,0xCF,
+	0x61,0xCE,0x7D,0x6B,0x5B,0x09,0x49,0x76,0xEE,0xB5,0x1E,0xE5,0x69,0x2E,0x44,0xD3,
+	0x9A,0xE6,0x27,0x7C,0x4D,0x09,0xA5,0x47,0xDC,0xF8,0xB9,0xAF,0x7B,0x62,0xB7,0x70,
+	0xE6,0xBE,0x1A,0x54,0x4C,0xB8,0xDD,0xFF,0x03,0x63,0x2A,0xAC,0x2B,0x8D,0xF7,0xEC,
+	0xF1,0xB6,0xB7,0xDD,0xDD,0xEC,0xC7,0x5A,0x58,0x55,0x39,0xF5,0x9E,0x6B,0x3D,0xD3,
+	0x59,0xB8,0x67,0x39,0xEE,0x8A,0x77,0x7A,0xAB,0x54,0x6F,0xC7,0x4C,0xF6,0x91,0xCF,
+	0xFF,0x03,0xA7,0x6B,0xA4,0x3B,0x4A,0xB3,0x9C,0xAE,0xF1,0xF6,0x48,0xE9,0x7C,0xDB,
+	0x55,0x56,0x13,0x56,0x62,0x8D,0x5B,0x56,0x15,0xFA,0x68,0x68,0xA9,0x79,0x28,0xA2,
+	0xE0,0x31,0x4D,0x8D,0xA6,0x36,0x52,0x27,0x39,0x13,0x85,0x7E,0x7A,0x35,0x56,0x4D,
+	0xB2,0xD6,0xE6,0x4D,0x55,0xAD,0xD5,0x58,0x6B,0x0E,0xB2,0x92,0x3C,0x73,0x2F,0x47,
+	0xE9,0x4A,0x99,0xBC,0x25,0x9F,0xE1,0xCA,0x43,0xB0,0x53,0x7A,0x85,0xBB,0x1C,0xE1,
+	0x56,0xCB,0xEC,0xEF,0xFF,0x07,0x61,0xB9,0x96,0x84,0xB9,0x56,0xE5,0xB9,0xCE,0x63,
+	0xDE,0xCE,0x0D,0x30,0x36,0x9F,0x6E,0x86,0x36,0x60,0xE9,0x7B,0xCA,0x5E,0x93,0x45,
+	0xA4,0xEB,0xC9,0xBB,0x77,0x72,0xE7,0x2D,0x2B,0xAB,0xD6,0x24,0x94,0x17,0x8F,0xA2,
+	0x79,0x4C,0xD5,0x48,0x5D,0xAA,0xEE,0x21,0x23,0x42,0xF1,0x1A,0x66,0x54,0x15,0x97,
+	0xD6,0x6B,0x19,0xD1,0xC5,0xC5,0x77,0xEF,0xB3,0x9F,0x7E,0x47,0xA0,0x08,0xE5,0x2E,
+	0x22,0x1B,0x00,0x01,0xCB,0xBB,0x3B,0xE0,0xD7,0x0A,0x05,0x9C,0xD0,0x4D,0x80,0xE6,
+	0x92,0xFE,0x1F,0x2D,0xCD,0x72,0xA2,0x55,0x77,0xDD,0xF6,0x36,0xB7,0xB9,0xD5,0xEA,
+	0xB3,0xC9,0x6C,0xF1,0xD5,0xE9,0x4A,0xB6,0xBD,0x39,0x7F,0x21,0x50,0x84,0x72,0x17,
+	0x91,0x0D,0x00,0x20,0x80,0x48,0xD3,0x08,0x90,0x54,0x28,0x06,0xFE,0x1F,0x61,0x1F,
+	0x5A,0x58,0x4D,0x9C,0x08,0x60,0x58,0x95,0x32,0x0D,0x2D,0xAC,0x26,0x4E,0x46,0xD7,
+	0x5C,0x58,0x18,0xAF,0x3E,0x6D,0x73,0x6A,0x65,0xF6,0xE4,0x34,0xCD,0xA6,0x97,0xD9,
+	0x93,0x5B,0xDF,0xFA,0x36,0xAB,0xCF,0x6A,0xA3,0x55,0x36,0xEF,0x7E,0xCF,0x63,0x2E,
+	0xF4,0xAA,0x9C,0xFA,0x8C,0xAD,0xC1,0x9E,0x76,0xF2,0xD6,0xF7,0xBA,0xD7,0xA3,0x1C,
+	0x85,0x78,0x76,0xA1,0xFA,0x78,0xC4,0x3B,0xDC,0x91,0x55,0x94,0x70,0x6A,0x7F,0xEB,
+	0x87,0x00,0x55,0xA8,0x70,0x80,0x02,0x14,0xC0,0xC0,0xFF,0x03,0x24,0x4B,0x38,0x2C,
+	0x43,0x13,0xBB,0xEC,0xB8,0xB6,0xD0,0x76,0xBD,0xDA,0x6D,0x4B,0xC5,0xD8,0xF7,0x69,
+	0x9B,0x55,0x2B,0xB3,0x27,0xA7,0x69,0x36,0xAD,0xCC,0x9E,0xDC,0xFA,0xD6,0xB7,0x59,
+	0x7D,0x56,0x1B,0xAD,0xB2,0x79,0xF7,0x73,0x68,0x73,0x0C,0x5D,0xE1,0xD2,0xA6,0xEE,
+	0xF9,0x0C,0x57,0xB0,0x13,0xC1,0x9E,0x36,0x5E,0xEE,0xCE,0x22,0xAC,0xD5,0xE2,0xF8,
+	0xDB,0xDC,0x4D,0x09,0xA5,0x47,0xDC,0x78,0x9B,0xBB,0x7B,0x62,0xB7,0x70,0xF6,0xFF,
+	0xA0,0xDA,0xA2,0xB2,0x3A,0x44,0x55,0x9C,0xFA,0xB0,0xBA,0x46,0x72,0xDA,0xD1,0xDB,
+	0xAE,0x47,0x59,0x61,0xED,0x28,0x79,0xED,0x45,0xAF,0x5A,0xDF,0x60,0xF4,0x39,0x69,
+	0xAB,0x63,0xD9,0x3B,0xD2,0xBC,0x24,0xA5,0xF5,0xB6,0x0F,0x80,0x01,0x3E,0x63,0x65,
+	0xC0,0x5F,0x63,0x12,0x90,0x80,0x06,0x24,0x20,0x01,0x0E,0xFC,0x3F,0xAA,0x15,0x7A,
+	0x23,0x5C,0x12,0xE9,0xD1,0x0D,0x5A,0x76,0x75,0xB2,0xAA,0xD0,0x3B,0xD9,0xED,0x81,
+	0x99,0x4A,0x1B,0xD5,0x8C,0x25,0xFA,0xDD,0xF5,0xA9,0xA3,0x9F,0x2C,0xE3,0x2E,0xB7,
+	0xBE,0xCD,0xEE,0xD6,0x9C,0xDC,0x44,0xAB,0xAD,0x6E,0x67,0x0E,0xE9,0xCD,0x7D,0xBB,
+	0x1E,0x0C,0x1C,0x24,0xCA,0x5C,0x59,0x03,0x00,0x01,0xB6,0x2A,0x15,0xC0,0x2F,0x19,
+	0x1A,0xB0,0x80,0x05,0x2C,0x60,0x80,0xAF,0xA2,0x24,0xF0,0xFF,0x62,0x13,0x7E,0x23,
+	0x4C,0x22,0xEB,0x4D,0xAD,0x46,0x7F,0x5A,0xB0,0x95,0xB4,0x38,0xF3,0xA1,0x4E,0x6D,
+	0xD6,0x94,0xCC,0x9A,0x3B,0x6D,0x39,0x7D,0xF3,0xC1,0x99,0xF2,0xE6,0xB4,0x23,0x0E,
+	0x51,0xF8,0x9A,0xDB,0x8E,0x6E,0xE4,0x04,0xC9,0x7C,0xDC,0x17,0x75,0x8C,0x26,0xA8,
+	0x56,0x8B,0x11,0x28,0x42,0xB9,0x8B,0xC8,0x06,0x00,0x00,0x01,0xBC,0xC0,0x66,0x80,
+	0x1F,0x73,0x04,0xB0,0xDD,0x34,0x02,0x46,0xE9,0xF8,0x7F,0x66,0xB7,0x7C,0x53,0x53,
+	0x6B,0xFA,0xC5,0xCF,0x65,0x4C,0x64,0x56,0x5C,0x1C,0xAF,0xA6,0xE0,0xEA,0x68,0x52,
+	0x77,0x8A,0x2A,0xD2,0xB3,0x29,0xDF,0xC9,0x9B,0x4A,0xCD,0xE2,0xCD,0x37,0x5F,0x45,
+	0x8B,0x21,0xAD,0xF1,0x78,0xB7,0xBB,0x1F,0x4B,0x89,0x92,0xC6,0x17,0x5B,0x01,0x8F,
+	0x9B,0x1A,0xE0,0x97,0x48,0x0F,0x78,0xC0,0x03,0x1A,0x10,0xC0,0x9F,0xED,0x1C,0xC0,
+	0x00,0x28,0xE0,0x15,0x56,0x05,0x1C,0x9F,0x43,0x80,0x61,0x26,0xFF,0x1F,0x69,0xBD,
+	0x56,0x15,0xAC,0x67,0xE5,0xA5,0xCC,0x2B,0x8E,0x82,0xD8,0xD6,0x39,0x9E,0xAE,0x85,
+	0x50,0x37,0x5F,0x7D,0xEB,0x53,0x55,0x1B,0xDE,0xA6,0x6B,0x56,0x5D,0x74,0x47,0x2B,
+	0x77,0x6E,0x75,0x87,0x59,0x95,0xA4,0x76,0x76,0x6B,0xCE,0xA2,0xB3,0x4C,0xF2,0xCF,
+	0xBD,0xED,0xC9,0x54,0xB6,0x52,0x9F,0x7E,0xA5,0xDB,0xC7,0xCA,0x46,0x5D,0x13,0xEF,
+	0xF8,0x84,0x37,0xA8,0xA9,0x0C,0xF2,0xE3,0xBE,0x24,0xC6,0x2B,0x48,0xDF,0xFF,0x03,
+	0x08,0x14,0xC1,0xDD,0x45,0x64,0x03,0x00,0xFC,0x4A,0x56,0x26,0x3A,0x06,0x0A,0x08,
+	0x14,0xC1,0xDD,0x45,0x64,0x03,0x00,0x00,0x00,0xC0,0xFF,0x4A,0x46,0x51,0x39,0x79,
+	0x15,0x0A,0x00,0x00,
+};
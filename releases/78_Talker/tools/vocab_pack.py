@@ -0,0 +1,253 @@
+#!/usr/bin/env python3
+"""
+vocab_pack.py — pack Talkie-style LPC vocabularies into Talker vocabulary banks
+
+A bank is one self-contained, read-only image: the words' LPC bitstreams (stored as the
+speech ROMs had them — that bitstream is already the compressed form, ~1 kbit/s) plus
+a word table in ordinal order, for picking words by number from CV or MIDI, and a hash
+index sorted by hash with a bucket table on the top hash bits, for finding a word by
+name in O(1). Words with identical data are stored once. src/VocabBank.h reads it.
+
+--------------------------------------------------------------------------------
+USAGE
+--------------------------------------------------------------------------------
+Run from the release directory (stdlib only, no pip installs). Each BANK=SOURCE adds the
+`static const uint8_t NAME[] = {...};` arrays of a C header to bank BANK, optionally
+only those whose name starts with :PREFIX. A word's name is the array name without its
+spN_ / sp prefix ("sp2_ZERO" -> "ZERO").
+
+The firmware's built-in bank (the VM61002 ROM, which has the number words the card
+babbles with):
+
+    python3 tools/vocab_pack.py --header src/vocab_builtin.h \\
+        VM61002=vocab/Vocab_US_Large.h:sp2_ VM61002=vocab/Vocab_Special.h
+
+Extra banks, to upload as a UF2 after the firmware (they go at the end of flash, like
+the sample_upload example's WAV files; Pulse in 2 steps through them on the card):
+
+    python3 tools/vocab_pack.py --uf2 talker_vocab.uf2 \\
+        VM61003=vocab/Vocab_US_Large.h:sp3_ VM61004=vocab/Vocab_US_Large.h:sp4_ \\
+        VM61005=vocab/Vocab_US_Large.h:sp5_
+
+--flash-mb sets the card's flash size (16, or 2 for early units); -o DIR also writes
+each bank as DIR/NAME.bin.
+
+--------------------------------------------------------------------------------
+BANK FORMAT (little-endian; every offset is from the start of the bank)
+--------------------------------------------------------------------------------
+    header   44 bytes
+      u32 magic 'TKVB'   u16 version (1)    u16 word count
+      u32 bank size      u16 bucket bits    u16 longest word, bytes
+      u32 words offset   u32 index offset   u32 buckets offset
+      char name[16]      (NUL padded)
+    words    count x {u32 data offset, u32 name offset, u16 data bytes, u16 0}
+    index    count x {u32 hash, u16 word, u16 0}, sorted by hash
+    buckets  (2^bits + 1) x u16: index entries for hash >> (32 - bits) == b are
+             [buckets[b], buckets[b + 1])
+    names    NUL-terminated, upper case
+    data     LPC bitstreams, then one 0 byte (the bit reader may look one byte ahead)
+    padding  to a multiple of 4 bytes
+
+Hash: 32-bit FNV-1a over the upper-cased name.
+
+The flash image for --uf2 is the banks back to back, starting on a 4 KB boundary, and
+in the last 256 bytes of flash {u32 address of the first bank, u32 number of banks}.
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+MAGIC = 0x42564B54          # "TKVB"
+VERSION = 1
+HEADER_SIZE = 44
+MAX_WORD_BYTES = 512        # LpcSynth::MAX_WORD_BYTES
+
+FLASH_BASE = 0x10000000
+UF2_MAGIC_START0 = 0x0A324655
+UF2_MAGIC_START1 = 0x9E5D5157
+UF2_MAGIC_END = 0x0AB16F30
+RP2040_FAMILY_ID = 0xE48BFF56
+FIRMWARE_RESERVE = 1024 * 1024  # refuse to place banks in the first MB (firmware)
+
+
+def fnv1a(name):
+    h = 0x811C9DC5
+    for b in name.upper().encode('ascii'):
+        h = ((h ^ b) * 0x01000193) & 0xFFFFFFFF
+    return h
+
+
+ARRAY_RE = re.compile(r'const\s+uint8_t\s+(\w+)\s*\[\s*\]\s*=\s*\{([^}]*)\}')
+
+
+def read_words(path, prefix):
+    text = re.sub(r'//[^\n]*', '', open(path).read())
+    words = []
+    for m in ARRAY_RE.finditer(text):
+        sym = m.group(1)
+        if prefix and not sym.startswith(prefix):
+            continue
+        data = bytes(int(x, 0) for x in m.group(2).split(',') if x.strip())
+        name = re.sub(r'^sp\d*_?', '', sym).upper()
+        words.append((name, data))
+    if not words:
+        sys.exit('%s: no words%s' % (path, ' starting ' + prefix if prefix else ''))
+    return words
+
+
+def build_bank(name, words):
+    seen = {}
+    for wname, data in words:
+        if wname in seen:
+            sys.exit('bank %s: word %s appears twice' % (name, wname))
+        if len(data) > MAX_WORD_BYTES:
+            sys.exit('bank %s: word %s is %d bytes, the card takes up to %d'
+                     % (name, wname, len(data), MAX_WORD_BYTES))
+        seen[wname] = data
+    count = len(words)
+    if count > 0xFFFF:
+        sys.exit('bank %s: too many words' % name)
+
+    bits = max(1, (count - 1).bit_length())          # about one index entry per bucket
+    words_off = HEADER_SIZE
+    index_off = words_off + 12 * count
+    buckets_off = index_off + 8 * count
+    names_off = buckets_off + 2 * ((1 << bits) + 1)
+
+    names = bytearray()
+    name_at = []
+    for wname, _ in words:
+        name_at.append(names_off + len(names))
+        names += wname.encode('ascii') + b'\0'
+    data_off = names_off + len(names)
+
+    blob = bytearray()
+    data_at = {}
+    for _, data in words:
+        if data not in data_at:
+            data_at[data] = data_off + len(blob)
+            blob += data
+    blob += b'\0'
+    size = data_off + len(blob)
+    size += -size % 4
+
+    hashes = sorted((fnv1a(w), i) for i, (w, _) in enumerate(words))
+    buckets = []
+    j = 0
+    for b in range((1 << bits) + 1):
+        while j < count and (hashes[j][0] >> (32 - bits)) < b:
+            j += 1
+        buckets.append(j)
+
+    out = bytearray()
+    out += struct.pack('<IHHIHHIII16s', MAGIC, VERSION, count, size, bits,
+                       max(len(d) for _, d in words), words_off, index_off, buckets_off,
+                       name.encode('ascii')[:15])
+    for i, (_, data) in enumerate(words):
+        out += struct.pack('<IIHH', data_at[data], name_at[i], len(data), 0)
+    for h, i in hashes:
+        out += struct.pack('<IHH', h, i, 0)
+    for b in buckets:
+        out += struct.pack('<H', b)
+    out += names
+    out += blob
+    out += b'\0' * (size - len(out))
+    assert len(out) == size
+    stored = len(blob) - 1
+    raw = sum(len(d) for _, d in words)
+    return bytes(out), stored, raw
+
+
+def write_header(path, cmd, banks):
+    if len(banks) != 1:
+        sys.exit('--header takes exactly one bank')
+    name, image = banks[0]
+    with open(path, 'w') as f:
+        f.write('// Generated by tools/vocab_pack.py - do not edit. Regenerate with:\n')
+        f.write('// %s\n' % cmd)
+        f.write('//\n// Bank %s, %d bytes (format: tools/vocab_pack.py, read by VocabBank.h)\n\n'
+                % (name, len(image)))
+        f.write('#pragma once\n\n#include <cstdint>\n\n')
+        f.write('alignas(4) static const uint8_t VOCAB_BUILTIN[%d] = {\n' % len(image))
+        for i in range(0, len(image), 16):
+            f.write('\t' + ','.join('0x%02X' % b for b in image[i:i + 16]) + ',\n')
+        f.write('};\n')
+
+
+def uf2_blocks(address, image):
+    blocks = []
+    total = len(image) // 256
+    for i in range(total):
+        payload = image[i * 256:(i + 1) * 256]
+        blocks.append(struct.pack('<IIIIIIII', UF2_MAGIC_START0, UF2_MAGIC_START1, 0x2000,
+                                  address + i * 256, 256, i, total, RP2040_FAMILY_ID)
+                      + payload + b'\0' * (476 - 256) + struct.pack('<I', UF2_MAGIC_END))
+    return b''.join(blocks)
+
+
+def write_uf2(path, banks, flash_mb):
+    flash_size = flash_mb * 1024 * 1024
+    body = b''.join(image for _, image in banks)
+    address = FLASH_BASE + flash_size - len(body) - 256
+    address -= address % 4096
+    if address < FLASH_BASE + FIRMWARE_RESERVE:
+        sys.exit('%d bytes of banks do not fit in %d MB of flash' % (len(body), flash_mb))
+    image = bytearray(FLASH_BASE + flash_size - address)
+    image[:len(body)] = body
+    image[-256:-248] = struct.pack('<II', address, len(banks))
+    with open(path, 'wb') as f:
+        f.write(uf2_blocks(address, bytes(image)))
+    return address
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Pack LPC vocabularies into Talker banks.')
+    ap.add_argument('banks', nargs='+', metavar='BANK=SOURCE[:PREFIX]')
+    ap.add_argument('--header', help='write the (single) bank as a C header')
+    ap.add_argument('--uf2', help='write all banks as a UF2 for the end of flash')
+    ap.add_argument('--flash-mb', type=int, default=16, help='card flash size (default 16)')
+    ap.add_argument('-o', '--out-dir', help='also write each bank as OUT_DIR/BANK.bin')
+    args = ap.parse_args()
+    if not (args.header or args.uf2 or args.out_dir):
+        ap.error('nothing to write: give --header, --uf2 and/or -o')
+
+    order = []
+    sources = {}
+    for spec in args.banks:
+        if '=' not in spec:
+            ap.error('expected BANK=SOURCE[:PREFIX], got ' + spec)
+        bank, src = spec.split('=', 1)
+        path, _, prefix = src.partition(':')
+        if not bank or len(bank) > 15:
+            ap.error('bank names are 1..15 characters: ' + bank)
+        if bank not in sources:
+            order.append(bank)
+            sources[bank] = []
+        sources[bank] += read_words(path, prefix)
+
+    banks = []
+    for bank in order:
+        image, stored, raw = build_bank(bank, sources[bank])
+        banks.append((bank, image))
+        shared = ' (%d shared by duplicates)' % (raw - stored) if raw != stored else ''
+        print('%-15s %4d words, %6d bytes LPC%s, bank %6d bytes'
+              % (bank, len(sources[bank]), stored, shared, len(image)), file=sys.stderr)
+
+    if args.out_dir:
+        os.makedirs(args.out_dir, exist_ok=True)
+        for bank, image in banks:
+            with open(os.path.join(args.out_dir, bank + '.bin'), 'wb') as f:
+                f.write(image)
+    if args.header:
+        cmd = 'python3 tools/vocab_pack.py --header %s %s' % (args.header, ' '.join(args.banks))
+        write_header(args.header, cmd, banks)
+    if args.uf2:
+        address = write_uf2(args.uf2, banks, args.flash_mb)
+        print('%s: %d banks at 0x%08X' % (args.uf2, len(banks), address), file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
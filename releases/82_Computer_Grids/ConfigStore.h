@@ -12,7 +12,7 @@ class ConfigStore {
 
   enum CV1Mode : uint8_t { CV1ToX = 0, CV1ToY = 1, CV1ToBlend = 2 };
   enum CV2Mode : uint8_t { CV2ToFill = 0 };
-  enum AuxMode : uint8_t { AuxAccent = 0, AuxClock = 1, AuxLane3Mirror = 2 };
+  enum AuxMode : uint8_t { AuxAccent = 0, AuxClock = 1, AuxLane3Mirror = 2, AuxLane6 = 3 };
 
   struct Data {
     uint32_t magic = kMagic;
@@ -36,8 +36,14 @@ class ConfigStore {
 
     uint8_t aux_mode = AuxAccent;
     uint8_t pulse_ms = 10;
+
+    /** Second pattern-map position (lanes 4–6), 0–255 like the X/Y knobs' top 8 bits. */
+    uint8_t map2_x = 192;
+    uint8_t map2_y = 64;
+    /** USB MIDI channel (1–16) for lane note-ons; 0 = off. */
+    uint8_t midi_channel = 0;
     /** Wire size must match `sizeof(Data)` (28); pads SysEx / flash blob without trailing compiler padding. */
-    uint8_t reserved[8] = {};
+    uint8_t reserved[5] = {};
   };
 
   void Load(bool force_reset = false);
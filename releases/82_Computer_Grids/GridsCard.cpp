@@ -4,6 +4,7 @@
 
 #include <cstring>
 
+#include "hardware/sync.h"
 #include "pico/time.h"
 
 #ifdef __GNUC__
@@ -25,6 +26,13 @@ constexpr uint8_t kCmdSetConfig = 0x03;
 constexpr uint8_t kCmdSaveConfig = 0x04;
 constexpr uint32_t kLongPressSamples = 24000;
 constexpr uint32_t kPickupDeadband = 96;
+/** GM drum notes for lanes 1–6: kick, snare, closed hat; low tom, clap, open hat. */
+constexpr uint8_t kLaneNotes[GridsEngine::kNumLanes] = {36, 38, 42, 45, 39, 46};
+
+/** Map 2's 8-bit config position as a 12-bit map input, mid-cell. */
+uint16_t Map2Raw(uint8_t v) {
+  return static_cast<uint16_t>((v << 4) | 8);
+}
 
 size_t Encode7Bit(const uint8_t* raw, size_t raw_len, uint8_t* out, size_t out_max) {
   size_t out_idx = 0;
@@ -95,6 +103,8 @@ GridsCard::GridsCard() {
   cfg_ = store_.Get();
   SanitizeConfig(cfg_);
   engine_.Seed(static_cast<uint32_t>(UniqueCardID()));
+  engine_.SetMap(1, Map2Raw(cfg_.map2_x), Map2Raw(cfg_.map2_y));
+  engine_.Flush();
   RecomputeNominalTickSamples();
 
   normal_params_.fill = 2048;
@@ -123,6 +133,7 @@ void GridsCard::ProcessSample() {
   sample_count_++;
   TickUiAndSwitch();
   TickPulseTimers();
+  engine_.Service();
 
   if (PulseIn2RisingEdge()) {
     engine_.Reset();
@@ -157,8 +168,13 @@ void GridsCard::ProcessSample() {
     if (alt_layer_ && !z_density_tick) {
       f1 = f2 = f3 = static_cast<uint16_t>(normal_params_.fill);
     }
-    const auto outputs = engine_.Tick(map_x, map_y, f1, f2, f3, cfg_.chaos);
+    // Lanes 4–6 play map 2 (from config) at the same densities as lanes 1–3.
+    const uint16_t fills[GridsEngine::kNumLanes] = {f1, f2, f3, f1, f2, f3};
+    engine_.SetMap(0, map_x, map_y);
+    engine_.SetMap(1, Map2Raw(cfg_.map2_x), Map2Raw(cfg_.map2_y));
+    const auto outputs = engine_.Tick(fills, cfg_.chaos);
     TriggerOutputs(outputs);
+    QueueLaneNotes(outputs);
     beat_led_countdown_ = CurrentPulseSamples();
     if (!ext_clock) {
       next_tick_at_ =
@@ -188,6 +204,7 @@ void GridsCard::ProcessSample() {
 void GridsCard::Housekeeping() {
   HandleTapTempo();
   HandleIncomingSysEx();
+  SendLaneNotes();
 
   bool should_save = false;
   ConfigStore::Data snapshot{};
@@ -446,13 +463,16 @@ uint16_t GridsCard::CurrentPulseSamples() const {
 
 void GridsCard::TriggerOutputs(const GridsEngine::Outputs& out) {
   const uint16_t len = CurrentPulseSamples();
-  if (out.lane1) pulse_1_countdown_ = len;
-  if (out.lane2) pulse_2_countdown_ = len;
-  if (out.lane3) cv1_pulse_countdown_ = len;
+  if (out.lane[0]) pulse_1_countdown_ = len;
+  if (out.lane[1]) pulse_2_countdown_ = len;
+  if (out.lane[2]) cv1_pulse_countdown_ = len;
+  if (out.lane[3]) audio1_pulse_countdown_ = len;
+  if (out.lane[4]) audio2_pulse_countdown_ = len;
 
-  if (cfg_.aux_mode == ConfigStore::AuxAccent && out.accent) cv2_pulse_countdown_ = len;
+  if (cfg_.aux_mode == ConfigStore::AuxAccent && out.accent[0]) cv2_pulse_countdown_ = len;
   if (cfg_.aux_mode == ConfigStore::AuxClock) cv2_pulse_countdown_ = len;
-  if (cfg_.aux_mode == ConfigStore::AuxLane3Mirror && out.lane3) cv2_pulse_countdown_ = len;
+  if (cfg_.aux_mode == ConfigStore::AuxLane3Mirror && out.lane[2]) cv2_pulse_countdown_ = len;
+  if (cfg_.aux_mode == ConfigStore::AuxLane6 && out.lane[5]) cv2_pulse_countdown_ = len;
 }
 
 void GridsCard::TickPulseTimers() {
@@ -462,11 +482,44 @@ void GridsCard::TickPulseTimers() {
   PulseOut2(p2);
   CVOut1(cv1_pulse_countdown_ > 0 ? 2047 : -2048);
   CVOut2(cv2_pulse_countdown_ > 0 ? 2047 : -2048);
+  AudioOut1(audio1_pulse_countdown_ > 0 ? 2047 : 0);
+  AudioOut2(audio2_pulse_countdown_ > 0 ? 2047 : 0);
 
   if (pulse_1_countdown_ > 0) pulse_1_countdown_--;
   if (pulse_2_countdown_ > 0) pulse_2_countdown_--;
   if (cv1_pulse_countdown_ > 0) cv1_pulse_countdown_--;
   if (cv2_pulse_countdown_ > 0) cv2_pulse_countdown_--;
+  if (audio1_pulse_countdown_ > 0) audio1_pulse_countdown_--;
+  if (audio2_pulse_countdown_ > 0) audio2_pulse_countdown_--;
+}
+
+void GridsCard::QueueLaneNotes(const GridsEngine::Outputs& out) {
+  if (cfg_.midi_channel == 0) return;
+  for (uint8_t lane = 0; lane < GridsEngine::kNumLanes; ++lane) {
+    if (!out.lane[lane]) continue;
+    const uint8_t head = note_head_;
+    const uint8_t next = static_cast<uint8_t>((head + 1) & (kNoteQueueSize - 1));
+    if (next == note_tail_) return;  // core 0 is behind (USB not serviced): drop
+    const uint8_t velocity = static_cast<uint8_t>(out.level[lane] >> 1);
+    note_queue_[head] = {lane, velocity ? velocity : static_cast<uint8_t>(1)};
+    __dmb();
+    note_head_ = next;
+  }
+}
+
+void GridsCard::SendLaneNotes() {
+  const uint8_t channel = cfg_.midi_channel;
+  while (note_tail_ != note_head_) {
+    __dmb();
+    const LaneNote note = note_queue_[note_tail_];
+    note_tail_ = static_cast<uint8_t>((note_tail_ + 1) & (kNoteQueueSize - 1));
+    if (channel == 0 || !tud_midi_mounted()) continue;
+    // Triggers, not held notes: note-on then note-off together.
+    const uint8_t status = static_cast<uint8_t>(channel - 1);
+    const uint8_t msg[6] = {static_cast<uint8_t>(0x90 | status), kLaneNotes[note.lane], note.velocity,
+                            static_cast<uint8_t>(0x80 | status), kLaneNotes[note.lane], 0};
+    tud_midi_stream_write(0, msg, sizeof(msg));
+  }
 }
 
 void GridsCard::HandleIncomingSysEx() {
@@ -580,10 +633,11 @@ void GridsCard::SanitizeConfig(ConfigStore::Data& cfg) {
   cfg.lane1_fill_offset = Clamp<int8_t>(cfg.lane1_fill_offset, -127, 127);
   cfg.lane2_fill_offset = Clamp<int8_t>(cfg.lane2_fill_offset, -127, 127);
   cfg.lane3_fill_offset = Clamp<int8_t>(cfg.lane3_fill_offset, -127, 127);
-  cfg.aux_mode = (cfg.aux_mode <= static_cast<uint8_t>(ConfigStore::AuxLane3Mirror))
+  cfg.aux_mode = (cfg.aux_mode <= static_cast<uint8_t>(ConfigStore::AuxLane6))
                      ? cfg.aux_mode
                      : static_cast<uint8_t>(ConfigStore::AuxAccent);
   cfg.pulse_ms = Clamp<uint8_t>(cfg.pulse_ms, 1, 40);
+  cfg.midi_channel = Clamp<uint8_t>(cfg.midi_channel, 0, 16);
   for (size_t i = 0; i < sizeof(cfg.reserved); ++i) cfg.reserved[i] = 0;
 }
 
@@ -40,6 +40,8 @@ class GridsCard : public ComputerCard {
   void HandleTapTempo();
   void TriggerOutputs(const GridsEngine::Outputs& out);
   void TickPulseTimers();
+  void QueueLaneNotes(const GridsEngine::Outputs& out);
+  void SendLaneNotes();
   int32_t ApplyPickup(Knob knob, KnobLayerState& state);
   void RefreshRuntimeParams();
   void HandleIncomingSysEx();
@@ -103,8 +105,20 @@ class GridsCard : public ComputerCard {
   uint16_t pulse_2_countdown_ = 0;
   uint16_t cv1_pulse_countdown_ = 0;
   uint16_t cv2_pulse_countdown_ = 0;
+  uint16_t audio1_pulse_countdown_ = 0;  // lane 4
+  uint16_t audio2_pulse_countdown_ = 0;  // lane 5
   uint16_t beat_led_countdown_ = 0;
 
+  /** Lane hits for USB MIDI: written by the audio core, drained by Housekeeping() on core 0. */
+  struct LaneNote {
+    uint8_t lane;
+    uint8_t velocity;
+  };
+  static constexpr uint8_t kNoteQueueSize = 32;  // power of two; a tick queues at most 6
+  LaneNote note_queue_[kNoteQueueSize] = {};
+  volatile uint8_t note_head_ = 0;
+  volatile uint8_t note_tail_ = 0;
+
   uint64_t last_change_us_ = 0;
   bool pending_save_ = false;
 };
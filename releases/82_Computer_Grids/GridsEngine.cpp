@@ -1,5 +1,4 @@
 #include "GridsEngine.h"
-#include "GridsResources.h"
 
 namespace {
 static inline uint32_t XorShift32(uint32_t& state) {
@@ -21,17 +20,36 @@ constexpr uint8_t kDrumMap[5][5] = {
     {23, 16, 21, 1, 2},
     {24, 19, 17, 20, 22},
 };
+
+/** Raw (12-bit) units a knob must move into a neighbouring 8-bit cell before the map follows. */
+constexpr uint16_t kMapHysteresis = 4;
+
+/** The 8-bit cell for a 12-bit position, staying in `held` while within the hysteresis of it. */
+static inline uint8_t MapCell(uint16_t raw, uint8_t held) {
+  const uint16_t lo = static_cast<uint16_t>(held) << 4;
+  const uint16_t hi = lo + 15;
+  if (raw + kMapHysteresis >= lo && raw <= hi + kMapHysteresis) return held;
+  return static_cast<uint8_t>(raw >> 4);
+}
 }  // namespace
 
+GridsEngine::GridsEngine() {
+  // build_step_ starts at 0: both maps are queued at cell 0 and built here, so Tick()
+  // never reads an unbuilt cache.
+  Flush();
+}
+
 void GridsEngine::Seed(uint32_t seed) {
-  rng_ = seed ? seed : 1;
+  rng_[0] = seed ? seed : 1;
+  // A second, decorrelated stream for map 1.
+  rng_[1] = (seed ^ 0x9E3779B9u) ? (seed ^ 0x9E3779B9u) : 1;
 }
 
 void GridsEngine::Reset() {
   step_ = 0;
 }
 
-uint8_t GridsEngine::ReadDrumMap(uint8_t step, uint8_t instrument, uint8_t x, uint8_t y) const {
+uint8_t GridsEngine::ReadDrumMap(uint8_t step, uint8_t instrument, uint8_t x, uint8_t y) {
   const uint8_t i = x >> 6;
   const uint8_t j = y >> 6;
   const uint8_t xMix = static_cast<uint8_t>(x << 2);
@@ -49,42 +67,79 @@ uint8_t GridsEngine::ReadDrumMap(uint8_t step, uint8_t instrument, uint8_t x, ui
   return MixU8(MixU8(a, b, xMix), MixU8(c, d, xMix), yMix);
 }
 
-GridsEngine::Outputs GridsEngine::Tick(uint16_t map_x, uint16_t map_y, uint16_t fill_lane1, uint16_t fill_lane2,
-                                       uint16_t fill_lane3, uint8_t chaos) {
-  const uint8_t x8 = static_cast<uint8_t>(map_x >> 4);
-  const uint8_t y8 = static_cast<uint8_t>(map_y >> 4);
-  const uint16_t fills[3] = {fill_lane1, fill_lane2, fill_lane3};
+void GridsEngine::SetMap(uint8_t map, uint16_t map_x, uint16_t map_y) {
+  if (map >= kNumMaps) return;
+  want_x_[map] = MapCell(map_x, want_x_[map]);
+  want_y_[map] = MapCell(map_y, want_y_[map]);
+  const bool building = build_step_[map] != kIdle;
+  if (building && build_x_[map] == want_x_[map] && build_y_[map] == want_y_[map]) return;
+  if (!building && built_x_[map] == want_x_[map] && built_y_[map] == want_y_[map]) return;
+  // (Re)start the rebuild towards the new cell; a half-built buffer is simply overwritten.
+  build_x_[map] = want_x_[map];
+  build_y_[map] = want_y_[map];
+  build_step_[map] = 0;
+}
+
+void GridsEngine::Service() {
+  // One step of one map per call: three node reads, where Tick() used to do them all.
+  for (uint8_t m = 0; m < kNumMaps; ++m) {
+    const uint8_t step = build_step_[m];
+    if (step == kIdle) continue;
+    uint8_t* back = cache_[m][front_[m] ^ 1];
+    for (uint8_t instrument = 0; instrument < GridsResources::kNumInstruments; ++instrument) {
+      back[instrument * GridsResources::kStepsPerPattern + step] =
+          ReadDrumMap(step, instrument, build_x_[m], build_y_[m]);
+    }
+    if (step + 1 < GridsResources::kStepsPerPattern) {
+      build_step_[m] = static_cast<uint8_t>(step + 1);
+    } else {
+      front_[m] ^= 1;
+      built_x_[m] = build_x_[m];
+      built_y_[m] = build_y_[m];
+      build_step_[m] = kIdle;
+    }
+    return;
+  }
+}
+
+void GridsEngine::Flush() {
+  for (uint8_t m = 0; m < kNumMaps; ++m) {
+    while (build_step_[m] != kIdle) Service();
+  }
+}
 
+GridsEngine::Outputs GridsEngine::Tick(const uint16_t fill[kNumLanes], uint8_t chaos) {
   if (step_ == 0) {
     const uint8_t randomness = chaos << 1;
-    for (uint8_t i = 0; i < 3; ++i) {
-      part_perturbation_[i] = static_cast<uint8_t>((XorShift32(rng_) & 0xFF) * randomness >> 8);
+    for (uint8_t lane = 0; lane < kNumLanes; ++lane) {
+      uint32_t& rng = rng_[lane / GridsResources::kNumInstruments];
+      part_perturbation_[lane] = static_cast<uint8_t>((XorShift32(rng) & 0xFF) * randomness >> 8);
     }
   }
 
   Outputs out;
-  bool accent = false;
-  for (uint8_t instrument = 0; instrument < 3; ++instrument) {
-    uint8_t level = ReadDrumMap(step_, instrument, x8, y8);
-    const uint8_t perturb = part_perturbation_[instrument];
+  for (uint8_t lane = 0; lane < kNumLanes; ++lane) {
+    const uint8_t map = lane / GridsResources::kNumInstruments;
+    const uint8_t instrument = lane - map * GridsResources::kNumInstruments;
+    // While a map's rebuild is under way its cache is stale: read this step directly
+    uint8_t level = (build_step_[map] == kIdle) ? CachedLevel(map, step_, instrument)
+                                                : ReadDrumMap(step_, instrument, build_x_[map], build_y_[map]);
+    const uint8_t perturb = part_perturbation_[lane];
     if (level < static_cast<uint8_t>(255 - perturb)) {
       level = static_cast<uint8_t>(level + perturb);
     } else {
       level = 255;
     }
-    const uint8_t density = static_cast<uint8_t>(fills[instrument] >> 4);
+    const uint8_t density = static_cast<uint8_t>(fill[lane] >> 4);
     const uint8_t threshold = static_cast<uint8_t>(~density);
     const bool hit = level > threshold;
     if (hit && level > 192) {
-      accent = true;
+      out.accent[map] = true;
     }
-    if (instrument == 0) out.lane1 = hit;
-    if (instrument == 1) out.lane2 = hit;
-    if (instrument == 2) out.lane3 = hit;
+    out.lane[lane] = hit;
+    out.level[lane] = level;
   }
-  out.accent = accent;
 
   step_ = static_cast<uint8_t>((step_ + 1) & 0x1F);
   return out;
 }
-
@@ -2,27 +2,74 @@
 
 #include <cstdint>
 
+#include "GridsResources.h"
+
 class GridsEngine {
  public:
+  /** Independent pattern-map positions; each drives kNumInstruments lanes. */
+  static constexpr uint8_t kNumMaps = 2;
+  static constexpr uint8_t kNumLanes = kNumMaps * GridsResources::kNumInstruments;
+
   struct Outputs {
-    bool lane1 = false;
-    bool lane2 = false;
-    bool lane3 = false;
-    bool accent = false;
+    /** Lane l is instrument l % 3 of map l / 3. */
+    bool lane[kNumLanes] = {};
+    /** Perturbed pattern level behind each lane's hit (0–255), for velocity / CV. */
+    uint8_t level[kNumLanes] = {};
+    bool accent[kNumMaps] = {};
   };
 
+  GridsEngine();
   void Seed(uint32_t seed);
   void Reset();
   /** Current pattern step (0–31), before the next Tick() advances it. */
   uint8_t Step() const { return step_; }
-  /** map_x/map_y select the pattern node; each lane uses its own fill (0–4095 → density). */
-  Outputs Tick(uint16_t map_x, uint16_t map_y, uint16_t fill_lane1, uint16_t fill_lane2, uint16_t fill_lane3,
-               uint8_t chaos);
+
+  /**
+   * Move map `map` to map_x/map_y (0–4095). Cheap: only a move across an 8-bit cell (with
+   * a little hysteresis against knob noise) queues a rebuild of that map's pattern cache,
+   * which Service() then fills in a step at a time.
+   */
+  void SetMap(uint8_t map, uint16_t map_x, uint16_t map_y);
+  /** Once a sample: builds one step of a queued cache rebuild, then swaps it in. */
+  void Service();
+  /** Build every queued rebuild now (boot, tests). */
+  void Flush();
+
+  /**
+   * Each lane uses its own fill (0–4095 → density). A table read per lane; a map whose
+   * rebuild is still under way is read directly for this step instead.
+   */
+  Outputs Tick(const uint16_t fill[kNumLanes], uint8_t chaos);
+
+  /** Cached level of `instrument` at `step` for map `map`, as Tick() sees it. */
+  uint8_t CachedLevel(uint8_t map, uint8_t step, uint8_t instrument) const {
+    return cache_[map][front_[map]][instrument * GridsResources::kStepsPerPattern + step];
+  }
+  /** The 8-bit map position the live cache of `map` was built for. */
+  uint8_t CachedX(uint8_t map) const { return built_x_[map]; }
+  uint8_t CachedY(uint8_t map) const { return built_y_[map]; }
+
+  /** Direct bilinear read of the node table (four lookups, three blends). */
+  static uint8_t ReadDrumMap(uint8_t step, uint8_t instrument, uint8_t x, uint8_t y);
 
  private:
-  uint8_t ReadDrumMap(uint8_t step, uint8_t instrument, uint8_t x, uint8_t y) const;
+  static constexpr uint8_t kCacheSize = GridsResources::kStepsPerPattern * GridsResources::kNumInstruments;
+  static constexpr uint8_t kIdle = 0xFF;
+
   uint8_t step_ = 0;
-  uint32_t rng_ = 1;
-  uint8_t part_perturbation_[3] = {};
-};
+  /** One stream per map, so map 0 draws exactly what the single-map engine did. */
+  uint32_t rng_[kNumMaps] = {1, 1};
+  uint8_t part_perturbation_[kNumLanes] = {};
 
+  /** Double buffer per map: Tick() reads front_, Service() fills the other. */
+  uint8_t cache_[kNumMaps][2][kCacheSize] = {};
+  uint8_t front_[kNumMaps] = {};
+  uint8_t built_x_[kNumMaps] = {};
+  uint8_t built_y_[kNumMaps] = {};
+  uint8_t want_x_[kNumMaps] = {};
+  uint8_t want_y_[kNumMaps] = {};
+  /** Next step Service() builds into the back buffer, or kIdle. */
+  uint8_t build_step_[kNumMaps] = {};
+  uint8_t build_x_[kNumMaps] = {};
+  uint8_t build_y_[kNumMaps] = {};
+};
@@ -0,0 +1,169 @@
+// grids_bench — checks GridsEngine's pattern cache and times it against the engine before it.
+//
+// Builds ../GridsEngine.cpp on its own (no card, no SDK), next to GridsEngineRef, the
+// uncached single-map engine (ref/, renamed):
+//
+//   cache     for every 8-bit map cell, a flushed cache holds exactly ReadDrumMap()
+//   hyst      a knob within kMapHysteresis of its cell keeps the cache; past it, rebuilds
+//   lanes     lanes 1–3 and accent match GridsEngineRef tick for tick, with the map knobs
+//             jumping between cell centres and Service() run a clock tick's worth of
+//             samples (or far fewer, so Tick() lands mid-rebuild) between ticks
+//   cost      ns per Tick() for both engines, and per Service() while building
+//
+//   ./grids_bench          everything; exit status is non-zero on any mismatch
+#include "GridsEngine.h"
+#include "GridsEngineRef.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+
+namespace {
+
+uint16_t CellCentre(uint8_t cell) {
+  return static_cast<uint16_t>((cell << 4) | 8);
+}
+
+uint32_t Rand(uint32_t& state) {
+  state = state * 1664525u + 1013904223u;
+  return state >> 8;
+}
+
+int CheckCache() {
+  static GridsEngine engine;
+  int bad = 0;
+  for (int x = 0; x < 256; ++x) {
+    for (int y = 0; y < 256; ++y) {
+      engine.SetMap(0, CellCentre(x), CellCentre(y));
+      engine.Flush();
+      if (engine.CachedX(0) != x || engine.CachedY(0) != y) {
+        if (bad++ < 5) std::printf("  cache: built %d,%d for cell %d,%d\n", engine.CachedX(0), engine.CachedY(0), x, y);
+        continue;
+      }
+      for (uint8_t step = 0; step < GridsResources::kStepsPerPattern; ++step) {
+        for (uint8_t inst = 0; inst < GridsResources::kNumInstruments; ++inst) {
+          const uint8_t want = GridsEngine::ReadDrumMap(step, inst, x, y);
+          if (engine.CachedLevel(0, step, inst) != want && bad++ < 5) {
+            std::printf("  cache: cell %d,%d step %d inst %d: %d, map %d\n", x, y, step, inst,
+                        engine.CachedLevel(0, step, inst), want);
+          }
+        }
+      }
+    }
+  }
+  std::printf("cache   %-6s 65536 cells x 96 levels\n", bad ? "FAILED" : "ok");
+  return bad;
+}
+
+int CheckHysteresis() {
+  static GridsEngine engine;
+  int bad = 0;
+  engine.SetMap(0, CellCentre(100), CellCentre(100));
+  engine.Flush();
+  // Just past the cell's top edge, but within the hysteresis: stays
+  engine.SetMap(0, (100 << 4) + 15 + 4, (100 << 4) - 4);
+  engine.Flush();
+  if (engine.CachedX(0) != 100 || engine.CachedY(0) != 100) bad++;
+  // One more unit either way: moves
+  engine.SetMap(0, (100 << 4) + 15 + 5, (100 << 4) - 5);
+  engine.Flush();
+  if (engine.CachedX(0) != 101 || engine.CachedY(0) != 99) bad++;
+  std::printf("hyst    %s\n", bad ? "FAILED" : "ok");
+  return bad;
+}
+
+int CheckLanes() {
+  static GridsEngine engine;
+  static GridsEngineRef ref;
+  uint32_t rnd = 12345;
+  int bad = 0;
+  uint32_t ticks = 0, mid_rebuild = 0;
+  for (uint32_t seed : {1u, 0xC0FFEEu, 0x80000001u}) {
+    engine.Seed(seed);
+    ref.Seed(seed);
+    engine.Reset();
+    ref.Reset();
+    uint8_t x = 0, y = 0, chaos = 0;
+    for (uint32_t t = 0; t < 200000; ++t) {
+      if ((t & 7) == 0) {
+        // Jump the knobs; sometimes only a cell, sometimes across the map
+        x = (Rand(rnd) & 3) ? static_cast<uint8_t>(x + (Rand(rnd) % 3) - 1) : static_cast<uint8_t>(Rand(rnd));
+        y = (Rand(rnd) & 3) ? static_cast<uint8_t>(y + (Rand(rnd) % 3) - 1) : static_cast<uint8_t>(Rand(rnd));
+        chaos = static_cast<uint8_t>(Rand(rnd) & 0x7F);
+      }
+      uint16_t fills[GridsEngine::kNumLanes];
+      for (auto& f : fills) f = static_cast<uint16_t>(Rand(rnd) & 0xFFF);
+      engine.SetMap(0, CellCentre(x), CellCentre(y));
+      engine.SetMap(1, CellCentre(static_cast<uint8_t>(Rand(rnd))), CellCentre(y));
+      // 16ths at 120 BPM are 6000 samples; a few ticks see only part of a rebuild
+      const uint32_t samples = (Rand(rnd) & 1) ? 6000 : Rand(rnd) % 40;
+      for (uint32_t s = 0; s < samples; ++s) engine.Service();
+      if (engine.CachedX(0) != x || engine.CachedY(0) != y) mid_rebuild++;
+
+      const auto a = engine.Tick(fills, chaos);
+      const auto b = ref.Tick(CellCentre(x), CellCentre(y), fills[0], fills[1], fills[2], chaos);
+      ticks++;
+      if (a.lane[0] != b.lane1 || a.lane[1] != b.lane2 || a.lane[2] != b.lane3 || a.accent[0] != b.accent) {
+        if (bad++ < 5) {
+          std::printf("  lanes: seed %08x tick %u cell %d,%d: %d%d%d/%d, ref %d%d%d/%d\n", seed, t, x, y, a.lane[0],
+                      a.lane[1], a.lane[2], a.accent[0], b.lane1, b.lane2, b.lane3, b.accent);
+        }
+      }
+    }
+  }
+  std::printf("lanes   %-6s %u ticks, %u of them mid-rebuild\n", bad ? "FAILED" : "ok", ticks, mid_rebuild);
+  return bad;
+}
+
+template <typename F>
+double BestNs(uint32_t n, F&& f) {
+  double best = 1e30;
+  for (int pass = 0; pass < 5; ++pass) {
+    const auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < n; ++i) f(i);
+    const auto t1 = std::chrono::steady_clock::now();
+    best = std::min(best, std::chrono::duration<double, std::nano>(t1 - t0).count() / n);
+  }
+  return best;
+}
+
+void Cost() {
+  static GridsEngine engine;
+  static GridsEngineRef ref;
+  constexpr uint32_t kN = 1 << 20;
+  const uint16_t fills[GridsEngine::kNumLanes] = {2048, 2048, 2048, 2048, 2048, 2048};
+  volatile uint32_t sink = 0;
+
+  engine.Flush();
+  const double ref_tick = BestNs(kN, [&](uint32_t i) {
+    const auto o = ref.Tick(CellCentre(i >> 8), CellCentre(i >> 12), 2048, 2048, 2048, 20);
+    sink = sink + o.lane1 + o.lane2 + o.lane3;
+  });
+  const double tick = BestNs(kN, [&](uint32_t) {
+    const auto o = engine.Tick(fills, 20);
+    sink = sink + o.lane[0] + o.lane[3] + o.lane[5];
+  });
+  const double service_idle = BestNs(kN, [&](uint32_t) { engine.Service(); });
+  // Build continuously: a new cell every 32 steps, so every call does a step's reads
+  const double service_build = BestNs(kN, [&](uint32_t i) {
+    if ((i & 31) == 0) engine.SetMap(0, CellCentre(i >> 5), CellCentre(i >> 7));
+    engine.Service();
+  });
+  std::printf("cost    Tick ref (3 lanes, 12 node reads)      %6.1f ns\n", ref_tick);
+  std::printf("        Tick cached (6 lanes, 6 table reads)   %6.1f ns\n", tick);
+  std::printf("        Service idle / building a step         %6.1f / %.1f ns a sample\n", service_idle,
+              service_build);
+  (void)sink;
+}
+
+}  // namespace
+
+int main() {
+  int bad = 0;
+  bad += CheckCache();
+  bad += CheckHysteresis();
+  bad += CheckLanes();
+  Cost();
+  return bad ? 1 : 0;
+}
@@ -24,6 +24,9 @@ const DEFAULTS = {
   lane3_fill_offset: -10,
   aux_mode: 0,
   pulse_ms: 10,
+  map2_x: 192,
+  map2_y: 64,
+  midi_channel: 0,
 };
 
 const state = {
@@ -53,6 +56,9 @@ const fields = [
   "lane3_fill_offset",
   "aux_mode",
   "pulse_ms",
+  "map2_x",
+  "map2_y",
+  "midi_channel",
 ];
 
 function byId(id) {
@@ -154,9 +160,12 @@ function getConfigFromForm() {
     lane1_fill_offset: clamp(asInt(byId("lane1_fill_offset").value, DEFAULTS.lane1_fill_offset), -127, 127),
     lane2_fill_offset: clamp(asInt(byId("lane2_fill_offset").value, DEFAULTS.lane2_fill_offset), -127, 127),
     lane3_fill_offset: clamp(asInt(byId("lane3_fill_offset").value, DEFAULTS.lane3_fill_offset), -127, 127),
-    aux_mode: clamp(asInt(byId("aux_mode").value, DEFAULTS.aux_mode), 0, 2),
+    aux_mode: clamp(asInt(byId("aux_mode").value, DEFAULTS.aux_mode), 0, 3),
     pulse_ms: clamp(asInt(byId("pulse_ms").value, DEFAULTS.pulse_ms), 1, 40),
-    reserved: [0, 0, 0, 0, 0, 0, 0, 0],
+    map2_x: clamp(asInt(byId("map2_x").value, DEFAULTS.map2_x), 0, 255),
+    map2_y: clamp(asInt(byId("map2_y").value, DEFAULTS.map2_y), 0, 255),
+    midi_channel: clamp(asInt(byId("midi_channel").value, DEFAULTS.midi_channel), 0, 16),
+    reserved: [0, 0, 0, 0, 0],
   };
 }
 
@@ -211,7 +220,10 @@ function encodeStruct(cfg) {
   pushI8(cfg.lane3_fill_offset);
   pushU8(cfg.aux_mode);
   pushU8(cfg.pulse_ms);
-  for (const r of cfg.reserved || [0, 0, 0, 0, 0, 0, 0, 0]) pushU8(r);
+  pushU8(cfg.map2_x);
+  pushU8(cfg.map2_y);
+  pushU8(cfg.midi_channel);
+  for (const r of cfg.reserved || [0, 0, 0, 0, 0]) pushU8(r);
   return bytes;
 }
 
@@ -241,7 +253,10 @@ function decodeStruct(bytes) {
   cfg.lane3_fill_offset = i8();
   cfg.aux_mode = u8();
   cfg.pulse_ms = u8();
-  cfg.reserved = [u8(), u8(), u8(), u8(), u8(), u8(), u8(), u8()];
+  cfg.map2_x = u8();
+  cfg.map2_y = u8();
+  cfg.midi_channel = u8();
+  cfg.reserved = [u8(), u8(), u8(), u8(), u8()];
   return cfg;
 }
 
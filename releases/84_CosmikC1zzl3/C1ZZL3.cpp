@@ -1,5 +1,6 @@
 #include "ComputerCard.h"
 #include "C1ZZL3_LUT.h"
+#include "C1ZZL3_PDMip.h"
 #include "hardware/clocks.h"
 #include "hardware/sync.h"
 #include "pico/multicore.h"
@@ -40,6 +41,9 @@ public:
 
         noise = 1;
 
+        // Band-limited copies of the PD waves, one per octave of pitch.
+        buildPdMipTables(pdMip);
+
         loadPerformanceState();
         loadCustomEnvelopeState();
     }
@@ -536,7 +540,8 @@ private:
         int32_t pdCurve = responseCurve(noisyPd);
 
         int32_t sine = getSine(renderPhase);
-        int32_t target = morphWave(renderPhase, wave);
+        int32_t target =
+            morphWave(renderPhase, wave, pdMipLevelFor((uint32_t)freq));
 
         return mix(sine, target, pdCurve);
     }
@@ -1187,14 +1192,14 @@ private:
         return stage >= 8;
     }
 
-    inline int32_t morphWave(uint32_t phase, int32_t wave)
+    inline int32_t morphWave(uint32_t phase, int32_t wave, uint32_t level)
     {
         uint32_t scaled = ((uint32_t)wave * 7u);
         uint32_t index = scaled >> 12;
         uint32_t frac = compressWaveTransition(smoothStep12(scaled & 4095));
 
-        int32_t a = czWave(phase, index);
-        int32_t b = czWave(phase, index < 7 ? index + 1 : 7);
+        int32_t a = czWave(phase, index, level);
+        int32_t b = czWave(phase, index < 7 ? index + 1 : 7, level);
 
         return a + (((b - a) * (int32_t)frac) >> 12);
     }
@@ -1210,10 +1215,11 @@ private:
         return ((span * 4095u) / 2048u);
     }
 
-    inline int32_t czWave(uint32_t phase, uint32_t wave)
+    inline int32_t czWave(uint32_t phase, uint32_t wave, uint32_t level)
     {
-        uint32_t p = (phase >> 20) & 4095;
-        return pdWaveLUT[wave & 7u][p];
+        // The mip level drops partials that would fold back past Nyquist at
+        // this pitch; pdWaveLUT itself is only read on the host now.
+        return readPdMip(pdMip[wave & 7u], phase, level);
     }
 
     // =========================================================
@@ -2123,6 +2129,7 @@ private:
 
     uint32_t phase1 = 0;
     uint32_t phase2 = 0;
+    int16_t pdMip[PD_WAVE_COUNT][PD_MIP_SIZE] = {};
     uint32_t syncFadeSamples = 0;
     OutputFilterState outputFilterLeft = {};
     OutputFilterState outputFilterRight = {};
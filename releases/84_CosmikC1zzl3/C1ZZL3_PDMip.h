@@ -0,0 +1,157 @@
+// C1ZZL3_PDMip.h
+//
+// Band-limited, octave mip-mapped copies of the eight phase-distortion waves.
+//
+// pdWaveLUT holds each wave as 4096 raw samples with no band limit: read at
+// audio rate, every partial above Nyquist folds back into the audio band, and
+// the saw and square families carry partials all the way up. Here each wave is
+// kept as its first PD_MIP_HARMONICS partials (C1ZZL3_PDSpectra.cpp, generated
+// from pdWaveLUT by host/pd_tables), and at boot the card sums them into one
+// table per octave of pitch, each holding only the partials that stay below
+// Nyquist for every note in that octave.
+//
+// Nothing here touches the card or the SDK, so the host tool builds it
+// unchanged.
+#pragma once
+
+#include "C1ZZL3_LUT.h"
+
+#include <stdint.h>
+
+constexpr int PD_MIP_HARMONICS = 256;
+constexpr int PD_MIP_LEVELS = 9;
+constexpr int PD_MIP_SIZE = 2112;
+
+// Spectrum entry h is {cos, sin} amplitude of partial h in output units * 8;
+// entry 0 is {DC * 8, 0}. The builder keeps two more bits through the fade.
+constexpr int PD_SPECTRUM_SHIFT = 3;
+constexpr int PD_MIP_SUM_SHIFT = PD_SPECTRUM_SHIFT + 2;
+
+extern const int16_t pdWaveSpectrum[PD_WAVE_COUNT][PD_MIP_HARMONICS + 1][2];
+
+struct PdMipLevel
+{
+    uint16_t offset;
+    uint8_t sizeShift;
+    uint16_t harmonics;
+};
+
+// Level n keeps 256 >> n partials in four samples per partial, but never
+// fewer than 32 samples, so linear interpolation of the top partials stays
+// clean. Nine levels cover 256 partials down to a sine.
+constexpr PdMipLevel PdMipLevels[PD_MIP_LEVELS] = {
+    {0, 10, 256},
+    {1024, 9, 128},
+    {1536, 8, 64},
+    {1792, 7, 32},
+    {1920, 6, 16},
+    {1984, 5, 8},
+    {2016, 5, 4},
+    {2048, 5, 2},
+    {2080, 5, 1},
+};
+
+static_assert(PdMipLevels[PD_MIP_LEVELS - 1].offset + 32 == PD_MIP_SIZE,
+              "mip levels must fill PD_MIP_SIZE");
+
+// Partial h of a level with H partials is weighted in Q15: untouched up to
+// H / 2, then a raised-cosine fade that would reach zero at H + 1. A hard cut
+// would ring about 9% past the rails on the saw and square families. Only the
+// top octave of each level fades, so neighbouring levels agree below it, and
+// the fundamental is never touched.
+inline int32_t pdMipTaperQ15(int32_t harmonic, int32_t harmonics)
+{
+    if (harmonic <= 1 || harmonic * 2 <= harmonics)
+        return 32768;
+
+    // cos(pi x) for x = (2h - H) / (H + 2); half a cycle is 512 entries.
+    int32_t index = 256 +
+        ((harmonic * 2 - harmonics) * 512 + (harmonics + 2) / 2) /
+            (harmonics + 2);
+    int32_t cosine = sineLUT[index & 1023];
+
+    return ((2047 + cosine) << 15) / 4094;
+}
+
+inline void buildPdMipTables(int16_t (&tables)[PD_WAVE_COUNT][PD_MIP_SIZE])
+{
+    // Boot only: sum each level's partials straight from the sine table.
+    // Level sizes divide 1024, so every partial lands on exact table entries.
+    for (int wave = 0; wave < PD_WAVE_COUNT; ++wave)
+    {
+        const int16_t (*spectrum)[2] = pdWaveSpectrum[wave];
+
+        for (int level = 0; level < PD_MIP_LEVELS; ++level)
+        {
+            const PdMipLevel& mip = PdMipLevels[level];
+            int32_t size = 1 << mip.sizeShift;
+            int32_t stride = 1024 >> mip.sizeShift;
+
+            // Static rather than on the small boot stack.
+            static int32_t cosine[PD_MIP_HARMONICS + 1];
+            static int32_t sine[PD_MIP_HARMONICS + 1];
+            constexpr int32_t TaperShift =
+                15 - (PD_MIP_SUM_SHIFT - PD_SPECTRUM_SHIFT);
+            for (int h = 0; h <= mip.harmonics; ++h)
+            {
+                int32_t taper = pdMipTaperQ15(h, mip.harmonics);
+                int32_t round = 1 << (TaperShift - 1);
+                cosine[h] = (spectrum[h][0] * taper + round) >> TaperShift;
+                sine[h] = (spectrum[h][1] * taper + round) >> TaperShift;
+            }
+
+            int16_t* table = tables[wave] + mip.offset;
+            for (int32_t n = 0; n < size; ++n)
+            {
+                // DC rides on a constant 2047, the sine table's peak.
+                int32_t sum = cosine[0] * 2047;
+                uint32_t step = (uint32_t)(n * stride);
+                uint32_t index = 0;
+
+                for (int h = 1; h <= mip.harmonics; ++h)
+                {
+                    index += step;
+                    sum += cosine[h] * sineLUT[(index + 256u) & 1023u];
+                    sum += sine[h] * sineLUT[index & 1023u];
+                }
+
+                // Output units * 32 * 2047: back to output units, rounded.
+                // Band-limited edges overshoot the raw tables' rails (the
+                // square's fundamental alone is 4 / pi of them). That is kept
+                // rather than clipped here, which would put partials back
+                // above the limit; the voice clips after the blend as before.
+                int32_t half = 2047 << (PD_MIP_SUM_SHIFT - 1);
+                table[n] = (int16_t)((sum < 0 ? sum - half : sum + half) /
+                                     (2047 << PD_MIP_SUM_SHIFT));
+            }
+        }
+    }
+}
+
+// The level whose partials all stay below Nyquist at this phase increment:
+// with H partials the top one sits at H * increment, which must stay below
+// 2^31. So H = 2^(clz(increment) - 1), capped at PD_MIP_HARMONICS.
+inline uint32_t pdMipLevelFor(uint32_t increment)
+{
+    int32_t level = 9 - (int32_t)__builtin_clz(increment | 1u);
+    if (level < 0)
+        return 0;
+    if (level >= PD_MIP_LEVELS)
+        return PD_MIP_LEVELS - 1;
+    return (uint32_t)level;
+}
+
+inline int32_t readPdMip(const int16_t* table, uint32_t phase, uint32_t level)
+{
+    const PdMipLevel& mip = PdMipLevels[level];
+    uint32_t shift = mip.sizeShift;
+    uint32_t mask = (1u << shift) - 1u;
+    uint32_t index = phase >> (32 - shift);
+    uint32_t frac = (phase >> (20 - shift)) & 4095u;
+
+    const int16_t* levelTable = table + mip.offset;
+    int32_t a = levelTable[index];
+    int32_t b = levelTable[(index + 1u) & mask];
+
+    return a + (((b - a) * (int32_t)frac) >> 12);
+}
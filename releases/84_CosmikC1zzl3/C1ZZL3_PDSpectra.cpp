@@ -0,0 +1,545 @@
+// C1ZZL3_PDSpectra.cpp
+//
+// Generated by host/pd_spectra from pdWaveLUT in C1ZZL3_LUT.cpp: do not edit.
+// Per wave, partials 0..256 as {cos, sin} in output units * 8 (C1ZZL3_PDMip.h).
+
+#include "C1ZZL3_PDMip.h"
+
+const int16_t pdWaveSpectrum[PD_WAVE_COUNT][PD_MIP_HARMONICS + 1][2] = {
+  { // wave 0
+    {    -4,      0}, {    -8, -10430}, {    -8,  -5215}, {    -8,  -3477},
+    {    -8,  -2608}, {    -8,  -2086}, {    -8,  -1738}, {    -8,  -1490},
+    {    -8,  -1304}, {    -8,  -1159}, {    -8,  -1043}, {    -8,   -948},
+    {    -8,   -869}, {    -8,   -802}, {    -8,   -745}, {    -8,   -695},
+    {    -8,   -652}, {    -8,   -614}, {    -8,   -579}, {    -8,   -549},
+    {    -8,   -521}, {    -8,   -497}, {    -8,   -474}, {    -8,   -453},
+    {    -8,   -435}, {    -8,   -417}, {    -8,   -401}, {    -8,   -386},
+    {    -8,   -372}, {    -8,   -360}, {    -8,   -348}, {    -8,   -336},
+    {    -8,   -326}, {    -8,   -316}, {    -8,   -307}, {    -8,   -298},
+    {    -8,   -290}, {    -8,   -282}, {    -8,   -274}, {    -8,   -267},
+    {    -8,   -261}, {    -8,   -254}, {    -8,   -248}, {    -8,   -242},
+    {    -8,   -237}, {    -8,   -232}, {    -8,   -227}, {    -8,   -222},
+    {    -8,   -217}, {    -8,   -213}, {    -8,   -209}, {    -8,   -204},
+    {    -8,   -200}, {    -8,   -197}, {    -8,   -193}, {    -8,   -190},
+    {    -8,   -186}, {    -8,   -183}, {    -8,   -180}, {    -8,   -177},
+    {    -8,   -174}, {    -8,   -171}, {    -8,   -168}, {    -8,   -165},
+    {    -8,   -163}, {    -8,   -160}, {    -8,   -158}, {    -8,   -156},
+    {    -8,   -153}, {    -8,   -151}, {    -8,   -149}, {    -8,   -147},
+    {    -8,   -145}, {    -8,   -143}, {    -8,   -141}, {    -8,   -139},
+    {    -8,   -137}, {    -8,   -135}, {    -8,   -134}, {    -8,   -132},
+    {    -8,   -130}, {    -8,   -129}, {    -8,   -127}, {    -8,   -125},
+    {    -8,   -124}, {    -8,   -123}, {    -8,   -121}, {    -8,   -120},
+    {    -8,   -118}, {    -8,   -117}, {    -8,   -116}, {    -8,   -114},
+    {    -8,   -113}, {    -8,   -112}, {    -8,   -111}, {    -8,   -110},
+    {    -8,   -108}, {    -8,   -107}, {    -8,   -106}, {    -8,   -105},
+    {    -8,   -104}, {    -8,   -103}, {    -8,   -102}, {    -8,   -101},
+    {    -8,   -100}, {    -8,    -99}, {    -8,    -98}, {    -8,    -97},
+    {    -8,    -96}, {    -8,    -95}, {    -8,    -95}, {    -8,    -94},
+    {    -8,    -93}, {    -8,    -92}, {    -8,    -91}, {    -8,    -90},
+    {    -8,    -90}, {    -8,    -89}, {    -8,    -88}, {    -8,    -87},
+    {    -8,    -87}, {    -8,    -86}, {    -8,    -85}, {    -8,    -85},
+    {    -8,    -84}, {    -8,    -83}, {    -8,    -83}, {    -8,    -82},
+    {    -8,    -81}, {    -8,    -81}, {    -8,    -80}, {    -8,    -79},
+    {    -8,    -79}, {    -8,    -78}, {    -8,    -78}, {    -8,    -77},
+    {    -8,    -76}, {    -8,    -76}, {    -8,    -75}, {    -8,    -75},
+    {    -8,    -74}, {    -8,    -74}, {    -8,    -73}, {    -8,    -73},
+    {    -8,    -72}, {    -8,    -72}, {    -8,    -71}, {    -8,    -71},
+    {    -8,    -70}, {    -8,    -70}, {    -8,    -69}, {    -8,    -69},
+    {    -8,    -68}, {    -8,    -68}, {    -8,    -67}, {    -8,    -67},
+    {    -8,    -67}, {    -8,    -66}, {    -8,    -66}, {    -8,    -65},
+    {    -8,    -65}, {    -8,    -64}, {    -8,    -64}, {    -8,    -64},
+    {    -8,    -63}, {    -8,    -63}, {    -8,    -62}, {    -8,    -62},
+    {    -8,    -62}, {    -8,    -61}, {    -8,    -61}, {    -8,    -61},
+    {    -8,    -60}, {    -8,    -60}, {    -8,    -60}, {    -8,    -59},
+    {    -8,    -59}, {    -8,    -59}, {    -8,    -58}, {    -8,    -58},
+    {    -8,    -58}, {    -8,    -57}, {    -8,    -57}, {    -8,    -57},
+    {    -8,    -56}, {    -8,    -56}, {    -8,    -56}, {    -8,    -55},
+    {    -8,    -55}, {    -8,    -55}, {    -8,    -55}, {    -8,    -54},
+    {    -8,    -54}, {    -8,    -54}, {    -8,    -53}, {    -8,    -53},
+    {    -8,    -53}, {    -8,    -53}, {    -8,    -52}, {    -8,    -52},
+    {    -8,    -52}, {    -8,    -51}, {    -8,    -51}, {    -8,    -51},
+    {    -8,    -51}, {    -8,    -50}, {    -8,    -50}, {    -8,    -50},
+    {    -8,    -50}, {    -8,    -49}, {    -8,    -49}, {    -8,    -49},
+    {    -8,    -49}, {    -8,    -49}, {    -8,    -48}, {    -8,    -48},
+    {    -8,    -48}, {    -8,    -48}, {    -8,    -47}, {    -8,    -47},
+    {    -8,    -47}, {    -8,    -47}, {    -8,    -47}, {    -8,    -46},
+    {    -8,    -46}, {    -8,    -46}, {    -8,    -46}, {    -8,    -45},
+    {    -8,    -45}, {    -8,    -45}, {    -8,    -45}, {    -8,    -45},
+    {    -8,    -44}, {    -8,    -44}, {    -8,    -44}, {    -8,    -44},
+    {    -8,    -44}, {    -8,    -44}, {    -8,    -43}, {    -8,    -43},
+    {    -8,    -43}, {    -8,    -43}, {    -8,    -43}, {    -8,    -42},
+    {    -8,    -42}, {    -8,    -42}, {    -8,    -42}, {    -8,    -42},
+    {    -8,    -42}, {    -8,    -41}, {    -8,    -41}, {    -8,    -41},
+    {    -8,    -41}, {    -8,    -41}, {    -8,    -41}, {    -8,    -40},
+    {    -8,    -40}
+  },
+  { // wave 1
+    {    -4,      0}, {   -16, -20856}, {     0,      0}, {   -16,  -6952},
+    {     0,      0}, {   -16,  -4171}, {     0,      0}, {   -16,  -2979},
+    {     0,      0}, {   -16,  -2317}, {     0,      0}, {   -16,  -1896},
+    {     0,      0}, {   -16,  -1604}, {     0,      0}, {   -16,  -1390},
+    {     0,      0}, {   -16,  -1227}, {     0,      0}, {   -16,  -1098},
+    {     0,      0}, {   -16,   -993}, {     0,      0}, {   -16,   -907},
+    {     0,      0}, {   -16,   -834}, {     0,      0}, {   -16,   -772},
+    {     0,      0}, {   -16,   -719}, {     0,      0}, {   -16,   -673},
+    {     0,      0}, {   -16,   -632}, {     0,      0}, {   -16,   -596},
+    {     0,      0}, {   -16,   -564}, {     0,      0}, {   -16,   -535},
+    {     0,      0}, {   -16,   -509}, {     0,      0}, {   -16,   -485},
+    {     0,      0}, {   -16,   -463}, {     0,      0}, {   -16,   -444},
+    {     0,      0}, {   -16,   -425}, {     0,      0}, {   -16,   -409},
+    {     0,      0}, {   -16,   -393}, {     0,      0}, {   -16,   -379},
+    {     0,      0}, {   -16,   -366}, {     0,      0}, {   -16,   -353},
+    {     0,      0}, {   -16,   -342}, {     0,      0}, {   -16,   -331},
+    {     0,      0}, {   -16,   -321}, {     0,      0}, {   -16,   -311},
+    {     0,      0}, {   -16,   -302}, {     0,      0}, {   -16,   -293},
+    {     0,      0}, {   -16,   -285}, {     0,      0}, {   -16,   -278},
+    {     0,      0}, {   -16,   -271}, {     0,      0}, {   -16,   -264},
+    {     0,      0}, {   -16,   -257}, {     0,      0}, {   -16,   -251},
+    {     0,      0}, {   -16,   -245}, {     0,      0}, {   -16,   -239},
+    {     0,      0}, {   -16,   -234}, {     0,      0}, {   -16,   -229},
+    {     0,      0}, {   -16,   -224}, {     0,      0}, {   -16,   -219},
+    {     0,      0}, {   -16,   -215}, {     0,      0}, {   -16,   -210},
+    {     0,      0}, {   -16,   -206}, {     0,      0}, {   -16,   -202},
+    {     0,      0}, {   -16,   -198}, {     0,      0}, {   -16,   -194},
+    {     0,      0}, {   -16,   -191}, {     0,      0}, {   -16,   -187},
+    {     0,      0}, {   -16,   -184}, {     0,      0}, {   -16,   -181},
+    {     0,      0}, {   -16,   -178}, {     0,      0}, {   -16,   -175},
+    {     0,      0}, {   -16,   -172}, {     0,      0}, {   -16,   -169},
+    {     0,      0}, {   -16,   -166}, {     0,      0}, {   -16,   -164},
+    {     0,      0}, {   -16,   -161}, {     0,      0}, {   -16,   -159},
+    {     0,      0}, {   -16,   -156}, {     0,      0}, {   -16,   -154},
+    {     0,      0}, {   -16,   -152}, {     0,      0}, {   -16,   -149},
+    {     0,      0}, {   -16,   -147}, {     0,      0}, {   -16,   -145},
+    {     0,      0}, {   -16,   -143}, {     0,      0}, {   -16,   -141},
+    {     0,      0}, {   -16,   -139}, {     0,      0}, {   -16,   -137},
+    {     0,      0}, {   -16,   -136}, {     0,      0}, {   -16,   -134},
+    {     0,      0}, {   -16,   -132}, {     0,      0}, {   -16,   -131},
+    {     0,      0}, {   -16,   -129}, {     0,      0}, {   -16,   -127},
+    {     0,      0}, {   -16,   -126}, {     0,      0}, {   -16,   -124},
+    {     0,      0}, {   -16,   -123}, {     0,      0}, {   -16,   -121},
+    {     0,      0}, {   -16,   -120}, {     0,      0}, {   -16,   -118},
+    {     0,      0}, {   -16,   -117}, {     0,      0}, {   -16,   -116},
+    {     0,      0}, {   -16,   -114}, {     0,      0}, {   -16,   -113},
+    {     0,      0}, {   -16,   -112}, {     0,      0}, {   -16,   -111},
+    {     0,      0}, {   -16,   -110}, {     0,      0}, {   -16,   -108},
+    {     0,      0}, {   -16,   -107}, {     0,      0}, {   -16,   -106},
+    {     0,      0}, {   -16,   -105}, {     0,      0}, {   -16,   -104},
+    {     0,      0}, {   -16,   -103}, {     0,      0}, {   -16,   -102},
+    {     0,      0}, {   -16,   -101}, {     0,      0}, {   -16,   -100},
+    {     0,      0}, {   -16,    -99}, {     0,      0}, {   -16,    -98},
+    {     0,      0}, {   -16,    -97}, {     0,      0}, {   -16,    -96},
+    {     0,      0}, {   -16,    -95}, {     0,      0}, {   -16,    -94},
+    {     0,      0}, {   -16,    -93}, {     0,      0}, {   -16,    -93},
+    {     0,      0}, {   -16,    -92}, {     0,      0}, {   -16,    -91},
+    {     0,      0}, {   -16,    -90}, {     0,      0}, {   -16,    -89},
+    {     0,      0}, {   -16,    -89}, {     0,      0}, {   -16,    -88},
+    {     0,      0}, {   -16,    -87}, {     0,      0}, {   -16,    -86},
+    {     0,      0}, {   -16,    -86}, {     0,      0}, {   -16,    -85},
+    {     0,      0}, {   -16,    -84}, {     0,      0}, {   -16,    -83},
+    {     0,      0}, {   -16,    -83}, {     0,      0}, {   -16,    -82},
+    {     0,      0}, {   -16,    -81}, {     0,      0}, {   -16,    -81},
+    {     0,      0}
+  },
+  { // wave 2
+    {    -4,      0}, {  2010,   2242}, {     0,      0}, {  1910,    572},
+    {     0,      0}, {  1718,    905}, {     0,      0}, {  1453,   1173},
+    {     0,      0}, {  1137,   1356}, {     0,      0}, {   798,   1446},
+    {     0,      0}, {   463,   1444}, {     0,      0}, {   159,   1358},
+    {     0,      0}, {   -92,   1202}, {     0,      0}, {  -276,   1000},
+    {     0,      0}, {  -386,    774}, {     0,      0}, {  -421,    550},
+    {     0,      0}, {  -391,    347}, {     0,      0}, {  -309,    185},
+    {     0,      0}, {  -193,     73}, {     0,      0}, {   -64,     16},
+    {     0,      0}, {    61,     12}, {     0,      0}, {   163,     51},
+    {     0,      0}, {   233,    122}, {     0,      0}, {   263,    208},
+    {     0,      0}, {   254,    294}, {     0,      0}, {   210,    367},
+    {     0,      0}, {   141,    415}, {     0,      0}, {    59,    432},
+    {     0,      0}, {   -24,    418}, {     0,      0}, {   -95,    375},
+    {     0,      0}, {  -146,    310}, {     0,      0}, {  -171,    234},
+    {     0,      0}, {  -168,    156}, {     0,      0}, {  -139,     88},
+    {     0,      0}, {   -91,     37}, {     0,      0}, {   -31,      9},
+    {     0,      0}, {    31,      5}, {     0,      0}, {    86,     25},
+    {     0,      0}, {   126,     62}, {     0,      0}, {   147,    111},
+    {     0,      0}, {   146,    162}, {     0,      0}, {   125,    208},
+    {     0,      0}, {    88,    241}, {     0,      0}, {    41,    256},
+    {     0,      0}, {    -8,    253}, {     0,      0}, {   -53,    232},
+    {     0,      0}, {   -87,    196}, {     0,      0}, {  -105,    150},
+    {     0,      0}, {  -105,    103}, {     0,      0}, {   -89,     59},
+    {     0,      0}, {   -59,     26}, {     0,      0}, {   -21,      6},
+    {     0,      0}, {    21,      3}, {     0,      0}, {    59,     15},
+    {     0,      0}, {    87,     41}, {     0,      0}, {   103,     74},
+    {     0,      0}, {   104,    110}, {     0,      0}, {    91,    143},
+    {     0,      0}, {    66,    169}, {     0,      0}, {    34,    182},
+    {     0,      0}, {    -2,    182}, {     0,      0}, {   -34,    168},
+    {     0,      0}, {   -60,    144}, {     0,      0}, {   -74,    112},
+    {     0,      0}, {   -76,     77}, {     0,      0}, {   -65,     45},
+    {     0,      0}, {   -44,     20}, {     0,      0}, {   -15,      5},
+    {     0,      0}, {    16,      2}, {     0,      0}, {    45,     11},
+    {     0,      0}, {    67,     29}, {     0,      0}, {    80,     55},
+    {     0,      0}, {    82,     82}, {     0,      0}, {    73,    109},
+    {     0,      0}, {    55,    129}, {     0,      0}, {    30,    141},
+    {     0,      0}, {     2,    142}, {     0,      0}, {   -24,    132},
+    {     0,      0}, {   -44,    114}, {     0,      0}, {   -56,     90},
+    {     0,      0}, {   -58,     63}, {     0,      0}, {   -51,     37},
+    {     0,      0}, {   -34,     17}, {     0,      0}, {   -12,      4},
+    {     0,      0}, {    13,      1}, {     0,      0}, {    36,      8},
+    {     0,      0}, {    55,     22}, {     0,      0}, {    66,     42},
+    {     0,      0}, {    68,     65}, {     0,      0}, {    62,     87},
+    {     0,      0}, {    47,    104}, {     0,      0}, {    27,    114},
+    {     0,      0}, {     5,    116}, {     0,      0}, {   -17,    109},
+    {     0,      0}, {   -34,     95}, {     0,      0}, {   -45,     75},
+    {     0,      0}, {   -47,     53}, {     0,      0}, {   -41,     32},
+    {     0,      0}, {   -28,     15}, {     0,      0}, {   -10,      4},
+    {     0,      0}, {    11,      1}, {     0,      0}, {    30,      6},
+    {     0,      0}, {    46,     17}, {     0,      0}, {    56,     35},
+    {     0,      0}, {    59,     53}, {     0,      0}, {    54,     72},
+    {     0,      0}, {    42,     87}, {     0,      0}, {    25,     96},
+    {     0,      0}, {     6,     98}, {     0,      0}, {   -12,     93},
+    {     0,      0}, {   -27,     81}, {     0,      0}, {   -36,     65},
+    {     0,      0}, {   -39,     46}, {     0,      0}, {   -35,     28},
+    {     0,      0}, {   -24,     13}, {     0,      0}, {    -8,      3},
+    {     0,      0}, {     9,      0}, {     0,      0}, {    26,      4},
+    {     0,      0}, {    40,     14}, {     0,      0}, {    49,     29},
+    {     0,      0}, {    52,     45}, {     0,      0}, {    48,     61},
+    {     0,      0}, {    38,     74}, {     0,      0}, {    24,     83},
+    {     0,      0}, {     8,     85}, {     0,      0}, {    -8,     81},
+    {     0,      0}, {   -22,     71}, {     0,      0}, {   -30,     57},
+    {     0,      0}, {   -33,     41}, {     0,      0}, {   -30,     25},
+    {     0,      0}, {   -21,     12}, {     0,      0}, {    -7,      3},
+    {     0,      0}
+  },
+  { // wave 3
+    {    -1,      0}, {     0,      0}, {     0,  16376}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,     -1}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}
+  },
+  { // wave 4
+    { -4102,      0}, {-10523,  12851}, {  2354,  -3631}, { -3921,   1424},
+    {  2265,     18}, { -2178,   -782}, {  1076,   1237}, {  -700,  -1373},
+    {   -84,   1310}, {   364,  -1073}, {  -792,    746}, {   825,   -369},
+    {  -911,      9}, {   710,    301}, {  -563,   -521}, {   247,    640},
+    {   -31,   -652}, {  -248,    571}, {   386,   -415}, {  -521,    218},
+    {   507,     -8}, {  -475,   -182}, {   329,    330}, {  -192,   -416},
+    {    -2,    435}, {   143,   -388}, {  -287,    289}, {   346,   -155},
+    {  -380,      8}, {   328,    130}, {  -258,   -240}, {   130,    308},
+    {   -14,   -326}, {  -119,    295}, {   206,   -222}, {  -277,    122},
+    {   285,     -8}, {  -268,   -100}, {   196,    188}, {  -114,   -244},
+    {     4,    261}, {    86,   -238}, {  -173,    181}, {   218,   -100},
+    {  -240,      8}, {   214,     81}, {  -169,   -155}, {    90,    202},
+    {   -11,   -217}, {   -76,    200}, {   139,   -153}, {  -188,     86},
+    {   198,     -8}, {  -187,    -68}, {   140,    131}, {   -82,   -172},
+    {     6,    186}, {    61,   -172}, {  -123,    133}, {   158,    -75},
+    {  -175,      8}, {   159,     58}, {  -126,   -113}, {    69,    150},
+    {   -10,   -163}, {   -55,    151}, {   105,   -117}, {  -142,     67},
+    {   152,     -8}, {  -144,    -50}, {   110,    100}, {   -65,   -132},
+    {     7,    145}, {    46,   -135}, {   -95,    105}, {   124,    -61},
+    {  -138,      8}, {   127,     44}, {  -101,    -89}, {    57,    119},
+    {    -9,   -130}, {   -43,    122}, {    83,    -95}, {  -114,     55},
+    {   123,     -8}, {  -117,    -39}, {    90,     80}, {   -54,   -108},
+    {     7,    118}, {    37,   -111}, {   -77,     87}, {   102,    -51},
+    {  -114,      8}, {   106,     35}, {   -85,    -73}, {    49,     98},
+    {    -9,   -108}, {   -34,    102}, {    69,    -81}, {   -95,     48},
+    {   103,     -8}, {   -99,    -32}, {    77,     66}, {   -47,    -90},
+    {     7,    100}, {    30,    -95}, {   -64,     75}, {    86,    -45},
+    {   -97,      8}, {    91,     29}, {   -73,    -61}, {    43,     83},
+    {    -8,    -93}, {   -28,     88}, {    58,    -70}, {   -81,     42},
+    {    89,     -8}, {   -86,    -27}, {    68,     57}, {   -41,    -78},
+    {     8,     87}, {    25,    -82}, {   -55,     66}, {    75,    -40},
+    {   -84,      8}, {    80,     24}, {   -64,    -53}, {    38,     72},
+    {    -8,    -81}, {   -24,     77}, {    51,    -62}, {   -71,     38},
+    {    78,     -8}, {   -76,    -23}, {    60,     49}, {   -37,    -68},
+    {     8,     76}, {    21,    -73}, {   -48,     59}, {    66,    -36},
+    {   -75,      8}, {    71,     21}, {   -58,    -46}, {    35,     64},
+    {    -8,    -72}, {   -20,     69}, {    44,    -56}, {   -62,     34},
+    {    70,     -8}, {   -68,    -19}, {    54,     43}, {   -34,    -60},
+    {     8,     68}, {    18,    -66}, {   -42,     53}, {    59,    -33},
+    {   -67,      8}, {    64,     18}, {   -52,    -41}, {    32,     57},
+    {    -8,    -65}, {   -17,     63}, {    39,    -51}, {   -56,     32},
+    {    63,     -8}, {   -61,    -17}, {    50,     39}, {   -31,    -54},
+    {     8,     62}, {    16,    -60}, {   -38,     49}, {    53,    -31},
+    {   -61,      8}, {    58,     16}, {   -48,    -36}, {    30,     52},
+    {    -8,    -59}, {   -15,     57}, {    35,    -47}, {   -51,     30},
+    {    57,     -8}, {   -56,    -14}, {    46,     35}, {   -29,    -49},
+    {     8,     56}, {    14,    -55}, {   -34,     45}, {    48,    -29},
+    {   -55,      8}, {    54,     14}, {   -44,    -33}, {    28,     47},
+    {    -8,    -54}, {   -13,     53}, {    32,    -43}, {   -46,     28},
+    {    53,     -8}, {   -52,    -13}, {    42,     31}, {   -27,    -45},
+    {     8,     52}, {    12,    -51}, {   -31,     42}, {    44,    -27},
+    {   -51,      8}, {    50,     12}, {   -41,    -30}, {    26,     43},
+    {    -8,    -50}, {   -12,     49}, {    29,    -40}, {   -42,     26},
+    {    49,     -8}, {   -48,    -11}, {    40,     28}, {   -26,    -41},
+    {     8,     48}, {    11,    -47}, {   -28,     39}, {    40,    -25},
+    {   -47,      8}, {    46,     10}, {   -39,    -27}, {    25,     40},
+    {    -8,    -46}, {   -10,     45}, {    27,    -38}, {   -39,     25},
+    {    45,     -8}, {   -45,    -10}, {    37,     26}, {   -25,    -38},
+    {     8,     44}, {     9,    -44}, {   -26,     37}, {    37,    -24},
+    {   -44,      8}, {    43,      9}, {   -36,    -25}, {    24,     37},
+    {    -8,    -43}, {    -9,     43}, {    24,    -36}, {   -36,     24},
+    {    42,     -8}, {   -42,     -9}, {    35,     24}, {   -24,    -35},
+    {     8,     41}, {     8,    -41}, {   -24,     35}, {    35,    -23},
+    {   -41,      8}, {    41,      8}, {   -34,    -23}, {    23,     34},
+    {    -8,    -40}
+  },
+  { // wave 5
+    {  -858,      0}, {  -651,  -2492}, {   564,  -1140}, {   861,   -750},
+    {  1297,   -644}, {  2656,   -627}, {   159,   7593}, { -2342,   -489},
+    {  -995,   -339}, {  -603,   -196}, {  -491,   -118}, {  -469,   -127},
+    {  -437,   -199}, {  -351,   -278}, {  -225,   -310}, {  -105,   -272},
+    {   -38,   -183}, {   -41,    -92}, {   -95,    -44}, {  -156,    -55},
+    {  -181,   -110}, {  -156,   -169}, {   -95,   -196}, {   -31,   -177},
+    {     3,   -127}, {    -3,    -74}, {   -37,    -46}, {   -73,    -52},
+    {   -89,    -79}, {   -79,   -107}, {   -52,   -120}, {   -25,   -111},
+    {   -12,    -91}, {   -14,    -71}, {   -25,    -61}, {   -34,    -63},
+    {   -37,    -69}, {   -32,    -72}, {   -27,    -71}, {   -24,    -67},
+    {   -25,    -64}, {   -27,    -65}, {   -24,    -68}, {   -17,    -69},
+    {   -10,    -64}, {    -8,    -55}, {   -12,    -46}, {   -21,    -43},
+    {   -28,    -48}, {   -29,    -56}, {   -23,    -64}, {   -12,    -64},
+    {    -3,    -57}, {    -1,    -47}, {    -7,    -38}, {   -15,    -36},
+    {   -21,    -40}, {   -22,    -47}, {   -17,    -52}, {   -10,    -52},
+    {    -6,    -48}, {    -5,    -42}, {    -8,    -38}, {   -11,    -38},
+    {   -12,    -39}, {   -11,    -40}, {   -10,    -40}, {    -9,    -38},
+    {   -10,    -37}, {   -11,    -38}, {   -11,    -39}, {    -9,    -40},
+    {    -6,    -39}, {    -4,    -36}, {    -5,    -32}, {    -8,    -30},
+    {   -11,    -30}, {   -13,    -34}, {   -12,    -37}, {    -8,    -39},
+    {    -4,    -37}, {    -2,    -33}, {    -3,    -29}, {    -6,    -27},
+    {   -10,    -27}, {   -11,    -30}, {    -9,    -32}, {    -7,    -33},
+    {    -5,    -32}, {    -4,    -30}, {    -4,    -28}, {    -6,    -27},
+    {    -6,    -27}, {    -6,    -28}, {    -6,    -28}, {    -6,    -27},
+    {    -6,    -26}, {    -7,    -26}, {    -7,    -27}, {    -6,    -28},
+    {    -4,    -28}, {    -3,    -27}, {    -3,    -24}, {    -4,    -22},
+    {    -6,    -22}, {    -8,    -24}, {    -8,    -26}, {    -6,    -27},
+    {    -4,    -27}, {    -2,    -25}, {    -2,    -23}, {    -3,    -21},
+    {    -5,    -21}, {    -7,    -22}, {    -6,    -23}, {    -5,    -24},
+    {    -4,    -24}, {    -3,    -23}, {    -3,    -22}, {    -4,    -21},
+    {    -4,    -21}, {    -4,    -21}, {    -4,    -21}, {    -4,    -21},
+    {    -4,    -20}, {    -5,    -20}, {    -5,    -21}, {    -5,    -22},
+    {    -4,    -22}, {    -3,    -21}, {    -2,    -20}, {    -3,    -18},
+    {    -4,    -18}, {    -6,    -18}, {    -6,    -20}, {    -5,    -21},
+    {    -4,    -21}, {    -2,    -20}, {    -2,    -19}, {    -3,    -17},
+    {    -4,    -17}, {    -5,    -17}, {    -5,    -18}, {    -4,    -19},
+    {    -4,    -19}, {    -3,    -18}, {    -3,    -18}, {    -3,    -18},
+    {    -3,    -18}, {    -3,    -18}, {    -3,    -17}, {    -3,    -17},
+    {    -3,    -16}, {    -4,    -16}, {    -4,    -17}, {    -4,    -17},
+    {    -4,    -18}, {    -3,    -18}, {    -2,    -17}, {    -2,    -16},
+    {    -3,    -15}, {    -4,    -15}, {    -5,    -16}, {    -4,    -17},
+    {    -4,    -17}, {    -3,    -17}, {    -2,    -16}, {    -2,    -15},
+    {    -3,    -15}, {    -3,    -15}, {    -4,    -15}, {    -4,    -15},
+    {    -3,    -15}, {    -3,    -15}, {    -3,    -15}, {    -3,    -15},
+    {    -3,    -15}, {    -3,    -15}, {    -3,    -15}, {    -3,    -14},
+    {    -3,    -14}, {    -3,    -14}, {    -4,    -14}, {    -4,    -15},
+    {    -3,    -15}, {    -3,    -15}, {    -2,    -14}, {    -2,    -14},
+    {    -2,    -13}, {    -3,    -13}, {    -4,    -13}, {    -4,    -14},
+    {    -3,    -14}, {    -3,    -14}, {    -2,    -14}, {    -2,    -13},
+    {    -2,    -13}, {    -3,    -13}, {    -3,    -13}, {    -3,    -13},
+    {    -3,    -13}, {    -3,    -13}, {    -3,    -13}, {    -3,    -13},
+    {    -3,    -13}, {    -3,    -13}, {    -3,    -13}, {    -2,    -12},
+    {    -3,    -12}, {    -3,    -12}, {    -3,    -12}, {    -3,    -12},
+    {    -3,    -13}, {    -3,    -13}, {    -2,    -13}, {    -2,    -12},
+    {    -2,    -11}, {    -3,    -11}, {    -3,    -11}, {    -3,    -12},
+    {    -3,    -12}, {    -3,    -12}, {    -2,    -12}, {    -2,    -12},
+    {    -2,    -11}, {    -3,    -11}, {    -3,    -11}, {    -3,    -11},
+    {    -3,    -11}, {    -3,    -11}, {    -3,    -11}, {    -3,    -11},
+    {    -3,    -11}, {    -3,    -11}, {    -2,    -11}, {    -2,    -11},
+    {    -2,    -11}, {    -2,    -10}, {    -3,    -10}, {    -3,    -11},
+    {    -3,    -11}, {    -3,    -11}, {    -2,    -11}, {    -2,    -11},
+    {    -2,    -10}, {    -2,    -10}, {    -3,    -10}, {    -3,    -10},
+    {    -3,    -10}, {    -3,    -11}, {    -2,    -11}, {    -2,    -10},
+    {    -2,    -10}, {    -2,    -10}, {    -3,    -10}, {    -3,    -10},
+    {    -3,    -10}
+  },
+  { // wave 6
+    {   648,      0}, { -1608,    -14}, {   788,   -274}, {  -151,    -39},
+    {   190,  -3231}, {   -61,   8134}, {    99,  -3242}, {   -56,    -44},
+    {    85,   -314}, {   -63,    -24}, {    80,   -107}, {   -61,      3},
+    {    66,    -72}, {   -46,     27}, {    43,    -68}, {   -22,     41},
+    {    15,    -62}, {     4,     40}, {   -10,    -48}, {    24,     27},
+    {   -26,    -26}, {    32,      6}, {   -28,     -3}, {    28,    -14},
+    {   -19,     16}, {    14,    -26}, {    -3,     24}, {    -3,    -28},
+    {    12,     22}, {   -16,    -21}, {    22,     13}, {   -23,     -9},
+    {    25,      0}, {   -21,      4}, {    19,    -10}, {   -14,     12},
+    {    10,    -15}, {    -4,     14}, {     1,    -15}, {     3,     11},
+    {    -4,    -10}, {     7,      6}, {    -6,     -4}, {     7,      0},
+    {    -5,      1}, {     4,     -3}, {    -2,      2}, {     1,     -3},
+    {     1,      2}, {    -1,     -2}, {     2,      1}, {    -1,      0},
+    {     1,     -1}, {     0,      0}, {     0,      0}, {     1,     -1},
+    {    -1,      1}, {     1,     -2}, {     0,      3}, {     0,     -4},
+    {     1,      3}, {    -2,     -3}, {     4,      3}, {    -4,     -2},
+    {     5,      0}, {    -5,      0}, {     5,     -2}, {    -4,      3},
+    {     3,     -4}, {    -2,      4}, {     1,     -4}, {     1,      4},
+    {    -1,     -4}, {     2,      2}, {    -3,     -2}, {     3,      1},
+    {    -2,      0}, {     2,     -1}, {    -1,      2}, {     1,     -2},
+    {     0,      2}, {     0,     -2}, {     1,      1}, {    -1,     -1},
+    {     1,      0}, {    -1,      0}, {     1,      0}, {    -1,      0},
+    {     1,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     1,      1}, {    -1,     -1}, {     1,      1}, {    -1,     -1},
+    {     2,      0}, {    -2,      0}, {     2,      0}, {    -2,      1},
+    {     2,     -1}, {    -1,      2}, {     0,     -2}, {     0,      2},
+    {    -1,     -2}, {     1,      1}, {    -1,     -1}, {     2,      0},
+    {    -1,      0}, {     1,     -1}, {    -1,      1}, {     1,     -1},
+    {     0,      1}, {     0,     -1}, {     1,      1}, {    -1,     -1},
+    {     1,      1}, {    -1,      0}, {     1,      0}, {    -1,      0},
+    {     1,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     1,      0}, {     0,      0}, {     1,      0}, {    -1,      0},
+    {     1,     -1}, {    -1,      1}, {     0,     -1}, {     0,      1},
+    {     0,     -1}, {     1,      1}, {    -1,     -1}, {     1,      0},
+    {    -1,      0}, {     1,      0}, {    -1,      1}, {     1,     -1},
+    {     0,      1}, {     0,     -1}, {     0,      1}, {     0,     -1},
+    {     1,      1}, {    -1,      0}, {     1,      0}, {    -1,      0},
+    {     1,      0}, {    -1,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,     -1}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     1,      0}, {     0,      0}, {     1,      0},
+    {     0,      1}, {     0,     -1}, {     0,      1}, {     0,     -1},
+    {     0,      0}, {    -1,      0}, {     1,      0}, {    -1,      0},
+    {     1,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      1}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     1,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}
+  },
+  { // wave 7
+    {  1624,      0}, {  -724,     66}, {  -508,     72}, {  -261,    -41},
+    {    -9,   -386}, {   207,  -1061}, {   259,  -1918}, {    68,   5676},
+    {  -211,   1691}, {  -307,  -1652}, {  -152,   -766}, {    45,   -213},
+    {    80,    -58}, {   -10,    -71}, {   -60,    -74}, {   -19,    -53},
+    {    26,    -40}, {    15,    -29}, {   -15,    -11}, {   -17,     -8},
+    {    -1,    -20}, {     5,    -25}, {     0,    -10}, {    -3,      4},
+    {    -3,     -3}, {    -5,    -14}, {    -4,    -11}, {     2,     -2},
+    {     4,      0}, {    -3,     -4}, {    -7,     -5}, {    -2,     -4},
+    {     4,     -3}, {     2,     -3}, {    -4,      0}, {    -4,      0},
+    {     0,     -4}, {     1,     -5}, {     0,     -1}, {    -1,      2},
+    {    -1,     -1}, {    -1,     -4}, {    -1,     -3}, {     1,      0},
+    {     1,      1}, {    -1,     -1}, {    -3,     -2}, {     0,     -1},
+    {     2,     -1}, {     0,      0}, {    -2,      0}, {    -2,      0},
+    {     0,     -1}, {     0,     -2}, {     0,      0}, {    -1,      1},
+    {     0,      0}, {    -1,     -2}, {     0,     -1}, {     0,      0},
+    {     0,      0}, {    -1,      0}, {    -1,     -1}, {     0,      0},
+    {     1,      0}, {     0,      0}, {    -1,      0}, {    -1,      0},
+    {     0,     -1}, {     0,     -1}, {     0,      0}, {     0,      1},
+    {     0,      0}, {     0,     -1}, {     0,     -1}, {     0,      0},
+    {     0,      0}, {     0,      0}, {    -1,      0}, {     0,      0},
+    {     1,      0}, {     0,      0}, {    -1,      0}, {     0,      0},
+    {     0,      0}, {     0,     -1}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,     -1}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {    -1,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     1,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}, {     0,      0}, {     0,      0}, {     0,      0},
+    {     0,      0}
+  }
+};
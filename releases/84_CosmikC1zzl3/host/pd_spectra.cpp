@@ -0,0 +1,35 @@
+// pd_spectra — writes C1ZZL3_PDSpectra.cpp: the first PD_MIP_HARMONICS partials of each
+// wave in ../C1ZZL3_LUT.cpp, which the card turns into its band-limited mip tables at boot.
+//
+//   make spectra          regenerate ../C1ZZL3_PDSpectra.cpp after editing pdWaveLUT
+#include "pd_spectrum.h"
+
+#include <cstdio>
+
+int main()
+{
+    std::printf("// C1ZZL3_PDSpectra.cpp\n"
+                "//\n"
+                "// Generated by host/pd_spectra from pdWaveLUT in C1ZZL3_LUT.cpp: do not edit.\n"
+                "// Per wave, partials 0..%d as {cos, sin} in output units * %d (C1ZZL3_PDMip.h).\n"
+                "\n"
+                "#include \"C1ZZL3_PDMip.h\"\n"
+                "\n"
+                "const int16_t pdWaveSpectrum[PD_WAVE_COUNT][PD_MIP_HARMONICS + 1][2] = {\n",
+                PD_MIP_HARMONICS, 1 << PD_SPECTRUM_SHIFT);
+    for (int wave = 0; wave < PD_WAVE_COUNT; ++wave) {
+        std::printf("  { // wave %d\n", wave);
+        for (int h = 0; h <= PD_MIP_HARMONICS; ++h) {
+            const Partial p = analysePartial(wave, h);
+            if (h % 4 == 0)
+                std::printf("   ");
+            std::printf(" {%6d, %6d}%s", quantiseSpectrum(p.cosine), quantiseSpectrum(p.sine),
+                h == PD_MIP_HARMONICS ? "" : ",");
+            if (h % 4 == 3 || h == PD_MIP_HARMONICS)
+                std::printf("\n");
+        }
+        std::printf("  }%s\n", wave + 1 == PD_WAVE_COUNT ? "" : ",");
+    }
+    std::printf("};\n");
+    return 0;
+}
@@ -0,0 +1,34 @@
+// Partials of pdWaveLUT in double precision, shared by pd_spectra and pd_tables.
+#pragma once
+
+#include "../C1ZZL3_LUT.h"
+#include "../C1ZZL3_PDMip.h"
+
+#include <cmath>
+#include <cstdint>
+
+constexpr double Pi = 3.141592653589793238462643383279502884;
+
+struct Partial {
+    double cosine;
+    double sine;
+};
+
+// Partial h of wave w, h = 0 being DC, with table index i at phase i / 4096.
+inline Partial analysePartial(int wave, int harmonic)
+{
+    double c = 0, s = 0;
+    for (int i = 0; i < PD_WAVE_SIZE; ++i) {
+        const double t = 2.0 * Pi * harmonic * i / PD_WAVE_SIZE;
+        c += pdWaveLUT[wave][i] * std::cos(t);
+        s += pdWaveLUT[wave][i] * std::sin(t);
+    }
+    if (harmonic == 0)
+        return {c / PD_WAVE_SIZE, 0.0};
+    return {2.0 * c / PD_WAVE_SIZE, 2.0 * s / PD_WAVE_SIZE};
+}
+
+inline int16_t quantiseSpectrum(double value)
+{
+    return (int16_t)std::lround(value * (1 << PD_SPECTRUM_SHIFT));
+}
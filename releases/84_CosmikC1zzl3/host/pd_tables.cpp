@@ -0,0 +1,305 @@
+// pd_tables — checks C1ZZL3's band-limited PD mip tables and compares them with pdWaveLUT.
+//
+// Builds ../C1ZZL3_PDMip.h as the firmware does, from the checked-in
+// ../C1ZZL3_PDSpectra.cpp, next to the raw 4096-point tables in ../C1ZZL3_LUT.cpp:
+//
+//   spectra   C1ZZL3_PDSpectra.cpp still matches pdWaveLUT (else: make spectra)
+//   headroom  no wave can overflow buildPdMipTables()' 32-bit sums
+//   build     every level within 2 LSB of the same partials summed in double (the
+//             builder's sines and fade come from the card's 12-bit sine table)
+//   band      no level holds more above its partial limit than rounding leaves there
+//   alias     the oscillator's morph target read both ways at a spread of pitches: energy
+//             off the note's harmonics, in dB below the signal, over the whole band,
+//             below 16 kHz and below 8 kHz, from a 32768-point Blackman-Harris spectrum
+//   cost      ns per sample for both reads, best of five passes, and host TSC cycles.
+//             Host figures are only relative (x86, not a Cortex-M0+): compare the columns.
+//
+//   ./pd_tables          everything; exit status is non-zero on any failed check
+#include "pd_spectrum.h"
+
+#include <algorithm>
+#include <chrono>
+#include <complex>
+#include <cstdio>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC 1
+#else
+#define HAVE_TSC 0
+#endif
+
+namespace {
+
+constexpr double SampleRate = 48000.0;
+constexpr uint32_t FftSize = 32768;
+
+int16_t mipTables[PD_WAVE_COUNT][PD_MIP_SIZE];
+
+int checkSpectra()
+{
+    int bad = 0;
+    for (int wave = 0; wave < PD_WAVE_COUNT; ++wave) {
+        for (int h = 0; h <= PD_MIP_HARMONICS; ++h) {
+            const Partial p = analysePartial(wave, h);
+            if (quantiseSpectrum(p.cosine) != pdWaveSpectrum[wave][h][0] ||
+                quantiseSpectrum(p.sine) != pdWaveSpectrum[wave][h][1]) {
+                if (bad++ < 5)
+                    std::printf("  spectra: wave %d partial %d differs from pdWaveLUT\n", wave, h);
+            }
+        }
+    }
+    std::printf("spectra   %-6s %d waves x %d partials\n", bad ? "FAILED" : "ok", PD_WAVE_COUNT,
+        PD_MIP_HARMONICS + 1);
+    return bad;
+}
+
+int checkHeadroom()
+{
+    int bad = 0;
+    int64_t worst = 0;
+    for (int wave = 0; wave < PD_WAVE_COUNT; ++wave) {
+        int64_t bound = 0;
+        for (int h = 0; h <= PD_MIP_HARMONICS; ++h)
+            bound += (std::abs(pdWaveSpectrum[wave][h][0]) + std::abs(pdWaveSpectrum[wave][h][1])) * 2047
+                << (PD_MIP_SUM_SHIFT - PD_SPECTRUM_SHIFT);
+        worst = std::max(worst, bound);
+        if (bound + (2047 << PD_MIP_SUM_SHIFT) >= (int64_t)INT32_MAX)
+            bad++;
+    }
+    std::printf("headroom  %-6s worst sum bound %.1f%% of int32\n", bad ? "FAILED" : "ok",
+        100.0 * worst / INT32_MAX);
+    return bad;
+}
+
+double referenceSample(int wave, int level, int n)
+{
+    const PdMipLevel& mip = PdMipLevels[level];
+    const double t = (double)n / (1 << mip.sizeShift);
+    double sum = pdWaveSpectrum[wave][0][0];
+    for (int h = 1; h <= mip.harmonics; ++h) {
+        double taper = 1.0;
+        if (h > 1 && h * 2 > mip.harmonics)
+            taper = 0.5 * (1.0 + std::cos(Pi * (2 * h - mip.harmonics) / (mip.harmonics + 2)));
+        sum += taper * (pdWaveSpectrum[wave][h][0] * std::cos(2 * Pi * h * t) +
+            pdWaveSpectrum[wave][h][1] * std::sin(2 * Pi * h * t));
+    }
+    return sum / (1 << PD_SPECTRUM_SHIFT);
+}
+
+int checkBuild()
+{
+    int bad = 0;
+    double worst = 0;
+    int peak = 0;
+    for (int wave = 0; wave < PD_WAVE_COUNT; ++wave) {
+        for (int level = 0; level < PD_MIP_LEVELS; ++level) {
+            const PdMipLevel& mip = PdMipLevels[level];
+            for (int n = 0; n < (1 << mip.sizeShift); ++n) {
+                const int16_t built = mipTables[wave][mip.offset + n];
+                const double error = std::fabs(built - referenceSample(wave, level, n));
+                worst = std::max(worst, error);
+                peak = std::max(peak, std::abs((int)built));
+                if (error > 2.0 && bad++ < 5)
+                    std::printf("  build: wave %d level %d sample %d: %d, reference %.1f\n", wave, level,
+                        n, built, referenceSample(wave, level, n));
+            }
+        }
+    }
+    std::printf("build     %-6s %d bytes, worst error %.2f LSB, peak %d\n", bad ? "FAILED" : "ok",
+        (int)sizeof(mipTables), worst, peak);
+    return bad;
+}
+
+int checkBand()
+{
+    // Rounding each sample to whole output units leaves white noise of 1/12 LSB^2, which
+    // a size-point DFT shows as size/12 in every bin; anything much above that floor in
+    // the bins past the partial limit is a level holding partials it should not.
+    int bad = 0;
+    double worst = 0;
+    for (int wave = 0; wave < PD_WAVE_COUNT; ++wave) {
+        for (int level = 0; level < PD_MIP_LEVELS; ++level) {
+            const PdMipLevel& mip = PdMipLevels[level];
+            const int size = 1 << mip.sizeShift;
+            double outOfBand = 0;
+            for (int h = mip.harmonics + 1; h <= size / 2; ++h) {
+                std::complex<double> s = 0;
+                for (int n = 0; n < size; ++n)
+                    s += (double)mipTables[wave][mip.offset + n] * std::polar(1.0, -2 * Pi * h * n / size);
+                outOfBand += std::norm(s);
+            }
+            const double floor = (size / 2 - mip.harmonics) * size / 12.0;
+            const double ratio = outOfBand / floor;
+            worst = std::max(worst, ratio);
+            if (ratio > 4.0 && bad++ < 5)
+                std::printf("  band: wave %d level %d: %.1fx the rounding floor above %d partials\n", wave,
+                    level, ratio, (int)mip.harmonics);
+        }
+    }
+    std::printf("band      %-6s worst %.2fx the rounding floor above the partial limit\n", bad ? "FAILED" : "ok",
+        worst);
+    return bad;
+}
+
+// The two reads of oscCZ()'s morph target, without the PD blend around them.
+enum class Path { Raw, Mip };
+const char* const PathNames[] = {"raw", "mip"};
+
+struct Oscillator {
+    Path path = Path::Raw;
+    int wave = 0;
+    uint32_t increment = 0;
+    uint32_t phase = 0;
+
+    int32_t next()
+    {
+        phase += increment;
+        if (path == Path::Raw)
+            return pdWaveLUT[wave & 7][(phase >> 20) & 4095];
+        return readPdMip(mipTables[wave & 7], phase, pdMipLevelFor(increment));
+    }
+};
+
+void fft(std::vector<std::complex<double>>& a)
+{
+    const size_t n = a.size();
+    for (size_t i = 1, j = 0; i < n; ++i) {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+        j ^= bit;
+        if (i < j)
+            std::swap(a[i], a[j]);
+    }
+    for (size_t len = 2; len <= n; len <<= 1) {
+        const std::complex<double> w = std::polar(1.0, -2.0 * Pi / (double)len);
+        for (size_t i = 0; i < n; i += len) {
+            std::complex<double> wk = 1.0;
+            for (size_t k = 0; k < len / 2; ++k) {
+                std::complex<double> u = a[i + k];
+                std::complex<double> v = a[i + k + len / 2] * wk;
+                a[i + k] = u + v;
+                a[i + k + len / 2] = u - v;
+                wk *= w;
+            }
+        }
+    }
+}
+
+struct Alias {
+    double wholeDb;
+    double audibleDb;
+    double lowDb;
+};
+
+Alias measure(Oscillator osc)
+{
+    std::vector<std::complex<double>> x(FftSize);
+    for (uint32_t i = 0; i < FftSize; ++i) {
+        const double t = 2.0 * Pi * i / FftSize;
+        const double w = 0.35875 - 0.48829 * std::cos(t) + 0.14128 * std::cos(2 * t) -
+            0.01168 * std::cos(3 * t);
+        x[i] = osc.next() * w;
+    }
+    fft(x);
+
+    const double f0 = osc.increment * SampleRate / 4294967296.0;
+    const double binHz = SampleRate / FftSize;
+    double signal = 0, alias = 0, aliasAudible = 0, aliasLow = 0;
+    for (uint32_t k = 1; k <= FftSize / 2; ++k) {
+        const double f = k * binHz;
+        const double p = std::norm(x[k]);
+        const double nearest = std::round(f / f0) * f0;
+        if (nearest > 0 && std::fabs(f - nearest) <= 6 * binHz) {
+            signal += p;
+        } else if (f > 6 * binHz) {
+            alias += p;
+            if (f < 16000)
+                aliasAudible += p;
+            if (f < 8000)
+                aliasLow += p;
+        }
+    }
+    return {10 * std::log10(alias / signal + 1e-30), 10 * std::log10(aliasAudible / signal + 1e-30),
+        10 * std::log10(aliasLow / signal + 1e-30)};
+}
+
+struct Cost {
+    double ns;
+    double cycles;
+};
+
+Cost cost(Oscillator osc)
+{
+    constexpr uint32_t Samples = 1u << 20;
+    double best = 1e30, bestCycles = 1e30;
+    volatile int32_t sink = 0;
+    for (int pass = 0; pass < 5; ++pass) {
+        int32_t acc = 0;
+        const auto t0 = std::chrono::steady_clock::now();
+#if HAVE_TSC
+        const uint64_t c0 = __rdtsc();
+#endif
+        for (uint32_t i = 0; i < Samples; ++i)
+            acc += osc.next();
+#if HAVE_TSC
+        bestCycles = std::min(bestCycles, (double)(__rdtsc() - c0) / Samples);
+#endif
+        const auto t1 = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::nano>(t1 - t0).count() / Samples);
+        sink = acc;
+    }
+    (void)sink;
+    return {best, HAVE_TSC ? bestCycles : 0.0};
+}
+
+void report()
+{
+    // C2 (the firmware's C2PhaseIncrement) and up in octaves, to two octaves short of the top.
+    const uint32_t c2 = 5852465u;
+    const int octaves[] = {0, 2, 4, 5};
+
+    std::printf("\n%-5s %-8s %5s %-5s %9s %9s %9s %7s %7s\n", "wave", "note", "level", "path",
+        "alias dB", "<16k dB", "<8k dB", "ns", "cycles");
+    // The four waves with the most energy high up; 3 is a pure second partial.
+    for (int wave : {0, 1, 2, 4}) {
+        for (int octave : octaves) {
+            for (Path path : {Path::Raw, Path::Mip}) {
+                Oscillator osc;
+                osc.path = path;
+                osc.wave = wave;
+                osc.increment = c2 << octave;
+                const Alias a = measure(osc);
+                const Cost c = cost(osc);
+                char note[32];
+                std::snprintf(note, sizeof note, "C%d %4.0f", 2 + octave,
+                    osc.increment * SampleRate / 4294967296.0);
+                std::printf("%-5d %-8s %5u %-5s %9.1f %9.1f %9.1f %7.2f %7.1f\n", wave, note,
+                    pdMipLevelFor(osc.increment), PathNames[(int)path], a.wholeDb, a.audibleDb, a.lowDb,
+                    c.ns, c.cycles);
+            }
+        }
+    }
+
+    const auto t0 = std::chrono::steady_clock::now();
+    buildPdMipTables(mipTables);
+    const auto t1 = std::chrono::steady_clock::now();
+    std::printf("\nbuildPdMipTables(): %.1f ms here\n",
+        std::chrono::duration<double, std::milli>(t1 - t0).count());
+}
+
+} // namespace
+
+int main()
+{
+    buildPdMipTables(mipTables);
+    int bad = 0;
+    bad += checkSpectra();
+    bad += checkHeadroom();
+    bad += checkBuild();
+    bad += checkBand();
+    report();
+    return bad ? 1 : 0;
+}
@@ -1,4 +1,5 @@
 #include "computercard.h"
+#include "Fr330hfr33_DSP.h"
 #include "Fr330hfr33_LUT.h"
 
 #include "hardware/clocks.h"
@@ -10,7 +11,6 @@
 #include "tusb.h"
 #include "usb_midi_host.h"
 
-#include <array>
 #include <stdint.h>
 
 namespace {
@@ -71,18 +71,6 @@ struct PersistentState {
 static_assert(sizeof(PersistentState) <= FLASH_SECTOR_SIZE,
     "Persistent state must fit in one flash sector");
 
-constexpr std::array<uint16_t, 577> makeReciprocalQ15Table()
-{
-    std::array<uint16_t, 577> table = {};
-    for (uint32_t i = 0; i < table.size(); ++i) {
-        uint32_t denominatorQ15 = 32768u + i * 512u;
-        table[i] = (uint16_t)((1u << 30) / denominatorQ15);
-    }
-    return table;
-}
-
-constexpr auto ReciprocalQ15Table = makeReciprocalQ15Table();
-
 // Pitch smoothing coefficient by sixteenth of Y travel. The values are
 // intentionally perceptual rather than linear: the lower end gets out of the
 // way quickly, noon is an obvious acid slide, and the top end becomes long.
@@ -144,15 +132,6 @@ struct SharedSnapshot {
 SharedSnapshot<HardwareSnapshot> hardwareShared;
 SharedSnapshot<AudioParameters> audioShared;
 
-inline int32_t clamp32(int32_t value, int32_t low, int32_t high)
-{
-    if (value < low)
-        return low;
-    if (value > high)
-        return high;
-    return value;
-}
-
 template <typename T>
 void publishSnapshot(SharedSnapshot<T> &shared, const T &value)
 {
@@ -1053,15 +1032,8 @@ public:
             smoothedIncrement - pitchDroop +
             (uint32_t)(((pitchDroop >> 15) * supplyQ15));
         phase += poweredIncrement;
-
-        uint32_t tableIndex = phase >> 26;
-        uint32_t fraction = (phase >> 14) & 0x0FFFu;
-        int32_t a = Fr330hfr33SawLut[tableIndex];
-        int32_t b = Fr330hfr33SawLut[tableIndex + 1u];
-        int32_t saw = a + (((b - a) * (int32_t)fraction) >> 12);
-        int32_t oscillator = parameters.waveform
-            ? ((phase & 0x80000000u) ? 2047 : -2048)
-            : saw;
+        int32_t oscillator = bandLimitedOscillator(
+            phase, poweredIncrement, parameters.waveform);
 
         int32_t dynamicCutoff = parameters.cutoffQ15 +
             ((filterEnvelope * parameters.filterEnvelopeQ15) >> 15);
@@ -1079,7 +1051,7 @@ public:
 
         int32_t poweredResonance =
             (parameters.resonanceQ12 * supplyAuthority) >> 15;
-        int32_t filtered = processDiodeLadder(oscillator, dynamicCutoff,
+        int32_t filtered = ladder.process(oscillator, dynamicCutoff,
             poweredResonance, parameters.filterPoles);
         int32_t resonanceMakeupQ15 =
             32768 + poweredResonance;
@@ -1169,63 +1141,6 @@ private:
         }
     }
 
-    int32_t processDiodeLadder(int32_t input, int32_t cutoffQ15,
-        int32_t resonanceQ12, uint8_t poles)
-    {
-        // Three or four trapezoidal-integrator one-poles form a diode-style
-        // ladder. Each mode solves its own global feedback path without
-        // iteration or division in the ISR.
-        uint32_t feedbackStages = poles == 3 ? 3u : 4u;
-        int32_t oneMinusG = 32768 - cutoffQ15;
-        int32_t constant = (oneMinusG * ladder[0]) >> 15;
-        constant = ((cutoffQ15 * constant) >> 15) +
-            ((oneMinusG * ladder[1]) >> 15);
-        constant = ((cutoffQ15 * constant) >> 15) +
-            ((oneMinusG * ladder[2]) >> 15);
-        if (feedbackStages == 4) {
-            constant = ((cutoffQ15 * constant) >> 15) +
-                ((oneMinusG * ladder[3]) >> 15);
-        }
-
-        int32_t g2 = (cutoffQ15 * cutoffQ15) >> 15;
-        int32_t gN = feedbackStages == 3
-            ? (g2 * cutoffQ15) >> 15
-            : (g2 * g2) >> 15;
-        int32_t denominatorQ15 =
-            32768 + ((resonanceQ12 * gN) >> 12);
-        int32_t reciprocalQ15 = reciprocalQ15For(denominatorQ15);
-        int32_t driven = input -
-            ((resonanceQ12 * constant) >> 12);
-        driven = (driven * reciprocalQ15) >> 15;
-        driven = diodePair(driveInput(driven));
-
-        int32_t selectedOutput = 0;
-        int32_t fourthPoleOutput = 0;
-        for (uint32_t i = 0; i < 4; ++i) {
-            int32_t delta = driven - ladder[i];
-            int32_t integrator = (delta * cutoffQ15) >> 15;
-            int32_t output = integrator + ladder[i];
-            // Paired-diode conduction has a broad knee rather than the early,
-            // flat rail used by the previous transistor-like stage clip. This
-            // leaves enough loop gain for a healthy sine at high resonance.
-            ladder[i] = diodePair(output + integrator);
-            driven = output;
-            if (i + 1u == feedbackStages)
-                selectedOutput = output;
-            if (i == 3)
-                fourthPoleOutput = output;
-        }
-
-        if (feedbackStages == 3) {
-            // Keep the true third-pole output dominant, then emphasize the
-            // spectrum that the tracked fourth pole would have removed. The
-            // asymptotic response remains third order, but the audible
-            // contrast with 24 dB mode is much clearer on bass waveforms.
-            selectedOutput += (selectedOutput - fourthPoleOutput) >> 1;
-        }
-        return diodePair(selectedOutput);
-    }
-
     int32_t processRawAllpass(int32_t input, int32_t cutoffQ15,
         uint8_t poles)
     {
@@ -1326,42 +1241,6 @@ private:
         return input;
     }
 
-    static int32_t reciprocalQ15For(int32_t denominatorQ15)
-    {
-        denominatorQ15 = clamp32(denominatorQ15, 32768, 327680);
-        uint32_t offset = (uint32_t)(denominatorQ15 - 32768);
-        uint32_t index = offset >> 9;
-        uint32_t fraction = offset & 0x1FFu;
-        if (index >= 576u)
-            return ReciprocalQ15Table[576];
-        int32_t a = ReciprocalQ15Table[index];
-        int32_t b = ReciprocalQ15Table[index + 1u];
-        return a + (((b - a) * (int32_t)fraction) >> 9);
-    }
-
-    static int32_t driveInput(int32_t value)
-    {
-        // A small pre-drive keeps the voice lively without making high cutoff,
-        // resonance, and envelope settings fizz against every ladder stage.
-        return value + (value >> 3);
-    }
-
-    static int32_t diodePair(int32_t value)
-    {
-        // Cheap piecewise approximation of an anti-parallel diode pair. It is
-        // linear around zero, bends progressively, and reaches its rail much
-        // more gradually than a transistor-style clipper.
-        bool negative = value < 0;
-        int32_t magnitude = negative ? -value : value;
-        if (magnitude > 3072)
-            magnitude = 2688 + ((magnitude - 3072) >> 3);
-        else if (magnitude > 1536)
-            magnitude = 1536 + (((magnitude - 1536) * 3) >> 2);
-        if (magnitude > 3840)
-            magnitude = 3840;
-        return negative ? -magnitude : magnitude;
-    }
-
     AudioParameters parameters = {
         midiNoteToPhaseIncrement(BaseMidiNote), 0, -2000,
         4096, 0, 128, 32767, 12000, 768, 1792, 960, 9600, 192, 0,
@@ -1378,7 +1257,7 @@ private:
     int32_t accentChargeQ15 = 0;
     int32_t accentSweepQ15 = 0;
     int32_t supplyQ15 = 0;
-    int32_t ladder[4] = {};
+    DiodeLadder ladder;
     int32_t rawAllpass[2] = {};
     int32_t rawFractionalAllpass = 0;
     int32_t ratToneState = 0;
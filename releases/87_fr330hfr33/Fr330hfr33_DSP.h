@@ -0,0 +1,184 @@
+#pragma once
+
+#include "Fr330hfr33_LUT.h"
+
+#include <array>
+#include <stdint.h>
+
+// Audio-rate building blocks of the voice: the band-limited oscillator and
+// the diode ladder. Nothing here touches the card or the SDK, so the host
+// harness in host/ builds it unchanged.
+
+inline int32_t clamp32(int32_t value, int32_t low, int32_t high)
+{
+    if (value < low)
+        return low;
+    if (value > high)
+        return high;
+    return value;
+}
+
+constexpr std::array<uint16_t, 577> makeReciprocalQ15Table()
+{
+    std::array<uint16_t, 577> table = {};
+    for (uint32_t i = 0; i < table.size(); ++i) {
+        uint32_t denominatorQ15 = 32768u + i * 512u;
+        table[i] = (uint16_t)((1u << 30) / denominatorQ15);
+    }
+    return table;
+}
+
+constexpr auto ReciprocalQ15Table = makeReciprocalQ15Table();
+
+inline int32_t reciprocalQ15For(int32_t denominatorQ15)
+{
+    denominatorQ15 = clamp32(denominatorQ15, 32768, 327680);
+    uint32_t offset = (uint32_t)(denominatorQ15 - 32768);
+    uint32_t index = offset >> 9;
+    uint32_t fraction = offset & 0x1FFu;
+    if (index >= 576u)
+        return ReciprocalQ15Table[576];
+    int32_t a = ReciprocalQ15Table[index];
+    int32_t b = ReciprocalQ15Table[index + 1u];
+    return a + (((b - a) * (int32_t)fraction) >> 9);
+}
+
+inline int32_t driveInput(int32_t value)
+{
+    // A small pre-drive keeps the voice lively without making high cutoff,
+    // resonance, and envelope settings fizz against every ladder stage.
+    return value + (value >> 3);
+}
+
+inline int32_t diodePair(int32_t value)
+{
+    // Cheap piecewise approximation of an anti-parallel diode pair. It is
+    // linear around zero, bends progressively, and reaches its rail much
+    // more gradually than a transistor-style clipper.
+    bool negative = value < 0;
+    int32_t magnitude = negative ? -value : value;
+    if (magnitude > 3072)
+        magnitude = 2688 + ((magnitude - 3072) >> 3);
+    else if (magnitude > 1536)
+        magnitude = 1536 + (((magnitude - 1536) * 3) >> 2);
+    if (magnitude > 3840)
+        magnitude = 3840;
+    return negative ? -magnitude : magnitude;
+}
+
+class DiodeLadder {
+public:
+    int32_t process(int32_t input, int32_t cutoffQ15,
+        int32_t resonanceQ12, uint8_t poles)
+    {
+        // Three or four trapezoidal-integrator one-poles form a diode-style
+        // ladder. Each mode solves its own global feedback path without
+        // iteration or division in the ISR.
+        uint32_t feedbackStages = poles == 3 ? 3u : 4u;
+        int32_t oneMinusG = 32768 - cutoffQ15;
+        int32_t constant = (oneMinusG * stage[0]) >> 15;
+        constant = ((cutoffQ15 * constant) >> 15) +
+            ((oneMinusG * stage[1]) >> 15);
+        constant = ((cutoffQ15 * constant) >> 15) +
+            ((oneMinusG * stage[2]) >> 15);
+        if (feedbackStages == 4) {
+            constant = ((cutoffQ15 * constant) >> 15) +
+                ((oneMinusG * stage[3]) >> 15);
+        }
+
+        int32_t g2 = (cutoffQ15 * cutoffQ15) >> 15;
+        int32_t gN = feedbackStages == 3
+            ? (g2 * cutoffQ15) >> 15
+            : (g2 * g2) >> 15;
+        int32_t denominatorQ15 =
+            32768 + ((resonanceQ12 * gN) >> 12);
+        int32_t reciprocalQ15 = reciprocalQ15For(denominatorQ15);
+        int32_t driven = input -
+            ((resonanceQ12 * constant) >> 12);
+        driven = (driven * reciprocalQ15) >> 15;
+        driven = diodePair(driveInput(driven));
+
+        int32_t selectedOutput = 0;
+        int32_t fourthPoleOutput = 0;
+        for (uint32_t i = 0; i < 4; ++i) {
+            int32_t delta = driven - stage[i];
+            int32_t integrator = (delta * cutoffQ15) >> 15;
+            int32_t output = integrator + stage[i];
+            // Paired-diode conduction has a broad knee rather than the early,
+            // flat rail used by the previous transistor-like stage clip. This
+            // leaves enough loop gain for a healthy sine at high resonance.
+            stage[i] = diodePair(output + integrator);
+            driven = output;
+            if (i + 1u == feedbackStages)
+                selectedOutput = output;
+            if (i == 3)
+                fourthPoleOutput = output;
+        }
+
+        if (feedbackStages == 3) {
+            // Keep the true third-pole output dominant, then emphasize the
+            // spectrum that the tracked fourth pole would have removed. The
+            // asymptotic response remains third order, but the audible
+            // contrast with 24 dB mode is much clearer on bass waveforms.
+            selectedOutput += (selectedOutput - fourthPoleOutput) >> 1;
+        }
+        return diodePair(selectedOutput);
+    }
+
+private:
+    int32_t stage[4] = {};
+};
+
+// distance / increment in Q15 for distance <= increment, through the
+// reciprocal table: the increment is normalised into [1, 2) first.
+inline int32_t phaseFractionQ15(uint32_t distance, uint32_t increment)
+{
+    uint32_t shift = (uint32_t)__builtin_clz(increment);
+    int32_t mantissaQ15 = (int32_t)((increment << shift) >> 16);
+    int32_t numerator = (int32_t)((distance << shift) >> 16);
+    int32_t fraction = (numerator * reciprocalQ15For(mantissaQ15)) >> 15;
+    return fraction > 32767 ? 32767 : fraction;
+}
+
+// Two-sample polynomial band-limited step residual for a falling edge at
+// phase zero, in Q15: -(1 - t/dt)^2 just after the edge, (1 - t/dt)^2 just
+// before it, zero elsewhere. dt is the phase increment per sample.
+inline int32_t polyBlepQ15(uint32_t phase, uint32_t increment)
+{
+    if (phase < increment) {
+        int32_t remaining = 32768 - phaseFractionQ15(phase, increment);
+        return -((remaining * remaining) >> 15);
+    }
+    uint32_t untilWrap = 0u - phase;
+    if (untilWrap < increment) {
+        int32_t remaining = 32768 - phaseFractionQ15(untilWrap, increment);
+        return (remaining * remaining) >> 15;
+    }
+    return 0;
+}
+
+inline int32_t naiveOscillator(uint32_t phase, uint8_t waveform)
+{
+    if (waveform)
+        return (phase & 0x80000000u) ? 2047 : -2048;
+    uint32_t tableIndex = phase >> 26;
+    uint32_t fraction = (phase >> 14) & 0x0FFFu;
+    int32_t a = Fr330hfr33SawLut[tableIndex];
+    int32_t b = Fr330hfr33SawLut[tableIndex + 1u];
+    return a + (((b - a) * (int32_t)fraction) >> 12);
+}
+
+// The table saw or the square with PolyBLEP at each edge. Both jump by the
+// full 12-bit range, so the residual is scaled by half of it (2048, >> 4).
+// Away from an edge this costs two or four compares over the naive wave.
+inline int32_t bandLimitedOscillator(uint32_t phase, uint32_t increment,
+    uint8_t waveform)
+{
+    int32_t value = naiveOscillator(phase, waveform);
+    if (increment == 0)
+        return value;
+    value -= polyBlepQ15(phase, increment) >> 4;
+    if (waveform)
+        value += polyBlepQ15(phase ^ 0x80000000u, increment) >> 4;
+    return value;
+}
@@ -95,6 +95,9 @@ protected:
 	/// Callback, called once per sample at 48kHz
 	virtual void ProcessSample() = 0;
 
+	/// Optional background loop for USB tasks, MIDI RX, etc. Called from AudioWorker
+	virtual void BackgroundLoop() {}
+
 
 
 
@@ -622,8 +625,8 @@ void __not_in_flash_func(ComputerCard::AudioWorker)()
 			irq_remove_handler(PWM_IRQ_WRAP, ComputerCard::OnCVPWMWrap);
 			break;
 		}
-		   
-
+		// Run background tasks (USB MIDI, MIDI RX, etc.) between ISR callbacks
+		if (thisptr) thisptr->BackgroundLoop();
 	}
 }
 
@@ -0,0 +1,257 @@
+// clipbank.h — OffAir's clip audio: an IMA ADPCM bank in flash, streamed into SRAM rings
+//
+// convert_clips.py packs the Station, interference and Insta-ference clips into one
+// bank and writes it as offair_clips.uf2, which loads at the end of flash, apart from
+// the firmware (the last 256 bytes of flash hold {u32 bank address, u32 bank count},
+// as in the sample_upload example). ADPCM is 4 bits a sample: a third of the old 12-bit
+// packed Stations, half of the 8-bit interference. Clips ADPCM codes badly (broadband
+// noise, clicks) go in as 8-bit PCM instead. A small bank built into the firmware
+// (fallback_clips.h) stands in when there is no offair_clips.uf2.
+//
+// Each playing clip has a ClipStream. The background loop on the audio core decodes
+// ahead into the stream's ring in SRAM between interrupts; the audio interrupt only pops
+// samples, so it never reads flash.
+//
+// Bank format (little-endian; offsets from the start of the bank):
+//   header  16 bytes: u32 magic 'OACB', u16 version (2), u16 clip count,
+//                     u32 bank size, u16 samples per block, u16 0
+//   clips   count x 16 bytes: u32 data offset, u32 samples, u32 sample rate,
+//                     u8 kind (0 Station, 1 interference, 2 Insta-ference),
+//                     u8 coding (0 IMA ADPCM, 1 8-bit PCM), u8 0[2]
+//   data    each clip is ceil(samples / block) blocks.
+//           ADPCM: 4 + block/2 bytes — i16 predictor and u8 step index before the
+//           block's first sample, u8 0, then one 4-bit code per sample, low nibble first.
+//           8-bit PCM: block bytes, one signed sample each (the top 8 of 16 bits).
+// Every ADPCM block restarts the decoder from its header, so a clip can loop or start
+// at any block without decoding what came before. Version 1 banks are all ADPCM (the
+// coding byte was 0) and load unchanged.
+
+#pragma once
+#include <stdint.h>
+
+// ---------------------------------------------------------------------------
+// IMA ADPCM
+// ---------------------------------------------------------------------------
+
+static const int16_t kImaStep[89] = {
+        7,     8,     9,    10,    11,    12,    13,    14,    16,    17,
+       19,    21,    23,    25,    28,    31,    34,    37,    41,    45,
+       50,    55,    60,    66,    73,    80,    88,    97,   107,   118,
+      130,   143,   157,   173,   190,   209,   230,   253,   279,   307,
+      337,   371,   408,   449,   494,   544,   598,   658,   724,   796,
+      876,   963,  1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+     2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,
+     5894,  6484,  7132,  7845,  8630,  9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767,
+};
+
+static const int8_t kImaIndex[16] = { -1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8 };
+
+struct ImaState {
+    int32_t pred  = 0;
+    int32_t index = 0;
+};
+
+static inline int32_t __not_in_flash_func(imaDecode)(ImaState& s, uint32_t code)
+{
+    int32_t step = kImaStep[s.index];
+    int32_t diff = step >> 3;
+    if (code & 4) diff += step;
+    if (code & 2) diff += step >> 1;
+    if (code & 1) diff += step >> 2;
+    s.pred += (code & 8) ? -diff : diff;
+    if (s.pred >  32767) s.pred =  32767;
+    if (s.pred < -32768) s.pred = -32768;
+    s.index += kImaIndex[code];
+    if (s.index < 0)  s.index = 0;
+    if (s.index > 88) s.index = 88;
+    return s.pred;
+}
+
+// ---------------------------------------------------------------------------
+// ClipBank — the bank image, read in place
+// ---------------------------------------------------------------------------
+
+class ClipBank
+{
+public:
+    static constexpr uint32_t kMagic    = 0x4243414F;  // "OACB"
+    static constexpr uint16_t kVersion  = 2;
+    static constexpr int      kMaxClips = 64;
+
+    enum Kind : uint8_t { Station = 0, Interference = 1, OneShot = 2, kNumKinds = 3 };
+    enum Coding : uint8_t { Adpcm = 0, Pcm8 = 1, kNumCodings = 2 };
+
+    // Check the image and use it; false (and an empty bank) if it isn't a clip bank.
+    bool load(const uint8_t* image, uint32_t maxSize)
+    {
+        base = nullptr;
+        for (int k = 0; k < kNumKinds; k++) numOfKind[k] = 0;
+        if (!image) return false;
+        const Header* h = (const Header*)image;
+        if (h->magic != kMagic || h->version < 1 || h->version > kVersion) return false;
+        if (h->size > maxSize || h->clipCount > kMaxClips) return false;
+        if (h->blockSamples < 2 || (h->blockSamples & 1)) return false;
+        if (sizeof(Header) + sizeof(Entry) * h->clipCount > h->size) return false;
+
+        const Entry* e = (const Entry*)(image + sizeof(Header));
+        for (int c = 0; c < h->clipCount; c++) {
+            uint32_t blocks = (e[c].samples + h->blockSamples - 1) / h->blockSamples;
+            if (e[c].samples == 0 || e[c].kind >= kNumKinds || e[c].coding >= kNumCodings
+                || e[c].dataOffset > h->size
+                || blocks * bytesPerBlock(h->blockSamples, (Coding)e[c].coding) > h->size - e[c].dataOffset)
+                return false;
+        }
+        for (int c = 0; c < h->clipCount; c++)
+            byKind[e[c].kind][numOfKind[e[c].kind]++] = (uint8_t)c;
+
+        base    = image;
+        hdr     = h;
+        entries = e;
+        return true;
+    }
+
+    bool     valid() const        { return base != nullptr; }
+    int      count(Kind k) const  { return numOfKind[k]; }
+    int      clip(Kind k, int i) const { return byKind[k][i]; }   // i < count(k)
+    uint32_t samples(int c) const { return entries[c].samples; }
+    uint32_t sampleRate(int c) const { return entries[c].sampleRate; }
+    Coding   coding(int c) const  { return (Coding)entries[c].coding; }
+    uint32_t blockSamples() const { return hdr->blockSamples; }
+    uint32_t size() const         { return base ? hdr->size : 0; }
+
+    uint32_t blockBytes(int c) const { return bytesPerBlock(hdr->blockSamples, coding(c)); }
+
+    const uint8_t* block(int c, uint32_t b) const
+    {
+        return base + entries[c].dataOffset + b * blockBytes(c);
+    }
+
+private:
+    static uint32_t bytesPerBlock(uint32_t blockSamples, Coding coding)
+    {
+        return coding == Pcm8 ? blockSamples : 4 + blockSamples / 2;
+    }
+
+    struct Header {
+        uint32_t magic;
+        uint16_t version, clipCount;
+        uint32_t size;
+        uint16_t blockSamples, reserved;
+    };
+    struct Entry {
+        uint32_t dataOffset, samples, sampleRate;
+        uint8_t  kind, coding, reserved[2];
+    };
+    static_assert(sizeof(Header) == 16 && sizeof(Entry) == 16, "bank layout");
+
+    const uint8_t* base    = nullptr;
+    const Header*  hdr     = nullptr;
+    const Entry*   entries = nullptr;
+    uint8_t byKind[kNumKinds][kMaxClips] = {};
+    int     numOfKind[kNumKinds] = {};
+};
+
+// ---------------------------------------------------------------------------
+// ClipStream — one playing clip: the audio interrupt asks for a clip, the background
+// loop decodes it into the ring, the interrupt pops samples. Single producer, single
+// consumer; the barriers also keep it safe with the two on different cores.
+// ---------------------------------------------------------------------------
+
+class ClipStream
+{
+public:
+    static constexpr uint32_t kRing = 512;   // samples (power of two): ~45ms at 11025Hz
+
+    // --- Audio interrupt ---
+
+    // Start clip c (or stop, if c < 0) from the block holding sample `start`. Samples
+    // from the old clip are dropped; pop() returns nothing until fill() has switched.
+    void play(int32_t c, uint32_t start, bool loop)
+    {
+        cmdClip  = c;
+        cmdStart = start;
+        cmdLoop  = loop;
+        __dmb();                    // command visible before its sequence number
+        cmdSeq   = cmdSeq + 1;
+    }
+
+    bool pop(int32_t& s)
+    {
+        if (ackSeq != cmdSeq) return false;
+        uint32_t t = tail;
+        if (head == t) return false;
+        __dmb();                    // read the sample after seeing the head that published it
+        s = ring[t & (kRing - 1)];
+        __dmb();
+        tail = t + 1;
+        return true;
+    }
+
+    // --- Background loop ---
+
+    // Take any new command, then decode until the ring is full (or the clip ends).
+    void __not_in_flash_func(fill)(const ClipBank& bank)
+    {
+        uint32_t seq = cmdSeq;
+        if (seq != ackSeq) {
+            __dmb();
+            clip = cmdClip;
+            loop = cmdLoop;
+            if (clip >= 0) {
+                uint32_t start = cmdStart < bank.samples(clip) ? cmdStart : 0;
+                pos = start - start % bank.blockSamples();
+            }
+            head = tail;            // the audio core isn't popping until we ack
+            __dmb();
+            ackSeq = seq;
+        }
+        if (clip < 0) return;
+
+        const uint32_t len = bank.samples(clip);
+        const uint32_t blockLen = bank.blockSamples();
+        const bool pcm = bank.coding(clip) == ClipBank::Pcm8;
+        uint32_t h = head;
+        uint32_t space = kRing - (h - tail);
+        while (space--) {
+            if (pos >= len) {
+                if (!loop) { clip = -1; break; }
+                pos = 0;
+            }
+            uint32_t off = pos % blockLen;
+            const uint8_t* b = bank.block(clip, pos / blockLen);
+            int32_t x;
+            if (pcm) {
+                x = (int8_t)b[off] * 256;
+            } else {
+                if (off == 0) {
+                    st.pred  = (int16_t)(b[0] | (b[1] << 8));
+                    st.index = b[2] > 88 ? 88 : b[2];
+                }
+                uint32_t code = b[4 + (off >> 1)];
+                code = (off & 1) ? (code >> 4) : (code & 0xF);
+                x = imaDecode(st, code);
+            }
+            ring[h & (kRing - 1)] = (int16_t)x;
+            h++;
+            pos++;
+        }
+        __dmb();                    // samples visible before the new head
+        head = h;
+    }
+
+private:
+    int16_t ring[kRing] = {};
+    volatile uint32_t head = 0, tail = 0;      // written only by fill() / pop()
+
+    volatile uint32_t cmdSeq = 0, ackSeq = 0;  // play() / fill()
+    volatile int32_t  cmdClip  = -1;
+    volatile uint32_t cmdStart = 0;
+    volatile bool     cmdLoop  = false;
+
+    // Decoder (fill() only)
+    int32_t  clip = -1;
+    bool     loop = false;
+    uint32_t pos  = 0;
+    ImaState st;
+};
@@ -1,9 +1,11 @@
 """
-convert_clips.py — bake the OffAir radio audio into clips.h
+convert_clips.py — pack the OffAir radio audio into an ADPCM clip bank
 
-OffAir's audio (Stations, looping interference, Insta-ference one-shots) is compiled
-into clips.h as C arrays. This script generates that header from your own source
-audio files. The source audio is NOT shipped in the repo — supply your own.
+OffAir's audio (Stations, looping interference, Insta-ference one-shots) lives in a
+clip bank at the end of flash, uploaded separately from the firmware as
+offair_clips.uf2. This script builds that bank from your own source audio files. The
+source audio is NOT shipped in the repo — supply your own (or repack the audio baked
+into the old clips.h with --from-header, below).
 
 --------------------------------------------------------------------------------
 USAGE
@@ -19,71 +21,109 @@ USAGE
 3. Point the script at your files (see the settings just below):
      - FOLDER          : directory with the Station + interference source files
      - CLIPS table     : one row per Station/interference file
-                         (filename, start_sec, max_sec, var_name, description, sr, bits)
-                         Keep 2 Station + 6 interference rows unless you also change
-                         the stream counts in main.cpp.
-     - LOOP_MAX_SEC    : caps interference loop length (frees flash)
+                         (filename, start_sec, max_sec, name, description, sr, kind)
+                         The first 2 Station rows are Station 1 and 2; any number of
+                         interference rows (3 are on the dial at a time).
+     - LOOP_MAX_SEC    : caps interference loop length
      - MAX_BCAST_SEC   : caps Station length
      - ONESHOT_FOLDER  : a folder of Insta-ference files — ALL files in it are
                          auto-discovered (any count). ONESHOT_MAX_SEC caps each.
 
 4. Run from this directory:         python convert_clips.py
-   It rewrites clips.h and prints per-clip sizes plus the total flash budget
-   (warns if you exceed ~2 MB — trim lengths or drop Insta-ference if so).
+   It writes offair_clips.uf2 and prints per-clip sizes plus the flash budget (it
+   stops if the bank won't fit beside the firmware).
 
-Then rebuild the firmware (Pico SDK / CMake / Ninja) and flash the new offair.uf2.
+   Without the source audio, the clips baked into the old firmware can be repacked
+   from its header (needs no pip installs):
+                                    python convert_clips.py --from-header clips.h
+   The CMake build does this too, writing build/offair_clips.uf2 beside offair.uf2.
+
+Then flash offair.uf2 (if you haven't) and offair_clips.uf2, one after the other. The
+clips stay put when the firmware is updated, and vice versa. Firmware with no bank
+plays the few seconds of each kind built into it (see FALLBACK) and blinks LED 4.
+
+Options: -o FILE names the UF2; --bin FILE also writes the bare bank (host/ reads
+it); --fallback-header FILE also writes the firmware's built-in bank as a C header
+(the CMake build writes build/fallback_clips.h from clips.h); --flash-mb sets the
+flash size the firmware is built for (2, PICO_BOARD pico).
 
 --------------------------------------------------------------------------------
-AUDIO FORMATS (what gets baked)
+AUDIO FORMAT (what gets packed)
 --------------------------------------------------------------------------------
-Interference / Insta-ference : 8 kHz,    uint8   (offset binary, 128 = silence)
-Station clips                : 11025 Hz, 12-bit packed signed (2 samples per 3 bytes)
-
-12-bit packing layout (A=sample[i], B=sample[i+1]):
-  byte0 = A[11:4];  byte1 = (A[3:0]<<4) | B[11:8];  byte2 = B[7:0]
-Unpack in C:
-  int32_t a = (int32_t)((byte0<<4)|(byte1>>4));  if(a>=2048)a-=4096;
-  int32_t b = (int32_t)(((byte1&0xF)<<8)|byte2); if(b>=2048)b-=4096;
+Interference / Insta-ference : 8 kHz,    IMA ADPCM, 4 bits per sample
+Station clips                : 11025 Hz, IMA ADPCM, 4 bits per sample
+(the old header held 8-bit interference and 12-bit packed Stations: the same flash
+now holds 2-3x as much Station audio)
+A clip that ADPCM codes below MIN_ADPCM_SNR_DB (broadband noise, clicks — most of the
+shipped interference and one-shots) is stored as 8-bit PCM instead, one byte a sample.
+
+Bank layout: see clipbank.h. In short, a 16-byte header, a 16-byte entry per clip
+{data offset, samples, sample rate, kind, coding}, then each clip as blocks of
+BLOCK_SAMPLES samples, each ADPCM block starting with the decoder state (i16 predictor,
+u8 step index, u8 0) so playback can loop or start at any block. The last 256 bytes of
+flash hold {u32 bank address, u32 1}.
 """
 
-import miniaudio
-import numpy as np
-import os
+import argparse
 import glob
+import math
+import os
+import re
+import struct
+import sys
+
 
 TARGET_SR_INTF  = 8000
 TARGET_SR_BCAST = 11025
-MAX_BCAST_SEC   = 35
+MAX_BCAST_SEC   = 80
+
+STATION, INTERFERENCE, ONESHOT = 0, 1, 2   # clip kinds (ClipBank::Kind)
 
 # One-shot bank: drop curated short event files (clicks, blips, dropouts, crashes,
 # single morse bursts...) into this folder. Any count, any length. Each is converted
-# to 8-bit 8kHz and played once-through when triggered by Pulse In 2.
+# to 8kHz and played once-through when triggered by Pulse In 2.
 ONESHOT_FOLDER  = "C:/Users/andyu/Downloads/NumbersStationsEtc/Oneshots/"
 ONESHOT_EXTS    = ("*.wav", "*.mp3", "*.aif", "*.aiff", "*.flac")
 ONESHOT_MAX_SEC = 3.0   # safety cap per clip
 
-# Loop interference clips trimmed to <=12s (back halves rarely heard; frees flash
-# for the one-shot bank). (filename, start_sec, max_sec, var_name, description, sr, bits)
-LOOP_MAX_SEC = 12
+# Loop interference clips trimmed to <=24s (back halves rarely heard; frees flash
+# for the one-shot bank). (filename, start_sec, max_sec, name, description, sr, kind)
+LOOP_MAX_SEC = 24
 CLIPS = [
     # AM band interference — voice / numbers
-    ("POL-2015-05-18-1310utc.mp3",                          0, LOOP_MAX_SEC, "clip_pol",   "Polish numbers station",    TARGET_SR_INTF,  8),
-    ("UM10-Q7JN-2015-02-09-1604utc-3956khz.mp3",            0, LOOP_MAX_SEC, "clip_um10",  "UM10 voice/tones",          TARGET_SR_INTF,  8),
+    ("POL-2015-05-18-1310utc.mp3",                          0, LOOP_MAX_SEC, "clip_pol",   "Polish numbers station",    TARGET_SR_INTF,  INTERFERENCE),
+    ("UM10-Q7JN-2015-02-09-1604utc-3956khz.mp3",            0, LOOP_MAX_SEC, "clip_um10",  "UM10 voice/tones",          TARGET_SR_INTF,  INTERFERENCE),
     # SW band interference — data / digital signals
-    ("F03-2017-08-21-0940-0945utc-AFSK400-960_10210khz.mp3",5, LOOP_MAX_SEC, "clip_f03",   "AFSK data signal",          TARGET_SR_INTF,  8),
-    ("XT2-2232.5khz.mp3",                                   0, LOOP_MAX_SEC, "clip_xt2",   "XT2 unidentified digital",  TARGET_SR_INTF,  8),
+    ("F03-2017-08-21-0940-0945utc-AFSK400-960_10210khz.mp3",5, LOOP_MAX_SEC, "clip_f03",   "AFSK data signal",          TARGET_SR_INTF,  INTERFERENCE),
+    ("XT2-2232.5khz.mp3",                                   0, LOOP_MAX_SEC, "clip_xt2",   "XT2 unidentified digital",  TARGET_SR_INTF,  INTERFERENCE),
     # LW band interference — tones / polytones
-    ("Unid-polytone-2010-02-17.mp3",                        0, LOOP_MAX_SEC, "clip_poly",  "Unidentified polytone",     TARGET_SR_INTF,  8),
-    ("MX-L-2013-10-16-1530utc-bygwraspe.mp3",               0, LOOP_MAX_SEC, "clip_mxl",   "MX-L tone sequence",        TARGET_SR_INTF,  8),
-    # Altboot broadcast stations — 12-bit packed signed
-    ("Demo1.wav",  0, MAX_BCAST_SEC, "clip_demo1", "Broadcast station 1", TARGET_SR_BCAST, 12),
-    ("Demo2.wav",  0, MAX_BCAST_SEC, "clip_demo2", "Broadcast station 2", TARGET_SR_BCAST, 12),
+    ("Unid-polytone-2010-02-17.mp3",                        0, LOOP_MAX_SEC, "clip_poly",  "Unidentified polytone",     TARGET_SR_INTF,  INTERFERENCE),
+    ("MX-L-2013-10-16-1530utc-bygwraspe.mp3",               0, LOOP_MAX_SEC, "clip_mxl",   "MX-L tone sequence",        TARGET_SR_INTF,  INTERFERENCE),
+    # Altboot broadcast stations
+    ("Demo1.wav",  0, MAX_BCAST_SEC, "clip_demo1", "Broadcast station 1", TARGET_SR_BCAST, STATION),
+    ("Demo2.wav",  0, MAX_BCAST_SEC, "clip_demo2", "Broadcast station 2", TARGET_SR_BCAST, STATION),
 ]
 
 FOLDER = "C:/Users/andyu/Downloads/NumbersStationsEtc/"
 
-def decode_float(filename, start_sec, max_sec, target_sr):
-    path = FOLDER + filename
+# Bank / flash layout (must match clipbank.h and the firmware build)
+BANK_MAGIC      = 0x4243414F     # "OACB"
+BANK_VERSION    = 2
+BLOCK_SAMPLES   = 256            # ADPCM block: 4-byte header + 128 bytes of codes
+CODING_ADPCM, CODING_PCM8 = 0, 1 # clip coding (ClipBank::Coding)
+MIN_ADPCM_SNR_DB = 24            # below this a clip goes in as 8-bit PCM instead
+FLASH_MB        = 2              # PICO_BOARD pico
+FIRMWARE_KB     = 256            # kept clear for offair.uf2 at the start of flash
+
+FLASH_BASE       = 0x10000000
+UF2_MAGIC_START0 = 0x0A324655
+UF2_MAGIC_START1 = 0x9E5D5157
+UF2_MAGIC_END    = 0x0AB16F30
+RP2040_FAMILY_ID = 0xE48BFF56
+
+def decode_float(path, start_sec, max_sec, target_sr):
+    import miniaudio
+    import numpy as np
     decoded = miniaudio.decode_file(path, output_format=miniaudio.SampleFormat.FLOAT32,
                                     nchannels=1, sample_rate=target_sr)
     samples = np.frombuffer(decoded.samples, dtype=np.float32).copy()
@@ -92,179 +132,235 @@ def decode_float(filename, start_sec, max_sec, target_sr):
     if end_sample > len(samples):
         end_sample = len(samples)
     samples = samples[start_sample:end_sample]
-    peak = np.max(np.abs(samples))
+    peak = np.max(np.abs(samples)) if len(samples) else 0
     if peak > 0:
         samples = samples / peak * 0.95
     return samples
 
-def to_u8(samples):
-    return np.clip((samples * 127.0 + 128.0), 0, 255).astype(np.uint8)
-
-def to_12bit_packed(samples):
-    s12 = np.clip(np.round(samples * 2047.0), -2048, 2047).astype(np.int16)
-    if len(s12) % 2 != 0:
-        s12 = np.append(s12, [0])
-    packed = bytearray()
-    for i in range(0, len(s12), 2):
-        a = int(s12[i])   & 0xFFF
-        b = int(s12[i+1]) & 0xFFF
-        packed.append((a >> 4) & 0xFF)
-        packed.append(((a & 0xF) << 4) | ((b >> 8) & 0xF))
-        packed.append(b & 0xFF)
-    return packed, len(s12)
-
-def array_to_c_u8(data, var_name, description, sr):
-    n = len(data)
-    lines = [
-        f"// {description}  ({n/sr:.1f}s at {sr}Hz, {n} samples = {n//1024}KB)",
-        f"static const uint8_t {var_name}[{n}] PROGMEM_OR_CONST = {{",
-    ]
-    for i in range(0, n, 16):
-        row = data[i:i+16]
-        lines.append("    " + ", ".join(f"0x{b:02X}" for b in row) + ",")
-    lines += ["};", f"static const uint32_t {var_name}_len = {n};",
-              f"static const uint32_t {var_name}_sr  = {sr};", ""]
-    return "\n".join(lines)
-
-def array_to_c_12bit(packed_bytes, sample_count, var_name, description, sr):
-    nb = len(packed_bytes)
-    lines = [
-        f"// {description}  ({sample_count/sr:.1f}s at {sr}Hz, {sample_count} samples, 12-bit packed = {nb//1024}KB)",
-        f"static const uint8_t {var_name}[{nb}] PROGMEM_OR_CONST = {{",
-    ]
-    for i in range(0, nb, 12):
-        row = packed_bytes[i:i+12]
-        lines.append("    " + ", ".join(f"0x{b:02X}" for b in row) + ",")
-    lines += ["};",
-              f"static const uint32_t {var_name}_len = {sample_count};  // samples, not bytes",
-              f"static const uint32_t {var_name}_sr  = {sr};", ""]
-    return "\n".join(lines)
+def to_s16(samples):
+    import numpy as np
+    return [int(v) for v in np.clip(np.round(samples * 32767.0), -32768, 32767)]
 
-# ---- main ----
-out_parts = [
-    "// clips.h — baked audio for OffAir",
-    "// Auto-generated by convert_clips.py — do not edit by hand",
-    "// Interference clips: 8kHz uint8, 128=silence",
-    "// Broadcast clips:    11025Hz 12-bit packed signed (2 samples per 3 bytes)",
-    "//",
-    "#pragma once",
-    "#include <stdint.h>",
-    "",
-    "#define PROGMEM_OR_CONST",
-    "",
+# ---- IMA ADPCM (the decoder half must match imaDecode() in clipbank.h) ----
+IMA_STEP = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253,
+    279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166,
+    1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428,
+    4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899, 15289,
+    16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767,
 ]
+IMA_INDEX = [-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8]
+
+def ima_block(x, pred, index):
+    """Code the samples x from decoder state (pred, index): codes, decoded, end state."""
+    codes, decoded = [], []
+    for v in x:
+        step = IMA_STEP[index]
+        diff = v - pred
+        code = 8 if diff < 0 else 0
+        diff = abs(diff)
+        if diff >= step:        code |= 4; diff -= step
+        if diff >= step >> 1:   code |= 2; diff -= step >> 1
+        if diff >= step >> 2:   code |= 1
+        # decode exactly as the firmware does, so encoder and decoder agree
+        d = step >> 3
+        if code & 4: d += step
+        if code & 2: d += step >> 1
+        if code & 1: d += step >> 2
+        pred = max(-32768, min(32767, pred - d if code & 8 else pred + d))
+        index = max(0, min(88, index + IMA_INDEX[code]))
+        codes.append(code)
+        decoded.append(pred)
+    return codes, decoded, pred, index
+
+def ima_encode(s16):
+    """Blocks of BLOCK_SAMPLES: decoder state, then 4-bit codes (low nibble first).
+    Returns the coded clip and what the firmware will decode from it."""
+    x = list(s16) + [0] * (-len(s16) % BLOCK_SAMPLES)
+    # Seed the clip's first block on its first sample, with the step index that codes
+    # that block best; every block after starts from the state the last one ended in.
+    first = x[:BLOCK_SAMPLES]
+    pred = max(-32768, min(32767, first[0]))
+    index = min(range(89), key=lambda i: sq_err(first, ima_block(first, pred, i)[1]))
+    out, decoded = bytearray(), []
+    for b in range(0, len(x), BLOCK_SAMPLES):
+        out += struct.pack('<hBB', pred, index, 0)
+        codes, dec, pred, index = ima_block(x[b:b + BLOCK_SAMPLES], pred, index)
+        out += bytes(codes[k] | (codes[k + 1] << 4) for k in range(0, BLOCK_SAMPLES, 2))
+        decoded += dec
+    return bytes(out), decoded[:len(s16)]
+
+# ---- 8-bit PCM, for the clips ADPCM can't carry ----
+def pcm8_encode(s16):
+    """One signed byte a sample (the top 8 bits, rounded), in blocks of BLOCK_SAMPLES."""
+    q = [max(-128, min(127, (v + 128) >> 8)) for v in s16]
+    out = bytes(v & 0xFF for v in q) + b'\0' * (-len(q) % BLOCK_SAMPLES)
+    return out, [v << 8 for v in q]
+
+def sq_err(ref, got):
+    return sum((a - b) * (a - b) for a, b in zip(ref, got))
+
+def snr_db(ref, got):
+    err = sq_err(ref, got)
+    return math.inf if err == 0 else 10 * math.log10(max(sum(v * v for v in ref), 1) / err)
 
-total_kb = 0
-for (filename, start_sec, max_sec, var_name, description, sr, bits) in CLIPS:
-    print(f"Converting {filename} [{start_sec}s..+{max_sec}s] @ {sr}Hz {bits}bit...")
-    samples = decode_float(filename, start_sec, max_sec, sr)
-    if bits == 8:
-        data = to_u8(samples)
-        kb = len(data) // 1024
-        total_kb += kb
-        print(f"  -> {var_name}: {len(data)} samples ({kb}KB, {len(data)/sr:.1f}s)")
-        out_parts.append(array_to_c_u8(data, var_name, description, sr))
+def encode_clip(s16):
+    """(coding, data, ADPCM SNR dB): ADPCM unless it falls below MIN_ADPCM_SNR_DB on this
+    clip and 8-bit PCM does better."""
+    adpcm, decoded = ima_encode(s16)
+    snr = snr_db(s16, decoded)
+    if snr < MIN_ADPCM_SNR_DB:
+        pcm, decoded = pcm8_encode(s16)
+        if snr_db(s16, decoded) > snr:
+            return CODING_PCM8, pcm, snr
+    return CODING_ADPCM, adpcm, snr
+
+# ---- sources ----
+def clips_from_audio():
+    """(name, description, sr, kind, s16 samples) from the CLIPS table + one-shot folder."""
+    clips = []
+    for (filename, start_sec, max_sec, name, description, sr, kind) in CLIPS:
+        print(f"Converting {filename} [{start_sec}s..+{max_sec}s] @ {sr}Hz...")
+        samples = decode_float(FOLDER + filename, start_sec, max_sec, sr)
+        clips.append((name, description, sr, kind, to_s16(samples)))
+
+    oneshot_files = []
+    for ext in ONESHOT_EXTS:
+        oneshot_files.extend(glob.glob(os.path.join(ONESHOT_FOLDER, ext)))
+    oneshot_files.sort()
+    if oneshot_files:
+        print(f"\nOne-shot bank: {len(oneshot_files)} file(s) in {ONESHOT_FOLDER}")
     else:
-        packed, sample_count = to_12bit_packed(samples)
-        kb = len(packed) // 1024
-        total_kb += kb
-        print(f"  -> {var_name}: {sample_count} samples ({kb}KB packed, {sample_count/sr:.1f}s)")
-        out_parts.append(array_to_c_12bit(packed, sample_count, var_name, description, sr))
-
-# ---- one-shot bank (auto-discovered folder) ----
-oneshot_files = []
-for ext in ONESHOT_EXTS:
-    oneshot_files.extend(glob.glob(os.path.join(ONESHOT_FOLDER, ext)))
-oneshot_files.sort()
-
-oneshot_vars = []
-if oneshot_files:
-    print(f"\nOne-shot bank: {len(oneshot_files)} file(s) in {ONESHOT_FOLDER}")
+        print(f"\nOne-shot bank: no files found in {ONESHOT_FOLDER} (bank will be empty)")
     for idx, path in enumerate(oneshot_files):
-        name = os.path.basename(path)
-        var  = f"clip_os_{idx}"
-        # decode directly by full path (one-shots live in their own folder)
-        decoded = miniaudio.decode_file(path, output_format=miniaudio.SampleFormat.FLOAT32,
-                                        nchannels=1, sample_rate=TARGET_SR_INTF)
-        s = np.frombuffer(decoded.samples, dtype=np.float32).copy()
-        s = s[:int(ONESHOT_MAX_SEC * TARGET_SR_INTF)]
-        peak = np.max(np.abs(s)) if len(s) else 0
-        if peak > 0:
-            s = s / peak * 0.95
-        data = to_u8(s)
-        kb = len(data) / 1024
-        total_kb += int(kb)
-        print(f"  -> {var}: {name}  {len(data)} samples ({kb:.1f}KB, {len(data)/TARGET_SR_INTF:.2f}s)")
-        out_parts.append(array_to_c_u8(data, var, f"one-shot: {name}", TARGET_SR_INTF))
-        oneshot_vars.append(var)
-else:
-    print(f"\nOne-shot bank: no files found in {ONESHOT_FOLDER} (bank will be empty)")
-
-out_parts += [
-    "// 8-bit interference clip descriptor",
-    "struct ClipDesc { const uint8_t* data; uint32_t len; uint32_t sr; };",
-    "",
-    "// AM band: POL + UM10",
-    "static const ClipDesc kAmClips[2] = {",
-    "    { clip_pol,  clip_pol_len,  clip_pol_sr  },",
-    "    { clip_um10, clip_um10_len, clip_um10_sr },",
-    "};",
-    "",
-    "// SW band: F03 + XT2",
-    "static const ClipDesc kSwClips[2] = {",
-    "    { clip_f03, clip_f03_len, clip_f03_sr },",
-    "    { clip_xt2, clip_xt2_len, clip_xt2_sr },",
-    "};",
-    "",
-    "// LW band: Polytone + MX-L",
-    "static const ClipDesc kLwClips[2] = {",
-    "    { clip_poly, clip_poly_len, clip_poly_sr },",
-    "    { clip_mxl,  clip_mxl_len,  clip_mxl_sr  },",
-    "};",
-    "",
-    "// All six interference clips flat (0=POL,1=UM10,2=F03,3=XT2,4=POLY,5=MXL)",
-    "static const ClipDesc kAllClips[6] = {",
-    "    { clip_pol,  clip_pol_len,  clip_pol_sr  },",
-    "    { clip_um10, clip_um10_len, clip_um10_sr },",
-    "    { clip_f03,  clip_f03_len,  clip_f03_sr  },",
-    "    { clip_xt2,  clip_xt2_len,  clip_xt2_sr  },",
-    "    { clip_poly, clip_poly_len, clip_poly_sr },",
-    "    { clip_mxl,  clip_mxl_len,  clip_mxl_sr  },",
-    "};",
-    "",
-    "// 12-bit packed broadcast clip descriptor (data is byte array, len is sample count)",
-    "struct BcastDesc { const uint8_t* data; uint32_t len; uint32_t sr; };",
-    "",
-    "static const BcastDesc kBcastClips[2] = {",
-    "    { clip_demo1, clip_demo1_len, clip_demo1_sr },",
-    "    { clip_demo2, clip_demo2_len, clip_demo2_sr },",
-    "};",
-    "",
-]
+        samples = decode_float(path, 0, ONESHOT_MAX_SEC, TARGET_SR_INTF)
+        clips.append((f"clip_os_{idx}", f"one-shot: {os.path.basename(path)}",
+                      TARGET_SR_INTF, ONESHOT, to_s16(samples)))
+    return clips
 
-# One-shot bank descriptor (reuses ClipDesc). kNumOneShots auto-computed.
-out_parts += [
-    "// One-shot bank — short curated events, played once-through on Pulse In 2.",
-    f"static constexpr int kNumOneShots = {len(oneshot_vars)};",
-]
-if oneshot_vars:
-    out_parts.append("static const ClipDesc kOneShotClips[kNumOneShots] = {")
-    for v in oneshot_vars:
-        out_parts.append(f"    {{ {v}, {v}_len, {v}_sr }},")
-    out_parts.append("};")
-else:
-    # Empty bank: provide a 1-element dummy so the array type is valid; firmware
-    # guards on kNumOneShots == 0 and never reads it.
-    out_parts.append("static const ClipDesc kOneShotClips[1] = { { clip_pol, clip_pol_len, clip_pol_sr } };")
-out_parts.append("")
-
-out_path = os.path.join(os.path.dirname(__file__), "clips.h")
-with open(out_path, "w") as f:
-    f.write("\n".join(out_parts))
-
-FREE_FLASH_KB = 272
-print(f"\nWrote clips.h ({total_kb}KB total audio)")
-if total_kb > 1747 + FREE_FLASH_KB:
-    print(f"  *** WARNING: ~{total_kb}KB exceeds the ~{1747+FREE_FLASH_KB}KB flash budget! ***")
-else:
-    print(f"  Flash budget OK (~{1747+FREE_FLASH_KB}KB available for audio).")
+ARRAY_RE = re.compile(r'//\s*([^\n]*?)\s*\([^\n]*\n\s*static const uint8_t (\w+)\[\d+\][^{]*\{([^}]*)\}')
+
+def clips_from_header(path):
+    """The clips baked into the old firmware's clips.h: 12-bit packed Stations
+    (clip_demo*), 8-bit interference and one-shots (clip_os_*)."""
+    text = open(path, encoding='latin-1').read()
+    consts = dict(re.findall(r'static const uint32_t (\w+)\s*=\s*(\d+);', text))
+    clips = []
+    for m in ARRAY_RE.finditer(text):
+        description, name, body = m.groups()
+        data = bytes(int(x, 16) for x in body.replace(',', ' ').split())
+        n, sr = int(consts[name + '_len']), int(consts[name + '_sr'])
+        if name.startswith('clip_demo'):
+            s16 = []
+            for i in range(n):
+                b = (i >> 1) * 3
+                v = (data[b] << 4) | (data[b + 1] >> 4) if i % 2 == 0 else \
+                    ((data[b + 1] & 0xF) << 8) | data[b + 2]
+                s16.append((v - 4096 if v >= 2048 else v) << 4)
+            kind = STATION
+        else:
+            s16 = [(v - 128) << 8 for v in data[:n]]
+            kind = ONESHOT if name.startswith('clip_os_') else INTERFERENCE
+        clips.append((name, description, sr, kind, s16))
+    if not clips:
+        sys.exit(f"{path}: no clips found")
+    return clips
+
+# The built-in bank compiled into the firmware, played when there is no offair_clips.uf2:
+# the first few seconds of a few clips of each kind. (kind: max clips, max seconds)
+FALLBACK = { STATION: (2, 4.0), INTERFERENCE: (3, 2.0), ONESHOT: (3, 0.5) }
+
+def fallback_clips(clips):
+    picked, count = [], {}
+    for (name, description, sr, kind, s16) in clips:
+        most, sec = FALLBACK[kind]
+        if count.get(kind, 0) < most:
+            count[kind] = count.get(kind, 0) + 1
+            picked.append((name, description, sr, kind, s16[:int(sec * sr)]))
+    return picked
+
+# ---- bank + UF2 ----
+def build_bank(clips, verbose=True):
+    # Stations first, in table order (Station 1, Station 2), then the rest as listed
+    clips = sorted(clips, key=lambda c: c[3] != STATION)
+    data = bytearray()
+    entries = bytearray()
+    offset = 16 + 16 * len(clips)
+    old_bytes = 0
+    for (name, description, sr, kind, s16) in clips:
+        coding, coded, snr = encode_clip(s16)
+        entries += struct.pack('<IIIBB2x', offset + len(data), len(s16), sr, kind, coding)
+        data += coded
+        old = len(s16) * 3 // 2 if kind == STATION else len(s16)   # 12-bit / 8-bit
+        old_bytes += old
+        how = f"ADPCM, {snr:.1f}dB" if coding == CODING_ADPCM else \
+              f"8-bit PCM (ADPCM would be {snr:.1f}dB)"
+        if verbose:
+            print(f"  -> {name}: {description}, {len(s16)} samples ({len(s16)/sr:.1f}s at {sr}Hz), "
+                  f"{len(coded)//1024}KB {how} (was {old//1024}KB)")
+    size = offset + len(data)
+    size += -size % 4
+    header = struct.pack('<IHHIHH', BANK_MAGIC, BANK_VERSION, len(clips), size, BLOCK_SAMPLES, 0)
+    bank = bytes(header + entries + data)
+    return bank + b'\0' * (size - len(bank)), old_bytes
+
+def write_fallback_header(path, bank):
+    rows = [', '.join(f'0x{b:02X}' for b in bank[i:i + 16]) for i in range(0, len(bank), 16)]
+    with open(path, 'w') as f:
+        f.write("// fallback_clips.h — OffAir's built-in clip bank (see clipbank.h), played when\n"
+                "// offair_clips.uf2 isn't in flash. Generated by convert_clips.py; don't edit.\n"
+                "#pragma once\n#include <stdint.h>\n\n"
+                f"alignas(4) static const uint8_t kFallbackBank[{len(bank)}] = {{\n    "
+                + ',\n    '.join(rows) + ",\n};\n")
+
+def uf2_blocks(address, image):
+    blocks = []
+    total = len(image) // 256
+    for i in range(total):
+        payload = image[i * 256:(i + 1) * 256]
+        blocks.append(struct.pack('<IIIIIIII', UF2_MAGIC_START0, UF2_MAGIC_START1, 0x2000,
+                                  address + i * 256, 256, i, total, RP2040_FAMILY_ID)
+                      + payload + b'\0' * (476 - 256) + struct.pack('<I', UF2_MAGIC_END))
+    return b''.join(blocks)
+
+def write_uf2(path, bank, flash_mb):
+    flash_size = flash_mb * 1024 * 1024
+    address = FLASH_BASE + flash_size - len(bank) - 256
+    address -= address % 4096
+    if address < FLASH_BASE + FIRMWARE_KB * 1024:
+        sys.exit(f"*** {len(bank)//1024}KB of clips doesn't fit in {flash_mb}MB of flash beside "
+                 f"the firmware ({flash_mb*1024 - FIRMWARE_KB}KB free) — trim clip lengths ***")
+    image = bytearray(FLASH_BASE + flash_size - address)
+    image[:len(bank)] = bank
+    image[-256:-248] = struct.pack('<II', address, 1)
+    with open(path, 'wb') as f:
+        f.write(uf2_blocks(address, bytes(image)))
+    return address, flash_size - FIRMWARE_KB * 1024
+
+# ---- main ----
+ap = argparse.ArgumentParser(description='Pack the OffAir clips into an ADPCM clip bank.')
+ap.add_argument('--from-header', metavar='CLIPS_H',
+                help='repack the clips from an old clips.h instead of the source audio')
+ap.add_argument('-o', '--uf2', default=os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                                                   'offair_clips.uf2'))
+ap.add_argument('--bin', help='also write the bare bank to this file')
+ap.add_argument('--fallback-header', metavar='H',
+                help="also write the firmware's built-in bank (a few short clips) as a C header")
+ap.add_argument('--flash-mb', type=int, default=FLASH_MB)
+args = ap.parse_args()
+
+clips = clips_from_header(args.from_header) if args.from_header else clips_from_audio()
+print(f"\nPacking {len(clips)} clips:")
+bank, old_bytes = build_bank(clips)
+if args.bin:
+    with open(args.bin, 'wb') as f:
+        f.write(bank)
+if args.fallback_header:
+    fallback, _ = build_bank(fallback_clips(clips), verbose=False)
+    write_fallback_header(args.fallback_header, fallback)
+    print(f"\nWrote {args.fallback_header}: {len(fallback)//1024}KB built-in bank")
+address, budget = write_uf2(args.uf2, bank, args.flash_mb)
+print(f"\nWrote {args.uf2}: {len(bank)//1024}KB bank at 0x{address:08X} "
+      f"(the old format would take {old_bytes//1024}KB)")
+print(f"  Flash budget OK ({len(bank)//1024}KB of ~{budget//1024}KB available for audio).")
@@ -0,0 +1,258 @@
+// clip_bench — OffAir's ADPCM clip bank against the clips.h it replaces, on Linux.
+//
+// For every clip in the bank (built from clips.h by convert_clips.py --from-header):
+//   - size, old format (12-bit packed Stations, 8-bit interference) vs the bank (ADPCM,
+//     or 8-bit PCM for the clips convert_clips.py finds ADPCM codes too badly);
+//   - quality: SNR of the decoded clip against the old samples;
+//   - that a ClipStream (the firmware's ring, fed as the background loop feeds it) gives
+//     exactly the straight decode, looping and starting part-way through.
+// The same stream check runs on the firmware's built-in bank (out/fallback_clips.h).
+// Then the cost: reading the old format in the audio interrupt, against the background
+// loop's ADPCM decode and the interrupt's ring readout with interpolation. Last, a
+// two-thread run with random play() commands checks the handoff between producer and
+// consumer.
+//
+//   ./clip_bench out/offair_clips.bin     (make run builds the bank first)
+//
+// Host ns are only relative (x86, not an RP2040) — compare the columns, not the numbers.
+#include "host_shim.h"
+#include "../clipbank.h"
+#include "../clips.h"
+#include "fallback_clips.h"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+// The old firmware's per-sample reads, as stepBcast() / stepIntf() did them
+static inline int32_t unpack12(const uint8_t* d, uint32_t p)
+{
+    uint32_t b = (p >> 1) * 3;
+    int32_t s = (p & 1) == 0 ? ((int32_t)d[b] << 4) | (d[b + 1] >> 4)
+                             : (((int32_t)d[b + 1] & 0xF) << 8) | d[b + 2];
+    return s >= 2048 ? s - 4096 : s;
+}
+
+struct OldClip { const uint8_t* data; uint32_t len; bool packed12; };
+
+// clips.h in bank order: Stations, then interference, then one-shots
+static std::vector<OldClip> old_clips()
+{
+    std::vector<OldClip> v;
+    for (const BcastDesc& c : kBcastClips) v.push_back({ c.data, c.len, true });
+    for (const ClipDesc& c : kAllClips) v.push_back({ c.data, c.len, false });
+    for (int i = 0; i < kNumOneShots; i++) v.push_back({ kOneShotClips[i].data, kOneShotClips[i].len, false });
+    return v;
+}
+
+static std::vector<int32_t> old_samples(const OldClip& c)   // 16-bit scale
+{
+    std::vector<int32_t> v(c.len);
+    for (uint32_t i = 0; i < c.len; i++)
+        v[i] = c.packed12 ? unpack12(c.data, i) << 4 : ((int32_t)c.data[i] - 128) << 8;
+    return v;
+}
+
+// Straight decode, block by block, without a ClipStream
+static std::vector<int32_t> decode_all(const ClipBank& bank, int c)
+{
+    std::vector<int32_t> v;
+    ImaState st;
+    for (uint32_t i = 0; i < bank.samples(c); i++) {
+        uint32_t off = i % bank.blockSamples();
+        const uint8_t* b = bank.block(c, i / bank.blockSamples());
+        if (bank.coding(c) == ClipBank::Pcm8) { v.push_back((int8_t)b[off] * 256); continue; }
+        if (off == 0) { st.pred = (int16_t)(b[0] | (b[1] << 8)); st.index = b[2]; }
+        uint32_t code = b[4 + (off >> 1)];
+        v.push_back(imaDecode(st, (off & 1) ? code >> 4 : code & 0xF));
+    }
+    return v;
+}
+
+// n samples through a ClipStream, filling whenever it runs dry (single thread)
+static std::vector<int32_t> stream_samples(const ClipBank& bank, ClipStream& s, size_t n)
+{
+    std::vector<int32_t> v;
+    int dry = 0;
+    while (v.size() < n && dry < 2) {
+        int32_t x;
+        if (s.pop(x)) { v.push_back(x); dry = 0; }
+        else { s.fill(bank); dry++; }
+    }
+    return v;
+}
+
+// Clip c through a ClipStream matches its straight decode: once through, then looping
+// from halfway for a clip and a half
+static bool stream_ok(const ClipBank& bank, ClipStream& stream, int c)
+{
+    std::vector<int32_t> dec = decode_all(bank, c);
+    uint32_t n = bank.samples(c);
+    stream.play(c, 0, false);
+    bool ok = stream_samples(bank, stream, n + 1000) == dec;
+    uint32_t start = n / 2 - (n / 2) % bank.blockSamples();
+    stream.play(c, n / 2, true);
+    std::vector<int32_t> looped = stream_samples(bank, stream, n + n / 2);
+    for (size_t i = 0; ok && i < looped.size(); i++) ok = looped[i] == dec[(start + i) % n];
+    return ok && looped.size() == n + n / 2;
+}
+
+static double snr_db(const std::vector<int32_t>& ref, const std::vector<int32_t>& got)
+{
+    double sig = 0, err = 0;
+    for (size_t i = 0; i < ref.size(); i++) {
+        double e = (double)got[i] - ref[i];
+        sig += (double)ref[i] * ref[i];
+        err += e * e;
+    }
+    return err == 0 ? INFINITY : 10 * std::log10(sig / err);
+}
+
+using Clock = std::chrono::steady_clock;
+static double ns_since(Clock::time_point t0, double per)
+{
+    return std::chrono::duration<double, std::nano>(Clock::now() - t0).count() / per;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc != 2) { fprintf(stderr, "usage: %s offair_clips.bin\n", argv[0]); return 2; }
+    std::ifstream in(argv[1], std::ios::binary);
+    std::vector<uint8_t> image((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    ClipBank bank;
+    if (!bank.load(image.data(), (uint32_t)image.size())) { printf("%s is not a clip bank\n", argv[1]); return 1; }
+
+    std::vector<OldClip> old = old_clips();
+    int nClips = 0;
+    for (int k = 0; k < ClipBank::kNumKinds; k++) nClips += bank.count((ClipBank::Kind)k);
+    if (nClips != (int)old.size()) { printf("bank has %d clips, clips.h %zu\n", nClips, old.size()); return 1; }
+
+    // --- Size, quality, stream == straight decode ---
+    static const char* kKind[] = { "Station", "interference", "one-shot" };
+    static const char* kCoding[] = { "ADPCM", "PCM8" };
+    printf("clip  kind          coding   samples   old KB   bank KB    SNR dB | stream\n");
+    int failures = 0;
+    size_t oldBytes = 0, newBytes = 0;
+    ClipStream stream;
+    for (int c = 0; c < nClips; c++) {
+        int kind = c < bank.count(ClipBank::Station) ? 0
+                 : c < bank.count(ClipBank::Station) + bank.count(ClipBank::Interference) ? 1 : 2;
+        uint32_t n = bank.samples(c);
+        size_t ob = old[c].packed12 ? (old[c].len * 3 + 1) / 2 : old[c].len;
+        size_t nb = (n + bank.blockSamples() - 1) / bank.blockSamples() * bank.blockBytes(c);
+        oldBytes += ob; newBytes += nb;
+
+        bool ok = n == old[c].len && stream_ok(bank, stream, c);
+        failures += !ok;
+
+        printf("%4d  %-12s  %-6s %9u %8.1f %9.1f %9.1f | %s\n", c, kKind[kind], kCoding[bank.coding(c)],
+               n, ob / 1024.0, nb / 1024.0, snr_db(old_samples(old[c]), decode_all(bank, c)),
+               ok ? "ok" : "FAIL");
+    }
+    printf("total                                %8.1f %9.1f  (%.2fx)\n\n", oldBytes / 1024.0,
+           newBytes / 1024.0, (double)oldBytes / newBytes);
+
+    // --- The built-in bank the firmware falls back on ---
+    {
+        ClipBank fb;
+        bool ok = fb.load(kFallbackBank, sizeof(kFallbackBank));
+        int n[ClipBank::kNumKinds] = {};
+        for (int k = 0; k < ClipBank::kNumKinds; k++) n[k] = fb.count((ClipBank::Kind)k);
+        for (int c = 0; ok && c < n[0] + n[1] + n[2]; c++) ok = stream_ok(fb, stream, c);
+        failures += !ok;
+        printf("built-in bank: %.1f KB, %d Station / %d interference / %d one-shot | %s\n\n",
+               sizeof(kFallbackBank) / 1024.0, n[0], n[1], n[2], ok ? "ok" : "FAIL");
+    }
+
+    // --- Cost ---
+    // Old: the audio interrupt steps through the clip in flash (Station 1, 13340Hz step).
+    const int kOut = 48000 * 20;
+    const OldClip& st = old[0];
+    volatile int32_t sink = 0;
+    auto t0 = Clock::now();
+    {
+        uint32_t pos = 0; int32_t frac = 0, s = 0, acc = 0;
+        for (int i = 0; i < kOut; i++) {
+            frac += 13340;
+            if (frac >= 48000) { frac -= 48000; if (++pos >= st.len) pos = 0; s = unpack12(st.data, pos); }
+            acc += s;
+        }
+        sink = acc;
+    }
+    double oldNs = ns_since(t0, kOut);
+
+    // New, background loop: decode into the ring (ns per clip sample)
+    uint32_t decoded = 0;
+    stream.play(0, 0, true);
+    t0 = Clock::now();
+    {
+        int32_t x, acc = 0;
+        for (int r = 0; r < 2000; r++) {
+            stream.fill(bank);
+            while (stream.pop(x)) { acc += x; decoded++; }
+        }
+        sink = acc;
+    }
+    double decodeNs = ns_since(t0, decoded);
+
+    // New, audio core: ring pop + interpolated readout, timed between untimed fills
+    stream.play(0, 0, true);
+    double readTotal = 0;
+    {
+        int32_t frac = 0, prev = 0, next = 0, acc = 0;
+        const int chunk = (int)(ClipStream::kRing * 48000 / 13340) - 1;   // one ring's worth
+        for (int done = 0; done < kOut; done += chunk) {
+            stream.fill(bank);
+            t0 = Clock::now();
+            for (int i = 0; i < chunk; i++) {
+                frac += 18214;
+                if (frac >= 65536) { frac -= 65536; prev = next; int32_t x; if (stream.pop(x)) next = x; }
+                acc += (prev + (((next - prev) * (frac >> 4)) >> 12)) >> 4;
+            }
+            readTotal += ns_since(t0, 1);
+        }
+        sink = acc;
+    }
+    double readNs = readTotal / kOut;
+    (void)sink;
+
+    printf("Station playback             ns per 48kHz sample\n");
+    printf("old: 12-bit read in the audio interrupt      %6.2f\n", oldNs);
+    printf("new: ring readout + interpolation (audio)    %6.2f\n", readNs);
+    printf("new: ADPCM decode in the background loop     %6.2f  (%.2f ns per clip sample)\n\n",
+           decodeNs * 13340.0 / 48000.0, decodeNs);
+
+    // --- Two threads: random play() commands against a filling thread ---
+    std::atomic<bool> done{ false };
+    ClipStream xs;
+    std::thread filler([&] { while (!done) xs.fill(bank); });
+    uint32_t rng = 1, checked = 0, bad = 0;
+    std::vector<std::vector<int32_t>> decs;
+    for (int c = 0; c < nClips; c++) decs.push_back(decode_all(bank, c));
+    for (int cmd = 0; cmd < 2000; cmd++) {
+        rng = 1664525u * rng + 1013904223u;
+        int c = (int)(rng >> 16) % nClips;
+        uint32_t n = bank.samples(c), start = (rng % n);
+        start -= start % bank.blockSamples();
+        xs.play(c, start, true);
+        uint32_t want = 200 + (rng >> 24) * 8;
+        for (uint32_t i = 0; i < want;) {
+            int32_t x;
+            if (!xs.pop(x)) continue;
+            if (x != decs[c][(start + i) % n]) bad++;
+            i++; checked++;
+        }
+    }
+    done = true;
+    filler.join();
+    printf("two threads: 2000 play() commands, %u samples checked | %s\n", checked, bad ? "FAIL" : "ok");
+    failures += bad != 0;
+
+    return failures ? 1 : 0;
+}
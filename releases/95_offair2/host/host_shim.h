@@ -0,0 +1,12 @@
+// host_shim.h — lets clipbank.h compile on Linux (see host/Makefile).
+//
+// The clip bank and streams only need __not_in_flash_func() and __dmb() from the SDK;
+// the card itself (ComputerCard, main.cpp) is not built on the host.
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#define __not_in_flash_func(f) f
+
+static inline void __dmb() { std::atomic_thread_fence(std::memory_order_seq_cst); }
@@ -17,6 +17,13 @@
 // like a crowded SW band. A separate "Insta-ference" bank of short one-shot events
 // can be fired in via Pulse In 2.
 //
+// Clip audio (Stations, interference, Insta-ference) is an ADPCM bank uploaded to the
+// end of flash as offair_clips.uf2 (see clipbank.h / convert_clips.py). Core 1's
+// background loop streams each playing clip into an SRAM ring between audio
+// interrupts; the audio reads the rings at 48kHz with linear interpolation. Without a
+// bank the card plays a few seconds of each kind from a small bank built into the
+// firmware (fallback_clips.h), and LED 4 blinks.
+//
 // BAKED-IN AUDIO MODE (hold Switch Down at power-on until all LEDs flash):
 //   Live Audio In 1/2 (Station 1/2) replaced by baked recordings.
 //
@@ -50,10 +57,12 @@
 //   5 stations per band: 2 broadcast + 3 interference.
 
 #include "ComputerCard.h"
-#include "clips.h"
 #include "hardware/pwm.h"
 #include "hardware/irq.h"
 #include "pico/multicore.h"
+#include "clipbank.h"
+#include "fallback_clips.h"
+#include "iir_hilbert.h"
 
 // ---------------------------------------------------------------------------
 // PWM globals — written by ProcessSample(), read by ISR (RF out, not a focus)
@@ -68,7 +77,12 @@ volatile int32_t amValue = 0, fqValue = 1024000;
 static constexpr int32_t kNumStations = 5;   // 0/1 broadcast, 2/3/4 interference
 static constexpr int32_t kNumClips    = 3;   // continuous interference streams
 
-// One-shot interference burst (Pulse In 2): random clip from kAllClips, ~1.5s,
+// Clip streams: 0/1 broadcast, 2/3/4 interference, 5 one-shot
+static constexpr int32_t kIntfStream  = 2;
+static constexpr int32_t kOsStream    = 5;
+static constexpr int32_t kNumStreams  = 6;
+
+// One-shot interference burst (Pulse In 2): random clip from the Insta-ference bank,
 // ducked under the current audio, retrigger restarts.
 static constexpr int32_t kOsFadeSamples = 400;   // fade-out over last ~50ms (clip samples @8k)
 static constexpr int32_t kOsDuckShift   = 3;     // ducked under broadcast (>>3 ≈ −18dB)
@@ -123,12 +137,6 @@ static constexpr bool kBandPitchShift[3] = { false, true, true };
 static constexpr int32_t kSsbAudioHalf = 90;   // audio audible over a wider approach window
                                                // (broadcast heard sooner; still fades before deep bass)
 
-// IIR Hilbert quadrature pair (Q14 a2 coeffs). Two 4-section all-pass chains
-// (in z^-2); path B has a +1 sample delay. Their outputs are ~90° apart across the
-// audio band, giving I/Q for the single-sideband frequency shift.
-static constexpr int32_t kHilbA[4] = { 11344, 15336, 16191, 16364 };
-static constexpr int32_t kHilbB[4] = {  6590, 14027, 15930, 16307 };
-
 // Drift (broadcast stations) — depth now set by CV In 2 (was Knob X). Q8 units.
 static constexpr int32_t  kMaxDrift_q8   = 256;        // applied as >>2 → ±64 counts
 static constexpr uint32_t kDriftProbMask = 0xFE000000u;
@@ -153,11 +161,9 @@ static constexpr int32_t kNoiseLpf[3] = { 200, 900, 28 };  // AM mid / SW bright
 // across bands. ~ 256 / lpf_gain(alpha): AM x6.3, SW x3.7, LW x12.2.
 static constexpr int32_t kNoiseGain[3] = { 1613, 752, 4400 };  // Q8 — matches new kNoiseLpf
 
-// Clip playback sample-rate fractions
-static constexpr int32_t kClipNum  = 8000;
-static constexpr int32_t kClipDen  = 48000;
-static constexpr int32_t kBcastNum = 13340;
-static constexpr int32_t kBcastDen = 48000;
+// Clip playback rates, as Q16 steps per 48kHz sample (= rate * 65536 / 48000)
+static constexpr int32_t kClipInc  = 10923;   // 8000Hz
+static constexpr int32_t kBcastInc = 18214;   // 13340Hz (Stations play a little fast)
 
 // ---------------------------------------------------------------------------
 // Sine table — 256-entry full cycle, int8 -127..127
@@ -242,10 +248,8 @@ class OffAir : public ComputerCard
     int32_t  stDc[5]       = {};   // per-station output DC block
     int32_t  stStrength[5] = {};   // signal strength for LED/CV/pulse
 
-    // --- Hilbert all-pass state: [station][section], two paths A/B ---
-    int32_t hilAx1[5][4]={}, hilAx2[5][4]={}, hilAy1[5][4]={}, hilAy2[5][4]={};
-    int32_t hilBx1[5][4]={}, hilBx2[5][4]={}, hilBy1[5][4]={}, hilBy2[5][4]={};
-    int32_t hilBdelay[5]={};  // path-B 1-sample delay (gives quadrature)
+    // --- IIR Hilbert quadrature pair per station (iir_hilbert.h, Q14 coeffs) ---
+    IirHilbert<14> hilbert[5];
 
     // --- Clip assignment shuffle (3 distinct from 6-clip bank per band) ---
     uint8_t  clipOrder[3] = { 0, 1, 2 };
@@ -254,14 +258,16 @@ class OffAir : public ComputerCard
 
     // --- One-shot (Pulse In 2): plays a curated clip once-through ---
     bool     pu2Prev   = false;
-    int32_t  osClip    = -1;       // -1 = idle, else index into the one-shot bank
-    uint32_t osPos     = 0;
-    int32_t  osFrac    = 0;
-    int32_t  osSample  = 0;
+    int32_t  osClip    = -1;       // -1 = idle, else clip number in the bank
+    uint32_t osLen     = 0;
 
     // --- Altboot flash ---
     int32_t altbootFlash = 24000;
 
+    // --- Built-in-bank blink on LED 4 ---
+    uint32_t ledTimer = 0;
+    bool     builtInBank = false;
+
     // --- Noise + slow swell/swish random walks ---
     int32_t bpY1 = 0;
     int32_t swellLevel  = 4096, swellTarget  = 4096;  // Q12 level multiplier walk
@@ -270,13 +276,13 @@ class OffAir : public ComputerCard
     // --- Knob X audio-brightness (IF bandwidth) tone LPF state ---
     int32_t toneState = 0;
 
-    // --- Clip playback ---
-    uint32_t intfPos[3]   = {};
-    int32_t  intfFrac[3]  = {};
-    int32_t  intfSamp[3]  = {};
-    uint32_t bcastPos[2]    = {};
-    int32_t  bcastFrac[2]   = {};
-    int32_t  bcastSample[2] = {};
+    // --- Clip playback: bank in flash, streams decoded by the background loop ---
+    ClipBank   bank;
+    ClipStream streams[kNumStreams];
+    uint32_t   rdPos[kNumStreams]  = {};   // samples popped from each stream
+    int32_t    rdFrac[kNumStreams] = {};   // Q16 position between rdPrev and rdNext
+    int32_t    rdPrev[kNumStreams] = {};
+    int32_t    rdNext[kNumStreams] = {};
 
     // --- RNG ---
     uint32_t rng = 1;
@@ -289,38 +295,37 @@ class OffAir : public ComputerCard
         return rng;
     }
 
-    int32_t __not_in_flash_func(stepBcast)(int ci)
+    // Start stream si on clip c (-1 = silence) from sample `start`.
+    void playStream(int si, int32_t c, uint32_t start, bool loop)
+    {
+        streams[si].play(c, start, loop);
+        rdPos[si] = 0; rdFrac[si] = 0; rdPrev[si] = 0; rdNext[si] = 0;
+    }
+
+    // Fractional-rate readout: step through stream si at inc (Q16 per output sample),
+    // interpolating linearly between clip samples. Returns 16-bit audio. If the decoder
+    // has fallen behind (or the clip has ended) the last sample is held, and rdPos only
+    // counts the samples actually popped.
+    int32_t __not_in_flash_func(readStream)(int si, int32_t inc)
     {
-        bcastFrac[ci] += kBcastNum;
-        if (bcastFrac[ci] >= kBcastDen) {
-            bcastFrac[ci] -= kBcastDen;
-            if (++bcastPos[ci] >= kBcastClips[ci].len) bcastPos[ci] = 0;
-            uint32_t p = bcastPos[ci];
-            const uint8_t* d = kBcastClips[ci].data;
+        rdFrac[si] += inc;
+        if (rdFrac[si] >= 65536) {
+            rdFrac[si] -= 65536;
+            rdPrev[si] = rdNext[si];
             int32_t s;
-            if ((p & 1) == 0) {
-                uint32_t b = (p >> 1) * 3;
-                s = ((int32_t)d[b] << 4) | (d[b+1] >> 4);
-            } else {
-                uint32_t b = (p >> 1) * 3;
-                s = (((int32_t)d[b+1] & 0xF) << 8) | d[b+2];
-            }
-            if (s >= 2048) s -= 4096;
-            bcastSample[ci] = s;
+            if (streams[si].pop(s)) { rdNext[si] = s; rdPos[si]++; }
         }
-        return bcastSample[ci];
+        return rdPrev[si] + (((rdNext[si] - rdPrev[si]) * (rdFrac[si] >> 4)) >> 12);
+    }
+
+    int32_t __not_in_flash_func(stepBcast)(int ci)
+    {
+        return readStream(ci, kBcastInc) >> 4;                    // ±2047
     }
 
     int32_t __not_in_flash_func(stepIntf)(int ci)
     {
-        const ClipDesc& c = kAllClips[clipOrder[ci]];
-        intfFrac[ci] += kClipNum;
-        if (intfFrac[ci] >= kClipDen) {
-            intfFrac[ci] -= kClipDen;
-            if (++intfPos[ci] >= c.len) intfPos[ci] = 0;
-            intfSamp[ci] = ((int32_t)c.data[intfPos[ci]] - 128) << 3;  // ±1020
-        }
-        return intfSamp[ci];
+        return readStream(kIntfStream + ci, kClipInc) >> 5;       // ±1023
     }
 
     // One-shot reader: plays the curated clip ONCE through at 8kHz, then stops.
@@ -329,35 +334,16 @@ class OffAir : public ComputerCard
     int32_t __not_in_flash_func(stepOneShot)()
     {
         if (osClip < 0) return 0;
-        const ClipDesc& c = (kNumOneShots > 0) ? kOneShotClips[osClip] : kAllClips[osClip];
-        osFrac += kClipNum;
-        if (osFrac >= kClipDen) {
-            osFrac -= kClipDen;
-            if (++osPos >= c.len) { osClip = -1; return 0; }   // played once → stop
-            osSample = ((int32_t)c.data[osPos] - 128) << 3;    // ±1020
-        }
+        int32_t osSample = readStream(kOsStream, kClipInc) >> 5;  // ±1023
+        uint32_t osPos = rdPos[kOsStream];
+        if (osPos >= osLen) { osClip = -1; return 0; }            // played once → stop
         // Linear fade-out over the last kOsFadeSamples of the clip.
-        int32_t remaining = (int32_t)c.len - (int32_t)osPos;
+        int32_t remaining = (int32_t)osLen - (int32_t)osPos;
         int32_t fade = 4096;
         if (remaining < kOsFadeSamples) fade = (remaining * 4096) / kOsFadeSamples;
         return ((osSample * fade) >> 12) >> kOsDuckShift;
     }
 
-    // One 4-section all-pass chain (in z^-2). y = (a2*(x+y2)>>14) - x2 per section.
-    int32_t __not_in_flash_func(hilbertChain)(
-        const int32_t* coeff, int32_t x,
-        int32_t* x1, int32_t* x2, int32_t* y1, int32_t* y2)
-    {
-        for (int k = 0; k < 4; k++) {
-            int32_t a2 = coeff[k];
-            int32_t y  = ((a2 * (x + y2[k])) >> 14) - x2[k];
-            x2[k] = x1[k]; x1[k] = x;
-            y2[k] = y1[k]; y1[k] = y;
-            x = y;
-        }
-        return x;
-    }
-
     // Assign random dial positions + clip selection. Called at startup + each band tap.
     void randomiseDial()
     {
@@ -378,25 +364,25 @@ class OffAir : public ComputerCard
         }
         for (int i = 0; i < kNumStations; i++) dialPos[i] = pos[idx[i]];
 
-        // Pick kNumClips distinct interference clips from the 6 available.
-        uint8_t pool[6] = { 0, 1, 2, 3, 4, 5 };
-        for (int i = 5; i > 0; i--) {
-            int j = (int)(rng_next() % (uint32_t)(i + 1));
+        // Pick kNumClips distinct interference clips from those in the bank (repeating
+        // if there are fewer).
+        int nIntf = bank.count(ClipBank::Interference);
+        uint8_t pool[ClipBank::kMaxClips];
+        for (int i = 0; i < nIntf; i++) pool[i] = (uint8_t)i;
+        for (int i = 0; i < kNumClips && i < nIntf; i++) {
+            int j = i + (int)(rng_next() % (uint32_t)(nIntf - i));
             uint8_t t = pool[i]; pool[i] = pool[j]; pool[j] = t;
         }
-        for (int i = 0; i < kNumClips; i++) clipOrder[i] = pool[i];
+        for (int i = 0; i < kNumClips; i++) clipOrder[i] = nIntf ? pool[i % nIntf] : 0;
 
         // Clear per-station DSP state.
         for (int i = 0; i < kNumStations; i++) {
             shiftPhase[i] = 0; detuneSm[i] = 0; stDc[i] = 0; stStrength[i] = 0;
-            hilBdelay[i] = 0;
-            for (int k = 0; k < 4; k++) {
-                hilAx1[i][k]=hilAx2[i][k]=hilAy1[i][k]=hilAy2[i][k]=0;
-                hilBx1[i][k]=hilBx2[i][k]=hilBy1[i][k]=hilBy2[i][k]=0;
-            }
+            hilbert[i].reset();
         }
         for (int i = 0; i < kNumClips; i++) {
-            intfPos[i] = 0; intfFrac[i] = 0; intfSamp[i] = 0;
+            int32_t c = nIntf ? bank.clip(ClipBank::Interference, clipOrder[i]) : -1;
+            playStream(kIntfStream + i, c, 0, true);
         }
     }
 
@@ -408,6 +394,22 @@ public:
         gpio_init(DEBUG_2);
         gpio_set_dir(DEBUG_2, GPIO_OUT);
         gpio_put(DEBUG_2, false);
+
+        // Clip bank from offair_clips.uf2: the last 256 bytes of flash hold its address.
+        const uint32_t flashEnd = XIP_BASE + PICO_FLASH_SIZE_BYTES - 256;
+        const uint32_t* dir = (const uint32_t*)flashEnd;
+        if (dir[1] >= 1 && dir[0] >= XIP_BASE && dir[0] < flashEnd)
+            bank.load((const uint8_t*)dir[0], flashEnd - dir[0]);
+        // None uploaded: the few short clips compiled in
+        if (!bank.valid())
+            builtInBank = bank.load(kFallbackBank, sizeof(kFallbackBank));
+    }
+
+    // Core 1, between audio interrupts: keep every playing clip's ring topped up.
+    void __not_in_flash_func(BackgroundLoop)() override
+    {
+        if (!bank.valid()) return;
+        for (int i = 0; i < kNumStreams; i++) streams[i].fill(bank);
     }
 
     void StageLed(int n) { LedBrightness(n, 4095); }
@@ -428,11 +430,17 @@ public:
                 LedBrightness(5, 4095);
                 return;
             }
-            altbootMode = (SwitchVal() == Switch::Down);
+            int32_t nStation = bank.count(ClipBank::Station);
+            altbootMode = (SwitchVal() == Switch::Down) && nStation > 0;
             mode_locked = true;
             downArmed   = false;
-            bcastPos[0] = 0;
-            bcastPos[1] = kBcastClips[1].len / 2;
+            if (altbootMode) {
+                // Station 2 starts halfway through its clip (the same clip, if only one)
+                int32_t c0 = bank.clip(ClipBank::Station, 0);
+                int32_t c1 = bank.clip(ClipBank::Station, nStation > 1 ? 1 : 0);
+                playStream(0, c0, 0, true);
+                playStream(1, c1, bank.samples(c1) / 2, true);
+            }
             randomiseDial();
             if (altbootMode) {
                 for (int i = 0; i < 6; i++) LedBrightness(i, 4095);
@@ -507,10 +515,13 @@ public:
         // -------------------------------------------------------------------
         bool pu2Now = PulseIn2();
         if (pu2Now && !pu2Prev) {
-            osClip   = (int32_t)(rng_next() % (uint32_t)(kNumOneShots > 0 ? kNumOneShots : 6));
-            osPos    = 0;
-            osFrac   = 0;
-            osSample = 0;
+            ClipBank::Kind k = bank.count(ClipBank::OneShot) > 0 ? ClipBank::OneShot
+                                                                 : ClipBank::Interference;
+            if (bank.count(k) > 0) {
+                osClip = bank.clip(k, (int)(rng_next() % (uint32_t)bank.count(k)));
+                osLen  = bank.samples(osClip);
+                playStream(kOsStream, osClip, 0, false);
+            }
         }
         pu2Prev = pu2Now;
 
@@ -583,19 +594,18 @@ public:
             // pitch shifts up one side, down the other). AM uses |detune| (symmetric).
             int32_t phaseStep = pitchShift ? ds : ad;
             shiftPhase[i] += (uint32_t)(phaseStep * kWhistleK_phaseInc);
-            int32_t c = icos(shiftPhase[i]);   // ±127, =127 at phase 0 (detune→0)
-            int32_t s = isin(shiftPhase[i]);   // ±127, =0   at phase 0
+            int32_t c = icos(shiftPhase[i]);   // ±127, =127 at phase 0 (detune→0): whistle
 
             int32_t shifted;
             if (pitchShift) {
-                // SSB single-sideband shift: I/Q from Hilbert pair, complex mix.
+                // SSB single-sideband shift: I/Q from Hilbert pair, complex mix with
+                // the interpolated Q15 sin/cos (the ±127 table's spurs would be heard).
                 // Audio is genuinely frequency-shifted by detune → "wrong pitch".
-                int32_t I = hilbertChain(kHilbA, aud[i],
-                                         hilAx1[i], hilAx2[i], hilAy1[i], hilAy2[i]);
-                int32_t Braw = hilbertChain(kHilbB, aud[i],
-                                            hilBx1[i], hilBx2[i], hilBy1[i], hilBy2[i]);
-                int32_t Q = hilBdelay[i]; hilBdelay[i] = Braw;   // +1 sample → quadrature
-                shifted = (I * c - Q * s) >> 7;
+                int32_t I, Q;
+                hilbert[i].process(aud[i], I, Q);
+                int32_t c15 = sinQ15(shiftPhase[i] + 0x40000000u);
+                int32_t s15 = sinQ15(shiftPhase[i]);
+                shifted = (I * c15 - Q * s15) >> 15;
             } else {
                 // AM envelope detection: audio stays at CORRECT PITCH. Off-tune, a real
                 // envelope detector distorts (sideband imbalance) — emulate with a
@@ -751,7 +761,9 @@ public:
             // Band: both off = AM, LED2 = SW, LED3 = LW
             LedBrightness(2, band == 1 ? 4095 : 0);
             LedBrightness(3, band == 2 ? 4095 : 0);
-            LedBrightness(4, 0);
+            // LED 4 blinks (~0.7s on, ~0.7s off) while playing the built-in clips
+            ledTimer++;
+            LedBrightness(4, (!bank.valid() || builtInBank) && (ledTimer & 0x8000) ? 4095 : 0);
             LedBrightness(5, (uint16_t)tunePos);
         }
 
@@ -0,0 +1,104 @@
+// cathode_host — Linux harness for Cathode Ray's Core-1 video pipeline.
+//
+// Compiles the real main.cpp (-DCATHODE_HOST swaps the SDK for host_shim.h), feeds the
+// Core-0 ProcessSample() with synthetic knob/CV/audio/pulse signals at 48 kHz, and runs
+// the same per-frame sequence as core1_main() (video_draw + video_encode). For every
+// scene it reports the expand+encode cost per frame with incremental (dirty-row)
+// encoding and with the old every-row path, and checks that the incremental word
+// stream is bit-identical to a from-scratch reference encode of the same picture.
+//
+//   ./cathode_host                      all scenes, both encode modes, 200 frames
+//   ./cathode_host -n 500 etch scope    selected scenes
+//   ./cathode_host -p out boing         also write out/boing_NNNN.pgm (framebuffer)
+#include "../main.cpp"
+
+#include "harness.h"
+
+#include <chrono>
+
+struct Result {
+    double draw_us, enc_us, enc_max_us, rows;
+    long mismatches;
+};
+
+static int popcount_rows(const uint32_t *mask) {
+    int n = 0;
+    for (int i = 0; i < FB_DIRTY_WORDS; i++) n += __builtin_popcount(mask[i]);
+    return n;
+}
+
+static Result run_scene(const Scene &sc, bool incremental, int frames, const char *pgm_dir) {
+    using clock = std::chrono::steady_clock;
+    video_incremental = incremental;
+    video_init_buffers();
+
+    SampleClock clk;
+    boot_scene(sc, clk, video_frame);
+
+    Result r = {0, 0, 0, 0, 0};
+    for (int f = 0; f < frames; f++) {
+        feed_samples(sc, clk.t, clk.next(), false);
+        auto t0 = clock::now();
+        video_draw();
+        auto t1 = clock::now();
+        int back = 1 - active_buf;
+        video_encode();
+        auto t2 = clock::now();
+        double d = std::chrono::duration<double, std::micro>(t1 - t0).count();
+        double e = std::chrono::duration<double, std::micro>(t2 - t1).count();
+        r.draw_us += d;
+        r.enc_us += e;
+        if (e > r.enc_max_us) r.enc_max_us = e;
+
+        // Framebuffer rows that changed this frame (still owed to the other buffer).
+        r.rows += incremental ? popcount_rows(fb_row_dirty[1 - back]) : TV_ACTIVE_LINES;
+
+        reference_expand();
+        if (memcmp(ref_fb, frame_buffer, FB_SIZE) != 0) r.mismatches++;
+        reference_encode(ref_fb, effect_invert);
+        if (memcmp(ref_words, word_buf[back], FRAME_WORDS * 4) != 0) r.mismatches++;
+
+        if (pgm_dir) write_pgm(pgm_dir, sc.name, f);
+    }
+    r.draw_us /= frames;
+    r.enc_us /= frames;
+    r.rows /= frames;
+    return r;
+}
+
+int main(int argc, char **argv) {
+    int frames = 200;
+    const char *pgm_dir = nullptr;
+    std::vector<const Scene *> pick;
+    for (int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        if (a == "-n" && i + 1 < argc) frames = atoi(argv[++i]);
+        else if (a == "-p" && i + 1 < argc) pgm_dir = argv[++i];
+        else if (!pick_scene(a, pick)) {
+            fprintf(stderr, "usage: %s [-n frames] [-p pgm_dir] [scene...]\n", argv[0]);
+            list_scenes();
+            return 2;
+        }
+    }
+    if (pick.empty()) for (int s = 0; s < NUM_SCENES; s++) pick.push_back(&SCENES[s]);
+
+#ifdef TV_NTSC
+    printf("NTSC  %d frames/scene, %d words/frame\n", frames, FRAME_WORDS);
+#else
+    printf("PAL   %d frames/scene, %d words/frame\n", frames, FRAME_WORDS);
+#endif
+    printf("%-14s %9s | %9s %9s | %9s %9s %7s | %s\n", "scene", "draw us",
+           "full us", "max", "incr us", "max", "rows", "check");
+    int failures = 0;
+    for (const Scene *sc : pick) {
+        const Result failed = {0, 0, 0, 0, -1};
+        Result full = run_isolated([&] { return run_scene(*sc, false, frames, nullptr); }, failed);
+        Result incr = run_isolated([&] { return run_scene(*sc, true, frames, pgm_dir); }, failed);
+        bool ok = full.mismatches == 0 && incr.mismatches == 0;
+        if (!ok) failures++;
+        printf("%-14s %9.1f | %9.1f %9.1f | %9.1f %9.1f %7.1f | %s\n", sc->name, incr.draw_us,
+               full.enc_us, full.enc_max_us, incr.enc_us, incr.enc_max_us, incr.rows,
+               ok ? "ok" : "MISMATCH");
+    }
+    return failures ? 1 : 0;
+}
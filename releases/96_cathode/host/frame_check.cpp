@@ -0,0 +1,116 @@
+// frame_check — renders Cathode Ray's screens on Linux and checks the signal a TV would get.
+//
+// Every frame of every scene goes through the real Core-1 sequence (video_draw +
+// video_encode). The finished word stream is then decoded pair by pair: line and field
+// timing are measured from the sync edges and checked against LINE_TOTAL_PX /
+// TV_TOTAL_LINES / the pulse widths and the PAL/NTSC nominals, and the active window is
+// cut back out and compared with frame_buffer. Per scene it reports the cost of
+// update_framebuffer() — the mode's own drawing, menus included — so heavy modes
+// (3DMAZE, PATCHTEROIDS) can be optimised against a baseline, and which frame was worst.
+//
+//   ./frame_check                        all scenes, 200 frames
+//   ./frame_check -n 50 -o out 3dmaze    + out/3dmaze_NNNN.pgm, the decoded picture
+//   ./frame_check -raster -o out etch    + the whole decoded raster (sync, blanking)
+#include "../main.cpp"
+
+#include "harness.h"
+
+#include <chrono>
+
+struct Result {
+    double draw_us, draw_p95, draw_max;
+    int worst_frame;
+    long bad_timing, bad_picture;
+    char err[128];
+};
+
+static Result run_scene(const Scene &sc, int frames, const char *out_dir, bool raster) {
+    using clock = std::chrono::steady_clock;
+    video_init_buffers();
+
+    SampleClock clk;
+    boot_scene(sc, clk, video_frame);
+
+    Result r = {};
+    std::vector<double> draw(frames);
+    for (int f = 0; f < frames; f++) {
+        feed_samples(sc, clk.t, clk.next(), false);
+        auto t0 = clock::now();
+        video_draw();
+        auto t1 = clock::now();
+        bool invert = effect_invert;
+        video_encode();
+        draw[f] = std::chrono::duration<double, std::micro>(t1 - t0).count();
+        r.draw_us += draw[f];
+        if (draw[f] > r.draw_max) { r.draw_max = draw[f]; r.worst_frame = f; }
+
+        // active_buf is the buffer the next DMA restart scans out.
+        decode_stream(word_buf[active_buf], FRAME_WORDS);
+        Timing t;
+        if (!check_timing(t)) {
+            if (!r.bad_timing++) snprintf(r.err, sizeof r.err, "frame %d: %s", f, t.err);
+            continue;
+        }
+        decode_picture();
+        if (picture_mismatches(frame_buffer, invert)) {
+            if (!r.bad_timing && !r.bad_picture) snprintf(r.err, sizeof r.err, "frame %d: picture", f);
+            r.bad_picture++;
+        }
+        if (out_dir) write_decoded_pgm(out_dir, sc.name, f, raster);
+    }
+    r.draw_us /= frames;
+    std::sort(draw.begin(), draw.end());
+    r.draw_p95 = draw[frames * 95 / 100];
+    return r;
+}
+
+int main(int argc, char **argv) {
+    int frames = 200;
+    const char *out_dir = nullptr;
+    bool raster = false;
+    std::vector<const Scene *> pick;
+    for (int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        if (a == "-n" && i + 1 < argc) frames = atoi(argv[++i]);
+        else if (a == "-o" && i + 1 < argc) out_dir = argv[++i];
+        else if (a == "-raster") raster = true;
+        else if (!pick_scene(a, pick)) {
+            fprintf(stderr, "usage: %s [-n frames] [-o pgm_dir] [-raster] [scene...]\n", argv[0]);
+            list_scenes();
+            return 2;
+        }
+    }
+    if (frames < 1) frames = 1;
+    if (pick.empty()) for (int s = 0; s < NUM_SCENES; s++) pick.push_back(&SCENES[s]);
+
+    // The raster of the blank start-up frame, as measured from the decoded stream.
+    video_init_buffers();
+    decode_stream(word_buf[active_buf], FRAME_WORDS);
+    Timing t;
+    bool blank_ok = check_timing(t);
+#ifdef TV_NTSC
+    printf("NTSC  ");
+#else
+    printf("PAL   ");
+#endif
+    printf("%d px × %d lines (%d words), %.3f MHz: line %.3f µs, h-sync %.3f µs, "
+           "broad %.3f µs, field %.3f Hz, wrap line +%d px\n", t.line_min, t.lines, FRAME_WORDS,
+           144.0 / VIDEO_CLKDIV, t.line_us, t.hs_us, px_us(t.vs_max), t.field_hz,
+           t.wrap_px - t.line_max);
+    if (!blank_ok) printf("start-up frame: %s\n", t.err);
+    printf("%d frames/scene\n\n", frames);
+
+    printf("%-14s %9s %9s %9s %6s | %s\n", "scene", "draw us", "p95", "max", "@frame", "check");
+    int failures = blank_ok ? 0 : 1;
+    for (const Scene *sc : pick) {
+        Result failed = {};
+        failed.bad_timing = -1;
+        snprintf(failed.err, sizeof failed.err, "crashed");
+        Result r = run_isolated([&] { return run_scene(*sc, frames, out_dir, raster); }, failed);
+        bool ok = r.bad_timing == 0 && r.bad_picture == 0;
+        if (!ok) failures++;
+        printf("%-14s %9.1f %9.1f %9.1f %6d | %s\n", sc->name, r.draw_us, r.draw_p95,
+               r.draw_max, r.worst_frame, ok ? "ok" : r.err);
+    }
+    return failures ? 1 : 0;
+}
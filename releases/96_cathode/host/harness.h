@@ -0,0 +1,360 @@
+// harness.h — pieces shared by the host harnesses (cathode_host, scanline_sim, frame_check).
+//
+// Include after "../main.cpp": the scene table and input generator that drive the card's
+// ProcessSample(), the naive reference encoder every packed word stream is checked
+// against, the word-stream decoder / timing check, PGM output, and the fork-per-scene
+// runner.
+#pragma once
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <sys/wait.h>
+#include <unistd.h>
+
+static CathodeRay card;
+
+// ─── Scenes ──────────────────────────────────────────────────────────────────
+// Each scene sets the panel once and then generates inputs per sample. alt >= 0 boots
+// into the alt-boot selector (switch DOWN through the ADC settle) and plays that mode;
+// with the switch UP it stays on the selector. A normal-mode scene with the switch DOWN
+// boots in MIDDLE, then holds DOWN and sweeps knob X, which opens the config menu.
+struct Scene {
+    const char *name;
+    int32_t knob_main, knob_x, knob_y;
+    ComputerCard::Switch sw;
+    int alt;
+};
+
+static const Scene SCENES[] = {
+    {"etch",         600,  2048, 2048, ComputerCard::Up,     -1},  // static strokes
+    {"etch-fade",    600,  2048, 2048, ComputerCard::Middle, -1},  // phosphor fade
+    {"scope",        2000, 2048, 2048, ComputerCard::Up,     -1},
+    {"scope-fade",   2000, 2048, 2048, ComputerCard::Middle, -1},
+    {"spectrum-bar", 3500, 2048, 2800, ComputerCard::Up,     -1},
+    {"spectrum-blob",3500, 2048, 2800, ComputerCard::Middle, -1},
+    {"comet",        2048, 2048, 2048, ComputerCard::Middle,  0},
+    {"patchteroids", 2048, 2048, 2048, ComputerCard::Middle,  1},
+    {"boing",        2048, 2048, 2048, ComputerCard::Middle,  2},
+    {"starfield",    2048, 2048, 2048, ComputerCard::Middle,  3},
+    {"radar",        2048, 2048, 2048, ComputerCard::Middle,  4},
+    {"lunar",        2048, 2048, 2048, ComputerCard::Middle,  5},
+    {"3dmaze",       2048, 3000, 2048, ComputerCard::Middle,  6},
+    {"fourtrig",     2048, 2048, 2048, ComputerCard::Middle,  7},
+    {"alt-menu",     2600, 2048, 2048, ComputerCard::Up,      0},  // draw_alt_menu
+    {"config-menu",  2048, 2048, 2048, ComputerCard::Down,   -1},  // draw_menu
+};
+#define NUM_SCENES ((int)(sizeof(SCENES) / sizeof(SCENES[0])))
+
+// Collect scene names from argv (anything not consumed by the caller's options).
+static bool pick_scene(const std::string &a, std::vector<const Scene *> &pick) {
+    for (int s = 0; s < NUM_SCENES; s++)
+        if (a == SCENES[s].name) { pick.push_back(&SCENES[s]); return true; }
+    return false;
+}
+
+static void list_scenes() {
+    fprintf(stderr, "scenes:");
+    for (int s = 0; s < NUM_SCENES; s++) fprintf(stderr, " %s", SCENES[s].name);
+    fprintf(stderr, "\n");
+}
+
+// 48 kHz samples per video frame (PAL 958.5, NTSC 799.5 — alternate the rounding).
+static const double SAMPLES_PER_FRAME =
+    48000.0 * VIDEO_CLKDIV * LINE_TOTAL_PX * TV_TOTAL_LINES / 144000000.0;
+
+static void feed_samples(const Scene &sc, uint64_t &t, int n, bool booting) {
+    const bool menu = sc.alt < 0 && sc.sw == ComputerCard::Down;
+    for (int i = 0; i < n; i++, t++) {
+        double s = (double)t / 48000.0;
+        card.in_knob[0] = sc.knob_main;
+        card.in_knob[1] = menu ? sc.knob_x + (int32_t)(900.0 * std::sin(2 * M_PI * 0.3 * s))
+                               : sc.knob_x;
+        card.in_knob[2] = sc.knob_y;
+        if (booting) card.in_switch = sc.alt >= 0 ? ComputerCard::Down : ComputerCard::Middle;
+        else         card.in_switch = sc.sw;
+        // Slow Lissajous on the CV inputs (etch), a tone + harmonics on Audio In 1,
+        // clicks on Audio In 2, and a 4 Hz / 3 Hz pulse pair (triggers / fire buttons).
+        card.in_cv[0] = (int16_t)(1500.0 * std::sin(2 * M_PI * 0.7 * s));
+        card.in_cv[1] = (int16_t)(1500.0 * std::sin(2 * M_PI * 1.1 * s + 0.5));
+        card.in_audio[0] = (int16_t)(900.0 * std::sin(2 * M_PI * 220.0 * s)
+                                   + 400.0 * std::sin(2 * M_PI * 1320.0 * s)
+                                   + 200.0 * std::sin(2 * M_PI * 5000.0 * s));
+        card.in_audio[1] = (int16_t)(((t % 12000) < 200) ? 1500 : 0);
+        card.in_pulse[0] = (t % 12000) < 480;
+        card.in_pulse[1] = (t % 16000) < 480;
+        card.Tick();
+    }
+}
+
+// Per-frame sample feed with the fractional remainder carried between frames.
+struct SampleClock {
+    uint64_t t = 0;
+    double frac = 0;
+    int next() {
+        frac += SAMPLES_PER_FRAME;
+        int n = (int)frac;
+        frac -= n;
+        return n;
+    }
+};
+
+// Boot: hold for the ADC settle (alt scenes hold DOWN → alt-boot latches, the rest hold
+// MIDDLE). `frame` is the per-frame Core-1 step of the build under test.
+template <typename F>
+static void boot_scene(const Scene &sc, SampleClock &clk, F frame) {
+    const int boot_frames = 10;
+    for (int f = 0; f < boot_frames; f++) {
+        feed_samples(sc, clk.t, clk.next(), true);
+        if (sc.alt >= 0) alt_select = sc.alt;
+        frame();
+    }
+}
+
+// ─── Reference encoder ───────────────────────────────────────────────────────
+// Independent, deliberately naive packer: the whole frame pixel by pixel from scratch,
+// straight from the timing constants. Every packed stream must match it exactly.
+static uint32_t ref_words[FRAME_WORDS_MAX];
+static uint8_t  ref_fb[FB_SIZE];
+
+static void reference_encode(const uint8_t *fb, bool invert) {
+    int wi = 0, bits = 0;
+    uint32_t cur = 0;
+    auto put = [&](Level l) {
+        cur = (cur << 2) | (level_pair[l] & 0x3);
+        if ((bits += 2) == 32) { ref_words[wi++] = cur; cur = 0; bits = 0; }
+    };
+    for (int line = 0; line < TV_TOTAL_LINES; line++) {
+        int active = line - TV_VSYNC_LINES - TV_BLANK_TOP;
+        bool vs = line < TV_VSYNC_LINES;
+        for (int x = 0; x < LINE_TOTAL_PX; x++) {
+            Level l = BLACK;
+            if (vs) {
+                if (x >= LINE_FP_PX && x < LINE_FP_PX + VSYNC_LOW_PX) l = SYNC;
+            } else if (x >= LINE_FP_PX && x < LINE_FP_PX + LINE_HS_PX) {
+                l = SYNC;
+            } else if (active >= 0 && active < TV_ACTIVE_LINES) {
+                int p = x - (LINE_FP_PX + LINE_HS_PX + LINE_BP_PX);
+                if (p >= 0 && p < FB_WIDTH) {
+                    const uint8_t *row = &fb[(TV_ACTIVE_ROW0 + active) * FB_STRIDE];
+                    bool set = (row[p >> 3] >> (7 - (p & 7))) & 1u;
+                    if (set != invert) l = WHITE;
+                }
+            }
+            put(l);
+        }
+    }
+    while (bits) put(BLACK);
+    while (wi < FRAME_WORDS) {
+        for (int i = 0; i < 16; i++) put(BLACK);
+    }
+}
+
+// Expand the whole grey buffer from scratch into ref_fb; the dirty-row expand must agree.
+static void reference_expand() {
+    for (int gy = 0; gy < GREY_H; gy++) expand_grey_row(gy, &ref_fb[gy * GREY_SCALE * FB_STRIDE]);
+}
+
+// ─── Word-stream decoder + timing check ──────────────────────────────────────
+// Reads a packed stream the way the PIO and DAC do (2 bits per pixel, MSB first) and maps
+// each pair back through level_pair[], so it knows nothing about how the stream was built.
+// check_timing() measures the raster from the sync edges alone and holds it against the
+// format constants and the broadcast nominals; decode_picture() cuts the active window
+// back out of each line, relative to that line's measured sync edge.
+#define DEC_BAD 3                        // a pair level_pair[] never produces
+static uint8_t dec_level[FRAME_WORDS_MAX * 16];
+static int     dec_edge[FRAME_WORDS_MAX * 16 / LINE_HS_PX + 1];   // sync leading edges
+static int     dec_px;
+
+#ifdef TV_NTSC
+static const double STD_LINE_US = 63.556, STD_FIELD_HZ = 59.94;
+#else
+static const double STD_LINE_US = 64.0,   STD_FIELD_HZ = 50.0;
+#endif
+static const double STD_HS_US = 4.7;
+
+static double px_us(double px) { return px * VIDEO_CLKDIV / 144.0; }
+
+static void decode_stream(const uint32_t *words, int nwords) {
+    uint8_t inv[4] = {DEC_BAD, DEC_BAD, DEC_BAD, DEC_BAD};
+    for (int l = SYNC; l <= WHITE; l++) inv[level_pair[l] & 0x3] = (uint8_t)l;
+    dec_px = nwords * 16;
+    for (int i = 0; i < dec_px; i++)
+        dec_level[i] = inv[(words[i >> 4] >> (30 - 2 * (i & 15))) & 0x3];
+}
+
+struct Timing {
+    int lines, broad;              // sync edges per frame / how many were broad (vsync)
+    int line_min, line_max;        // edge-to-edge px, not counting the frame-wrap line
+    int wrap_px;                   // last edge → first edge of the next frame
+    int hs_min, hs_max;            // h-sync width px
+    int vs_min, vs_max;            // broad pulse width px
+    int bad_px, stray_white;       // undefined pairs / white outside the active window
+    double line_us, hs_us, field_hz;
+    char err[96];                  // first failure, "" if the frame is good
+};
+
+// Measure the decoded frame. Exact checks against LINE_TOTAL_PX, TV_TOTAL_LINES and the
+// pulse widths; the µs / Hz figures must also sit near the PAL/NTSC nominals (the raster
+// is progressive — 312/262 whole lines — so the field rate is a little above nominal).
+static bool check_timing(Timing &t) {
+    memset(&t, 0, sizeof t);
+    t.line_min = t.hs_min = t.vs_min = INT_MAX;
+    auto fail = [&](const char *what, int got, int want) {
+        if (!t.err[0]) snprintf(t.err, sizeof t.err, "%s %d (want %d)", what, got, want);
+    };
+    const int edge_max = (int)(sizeof dec_edge / sizeof dec_edge[0]);
+    int in_place = 0;                                 // broad pulses on lines 0..VSYNC-1
+
+    for (int i = 0; i < dec_px;) {
+        if (dec_level[i] != SYNC) { t.bad_px += dec_level[i] == DEC_BAD; i++; continue; }
+        int j = i;
+        while (j < dec_px && dec_level[j] == SYNC) j++;
+        int w = j - i;
+        bool broad = w >= LINE_TOTAL_PX / 4;
+        if (broad) {
+            t.broad++;
+            t.vs_min = std::min(t.vs_min, w); t.vs_max = std::max(t.vs_max, w);
+        } else {
+            t.hs_min = std::min(t.hs_min, w); t.hs_max = std::max(t.hs_max, w);
+        }
+        if (broad && t.lines < TV_VSYNC_LINES) in_place++;
+        if (t.lines < edge_max) dec_edge[t.lines] = i;
+        t.lines++;
+        i = j;
+    }
+    if (t.lines != TV_TOTAL_LINES) { fail("lines", t.lines, TV_TOTAL_LINES); return false; }
+
+    for (int l = 0; l + 1 < t.lines; l++) {
+        int p = dec_edge[l + 1] - dec_edge[l];
+        t.line_min = std::min(t.line_min, p); t.line_max = std::max(t.line_max, p);
+    }
+    const int pad = dec_px - LINE_TOTAL_PX * TV_TOTAL_LINES;   // FRAME_WORDS round-up
+    t.wrap_px = dec_edge[0] + dec_px - dec_edge[t.lines - 1];
+
+    // Active window: white only on the active lines, inside the FB_WIDTH pixels after
+    // the back porch (the padding at the end of the frame counts as the last line).
+    const int first = TV_VSYNC_LINES + TV_BLANK_TOP;
+    const int x0 = LINE_FP_PX + LINE_HS_PX + LINE_BP_PX;
+    for (int l = 0; l < t.lines; l++) {
+        int s = dec_edge[l] - LINE_FP_PX;
+        int e = l + 1 < t.lines ? dec_edge[l + 1] - LINE_FP_PX : dec_px;
+        bool active = l >= first && l < first + TV_ACTIVE_LINES;
+        for (int i = std::max(s, 0); i < e; i++)
+            if (dec_level[i] == WHITE && !(active && i - s >= x0 && i - s < x0 + FB_WIDTH))
+                t.stray_white++;
+    }
+
+    t.line_us = px_us(LINE_TOTAL_PX);
+    t.hs_us = px_us(t.hs_max);
+    t.field_hz = 144e6 / VIDEO_CLKDIV / dec_px;
+
+    if (dec_edge[0] != LINE_FP_PX) fail("first sync edge at px", dec_edge[0], LINE_FP_PX);
+    if (t.line_min != LINE_TOTAL_PX) fail("line px", t.line_min, LINE_TOTAL_PX);
+    if (t.line_max != LINE_TOTAL_PX) fail("line px", t.line_max, LINE_TOTAL_PX);
+    if (pad < 0 || pad > 15) fail("frame padding px", pad, 0);
+    if (t.wrap_px != LINE_TOTAL_PX + pad) fail("wrap line px", t.wrap_px, LINE_TOTAL_PX + pad);
+    if (t.broad != TV_VSYNC_LINES) fail("broad pulses", t.broad, TV_VSYNC_LINES);
+    if (in_place != TV_VSYNC_LINES) fail("broad pulses on the vsync lines", in_place, TV_VSYNC_LINES);
+    if (t.vs_min != VSYNC_LOW_PX || t.vs_max != VSYNC_LOW_PX)
+        fail("broad pulse px", t.vs_min != VSYNC_LOW_PX ? t.vs_min : t.vs_max, VSYNC_LOW_PX);
+    if (t.hs_min != LINE_HS_PX || t.hs_max != LINE_HS_PX)
+        fail("h-sync px", t.hs_min != LINE_HS_PX ? t.hs_min : t.hs_max, LINE_HS_PX);
+    if (t.bad_px) fail("undefined level px", t.bad_px, 0);
+    if (t.stray_white) fail("white px outside the active window", t.stray_white, 0);
+    if (std::fabs(t.line_us / STD_LINE_US - 1) > 0.001)
+        fail("line period ns", (int)lround(t.line_us * 1000), (int)lround(STD_LINE_US * 1000));
+    if (std::fabs(t.hs_us - STD_HS_US) > 0.2)
+        fail("h-sync ns", (int)lround(t.hs_us * 1000), (int)lround(STD_HS_US * 1000));
+    if (std::fabs(t.field_hz / STD_FIELD_HZ - 1) > 0.005)
+        fail("field mHz", (int)lround(t.field_hz * 1000), (int)lround(STD_FIELD_HZ * 1000));
+    return !t.err[0];
+}
+
+// The picture as the TV shows it (FB_WIDTH × TV_ACTIVE_LINES, 1 = white), cut out of the
+// last checked frame. Only valid after check_timing() found TV_TOTAL_LINES edges.
+static uint8_t dec_picture[FB_WIDTH * TV_ACTIVE_LINES];
+
+static void decode_picture() {
+    const int first = TV_VSYNC_LINES + TV_BLANK_TOP;
+    for (int r = 0; r < TV_ACTIVE_LINES; r++) {
+        int s = dec_edge[first + r] + LINE_HS_PX + LINE_BP_PX;
+        for (int c = 0; c < FB_WIDTH; c++) dec_picture[r * FB_WIDTH + c] = dec_level[s + c] == WHITE;
+    }
+}
+
+// Rows of dec_picture that differ from frame_buffer (XOR invert) — the round trip.
+static int picture_mismatches(const uint8_t *fb, bool invert) {
+    int bad = 0;
+    for (int r = 0; r < TV_ACTIVE_LINES; r++) {
+        const uint8_t *row = &fb[(TV_ACTIVE_ROW0 + r) * FB_STRIDE];
+        for (int c = 0; c < FB_WIDTH; c++)
+            if (dec_picture[r * FB_WIDTH + c] != (((row[c >> 3] >> (7 - (c & 7))) & 1) != invert)) {
+                bad++;
+                break;
+            }
+    }
+    return bad;
+}
+
+// ─── Output ──────────────────────────────────────────────────────────────────
+static void write_pgm(const char *dir, const char *scene, int frame) {
+    char path[512];
+    snprintf(path, sizeof path, "%s/%s_%04d.pgm", dir, scene, frame);
+    FILE *f = fopen(path, "wb");
+    if (!f) { perror(path); return; }
+    fprintf(f, "P5\n%d %d\n255\n", FB_WIDTH, FB_HEIGHT);
+    for (int r = 0; r < FB_HEIGHT; r++)
+        for (int c = 0; c < FB_WIDTH; c++)
+            fputc(((frame_buffer[r * FB_STRIDE + (c >> 3)] >> (7 - (c & 7))) & 1) ? 255 : 0, f);
+    fclose(f);
+}
+
+// The decoded stream: the picture only (FB_WIDTH × TV_ACTIVE_LINES), or with `raster` the
+// whole frame, one line per row from its sync edge (sync 0, blanking 64, white 255,
+// undefined pairs 128; the frame's padding pixels are dropped).
+static void write_decoded_pgm(const char *dir, const char *scene, int frame, bool raster) {
+    char path[512];
+    snprintf(path, sizeof path, "%s/%s_%04d.pgm", dir, scene, frame);
+    FILE *f = fopen(path, "wb");
+    if (!f) { perror(path); return; }
+    if (raster) {
+        static const uint8_t grey[4] = {0, 64, 255, 128};
+        fprintf(f, "P5\n%d %d\n255\n", LINE_TOTAL_PX, TV_TOTAL_LINES);
+        for (int l = 0; l < TV_TOTAL_LINES; l++)
+            for (int x = 0; x < LINE_TOTAL_PX; x++) {
+                int i = dec_edge[l] - LINE_FP_PX + x;
+                fputc(i >= 0 && i < dec_px ? grey[dec_level[i]] : 128, f);
+            }
+    } else {
+        fprintf(f, "P5\n%d %d\n255\n", FB_WIDTH, TV_ACTIVE_LINES);
+        for (int i = 0; i < FB_WIDTH * TV_ACTIVE_LINES; i++) fputc(dec_picture[i] ? 255 : 0, f);
+    }
+    fclose(f);
+}
+
+// Run fn() in a forked child so the card's static state starts fresh for every scene;
+// the child hands back a plain-old-data result through a pipe. `failed` is returned if
+// the child dies.
+template <typename R, typename F>
+static R run_isolated(F fn, const R &failed) {
+    int fd[2];
+    R r = failed;
+    if (pipe(fd) != 0) return r;
+    pid_t pid = fork();
+    if (pid == 0) {
+        close(fd[0]);
+        R cr = fn();
+        if (write(fd[1], &cr, sizeof cr) != (ssize_t)sizeof cr) _exit(2);
+        _exit(0);
+    }
+    close(fd[1]);
+    if (read(fd[0], &r, sizeof r) != (ssize_t)sizeof r) r = failed;
+    close(fd[0]);
+    waitpid(pid, nullptr, 0);
+    return r;
+}
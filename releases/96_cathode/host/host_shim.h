@@ -0,0 +1,116 @@
+// host_shim.h — just enough of the Pico SDK + ComputerCard to compile main.cpp on Linux.
+//
+// Included by main.cpp instead of the real SDK headers when built with -DCATHODE_HOST
+// (see host/Makefile). The PIO/DMA/IRQ calls in core1_main() become no-ops; the host
+// harness never calls core1_main(), it drives the video functions directly (the scanline
+// build also plays the DMA itself, via dma_hw->ch[].read_addr and the IRQ handler).
+// ComputerCard is replaced by a plain class whose inputs the harness sets before each
+// ProcessSample().
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+typedef unsigned int uint;
+
+#define __not_in_flash_func(f) f
+
+static inline void tight_loop_contents() {}
+static inline bool set_sys_clock_khz(uint32_t, bool) { return true; }
+
+// ─── GPIO / PIO ──────────────────────────────────────────────────────────────
+enum gpio_function { GPIO_FUNC_PIO0 = 6 };
+static inline void gpio_set_function(uint, gpio_function) {}
+
+struct pio_hw_t { uint32_t txf[4]; };
+typedef pio_hw_t *PIO;
+static pio_hw_t host_pio0;
+#define pio0 (&host_pio0)
+
+struct pio_program_t { int dummy; };
+static const pio_program_t video_out_program = {0};
+struct pio_sm_config { int dummy; };
+static inline uint pio_add_program(PIO, const pio_program_t *) { return 0; }
+static inline pio_sm_config video_out_program_get_default_config(uint) { return pio_sm_config{0}; }
+static inline void sm_config_set_out_pins(pio_sm_config *, uint, uint) {}
+static inline void sm_config_set_out_shift(pio_sm_config *, bool, bool, uint) {}
+static inline void sm_config_set_clkdiv(pio_sm_config *, float) {}
+enum pio_fifo_join { PIO_FIFO_JOIN_NONE = 0, PIO_FIFO_JOIN_TX = 1, PIO_FIFO_JOIN_RX = 2 };
+static inline void sm_config_set_fifo_join(pio_sm_config *, pio_fifo_join) {}
+static inline void pio_sm_set_consecutive_pindirs(PIO, uint, uint, uint, bool) {}
+static inline void pio_sm_init(PIO, uint, uint, const pio_sm_config *) {}
+static inline void pio_sm_set_enabled(PIO, uint, bool) {}
+static inline uint pio_get_dreq(PIO, uint, bool) { return 0; }
+
+// ─── DMA / IRQ / multicore ───────────────────────────────────────────────────
+enum dma_channel_transfer_size { DMA_SIZE_8 = 0, DMA_SIZE_16 = 1, DMA_SIZE_32 = 2 };
+struct dma_channel_config { uint32_t ctrl; };
+// Addresses are uintptr_t (not io_rw_32) so a 64-bit host can keep real pointers in them.
+struct dma_channel_hw_t { volatile uintptr_t read_addr; volatile uintptr_t al3_read_addr_trig; };
+struct dma_hw_t { dma_channel_hw_t ch[12]; volatile uint32_t ints1; };
+static dma_hw_t host_dma_hw;
+#define dma_hw (&host_dma_hw)
+#define DMA_IRQ_1 12
+static inline void dma_channel_claim(uint) {}
+static inline dma_channel_config dma_channel_get_default_config(uint) { return dma_channel_config{0}; }
+static inline void channel_config_set_transfer_data_size(dma_channel_config *, dma_channel_transfer_size) {}
+static inline void channel_config_set_read_increment(dma_channel_config *, bool) {}
+static inline void channel_config_set_write_increment(dma_channel_config *, bool) {}
+static inline void channel_config_set_dreq(dma_channel_config *, uint) {}
+static inline void channel_config_set_chain_to(dma_channel_config *, uint) {}
+static inline void channel_config_set_irq_quiet(dma_channel_config *, bool) {}
+static inline void dma_channel_configure(uint, const dma_channel_config *, volatile void *,
+                                         const volatile void *, uint, bool) {}
+static inline void dma_channel_set_read_addr(uint ch, const volatile void *a, bool) {
+    host_dma_hw.ch[ch].read_addr = (uintptr_t)a;
+}
+static inline void dma_channel_set_irq1_enabled(uint, bool) {}
+static inline void dma_channel_start(uint) {}
+static inline void irq_set_exclusive_handler(uint, void (*)()) {}
+static inline void irq_set_enabled(uint, bool) {}
+static inline void multicore_launch_core1(void (*)()) {}
+
+// ─── ComputerCard stand-in ───────────────────────────────────────────────────
+// Same method names/semantics as the real header for everything main.cpp uses. The
+// harness writes the public `in_*` fields, then calls Tick() once per 48 kHz sample.
+class ComputerCard {
+public:
+    enum Knob {Main, X, Y};
+    enum Switch {Down, Middle, Up};
+
+    int32_t in_knob[3] = {2048, 2048, 2048};
+    Switch  in_switch = Middle;
+    int16_t in_audio[2] = {0, 0};
+    int16_t in_cv[2] = {0, 0};
+    bool    in_pulse[2] = {false, false};
+    int16_t out_cv[2] = {0, 0};
+    bool    out_led[6] = {};
+
+    virtual ~ComputerCard() {}
+    virtual void ProcessSample() = 0;
+
+    void Tick() {
+        ProcessSample();
+        last_pulse[0] = in_pulse[0];
+        last_pulse[1] = in_pulse[1];
+    }
+
+protected:
+    int32_t KnobVal(Knob k) { return in_knob[k]; }
+    Switch  SwitchVal() { return in_switch; }
+    int16_t AudioIn1() { return in_audio[0]; }
+    int16_t AudioIn2() { return in_audio[1]; }
+    int16_t CVIn1() { return in_cv[0]; }
+    int16_t CVIn2() { return in_cv[1]; }
+    bool PulseIn1() { return in_pulse[0]; }
+    bool PulseIn2() { return in_pulse[1]; }
+    bool PulseIn1RisingEdge() { return in_pulse[0] && !last_pulse[0]; }
+    bool PulseIn2RisingEdge() { return in_pulse[1] && !last_pulse[1]; }
+    void CVOut1(int16_t v) { out_cv[0] = v; }
+    void CVOut2(int16_t v) { out_cv[1] = v; }
+    void CVOut1MIDINote(uint8_t n) { out_cv[0] = (int16_t)((n - 60) * 4096 / 120); }
+    void LedOn(uint32_t i, bool v = true) { out_led[i] = v; }
+
+private:
+    bool last_pulse[2] = {false, false};
+};
@@ -0,0 +1,292 @@
+// scanline_sim — Linux check of Cathode Ray's scanline-buffer video mode (-DCATHODE_SCANLINE).
+//
+// Two halves:
+//
+//  1. Functional. The real main.cpp is driven frame by frame the way the two DMA channels
+//     and core1_main() would: the frame-end IRQ rewinds the line list, the thread expands
+//     the grey buffer, then for every line the control channel "fetches" line_ptrs[k]
+//     (dma_hw->ch[7].read_addr advances, the line IRQ runs) and the data channel's line
+//     buffer is appended to a captured stream. That stream must be bit-identical to the
+//     naive reference encode of the same picture, every frame — ring-slot reuse, the
+//     templates and the invert latch are all covered — and pass the decoded timing
+//     check (harness.h check_timing()).
+//
+//  2. Timing. A cycle model of Core 1 at 144 MHz: line fetches happen one FIFO's worth
+//     (8 joined words = 128 px) before each line starts; the line IRQ packs rows at a
+//     per-row cost; the thread's expand of the rows it actually re-dithered this frame
+//     (traced from the functional run) is pushed around the IRQs. Reported per scene:
+//       slack  — worst margin between a row finishing its pack and its line's fetch
+//       lead   — worst margin between the expand of a row and the IRQ packing it
+//       irq %  — Core-1 time taken by the line IRQ (what the draw loses)
+//     A negative slack is a corrupted line; a negative lead is a torn (half old / half
+//     new) row. Cycle costs are estimates for the RP2040 (M0+, code in RAM) and can be
+//     overridden; the "budget" line gives the largest per-row costs that still hold with
+//     every row re-dithered.
+//
+//   ./scanline_sim                         all scenes, 200 frames
+//   ./scanline_sim -n 500 -row 2000 boing  heavier pack cost, one scene
+#define VIDEO_TRACE_EXPAND(gy) (host_expanded[gy] = 1)
+static unsigned char host_expanded[256];
+
+#include "../main.cpp"
+
+#include "harness.h"
+
+#include <algorithm>
+#include <utility>
+
+// ─── Cycle costs (144 MHz sys clock) ─────────────────────────────────────────
+struct Costs {
+    double irq_entry   = 300;    // event → first handler instruction (M0+ 16 + bus/XIP stalls)
+    double line_irq    = 150;    // line IRQ fixed cost (ack, line number, loop)
+    double frame_irq   = 200;    // frame-end IRQ (ack, rewind, latch)
+    double row_pack    = 1500;   // encode_active_row: 45 bytes through pix_lut + edges
+    double wake        = 200;    // thread notices vblank_ready
+    double fingerprint = 600;    // grey_row_fingerprint: 45 words
+    double expand_row  = 12000;  // expand_grey_row: 2 × (360 px dither + dilate)
+};
+
+static const double LINE_CYC  = LINE_TOTAL_PX * VIDEO_CLKDIV;
+static const double FIFO_LEAD = 8 * 16 * VIDEO_CLKDIV;   // joined TX FIFO, 16 px per word
+static const double FRAME_CYC = LINE_CYC * TV_TOTAL_LINES;
+
+struct FrameModel {
+    double slack, lead, end_margin, irq_cycles;
+    int misses, tears;
+};
+
+// Time the thread finishes `work` cycles starting at t, stepping around the IRQ intervals.
+static double thread_advance(const std::vector<std::pair<double, double>> &busy, double t,
+                             double work) {
+    for (const auto &b : busy) {
+        if (b.second <= t) continue;
+        if (b.first > t) {
+            if (work <= b.first - t) return t + work;
+            work -= b.first - t;
+        }
+        t = b.second;
+    }
+    return t + work;
+}
+
+// One frame, t = 0 at the start of line 0. `expanded` marks the grey rows the thread
+// re-dithers this frame.
+static FrameModel model_frame(const Costs &c, const unsigned char *expanded) {
+    FrameModel m = {1e18, 1e18, 0, 0, 0, 0};
+    std::vector<std::pair<double, double>> busy;
+
+    // Previous frame's NULL fetch → frame-end IRQ → rewind → line 0 fetched.
+    double end_irq = -FIFO_LEAD + c.irq_entry;
+    double f0 = end_irq + c.frame_irq;
+    busy.push_back({-FIFO_LEAD, f0});
+    m.end_margin = -f0;
+    auto fetch = [&](int k) { return k == 0 ? f0 : k * LINE_CYC - FIFO_LEAD; };
+
+    // Line IRQs. A handler that starts late sees a later line (the control channel keeps
+    // going) and packs correspondingly more rows; pending IRQs coalesce.
+    std::vector<double> pack_start(TV_ACTIVE_LINES, 0);
+    int rendered = 0;
+    double prev_exit = f0;
+    for (int k = 0; k < TV_TOTAL_LINES;) {
+        double entry = std::max(fetch(k) + c.irq_entry, prev_exit);
+        int line = k;
+        while (line + 1 < TV_TOTAL_LINES && fetch(line + 1) + c.irq_entry <= entry) line++;
+        double t = entry + c.line_irq;
+        int limit = std::min(line - TV_FIRST_ACTIVE + LINE_RING, TV_ACTIVE_LINES);
+        while (rendered < limit) {
+            int r = rendered++;
+            pack_start[r] = t;
+            t += c.row_pack;
+            double slack = fetch(TV_FIRST_ACTIVE + r) - t;
+            if (slack < m.slack) m.slack = slack;
+            if (slack < 0) m.misses++;
+        }
+        busy.push_back({std::max(entry - c.irq_entry, prev_exit), t});
+        prev_exit = t;
+        k = line + 1;
+    }
+    for (const auto &b : busy) m.irq_cycles += b.second - b.first;
+
+    // Thread: expand top to bottom from the frame-end wake-up.
+    double t = f0 + c.wake;
+    for (int gy = TV_ACTIVE_ROW0 / GREY_SCALE;
+         gy < (TV_ACTIVE_ROW0 + TV_ACTIVE_LINES) / GREY_SCALE; gy++) {
+        t = thread_advance(busy, t, c.fingerprint + (expanded[gy] ? c.expand_row : 0));
+        if (!expanded[gy]) continue;
+        for (int s = 0; s < GREY_SCALE; s++) {
+            int r = gy * GREY_SCALE + s - TV_ACTIVE_ROW0;
+            if (r < 0 || r >= TV_ACTIVE_LINES) continue;
+            double lead = pack_start[r] - t;
+            if (lead < m.lead) m.lead = lead;
+            if (lead < 0) m.tears++;
+        }
+    }
+    return m;
+}
+
+// ─── Functional run ──────────────────────────────────────────────────────────
+static uint32_t scan_words[FRAME_WORDS_MAX];
+
+// Raise DMA_IRQ_1 with the given channel bits. (The shim's ints1 is a plain variable,
+// not write-1-to-clear, so clear it here once the handler has acked.)
+static void dma_raise(uint32_t bits) {
+    dma_hw->ints1 = bits;
+    dma_irq_handler();
+    dma_hw->ints1 = 0;
+}
+
+// The control channel copies line_ptrs[k] into the data channel and raises its IRQ.
+static void dma_fetch_line(int k) {
+    dma_hw->ch[dma_ctrl_chan].read_addr = (uintptr_t)&line_ptrs[k + 1];
+    dma_raise(1u << dma_ctrl_chan);
+}
+
+// The control channel fetched the NULL at the end of line_ptrs[]; its null trigger
+// raises the data channel's frame-end IRQ in the same go.
+static void dma_frame_end() {
+    dma_hw->ch[dma_ctrl_chan].read_addr = (uintptr_t)&line_ptrs[TV_TOTAL_LINES + 1];
+    dma_raise((1u << dma_chan) | (1u << dma_ctrl_chan));
+}
+
+struct Result {
+    double rows, rows_max;
+    FrameModel worst;
+    long mismatches;
+};
+
+static Result run_scene(const Scene &sc, int frames, const Costs &c, const char *pgm_dir) {
+    dma_chan = 6;
+    dma_ctrl_chan = 7;
+    video_init_buffers();
+    dma_channel_set_read_addr(dma_ctrl_chan, line_ptrs, false);
+
+    // One scanned frame: rewind, expand, all lines out (the draw for the next frame
+    // overlaps the scan on hardware; it only touches the grey buffer, so run it after).
+    auto scan_frame = [&](bool check) {
+        dma_frame_end();
+        bool invert = scan_xr != 0;
+        memset(host_expanded, 0, sizeof host_expanded);
+        expand_grey_to_fb();
+        for (int k = 0; k < TV_TOTAL_LINES; k++) {
+            dma_fetch_line(k);
+            memcpy(&scan_words[k * LINE_WORDS], line_ptrs[k], LINE_WORDS * 4);
+        }
+        if (!check) return 0L;
+        reference_expand();
+        reference_encode(ref_fb, invert);
+        const int scanned = TV_ACTIVE_ROW0 * FB_STRIDE;   // unscanned rows aren't expanded
+        Timing t;
+        decode_stream(scan_words, LINE_WORDS * TV_TOTAL_LINES);
+        return (long)(memcmp(ref_fb + scanned, frame_buffer + scanned,
+                             TV_ACTIVE_LINES * FB_STRIDE) != 0) +
+               (long)(memcmp(ref_words, scan_words, LINE_WORDS * TV_TOTAL_LINES * 4) != 0) +
+               (long)!check_timing(t);
+    };
+
+    SampleClock clk;
+    boot_scene(sc, clk, [&] { scan_frame(false); video_draw(); });
+
+    Result r = {0, 0, {1e18, 1e18, 1e18, 0, 0, 0}, 0};
+    for (int f = 0; f < frames; f++) {
+        feed_samples(sc, clk.t, clk.next(), false);
+        r.mismatches += scan_frame(true);
+
+        int n = 0;
+        for (int gy = 0; gy < GREY_H; gy++) n += host_expanded[gy];
+        r.rows += n;
+        r.rows_max = std::max(r.rows_max, (double)n);
+        FrameModel m = model_frame(c, host_expanded);
+        r.worst.slack = std::min(r.worst.slack, m.slack);
+        r.worst.lead = std::min(r.worst.lead, m.lead);
+        r.worst.end_margin = std::min(r.worst.end_margin, m.end_margin);
+        r.worst.irq_cycles = std::max(r.worst.irq_cycles, m.irq_cycles);
+        r.worst.misses += m.misses;
+        r.worst.tears += m.tears;
+
+        if (pgm_dir) write_pgm(pgm_dir, sc.name, f);
+        video_draw();
+    }
+    r.rows /= frames;
+    return r;
+}
+
+// Largest cost for one field that keeps a full-redraw frame free of line misses (row_pack)
+// or torn rows (expand_row).
+static double budget(Costs c, double Costs::*field) {
+    unsigned char all[256];
+    memset(all, 1, sizeof all);
+    double lo = 0, hi = 200000;
+    for (int i = 0; i < 40; i++) {
+        double mid = (lo + hi) / 2;
+        c.*field = mid;
+        FrameModel m = model_frame(c, all);
+        if ((field == &Costs::row_pack ? m.misses : m.tears) == 0) lo = mid; else hi = mid;
+    }
+    return lo;
+}
+
+static double us(double cycles) { return cycles / 144.0; }
+
+static void print_sram() {
+    size_t frame_words = sizeof(uint32_t) * 2 * FRAME_WORDS_MAX;
+    size_t frame_dirty = sizeof(uint32_t) * 2 * FB_DIRTY_WORDS + 2;   // fb_row_dirty, word_invert
+    size_t ring = sizeof line_ring, tmpl = sizeof line_vsync + sizeof line_blank;
+    size_t ptrs = sizeof line_ptrs;
+    size_t shared = sizeof frame_buffer + sizeof grey_buffer + sizeof pix_lut;
+    printf("SRAM   frame mode: word streams %zu + dirty masks %zu + fb/grey/lut %zu = %zu B\n",
+           frame_words, frame_dirty, shared, frame_words + frame_dirty + shared);
+    printf("       scanline:   line ring %zu + templates %zu + line list %zu + fb/grey/lut %zu"
+           " = %zu B  (saves %zu B)\n", ring, tmpl, ptrs, shared, ring + tmpl + ptrs + shared,
+           frame_words + frame_dirty - ring - tmpl - ptrs);
+}
+
+int main(int argc, char **argv) {
+    int frames = 200;
+    const char *pgm_dir = nullptr;
+    Costs c;
+    std::vector<const Scene *> pick;
+    for (int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        if (a == "-n" && i + 1 < argc) frames = atoi(argv[++i]);
+        else if (a == "-p" && i + 1 < argc) pgm_dir = argv[++i];
+        else if (a == "-row" && i + 1 < argc) c.row_pack = atof(argv[++i]);
+        else if (a == "-expand" && i + 1 < argc) c.expand_row = atof(argv[++i]);
+        else if (a == "-lat" && i + 1 < argc) c.irq_entry = atof(argv[++i]);
+        else if (!pick_scene(a, pick)) {
+            fprintf(stderr, "usage: %s [-n frames] [-p pgm_dir] [-row cyc] [-expand cyc]"
+                            " [-lat cyc] [scene...]\n", argv[0]);
+            list_scenes();
+            return 2;
+        }
+    }
+    if (pick.empty()) for (int s = 0; s < NUM_SCENES; s++) pick.push_back(&SCENES[s]);
+
+#ifdef TV_NTSC
+    printf("NTSC scanline  ");
+#else
+    printf("PAL scanline   ");
+#endif
+    printf("%d frames/scene, %d×%d px lines (%.3f µs), FIFO lead %.1f µs, ring %d lines\n",
+           frames, LINE_TOTAL_PX, TV_TOTAL_LINES, us(LINE_CYC), us(FIFO_LEAD), LINE_RING);
+    printf("cycles: irq entry %.0f, row pack %.0f, expand row %.0f, fingerprint %.0f\n",
+           c.irq_entry, c.row_pack, c.expand_row, c.fingerprint);
+    print_sram();
+    printf("budget (every row re-dithered): row pack ≤ %.0f cyc, expand row ≤ %.0f cyc\n\n",
+           budget(c, &Costs::row_pack), budget(c, &Costs::expand_row));
+
+    printf("%-14s %6s %5s | %9s %9s %9s %6s | %s\n", "scene", "rows", "max",
+           "slack us", "lead us", "end us", "irq %", "check");
+    int failures = 0;
+    for (const Scene *sc : pick) {
+        const Result failed = {0, 0, {0, 0, 0, 0, 0, 0}, -1};
+        Result r = run_isolated([&] { return run_scene(*sc, frames, c, pgm_dir); }, failed);
+        bool timing_ok = r.worst.misses == 0 && r.worst.tears == 0 && r.worst.end_margin > 0;
+        bool ok = r.mismatches == 0 && timing_ok;
+        if (!ok) failures++;
+        printf("%-14s %6.1f %5.0f | %9.1f %9.1f %9.1f %6.1f | %s\n", sc->name, r.rows,
+               r.rows_max, us(r.worst.slack), r.worst.lead < 1e17 ? us(r.worst.lead) : 0.0,
+               us(r.worst.end_margin), 100.0 * r.worst.irq_cycles / FRAME_CYC,
+               r.mismatches ? "MISMATCH" : timing_ok ? "ok" : "LATE");
+    }
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,167 @@
+// spectrum_bench — accuracy and cost of the SPECTRUM analyser (fixed-point real FFT).
+//
+// Loads test signals straight into audio_ring, runs the firmware's spec_fft() /
+// spectrum_analyse(), and compares every bin and every band against a double-precision
+// DFT of the same Hann-windowed block (scaled the way the fixed-point path scales it).
+// Then times spectrum_analyse() against the Goertzel bank it replaced (24 bands, and the
+// same bank stretched to SPEC_BANDS bands).
+//
+//   ./spectrum_bench          accuracy table + timing
+//   ./spectrum_bench -n 20000 more timing iterations
+//
+// Host ns are only relative (x86, not an RP2040) — compare the rows, not the numbers.
+#include "../main.cpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+// ─── Test signals ────────────────────────────────────────────────────────────
+struct Signal {
+    const char *name;
+    double f1, a1, f2, a2, noise;   // two sines (Hz, 12-bit amplitude) + white noise
+};
+
+static const Signal SIGNALS[] = {
+    {"sine 200 Hz 0 dB",    200.0, 2047, 0, 0, 0},
+    {"sine 1 kHz 0 dB",    1000.0, 2047, 0, 0, 0},
+    {"sine 5 kHz -20 dB",  5000.0,  205, 0, 0, 0},
+    {"sine 11 kHz -40 dB",11000.0,   20, 0, 0, 0},
+    {"two-tone 440+3k",     440.0, 1000, 3000.0, 500, 0},
+    {"white noise -10 dB",    0.0,    0, 0, 0, 650},
+    {"silence",               0.0,    0, 0, 0, 0},
+};
+#define NUM_SIGNALS ((int)(sizeof(SIGNALS) / sizeof(SIGNALS[0])))
+
+static void load_signal(const Signal &sg) {
+    uint32_t seed = 12345;
+    for (int i = 0; i < AUDIO_RING_SIZE; i++) {
+        double t = i / 48000.0;
+        double v = sg.a1 * std::sin(2 * M_PI * sg.f1 * t) + sg.a2 * std::sin(2 * M_PI * sg.f2 * t);
+        if (sg.noise > 0) {
+            seed = seed * 1664525u + 1013904223u;
+            v += sg.noise * ((int32_t)(seed >> 16) - 32768) / 32768.0 * 1.732;   // uniform, σ ≈ noise
+        }
+        long q = lround(v);
+        if (q > 2047) q = 2047;
+        if (q < -2048) q = -2048;
+        audio_ring[i] = (int16_t)q;
+    }
+    audio_write_idx = AUDIO_RING_SIZE;
+}
+
+// |X[k]| of the newest SPEC_N samples, double precision, same scale as spec_bin_power():
+// the fixed path computes DFT(x·w · 8) / 256  (×32768/4096 window, ¼ per radix-4 stage)
+// = DFT(x·w) / 32.
+static double ref_mag[SPEC_M];
+
+static void reference_spectrum() {
+    double x[SPEC_N];
+    uint32_t idx = audio_write_idx - SPEC_N;
+    for (int n = 0; n < SPEC_N; n++)
+        x[n] = audio_ring[(idx + n) & AUDIO_RING_MASK] * 0.5 * (1.0 - std::cos(2 * M_PI * n / SPEC_N));
+    for (int k = 0; k < SPEC_M; k++) {
+        double re = 0, im = 0;
+        for (int n = 0; n < SPEC_N; n++) {
+            re += x[n] * std::cos(2 * M_PI * k * n / SPEC_N);
+            im -= x[n] * std::sin(2 * M_PI * k * n / SPEC_N);
+        }
+        ref_mag[k] = std::sqrt(re * re + im * im) / 32.0;
+    }
+}
+
+// ─── The Goertzel bank spectrum_render() used to run (for the timing comparison) ─────
+static const int32_t goertzel24[24] = {
+    16383,16383,16382,16381,16380,16377,16374,16369,16362,16351,16335,16311,
+    16274,16220,16140,16020,15842,15578,15186,14607,13755,12514,10725,8192 };
+static int32_t goertzelN[SPEC_BANDS];
+
+static void goertzel_bank(const int32_t *coeff, int bands, int32_t *mag) {
+    const int N = 512;
+    uint32_t aw = audio_write_idx;
+    for (int b = 0; b < bands; b++) {
+        int32_t c = coeff[b];
+        int32_t s1 = 0, s2 = 0;
+        uint32_t idx = aw - N;
+        for (int n = 0; n < N; n++) {
+            int32_t x = audio_ring[idx & AUDIO_RING_MASK] >> 3;
+            int32_t s0 = ((c * s1) >> 13) - s2 + x;
+            s2 = s1; s1 = s0;
+            idx++;
+        }
+        int32_t p = s1*s1 + s2*s2 - (int32_t)(((int64_t)c * s1 * s2) >> 13);
+        if (p < 0) p = 0;
+        mag[b] = (int32_t)isqrt_u((uint32_t)p);
+    }
+}
+
+template <typename F>
+static double ns_per_call(F fn, int iters) {
+    using clock = std::chrono::steady_clock;
+    fn();   // warm
+    auto t0 = clock::now();
+    for (int i = 0; i < iters; i++) fn();
+    auto t1 = clock::now();
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / iters;
+}
+
+int main(int argc, char **argv) {
+    int iters = 5000;
+    for (int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        if (a == "-n" && i + 1 < argc) iters = atoi(argv[++i]);
+        else { fprintf(stderr, "usage: %s [-n iterations]\n", argv[0]); return 2; }
+    }
+    for (int b = 0; b < SPEC_BANDS; b++) {
+        double fc = 0.5 * (spec_edge[b] + spec_edge[b + 1] - 1) * 48000.0 / SPEC_N;
+        goertzelN[b] = (int32_t)lround(8192.0 * 2 * std::cos(2 * M_PI * fc / 48000.0));
+    }
+
+    // Accuracy. Errors are in output LSBs and relative to a full-scale sine (≈8190).
+    const double FS = 2047.0 * SPEC_N / 4 / 32.0;
+    printf("SPEC_N %d, %d bands, bins %d..%d (%.0f Hz..%.0f Hz)\n", SPEC_N, SPEC_BANDS,
+           spec_edge[0], spec_edge[SPEC_BANDS] - 1, spec_edge[0] * 48000.0 / SPEC_N,
+           (spec_edge[SPEC_BANDS] - 1) * 48000.0 / SPEC_N);
+    printf("%-20s %9s %9s | %9s %9s | %9s | %s\n", "signal", "peak ref", "peak fix",
+           "bin err", "dBFS", "band err", "check");
+    int failures = 0;
+    for (int si = 0; si < NUM_SIGNALS; si++) {
+        load_signal(SIGNALS[si]);
+        reference_spectrum();
+        spec_fft();
+        double worst = 0, pref = 0, pfix = 0;
+        int kref = 0, kfix = 0;
+        for (int k = 1; k < SPEC_M; k++) {
+            double m = std::sqrt((double)spec_bin_power(k));
+            worst = std::max(worst, std::fabs(m - ref_mag[k]));
+            if (ref_mag[k] > pref) { pref = ref_mag[k]; kref = k; }
+            if (m > pfix) { pfix = m; kfix = k; }
+        }
+        int32_t mag[SPEC_BANDS];
+        spectrum_analyse(mag);
+        double band_worst = 0;
+        for (int b = 0; b < SPEC_BANDS; b++) {
+            double r = 0;
+            for (int k = spec_edge[b]; k < spec_edge[b + 1]; k++) r = std::max(r, ref_mag[k]);
+            band_worst = std::max(band_worst, std::fabs(mag[b] - r));
+        }
+        double dbfs = worst > 0 ? 20 * std::log10(worst / FS) : -200;
+        // Pass: the error floor sits ≥ 54 dB under full scale and the loudest bin agrees.
+        bool ok = dbfs < -54 && (pref < 4 || kref == kfix);
+        if (!ok) failures++;
+        printf("%-20s %9.1f %9.1f | %9.2f %9.1f | %9.2f | %s\n", SIGNALS[si].name, pref, pfix,
+               worst, dbfs, band_worst, ok ? "ok" : "FAIL");
+    }
+
+    // Cost per frame's analysis.
+    load_signal(SIGNALS[4]);
+    int32_t mag[SPEC_BANDS];
+    double t_fft = ns_per_call([&] { spectrum_analyse(mag); }, iters);
+    double t_g24 = ns_per_call([&] { goertzel_bank(goertzel24, 24, mag); }, iters);
+    double t_gN  = ns_per_call([&] { goertzel_bank(goertzelN, SPEC_BANDS, mag); }, iters);
+    printf("\nns per frame (host):  FFT %d bands %.0f  |  Goertzel 24 bands %.0f  |"
+           "  Goertzel %d bands %.0f\n", SPEC_BANDS, t_fft, t_g24, SPEC_BANDS, t_gN);
+    return failures ? 1 : 0;
+}
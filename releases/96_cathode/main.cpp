@@ -19,6 +19,9 @@
 //   Line:    448 pixels = 64.000 µs  (target 64.000 µs, 0%)
 //   Frame:   312 lines  = 19.968 ms  (target 20.000 ms = 50 Hz, -0.16%)
 
+#ifdef CATHODE_HOST
+#include "host/host_shim.h"     // Linux build: mocked SDK + ComputerCard (see host/README.md)
+#else
 #include "ComputerCard.h"
 #include "pico/multicore.h"
 #include "hardware/pio.h"
@@ -26,6 +29,7 @@
 #include "hardware/irq.h"
 #include "hardware/sync.h"
 #include "composite.pio.h"
+#endif
 #include <cstring>
 
 // ─── Hardware pin macros ──────────────────────────────────────────────────────
@@ -50,8 +54,8 @@
 // All drawing happens in a half-resolution grey buffer where each cell holds a
 // brightness 0..GREY_LEVELS-1. Each frame it is expanded into the 1-bit
 // frame_buffer via a GREY_SCALE×GREY_SCALE spatial dither, giving fake greyscale
-// on a 1-bit display (ZX-Spectrum-style). The scan-out path (build_frame_words)
-// is unchanged — it still reads frame_buffer bit by bit.
+// on a 1-bit display (ZX-Spectrum-style). Only rows that changed are re-dithered and
+// re-packed into the word stream (see "Per-row dirty tracking" below).
 //
 // GREY_SCALE is the downscale factor. It MUST divide both FB_WIDTH and FB_HEIGHT.
 // Legal values (common divisors of 360 and 256): 1, 2, 4, 8. Start at 2 (180×128);
@@ -74,6 +78,7 @@ static_assert(FB_HEIGHT % GREY_SCALE == 0, "GREY_SCALE must divide FB_HEIGHT");
 // the ONE place PAL and NTSC diverge — everything else derives automatically.
 //   Frame-structure macros are format-neutral (TV_*) so build_frame_words() is shared.
 #ifdef TV_NTSC
+#ifndef CATHODE_SCANLINE
 // NTSC: line = 63.556µs. At 7MHz → 445 ticks (63.571µs, +0.02%). 262 lines → 60.04Hz.
 //   fp=10 + hs=33 + bp=32 + av=370 = 445.  Active = 240 (a centred crop of the 256-row FB).
 #define LINE_FP_PX          10      // front porch (~1.5µs)
@@ -82,6 +87,20 @@ static_assert(FB_HEIGHT % GREY_SCALE == 0, "GREY_SCALE must divide FB_HEIGHT");
 #define LINE_AV_PX          370     // active video (FB_WIDTH=360 + 10 px right padding)
 #define LINE_TOTAL_PX       445     // 10+33+32+370 = 445 ✓
 #define VSYNC_LOW_PX        190     // broad sync pulse LOW (~27µs)
+#define VIDEO_CLKDIV        (144.0f / 7.0f)
+#else
+// NTSC, scanline mode: DMA feeds the PIO one whole line buffer at a time, so a line must
+// be a whole number of 32-bit words (16 px). 448 px/line with the pixel clock raised to
+// 144MHz / (144·445/(7·448)) = 7.049 MHz keeps the SAME 63.571µs line as above; the
+// picture is just 0.7% narrower. fp=10 + hs=33 + bp=32 + av=373 = 448.
+#define LINE_FP_PX          10      // front porch (~1.4µs)
+#define LINE_HS_PX          33      // h-sync (~4.7µs)
+#define LINE_BP_PX          32      // back porch (~4.5µs)
+#define LINE_AV_PX          373     // active video (FB_WIDTH=360 + 13 px right padding)
+#define LINE_TOTAL_PX       448     // 10+33+32+373 = 448 ✓
+#define VSYNC_LOW_PX        191     // broad sync pulse LOW (~27µs)
+#define VIDEO_CLKDIV        (144.0f * 445.0f / (7.0f * 448.0f))
+#endif
 #define TV_VSYNC_LINES      6
 #define TV_BLANK_TOP        8
 #define TV_ACTIVE_LINES     240     // scan out 240 of the 256 FB rows (crop 8 top / 8 bot)
@@ -97,6 +116,7 @@ static_assert(FB_HEIGHT % GREY_SCALE == 0, "GREY_SCALE must divide FB_HEIGHT");
 #define LINE_AV_PX          363     // active video (FB_WIDTH=360 + 3 px right padding)
 #define LINE_TOTAL_PX       448     // 12+33+40+363 = 448 ✓
 #define VSYNC_LOW_PX        191     // V-sync long pulse: 27.3µs → 191 ticks LOW
+#define VIDEO_CLKDIV        (144.0f / 7.0f)
 #define TV_VSYNC_LINES      5
 #define TV_BLANK_TOP        33      // picture vertical position (down vs default)
 #define TV_ACTIVE_LINES     FB_HEIGHT   // 256 — all FB rows
@@ -124,15 +144,60 @@ static_assert(FB_HEIGHT % GREY_SCALE == 0, "GREY_SCALE must divide FB_HEIGHT");
 // Buffers are sized for the LARGER (PAL) frame so one allocation serves both formats.
 #define FRAME_WORDS_MAX     8736
 
+#ifndef CATHODE_SCANLINE
 // Double-buffered word streams: Core 1 writes to back buffer, DMA reads from front.
 static uint32_t __attribute__((aligned(4))) word_buf[2][FRAME_WORDS_MAX];
 static volatile int active_buf = 0;  // which buffer DMA is currently reading
+#else
+// ─── Scanline mode (-DCATHODE_SCANLINE) ──────────────────────────────────────
+// No frame-sized word streams (2 × 34.9 KB). A control DMA channel walks line_ptrs[],
+// handing the data channel one LINE_WORDS-word line buffer per scan line:
+//   vsync / blank lines → the constant line_vsync / line_blank templates
+//   active row r        → line_ring[r % LINE_RING], re-packed from frame_buffer just in
+//                         time by the Core-1 line IRQ (scan_render_ahead), up to
+//                         LINE_RING lines ahead of the beam.
+// line_ptrs[] ends with a NULL, whose null trigger raises the frame-end IRQ that rewinds
+// the control channel (the same per-frame restart the frame mode does).
+#define LINE_WORDS          (LINE_TOTAL_PX / 16)
+static_assert(LINE_TOTAL_PX % 16 == 0, "scanline mode needs whole-word lines");
+#define LINE_RING           8       // line buffers in flight (power of 2); 8 lines ≈ 512µs
+#define LINE_RING_MASK      (LINE_RING - 1)
+#define TV_FIRST_ACTIVE     (TV_VSYNC_LINES + TV_BLANK_TOP)
+static uint32_t __attribute__((aligned(4))) line_ring[LINE_RING][LINE_WORDS];
+static uint32_t __attribute__((aligned(4))) line_vsync[LINE_WORDS];
+static uint32_t __attribute__((aligned(4))) line_blank[LINE_WORDS];
+static const uint32_t *line_ptrs[TV_TOTAL_LINES + 1];
+#endif
 
 // ─── Framebuffer (written by Core 1 during vblank) ───────────────────────────
 static uint8_t frame_buffer[FB_SIZE];
 
 // ─── Grey working buffer (Core-1-private; expanded into frame_buffer each frame)
-static uint8_t grey_buffer[GREY_SIZE];
+// Word-aligned so expand_grey_to_fb() can fingerprint each row 4 cells at a time.
+static uint8_t __attribute__((aligned(4))) grey_buffer[GREY_SIZE];
+static_assert(GREY_W % 4 == 0, "grey rows are fingerprinted as whole 32-bit words");
+
+// ─── Per-row dirty tracking (Core 1 only) ────────────────────────────────────
+// Most frames only touch a few rows (an etch stroke, a scope column), so the
+// grey→fb expansion and the word-stream encode both skip rows that didn't change.
+//   grey_row_sig[]  fingerprint of each grey row as last expanded (+ whether it holds
+//                   mid-greys, which are the only cells the dither orientation affects)
+//   fb_row_dirty[b] bitmask of framebuffer rows not yet re-encoded into word_buf[b].
+//                   Each word buffer is only rebuilt every other frame, so each keeps
+//                   its own mask; a changed fb row sets its bit in BOTH.
+// video_incremental=false forces the old every-row path (host harness A/B timing).
+// (Scanline mode has no word buffers: every active line is re-packed as it is scanned.)
+#define FB_DIRTY_WORDS   ((FB_HEIGHT + 31) / 32)
+static uint32_t grey_row_sig[GREY_H];
+static uint32_t grey_row_mid[(GREY_H + 31) / 32];   // bit set = row has level 1..3 cells
+#ifndef CATHODE_SCANLINE
+static uint32_t fb_row_dirty[2][FB_DIRTY_WORDS];
+static bool     word_invert[2] = {false, false};    // invert state each buffer was encoded with
+#endif
+static bool     grey_force_full = true;             // next expand re-dithers every row
+static bool     video_incremental = true;
+static int      expand_orient = -1;                 // dither_orient of the last expand
+static int      expand_cap = -1;                    // dilate_cap of the last expand
 
 // ─── Etch CV ring buffer (Core 0 pushes @48kHz, Core 1 drains each frame) ─────
 // Captures sub-frame CV motion: each frame Core 1 plots every sample Core 0 queued.
@@ -242,8 +307,11 @@ static inline uint32_t lcg_rand() {
 
 // ─────────────────────────────────────────────────────────────────────────────
 // Word-stream builder
-// Packs the PAL frame (sync lines + active video lines) into word_buf[back].
-// The invert flag is applied here: active pixel bytes are XOR'd with 0xFF.
+// The sync / porch / blanking structure never changes, so build_frame_template() packs
+// the whole frame ONCE per word buffer at startup (active video left black). After
+// that build_frame_words() only re-packs the 360 active pixels of framebuffer rows that
+// changed since that buffer was last built. The invert flag is applied per row here:
+// active pixel bytes are XOR'd with 0xFF (flipping invert re-encodes every row).
 // ─────────────────────────────────────────────────────────────────────────────
 
 // ─── Output levels (2-bit resistor DAC) ──────────────────────────────────────
@@ -269,21 +337,38 @@ static const uint8_t level_pair[3] = {
     /*WHITE*/ 0b00,   // both jack HIGH → brightest
 };
 
-static void build_frame_words(int back, bool invert) {
-    uint32_t *buf = word_buf[back];
+// 8 framebuffer pixels (one byte, MSB = leftmost) → 16 bits of packed level pairs.
+// Filled from level_pair[] by init_pix_lut(), so level_pair stays the ONE place the DAC
+// levels live.
+static uint16_t pix_lut[256];
+
+static void init_pix_lut() {
+    for (int b = 0; b < 256; b++) {
+        uint32_t v = 0;
+        for (int i = 7; i >= 0; i--) v = (v << 2) | (level_pair[((b >> i) & 1) ? WHITE : BLACK] & 0x3);
+        pix_lut[b] = (uint16_t)v;
+    }
+}
+
+// Sequential 2-bit-per-pixel packer for the constant parts of the stream (sync, porches,
+// blanking). Used once at startup — the whole frame template, or single line templates.
+struct WordPacker {
+    uint32_t *buf;
     int word_idx = 0;
     uint32_t cur_word = 0;
     int bit_pos = 0;  // counts BITS (advances by 2 per pixel); word commits at 32
 
-    auto commit_word = [&]() {
+    explicit WordPacker(uint32_t *b) : buf(b) {}
+
+    void commit_word() {
         buf[word_idx++] = cur_word;
         cur_word = 0;
         bit_pos = 0;
-    };
+    }
 
     // emit_const: emit `count` PIXELS all at the given level (2 bits each).
     // 32-bit threshold / 2 = 16 pixels per word; pairs never straddle a word boundary.
-    auto emit_const = [&](Level lvl, int count) {
+    void emit_const(Level lvl, int count) {
         uint32_t pair = level_pair[lvl] & 0x3;
         // 16×-replicated full word for the fast path
         uint32_t fill = pair;
@@ -304,77 +389,162 @@ static void build_frame_words(int back, bool invert) {
             count--;
             if (bit_pos == 32) commit_word();
         }
-    };
+    }
 
-    // Blank line: fp=black, hs=sync, rest=black (blanking pedestal sits at black)
-    auto emit_blank_line = [&]() {
+    // Blank line: fp=black, hs=sync, rest=black (blanking pedestal sits at black).
+    // Active lines have the same shape: the FB_WIDTH pixels after the back porch are the
+    // span encode_active_row() rewrites (the LINE_AV_PX - FB_WIDTH pad stays black).
+    void blank_line() {
         emit_const(BLACK, LINE_FP_PX);
         emit_const(SYNC,  LINE_HS_PX);
         emit_const(BLACK, LINE_BP_PX + LINE_AV_PX);
-    };
+    }
 
     // V-sync line: short front porch, long sync pulse, rest black
-    auto emit_vsync_line = [&]() {
+    void vsync_line() {
         emit_const(BLACK, LINE_FP_PX);
         emit_const(SYNC,  VSYNC_LOW_PX);
         emit_const(BLACK, VSYNC_HIGH_PX - LINE_FP_PX);
-    };
-
-    // V-sync lines
-    for (int l = 0; l < TV_VSYNC_LINES; l++) {
-        emit_vsync_line();
-    }
-
-    // Top blank lines
-    for (int l = 0; l < TV_BLANK_TOP; l++) {
-        emit_blank_line();
     }
 
-    // Active video. TV_ACTIVE_LINES rows are scanned, starting at framebuffer row
-    // TV_ACTIVE_ROW0 (PAL: 0/256 = all rows; NTSC: 8/240 = a centred crop of the 256-row
-    // framebuffer, so the drawing geometry is identical for both formats).
-    // Framebuffer bit SET = white pixel, CLEAR = black; invert swaps WHITE/BLACK.
-    for (int row = 0; row < TV_ACTIVE_LINES; row++) {
-        emit_const(BLACK, LINE_FP_PX);   // front porch (black)
-        emit_const(SYNC,  LINE_HS_PX);   // h-sync
-        emit_const(BLACK, LINE_BP_PX);   // back porch (black)
-        const uint8_t *fb_row = &frame_buffer[(TV_ACTIVE_ROW0 + row) * FB_STRIDE];
-        for (int p = 0; p < FB_WIDTH; p++) {
-            bool set = (fb_row[p / 8] >> (7 - (p & 7))) & 1u;
-            if (invert) set = !set;
-            uint32_t pair = level_pair[set ? WHITE : BLACK] & 0x3;
-            for (int s = 0; s < PIXEL_STRETCH; s++) {
-                cur_word = (cur_word << 2) | pair;
+    // Flush the partial word (LSBs padded BLACK), then pad with 16×BLACK words up to
+    // total_words.
+    void finish(int total_words) {
+        if (bit_pos > 0) {
+            uint32_t blk = level_pair[BLACK] & 0x3;
+            while (bit_pos < 32) {
+                cur_word = (cur_word << 2) | blk;
                 bit_pos += 2;
-                if (bit_pos == 32) commit_word();
             }
+            commit_word();
+        }
+        uint32_t black_fill = level_pair[BLACK] & 0x3;
+        for (int i = 1; i < 16; i++) black_fill = (black_fill << 2) | (level_pair[BLACK] & 0x3);
+        while (word_idx < total_words) {
+            buf[word_idx++] = black_fill;
         }
-        emit_const(BLACK, LINE_AV_PX - FB_WIDTH);  // right-pad to fill LINE_AV_PX (363-360 = 3 px)
     }
+};
 
-    // Bottom blank lines
-    for (int l = 0; l < TV_BLANK_BOT; l++) {
-        emit_blank_line();
-    }
+#ifndef CATHODE_SCANLINE
+// Pack the complete frame structure into word_buf[buf]: vsync, blanking, and every
+// line's porches/sync/right-pad. Active pixels are emitted BLACK; build_frame_words()
+// overwrites just those spans. Called once per buffer at startup.
+static void build_frame_template(int buf_index) {
+    WordPacker pk(word_buf[buf_index]);
+    for (int l = 0; l < TV_VSYNC_LINES; l++)  pk.vsync_line();
+    for (int l = 0; l < TV_BLANK_TOP; l++)    pk.blank_line();
+    for (int l = 0; l < TV_ACTIVE_LINES; l++) pk.blank_line();
+    for (int l = 0; l < TV_BLANK_BOT; l++)    pk.blank_line();
+    pk.finish(FRAME_WORDS);
+}
+
+// First active pixel of scan line `row` (0..TV_ACTIVE_LINES-1), counted in pixels from
+// the start of the frame word stream.
+static inline uint32_t active_row_px(int row) {
+    return (uint32_t)(TV_VSYNC_LINES + TV_BLANK_TOP + row) * LINE_TOTAL_PX
+         + LINE_FP_PX + LINE_HS_PX + LINE_BP_PX;
+}
+#endif
 
-    // Flush remaining partial word, padding LSBs with BLACK pairs
-    if (bit_pos > 0) {
-        uint32_t blk = level_pair[BLACK] & 0x3;
-        while (bit_pos < 32) {
-            cur_word = (cur_word << 2) | blk;
-            bit_pos += 2;
+// Re-pack one framebuffer row into the word stream at pixel offset px. The span rarely
+// starts or ends on a word boundary (PAL: pixel 5 of a word), so the bits before it
+// (back porch) and after it (right pad) are preserved from the template.
+static void __not_in_flash_func(encode_active_row)(uint32_t *buf, uint32_t px,
+                                                   const uint8_t *fb_row, uint8_t xr) {
+    uint32_t *w = &buf[px >> 4];
+    int nbits = (int)(px & 15) * 2;                 // leading bits owned by the porch
+    uint64_t acc = nbits ? (*w >> (32 - nbits)) : 0;
+    for (int b = 0; b < FB_STRIDE; b++) {
+        acc = (acc << 16) | pix_lut[fb_row[b] ^ xr];
+        nbits += 16;
+        if (nbits >= 32) {
+            nbits -= 32;
+            *w++ = (uint32_t)(acc >> nbits);
         }
-        commit_word();
     }
+    if (nbits) {                                    // merge the tail with the right pad
+        *w = (uint32_t)(acc << (32 - nbits)) | (*w & (0xFFFFFFFFu >> nbits));
+    }
+}
 
-    // Fill any remaining words with the 16×BLACK blanking-level constant
-    uint32_t black_fill = level_pair[BLACK] & 0x3;
-    for (int i = 1; i < 16; i++) black_fill = (black_fill << 2) | (level_pair[BLACK] & 0x3);
-    while (word_idx < FRAME_WORDS) {
-        buf[word_idx++] = black_fill;
+#ifndef CATHODE_SCANLINE
+// Flag framebuffer rows [r0, r0+n) as changed for both word buffers.
+static inline void mark_fb_rows_dirty(int r0, int n) {
+    for (int r = r0; r < r0 + n; r++) {
+        uint32_t bit = 1u << (r & 31);
+        fb_row_dirty[0][r >> 5] |= bit;
+        fb_row_dirty[1][r >> 5] |= bit;
     }
 }
 
+// Bring word_buf[back] up to date with frame_buffer: re-encode only the scanned rows
+// whose dirty bit is set for this buffer (or every row if invert changed).
+static void __not_in_flash_func(build_frame_words)(int back, bool invert) {
+    uint32_t *buf = word_buf[back];
+    uint32_t *dirty = fb_row_dirty[back];
+    bool all = !video_incremental || invert != word_invert[back];
+    word_invert[back] = invert;
+    uint8_t xr = invert ? 0xFF : 0x00;
+
+    // TV_ACTIVE_LINES rows are scanned, starting at framebuffer row TV_ACTIVE_ROW0
+    // (PAL: 0/256 = all rows; NTSC: 8/240 = a centred crop of the 256-row framebuffer,
+    // so the drawing geometry is identical for both formats).
+    for (int row = 0; row < TV_ACTIVE_LINES; row++) {
+        int fr = TV_ACTIVE_ROW0 + row;
+        uint32_t bit = 1u << (fr & 31);
+        if (!all && !(dirty[fr >> 5] & bit)) continue;
+        encode_active_row(buf, active_row_px(row), &frame_buffer[fr * FB_STRIDE], xr);
+    }
+    for (int i = 0; i < FB_DIRTY_WORDS; i++) dirty[i] = 0;
+}
+#else
+// Every scanned row is re-packed each frame, so there is nothing to track.
+static inline void mark_fb_rows_dirty(int, int) {}
+
+static int dma_ctrl_chan = -1;
+static volatile int scan_rendered = 0;   // active rows packed into line_ring this frame
+static uint8_t scan_xr = 0;              // invert mask, latched at frame start
+
+// Build the constant vsync / blank line templates and the per-frame line pointer list.
+// The ring slots start as blank lines; only their active spans are rewritten after this.
+static void scan_init_lines() {
+    WordPacker v(line_vsync);
+    v.vsync_line();
+    v.finish(LINE_WORDS);
+    WordPacker b(line_blank);
+    b.blank_line();
+    b.finish(LINE_WORDS);
+    for (int i = 0; i < LINE_RING; i++) memcpy(line_ring[i], line_blank, sizeof line_blank);
+
+    int l = 0;
+    for (; l < TV_VSYNC_LINES; l++)  line_ptrs[l] = line_vsync;
+    for (; l < TV_FIRST_ACTIVE; l++) line_ptrs[l] = line_blank;
+    for (int r = 0; r < TV_ACTIVE_LINES; r++, l++) line_ptrs[l] = line_ring[r & LINE_RING_MASK];
+    for (; l < TV_TOTAL_LINES; l++)  line_ptrs[l] = line_blank;
+    line_ptrs[TV_TOTAL_LINES] = nullptr;   // null trigger → frame-end IRQ
+}
+
+// The line the data channel is sending now (= line pointers fetched so far - 1).
+static inline int scan_current_line() {
+    return (int)((const uint32_t *const *)dma_hw->ch[dma_ctrl_chan].read_addr - line_ptrs) - 1;
+}
+
+// Pack active rows into the ring, up to LINE_RING lines ahead of `line` (the line being
+// sent). Row r reuses the slot of row r-LINE_RING, which is free once that row's line
+// (TV_FIRST_ACTIVE + r - LINE_RING) has been sent. Row r's deadline is the start of line
+// TV_FIRST_ACTIVE + r, when the control channel hands its slot to the data channel.
+static void __not_in_flash_func(scan_render_ahead)(int line) {
+    int limit = line - TV_FIRST_ACTIVE + LINE_RING;   // rows < limit have a free slot
+    if (limit > TV_ACTIVE_LINES) limit = TV_ACTIVE_LINES;
+    while (scan_rendered < limit) {
+        int r = scan_rendered++;
+        encode_active_row(line_ring[r & LINE_RING_MASK], LINE_FP_PX + LINE_HS_PX + LINE_BP_PX,
+                          &frame_buffer[(TV_ACTIVE_ROW0 + r) * FB_STRIDE], scan_xr);
+    }
+}
+#endif
+
 // ─────────────────────────────────────────────────────────────────────────────
 // Framebuffer drawing
 // Called by Core 1 during vblank. Reads from shared, writes to frame_buffer[].
@@ -523,28 +693,76 @@ static inline void dilate_white_leveled(uint8_t *fb, const uint8_t *grow, int ca
     }
 }
 
-// Expand the grey buffer into the 1-bit frame_buffer using the dither. Driven by
-// output byte: each frame_buffer byte = 8 horizontal pixels = (8/GREY_SCALE) grey
-// cells on one grey row. Must run before build_frame_words() each frame.
-static void __not_in_flash_func(expand_grey_to_fb)() {
+// Expand one grey row into its GREY_SCALE framebuffer rows (fb = first of them) using
+// the dither. Driven by output byte: each frame_buffer byte = 8 horizontal pixels =
+// (8/GREY_SCALE) grey cells on one grey row.
+static void __not_in_flash_func(expand_grey_row)(int gy, uint8_t *fb) {
     const int cells_per_byte = 8 / GREY_SCALE;       // 4 at scale 2
-    for (int gy = 0; gy < GREY_H; gy++) {
-        const uint8_t *grow = &grey_buffer[gy * GREY_W];
-        for (int sub = 0; sub < GREY_SCALE; sub++) {
-            int fb_row = gy * GREY_SCALE + sub;
-            uint8_t *fb = &frame_buffer[fb_row * FB_STRIDE];
-            int cell = 0;
-            for (int b = 0; b < FB_STRIDE; b++) {
-                uint8_t byte = 0;
-                for (int k = 0; k < cells_per_byte; k++) {
-                    byte = (uint8_t)((byte << GREY_SCALE) | dither[grow[cell++]][dither_orient][sub]);
-                }
-                fb[b] = byte;
+    const uint8_t *grow = &grey_buffer[gy * GREY_W];
+    for (int sub = 0; sub < GREY_SCALE; sub++, fb += FB_STRIDE) {
+        int cell = 0;
+        for (int b = 0; b < FB_STRIDE; b++) {
+            uint8_t byte = 0;
+            for (int k = 0; k < cells_per_byte; k++) {
+                byte = (uint8_t)((byte << GREY_SCALE) | dither[grow[cell++]][dither_orient][sub]);
             }
+            fb[b] = byte;
+        }
 #if WHITE_DILATE
-            dilate_white_leveled(fb, grow, dilate_cap);   // per-frame cap (text/Boing lower it)
+        dilate_white_leveled(fb, grow, dilate_cap);   // per-frame cap (text/Boing lower it)
 #endif
-        }
+    }
+}
+
+// Fingerprint of one grey row (FNV-style over 32-bit words). *mid gets the OR of the
+// row's words: (mid & 0x03030303) != 0 ⇔ some cell is level 1..3 (0 and 4 have no low bits).
+static inline uint32_t grey_row_fingerprint(int gy, uint32_t *mid) {
+    const uint32_t *w = (const uint32_t *)&grey_buffer[gy * GREY_W];
+    uint32_t h = 0x811C9DC5u, m = 0;
+    for (int i = 0; i < GREY_W / 4; i++) {
+        uint32_t v = w[i];
+        m |= v;
+        h = (h ^ v) * 0x01000193u;
+        h ^= h >> 15;
+    }
+    *mid = m;
+    return h;
+}
+
+// Host builds hook this to see which rows each expand re-dithers (see host/).
+#ifndef VIDEO_TRACE_EXPAND
+#define VIDEO_TRACE_EXPAND(gy)
+#endif
+
+// Bring frame_buffer up to date with the grey buffer. Must run before build_frame_words()
+// each frame. A row is re-dithered only if its cells changed, the dilate cap changed, or
+// the dither orientation rotated and the row holds mid-greys (pure black/white rows look
+// the same in every orientation). Re-dithered rows are flagged for the word encoder.
+static void __not_in_flash_func(expand_grey_to_fb)() {
+    bool all = grey_force_full || !video_incremental || dilate_cap != expand_cap;
+    bool orient_moved = dither_orient != expand_orient;
+    grey_force_full = false;
+    expand_cap = dilate_cap;
+    expand_orient = dither_orient;
+#ifdef CATHODE_SCANLINE
+    // Racing the beam: skip the grey rows the crop never scans (NTSC's top/bottom 8 rows).
+    const int gy0 = TV_ACTIVE_ROW0 / GREY_SCALE;
+    const int gy1 = (TV_ACTIVE_ROW0 + TV_ACTIVE_LINES) / GREY_SCALE;
+#else
+    const int gy0 = 0, gy1 = GREY_H;
+#endif
+    for (int gy = gy0; gy < gy1; gy++) {
+        uint32_t mid;
+        uint32_t sig = grey_row_fingerprint(gy, &mid);
+        uint32_t bit = 1u << (gy & 31);
+        bool had_mid = (grey_row_mid[gy >> 5] & bit) != 0;
+        bool has_mid = (mid & 0x03030303u) != 0;
+        if (!all && sig == grey_row_sig[gy] && !(orient_moved && had_mid)) continue;
+        grey_row_sig[gy] = sig;
+        if (has_mid) grey_row_mid[gy >> 5] |= bit; else grey_row_mid[gy >> 5] &= ~bit;
+        expand_grey_row(gy, &frame_buffer[gy * GREY_SCALE * FB_STRIDE]);
+        mark_fb_rows_dirty(gy * GREY_SCALE, GREY_SCALE);
+        VIDEO_TRACE_EXPAND(gy);
     }
 }
 
@@ -733,7 +951,7 @@ static void __not_in_flash_func(corrupt_step)() {
 }
 
 // Run one low-level effect (fx = FX_*). Returns true if it produced a FINISHED frame
-// (caller should expand_grey_to_fb() + return). FX_SWAP_XY sets swap_xy_out and returns
+// (caller should return without drawing more). FX_SWAP_XY sets swap_xy_out and returns
 // false (drawing continues, transposed). st = this trigger source's effect state.
 static bool __not_in_flash_func(run_fx)(int fx, FxState &st, bool &swap_xy_out) {
     switch (fx) {
@@ -2540,25 +2758,152 @@ static void __not_in_flash_func(draw_alt_menu)() {
     }
 }
 
-// ── SPECTRUM: audio analyser (Goertzel filter bank) ─────────────────────────────────
-// A bank of 24 integer Goertzel detectors, log-spaced ~80 Hz…8 kHz (fs 48 kHz), run once
-// per frame over the frame's audio block (Core 1). Each → one vertical bar (low freq left).
-// coeff = 2·cos(2π·f/fs) in Q13 (×8192). Bars decay smoothly; UP = spiky peak-hold, MID =
-// solid bargraph. Knob Y = gain (shared.scope_audio_scale), like the scope.
-#define SPEC_BANDS 24
-static const int32_t spec_coeff[SPEC_BANDS] = {
-    16383,16383,16382,16381,16380,16377,16374,16369,16362,16351,16335,16311,
-    16274,16220,16140,16020,15842,15578,15186,14607,13755,12514,10725,8192 };
-// Per-band gain TILT (Q8, 256 = 1×): cut the low end, lift the highs so a swept sine reads
-// roughly even (bass is otherwise over-represented — many log bands + more natural LF
-// energy). Moderate rising ramp ~0.27× (low) → ~3.0× (high) — between the too-flat and
-// over-corrected extremes.
+// ── SPECTRUM: audio analyser (fixed-point real FFT) ─────────────────────────────────
+// Once per frame (Core 1) the newest SPEC_N samples are Hann-windowed and transformed with a
+// 512-point real FFT: packed as a 256-point complex sequence (even samples → re, odd → im),
+// a radix-4 decimation-in-frequency FFT (4 stages, Q15, each stage scaled by ¼ so nothing
+// can overflow), then the real-FFT split. Bins (93.75 Hz each) are grouped into SPEC_BANDS
+// log-spaced bands ~94 Hz…12 kHz — one bin per band at the bottom, where the bins are wider
+// than a log band — and each band reads its loudest bin. Each band → one bar (low freq
+// left). Bars decay smoothly and carry a peak-hold marker; UP = radial blob, MID = solid
+// bargraph. Knob Y = gain (shared.spec_gain).
+#define SPEC_N         512                  // newest samples analysed (≈10.7 ms)
+#define SPEC_M         (SPEC_N / 2)         // complex FFT length (real-FFT packing)
+#define SPEC_BANDS     48
+#define SPEC_PEAK_HOLD 25                   // frames a peak marker holds before falling
+// sin(2π·m/SPEC_N) for m = 0..SPEC_N/4, Q15 (32767 = 1.0). Twiddles and the window are
+// folded out of this quarter wave.
+static const int16_t spec_qsin[SPEC_N / 4 + 1] = {
+        0,  402,  804, 1206, 1608, 2009, 2411, 2811, 3212, 3612, 4011, 4410, 4808, 5205,
+     5602, 5998, 6393, 6787, 7180, 7571, 7962, 8351, 8740, 9127, 9512, 9896,10279,10660,
+    11039,11417,11793,12167,12540,12910,13279,13646,14010,14373,14733,15091,15447,15800,
+    16151,16500,16846,17190,17531,17869,18205,18538,18868,19195,19520,19841,20160,20475,
+    20788,21097,21403,21706,22006,22302,22595,22884,23170,23453,23732,24008,24279,24548,
+    24812,25073,25330,25583,25833,26078,26320,26557,26791,27020,27246,27467,27684,27897,
+    28106,28311,28511,28707,28899,29086,29269,29448,29622,29792,29957,30118,30274,30425,
+    30572,30715,30853,30986,31114,31238,31357,31471,31581,31686,31786,31881,31972,32058,
+    32138,32214,32286,32352,32413,32470,32522,32568,32610,32647,32679,32706,32729,32746,
+    32758,32766,32767 };
+// First FFT bin of each band (band b = bins spec_edge[b] .. spec_edge[b+1]-1).
+static const uint8_t spec_edge[SPEC_BANDS + 1] = {
+      1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22,
+     23, 25, 27, 29, 31, 33, 35, 37, 39, 42, 45, 48, 51, 54, 58, 62, 66, 71, 76, 81, 86, 92,
+     98,105,112,120,128 };
+// Per-band gain TILT (Q8, 256 = 1×) ∝ √(band centre / 1 kHz): lifts the highs by the
+// +3 dB/octave that makes pink-ish material (most music) read roughly flat, so the bass
+// doesn't dominate. ~0.3× (94 Hz) → ~3.4× (12 kHz).
 static const int32_t spec_tilt[SPEC_BANDS] = {
-    54,64,76,90,107,127,151,179,213,253,300,356,
-    423,502,596,708,840,997,1184,1405,1668,1980,2350,2790 };
+     78,111,136,157,175,192,207,222,235,248,260,272,283,293,304,314,323,333,342,351,
+    359,368,380,396,411,426,440,454,467,480,496,514,532,549,565,584,605,625,646,670,
+    692,714,737,762,788,814,842,871 };
+
+static int16_t spec_re[SPEC_M], spec_im[SPEC_M];   // FFT work buffer (1 KB)
+
+// cos / sin of 2π·m/SPEC_N, m in [0, SPEC_N), Q15.
+static inline void spec_cos_sin(int m, int32_t &c, int32_t &s) {
+    const int Q = SPEC_N / 4;
+    int r = m & (Q - 1);
+    switch (m / Q) {
+        case 0:  s =  spec_qsin[r];     c =  spec_qsin[Q - r]; break;
+        case 1:  s =  spec_qsin[Q - r]; c = -spec_qsin[r];     break;
+        case 2:  s = -spec_qsin[r];     c = -spec_qsin[Q - r]; break;
+        default: s = -spec_qsin[Q - r]; c =  spec_qsin[r];     break;
+    }
+}
+
+// Position of FFT bin k in the radix-4 output (base-4 digit reversal of 8 bits).
+static inline int spec_digit_rev(int k) {
+    return ((k & 0x03) << 6) | ((k & 0x0C) << 2) | ((k & 0x30) >> 2) | (k >> 6);
+}
+static_assert(SPEC_M == 256, "spec_digit_rev assumes a 4-stage (4^4) radix-4 FFT");
+
+// Window + pack the newest SPEC_N samples and run the complex FFT in place. Read a private
+// window ending at the write head (don't disturb the scope's audio_read_idx).
+static void __not_in_flash_func(spec_fft)() {
+    uint32_t idx = audio_write_idx - SPEC_N;
+    for (int n = 0; n < SPEC_M; n++) {
+        // Hann w(i) = (1 − cos 2πi/N)/2, Q15. Samples are 12-bit: ×w >> 12 → ±2^14, so a
+        // complex value's magnitude stays < 2^15 (the ¼-scaled stages never grow it).
+        int32_t c, s;
+        spec_cos_sin(2 * n, c, s);
+        int32_t w0 = (32767 - c) >> 1;
+        spec_cos_sin(2 * n + 1, c, s);
+        int32_t w1 = (32767 - c) >> 1;
+        spec_re[n] = (int16_t)((audio_ring[idx++ & AUDIO_RING_MASK] * w0) >> 12);
+        spec_im[n] = (int16_t)((audio_ring[idx++ & AUDIO_RING_MASK] * w1) >> 12);
+    }
+    // Radix-4 DIF: span L = 256, 64, 16, 4. The three twiddles depend only on k, so they
+    // are looked up once per k and applied to every group at that offset.
+    for (int L = SPEC_M; L >= 4; L >>= 2) {
+        const int q = L >> 2, step = SPEC_N / L;
+        for (int k = 0; k < q; k++) {
+            int32_t c1, s1, c2, s2, c3, s3;
+            spec_cos_sin(k * step, c1, s1);
+            spec_cos_sin(2 * k * step, c2, s2);
+            spec_cos_sin(3 * k * step, c3, s3);
+            for (int i0 = k; i0 < SPEC_M; i0 += L) {
+                int i1 = i0 + q, i2 = i1 + q, i3 = i2 + q;
+                int32_t t0r = spec_re[i0] + spec_re[i2], t0i = spec_im[i0] + spec_im[i2];
+                int32_t t1r = spec_re[i0] - spec_re[i2], t1i = spec_im[i0] - spec_im[i2];
+                int32_t t2r = spec_re[i1] + spec_re[i3], t2i = spec_im[i1] + spec_im[i3];
+                int32_t t3r = spec_re[i1] - spec_re[i3], t3i = spec_im[i1] - spec_im[i3];
+                int32_t y0r = (t0r + t2r) >> 2, y0i = (t0i + t2i) >> 2;
+                int32_t y2r = (t0r - t2r) >> 2, y2i = (t0i - t2i) >> 2;
+                int32_t y1r = (t1r + t3i) >> 2, y1i = (t1i - t3r) >> 2;   // t1 − j·t3
+                int32_t y3r = (t1r - t3i) >> 2, y3i = (t1i + t3r) >> 2;   // t1 + j·t3
+                spec_re[i0] = (int16_t)y0r; spec_im[i0] = (int16_t)y0i;
+                // Output m (bins ≡ m mod 4 of this span) goes to quarter m → base-4
+                // digit-reversed order overall.
+                if (k == 0) {
+                    spec_re[i1] = (int16_t)y1r; spec_im[i1] = (int16_t)y1i;
+                    spec_re[i2] = (int16_t)y2r; spec_im[i2] = (int16_t)y2i;
+                    spec_re[i3] = (int16_t)y3r; spec_im[i3] = (int16_t)y3i;
+                    continue;
+                }
+                // y·W, W = e^(−jθ) = c − j·s
+                spec_re[i1] = (int16_t)((y1r * c1 + y1i * s1) >> 15);
+                spec_im[i1] = (int16_t)((y1i * c1 - y1r * s1) >> 15);
+                spec_re[i2] = (int16_t)((y2r * c2 + y2i * s2) >> 15);
+                spec_im[i2] = (int16_t)((y2i * c2 - y2r * s2) >> 15);
+                spec_re[i3] = (int16_t)((y3r * c3 + y3i * s3) >> 15);
+                spec_im[i3] = (int16_t)((y3i * c3 - y3r * s3) >> 15);
+            }
+        }
+    }
+}
+
+// Power |X[k]|² of real-FFT bin k (1 ≤ k < SPEC_M), from the packed complex result:
+// X[k] = E + W^k·O with E = (Z[k] + Z*[M−k])/2, O = (Z[k] − Z*[M−k])/2j. Overall X is
+// DFT(x·w)/32 for 12-bit samples x, so a full-scale sine peaks at ≈8190².
+static inline uint32_t spec_bin_power(int k) {
+    int a = spec_digit_rev(k), b = spec_digit_rev(SPEC_M - k);
+    int32_t zr = spec_re[a], zi = spec_im[a], cr = spec_re[b], ci = spec_im[b];
+    int32_t er = (zr + cr) >> 1, ei = (zi - ci) >> 1;
+    int32_t orr = (zi + ci) >> 1, oi = (cr - zr) >> 1;
+    int32_t c, s;
+    spec_cos_sin(k, c, s);
+    int32_t xr = er + ((orr * c + oi * s) >> 15);
+    int32_t xi = ei + ((oi * c - orr * s) >> 15);
+    return (uint32_t)(xr * xr) + (uint32_t)(xi * xi);
+}
+
+// FFT the newest block and reduce it to one magnitude per band (loudest bin in the band).
+static void __not_in_flash_func(spectrum_analyse)(int32_t *mag) {
+    spec_fft();
+    for (int b = 0; b < SPEC_BANDS; b++) {
+        uint32_t pk = 0;
+        for (int k = spec_edge[b]; k < spec_edge[b + 1]; k++) {
+            uint32_t p = spec_bin_power(k);
+            if (p > pk) pk = p;
+        }
+        mag[b] = (int32_t)isqrt_u(pk);
+    }
+}
 
 static void __not_in_flash_func(spectrum_render)(uint8_t sw, int32_t knob, bool swap) {
     static int  bar[SPEC_BANDS]  = {0};   // current (decaying) magnitudes, cells
+    static int  peak[SPEC_BANDS] = {0};   // peak-hold marker height, cells
+    static int  hold[SPEC_BANDS] = {0};   // frames left before the marker starts to fall
 
     dilate_cap = 1;
 
@@ -2577,31 +2922,21 @@ static void __not_in_flash_func(spectrum_render)(uint8_t sw, int32_t knob, bool
     if (kpos > kspan) kpos = kspan;
     int fall = 1 + (kpos * 6) / kspan;            // bar fall: 1 (slow) .. 7 (fast) cells/frame
 
-    // ── Analyse the frame's audio block. Read the newest N samples (don't disturb the
-    //    scope's audio_read_idx — take a private window ending at the write head). ──
-    const int N = 512;
-    uint32_t aw = audio_write_idx;
+    // ── Analyse the frame's audio block ──
+    int32_t mag[SPEC_BANDS];
+    spectrum_analyse(mag);
     for (int b = 0; b < SPEC_BANDS; b++) {
-        int32_t c = spec_coeff[b];
-        int32_t s1 = 0, s2 = 0;
-        uint32_t idx = aw - N;
-        for (int n = 0; n < N; n++) {
-            int32_t x = audio_ring[idx & AUDIO_RING_MASK] >> 3;   // scale down (overflow guard)
-            int32_t s0 = ((c * s1) >> 13) - s2 + x;
-            s2 = s1; s1 = s0;
-            idx++;
-        }
-        // Goertzel magnitude²: s1² + s2² − coeff·s1·s2 . Then sqrt → magnitude.
-        int32_t p = s1*s1 + s2*s2 - (int32_t)(((int64_t)c * s1 * s2) >> 13);
-        if (p < 0) p = 0;
-        int32_t mag = (int32_t)isqrt_u((uint32_t)p);
-        mag = (mag * spec_tilt[b]) >> 8;                          // per-band tilt (tame lows)
+        int32_t m = (mag[b] * spec_tilt[b]) >> 8;                 // per-band tilt (tame lows)
         // Gain from Knob Y — gentle so the useful range spans the whole knob (not maxed in
         // the bottom 20%). h in cells.
-        int h = (int)(((int64_t)mag * ky) >> 16);                 // tune the shift for range
+        int h = (int)(((int64_t)m * ky) >> 13);                   // tune the shift for range
         if (h > GREY_H - 1) h = GREY_H - 1;
         // Decay: bars fall smoothly instead of snapping down.
         if (h >= bar[b]) bar[b] = h; else { bar[b] -= fall; if (bar[b] < h) bar[b] = h; }
+        // Peak hold: the marker sits at the highest recent bar, then sinks 1 cell/frame.
+        if (bar[b] >= peak[b]) { peak[b] = bar[b]; hold[b] = SPEC_PEAK_HOLD; }
+        else if (hold[b] > 0) hold[b]--;
+        else peak[b]--;
     }
 
     if (sw == 1) {
@@ -2609,12 +2944,13 @@ static void __not_in_flash_func(spectrum_render)(uint8_t sw, int32_t knob, bool
         //    thin BLACK divider lines every SEG cells; the topmost occupied segment is grey-
         //    shaded by its fractional fill (5 levels). SWAP flips bass↔treble across X. ──
         memset(grey_buffer, 0, GREY_SIZE);
-        const int bw  = GREY_W / SPEC_BANDS;       // ~7 px per band
+        const int bw  = GREY_W / SPEC_BANDS;       // 3 cells per band
+        const int xm  = (GREY_W - bw * SPEC_BANDS) / 2;    // centre the bank
         const int SEG = 6;                         // LED segment height (cells)
         const int base = GREY_H - 1 - NTSC_BOTTOM_INSET;   // bar baseline (raised on NTSC)
         for (int b = 0; b < SPEC_BANDS; b++) {
             int bi = swap ? (SPEC_BANDS - 1 - b) : b;   // swap → reverse bin order on screen
-            int x0 = bi * bw, x1 = x0 + bw - 1;    // 1px gap between bars
+            int x0 = xm + bi * bw, x1 = x0 + bw - 1;    // 1px gap between bars
             int hgt = bar[b];
             for (int seg_base = 0; seg_base < hgt; seg_base += SEG) {
                 int seg_fill = hgt - seg_base;      // cells filled in this segment
@@ -2631,11 +2967,17 @@ static void __not_in_flash_func(spectrum_render)(uint8_t sw, int32_t knob, bool
                     for (int gy = ytop; gy <= ybot; gy++)
                         if (gy >= 0 && gy < GREY_H) GREY_SET(grey_buffer, gy, gx, lvl);
             }
+            // Peak-hold marker: one white cell-row, one cell clear of the bar top.
+            int py = base - peak[b] - 1;
+            if (peak[b] > hgt && py >= 0)
+                for (int gx = x0; gx < x1 && gx < GREY_W; gx++)
+                    GREY_SET(grey_buffer, py, gx, GREY_LEVELS - 1);
         }
     } else {
-        // ── UP: RADIAL BLOB — 24 vertices at even angles, pushed out by magnitude and
+        // ── UP: RADIAL BLOB — SPEC_BANDS vertices at even angles, pushed out by magnitude and
         //    CONNECTED around the perimeter (closed loop). FADE (not clear) → grey echo trail.
-        //    Knob X rotates the whole blob; SWAP reverses the band→angle order. ──
+        //    Knob X rotates the whole blob; SWAP reverses the band→angle order. Peak-hold
+        //    markers ride outside it as grey dots. ──
         static int echo_ctr = 0;
         int echo_every = 8 - fall;
         if (echo_every < 1) echo_every = 1;
@@ -2650,6 +2992,10 @@ static void __not_in_flash_func(spectrum_render)(uint8_t sw, int32_t knob, bool
             int len = RMIN + (bar[b] * (RMAX - RMIN)) / (GREY_H - 1);
             vx[b] = ccx + (cos_a(a) * len >> 8);
             vy[b] = ccy + (sin_a(a) * len >> 8);
+            if (peak[b] > bar[b]) {
+                int plen = RMIN + (peak[b] * (RMAX - RMIN)) / (GREY_H - 1) + 2;
+                plot_dot(ccx + (cos_a(a) * plen >> 8), ccy + (sin_a(a) * plen >> 8), 2);
+            }
         }
         // 2×2-thick perimeter (plot_dot is 2px wide; one extra vertical offset → 2×2).
         for (int b = 0; b < SPEC_BANDS; b++) {
@@ -2697,13 +3043,12 @@ static void __not_in_flash_func(update_framebuffer)() {
                 default: screensaver_bounce();    break;   // 0 = COMET
             }
         }
-        expand_grey_to_fb();
         return;
     }
 
     // Config menu takeover (entered by moving X/Y while DOWN — state owned by Core 0).
     // Force invert off so the menu is always readable (white-on-black).
-    if (shared.menu_active) { effect_invert = false; draw_menu(); expand_grey_to_fb(); return; }
+    if (shared.menu_active) { effect_invert = false; draw_menu(); return; }
 
     // Three independent trigger sources: switch-DOWN→cfg_sw, PU1→cfg_pu1, PU2→cfg_pu2.
     // Each has its own FxState so they don't fight. Read-and-clear the rising latches.
@@ -2723,12 +3068,11 @@ static void __not_in_flash_func(update_framebuffer)() {
     finished |= apply_behaviour(shared.cfg_pu1, pu1_held,  pu1_rising,  fx_pu1,  swap_xy);
     finished |= apply_behaviour(shared.cfg_pu2, pu2_held,  pu2_rising,  fx_pu2,  swap_xy);
     effect_invert = fx_down.strobe_invert || fx_pu1.strobe_invert || fx_pu2.strobe_invert;
-    if (finished) { expand_grey_to_fb(); return; }
+    if (finished) return;
 
     if (mode == MODE_SPECTRUM) {
         etch_have_prev = false;
         spectrum_render(nsw, knob, swap_xy);   // knob-in-zone = decay; swap reverses bins
-        expand_grey_to_fb();
         return;
     }
 
@@ -2844,9 +3188,66 @@ static void __not_in_flash_func(update_framebuffer)() {
             if (++fade_cols >= interval) { fade_cols = 0; fade_step(); }
         }
     }
+}
 
-    // Expand grey buffer → 1-bit frame_buffer (must finish before build_frame_words)
+// ─────────────────────────────────────────────────────────────────────────────
+// Per-frame video work (Core 1) — split out of core1_main so the host harness can
+// drive exactly the same sequence without the PIO/DMA.
+// ─────────────────────────────────────────────────────────────────────────────
+
+// Build the initial frame (back buffer = 1, active = 0): constant sync/blanking
+// templates for both word buffers, then a full encode of the blank picture.
+static void video_init_buffers() {
+    memset(grey_buffer, 0, GREY_SIZE);
+    memset(frame_buffer, 0, FB_SIZE);
+    init_pix_lut();
+#ifndef CATHODE_SCANLINE
+    build_frame_template(0);
+    build_frame_template(1);
+    grey_force_full = true;
+    expand_grey_to_fb();          // ensure frame_buffer is valid before first pack
+    build_frame_words(0, false);
+    build_frame_words(1, false);
+    active_buf = 0;
+#else
+    scan_init_lines();
+    grey_force_full = true;
+    expand_grey_to_fb();
+    scan_rendered = 0;
+#endif
+}
+
+// Draw the new frame into the grey buffer from the Eurorack I/O state.
+static void __not_in_flash_func(video_draw)() {
+    // Advance the dither orientation every 2 frames (rotates the 2×2 patterns so
+    // greys average out over time → smoother, less fixed checkerboard).
+    static uint32_t frame_counter = 0;
+    frame_counter++;
+    dither_orient = (frame_counter >> 1) & 3;
+
+    update_framebuffer();
+}
+
+#ifndef CATHODE_SCANLINE
+// Expand the changed grey rows → 1-bit frame_buffer (must finish before
+// build_frame_words), re-pack them into the back buffer and queue it for scan-out.
+static void __not_in_flash_func(video_encode)() {
     expand_grey_to_fb();
+
+    // Bring the back buffer's word stream up to date (dirty rows only)
+    int back = 1 - active_buf;
+    bool invert = effect_invert;  // INVERT behaviour / strobe set this on Core 1
+    build_frame_words(back, invert);
+
+    // Swap buffers: next DMA IRQ handler will restart using the new active_buf.
+    // The current DMA is already running (restarted in IRQ handler) using the OLD active_buf.
+    // We update active_buf now so the NEXT restart uses the new one.
+    active_buf = back;
+}
+
+static void __not_in_flash_func(video_frame)() {
+    video_draw();
+    video_encode();
 }
 
 // ─────────────────────────────────────────────────────────────────────────────
@@ -2864,6 +3265,42 @@ static void __not_in_flash_func(dma_irq_handler)() {
 
     vblank_ready = true;
 }
+#else
+// Scanline mode: the line IRQ packs rows straight out of frame_buffer as the beam
+// approaches them, so there is one picture, updated at the top of each frame: expand
+// (changed rows, top to bottom) races ahead of the beam during vsync + top blanking, then
+// the next frame is drawn into the grey buffer while this one is scanned.
+// If drawing overran so far into the frame that the beam would catch the expand, skip
+// publishing until the next frame start (the old picture simply stays up one more frame).
+#define SCAN_EXPAND_LATE    (TV_FIRST_ACTIVE - LINE_RING)
+
+static void __not_in_flash_func(video_frame)() {
+    expand_grey_to_fb();
+    video_draw();
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// DMA IRQ handler (Core 1), scanline mode. Two sources on DMA_IRQ_1:
+//   control channel done → a new line has started: pack rows into free ring slots.
+//   data channel (IRQ_QUIET) null trigger → the frame's line list is exhausted: rewind
+//     the control channel to line 0 (restarts video immediately), latch invert for the
+//     new frame and signal Core 1's update loop via vblank_ready.
+// ─────────────────────────────────────────────────────────────────────────────
+static void __not_in_flash_func(dma_irq_handler)() {
+    uint32_t st = dma_hw->ints1;
+    if (st & (1u << dma_chan)) {
+        dma_hw->ints1 = 1u << dma_chan;
+        dma_channel_set_read_addr(dma_ctrl_chan, line_ptrs, true);
+        scan_rendered = 0;
+        scan_xr = effect_invert ? 0xFF : 0x00;
+        vblank_ready = true;
+    }
+    if (st & (1u << dma_ctrl_chan)) {
+        dma_hw->ints1 = 1u << dma_ctrl_chan;
+        scan_render_ahead(scan_current_line());
+    }
+}
+#endif
 
 // ─────────────────────────────────────────────────────────────────────────────
 // Core 1 entry point
@@ -2885,7 +3322,11 @@ static void __not_in_flash_func(core1_main)() {
     pio_sm_config c = video_out_program_get_default_config(offset);
     sm_config_set_out_pins(&c, VIDEO_GPIO, 2);     // GPIO 8,9 = 2-bit video DAC
     sm_config_set_out_shift(&c, false, true, 32);  // shift left, autopull, threshold=32
-    sm_config_set_clkdiv(&c, 144.0f/7.0f);         // 144 MHz / 20.571 = 7.000 MHz = 142.857 ns/pixel
+    sm_config_set_clkdiv(&c, VIDEO_CLKDIV);        // 144 MHz / 20.571 = 7.000 MHz = 142.857 ns/pixel
+#ifdef CATHODE_SCANLINE
+    // 8-word TX FIFO (128 px ≈ 18µs) covers the frame-end IRQ that rewinds the line list.
+    sm_config_set_fifo_join(&c, PIO_FIFO_JOIN_TX);
+#endif
 
     pio_sm_set_consecutive_pindirs(pio, sm, VIDEO_GPIO, 2, true);  // GPIO 8,9 output
     pio_sm_init(pio, sm, offset, &c);
@@ -2898,14 +3339,9 @@ static void __not_in_flash_func(core1_main)() {
     dma_chan = 6;
     dma_channel_claim(dma_chan);
 
-    // Build initial frame (back buffer = 1, active = 0)
-    memset(grey_buffer, 0, GREY_SIZE);
-    memset(frame_buffer, 0, FB_SIZE);
-    expand_grey_to_fb();          // ensure frame_buffer is valid before first pack
-    build_frame_words(0, false);
-    build_frame_words(1, false);
-    active_buf = 0;
+    video_init_buffers();
 
+#ifndef CATHODE_SCANLINE
     // Configure DMA: read from word_buf[0], write to PIO TX FIFO, loop
     dma_channel_config dc = dma_channel_get_default_config(dma_chan);
     channel_config_set_transfer_data_size(&dc, DMA_SIZE_32);
@@ -2929,6 +3365,37 @@ static void __not_in_flash_func(core1_main)() {
     // Start PIO SM and DMA
     pio_sm_set_enabled(pio, sm, true);
     dma_channel_start(dma_chan);
+#else
+    // Data channel (6): one line buffer → PIO TX FIFO, then chains to the control channel.
+    // IRQ_QUIET: no IRQ per line, only on the NULL that ends line_ptrs[] (frame end).
+    dma_ctrl_chan = 7;
+    dma_channel_claim(dma_ctrl_chan);
+    dma_channel_config dc = dma_channel_get_default_config(dma_chan);
+    channel_config_set_transfer_data_size(&dc, DMA_SIZE_32);
+    channel_config_set_read_increment(&dc, true);
+    channel_config_set_write_increment(&dc, false);
+    channel_config_set_dreq(&dc, pio_get_dreq(pio, sm, true));  // pace to PIO TX FIFO
+    channel_config_set_chain_to(&dc, dma_ctrl_chan);
+    channel_config_set_irq_quiet(&dc, true);
+    dma_channel_configure(dma_chan, &dc, &pio->txf[sm], line_ptrs[0], LINE_WORDS, false);
+
+    // Control channel (7): copies the next line pointer into the data channel's
+    // read-address trigger register, one per line (its completion IRQ = "line started").
+    dma_channel_config cc = dma_channel_get_default_config(dma_ctrl_chan);
+    channel_config_set_transfer_data_size(&cc, DMA_SIZE_32);
+    channel_config_set_read_increment(&cc, true);
+    channel_config_set_write_increment(&cc, false);
+    dma_channel_configure(dma_ctrl_chan, &cc, &dma_hw->ch[dma_chan].al3_read_addr_trig,
+                          line_ptrs, 1, false);
+
+    dma_channel_set_irq1_enabled(dma_chan, true);
+    dma_channel_set_irq1_enabled(dma_ctrl_chan, true);
+    irq_set_exclusive_handler(DMA_IRQ_1, dma_irq_handler);
+    irq_set_enabled(DMA_IRQ_1, true);
+
+    pio_sm_set_enabled(pio, sm, true);
+    dma_channel_start(dma_ctrl_chan);
+#endif
 
     // Main Core 1 loop: update framebuffer each vblank
     while (1) {
@@ -2937,25 +3404,10 @@ static void __not_in_flash_func(core1_main)() {
             tight_loop_contents();
         }
         vblank_ready = false;
-
-        // Advance the dither orientation every 2 frames (rotates the 2×2 patterns so
-        // greys average out over time → smoother, less fixed checkerboard).
-        static uint32_t frame_counter = 0;
-        frame_counter++;
-        dither_orient = (frame_counter >> 1) & 3;
-
-        // Update framebuffer with new Eurorack I/O state
-        update_framebuffer();
-
-        // Build new word stream into back buffer
-        int back = 1 - active_buf;
-        bool invert = effect_invert;  // INVERT behaviour / strobe set this on Core 1
-        build_frame_words(back, invert);
-
-        // Swap buffers: next DMA IRQ handler will restart using the new active_buf.
-        // The current DMA is already running (restarted in IRQ handler) using the OLD active_buf.
-        // We update active_buf now so the NEXT restart uses the new one.
-        active_buf = back;
+#ifdef CATHODE_SCANLINE
+        if (scan_current_line() >= SCAN_EXPAND_LATE) continue;   // overran: publish next frame
+#endif
+        video_frame();
     }
 }
 
@@ -3246,6 +3698,7 @@ public:
     }
 };
 
+#ifndef CATHODE_HOST
 // Global instance — must not be on stack (ComputerCard requirement, stack = 4 KB)
 CathodeRay g_card;
 
@@ -3253,3 +3706,4 @@ int main() {
     set_sys_clock_khz(144000, true);
     g_card.Run();  // blocking — never returns
 }
+#endif